@@ -132,6 +132,10 @@ void lake_AES_GCM_destroy(struct AES_GCM_engine_ctx* d_engine) {
     hipHostUnregister(d_engine->h_dst_mapped);
     kava_free(d_engine->h_src_mapped);
     kava_free(d_engine->h_dst_mapped);
+#ifdef __KERNEL__
+    lake_batch_free(d_engine->mac_batch);
+    d_engine->mac_batch = NULL;
+#endif
     PRINT("FREE!\n");
 }
 
@@ -216,6 +220,19 @@ static void lake_AES_GCM_compute_mac(struct AES_GCM_engine_ctx* d_engine, hipDev
         &d_engine->HH, &d_engine->sbox, &d_engine->aes_roundkey, &d_engine->nonce_device,
         &dst, &size, &src };
 
+#ifdef __KERNEL__
+    //the four launches are chained on the same stream, send them as one command
+    struct lake_batch *b = d_engine->mac_batch;
+    lake_batch_hipModuleLaunchKernel(b, d_engine->mac_kernel, AES_GCM_STEP, 1, 1, 
+            AES_GCM_STEP, 1, 1, 0, 0, args, 0);
+    lake_batch_hipModuleLaunchKernel(b, d_engine->mac_kernel, AES_GCM_STEP / 8, 1, 1, 
+            8, 1, 1, 0, 0, args2, 0);
+    lake_batch_hipModuleLaunchKernel(b, d_engine->mac_kernel, 1, 1, 1, 
+            1, 1, 1, 0, 0, args3, 0);
+    lake_batch_hipModuleLaunchKernel(b, d_engine->final_mac_kernel, 1, 1, 1, 
+            1, 1, 1, 0, 0, args4, 0);
+    lake_batch_flush(b, 0, NULL);
+#else
     hipModuleLaunchKernel(d_engine->mac_kernel, AES_GCM_STEP, 1, 1, 
             AES_GCM_STEP, 1, 1, 0, 0, args, 0);
     hipModuleLaunchKernel(d_engine->mac_kernel, AES_GCM_STEP / 8, 1, 1, 
@@ -224,6 +241,7 @@ static void lake_AES_GCM_compute_mac(struct AES_GCM_engine_ctx* d_engine, hipDev
             1, 1, 1, 0, 0, args3, 0);
     hipModuleLaunchKernel(d_engine->final_mac_kernel, 1, 1, 1, 
             1, 1, 1, 0, 0, args4, 0);
+#endif
 }
 
 //TODO: set IV
@@ -337,6 +355,13 @@ int lake_AES_GCM_init_fns(struct AES_GCM_engine_ctx *d_engine, char *hsaco_path)
         PRINT("[lake] Error: load decrypt kernel\n");
         return -ENOSYS;
     }
+#ifdef __KERNEL__
+    d_engine->mac_batch = lake_batch_alloc();
+    if (!d_engine->mac_batch) {
+        PRINT("[lake] Error: allocate command batch\n");
+        return -ENOMEM;
+    }
+#endif
     return 0;
 }
 
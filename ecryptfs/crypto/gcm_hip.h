@@ -5,6 +5,7 @@
 #include <linux/kernel.h>
 #include <linux/module.h>
 #include <hip_runtime_api_mini.h>
+#include "lake_batch.h"
 #else
 #include <stdio.h>
 #include <string.h>
@@ -124,6 +125,9 @@ struct AES_GCM_engine_ctx {
     hipFunction_t encrypt_oneblock_kernel;
     hipFunction_t next_nonce_kernel;
     hipStream_t *g_stream;
+#ifdef __KERNEL__
+    struct lake_batch *mac_batch;
+#endif
 };
 
 void lake_AES_GCM_alloc_pages(hipDeviceptr_t* src, u32 size);
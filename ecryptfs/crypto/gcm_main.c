@@ -44,6 +44,7 @@
 #include <linux/fs.h> 
 #include <asm/uaccess.h>
 #include "lake_shm.h"
+#include "lake_copy.h"
 #include "gcm_hip.h"
 
 static char *cubin_path = "gcm_kernels.cubin";
@@ -134,8 +135,7 @@ static int crypto_gcm_encrypt(struct aead_request *req)
 	struct crypto_aead *tfm = crypto_aead_reqtfm(req);
 	struct crypto_gcm_ctx *ctx = crypto_aead_ctx(tfm);
 	struct aead_request **aead_req = NULL;
-	int count_dst = 0, lake_count = 0;
-	void* buf;
+	int lake_count = 0;
 	struct scatterlist *src_sg = req->src;
 	struct scatterlist *dst_sg = req->dst;
 	// hipDeviceptr_t d_src = ctx->cuda_ctx.d_src;
@@ -144,6 +144,8 @@ static int crypto_gcm_encrypt(struct aead_request *req)
 	int npages, i;
 	int *rcs;
 	int aesni_n, lake_n;
+	struct lake_future *gpu_done = NULL;
+	CUresult cu_err;
 	struct extent_crypt_result *ecrs;
 
 	npages = sg_nents(src_sg);
@@ -170,31 +172,10 @@ static int crypto_gcm_encrypt(struct aead_request *req)
 		// ctx->cuda_ctx.d_buffer=d_buffer;
 
 //--------------------------------将待加密数据拷到src
-		// 预计算目标缓冲区指针，减少重复计算
-		char *target_buf = ctx->cuda_ctx.h_src_mapped;
-	
-		// 优化：使用更大的块大小进行拷贝，减少循环开销
-		#define OPTIMIZED_COPY_SIZE (16 * PAGE_SIZE)  // 4页作为一个块
-		int remaining_pages = npages - aesni_n;
-		int full_blocks = remaining_pages / 16;
-		int remaining_single = remaining_pages % 16;
-		
-		// 处理完整的4页块
-		for(int block = 0; block < full_blocks; block++) {
-			for(int j = 0; j < 16; j++) {
-				buf = sg_virt(&src_sg[aesni_n + block * 16 + j]);
-				memcpy(target_buf + j * PAGE_SIZE, buf, PAGE_SIZE);
-			}
-			target_buf += OPTIMIZED_COPY_SIZE;
-			lake_count += 16;
-		}
-		
-		// 处理剩余的单个页面
-		for(int j = 0; j < remaining_single; j++) {
-			buf = sg_virt(&src_sg[aesni_n + full_blocks * 16 + j]);
-			memcpy(target_buf + j * PAGE_SIZE, buf, PAGE_SIZE);
-			lake_count++;
-		}
+		// staging copy, non-temporal and split over cpus when it is large
+		lake_memcpy_sg(ctx->cuda_ctx.h_src_mapped, &src_sg[aesni_n], 1, PAGE_SIZE,
+				lake_n, PAGE_SIZE, LAKE_COPY_FROM_SG);
+		lake_count = lake_n;
 
 		
 
@@ -222,6 +203,8 @@ static int crypto_gcm_encrypt(struct aead_request *req)
 		// ctx->cuda_ctx.d_src_mapped=d_src_mapped;
 //--------------------------------加密，结果放在ctx->cuda_ctx.d_buffer
 		lake_AES_GCM_encrypt(&ctx->cuda_ctx, ctx->cuda_ctx.d_dst_mapped, ctx->cuda_ctx.d_src_mapped, lake_count*PAGE_SIZE);
+		// get the sync on its way now, we only collect it after the AESNI work
+		gpu_done = lake_future_hipDeviceSynchronize();
 		//PRINT("Done encrypt\n");
 	}
 
@@ -241,6 +224,8 @@ static int crypto_gcm_encrypt(struct aead_request *req)
 			aead_req[i] = aead_request_alloc(ctx->aesni_tfm, GFP_NOFS);
 			if (!aead_req[i]) {
 				printk(KERN_ERR "err aead_request_alloc\n");
+				if (gpu_done)
+					lake_future_release(gpu_done);
 				return -1;
 			}
 			init_completion(&ecrs[i].completion);
@@ -259,16 +244,16 @@ static int crypto_gcm_encrypt(struct aead_request *req)
 		//copy cipher back
 		//lake_AES_GCM_copy_from_device(pages_buf, d_dst, lake_count*PAGE_SIZE);
 		//TODO: copy back MACs
-		hipDeviceSynchronize();
+		// the sync was sent right after the launch, it has been running under the AESNI work
+		cu_err = lake_future_wait(gpu_done, MAX_SCHEDULE_TIMEOUT, NULL);
+		lake_future_release(gpu_done);
+		if (cu_err != CUDA_SUCCESS)
+			printk(KERN_ERR "encrypt: GPU error %d\n", cu_err);
 //将加密后的数据写回buf
-		for(i = aesni_n ; i < npages ; i++) {
-			// cipher sg
-			buf = sg_virt(&dst_sg[i*2]);
-			memcpy(buf, ctx->cuda_ctx.h_dst_mapped+(count_dst * (PAGE_SIZE+crypto_aead_aes256gcm_ABYTES)), PAGE_SIZE);
-			//TODO: copy MAC
-			//memcpy(buf, pages_buf+((count_dst*PAGE_SIZE) + PAGE_SIZE), crypto_aead_aes256gcm_ABYTES);
-			count_dst++;
-		}
+		// cipher sg
+		lake_memcpy_sg(ctx->cuda_ctx.h_dst_mapped, &dst_sg[aesni_n*2], 2,
+				PAGE_SIZE+crypto_aead_aes256gcm_ABYTES, lake_n, PAGE_SIZE, LAKE_COPY_TO_SG);
+		//TODO: copy MAC
 	}
 
 	if (aesni_n > 0) {
@@ -302,8 +287,7 @@ static int crypto_gcm_decrypt(struct aead_request *req)
 	struct crypto_aead *tfm = crypto_aead_reqtfm(req);
 	struct crypto_gcm_ctx *ctx = crypto_aead_ctx(tfm);
 	struct aead_request **aead_req = NULL;
-	int count_dst = 0, lake_count = 0;
-	void* buf;
+	int lake_count = 0;
 	struct scatterlist *src_sg = req->src; 
 	struct scatterlist *dst_sg = req->dst; 
 	CUdeviceptr d_src = ctx->cuda_ctx.d_src;
@@ -312,6 +296,8 @@ static int crypto_gcm_decrypt(struct aead_request *req)
 	int npages, i;
 	int *rcs;
 	int aesni_n, lake_n;
+	struct lake_future *gpu_done = NULL;
+	CUresult cu_err;
 	struct extent_crypt_result *ecrs;
 
 	npages = sg_nents(src_sg);
@@ -333,35 +319,11 @@ static int crypto_gcm_decrypt(struct aead_request *req)
 		// 	return -1;
 		// }
 
-		char *target_buf = ctx->cuda_ctx.h_src_mapped;
-		
-		// 优化：使用更大的块大小进行拷贝，减少循环开销
-		// 注意：这里使用i*2的索引模式，所以需要调整块大小计算
-		#define OPTIMIZED_COPY_SIZE_DECRYPT (16 * PAGE_SIZE)  // 16页作为一个块
-		int remaining_pages = npages - aesni_n;
-		int full_blocks = remaining_pages / 16;
-		int remaining_single = remaining_pages % 16;
-		
-		// 处理完整的16页块
-		for(int block = 0; block < full_blocks; block++) {
-			for(int j = 0; j < 16; j++) {
-				int actual_index = aesni_n + block * 16 + j;
-				buf = sg_virt(&src_sg[actual_index * 2]);  // 注意i*2的索引模式
-				memcpy(target_buf + j * PAGE_SIZE, buf, PAGE_SIZE);
-				//TODO: copy MACs sg_virt(&src_sg[actual_index * 2 + 1]);
-			}
-			target_buf += OPTIMIZED_COPY_SIZE_DECRYPT;
-			lake_count += 16;
-		}
-		
-		// 处理剩余的单个页面
-		for(int j = 0; j < remaining_single; j++) {
-			int actual_index = aesni_n + full_blocks * 16 + j;
-			buf = sg_virt(&src_sg[actual_index * 2]);  // 注意i*2的索引模式
-			memcpy(target_buf + j * PAGE_SIZE, buf, PAGE_SIZE);
-			//TODO: copy MACs sg_virt(&src_sg[actual_index * 2 + 1]);
-			lake_count++;
-		}
+		// staging copy, non-temporal and split over cpus when it is large
+		lake_memcpy_sg(ctx->cuda_ctx.h_src_mapped, &src_sg[aesni_n*2], 2, PAGE_SIZE,
+				lake_n, PAGE_SIZE, LAKE_COPY_FROM_SG);
+		//TODO: copy MACs sg_virt(&src_sg[i*2 + 1]);
+		lake_count = lake_n;
 		
 		// PRINT("decrypt: done copying to SHAREDMEM\n");
 		// //lake_AES_GCM_copy_to_device(d_src, pages_buf, lake_n*PAGE_SIZE);
@@ -382,6 +344,8 @@ static int crypto_gcm_decrypt(struct aead_request *req)
    		// hipStreamSynchronize(0);
 		// //TODO: copy MACs too
 		lake_AES_GCM_decrypt(&ctx->cuda_ctx, ctx->cuda_ctx.d_dst_mapped, ctx->cuda_ctx.d_src_mapped, lake_n*PAGE_SIZE);
+		// get the sync on its way now, we only collect it after the AESNI work
+		gpu_done = lake_future_hipDeviceSynchronize();
 		
 	}
 
@@ -401,6 +365,8 @@ static int crypto_gcm_decrypt(struct aead_request *req)
 			aead_req[i] = aead_request_alloc(ctx->aesni_tfm, GFP_NOFS);
 			if (!aead_req[i]) {
 				printk(KERN_ERR "err aead_request_alloc\n");
+				if (gpu_done)
+					lake_future_release(gpu_done);
 				return -1;
 			}
 			init_completion(&ecrs[i].completion);
@@ -419,13 +385,14 @@ static int crypto_gcm_decrypt(struct aead_request *req)
 		// lake_AES_GCM_copy_from_device(pages_buf, d_dst, lake_n*PAGE_SIZE);
 		// hipStreamSynchronize(0);
 		//将解密完成的数据拷回来
-		hipDeviceSynchronize();
-		for(i = aesni_n ; i < npages ; i++) {
-			// plain sg
-			buf = sg_virt(&dst_sg[i]);
-			memcpy(buf, ctx->cuda_ctx.h_dst_mapped+(count_dst * PAGE_SIZE), PAGE_SIZE);
-			count_dst++;
-		}
+		// the sync was sent right after the launch, it has been running under the AESNI work
+		cu_err = lake_future_wait(gpu_done, MAX_SCHEDULE_TIMEOUT, NULL);
+		lake_future_release(gpu_done);
+		if (cu_err != CUDA_SUCCESS)
+			printk(KERN_ERR "decrypt: GPU error %d\n", cu_err);
+		// plain sg
+		lake_memcpy_sg(ctx->cuda_ctx.h_dst_mapped, &dst_sg[aesni_n], 1, PAGE_SIZE,
+				lake_n, PAGE_SIZE, LAKE_COPY_TO_SG);
 
 			// 打印src_sg和dst_sg前check_blocks块的内容来确认结果是否一致
 			// 注意：src_sg和dst_sg的对应关系是跳跃的：
@@ -44,6 +44,7 @@
 #include <linux/fs.h> 
 #include <asm/uaccess.h>
 #include "lake_shm.h"
+#include "lake_copy.h"
 #include "gcm_cuda.h"
 
 static char *cubin_path = "gcm_kernels.cubin";
@@ -126,8 +127,7 @@ static int crypto_gcm_encrypt(struct aead_request *req)
 	struct crypto_aead *tfm = crypto_aead_reqtfm(req);
 	struct crypto_gcm_ctx *ctx = crypto_aead_ctx(tfm);
 	struct aead_request **aead_req = NULL;
-	int count_dst = 0, lake_count = 0;
-	void* buf;
+	int lake_count = 0;
 	struct scatterlist *src_sg = req->src;
 	struct scatterlist *dst_sg = req->dst;
 	CUdeviceptr d_src = ctx->cuda_ctx.d_src;
@@ -151,11 +151,9 @@ static int crypto_gcm_encrypt(struct aead_request *req)
 	if (lake_n > 0) {
 		pages_buf = (char *)kava_alloc(lake_n*PAGE_SIZE);
 
-		for(i = aesni_n ; i < npages ; i++) {
-			buf = sg_virt(&src_sg[i]);
-			memcpy(pages_buf+(lake_count*PAGE_SIZE), buf, PAGE_SIZE);
-			lake_count++;	
-		}
+		lake_memcpy_sg(pages_buf, &src_sg[aesni_n], 1, PAGE_SIZE,
+				lake_n, PAGE_SIZE, LAKE_COPY_FROM_SG);
+		lake_count = lake_n;
 		//TODO: copy IVs, set enc to use it. it's currently constant and set at setkey
 		lake_AES_GCM_copy_to_device(d_src, pages_buf, lake_count*PAGE_SIZE);
 		lake_AES_GCM_encrypt(&ctx->cuda_ctx, d_dst, d_src, lake_count*PAGE_SIZE);
@@ -196,14 +194,10 @@ static int crypto_gcm_encrypt(struct aead_request *req)
 		//TODO: copy back MACs
 		cuCtxSynchronize();
 
-		for(i = aesni_n ; i < npages ; i++) {
-			// cipher sg
-			buf = sg_virt(&dst_sg[i*2]);
-			memcpy(buf, pages_buf+(count_dst * PAGE_SIZE), PAGE_SIZE);
-			//TODO: copy MAC
-			//memcpy(buf, pages_buf+((count_dst*PAGE_SIZE) + PAGE_SIZE), crypto_aead_aes256gcm_ABYTES);
-			count_dst++;
-		}
+		// cipher sg
+		lake_memcpy_sg(pages_buf, &dst_sg[aesni_n*2], 2, PAGE_SIZE,
+				lake_n, PAGE_SIZE, LAKE_COPY_TO_SG);
+		//TODO: copy MAC
 		kava_free(pages_buf);
 	}
 
@@ -235,8 +229,7 @@ static int crypto_gcm_decrypt(struct aead_request *req)
 	struct crypto_aead *tfm = crypto_aead_reqtfm(req);
 	struct crypto_gcm_ctx *ctx = crypto_aead_ctx(tfm);
 	struct aead_request **aead_req = NULL;
-	int count_dst = 0, lake_count = 0;
-	void* buf;
+	int lake_count = 0;
 	struct scatterlist *src_sg = req->src; 
 	struct scatterlist *dst_sg = req->dst; 
 	CUdeviceptr d_src = ctx->cuda_ctx.d_src;
@@ -267,12 +260,10 @@ static int crypto_gcm_decrypt(struct aead_request *req)
 			return -1;
 		}
 
-		for(i = aesni_n ; i < npages ; i++) {
-			buf = sg_virt(&src_sg[i*2]);	
-			memcpy(pages_buf+(lake_count*PAGE_SIZE), buf, PAGE_SIZE);
-			//TODO: copy MACs sg_virt(&src_sg[i*2+1]);	
-			lake_count++; 
-		}
+		lake_memcpy_sg(pages_buf, &src_sg[aesni_n*2], 2, PAGE_SIZE,
+				lake_n, PAGE_SIZE, LAKE_COPY_FROM_SG);
+		//TODO: copy MACs sg_virt(&src_sg[i*2+1]);
+		lake_count = lake_n;
 
 		lake_AES_GCM_copy_to_device(d_src, pages_buf, lake_n*PAGE_SIZE);
 		//TODO: copy MACs too
@@ -313,12 +304,9 @@ static int crypto_gcm_decrypt(struct aead_request *req)
 		lake_AES_GCM_copy_from_device(pages_buf, d_dst, lake_n*PAGE_SIZE);
 		cuCtxSynchronize();
 
-		for(i = aesni_n ; i < npages ; i++) {
-			// plain sg
-			buf = sg_virt(&dst_sg[i]);
-			memcpy(buf, pages_buf+(count_dst * PAGE_SIZE), PAGE_SIZE);
-			count_dst++;
-		}
+		// plain sg
+		lake_memcpy_sg(pages_buf, &dst_sg[aesni_n], 1, PAGE_SIZE,
+				lake_n, PAGE_SIZE, LAKE_COPY_TO_SG);
 		kava_free(pages_buf);
 	}
 	
@@ -31,59 +31,122 @@
 
 #include "cuda.h"
 #include "hip_runtime_api_mini.h"
+#include "lake_devpool.h"
+#include "lake_ring.h"
 
 typedef unsigned int u32;
 
 #define CMD_ASYNC 0
 #define CMD_SYNC  1
+// reply is kept in the in-flight slot until the caller collects it, see lake_future.h
+#define CMD_FUTURE 2
 
+/*
+ * Every command of the kapi protocol, one line each, in LAKE_API_* id
+ * order. The ids go on the wire, so new commands are appended. This table
+ * generates the ids, the command structs and their size checks, the
+ * senders of the kernel stubs (kernel/lake_kapi.h), the handler tables of
+ * lake_uspace and the trace names.
+ *
+ *   X(name, policy, order, (fields))
+ *
+ * policy, how the kernel stub waits for the reply:
+ *   SYNC   waits for it
+ *   ASYNC  does not, errors show up at the next synchronize
+ *   FREE   async if lake_async_free is set and dptr is not NULL, see devpool.c
+ *   VAR    variable size command, built and sent by its own code: launches
+ *          (async), batches (batch.c) and function lookups (module.c)
+ * order, how the command is ordered against others (sync.c, dispatcher):
+ *   NONE     against everything
+ *   WORK     queues device work on its hStream
+ *   SYNC     synchronizes its hStream
+ *   DEVSYNC  synchronizes the device
+ * fields, after the u32 API_ID every command starts with:
+ *   F(type, name), A(type, name, elements)
+ *
+ * Generators only use name pasted: cuda.h defines some of the API names
+ * (cuMemAlloc to cuMemAlloc_v2, ...), so name must not reach another
+ * macro as an argument on its own.
+ */
+#define LAKE_APIS(X) \
+    X(cuInit,                  SYNC,  NONE,    (F(int, flags))) \
+    X(cuDeviceGet,             SYNC,  NONE,    (F(int, ordinal))) \
+    X(cuCtxCreate,             SYNC,  NONE,    (F(unsigned int, flags) F(CUdevice, dev))) \
+    X(cuModuleLoad,            SYNC,  NONE,    (A(char, fname, 256))) \
+    X(cuModuleUnload,          SYNC,  NONE,    (F(CUmodule, hmod))) \
+    X(cuModuleGetFunction,     SYNC,  NONE,    (F(CUmodule, hmod) A(char, name, 256))) \
+    X(cuLaunchKernel,          VAR,   WORK,    (F(CUfunction, f) \
+        F(unsigned int, gridDimX) F(unsigned int, gridDimY) F(unsigned int, gridDimZ) \
+        F(unsigned int, blockDimX) F(unsigned int, blockDimY) F(unsigned int, blockDimZ) \
+        F(unsigned int, sharedMemBytes) F(CUstream, hStream) \
+        F(void **, extra) /* always NULL */ \
+        F(unsigned int, paramsSize) /* of the serialized args that follow */)) \
+    X(cuCtxDestroy,            SYNC,  NONE,    (F(CUcontext, ctx))) \
+    X(cuMemAlloc,              SYNC,  NONE,    (F(size_t, bytesize))) \
+    X(cuMemcpyHtoD,            SYNC,  NONE,    (F(CUdeviceptr, dstDevice) F(const void *, srcHost) \
+        F(size_t, ByteCount))) \
+    X(cuMemcpyDtoH,            SYNC,  NONE,    (F(void *, dstHost) F(CUdeviceptr, srcDevice) \
+        F(size_t, ByteCount))) \
+    X(cuCtxSynchronize,        SYNC,  DEVSYNC, ()) \
+    X(cuMemFree,               FREE,  NONE,    (F(CUdeviceptr, dptr))) \
+    X(cuStreamCreate,          SYNC,  NONE,    (F(unsigned int, Flags))) \
+    X(cuStreamSynchronize,     SYNC,  SYNC,    (F(CUstream, hStream))) \
+    X(cuStreamDestroy,         SYNC,  NONE,    (F(CUstream, hStream))) \
+    X(cuMemcpyHtoDAsync,       ASYNC, WORK,    (F(CUdeviceptr, dstDevice) F(const void *, srcHost) \
+        F(size_t, ByteCount) F(CUstream, hStream))) \
+    X(cuMemcpyDtoHAsync,       ASYNC, WORK,    (F(void *, dstHost) F(CUdeviceptr, srcDevice) \
+        F(size_t, ByteCount) F(CUstream, hStream))) \
+    X(cuMemAllocPitch,         SYNC,  NONE,    (F(size_t, WidthInBytes) F(size_t, Height) \
+        F(unsigned int, ElementSizeBytes))) \
+    X(kleioLoadModel,          SYNC,  NONE,    (F(const void *, srcHost) F(size_t, len))) \
+    X(kleioInference,          SYNC,  NONE,    (F(const void *, srcHost) F(size_t, len) F(int, use_gpu))) \
+    X(kleioForceGC,            SYNC,  NONE,    ()) \
+    X(nvmlRunningProcs,        SYNC,  NONE,    ()) \
+    X(nvmlUtilRate,            SYNC,  NONE,    ()) \
+    X(hipInit,                 SYNC,  NONE,    (F(int, flags))) \
+    X(hipDeviceGet,            SYNC,  NONE,    (F(int, ordinal))) \
+    X(hipHostMalloc,           SYNC,  NONE,    (F(size_t, size) F(unsigned int, flags))) \
+    X(hipHostGetDevicePointer, SYNC,  NONE,    (F(void *, hstPtr) F(unsigned int, flags))) \
+    X(hipHostFree,             SYNC,  NONE,    (F(void *, ptr))) \
+    X(hipHostRegister,         SYNC,  NONE,    (F(void *, hostPtr) F(size_t, sizeBytes) \
+        F(unsigned int, flags))) \
+    X(hipHostUnregister,       SYNC,  NONE,    (F(void *, hostPtr))) \
+    X(hipCtxCreate,            SYNC,  NONE,    (F(unsigned int, flags) F(hipDevice_t, dev))) \
+    X(hipModuleGetFunction,    SYNC,  NONE,    (F(hipModule_t, hmod) A(char, name, 256))) \
+    X(hipMalloc,               SYNC,  NONE,    (F(size_t, bytesize))) \
+    X(hipFree,                 FREE,  NONE,    (F(CUdeviceptr, dptr))) \
+    X(hipMemcpyHtoDAsync,      ASYNC, WORK,    (F(CUdeviceptr, dstDevice) F(const void *, srcHost) \
+        F(size_t, ByteCount) F(hipStream_t, hStream))) \
+    X(hipMemcpyHtoD,           SYNC,  NONE,    (F(hipDeviceptr_t, dstDevice) F(const void *, srcHost) \
+        F(size_t, ByteCount))) \
+    X(hipMemcpyDtoH,           SYNC,  NONE,    (F(void *, dstHost) F(hipDeviceptr_t, srcDevice) \
+        F(size_t, ByteCount))) \
+    X(hipDeviceSynchronize,    SYNC,  DEVSYNC, ()) \
+    X(hipModuleLaunchKernel,   VAR,   WORK,    (F(hipFunction_t, f) \
+        F(unsigned int, gridDimX) F(unsigned int, gridDimY) F(unsigned int, gridDimZ) \
+        F(unsigned int, blockDimX) F(unsigned int, blockDimY) F(unsigned int, blockDimZ) \
+        F(unsigned int, sharedMemBytes) F(hipStream_t, hStream) \
+        F(void **, extra) /* always NULL */ \
+        F(unsigned int, paramsSize) /* of the serialized args that follow */)) \
+    X(hipModuleLoad,           SYNC,  NONE,    (A(char, fname, 256))) \
+    X(hipStreamCreate,         SYNC,  NONE,    (F(unsigned int, Flags))) \
+    X(hipStreamSynchronize,    SYNC,  SYNC,    (F(hipStream_t, hStream))) \
+    X(hipStreamDestroy,        SYNC,  NONE,    (F(hipStream_t, hStream))) \
+    X(hipCtxDestroy,           SYNC,  NONE,    (F(hipCtx_t, ctx))) \
+    X(hipMemcpyDtoHAsync,      ASYNC, WORK,    (F(void *, dstHost) F(hipDeviceptr_t, srcDevice) \
+        F(size_t, ByteCount) F(hipStream_t, hStream))) \
+    X(batch,                   VAR,   NONE,    (F(u32, n_cmds) F(u32, size) /* including this header */)) \
+    X(cuModuleGetFunctions,    VAR,   NONE,    (F(u32, n_funcs) F(u32, size) /* including this header */ \
+        F(CUmodule, hmod) F(void *, funcs) /* kava_shm offset */ A(char, names, ))) \
+    X(hipModuleGetFunctions,   VAR,   NONE,    (F(u32, n_funcs) F(u32, size) /* including this header */ \
+        F(hipModule_t, hmod) F(void *, funcs) /* kava_shm offset */ A(char, names, ))) \
+    X(devpoolStats,            SYNC,  NONE,    (F(void *, stats) /* kava_shm offset */)) \
+    X(devpoolTrim,             SYNC,  NONE,    ())
+
+#define LAKE_API_ID(name, policy, order, fields) LAKE_API_##name,
 enum lake_api_ids {
-    LAKE_API_cuInit = 0,
-    LAKE_API_cuDeviceGet,
-    LAKE_API_cuCtxCreate,
-    LAKE_API_cuModuleLoad,
-    LAKE_API_cuModuleUnload,
-    LAKE_API_cuModuleGetFunction = 5,
-    LAKE_API_cuLaunchKernel,
-    LAKE_API_cuCtxDestroy,
-    LAKE_API_cuMemAlloc,
-    LAKE_API_cuMemcpyHtoD,
-    LAKE_API_cuMemcpyDtoH =10,
-    LAKE_API_cuCtxSynchronize,
-    LAKE_API_cuMemFree,
-    LAKE_API_cuStreamCreate,
-    LAKE_API_cuStreamSynchronize,
-    LAKE_API_cuStreamDestroy =15,
-    LAKE_API_cuMemcpyHtoDAsync,
-    LAKE_API_cuMemcpyDtoHAsync,
-    LAKE_API_cuMemAllocPitch,
-    LAKE_API_kleioLoadModel,
-    LAKE_API_kleioInference =20,
-    LAKE_API_kleioForceGC,
-    LAKE_API_nvmlRunningProcs,
-    LAKE_API_nvmlUtilRate,
-    LAKE_API_hipInit,
-    LAKE_API_hipDeviceGet =25,
-    LAKE_API_hipHostMalloc,
-    LAKE_API_hipHostGetDevicePointer,
-    LAKE_API_hipHostFree,
-    LAKE_API_hipHostRegister,
-    LAKE_API_hipHostUnregister=30,
-    LAKE_API_hipCtxCreate,
-    LAKE_API_hipModuleGetFunction,
-    LAKE_API_hipMalloc,
-    LAKE_API_hipFree,
-    LAKE_API_hipMemcpyHtoDAsync=35,
-    LAKE_API_hipMemcpyHtoD,
-    LAKE_API_hipMemcpyDtoH,
-    LAKE_API_hipDeviceSynchronize,
-    LAKE_API_hipModuleLaunchKernel,
-    LAKE_API_hipModuleLoad=40,
-    LAKE_API_hipStreamCreate,
-    LAKE_API_hipStreamSynchronize,
-    LAKE_API_hipStreamDestroy,
-    LAKE_API_hipCtxDestroy,
-    LAKE_API_hipMemcpyDtoHAsync
+    LAKE_APIS(LAKE_API_ID)
+    LAKE_API_NR
 };
 
 struct lake_cmd_ret {
@@ -95,305 +158,106 @@ struct lake_cmd_ret {
         CUmodule module; //ptr
         CUfunction func; //ptr
         CUstream stream; //ptr
+        unsigned long long batch_failed; //bit i set if command i of a batch failed
     };
     size_t pPitch; //malloc pitch ruined everything
-};
-
-struct lake_cmd_cuInit {
-    u32 API_ID;
-    int flags;
-};
-
-struct lake_cmd_cuDeviceGet {
-    u32 API_ID;
-    //CUdevice *device; 
-    int ordinal;
-};
-
-struct lake_cmd_cuCtxCreate {
-    u32 API_ID;
-    //CUcontext *pctx; 
-    unsigned int flags; 
-    CUdevice dev;
-};
-
-struct lake_cmd_cuModuleLoad {
-    u32 API_ID;
-    //CUmodule *module;
-    //const char *fname;
-    char fname[256];
-};
-
-struct lake_cmd_cuModuleUnload {
-    u32 API_ID;
-    CUmodule hmod;
-};
-
-struct lake_cmd_cuModuleGetFunction {
-    u32 API_ID;
-    //CUfunction *hfunc;
-    CUmodule hmod; 
-    //char *name;
-    char name[256];
-};
-
-struct lake_cmd_cuLaunchKernel {
-    u32 API_ID;
-    CUfunction f;
-    unsigned int gridDimX;
-    unsigned int gridDimY;
-    unsigned int gridDimZ;
-    unsigned int blockDimX;
-    unsigned int blockDimY;
-    unsigned int blockDimZ;
-    unsigned int sharedMemBytes;
-    CUstream hStream;
-    //extra is always null
-    void **extra;
-    unsigned int paramsSize;
-};
-
-struct lake_cmd_cuCtxDestroy {
-    u32 API_ID;
-    CUcontext ctx;
-};
-
-struct lake_cmd_cuMemAlloc {
-    u32 API_ID;
-    //CUdeviceptr *dptr; 
-    size_t bytesize;
-};
-
-struct lake_cmd_cuMemcpyHtoD {
-    u32 API_ID;
-    CUdeviceptr dstDevice; 
-    const void *srcHost;
-    size_t ByteCount;
-};
-
-struct lake_cmd_cuMemcpyDtoH {
-    u32 API_ID;
-    void *dstHost; 
-    CUdeviceptr srcDevice; 
-    size_t ByteCount;
-};
-
-struct lake_cmd_cuCtxSynchronize {
-    u32 API_ID;
-};
-
-struct lake_cmd_cuMemFree {
-    u32 API_ID;
-    CUdeviceptr dptr;
-};
-
-struct lake_cmd_cuStreamCreate {
-    u32 API_ID;
-    //CUstream *phStream;
-    unsigned int Flags;
-};
-
-struct lake_cmd_cuStreamSynchronize {
-    u32 API_ID;
-    CUstream hStream;
-};
-
-struct lake_cmd_cuStreamDestroy {
-    u32 API_ID;
-    CUstream hStream;
-};
-
-struct lake_cmd_cuMemcpyHtoDAsync {
-    u32 API_ID;
-    CUdeviceptr dstDevice;
-    const void *srcHost; 
-    size_t ByteCount; 
-    CUstream hStream;
-};
-
-struct lake_cmd_cuMemcpyDtoHAsync {
-    u32 API_ID;
-    void *dstHost;
-    CUdeviceptr srcDevice;
-    size_t ByteCount;
-    CUstream hStream;
-};
-
-struct lake_cmd_cuMemAllocPitch {
-    u32 API_ID;
-    //CUdeviceptr* dptr;
-    //size_t* pPitch;
-    size_t WidthInBytes; 
-    size_t Height;
-    unsigned int ElementSizeBytes;
-};
-
-struct lake_cmd_kleioLoadModel {
-    u32 API_ID;
-    const void *srcHost;
-    size_t len;
-};
-
-struct lake_cmd_kleioInference {
-    u32 API_ID;
-    const void *srcHost;
-    size_t len;
-    int use_gpu;
-};
-
-struct lake_cmd_kleioForceGC {
-    u32 API_ID;
-};
-
-struct lake_cmd_nvmlRunningProcs {
-    u32 API_ID;
-};
-
-struct lake_cmd_nvmlUtilRate {
-    u32 API_ID;
-};
-
-struct lake_cmd_hipInit {
-    u32 API_ID;
-    int flags;
-};
-
-struct lake_cmd_hipDeviceGet {
-    u32 API_ID;
-    //hipDevice_t *device; 
-    int ordinal;
-};
-
-struct lake_cmd_hipHostMalloc {
-    int API_ID;
-    size_t size;
-    unsigned int flags;
-};
-
-struct lake_cmd_hipHostGetDevicePointer {
-    int API_ID;
-    void* hstPtr;
-    unsigned int flags;
-};
-
-struct lake_cmd_hipHostFree {
-    u32 API_ID;
-    void* ptr;
-};
-
-struct lake_cmd_hipHostRegister {
-    u32 API_ID;
-    void* hostPtr;
-    size_t sizeBytes;
-    unsigned int flags;
-};
-
-
-struct lake_cmd_hipHostUnregister {
-    u32 API_ID;
-    void* hostPtr;
-};
-
-struct lake_cmd_hipCtxCreate {
-    u32 API_ID;
-    unsigned int flags;
-    hipDevice_t dev;
-};
-
-struct lake_cmd_hipModuleGetFunction {
-    u32 API_ID;
-    //CUfunction *hfunc;
-    hipModule_t hmod; 
-    //char *name;
-    char name[256];
-};
+    // stamped by lake_uspace (CLOCK_MONOTONIC ns) for kapi tracing, 0 if not stamped.
+    // The whole struct must fit in a reply ring slot (LAKE_RING_RET_SLOT_SIZE)
+    unsigned long long t_recv;   // command received
+    unsigned long long t_start;  // handler started, after queueing in the dispatcher
+    unsigned long long t_end;    // handler returned
+};
+
+#define LAKE_UNPAREN(...) __VA_ARGS__
+#define F(type, name) type name;
+#define A(type, name, n) type name[n];
+#define LAKE_CMD_STRUCT(name, policy, order, fields) \
+    struct lake_cmd_##name { \
+        u32 API_ID; \
+        LAKE_UNPAREN fields \
+    };
+LAKE_APIS(LAKE_CMD_STRUCT)
+#undef F
+#undef A
 
-struct lake_cmd_hipMalloc {
-    u32 API_ID;
-    size_t bytesize;
-};
+/*
+ * Fixed size commands go in a single ring slot; variable size ones are
+ * checked against LAKE_RING_CMD_SLOT_SIZE by the code that builds them.
+ * Commands of the cu and hip API share their layout where the handlers
+ * (and batch.c, module.c) rely on it.
+ */
+#ifdef __cplusplus
+#define LAKE_STATIC_ASSERT(cond, msg) static_assert(cond, msg)
+#else
+#define LAKE_STATIC_ASSERT(cond, msg) _Static_assert(cond, msg)
+#endif
+#define LAKE_CMD_SIZE_ASSERT(name, policy, order, fields) \
+    LAKE_STATIC_ASSERT(sizeof(struct lake_cmd_##name) <= LAKE_RING_CMD_SLOT_SIZE - sizeof(struct lake_ring_slot), \
+            "lake_cmd_" #name " does not fit a command ring slot");
+LAKE_APIS(LAKE_CMD_SIZE_ASSERT)
+LAKE_STATIC_ASSERT(sizeof(struct lake_cmd_cuLaunchKernel) == sizeof(struct lake_cmd_hipModuleLaunchKernel),
+        "cu and hip launches differ");
+LAKE_STATIC_ASSERT(sizeof(struct lake_cmd_cuModuleGetFunctions) == sizeof(struct lake_cmd_hipModuleGetFunctions),
+        "cu and hip function lookups differ");
 
-struct lake_cmd_hipFree {
-    u32 API_ID;
-    CUdeviceptr dptr;
-};
+/*
+ * Policy and order of every command, indexed by LAKE_API_*. Defined by
+ * kernel/kapi.c and uspace/backend.c with LAKE_APIS(LAKE_API_INFO).
+ */
+enum lake_api_policy { LAKE_POLICY_SYNC, LAKE_POLICY_ASYNC, LAKE_POLICY_FREE, LAKE_POLICY_VAR };
+enum lake_api_order { LAKE_ORDER_NONE, LAKE_ORDER_WORK, LAKE_ORDER_SYNC, LAKE_ORDER_DEVSYNC };
 
-struct lake_cmd_hipMemcpyHtoDAsync {
-    u32 API_ID;
-    CUdeviceptr dstDevice;
-    const void *srcHost; 
-    size_t ByteCount; 
-    hipStream_t hStream;
+struct lake_api_info {
+    unsigned char policy;
+    unsigned char order;
+    unsigned short stream_off; // of hStream, 0 if the command is not ordered on a stream
 };
 
-struct lake_cmd_hipMemcpyHtoD {
-    u32 API_ID;
-    hipDeviceptr_t dstDevice; 
-    const void *srcHost;
-    size_t ByteCount;
-};
+#define LAKE_STREAM_OFF_NONE(cmd)    0
+#define LAKE_STREAM_OFF_WORK(cmd)    offsetof(struct cmd, hStream)
+#define LAKE_STREAM_OFF_SYNC(cmd)    offsetof(struct cmd, hStream)
+#define LAKE_STREAM_OFF_DEVSYNC(cmd) 0
+#define LAKE_API_INFO(name, policy, order, fields) \
+    { LAKE_POLICY_##policy, LAKE_ORDER_##order, LAKE_STREAM_OFF_##order(lake_cmd_##name) },
 
-struct lake_cmd_hipMemcpyDtoH {
-    u32 API_ID;
-    void *dstHost; 
-    hipDeviceptr_t srcDevice; 
-    size_t ByteCount;
-};
+extern const struct lake_api_info lake_api_info[LAKE_API_NR];
 
-struct lake_cmd_hipDeviceSynchronize {
-    u32 API_ID;
-};
+// LAKE_ORDER_* of the command in buf, and in *stream the stream it is ordered on (or NULL)
+static inline unsigned int lake_api_order(const void *buf, void **stream)
+{
+    u32 id = *(const u32 *) buf;
 
-struct lake_cmd_hipModuleLaunchKernel {
-    u32 API_ID;
-    hipFunction_t f;
-    unsigned int gridDimX;
-    unsigned int gridDimY;
-    unsigned int gridDimZ;
-    unsigned int blockDimX;
-    unsigned int blockDimY;
-    unsigned int blockDimZ;
-    unsigned int sharedMemBytes;
-    hipStream_t hStream;
-    //extra is always null
-    void **extra;
-    unsigned int paramsSize;
-};
+    *stream = NULL;
+    if (id >= LAKE_API_NR)
+        return LAKE_ORDER_NONE;
+    if (lake_api_info[id].stream_off)
+        *stream = *(void * const *) ((const char *) buf + lake_api_info[id].stream_off);
+    return lake_api_info[id].order;
+}
 
-struct lake_cmd_hipModuleLoad {
-    u32 API_ID;
-    //CUmodule *module;
-    //const char *fname;
-    char fname[256];
-};
-
-struct lake_cmd_hipStreamCreate {
-    u32 API_ID;
-    //hipStream_t *phStream;
-    unsigned int Flags;
-};
-
-struct lake_cmd_hipStreamSynchronize {
-    u32 API_ID;
-    hipStream_t hStream;
-};
+/*
+ * A batch is a lake_cmd_batch header followed by n_cmds entries, each a
+ * lake_cmd_batch_entry and the command itself, padded to 8 bytes.
+ * Commands run in order; the reply's res is the first error and
+ * batch_failed flags every command that failed.
+ */
+#define LAKE_BATCH_MAX_CMDS 64
 
-struct lake_cmd_hipStreamDestroy {
-    u32 API_ID;
-    hipStream_t hStream;
+struct lake_cmd_batch_entry {
+    u32 size; //of the command, without padding
+    u32 pad;
 };
 
-struct lake_cmd_hipCtxDestroy {
-    u32 API_ID;
-    hipCtx_t ctx;
-};
+/*
+ * Resolves several functions of one module in one round trip, see
+ * lake_module.h. names holds n_funcs NUL terminated names back to back;
+ * the handles are written in order to funcs, an array in kava_shm.
+ * The reply's res is the first error and batch_failed flags every name
+ * that could not be resolved. The cu and hip commands share their layout.
+ */
+#define LAKE_MODULE_MAX_FUNCS 64
 
-struct lake_cmd_hipMemcpyDtoHAsync {
-    u32 API_ID;
-    void *dstHost;
-    hipDeviceptr_t srcDevice;
-    size_t ByteCount;
-    hipStream_t hStream;
-};
+// devpoolStats: stats is a struct lake_devpool_stats[LAKE_DEVPOOL_NR], see lake_devpool.h
+// devpoolTrim: ret.ptr is the number of bytes given back to the driver
 
-#endif
\ No newline at end of file
+#endif
@@ -72,11 +72,15 @@ struct kernel_args_metadata* get_kargs(const void* ptr);
 }
 #endif
 
+#define KARGS_MAX_ARGS 64
+// largest serialized argument is a CUdeviceptr
+#define KARGS_MAX_SIZE (KARGS_MAX_ARGS * sizeof(CUdeviceptr))
+
 struct kernel_args_metadata {
     int func_argc;
     size_t total_size;
-    char func_arg_is_handle[64];
-    size_t func_arg_size[64];
+    char func_arg_is_handle[KARGS_MAX_ARGS];
+    size_t func_arg_size[KARGS_MAX_ARGS];
 };
 
 static inline void serialize_args(struct kernel_args_metadata* meta,
@@ -148,6 +152,13 @@ static inline void kava_parse_function_args(const char *name,
 
     i += skip;
     while (i < name_len) {
+        // launches marshal into fixed size buffers
+        if (unlikely(*func_argc == KARGS_MAX_ARGS)) {
+            PRINT("CUDA function argument: more than %d arguments", KARGS_MAX_ARGS);
+            *func_argc = 0;
+            meta->total_size = 0;
+            return;
+        }
         switch(name[i]) {
             case 'P':
                 func_arg_size[(*func_argc)] = sizeof(CUdeviceptr);
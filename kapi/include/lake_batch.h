@@ -0,0 +1,83 @@
+/*
+ * Part of LAKE: Towards a Machine Learning-Assisted Kernel with LAKE
+ *
+ * Original work:
+ *   Copyright (C) 2022–2024 Henrique Fingler
+ *   Copyright (C) 2022–2024 Isha Tarte
+ *
+ * Modifications and adaptations for LAIKA:
+ *   Copyright (C) 2024-2025 Haoming Zhuo
+ *
+ * This file is adapted from the original LAKE kernel module.
+ * Major changes include:
+ *   - Integration with LAIKA framework
+ *   - Hybrid execution support
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef __KAPI_LAKE_BATCH_H__
+#define __KAPI_LAKE_BATCH_H__
+
+#include "cuda.h"
+#include "hip_runtime_api_mini.h"
+#include "lake_future.h"
+
+/*
+ * Command buffers: record a chain of async calls (copies, launches and a
+ * final stream sync) and send them to lake_uspace as one message.
+ *
+ *   b = lake_batch_alloc();
+ *   lake_batch_hipMemcpyHtoDAsync(b, ...);
+ *   lake_batch_hipModuleLaunchKernel(b, ...);
+ *   lake_batch_hipMemcpyDtoHAsync(b, ...);
+ *   lake_batch_hipStreamSynchronize(b, stream);
+ *   err = lake_batch_flush(b, 1, &failed);
+ *
+ * A batch that fills up is flushed asynchronously and recording goes on,
+ * so ordering is kept. The failed mask (bit i = i-th command since the
+ * last flush) is only known when flush waits for the reply; otherwise
+ * errors are reported the same way async calls do. lake_batch_submit
+ * sends the batch as a future: ret.res and ret.batch_failed of the
+ * future's reply describe this batch only.
+ */
+struct lake_batch;
+
+struct lake_batch *lake_batch_alloc(void);
+void lake_batch_free(struct lake_batch *b);
+void lake_batch_reset(struct lake_batch *b);
+unsigned int lake_batch_count(struct lake_batch *b);
+CUresult lake_batch_flush(struct lake_batch *b, int wait, unsigned long long *failed);
+struct lake_future *lake_batch_submit(struct lake_batch *b);
+
+CUresult lake_batch_cuLaunchKernel(struct lake_batch *b, CUfunction f,
+        unsigned int gridDimX, unsigned int gridDimY, unsigned int gridDimZ,
+        unsigned int blockDimX, unsigned int blockDimY, unsigned int blockDimZ,
+        unsigned int sharedMemBytes, CUstream hStream, void **kernelParams, void **extra);
+CUresult lake_batch_cuMemcpyHtoDAsync(struct lake_batch *b, CUdeviceptr dstDevice,
+        const void *srcHost, size_t ByteCount, CUstream hStream);
+CUresult lake_batch_cuMemcpyDtoHAsync(struct lake_batch *b, void *dstHost,
+        CUdeviceptr srcDevice, size_t ByteCount, CUstream hStream);
+CUresult lake_batch_cuStreamSynchronize(struct lake_batch *b, CUstream hStream);
+
+hipError_t lake_batch_hipModuleLaunchKernel(struct lake_batch *b, hipFunction_t f,
+        unsigned int gridDimX, unsigned int gridDimY, unsigned int gridDimZ,
+        unsigned int blockDimX, unsigned int blockDimY, unsigned int blockDimZ,
+        unsigned int sharedMemBytes, hipStream_t hStream, void **kernelParams, void **extra);
+hipError_t lake_batch_hipMemcpyHtoDAsync(struct lake_batch *b, hipDeviceptr_t dstDevice,
+        const void *srcHost, size_t ByteCount, hipStream_t hStream);
+hipError_t lake_batch_hipMemcpyDtoHAsync(struct lake_batch *b, void *dstHost,
+        hipDeviceptr_t srcDevice, size_t ByteCount, hipStream_t hStream);
+hipError_t lake_batch_hipStreamSynchronize(struct lake_batch *b, hipStream_t hStream);
+
+#endif
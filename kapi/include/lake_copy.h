@@ -0,0 +1,141 @@
+/*
+ * Part of LAKE: Towards a Machine Learning-Assisted Kernel with LAKE
+ *
+ * Original work:
+ *   Copyright (C) 2022–2024 Henrique Fingler
+ *   Copyright (C) 2022–2024 Isha Tarte
+ *
+ * Modifications and adaptations for LAIKA:
+ *   Copyright (C) 2024-2025 Haoming Zhuo
+ *
+ * This file is adapted from the original LAKE kernel module.
+ * Major changes include:
+ *   - Integration with LAIKA framework
+ *   - Hybrid execution support
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef __KAPI_LAKE_COPY_H__
+#define __KAPI_LAKE_COPY_H__
+
+/*
+ * Copy engine for staging data through kava_shm.
+ *
+ * Data copied into a staging buffer is read next by lake_uspace or the
+ * device, not by this cpu, so large copies into shared memory use
+ * non-temporal stores (AVX-512 or AVX2) that bypass the cache instead of
+ * evicting the caller's working set. Copies above copy_split_min are
+ * split over a few cpus. Small copies stay plain memcpys: saving the FPU
+ * state costs more than the copy.
+ *
+ *   lake_memcpy(kbuf, data, size);                  // into kava_alloc'd memory
+ *   lake_memcpy_sg(kbuf, sg, 1, PAGE_SIZE, n, PAGE_SIZE, LAKE_COPY_FROM_SG);
+ *
+ * lake_memcpy_sg gathers the pages of sg[0], sg[stride], ... into buf (or
+ * scatters buf back), buf_stride apart in buf. Copies out of shared memory
+ * use plain stores, their destination is about to be used.
+ * Both may sleep when the copy is split.
+ *
+ * The thresholds are module parameters of lake_kapi, test/test_copy
+ * measures where they should be on a given machine.
+ */
+#ifdef __KERNEL__
+#include <linux/types.h>
+#include <linux/scatterlist.h>
+
+#define LAKE_COPY_FROM_SG 0
+#define LAKE_COPY_TO_SG   1
+
+void lake_memcpy(void *dst, const void *src, size_t n);
+void lake_memcpy_sg(void *buf, struct scatterlist *sg, unsigned int sg_stride,
+        size_t buf_stride, unsigned int n, size_t len, int dir);
+#endif
+
+/*
+ * Non-temporal copy loops, shared with test/test_copy.c. dst must be
+ * aligned to the vector size and n a multiple of LAKE_NT_BLOCK; src can
+ * be unaligned. The caller owns the vector registers (kernel_fpu_begin)
+ * and orders the stores with lake_nt_fence before publishing the data.
+ */
+#if defined(__x86_64__)
+
+#define LAKE_NT_BLOCK 256
+
+#ifdef __KERNEL__
+// the kernel is built without SSE, nothing to tell the compiler
+#define LAKE_NT_CLOBBERS "memory", "cc"
+#else
+#define LAKE_NT_CLOBBERS "xmm0", "xmm1", "xmm2", "xmm3", "memory", "cc"
+#endif
+
+static inline void lake_nt_copy_avx2(void *dst, const void *src, unsigned long n)
+{
+    asm volatile(
+        "1:\n\t"
+        "vmovdqu    0(%[s]), %%ymm0\n\t"
+        "vmovdqu   32(%[s]), %%ymm1\n\t"
+        "vmovdqu   64(%[s]), %%ymm2\n\t"
+        "vmovdqu   96(%[s]), %%ymm3\n\t"
+        "vmovntdq  %%ymm0,   0(%[d])\n\t"
+        "vmovntdq  %%ymm1,  32(%[d])\n\t"
+        "vmovntdq  %%ymm2,  64(%[d])\n\t"
+        "vmovntdq  %%ymm3,  96(%[d])\n\t"
+        "vmovdqu  128(%[s]), %%ymm0\n\t"
+        "vmovdqu  160(%[s]), %%ymm1\n\t"
+        "vmovdqu  192(%[s]), %%ymm2\n\t"
+        "vmovdqu  224(%[s]), %%ymm3\n\t"
+        "vmovntdq  %%ymm0, 128(%[d])\n\t"
+        "vmovntdq  %%ymm1, 160(%[d])\n\t"
+        "vmovntdq  %%ymm2, 192(%[d])\n\t"
+        "vmovntdq  %%ymm3, 224(%[d])\n\t"
+        "add $256, %[s]\n\t"
+        "add $256, %[d]\n\t"
+        "sub $256, %[n]\n\t"
+        "jnz 1b\n\t"
+        "vzeroupper\n\t"
+        : [d] "+r" (dst), [s] "+r" (src), [n] "+r" (n)
+        :
+        : LAKE_NT_CLOBBERS);
+}
+
+static inline void lake_nt_copy_avx512(void *dst, const void *src, unsigned long n)
+{
+    asm volatile(
+        "1:\n\t"
+        "vmovdqu64    0(%[s]), %%zmm0\n\t"
+        "vmovdqu64   64(%[s]), %%zmm1\n\t"
+        "vmovdqu64  128(%[s]), %%zmm2\n\t"
+        "vmovdqu64  192(%[s]), %%zmm3\n\t"
+        "vmovntdq   %%zmm0,   0(%[d])\n\t"
+        "vmovntdq   %%zmm1,  64(%[d])\n\t"
+        "vmovntdq   %%zmm2, 128(%[d])\n\t"
+        "vmovntdq   %%zmm3, 192(%[d])\n\t"
+        "add $256, %[s]\n\t"
+        "add $256, %[d]\n\t"
+        "sub $256, %[n]\n\t"
+        "jnz 1b\n\t"
+        "vzeroupper\n\t"
+        : [d] "+r" (dst), [s] "+r" (src), [n] "+r" (n)
+        :
+        : LAKE_NT_CLOBBERS);
+}
+
+static inline void lake_nt_fence(void)
+{
+    asm volatile("sfence" ::: "memory");
+}
+
+#endif /* __x86_64__ */
+
+#endif
@@ -0,0 +1,72 @@
+/*
+ * Part of LAKE: Towards a Machine Learning-Assisted Kernel with LAKE
+ *
+ * Original work:
+ *   Copyright (C) 2022–2024 Henrique Fingler
+ *   Copyright (C) 2022–2024 Isha Tarte
+ *
+ * Modifications and adaptations for LAIKA:
+ *   Copyright (C) 2024-2025 Haoming Zhuo
+ *
+ * This file is adapted from the original LAKE kernel module.
+ * Major changes include:
+ *   - Integration with LAIKA framework
+ *   - Hybrid execution support
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef __KAPI_LAKE_DEVPOOL_H__
+#define __KAPI_LAKE_DEVPOOL_H__
+
+/*
+ * Device memory pool of lake_uspace.
+ *
+ * cuMemAlloc/hipMalloc are served from size-bucketed lists of blocks that
+ * were freed before, and cuMemFree/hipFree return blocks to those lists
+ * instead of the driver. A freed block is only handed out again after a
+ * device synchronize, which the pool issues itself when it needs one, so
+ * work still running on it is not overwritten. With that, kapi can send
+ * frees asynchronously (its async_free parameter).
+ *
+ * The cu and hip APIs have one pool each. Statistics are read with
+ * lake_devpool_stats (or the devpool_stats parameter of lake_kapi), and
+ * lake_devpool_trim (or writing to devpool_trim) gives every cached block
+ * back to the driver.
+ */
+#define LAKE_DEVPOOL_CU  0
+#define LAKE_DEVPOOL_HIP 1
+#define LAKE_DEVPOOL_NR  2
+
+struct lake_devpool_stats {
+    unsigned long long allocs;         // allocations served
+    unsigned long long hits;           // of them, from cached blocks
+    unsigned long long frees;
+    unsigned long long driver_allocs;
+    unsigned long long driver_frees;
+    unsigned long long syncs;          // device synchronizes to reuse freed blocks
+    unsigned long long trims;
+    unsigned long long in_use;         // bytes handed out
+    unsigned long long cached;         // bytes kept for reuse
+};
+
+#ifdef __KERNEL__
+#include "cuda.h"
+
+// stats[LAKE_DEVPOOL_NR]
+CUresult lake_devpool_stats(struct lake_devpool_stats *stats);
+// bytes given back to the driver, in *released if not NULL
+CUresult lake_devpool_trim(unsigned long long *released);
+#endif
+
+#endif
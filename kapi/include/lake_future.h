@@ -0,0 +1,67 @@
+/*
+ * Part of LAKE: Towards a Machine Learning-Assisted Kernel with LAKE
+ *
+ * Original work:
+ *   Copyright (C) 2022–2024 Henrique Fingler
+ *   Copyright (C) 2022–2024 Isha Tarte
+ *
+ * Modifications and adaptations for LAIKA:
+ *   Copyright (C) 2024-2025 Haoming Zhuo
+ *
+ * This file is adapted from the original LAKE kernel module.
+ * Major changes include:
+ *   - Integration with LAIKA framework
+ *   - Hybrid execution support
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef __KAPI_LAKE_FUTURE_H__
+#define __KAPI_LAKE_FUTURE_H__
+
+#include "cuda.h"
+#include "hip_runtime_api_mini.h"
+#include "commands.h"
+
+/*
+ * Futures: a call that returns right away with a handle to its reply,
+ * so the caller can overlap CPU work with the remote call instead of
+ * sleeping in it. Unlike async calls, the error of each command is kept
+ * with its handle rather than folded into the sticky last error.
+ *
+ *   f = lake_future_hipDeviceSynchronize();
+ *   ... CPU work ...
+ *   err = lake_future_wait(f, MAX_SCHEDULE_TIMEOUT, NULL);
+ *   lake_future_release(f);
+ *
+ * Every future must be either released or handed to lake_future_then,
+ * which frees it after the callback ran. The callback runs in the reply
+ * path (netlink input or the ring poller), so it must not block; it may
+ * run before lake_future_then returns if the reply is already there.
+ */
+struct lake_future;
+typedef void (*lake_future_fn)(struct lake_cmd_ret *ret, void *arg);
+
+// 1 if the reply arrived
+int lake_future_done(struct lake_future *f);
+// timeout in jiffies; returns CUDA_ERROR_NOT_READY if it expired, the command's result otherwise
+CUresult lake_future_wait(struct lake_future *f, long timeout, struct lake_cmd_ret *ret);
+void lake_future_then(struct lake_future *f, lake_future_fn fn, void *arg);
+void lake_future_release(struct lake_future *f);
+
+struct lake_future *lake_future_cuCtxSynchronize(void);
+struct lake_future *lake_future_cuStreamSynchronize(CUstream hStream);
+struct lake_future *lake_future_hipDeviceSynchronize(void);
+struct lake_future *lake_future_hipStreamSynchronize(hipStream_t hStream);
+
+#endif
@@ -0,0 +1,56 @@
+/*
+ * Part of LAKE: Towards a Machine Learning-Assisted Kernel with LAKE
+ *
+ * Original work:
+ *   Copyright (C) 2022–2024 Henrique Fingler
+ *   Copyright (C) 2022–2024 Isha Tarte
+ *
+ * Modifications and adaptations for LAIKA:
+ *   Copyright (C) 2024-2025 Haoming Zhuo
+ *
+ * This file is adapted from the original LAKE kernel module.
+ * Major changes include:
+ *   - Integration with LAIKA framework
+ *   - Hybrid execution support
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef __KAPI_LAKE_MODULE_H__
+#define __KAPI_LAKE_MODULE_H__
+
+#include "cuda.h"
+#include "hip_runtime_api_mini.h"
+
+/*
+ * Resolve several kernels of one module at once, instead of one
+ * cuModuleGetFunction/hipModuleGetFunction round trip per kernel:
+ *
+ *   static const char *names[] = { "_Z6kernelPf", "_Z6kernelPi" };
+ *   hipFunction_t funcs[2];
+ *   err = lake_hipModuleGetFunctions(funcs, mod, names, 2);
+ *
+ * funcs[i] is NULL for a name that could not be resolved, and the first
+ * error is returned. Any number of names can be given, they are sent
+ * as few commands as fit.
+ *
+ * lake_uspace caches modules by file and functions by name, so loading
+ * the same unchanged file again (a module reloaded after a failover)
+ * returns the handles it got the first time without touching the driver.
+ */
+CUresult lake_cuModuleGetFunctions(CUfunction *hfuncs, CUmodule hmod,
+        const char * const *names, unsigned int n);
+hipError_t lake_hipModuleGetFunctions(hipFunction_t *funcs, hipModule_t hmod,
+        const char * const *names, unsigned int n);
+
+#endif
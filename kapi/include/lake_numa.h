@@ -0,0 +1,109 @@
+/*
+ * Part of LAKE: Towards a Machine Learning-Assisted Kernel with LAKE
+ *
+ * Original work:
+ *   Copyright (C) 2022–2024 Henrique Fingler
+ *   Copyright (C) 2022–2024 Isha Tarte
+ *
+ * Modifications and adaptations for LAIKA:
+ *   Copyright (C) 2024-2025 Haoming Zhuo
+ *
+ * This file is adapted from the original LAKE kernel module.
+ * Major changes include:
+ *   - Integration with LAIKA framework
+ *   - Hybrid execution support
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef __KAPI_LAKE_NUMA_H__
+#define __KAPI_LAKE_NUMA_H__
+
+/*
+ * NUMA topology for lake_uspace, read from sysfs so it needs no libnuma.
+ * Kernels without NUMA (no node directories) look like a single node 0,
+ * fake NUMA (numa=fake=N) kernels like any other machine.
+ */
+
+#ifndef __KERNEL__
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define LAKE_NUMA_MAX_NODES 64
+#define LAKE_NUMA_SYSFS     "/sys/devices/system"
+
+// parses a sysfs cpu or node list ("0-3,8,10-11"), returns the number of entries
+static inline int lake_numa_parse_list(const char *path, int *out, int max)
+{
+    FILE *f = fopen(path, "r");
+    int n = 0, lo, hi, c;
+
+    if (!f)
+        return 0;
+    while (n < max && fscanf(f, "%d", &lo) == 1) {
+        hi = lo;
+        c = fgetc(f);
+        if (c == '-') {
+            if (fscanf(f, "%d", &hi) != 1)
+                break;
+            c = fgetc(f);
+        }
+        for (; lo <= hi && n < max; lo++)
+            out[n++] = lo;
+        if (c != ',')
+            break;
+    }
+    fclose(f);
+    return n;
+}
+
+// one more than the highest online node
+static inline int lake_numa_nodes(void)
+{
+    int nodes[LAKE_NUMA_MAX_NODES];
+    int n = lake_numa_parse_list(LAKE_NUMA_SYSFS "/node/online", nodes, LAKE_NUMA_MAX_NODES);
+
+    return n ? nodes[n - 1] + 1 : 1;
+}
+
+static inline int lake_cpu_node(int cpu)
+{
+    char path[96];
+    int node;
+
+    for (node = 0; node < LAKE_NUMA_MAX_NODES; node++) {
+        snprintf(path, sizeof(path), LAKE_NUMA_SYSFS "/cpu/cpu%d/node%d", cpu, node);
+        if (access(path, F_OK) == 0)
+            return node;
+    }
+    return 0;
+}
+
+// cpus of a node, at most max of them; without NUMA node 0 has every online cpu
+static inline int lake_node_cpus(int node, int *cpus, int max)
+{
+    char path[96];
+    int n;
+
+    snprintf(path, sizeof(path), LAKE_NUMA_SYSFS "/node/node%d/cpulist", node);
+    n = lake_numa_parse_list(path, cpus, max);
+    if (!n && node == 0)
+        n = lake_numa_parse_list(LAKE_NUMA_SYSFS "/cpu/online", cpus, max);
+    return n;
+}
+
+#endif // __KERNEL__
+
+#endif // __KAPI_LAKE_NUMA_H__
@@ -0,0 +1,203 @@
+/*
+ * Part of LAKE: Towards a Machine Learning-Assisted Kernel with LAKE
+ *
+ * Original work:
+ *   Copyright (C) 2022–2024 Henrique Fingler
+ *   Copyright (C) 2022–2024 Isha Tarte
+ *
+ * Modifications and adaptations for LAIKA:
+ *   Copyright (C) 2024-2025 Haoming Zhuo
+ *
+ * This file is adapted from the original LAKE kernel module.
+ * Major changes include:
+ *   - Integration with LAIKA framework
+ *   - Hybrid execution support
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef __KAPI_LAKE_PK_H__
+#define __KAPI_LAKE_PK_H__
+
+/*
+ * Persistent kernels: a kernel that stays resident on the device and
+ * polls a mailbox in mapped host memory, instead of being launched for
+ * every batch. The protocol, shared by all the ML modules:
+ *
+ *   task  host writes LAKE_PK_POSTED once the inputs are in place; device
+ *         stages may move it through intermediate values, and the last
+ *         stage writes the service's `done` value
+ *   quit  host writes 1, every stage returns
+ *   n     number of items in the posted batch, for kernels that read it
+ *
+ * The host side (post, then spin-then-sleep wait) lives here so it can be
+ * exercised with a CPU thread standing in for the device, see
+ * kapi/test/test_pk.c. The kernel service that allocates the mailbox and
+ * launches the stages is at the end of this file.
+ */
+
+#include "lake_ring.h"  // lake_ring_load_acquire & co.
+
+#ifdef __KERNEL__
+#include <linux/ktime.h>
+#include <linux/delay.h>
+#define lake_pk_now_ns()   ktime_get_ns()
+#define lake_pk_sleep_us(us) usleep_range(us, 2 * (us))
+#else
+#include <time.h>
+static inline uint64_t lake_pk_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+static inline void lake_pk_sleep_us(unsigned int us)
+{
+    struct timespec ts = { 0, (long)us * 1000 };
+    nanosleep(&ts, NULL);
+}
+#endif
+
+#define LAKE_PK_POSTED 1
+
+// the wait spins for twice the recent completion time, within these bounds
+#define LAKE_PK_SPIN_MIN_NS   (2 * 1000)
+#define LAKE_PK_SPIN_MAX_NS   (200 * 1000)
+#define LAKE_PK_SLEEP_US      5
+
+struct lake_pk_mailbox {
+    int32_t *task;
+    int32_t *quit;
+    int32_t *n;
+    int32_t done;
+    uint64_t avg_ns;   // running average of post-to-done time
+    uint64_t spin_ns;  // current spin budget of lake_pk_wait
+};
+
+static inline void lake_pk_mailbox_init(struct lake_pk_mailbox *mb,
+        int32_t *task, int32_t *quit, int32_t *n, int32_t done)
+{
+    mb->task = task;
+    mb->quit = quit;
+    mb->n = n;
+    mb->done = done;
+    mb->avg_ns = 0;
+    mb->spin_ns = LAKE_PK_SPIN_MAX_NS;
+    *task = done;
+    *quit = 0;
+    *n = 0;
+    lake_ring_mb();
+}
+
+// host: hands a batch of n items to the device, inputs must be written already
+static inline void lake_pk_post(struct lake_pk_mailbox *mb, int32_t n)
+{
+    *(volatile int32_t *)mb->n = n;
+    lake_ring_store_release(mb->task, LAKE_PK_POSTED);
+}
+
+static inline int lake_pk_done(struct lake_pk_mailbox *mb)
+{
+    return lake_ring_load_acquire(mb->task) == mb->done;
+}
+
+/*
+ * host: waits for the posted batch. Spins for about twice the recent
+ * completion time, then sleeps between polls. Returns 0 once done, -1 if
+ * timeout_ns (0: none) expired first.
+ */
+static inline int lake_pk_wait(struct lake_pk_mailbox *mb, uint64_t timeout_ns)
+{
+    uint64_t start = lake_pk_now_ns();
+    uint64_t now = start;
+    uint64_t spin;
+
+    while (!lake_pk_done(mb)) {
+        now = lake_pk_now_ns();
+        if (timeout_ns && now - start >= timeout_ns)
+            return -1;
+        if (now - start < mb->spin_ns)
+            lake_ring_relax();
+        else
+            lake_pk_sleep_us(LAKE_PK_SLEEP_US);
+    }
+    now = lake_pk_now_ns();
+
+    mb->avg_ns = mb->avg_ns ? (7 * mb->avg_ns + (now - start)) / 8 : now - start;
+    spin = 2 * mb->avg_ns;
+    if (spin < LAKE_PK_SPIN_MIN_NS)
+        spin = LAKE_PK_SPIN_MIN_NS;
+    if (spin > LAKE_PK_SPIN_MAX_NS)
+        spin = LAKE_PK_SPIN_MAX_NS;
+    mb->spin_ns = spin;
+    return 0;
+}
+
+// host: asks every stage to return, the caller then syncs their streams
+static inline void lake_pk_quit(struct lake_pk_mailbox *mb)
+{
+    lake_ring_store_release(mb->quit, 1);
+    lake_ring_mb();
+}
+
+/*
+ * Device side, for CPU stand-ins: a stage waits for the task value it
+ * handles, then writes the value of the next stage (or done).
+ * Returns 1 when there is work, 0 when not, -1 on quit.
+ */
+static inline int lake_pk_stage_poll(int32_t *task, int32_t *quit, int32_t stage)
+{
+    if (lake_ring_load_acquire(quit))
+        return -1;
+    return lake_ring_load_acquire(task) == stage;
+}
+
+static inline void lake_pk_stage_finish(int32_t *task, int32_t next)
+{
+    lake_ring_store_release(task, next);
+}
+
+#ifdef __KERNEL__
+#include "hip_runtime_api_mini.h"
+
+#define LAKE_PK_MAX_STAGES 4
+
+/*
+ * Kernel service: the mailbox is allocated from kava_shm and mapped for
+ * the device. Stage kernels take the pointers from lake_pk_device_ptrs
+ * as their task/quit/n arguments and are launched on a stream each.
+ *
+ *   pk = lake_pk_create(8);
+ *   lake_pk_device_ptrs(pk, &d_task, &d_quit, &d_n);
+ *   lake_pk_launch(pk, mid_layer, ..., args);   // args hold &d_task, &d_quit
+ *   lake_pk_launch(pk, final_layer, ..., args1);
+ *   lake_pk_submit(pk, batch_size);
+ *   lake_pk_wait_done(pk, 0);
+ *   lake_pk_stop(pk);                           // before freeing what the stages use
+ *   lake_pk_destroy(pk);
+ */
+struct lake_pk;
+
+struct lake_pk *lake_pk_create(int done);
+void lake_pk_destroy(struct lake_pk *pk);
+void lake_pk_device_ptrs(struct lake_pk *pk, void **task, void **quit, void **n);
+hipError_t lake_pk_launch(struct lake_pk *pk, hipFunction_t f,
+        unsigned int gridDimX, unsigned int gridDimY, unsigned int gridDimZ,
+        unsigned int blockDimX, unsigned int blockDimY, unsigned int blockDimZ,
+        unsigned int sharedMemBytes, void **kernelParams);
+void lake_pk_submit(struct lake_pk *pk, int n);
+int lake_pk_wait_done(struct lake_pk *pk, u64 timeout_ns);
+void lake_pk_stop(struct lake_pk *pk);
+#endif
+
+#endif
@@ -0,0 +1,218 @@
+/*
+ * Part of LAKE: Towards a Machine Learning-Assisted Kernel with LAKE
+ *
+ * Original work:
+ *   Copyright (C) 2022–2024 Henrique Fingler
+ *   Copyright (C) 2022–2024 Isha Tarte
+ *
+ * Modifications and adaptations for LAIKA:
+ *   Copyright (C) 2024-2025 Haoming Zhuo
+ *
+ * This file is adapted from the original LAKE kernel module.
+ * Major changes include:
+ *   - Integration with LAIKA framework
+ *   - Hybrid execution support
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef __KAPI_LAKE_RING_H__
+#define __KAPI_LAKE_RING_H__
+
+/*
+ * Single-producer/single-consumer ring living in a cached kava_shm region.
+ * The kernel owns one ring for commands (kernel -> lake_uspace) and one
+ * for replies (lake_uspace -> kernel). Slots are fixed size and carry the
+ * same seq the netlink transport puts in nlmsg_seq.
+ *
+ * A consumer that runs out of work sets `sleeping` before blocking; the
+ * producer clears it and rings the doorbell (a netlink message) only in
+ * that case. Both sides issue a full barrier between their store and the
+ * load of the other side's variable, so a wakeup cannot be lost.
+ */
+
+#ifdef __KERNEL__
+#include <linux/types.h>
+#include <linux/string.h>
+#include <linux/compiler.h>
+#include <asm/barrier.h>
+#include <asm/processor.h>
+#define lake_ring_load_acquire(p)     smp_load_acquire(p)
+#define lake_ring_store_release(p, v) smp_store_release(p, v)
+#define lake_ring_mb()                smp_mb()
+#define lake_ring_xchg(p, v)          xchg(p, v)
+#define lake_ring_relax()             cpu_relax()
+#else
+#include <stdint.h>
+#include <string.h>
+#define lake_ring_load_acquire(p)     __atomic_load_n(p, __ATOMIC_ACQUIRE)
+#define lake_ring_store_release(p, v) __atomic_store_n(p, v, __ATOMIC_RELEASE)
+#define lake_ring_mb()                __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define lake_ring_xchg(p, v)          __atomic_exchange_n(p, v, __ATOMIC_SEQ_CST)
+#if defined(__x86_64__) || defined(__i386__)
+#define lake_ring_relax()             __builtin_ia32_pause()
+#else
+#define lake_ring_relax()             __atomic_signal_fence(__ATOMIC_SEQ_CST)
+#endif
+#endif
+
+#define LAKE_RING_CACHELINE 64
+
+// command ring: large enough for a launch with 64 args, or a command batch
+#define LAKE_RING_CMD_SLOTS     128
+#define LAKE_RING_CMD_SLOT_SIZE 4096
+// reply ring: one lake_cmd_ret per slot
+#define LAKE_RING_RET_SLOTS     256
+#define LAKE_RING_RET_SLOT_SIZE 64
+
+struct lake_ring {
+    uint32_t head __attribute__((aligned(LAKE_RING_CACHELINE)));     // written by producer
+    uint32_t tail __attribute__((aligned(LAKE_RING_CACHELINE)));     // written by consumer
+    uint32_t sleeping __attribute__((aligned(LAKE_RING_CACHELINE))); // consumer is parked
+    uint32_t nslots;     // power of two
+    uint32_t slot_size;  // includes struct lake_ring_slot
+} __attribute__((aligned(LAKE_RING_CACHELINE)));
+
+struct lake_ring_slot {
+    uint32_t seq;
+    uint32_t size;
+    char data[];
+};
+
+// sent by the kernel right after the worker's ping, payload of MSG_LAKE_KAPI_RING_SETUP
+struct lake_ring_setup {
+    int64_t cmd_ring; // kava_shm offsets
+    int64_t ret_ring;
+};
+
+static inline size_t lake_ring_bytes(uint32_t nslots, uint32_t slot_size)
+{
+    return sizeof(struct lake_ring) + (size_t)nslots * slot_size;
+}
+
+static inline void lake_ring_init(struct lake_ring *r, uint32_t nslots, uint32_t slot_size)
+{
+    r->head = 0;
+    r->tail = 0;
+    r->sleeping = 0;
+    r->nslots = nslots;
+    r->slot_size = slot_size;
+}
+
+static inline struct lake_ring_slot *lake_ring_slot_at(struct lake_ring *r, uint32_t idx)
+{
+    return (struct lake_ring_slot *)((char *)(r + 1) +
+            (size_t)(idx & (r->nslots - 1)) * r->slot_size);
+}
+
+static inline uint32_t lake_ring_max_payload(struct lake_ring *r)
+{
+    return r->slot_size - sizeof(struct lake_ring_slot);
+}
+
+static inline int lake_ring_empty(struct lake_ring *r)
+{
+    return lake_ring_load_acquire(&r->head) == lake_ring_load_acquire(&r->tail);
+}
+
+/*
+ * Producer side. Returns 0 on success, -1 if the ring is full and
+ * -2 if the payload does not fit in a slot.
+ */
+static inline int lake_ring_push(struct lake_ring *r, uint32_t seq, const void *buf, uint32_t size)
+{
+    uint32_t head = r->head;
+    struct lake_ring_slot *slot;
+
+    if (size > lake_ring_max_payload(r))
+        return -2;
+    if (head - lake_ring_load_acquire(&r->tail) >= r->nslots)
+        return -1;
+
+    slot = lake_ring_slot_at(r, head);
+    slot->seq = seq;
+    slot->size = size;
+    memcpy(slot->data, buf, size);
+    lake_ring_store_release(&r->head, head + 1);
+    return 0;
+}
+
+/*
+ * Producer side, for callers that build the payload in place: returns the
+ * next free slot or NULL if the ring is full. The slot is published by
+ * lake_ring_commit once seq, size and data are filled in.
+ */
+static inline struct lake_ring_slot *lake_ring_reserve(struct lake_ring *r)
+{
+    uint32_t head = r->head;
+
+    if (head - lake_ring_load_acquire(&r->tail) >= r->nslots)
+        return NULL;
+    return lake_ring_slot_at(r, head);
+}
+
+static inline void lake_ring_commit(struct lake_ring *r)
+{
+    lake_ring_store_release(&r->head, r->head + 1);
+}
+
+// Consumer side: returns the oldest slot without releasing it, or NULL
+static inline struct lake_ring_slot *lake_ring_peek(struct lake_ring *r)
+{
+    uint32_t tail = r->tail;
+
+    if (tail == lake_ring_load_acquire(&r->head))
+        return NULL;
+    return lake_ring_slot_at(r, tail);
+}
+
+// Consumer side: hands the slot returned by lake_ring_peek back to the producer
+static inline void lake_ring_pop(struct lake_ring *r)
+{
+    lake_ring_store_release(&r->tail, r->tail + 1);
+}
+
+/*
+ * Producer side, after a push: returns 1 if the consumer parked and
+ * must be woken up. Only one producer observes the flag.
+ */
+static inline int lake_ring_need_doorbell(struct lake_ring *r)
+{
+    lake_ring_mb();
+    if (!*(volatile uint32_t *)&r->sleeping)
+        return 0;
+    return lake_ring_xchg(&r->sleeping, 0) != 0;
+}
+
+/*
+ * Consumer side, before blocking: announces that a doorbell is needed.
+ * Returns 0 if work raced in and the consumer must not block.
+ */
+static inline int lake_ring_prepare_sleep(struct lake_ring *r)
+{
+    lake_ring_store_release(&r->sleeping, 1);
+    lake_ring_mb();
+    if (!lake_ring_empty(r)) {
+        lake_ring_store_release(&r->sleeping, 0);
+        return 0;
+    }
+    return 1;
+}
+
+// Consumer side, after waking up for whatever reason
+static inline void lake_ring_finish_sleep(struct lake_ring *r)
+{
+    lake_ring_store_release(&r->sleeping, 0);
+}
+
+#endif
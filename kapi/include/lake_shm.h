@@ -46,40 +46,14 @@
 #include <linux/fs.h>
 
 #define KAVA_DEFAULT_SHARED_MEM_SIZE 32
-#define BIN_COUNT 20
-#define BIN_MAX_IDX (BIN_COUNT - 1)
-
-#define MIN_ALLOC_SIZE 4
-#define MIN_NODE_SIZE (sizeof(node_t) + MIN_ALLOC_SIZE + sizeof(footer_t))
-
-typedef struct node_t {
-    uint32_t hole;
-    uint32_t size;
-    struct node_t *next; /* Allocated memory starts from here */
-    struct node_t *prev;
-} node_t;
-
-typedef struct footer_t {
-    node_t *header;
-} footer_t;
-
-typedef struct bin_t {
-    node_t *head;
-} bin_t;
-
-typedef struct allocator_t {
-    long start;
-    long end;
-    size_t size;
-    bin_t bins[BIN_COUNT];
-    uint32_t is_dma;
-} allocator_t;
-
-extern allocator_t *shm_allocator;
 
 int kava_allocator_init(size_t size);
 void kava_allocator_fini(void);
+int kava_shm_add_region(size_t size, int node);
+int kava_shm_add_cached_region(size_t size);
 void *kava_alloc(size_t size);
+void *kava_alloc_node(size_t size, int node);
+void *kava_alloc_region(int region, size_t size);
 void kava_free(void *p);
 s64 kava_shm_offset(const void *p);
 int kshm_mmap_helper(struct file *filp, struct vm_area_struct *vma);
@@ -87,10 +61,42 @@ int kshm_mmap_helper(struct file *filp, struct vm_area_struct *vma);
 
 #else
 
+#include <stdint.h>
 #include <sys/ioctl.h>
 
 #endif // __KERNEL
 
+/*
+ * Offsets into the shared memory (kava_shm_offset, what lake_uspace gets
+ * in place of host pointers) carry the region id above
+ * KAVA_SHM_REGION_SHIFT. Region 0 offsets are plain byte offsets.
+ */
+#define KAVA_SHM_MAX_REGIONS  16
+#define KAVA_SHM_REGION_SHIFT 40
+#define KAVA_SHM_OFFSET_MASK  ((1ull << KAVA_SHM_REGION_SHIFT) - 1)
+#define kava_shm_make_offset(id, off) (((int64_t)(id) << KAVA_SHM_REGION_SHIFT) | (int64_t)(off))
+#define kava_shm_region_of(offset)    ((int)((uint64_t)(offset) >> KAVA_SHM_REGION_SHIFT))
+
+struct kava_shm_region_info {
+    uint32_t id;
+    int32_t node;          // NUMA node the pages are on
+    uint64_t size;
+    uint64_t mmap_offset;  // file offset to mmap the whole region at
+};
+
+struct kava_shm_regions {
+    uint32_t count;
+    struct kava_shm_region_info regions[KAVA_SHM_MAX_REGIONS];
+};
+
+struct kava_shm_add_region {
+    uint64_t size;  // bytes
+    int32_t node;   // -1 for any
+    int32_t id;     // out
+};
+
 #define KAVA_SHM_GET_SHM_SIZE _IOW(KAVA_SHM_DEV_MAJOR, 0x1, long *)
+#define KAVA_SHM_GET_REGIONS  _IOR(KAVA_SHM_DEV_MAJOR, 0x2, struct kava_shm_regions)
+#define KAVA_SHM_ADD_REGION   _IOWR(KAVA_SHM_DEV_MAJOR, 0x3, struct kava_shm_add_region)
 
 #endif // __KAVA_SHARED_MEMORY_H__
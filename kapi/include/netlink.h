@@ -33,6 +33,10 @@
 
 #define MSG_LAKE_KAPI_REQ      0x11
 #define MSG_LAKE_KAPI_REP      0x12
+// ring transport: kernel hands the ring offsets to the worker
+#define MSG_LAKE_KAPI_RING_SETUP 0x13
+// ring transport: wakes up a parked ring consumer, no payload
+#define MSG_LAKE_KAPI_DOORBELL   0x14
 
 
 #endif
\ No newline at end of file
@@ -0,0 +1,266 @@
+/*
+ * Part of LAKE: Towards a Machine Learning-Assisted Kernel with LAKE
+ *
+ * Original work:
+ *   Copyright (C) 2022–2024 Henrique Fingler
+ *   Copyright (C) 2022–2024 Isha Tarte
+ *
+ * Modifications and adaptations for LAIKA:
+ *   Copyright (C) 2024-2025 Haoming Zhuo
+ *
+ * This file is adapted from the original LAKE kernel module.
+ * Major changes include:
+ *   - Integration with LAIKA framework
+ *   - Hybrid execution support
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <linux/types.h>
+#include <linux/module.h>
+#include <linux/slab.h>
+#include "commands.h"
+#include "lake_kapi.h"
+#include "lake_shm.h"
+#include "lake_ring.h"
+#include "lake_batch.h"
+#include "kargs.h"
+
+/*
+ *   Command buffers, see lake_batch.h.
+ *   The whole batch must fit in one ring slot so it can use either transport.
+ */
+
+#define LAKE_BATCH_MAX_SIZE (LAKE_RING_CMD_SLOT_SIZE - sizeof(struct lake_ring_slot))
+
+struct lake_batch {
+    u32 n_cmds;
+    u32 size;
+    char buf[LAKE_BATCH_MAX_SIZE] __aligned(8);
+};
+
+struct lake_batch *lake_batch_alloc(void)
+{
+    struct lake_batch *b = kmalloc(sizeof(*b), GFP_KERNEL);
+    if (b)
+        lake_batch_reset(b);
+    return b;
+}
+EXPORT_SYMBOL(lake_batch_alloc);
+
+void lake_batch_free(struct lake_batch *b)
+{
+    kfree(b);
+}
+EXPORT_SYMBOL(lake_batch_free);
+
+void lake_batch_reset(struct lake_batch *b)
+{
+    b->n_cmds = 0;
+    b->size = sizeof(struct lake_cmd_batch);
+}
+EXPORT_SYMBOL(lake_batch_reset);
+
+unsigned int lake_batch_count(struct lake_batch *b)
+{
+    return b->n_cmds;
+}
+EXPORT_SYMBOL(lake_batch_count);
+
+CUresult lake_batch_flush(struct lake_batch *b, int wait, unsigned long long *failed)
+{
+    struct lake_cmd_ret ret;
+    struct lake_cmd_batch *cmd = (struct lake_cmd_batch*) b->buf;
+
+    if (failed)
+        *failed = 0;
+    if (b->n_cmds == 0)
+        return CUDA_SUCCESS;
+
+    cmd->API_ID = LAKE_API_batch;
+    cmd->n_cmds = b->n_cmds;
+    cmd->size = b->size;
+    lake_send_cmd(b->buf, b->size, wait ? CMD_SYNC : CMD_ASYNC, &ret);
+    if (wait && failed)
+        *failed = ret.batch_failed;
+    lake_batch_reset(b);
+    return ret.res;
+}
+EXPORT_SYMBOL(lake_batch_flush);
+
+struct lake_future *lake_batch_submit(struct lake_batch *b)
+{
+    struct lake_cmd_batch *cmd = (struct lake_cmd_batch*) b->buf;
+    struct lake_future *f;
+
+    cmd->API_ID = LAKE_API_batch;
+    cmd->n_cmds = b->n_cmds;
+    cmd->size = b->size;
+    f = lake_send_cmd_future(b->buf, b->size);
+    lake_batch_reset(b);
+    return f;
+}
+EXPORT_SYMBOL(lake_batch_submit);
+
+/*
+ * Reserves room for a command of `size` bytes at the end of the batch,
+ * flushing what was recorded so far if it does not fit.
+ */
+static void *lake_batch_reserve(struct lake_batch *b, u32 size)
+{
+    struct lake_cmd_batch_entry *entry;
+    u32 need = sizeof(*entry) + ALIGN(size, 8);
+
+    if (unlikely(sizeof(struct lake_cmd_batch) + need > LAKE_BATCH_MAX_SIZE))
+        return NULL;
+    if (b->n_cmds == LAKE_BATCH_MAX_CMDS || b->size + need > LAKE_BATCH_MAX_SIZE)
+        lake_batch_flush(b, 0, NULL);
+
+    entry = (struct lake_cmd_batch_entry*) (b->buf + b->size);
+    entry->size = size;
+    entry->pad = 0;
+    b->size += need;
+    b->n_cmds++;
+    return entry + 1;
+}
+
+static CUresult lake_batch_launch(struct lake_batch *b, u32 api_id, void *f,
+        unsigned int gridDimX, unsigned int gridDimY, unsigned int gridDimZ,
+        unsigned int blockDimX, unsigned int blockDimY, unsigned int blockDimZ,
+        unsigned int sharedMemBytes, CUstream hStream, void **kernelParams)
+{
+    // the cu and hip launch commands share their layout
+    struct lake_cmd_cuLaunchKernel *cmd;
+    struct kernel_args_metadata* meta = get_kargs(f);
+    u32 tsize;
+
+    BUILD_BUG_ON(sizeof(struct lake_cmd_cuLaunchKernel) != sizeof(struct lake_cmd_hipModuleLaunchKernel));
+    if (unlikely(!meta))
+        return CUDA_ERROR_OUT_OF_MEMORY;
+    tsize = sizeof(struct lake_cmd_cuLaunchKernel) + meta->total_size;
+    cmd = lake_batch_reserve(b, tsize);
+    if (unlikely(!cmd))
+        return CUDA_ERROR_INVALID_VALUE;
+
+    cmd->API_ID = api_id; cmd->f = f;
+    cmd->gridDimX = gridDimX; cmd->gridDimY = gridDimY; cmd->gridDimZ = gridDimZ;
+    cmd->blockDimX = blockDimX; cmd->blockDimY = blockDimY; cmd->blockDimZ = blockDimZ;
+    cmd->sharedMemBytes = sharedMemBytes; cmd->hStream = hStream; cmd->extra = 0;
+    cmd->paramsSize = meta->total_size;
+    serialize_args(meta, (u8*)(cmd + 1), kernelParams);
+    return CUDA_SUCCESS;
+}
+
+CUresult lake_batch_cuLaunchKernel(struct lake_batch *b, CUfunction f,
+        unsigned int gridDimX, unsigned int gridDimY, unsigned int gridDimZ,
+        unsigned int blockDimX, unsigned int blockDimY, unsigned int blockDimZ,
+        unsigned int sharedMemBytes, CUstream hStream, void **kernelParams, void **extra)
+{
+    return lake_batch_launch(b, LAKE_API_cuLaunchKernel, f, gridDimX, gridDimY, gridDimZ,
+            blockDimX, blockDimY, blockDimZ, sharedMemBytes, hStream, kernelParams);
+}
+EXPORT_SYMBOL(lake_batch_cuLaunchKernel);
+
+hipError_t lake_batch_hipModuleLaunchKernel(struct lake_batch *b, hipFunction_t f,
+        unsigned int gridDimX, unsigned int gridDimY, unsigned int gridDimZ,
+        unsigned int blockDimX, unsigned int blockDimY, unsigned int blockDimZ,
+        unsigned int sharedMemBytes, hipStream_t hStream, void **kernelParams, void **extra)
+{
+    return lake_batch_launch(b, LAKE_API_hipModuleLaunchKernel, f, gridDimX, gridDimY, gridDimZ,
+            blockDimX, blockDimY, blockDimZ, sharedMemBytes, hStream, kernelParams);
+}
+EXPORT_SYMBOL(lake_batch_hipModuleLaunchKernel);
+
+CUresult lake_batch_cuMemcpyHtoDAsync(struct lake_batch *b, CUdeviceptr dstDevice,
+        const void *srcHost, size_t ByteCount, CUstream hStream)
+{
+    struct lake_cmd_cuMemcpyHtoDAsync *cmd;
+    s64 offset = kava_shm_offset(srcHost);
+    if (offset < 0) {
+        pr_err("srcHost in lake_batch_cuMemcpyHtoDAsync is NOT a kshm pointer (use kava_alloc to fix it)\n");
+        return CUDA_ERROR_INVALID_VALUE;
+    }
+
+    cmd = lake_batch_reserve(b, sizeof(*cmd));
+    cmd->API_ID = LAKE_API_cuMemcpyHtoDAsync; cmd->dstDevice = dstDevice;
+    cmd->srcHost = (void*)offset; cmd->ByteCount = ByteCount; cmd->hStream = hStream;
+    return CUDA_SUCCESS;
+}
+EXPORT_SYMBOL(lake_batch_cuMemcpyHtoDAsync);
+
+CUresult lake_batch_cuMemcpyDtoHAsync(struct lake_batch *b, void *dstHost,
+        CUdeviceptr srcDevice, size_t ByteCount, CUstream hStream)
+{
+    struct lake_cmd_cuMemcpyDtoHAsync *cmd;
+    s64 offset = kava_shm_offset(dstHost);
+    if (offset < 0) {
+        pr_err("dstHost in lake_batch_cuMemcpyDtoHAsync is NOT a kshm pointer (use kava_alloc to fix it)\n");
+        return CUDA_ERROR_INVALID_VALUE;
+    }
+
+    cmd = lake_batch_reserve(b, sizeof(*cmd));
+    cmd->API_ID = LAKE_API_cuMemcpyDtoHAsync; cmd->dstHost = (void*)offset;
+    cmd->srcDevice = srcDevice; cmd->ByteCount = ByteCount; cmd->hStream = hStream;
+    return CUDA_SUCCESS;
+}
+EXPORT_SYMBOL(lake_batch_cuMemcpyDtoHAsync);
+
+CUresult lake_batch_cuStreamSynchronize(struct lake_batch *b, CUstream hStream)
+{
+    struct lake_cmd_cuStreamSynchronize *cmd = lake_batch_reserve(b, sizeof(*cmd));
+    cmd->API_ID = LAKE_API_cuStreamSynchronize; cmd->hStream = hStream;
+    return CUDA_SUCCESS;
+}
+EXPORT_SYMBOL(lake_batch_cuStreamSynchronize);
+
+hipError_t lake_batch_hipMemcpyHtoDAsync(struct lake_batch *b, hipDeviceptr_t dstDevice,
+        const void *srcHost, size_t ByteCount, hipStream_t hStream)
+{
+    struct lake_cmd_hipMemcpyHtoDAsync *cmd;
+    s64 offset = kava_shm_offset(srcHost);
+    if (offset < 0) {
+        pr_err("srcHost in lake_batch_hipMemcpyHtoDAsync is NOT a kshm pointer (use kava_alloc to fix it)\n");
+        return hipErrorInvalidValue;
+    }
+
+    cmd = lake_batch_reserve(b, sizeof(*cmd));
+    cmd->API_ID = LAKE_API_hipMemcpyHtoDAsync; cmd->dstDevice = dstDevice;
+    cmd->srcHost = (void*)offset; cmd->ByteCount = ByteCount; cmd->hStream = hStream;
+    return hipSuccess;
+}
+EXPORT_SYMBOL(lake_batch_hipMemcpyHtoDAsync);
+
+hipError_t lake_batch_hipMemcpyDtoHAsync(struct lake_batch *b, void *dstHost,
+        hipDeviceptr_t srcDevice, size_t ByteCount, hipStream_t hStream)
+{
+    struct lake_cmd_hipMemcpyDtoHAsync *cmd;
+    s64 offset = kava_shm_offset(dstHost);
+    if (offset < 0) {
+        pr_err("dstHost in lake_batch_hipMemcpyDtoHAsync is NOT a kshm pointer (use kava_alloc to fix it)\n");
+        return hipErrorInvalidValue;
+    }
+
+    cmd = lake_batch_reserve(b, sizeof(*cmd));
+    cmd->API_ID = LAKE_API_hipMemcpyDtoHAsync; cmd->dstHost = (void*)offset;
+    cmd->srcDevice = srcDevice; cmd->ByteCount = ByteCount; cmd->hStream = hStream;
+    return hipSuccess;
+}
+EXPORT_SYMBOL(lake_batch_hipMemcpyDtoHAsync);
+
+hipError_t lake_batch_hipStreamSynchronize(struct lake_batch *b, hipStream_t hStream)
+{
+    struct lake_cmd_hipStreamSynchronize *cmd = lake_batch_reserve(b, sizeof(*cmd));
+    cmd->API_ID = LAKE_API_hipStreamSynchronize; cmd->hStream = hStream;
+    return hipSuccess;
+}
+EXPORT_SYMBOL(lake_batch_hipStreamSynchronize);
@@ -0,0 +1,267 @@
+/*
+ * Part of LAKE: Towards a Machine Learning-Assisted Kernel with LAKE
+ *
+ * Original work:
+ *   Copyright (C) 2022–2024 Henrique Fingler
+ *   Copyright (C) 2022–2024 Isha Tarte
+ *
+ * Modifications and adaptations for LAIKA:
+ *   Copyright (C) 2024-2025 Haoming Zhuo
+ *
+ * This file is adapted from the original LAKE kernel module.
+ * Major changes include:
+ *   - Integration with LAIKA framework
+ *   - Hybrid execution support
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <linux/module.h>
+#include <linux/moduleparam.h>
+#include <linux/kernel.h>
+#include <linux/string.h>
+#include <linux/workqueue.h>
+#include <linux/completion.h>
+#include <linux/scatterlist.h>
+#ifdef CONFIG_X86_64
+#include <asm/cpufeature.h>
+#include <asm/fpu/api.h>
+#include <asm/fpu/xstate.h>
+#endif
+#include "lake_kapi.h"
+#include "lake_copy.h"
+
+/*
+ *   Copy engine, see lake_copy.h.
+ *   A copy runs as pieces: the caller does the first one and the others go
+ *   to an unbound workqueue, so they land on idle cpus. Plain copies split
+ *   on page boundaries, scatterlist copies on entries. Vector registers are
+ *   taken for at most COPY_FPU_CHUNK bytes at a time, kernel_fpu_begin
+ *   disables preemption.
+ */
+
+#define COPY_MEMCPY 0
+#define COPY_AVX2   1
+#define COPY_AVX512 2
+
+#define COPY_MAX_THREADS 16
+#define COPY_FPU_CHUNK   (64 << 10)  // multiple of LAKE_NT_BLOCK
+
+static unsigned long copy_nt_min = 256 << 10;
+module_param(copy_nt_min, ulong, 0644);
+MODULE_PARM_DESC(copy_nt_min, "Copies into shared memory of at least this many bytes use non-temporal stores, default 256K");
+
+static unsigned long copy_split_min = 1 << 20;
+module_param(copy_split_min, ulong, 0644);
+MODULE_PARM_DESC(copy_split_min, "Copies of at least this many bytes are split over cpus, 0 never splits, default 1M");
+
+static int copy_threads = 4;
+module_param(copy_threads, int, 0644);
+MODULE_PARM_DESC(copy_threads, "Cpus a split copy runs on, the caller included, default 4, at most 16");
+
+static int copy_isa = -1;
+module_param(copy_isa, int, 0644);
+MODULE_PARM_DESC(copy_isa, "Non-temporal stores: 0 none (memcpy), 1 AVX2, 2 AVX-512, default the best the cpu has");
+
+static int copy_isa_max = COPY_MEMCPY;
+static struct workqueue_struct *copy_wq;
+
+struct copy_job {
+    int isa;
+    // plain copy
+    void *dst;
+    const void *src;
+    // scatterlist copy, when sg is set
+    struct scatterlist *sg;
+    unsigned int sg_stride;
+    void *buf;
+    size_t buf_stride;
+    size_t len;
+    int dir;
+};
+
+struct copy_piece {
+    struct work_struct work;
+    struct copy_job *job;
+    unsigned long first;
+    unsigned long count;
+    atomic_t *pending;
+    struct completion *done;
+};
+
+static void copy_nt(void *dst, const void *src, size_t n, int isa)
+{
+#ifdef CONFIG_X86_64
+    size_t head, chunk;
+
+    if (!irq_fpu_usable()) {
+        memcpy(dst, src, n);
+        return;
+    }
+    head = min_t(size_t, n, -(unsigned long) dst & 63);
+    memcpy(dst, src, head);
+    dst += head;
+    src += head;
+    n -= head;
+
+    while (n >= LAKE_NT_BLOCK) {
+        chunk = min_t(size_t, n & ~(size_t) (LAKE_NT_BLOCK - 1), COPY_FPU_CHUNK);
+        kernel_fpu_begin();
+        if (isa == COPY_AVX512)
+            lake_nt_copy_avx512(dst, src, chunk);
+        else
+            lake_nt_copy_avx2(dst, src, chunk);
+        kernel_fpu_end();
+        dst += chunk;
+        src += chunk;
+        n -= chunk;
+    }
+    // non-temporal stores are weakly ordered, make them visible before whoever reads them is told
+    lake_nt_fence();
+#endif
+    memcpy(dst, src, n);
+}
+
+static void copy_range(void *dst, const void *src, size_t n, int isa)
+{
+    if (isa == COPY_MEMCPY)
+        memcpy(dst, src, n);
+    else
+        copy_nt(dst, src, n, isa);
+}
+
+static void copy_run(struct copy_job *job, unsigned long first, unsigned long count)
+{
+    unsigned long i;
+    void *page;
+
+    if (!job->sg) {
+        copy_range(job->dst + first, job->src + first, count, job->isa);
+        return;
+    }
+    for (i = first; i < first + count; i++) {
+        page = sg_virt(&job->sg[i * job->sg_stride]);
+        if (job->dir == LAKE_COPY_FROM_SG)
+            copy_range(job->buf + i * job->buf_stride, page, job->len, job->isa);
+        else
+            memcpy(page, job->buf + i * job->buf_stride, job->len);
+    }
+}
+
+static void copy_piece_fn(struct work_struct *work)
+{
+    struct copy_piece *p = container_of(work, struct copy_piece, work);
+
+    copy_run(p->job, p->first, p->count);
+    if (atomic_dec_and_test(p->pending))
+        complete(p->done);
+}
+
+// units are bytes for a plain copy, entries for a scatterlist one
+static void copy_split(struct copy_job *job, unsigned long units, size_t unit_size)
+{
+    struct copy_piece pieces[COPY_MAX_THREADS];
+    DECLARE_COMPLETION_ONSTACK(done);
+    unsigned long per, first;
+    int threads = clamp(READ_ONCE(copy_threads), 1, COPY_MAX_THREADS);
+    int i, n = 0;
+    atomic_t pending;
+
+    if (threads == 1 || !copy_split_min || units * unit_size < copy_split_min) {
+        copy_run(job, 0, units);
+        return;
+    }
+    might_sleep();
+
+    per = DIV_ROUND_UP(units, threads);
+    if (!job->sg)
+        per = ALIGN(per, PAGE_SIZE);
+    // the caller takes the first piece
+    atomic_set(&pending, 0);
+    for (first = per; first < units; first += per) {
+        pieces[n].job = job;
+        pieces[n].first = first;
+        pieces[n].count = min(per, units - first);
+        pieces[n].pending = &pending;
+        pieces[n].done = &done;
+        n++;
+    }
+    atomic_set(&pending, n);
+    for (i = 0; i < n; i++) {
+        INIT_WORK_ONSTACK(&pieces[i].work, copy_piece_fn);
+        queue_work(copy_wq, &pieces[i].work);
+    }
+    copy_run(job, 0, min(per, units));
+    if (n)
+        wait_for_completion(&done);
+    for (i = 0; i < n; i++)
+        destroy_work_on_stack(&pieces[i].work);
+}
+
+static int copy_isa_for(size_t n)
+{
+    if (n < READ_ONCE(copy_nt_min))
+        return COPY_MEMCPY;
+    return clamp(READ_ONCE(copy_isa), COPY_MEMCPY, copy_isa_max);
+}
+
+void lake_memcpy(void *dst, const void *src, size_t n)
+{
+    struct copy_job job = {
+        .isa = copy_isa_for(n), .dst = dst, .src = src,
+    };
+    copy_split(&job, n, 1);
+}
+EXPORT_SYMBOL(lake_memcpy);
+
+void lake_memcpy_sg(void *buf, struct scatterlist *sg, unsigned int sg_stride,
+        size_t buf_stride, unsigned int n, size_t len, int dir)
+{
+    struct copy_job job = {
+        .isa = dir == LAKE_COPY_FROM_SG ? copy_isa_for(n * len) : COPY_MEMCPY,
+        .sg = sg, .sg_stride = sg_stride, .buf = buf, .buf_stride = buf_stride,
+        .len = len, .dir = dir,
+    };
+    copy_split(&job, n, len);
+}
+EXPORT_SYMBOL(lake_memcpy_sg);
+
+int lake_copy_init(void)
+{
+    static const char *isa_names[] = { "memcpy", "AVX2", "AVX-512" };
+
+#ifdef CONFIG_X86_64
+    if (boot_cpu_has(X86_FEATURE_AVX2) &&
+            cpu_has_xfeatures(XFEATURE_MASK_SSE | XFEATURE_MASK_YMM, NULL))
+        copy_isa_max = COPY_AVX2;
+    if (copy_isa_max == COPY_AVX2 && boot_cpu_has(X86_FEATURE_AVX512F) &&
+            cpu_has_xfeatures(XFEATURE_MASK_AVX512, NULL))
+        copy_isa_max = COPY_AVX512;
+#endif
+    if (copy_isa < 0 || copy_isa > copy_isa_max)
+        copy_isa = copy_isa_max;
+
+    copy_wq = alloc_workqueue("lake_copy", WQ_UNBOUND | WQ_HIGHPRI, COPY_MAX_THREADS);
+    if (!copy_wq)
+        return -ENOMEM;
+    pr_info("[lake] copy engine: %s stores from %lu bytes, split over %d cpus from %lu bytes\n",
+            isa_names[copy_isa], copy_nt_min, copy_threads, copy_split_min);
+    return 0;
+}
+
+void lake_copy_fini(void)
+{
+    if (copy_wq)
+        destroy_workqueue(copy_wq);
+    copy_wq = NULL;
+}
@@ -0,0 +1,123 @@
+/*
+ * Part of LAKE: Towards a Machine Learning-Assisted Kernel with LAKE
+ *
+ * Original work:
+ *   Copyright (C) 2022–2024 Henrique Fingler
+ *   Copyright (C) 2022–2024 Isha Tarte
+ *
+ * Modifications and adaptations for LAIKA:
+ *   Copyright (C) 2024-2025 Haoming Zhuo
+ *
+ * This file is adapted from the original LAKE kernel module.
+ * Major changes include:
+ *   - Integration with LAIKA framework
+ *   - Hybrid execution support
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <linux/module.h>
+#include <linux/moduleparam.h>
+#include <linux/kernel.h>
+#include <linux/string.h>
+#include "commands.h"
+#include "lake_kapi.h"
+#include "lake_shm.h"
+#include "lake_devpool.h"
+
+/*
+ *   Device memory pool of lake_uspace, see lake_devpool.h.
+ *   Frees never wait for the device in lake_uspace: the pool keeps the
+ *   block or the driver frees it in order with everything sent before.
+ *   Nothing needs their reply, so they are sent asynchronously; an error
+ *   shows up on the next synchronous command like for any async command.
+ */
+
+int lake_async_free = 1;
+module_param_named(async_free, lake_async_free, int, 0644);
+MODULE_PARM_DESC(async_free, "Send cuMemFree/hipFree without waiting for lake_uspace, default 1");
+
+CUresult lake_devpool_stats(struct lake_devpool_stats *stats)
+{
+    struct lake_cmd_devpoolStats cmd = {};
+    struct lake_devpool_stats *buf;
+    struct lake_cmd_ret ret;
+
+    buf = kava_alloc(sizeof(*buf) * LAKE_DEVPOOL_NR);
+    if (!buf)
+        return CUDA_ERROR_OUT_OF_MEMORY;
+    cmd.stats = (void *) kava_shm_offset(buf);
+    lake_send_devpoolStats(&cmd, &ret);
+    if (ret.res == CUDA_SUCCESS)
+        memcpy(stats, buf, sizeof(*buf) * LAKE_DEVPOOL_NR);
+    kava_free(buf);
+    return ret.res;
+}
+EXPORT_SYMBOL(lake_devpool_stats);
+
+CUresult lake_devpool_trim(unsigned long long *released)
+{
+    struct lake_cmd_devpoolTrim cmd = {};
+    struct lake_cmd_ret ret;
+
+    lake_send_devpoolTrim(&cmd, &ret);
+    if (released)
+        *released = ret.res == CUDA_SUCCESS ? ret.ptr : 0;
+    return ret.res;
+}
+EXPORT_SYMBOL(lake_devpool_trim);
+
+static int devpool_stats_get(char *buf, const struct kernel_param *kp)
+{
+    static const char *names[LAKE_DEVPOOL_NR] = { "cu", "hip" };
+    struct lake_devpool_stats stats[LAKE_DEVPOOL_NR];
+    int i, len = 0;
+
+    if (lake_devpool_stats(stats) != CUDA_SUCCESS)
+        return sprintf(buf, "unavailable\n");
+    for (i = 0; i < LAKE_DEVPOOL_NR; i++) {
+        len += scnprintf(buf + len, PAGE_SIZE - len,
+                "%s allocs %llu hits %llu frees %llu driver_allocs %llu driver_frees %llu "
+                "syncs %llu trims %llu in_use %llu cached %llu\n", names[i],
+                stats[i].allocs, stats[i].hits, stats[i].frees, stats[i].driver_allocs,
+                stats[i].driver_frees, stats[i].syncs, stats[i].trims, stats[i].in_use,
+                stats[i].cached);
+    }
+    return len;
+}
+
+static const struct kernel_param_ops devpool_stats_ops = {
+    .get = devpool_stats_get,
+};
+module_param_cb(devpool_stats, &devpool_stats_ops, NULL, 0444);
+MODULE_PARM_DESC(devpool_stats, "Device memory pool counters of lake_uspace, per API");
+
+static int devpool_trim_set(const char *val, const struct kernel_param *kp)
+{
+    unsigned long long released;
+    CUresult res;
+
+    res = lake_devpool_trim(&released);
+    if (res != CUDA_SUCCESS) {
+        pr_err("devpool_trim: lake_uspace returned %d\n", res);
+        return -EIO;
+    }
+    pr_info("devpool_trim: %llu bytes given back to the driver\n", released);
+    return 0;
+}
+
+static const struct kernel_param_ops devpool_trim_ops = {
+    .set = devpool_trim_set,
+};
+module_param_cb(devpool_trim, &devpool_trim_ops, NULL, 0200);
+MODULE_PARM_DESC(devpool_trim, "Write anything to give every cached device block back to the driver");
@@ -0,0 +1,145 @@
+/*
+ * Part of LAKE: Towards a Machine Learning-Assisted Kernel with LAKE
+ *
+ * Original work:
+ *   Copyright (C) 2022–2024 Henrique Fingler
+ *   Copyright (C) 2022–2024 Isha Tarte
+ *
+ * Modifications and adaptations for LAIKA:
+ *   Copyright (C) 2024-2025 Haoming Zhuo
+ *
+ * This file is adapted from the original LAKE kernel module.
+ * Major changes include:
+ *   - Integration with LAIKA framework
+ *   - Hybrid execution support
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <linux/module.h>
+#include <linux/completion.h>
+#include <linux/atomic.h>
+#include "commands.h"
+#include "lake_kapi.h"
+#include "lake_future.h"
+
+/*
+ *   Futures, see lake_future.h.
+ *   A future is its in-flight slot. The slot goes back to the table once
+ *   the reply arrived and the caller let go of it (release, or a callback
+ *   that ran); whichever of the two happens last frees it.
+ */
+
+#define FUTURE_DONE     1
+#define FUTURE_RELEASED 2
+#define FUTURE_CALLBACK 4
+
+static inline struct lake_inflight *to_cmd(struct lake_future *f)
+{
+    return (struct lake_inflight *) f;
+}
+
+// reply path, cmd->ret is filled in
+void lake_future_complete(struct lake_inflight *cmd)
+{
+    int old;
+
+    // wake waiters before publishing DONE: once the caller sees DONE it may
+    // release, and the slot must not be touched after that
+    complete_all(&cmd->cmd_done);
+    old = atomic_fetch_or(FUTURE_DONE, &cmd->fstate);
+
+    if (old & FUTURE_CALLBACK) {
+        cmd->fn(&cmd->ret, cmd->fn_arg);
+        lake_inflight_put(cmd);
+    } else if (old & FUTURE_RELEASED) {
+        lake_inflight_put(cmd);
+    }
+}
+
+int lake_future_done(struct lake_future *f)
+{
+    return (atomic_read_acquire(&to_cmd(f)->fstate) & FUTURE_DONE) != 0;
+}
+EXPORT_SYMBOL(lake_future_done);
+
+CUresult lake_future_wait(struct lake_future *f, long timeout, struct lake_cmd_ret *ret)
+{
+    struct lake_inflight *cmd = to_cmd(f);
+
+    if (!wait_for_completion_timeout(&cmd->cmd_done, timeout))
+        return CUDA_ERROR_NOT_READY;
+    if (ret)
+        *ret = cmd->ret;
+    return cmd->ret.res;
+}
+EXPORT_SYMBOL(lake_future_wait);
+
+void lake_future_then(struct lake_future *f, lake_future_fn fn, void *arg)
+{
+    struct lake_inflight *cmd = to_cmd(f);
+
+    cmd->fn = fn;
+    cmd->fn_arg = arg;
+    // fully ordered, the reply path sees fn once it sees the flag
+    if (atomic_fetch_or(FUTURE_CALLBACK, &cmd->fstate) & FUTURE_DONE) {
+        fn(&cmd->ret, arg);
+        lake_inflight_put(cmd);
+    }
+}
+EXPORT_SYMBOL(lake_future_then);
+
+void lake_future_release(struct lake_future *f)
+{
+    struct lake_inflight *cmd = to_cmd(f);
+
+    if (atomic_fetch_or(FUTURE_RELEASED, &cmd->fstate) & FUTURE_DONE)
+        lake_inflight_put(cmd);
+}
+EXPORT_SYMBOL(lake_future_release);
+
+struct lake_future *lake_future_cuCtxSynchronize(void)
+{
+    struct lake_cmd_cuCtxSynchronize cmd = {
+        .API_ID = LAKE_API_cuCtxSynchronize,
+    };
+    return lake_send_cmd_future((void*)&cmd, sizeof(cmd));
+}
+EXPORT_SYMBOL(lake_future_cuCtxSynchronize);
+
+struct lake_future *lake_future_cuStreamSynchronize(CUstream hStream)
+{
+    struct lake_cmd_cuStreamSynchronize cmd = {
+        .API_ID = LAKE_API_cuStreamSynchronize, .hStream = hStream,
+    };
+    return lake_send_cmd_future((void*)&cmd, sizeof(cmd));
+}
+EXPORT_SYMBOL(lake_future_cuStreamSynchronize);
+
+struct lake_future *lake_future_hipDeviceSynchronize(void)
+{
+    struct lake_cmd_hipDeviceSynchronize cmd = {
+        .API_ID = LAKE_API_hipDeviceSynchronize,
+    };
+    return lake_send_cmd_future((void*)&cmd, sizeof(cmd));
+}
+EXPORT_SYMBOL(lake_future_hipDeviceSynchronize);
+
+struct lake_future *lake_future_hipStreamSynchronize(hipStream_t hStream)
+{
+    struct lake_cmd_hipStreamSynchronize cmd = {
+        .API_ID = LAKE_API_hipStreamSynchronize, .hStream = hStream,
+    };
+    return lake_send_cmd_future((void*)&cmd, sizeof(cmd));
+}
+EXPORT_SYMBOL(lake_future_hipStreamSynchronize);
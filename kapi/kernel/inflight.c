@@ -0,0 +1,257 @@
+/*
+ * Part of LAKE: Towards a Machine Learning-Assisted Kernel with LAKE
+ *
+ * Original work:
+ *   Copyright (C) 2022–2024 Henrique Fingler
+ *   Copyright (C) 2022–2024 Isha Tarte
+ *
+ * Modifications and adaptations for LAIKA:
+ *   Copyright (C) 2024-2025 Haoming Zhuo
+ *
+ * This file is adapted from the original LAKE kernel module.
+ * Major changes include:
+ *   - Integration with LAIKA framework
+ *   - Hybrid execution support
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <linux/module.h>
+#include <linux/percpu.h>
+#include <linux/spinlock.h>
+#include <linux/wait.h>
+#include <linux/slab.h>
+#include <linux/mm.h>
+#include <linux/log2.h>
+#include "lake_kapi.h"
+
+/*
+ *   In-flight command table.
+ *   Every command gets a preallocated slot; its id (the netlink/ring seq) is
+ *   the slot index with a per-slot generation in the upper bits. A reply
+ *   whose generation does not match the slot is stale and gets dropped
+ *   instead of completing whoever reused the slot. When the table is full
+ *   senders wait for a reply rather than overwrite a live entry.
+ *
+ *   Free slot indexes are cached in small per-CPU magazines so get/put
+ *   usually touch no shared cache line; the global stack is only used to
+ *   refill or drain a magazine.
+ */
+
+static int max_inflight = 4096;
+module_param(max_inflight, int, 0444);
+MODULE_PARM_DESC(max_inflight, "Size of the in-flight command table, rounded up to a power of two, default 4096");
+
+static int inflight_peak = 0;
+module_param(inflight_peak, int, 0444);
+MODULE_PARM_DESC(inflight_peak, "Highest number of commands that were in flight at the same time");
+
+#define INFLIGHT_MAG_SIZE 32
+#define INFLIGHT_MAX_BITS 20  // keeps at least 12 bits of generation
+
+struct inflight_mag {
+    u32 n;
+    u32 idx[INFLIGHT_MAG_SIZE];
+};
+static DEFINE_PER_CPU(struct inflight_mag, inflight_mags);
+
+static struct lake_inflight *table;
+static u32 idx_bits;
+static u32 idx_mask;
+static u32 gen_mask;
+
+static u32 *free_idx;
+static u32 n_free;
+static DEFINE_SPINLOCK(free_lock);
+static DECLARE_WAIT_QUEUE_HEAD(free_wq);
+static atomic_t inflight = ATOMIC_INIT(0);
+
+static bool mag_refill(struct inflight_mag *mag)
+{
+    spin_lock(&free_lock);
+    while (n_free && mag->n < INFLIGHT_MAG_SIZE / 2)
+        mag->idx[mag->n++] = free_idx[--n_free];
+    spin_unlock(&free_lock);
+    return mag->n != 0;
+}
+
+static void mag_drain(struct inflight_mag *mag, u32 keep)
+{
+    spin_lock(&free_lock);
+    while (mag->n > keep)
+        free_idx[n_free++] = mag->idx[--mag->n];
+    spin_unlock(&free_lock);
+}
+
+static void update_peak(int cur)
+{
+    int peak = READ_ONCE(inflight_peak);
+    int old;
+
+    while (cur > peak) {
+        old = cmpxchg(&inflight_peak, peak, cur);
+        if (old == peak)
+            break;
+        peak = old;
+    }
+}
+
+// may sleep if every slot is in flight
+struct lake_inflight *lake_inflight_get(char sync)
+{
+    struct inflight_mag *mag;
+    struct lake_inflight *cmd;
+    u32 idx, gen;
+
+    for (;;) {
+        mag = get_cpu_ptr(&inflight_mags);
+        if (likely(mag->n) || mag_refill(mag)) {
+            idx = mag->idx[--mag->n];
+            put_cpu_ptr(&inflight_mags);
+            break;
+        }
+        put_cpu_ptr(&inflight_mags);
+        // put() hands slots straight to the global stack while we wait
+        wait_event_timeout(free_wq, READ_ONCE(n_free) != 0, 1);
+    }
+
+    cmd = &table[idx];
+    // generation 0 marks a free slot, skip it when wrapping
+    gen = (cmd->gen + 1) & gen_mask;
+    if (unlikely(gen == 0))
+        gen = 1;
+    cmd->gen = gen;
+    cmd->sync = sync;
+    cmd->posted = false;
+    atomic_set(&cmd->fstate, 0);
+    reinit_completion(&cmd->cmd_done);
+    // publish the id last, a stale reply must not see a half-initialized slot
+    smp_store_release(&cmd->id, (gen << idx_bits) | idx);
+
+    update_peak(atomic_inc_return(&inflight));
+    return cmd;
+}
+
+void lake_inflight_put(struct lake_inflight *cmd)
+{
+    struct inflight_mag *mag;
+    u32 idx = cmd - table;
+
+    // a generation 0 id never matches, late replies for this slot get dropped
+    WRITE_ONCE(cmd->id, idx);
+    atomic_dec(&inflight);
+
+    mag = get_cpu_ptr(&inflight_mags);
+    if (unlikely(mag->n == INFLIGHT_MAG_SIZE))
+        mag_drain(mag, INFLIGHT_MAG_SIZE / 2);
+    mag->idx[mag->n++] = idx;
+    if (unlikely(waitqueue_active(&free_wq))) {
+        mag_drain(mag, 0);
+        put_cpu_ptr(&inflight_mags);
+        wake_up(&free_wq);
+        return;
+    }
+    put_cpu_ptr(&inflight_mags);
+}
+
+// returns NULL if id does not name a command currently in flight
+struct lake_inflight *lake_inflight_lookup(u32 id)
+{
+    struct lake_inflight *cmd = &table[id & idx_mask];
+
+    if (unlikely((id >> idx_bits) == 0 || smp_load_acquire(&cmd->id) != id))
+        return NULL;
+    return cmd;
+}
+
+/*
+ * Like lake_inflight_lookup, but only one caller gets the command: a reply
+ * and lake_inflight_fail_all can race for it, whoever loses gets NULL.
+ */
+struct lake_inflight *lake_inflight_claim(u32 id)
+{
+    struct lake_inflight *cmd = lake_inflight_lookup(id);
+
+    if (cmd && cmpxchg(&cmd->id, id, id & idx_mask) != id)
+        return NULL;
+    return cmd;
+}
+
+/*
+ * Completes every posted command with ret, for when lake_uspace is gone
+ * and no reply will come. Commands still being set up are left to their
+ * sender, which sees the worker gone when it posts them.
+ */
+void lake_inflight_fail_all(struct lake_cmd_ret *ret)
+{
+    u32 i, id, n = 0;
+
+    for (i = 0; i <= idx_mask; i++) {
+        id = smp_load_acquire(&table[i].id);
+        // a claim only succeeds if id is unchanged, so posted was read for this generation
+        if ((id >> idx_bits) == 0 || !smp_load_acquire(&table[i].posted))
+            continue;
+        if (lake_complete_cmd(id, ret) == 0)
+            n++;
+    }
+    if (n)
+        pr_warn("Failed %u commands in flight, lake_uspace is gone\n", n);
+}
+
+int lake_inflight_init(void)
+{
+    // magazines can strand up to INFLIGHT_MAG_SIZE slots per cpu, never let them hold half the table
+    u32 min_slots = 2 * INFLIGHT_MAG_SIZE * num_possible_cpus();
+    u32 slots = max_t(u32, max_inflight, min_slots);
+    u32 i;
+
+    slots = min_t(u32, roundup_pow_of_two(slots), 1u << INFLIGHT_MAX_BITS);
+    idx_bits = ilog2(slots);
+    idx_mask = slots - 1;
+    gen_mask = (1u << (32 - idx_bits)) - 1;
+
+    table = kvcalloc(slots, sizeof(*table), GFP_KERNEL);
+    free_idx = kvcalloc(slots, sizeof(*free_idx), GFP_KERNEL);
+    if (!table || !free_idx) {
+        pr_err("Failed to allocate in-flight table of %u slots\n", slots);
+        kvfree(table);
+        kvfree(free_idx);
+        table = NULL;
+        free_idx = NULL;
+        return -ENOMEM;
+    }
+
+    // hand out low slots first, they stay warm in cache
+    for (i = 0; i < slots; i++) {
+        table[i].id = i;
+        init_completion(&table[i].cmd_done);
+        free_idx[i] = slots - 1 - i;
+    }
+    n_free = slots;
+    max_inflight = slots;
+    return 0;
+}
+
+void lake_inflight_fini(void)
+{
+    int cpu;
+
+    if (atomic_read(&inflight))
+        pr_warn("%d commands still in flight at exit\n", atomic_read(&inflight));
+    for_each_possible_cpu(cpu)
+        per_cpu_ptr(&inflight_mags, cpu)->n = 0;
+    kvfree(table);
+    kvfree(free_idx);
+    table = NULL;
+    free_idx = NULL;
+}
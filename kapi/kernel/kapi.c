@@ -36,38 +36,63 @@
 #include "lake_shm.h"
 #include "kargs.h"
 
-// Smart memory allocation: use kmalloc for small memory, vmalloc for large memory
-static inline void* fast_alloc(size_t size) {
-    // If size is less than one page, use kmalloc (faster)
-    if (likely(size < PAGE_SIZE))
-        return kmalloc(size, GFP_KERNEL);
-    return vmalloc(size);
-}
-
-static inline void fast_free(void* ptr, size_t size) {
-    if (likely(size < PAGE_SIZE))
-        kfree(ptr);
-    else
-        vfree(ptr);
-}
-
 /*
  *
  *   Functions in this file export CUDA symbols.
  *   In general they fill a struct and send it through netlink.
- *   They also choose if they are sync or async calls.
+ *   Whether they wait for the reply is the policy of the command in
+ *   LAKE_APIS (commands.h), applied by its lake_send_<api>.
  *   Some have special handling, such as memcpys
  * 
  *   TODO: support netlink copies (not urgent)
  *   TODO: accumulate errors
  */
 
+const struct lake_api_info lake_api_info[LAKE_API_NR] = {
+    LAKE_APIS(LAKE_API_INFO)
+};
+
+/*
+ * Launches are the hot path of small-batch inference, so they marshal
+ * into a buffer on the stack instead of allocating one: the command plus
+ * at most KARGS_MAX_ARGS serialized arguments. A per-cpu buffer does not
+ * work here since lake_send_cmd may sleep. The cu and hip launch commands
+ * share their layout.
+ */
+static CUresult lake_launch(u32 api_id, void *f,
+        unsigned int gridDimX, unsigned int gridDimY, unsigned int gridDimZ,
+        unsigned int blockDimX, unsigned int blockDimY, unsigned int blockDimZ,
+        unsigned int sharedMemBytes, CUstream hStream, void **kernelParams)
+{
+    struct lake_cmd_ret ret;
+    u64 cmd_and_args[(sizeof(struct lake_cmd_cuLaunchKernel) + KARGS_MAX_SIZE + 7) / 8];
+    struct lake_cmd_cuLaunchKernel *cmd = (struct lake_cmd_cuLaunchKernel*) cmd_and_args;
+    struct kernel_args_metadata* meta = get_kargs(f);
+    u32 tsize;
+
+    BUILD_BUG_ON(sizeof(struct lake_cmd_cuLaunchKernel) != sizeof(struct lake_cmd_hipModuleLaunchKernel));
+    if (unlikely(!meta))
+        return CUDA_ERROR_OUT_OF_MEMORY;
+    tsize = sizeof(struct lake_cmd_cuLaunchKernel) + meta->total_size;
+
+    cmd->API_ID = api_id; cmd->f = f;
+    cmd->gridDimX = gridDimX; cmd->gridDimY = gridDimY; cmd->gridDimZ = gridDimZ;
+    cmd->blockDimX = blockDimX; cmd->blockDimY = blockDimY; cmd->blockDimZ = blockDimZ;
+    cmd->sharedMemBytes = sharedMemBytes; cmd->hStream = hStream; cmd->extra = 0;
+
+    cmd->paramsSize = meta->total_size;
+    serialize_args(meta, (u8*)(cmd + 1), kernelParams);
+
+    lake_send_cmd(cmd_and_args, tsize, CMD_ASYNC, &ret);
+    return ret.res;
+}
+
 CUresult CUDAAPI cuInit(unsigned int flags) {
     struct lake_cmd_ret ret;
 	struct lake_cmd_cuInit cmd = {
-        .API_ID = LAKE_API_cuInit, .flags = flags,
+        .flags = flags,
     };
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_cuInit(&cmd, &ret);
 	return ret.res;
 }
 EXPORT_SYMBOL(cuInit);
@@ -75,9 +100,9 @@ EXPORT_SYMBOL(cuInit);
 CUresult CUDAAPI cuDeviceGet(CUdevice *device, int ordinal) {
     struct lake_cmd_ret ret;
 	struct lake_cmd_cuDeviceGet cmd = {
-        .API_ID = LAKE_API_cuDeviceGet, .ordinal = ordinal,
+        .ordinal = ordinal,
     };
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_cuDeviceGet(&cmd, &ret);
     *device = ret.device;
 	return ret.res;
 }
@@ -86,9 +111,9 @@ EXPORT_SYMBOL(cuDeviceGet);
 CUresult CUDAAPI cuCtxCreate(CUcontext *pctx, unsigned int flags, CUdevice dev) {
     struct lake_cmd_ret ret;
 	struct lake_cmd_cuCtxCreate cmd = {
-        .API_ID = LAKE_API_cuCtxCreate, .flags = flags, .dev = dev
+        .flags = flags, .dev = dev
     };
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_cuCtxCreate(&cmd, &ret);
     *pctx = ret.pctx;
 	return ret.res;
 }
@@ -98,22 +123,20 @@ EXPORT_SYMBOL(cuCtxCreate);
 CUresult CUDAAPI cuCtxDestroy(CUcontext pctx) {
     struct lake_cmd_ret ret;
 	struct lake_cmd_cuCtxDestroy cmd = {
-        .API_ID = LAKE_API_cuCtxDestroy, .ctx = pctx,
+        .ctx = pctx,
     };
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_cuCtxDestroy(&cmd, &ret);
 	return ret.res;
 }
 EXPORT_SYMBOL(cuCtxDestroy);
 
 CUresult CUDAAPI cuModuleLoad(CUmodule *module, const char *fname) {
     struct lake_cmd_ret ret;
-	struct lake_cmd_cuModuleLoad cmd = {
-        .API_ID = LAKE_API_cuModuleLoad
-    };
+	struct lake_cmd_cuModuleLoad cmd = {};
     // Use strncpy and ensure null termination
     strncpy(cmd.fname, fname, sizeof(cmd.fname) - 1);
     cmd.fname[sizeof(cmd.fname) - 1] = '\0';
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_cuModuleLoad(&cmd, &ret);
     *module = ret.module;
 	return ret.res;
 }
@@ -122,9 +145,9 @@ EXPORT_SYMBOL(cuModuleLoad);
 CUresult CUDAAPI cuModuleUnload(CUmodule hmod) {
     struct lake_cmd_ret ret;
 	struct lake_cmd_cuModuleUnload cmd = {
-        .API_ID = LAKE_API_cuModuleUnload, .hmod = hmod
+        .hmod = hmod
     };
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_cuModuleUnload(&cmd, &ret);
 	return ret.res;
 }
 EXPORT_SYMBOL(cuModuleUnload);
@@ -133,12 +156,12 @@ CUresult CUDAAPI cuModuleGetFunction(CUfunction *hfunc, CUmodule hmod, const cha
     struct kernel_args_metadata* meta;
     struct lake_cmd_ret ret;
 	struct lake_cmd_cuModuleGetFunction cmd = {
-        .API_ID = LAKE_API_cuModuleGetFunction, .hmod = hmod
+        .hmod = hmod
     };
     // Use strncpy and ensure null termination
     strncpy(cmd.name, name, sizeof(cmd.name) - 1);
     cmd.name[sizeof(cmd.name) - 1] = '\0';
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_cuModuleGetFunction(&cmd, &ret);
     *hfunc = ret.func;
 
     //parse and store kargs
@@ -160,38 +183,17 @@ CUresult CUDAAPI cuLaunchKernel(CUfunction f,
                                 CUstream hStream,
                                 void **kernelParams,
                                 void **extra) {
-    struct lake_cmd_ret ret;
-    struct kernel_args_metadata* meta = get_kargs(f);
-    u32 tsize = sizeof(struct lake_cmd_cuLaunchKernel) + meta->total_size;
-    // Use smart memory allocation, kmalloc for small memory (faster)
-    void* cmd_and_args = fast_alloc(tsize);
-    if (unlikely(!cmd_and_args)) {
-        ret.res = CUDA_ERROR_OUT_OF_MEMORY;
-        return ret.res;
-    }
-	struct lake_cmd_cuLaunchKernel *cmd = (struct lake_cmd_cuLaunchKernel*) cmd_and_args;
-    u8 *args = cmd_and_args + sizeof(struct lake_cmd_cuLaunchKernel);
-
-    cmd->API_ID = LAKE_API_cuLaunchKernel; cmd->f = f; 
-    cmd->gridDimX = gridDimX; cmd->gridDimY = gridDimY; cmd->gridDimZ = gridDimZ;
-    cmd->blockDimX = blockDimX; cmd->blockDimY = blockDimY; cmd->blockDimZ = blockDimZ;
-    cmd->sharedMemBytes = sharedMemBytes; cmd->hStream = hStream; cmd->extra = 0;
-
-    cmd->paramsSize = meta->total_size;
-    serialize_args(meta, args, kernelParams);
-
-    lake_send_cmd(cmd_and_args, tsize, CMD_ASYNC, &ret);
-    fast_free(cmd_and_args, tsize);
-	return ret.res;
+    return lake_launch(LAKE_API_cuLaunchKernel, f, gridDimX, gridDimY, gridDimZ,
+            blockDimX, blockDimY, blockDimZ, sharedMemBytes, hStream, kernelParams);
 }
 EXPORT_SYMBOL(cuLaunchKernel);
 
 CUresult CUDAAPI cuMemAlloc(CUdeviceptr *dptr, size_t bytesize) {
     struct lake_cmd_ret ret;
 	struct lake_cmd_cuMemAlloc cmd = {
-        .API_ID = LAKE_API_cuMemAlloc, .bytesize = bytesize
+        .bytesize = bytesize
     };
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_cuMemAlloc(&cmd, &ret);
     *dptr = ret.ptr;
 	return ret.res;
 }
@@ -200,7 +202,7 @@ EXPORT_SYMBOL(cuMemAlloc);
 CUresult CUDAAPI cuMemcpyHtoD(CUdeviceptr dstDevice, const void *srcHost, size_t ByteCount) {
     struct lake_cmd_ret ret;
 	struct lake_cmd_cuMemcpyHtoD cmd = {
-        .API_ID = LAKE_API_cuMemcpyHtoD, .dstDevice = dstDevice, .srcHost = srcHost,
+        .dstDevice = dstDevice, .srcHost = srcHost,
         .ByteCount = ByteCount
     };
 
@@ -210,7 +212,7 @@ CUresult CUDAAPI cuMemcpyHtoD(CUdeviceptr dstDevice, const void *srcHost, size_t
         return CUDA_ERROR_INVALID_VALUE;
     }
     cmd.srcHost = (void*)offset;
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_cuMemcpyHtoD(&cmd, &ret);
 	return ret.res;
 }
 EXPORT_SYMBOL(cuMemcpyHtoD);
@@ -218,7 +220,7 @@ EXPORT_SYMBOL(cuMemcpyHtoD);
 CUresult CUDAAPI cuMemcpyDtoH(void *dstHost, CUdeviceptr srcDevice, size_t ByteCount) {
     struct lake_cmd_ret ret;
 	struct lake_cmd_cuMemcpyDtoH cmd = {
-        .API_ID = LAKE_API_cuMemcpyDtoH, .srcDevice = srcDevice,
+        .srcDevice = srcDevice,
         .ByteCount = ByteCount
     };
 
@@ -228,17 +230,15 @@ CUresult CUDAAPI cuMemcpyDtoH(void *dstHost, CUdeviceptr srcDevice, size_t ByteC
         return CUDA_ERROR_INVALID_VALUE;
     }
     cmd.dstHost = (void*)offset;
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_cuMemcpyDtoH(&cmd, &ret);
 	return ret.res;
 }
 EXPORT_SYMBOL(cuMemcpyDtoH);
 
 CUresult CUDAAPI cuCtxSynchronize(void) {
     struct lake_cmd_ret ret;
-	struct lake_cmd_cuCtxSynchronize cmd = {
-        .API_ID = LAKE_API_cuCtxSynchronize,
-    };
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+	struct lake_cmd_cuCtxSynchronize cmd = {};
+    lake_send_cuCtxSynchronize(&cmd, &ret);
 	return ret.res;
 }
 EXPORT_SYMBOL(cuCtxSynchronize);
@@ -246,9 +246,10 @@ EXPORT_SYMBOL(cuCtxSynchronize);
 CUresult CUDAAPI cuMemFree(CUdeviceptr dptr) {
     struct lake_cmd_ret ret;
 	struct lake_cmd_cuMemFree cmd = {
-        .API_ID = LAKE_API_cuMemFree, .dptr = dptr
+        .dptr = dptr
     };
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    // see devpool.c
+    lake_send_cuMemFree(&cmd, &ret);
 	return ret.res;
 }
 EXPORT_SYMBOL(cuMemFree);
@@ -256,9 +257,9 @@ EXPORT_SYMBOL(cuMemFree);
 CUresult CUDAAPI cuStreamCreate(CUstream *phStream, unsigned int Flags) {
     struct lake_cmd_ret ret;
 	struct lake_cmd_cuStreamCreate cmd = {
-        .API_ID = LAKE_API_cuStreamCreate, .Flags = Flags
+        .Flags = Flags
     };
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_cuStreamCreate(&cmd, &ret);
     *phStream = ret.stream;
 	return ret.res;
 }
@@ -267,9 +268,9 @@ EXPORT_SYMBOL(cuStreamCreate);
 CUresult CUDAAPI cuStreamDestroy (CUstream hStream) {
     struct lake_cmd_ret ret;
 	struct lake_cmd_cuStreamDestroy cmd = {
-        .API_ID = LAKE_API_cuStreamDestroy, .hStream = hStream
+        .hStream = hStream
     };
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_cuStreamDestroy(&cmd, &ret);
 	return ret.res;
 }
 EXPORT_SYMBOL(cuStreamDestroy);
@@ -277,9 +278,9 @@ EXPORT_SYMBOL(cuStreamDestroy);
 CUresult CUDAAPI cuStreamSynchronize(CUstream hStream) {
     struct lake_cmd_ret ret;
 	struct lake_cmd_cuStreamSynchronize cmd = {
-        .API_ID = LAKE_API_cuStreamSynchronize, .hStream = hStream
+        .hStream = hStream
     };
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_cuStreamSynchronize(&cmd, &ret);
 	return ret.res;
 }
 EXPORT_SYMBOL(cuStreamSynchronize);
@@ -287,7 +288,7 @@ EXPORT_SYMBOL(cuStreamSynchronize);
 CUresult CUDAAPI cuMemcpyHtoDAsync(CUdeviceptr dstDevice, const void *srcHost, size_t ByteCount, CUstream hStream) {
     struct lake_cmd_ret ret;
 	struct lake_cmd_cuMemcpyHtoDAsync cmd = {
-        .API_ID = LAKE_API_cuMemcpyHtoDAsync, .dstDevice = dstDevice, .srcHost = srcHost, 
+        .dstDevice = dstDevice, .srcHost = srcHost, 
         .ByteCount = ByteCount, .hStream = hStream
     };
     s64 offset = kava_shm_offset(srcHost);
@@ -297,7 +298,7 @@ CUresult CUDAAPI cuMemcpyHtoDAsync(CUdeviceptr dstDevice, const void *srcHost, s
     }
     cmd.srcHost = (void*)offset;
 
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_ASYNC, &ret);
+    lake_send_cuMemcpyHtoDAsync(&cmd, &ret);
 	return ret.res;
 }
 EXPORT_SYMBOL(cuMemcpyHtoDAsync);
@@ -305,7 +306,7 @@ EXPORT_SYMBOL(cuMemcpyHtoDAsync);
 CUresult CUDAAPI cuMemcpyDtoHAsync(void *dstHost, CUdeviceptr srcDevice, size_t ByteCount, CUstream hStream) {
     struct lake_cmd_ret ret;
 	struct lake_cmd_cuMemcpyDtoHAsync cmd = {
-        .API_ID = LAKE_API_cuMemcpyDtoHAsync, .dstHost = dstHost, .srcDevice = srcDevice,
+        .dstHost = dstHost, .srcDevice = srcDevice,
         .ByteCount = ByteCount, .hStream = hStream
     };
     
@@ -316,7 +317,7 @@ CUresult CUDAAPI cuMemcpyDtoHAsync(void *dstHost, CUdeviceptr srcDevice, size_t
     }
     cmd.dstHost = (void*)offset;
 
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_ASYNC, &ret);
+    lake_send_cuMemcpyDtoHAsync(&cmd, &ret);
 	return ret.res;
 }
 EXPORT_SYMBOL(cuMemcpyDtoHAsync);
@@ -325,10 +326,10 @@ CUresult CUDAAPI cuMemAllocPitch(CUdeviceptr* dptr, size_t* pPitch,
         size_t WidthInBytes, size_t Height, unsigned int ElementSizeBytes) {
     struct lake_cmd_ret ret;
 	struct lake_cmd_cuMemAllocPitch cmd = {
-        .API_ID = LAKE_API_cuMemAllocPitch, .WidthInBytes = WidthInBytes,
+        .WidthInBytes = WidthInBytes,
         .Height = Height, .ElementSizeBytes = ElementSizeBytes
     };
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_cuMemAllocPitch(&cmd, &ret);
     *dptr = ret.ptr;
     *pPitch = ret.pPitch;
 	return ret.res;
@@ -342,9 +343,7 @@ EXPORT_SYMBOL(cuMemAllocPitch);
 
 CUresult CUDAAPI kleioLoadModel(const void *srcHost, size_t len) {
     struct lake_cmd_ret ret;
-	struct lake_cmd_kleioLoadModel cmd = {
-        .API_ID = LAKE_API_kleioLoadModel
-    };
+	struct lake_cmd_kleioLoadModel cmd = {};
 
     // s64 offset = kava_shm_offset(srcHost);
     // if (offset < 0) {
@@ -352,7 +351,7 @@ CUresult CUDAAPI kleioLoadModel(const void *srcHost, size_t len) {
     //     return CUDA_ERROR_INVALID_VALUE;
     // }
     // cmd.srcHost = (void*)offset;
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_kleioLoadModel(&cmd, &ret);
 	return ret.res;
 }
 EXPORT_SYMBOL(kleioLoadModel);
@@ -360,7 +359,7 @@ EXPORT_SYMBOL(kleioLoadModel);
 CUresult CUDAAPI kleioInference(const void *srcHost, size_t len, int use_gpu) {
     struct lake_cmd_ret ret;
 	struct lake_cmd_kleioInference cmd = {
-        .API_ID = LAKE_API_kleioInference, .len = len,
+        .len = len,
         .use_gpu = use_gpu
     };
     // s64 offset = kava_shm_offset(srcHost);
@@ -369,27 +368,23 @@ CUresult CUDAAPI kleioInference(const void *srcHost, size_t len, int use_gpu) {
     //     return CUDA_ERROR_INVALID_VALUE;
     // }
     // cmd.srcHost = (void*)offset;
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_kleioInference(&cmd, &ret);
 	return ret.res;
 }
 EXPORT_SYMBOL(kleioInference);
 
 CUresult CUDAAPI kleioForceGC(void) {
     struct lake_cmd_ret ret;
-	struct lake_cmd_kleioForceGC cmd = {
-        .API_ID = LAKE_API_kleioForceGC,
-    };
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+	struct lake_cmd_kleioForceGC cmd = {};
+    lake_send_kleioForceGC(&cmd, &ret);
 	return ret.res;
 }
 EXPORT_SYMBOL(kleioForceGC);
 
 CUresult CUDAAPI nvmlRunningProcs(int* nproc) {
     struct lake_cmd_ret ret;
-	struct lake_cmd_nvmlRunningProcs cmd = {
-        .API_ID = LAKE_API_nvmlRunningProcs,
-    };
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+	struct lake_cmd_nvmlRunningProcs cmd = {};
+    lake_send_nvmlRunningProcs(&cmd, &ret);
     *nproc = (int)ret.ptr;
 	return ret.res;
 }
@@ -397,10 +392,8 @@ EXPORT_SYMBOL(nvmlRunningProcs);
 
 CUresult CUDAAPI nvmlUtilRate(int* nproc) {
     struct lake_cmd_ret ret;
-	struct lake_cmd_nvmlUtilRate cmd = {
-        .API_ID = LAKE_API_nvmlUtilRate,
-    };
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+	struct lake_cmd_nvmlUtilRate cmd = {};
+    lake_send_nvmlUtilRate(&cmd, &ret);
     *nproc = (int)ret.ptr;
 	return ret.res;
 }
@@ -409,13 +402,10 @@ EXPORT_SYMBOL(nvmlUtilRate);
 hipError_t HIPAPI hipHostMalloc(void** ptr, size_t size, unsigned int flags) {
     struct lake_cmd_ret ret;
     struct lake_cmd_hipHostMalloc cmd = {
-        .API_ID = LAKE_API_hipHostMalloc,
         .size = size,
         .flags = flags
     };
-    pr_err("before send cmd\n");
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
-    pr_err("after send cmd\n");
+    lake_send_hipHostMalloc(&cmd, &ret);
     *ptr = ret.ptr;
     return ret.res;
 }
@@ -424,7 +414,6 @@ EXPORT_SYMBOL(hipHostMalloc);
 hipError_t HIPAPI hipHostGetDevicePointer(void** devPtr, void* hstPtr, unsigned int flags) {
     struct lake_cmd_ret ret;
     struct lake_cmd_hipHostGetDevicePointer cmd = {
-        .API_ID = LAKE_API_hipHostGetDevicePointer,
         .flags = flags
     };
 
@@ -435,7 +424,7 @@ hipError_t HIPAPI hipHostGetDevicePointer(void** devPtr, void* hstPtr, unsigned
     }
     cmd.hstPtr = (void*)offset;
 
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_hipHostGetDevicePointer(&cmd, &ret);
     *devPtr = ret.ptr;
     return ret.res;
 }
@@ -445,9 +434,9 @@ EXPORT_SYMBOL(hipHostGetDevicePointer);
 hipError_t HIPAPI hipHostFree(void* ptr) {
     struct lake_cmd_ret ret;
     struct lake_cmd_hipHostFree cmd = {
-        .API_ID = LAKE_API_hipHostFree, .ptr = ptr
+        .ptr = ptr
     };
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_hipHostFree(&cmd, &ret);
     return ret.res;
     
 }
@@ -456,7 +445,6 @@ EXPORT_SYMBOL(hipHostFree);
 hipError_t hipHostRegister(void* hostPtr, size_t sizeBytes, unsigned int flags){
     struct lake_cmd_ret ret;
     struct lake_cmd_hipHostRegister cmd = {
-        .API_ID = LAKE_API_hipHostRegister,
         .sizeBytes = sizeBytes,
         .flags = flags
     };
@@ -467,23 +455,21 @@ hipError_t hipHostRegister(void* hostPtr, size_t sizeBytes, unsigned int flags){
         return CUDA_ERROR_INVALID_VALUE;
     }
     cmd.hostPtr = (void*)offset;
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_hipHostRegister(&cmd, &ret);
     return ret.res;
 }
 EXPORT_SYMBOL(hipHostRegister);
 
 hipError_t HIPAPI hipHostUnregister(void* hostPtr) {
     struct lake_cmd_ret ret;
-	struct lake_cmd_hipHostUnregister cmd = {
-        .API_ID = LAKE_API_hipHostUnregister
-    };
+	struct lake_cmd_hipHostUnregister cmd = {};
     s64 offset = kava_shm_offset(hostPtr);
     if (offset < 0) {
         pr_err("hostPtr in hipHostUnregister is NOT a kshm pointer (use kava_alloc to fix it)\n");
         return hipErrorInvalidValue;
     }
     cmd.hostPtr = (void*)offset;
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_hipHostUnregister(&cmd, &ret);
 	return ret.res;
 }
 EXPORT_SYMBOL(hipHostUnregister);
@@ -491,9 +477,9 @@ EXPORT_SYMBOL(hipHostUnregister);
 hipError_t HIPAPI hipInit(unsigned int flags) {
     struct lake_cmd_ret ret;
 	struct lake_cmd_hipInit cmd = {
-        .API_ID = LAKE_API_hipInit, .flags = flags,
+        .flags = flags,
     };
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_hipInit(&cmd, &ret);
 	return ret.res;
 }
 EXPORT_SYMBOL(hipInit);
@@ -501,9 +487,9 @@ EXPORT_SYMBOL(hipInit);
 hipError_t HIPAPI hipCtxCreate(hipCtx_t *pctx, unsigned int flags, hipDevice_t dev) {
     struct lake_cmd_ret ret;
 	struct lake_cmd_hipCtxCreate cmd = {
-        .API_ID = LAKE_API_hipCtxCreate, .flags = flags, .dev = dev
+        .flags = flags, .dev = dev
     };
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_hipCtxCreate(&cmd, &ret);
     *pctx = ret.pctx;
 	return ret.res;
 }
@@ -513,12 +499,12 @@ hipError_t HIPAPI hipModuleGetFunction(hipFunction_t* function, hipModule_t hmod
     struct kernel_args_metadata* meta;
     struct lake_cmd_ret ret;
 	struct lake_cmd_hipModuleGetFunction cmd = {
-        .API_ID = LAKE_API_hipModuleGetFunction, .hmod = hmod
+        .hmod = hmod
     };
     // Use strncpy and ensure null termination
     strncpy(cmd.name, kname, sizeof(cmd.name) - 1);
     cmd.name[sizeof(cmd.name) - 1] = '\0';
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_hipModuleGetFunction(&cmd, &ret);
     *function = ret.func;
 
     //parse and store kargs
@@ -532,9 +518,9 @@ EXPORT_SYMBOL(hipModuleGetFunction);
 hipError_t HIPAPI hipMalloc(void** ptr, size_t size){
     struct lake_cmd_ret ret;
 	struct lake_cmd_hipMalloc cmd = {
-        .API_ID = LAKE_API_hipMalloc, .bytesize = size
+        .bytesize = size
     };
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_hipMalloc(&cmd, &ret);
     *ptr = ret.ptr;
 	return ret.res;
 }
@@ -543,9 +529,9 @@ EXPORT_SYMBOL(hipMalloc);
 hipError_t HIPAPI hipFree(hipDeviceptr_t dptr) {
     struct lake_cmd_ret ret;
 	struct lake_cmd_hipFree cmd = {
-    .API_ID = LAKE_API_hipFree, .dptr = dptr
+    .dptr = dptr
     };
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_hipFree(&cmd, &ret);
 	return ret.res;
 }
 EXPORT_SYMBOL(hipFree);
@@ -553,7 +539,7 @@ EXPORT_SYMBOL(hipFree);
     hipError_t HIPAPI hipMemcpyHtoDAsync(hipDeviceptr_t dstDevice, const void *srcHost, size_t ByteCount, hipStream_t hStream) {
     struct lake_cmd_ret ret;
 	struct lake_cmd_hipMemcpyHtoDAsync cmd = {
-        .API_ID = LAKE_API_hipMemcpyHtoDAsync, .dstDevice = dstDevice, .srcHost = srcHost, 
+        .dstDevice = dstDevice, .srcHost = srcHost, 
         .ByteCount = ByteCount, .hStream = hStream
     };
     s64 offset = kava_shm_offset(srcHost);
@@ -563,7 +549,7 @@ EXPORT_SYMBOL(hipFree);
     }
     cmd.srcHost = (void*)offset;
 
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_ASYNC, &ret);
+    lake_send_hipMemcpyHtoDAsync(&cmd, &ret);
 	return ret.res;
 }
 EXPORT_SYMBOL(hipMemcpyHtoDAsync);
@@ -571,7 +557,7 @@ EXPORT_SYMBOL(hipMemcpyHtoDAsync);
 hipError_t HIPAPI hipMemcpyHtoD(hipDeviceptr_t dstDevice, const void *srcHost, size_t ByteCount) {
     struct lake_cmd_ret ret;
 	struct lake_cmd_hipMemcpyHtoD cmd = {
-        .API_ID = LAKE_API_hipMemcpyHtoD, .dstDevice = dstDevice, .srcHost = srcHost,
+        .dstDevice = dstDevice, .srcHost = srcHost,
         .ByteCount = ByteCount
     };
 
@@ -581,7 +567,7 @@ hipError_t HIPAPI hipMemcpyHtoD(hipDeviceptr_t dstDevice, const void *srcHost, s
         return hipErrorInvalidValue;
     }
     cmd.srcHost = (void*)offset;
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_hipMemcpyHtoD(&cmd, &ret);
 	return ret.res;
 }
 EXPORT_SYMBOL(hipMemcpyHtoD);
@@ -589,7 +575,7 @@ EXPORT_SYMBOL(hipMemcpyHtoD);
 hipError_t HIPAPI hipMemcpyDtoH(void *dstHost, hipDeviceptr_t srcDevice, size_t ByteCount) {
     struct lake_cmd_ret ret;
 	struct lake_cmd_hipMemcpyDtoH cmd = {
-        .API_ID = LAKE_API_hipMemcpyDtoH, .srcDevice = srcDevice,
+        .srcDevice = srcDevice,
         .ByteCount = ByteCount
     };
 
@@ -599,17 +585,15 @@ hipError_t HIPAPI hipMemcpyDtoH(void *dstHost, hipDeviceptr_t srcDevice, size_t
         return hipErrorInvalidValue;
     }
     cmd.dstHost = (void*)offset;
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_hipMemcpyDtoH(&cmd, &ret);
 	return ret.res;
 }
 EXPORT_SYMBOL(hipMemcpyDtoH);
 
 hipError_t HIPAPI hipDeviceSynchronize(void) {
     struct lake_cmd_ret ret;
-	struct lake_cmd_hipDeviceSynchronize cmd = {
-        .API_ID = LAKE_API_hipDeviceSynchronize,
-    };
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+	struct lake_cmd_hipDeviceSynchronize cmd = {};
+    lake_send_hipDeviceSynchronize(&cmd, &ret);
 	return ret.res;
 }
 EXPORT_SYMBOL(hipDeviceSynchronize);
@@ -625,38 +609,17 @@ hipError_t HIPAPI hipModuleLaunchKernel(hipFunction_t f,
     hipStream_t hstream,
     void** kernelParams,
     void** extra){
-struct lake_cmd_ret ret;
-struct kernel_args_metadata* meta = get_kargs(f);
-u32 tsize = sizeof(struct lake_cmd_hipModuleLaunchKernel) + meta->total_size;
-// Use smart memory allocation, kmalloc for small memory (faster)
-void* cmd_and_args = fast_alloc(tsize);
-if (unlikely(!cmd_and_args)) {
-    ret.res = hipErrorOutOfMemory;
-    return ret.res;
-}
-struct lake_cmd_hipModuleLaunchKernel *cmd = (struct lake_cmd_hipModuleLaunchKernel*) cmd_and_args;
-u8 *args = cmd_and_args + sizeof(struct lake_cmd_hipModuleLaunchKernel);
-
-cmd->API_ID = LAKE_API_hipModuleLaunchKernel; cmd->f = f; 
-cmd->gridDimX = gridDimX; cmd->gridDimY = gridDimY; cmd->gridDimZ = gridDimZ;
-cmd->blockDimX = blockDimX; cmd->blockDimY = blockDimY; cmd->blockDimZ = blockDimZ;
-cmd->sharedMemBytes = sharedMemBytes; cmd->hStream = hstream; cmd->extra = 0;
-
-cmd->paramsSize = meta->total_size;
-serialize_args(meta, args, kernelParams);
-
-lake_send_cmd(cmd_and_args, tsize, CMD_ASYNC, &ret);
-fast_free(cmd_and_args, tsize);
-return ret.res;
+return lake_launch(LAKE_API_hipModuleLaunchKernel, f, gridDimX, gridDimY, gridDimZ,
+        blockDimX, blockDimY, blockDimZ, sharedMemBytes, hstream, kernelParams);
 }
 EXPORT_SYMBOL(hipModuleLaunchKernel);
 
 hipError_t HIPAPI hipDeviceGet(hipdevice_t *device, int ordinal) {
     struct lake_cmd_ret ret;
 	struct lake_cmd_hipDeviceGet cmd = {
-        .API_ID = LAKE_API_hipDeviceGet, .ordinal = ordinal,
+        .ordinal = ordinal,
     };
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_hipDeviceGet(&cmd, &ret);
     *device = ret.device;
 	return ret.res;
 }
@@ -664,13 +627,11 @@ EXPORT_SYMBOL(hipDeviceGet);
 
 hipError_t HIPAPI hipModuleLoad(hipModule_t *module, const char *fname) {
     struct lake_cmd_ret ret;
-	struct lake_cmd_hipModuleLoad cmd = {
-        .API_ID = LAKE_API_hipModuleLoad
-    };
+	struct lake_cmd_hipModuleLoad cmd = {};
     // Use strncpy and ensure null termination
     strncpy(cmd.fname, fname, sizeof(cmd.fname) - 1);
     cmd.fname[sizeof(cmd.fname) - 1] = '\0';
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_hipModuleLoad(&cmd, &ret);
     *module = ret.module;
 	return ret.res;
 }
@@ -679,9 +640,9 @@ EXPORT_SYMBOL(hipModuleLoad);
 hipError_t HIPAPI hipStreamCreate(hipStream_t *phStream, unsigned int Flags) {
     struct lake_cmd_ret ret;
 	struct lake_cmd_hipStreamCreate cmd = {
-        .API_ID = LAKE_API_hipStreamCreate, .Flags = Flags
+        .Flags = Flags
     };
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_hipStreamCreate(&cmd, &ret);
     *phStream = ret.stream;
 	return ret.res;
 }
@@ -690,9 +651,9 @@ EXPORT_SYMBOL(hipStreamCreate);
 hipError_t HIPAPI hipStreamSynchronize(hipStream_t hStream) {
     struct lake_cmd_ret ret;
 	struct lake_cmd_hipStreamSynchronize cmd = {
-        .API_ID = LAKE_API_hipStreamSynchronize, .hStream = hStream
+        .hStream = hStream
     };
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_hipStreamSynchronize(&cmd, &ret);
 	return ret.res;
 }
 EXPORT_SYMBOL(hipStreamSynchronize);
@@ -700,9 +661,9 @@ EXPORT_SYMBOL(hipStreamSynchronize);
 hipError_t HIPAPI hipStreamDestroy (hipStream_t hStream) {
     struct lake_cmd_ret ret;
 	struct lake_cmd_hipStreamDestroy cmd = {
-        .API_ID = LAKE_API_hipStreamDestroy, .hStream = hStream
+        .hStream = hStream
     };
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_hipStreamDestroy(&cmd, &ret);
 	return ret.res;
 }
 EXPORT_SYMBOL(hipStreamDestroy);
@@ -710,9 +671,9 @@ EXPORT_SYMBOL(hipStreamDestroy);
 hipError_t HIPAPI hipCtxDestroy(hipCtx_t pctx) {
     struct lake_cmd_ret ret;
 	struct lake_cmd_hipCtxDestroy cmd = {
-        .API_ID = LAKE_API_hipCtxDestroy, .ctx = pctx,
+        .ctx = pctx,
     };
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_SYNC, &ret);
+    lake_send_hipCtxDestroy(&cmd, &ret);
 	return ret.res;
 }
 EXPORT_SYMBOL(hipCtxDestroy);
@@ -720,7 +681,7 @@ EXPORT_SYMBOL(hipCtxDestroy);
 hipError_t HIPAPI hipMemcpyDtoHAsync(void *dstHost, hipDeviceptr_t srcDevice, size_t ByteCount, hipStream_t hStream) {
     struct lake_cmd_ret ret;
 	struct lake_cmd_hipMemcpyDtoHAsync cmd = {
-        .API_ID = LAKE_API_hipMemcpyDtoHAsync, .dstHost = dstHost, .srcDevice = srcDevice,
+        .dstHost = dstHost, .srcDevice = srcDevice,
         .ByteCount = ByteCount, .hStream = hStream
     };
     
@@ -731,7 +692,7 @@ hipError_t HIPAPI hipMemcpyDtoHAsync(void *dstHost, hipDeviceptr_t srcDevice, si
     }
     cmd.dstHost = (void*)offset;
 
-    lake_send_cmd((void*)&cmd, sizeof(cmd), CMD_ASYNC, &ret);
+    lake_send_hipMemcpyDtoHAsync(&cmd, &ret);
 	return ret.res;
 }
 EXPORT_SYMBOL(hipMemcpyDtoHAsync);
\ No newline at end of file
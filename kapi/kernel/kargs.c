@@ -53,21 +53,32 @@ void init_kargs_kv(void) {
     }
 }
 
+/*
+ * Launches look up the metadata of their function on every call, so the
+ * lookup is lock-free (rhashtable_lookup_fast runs under RCU). Entries are
+ * only added by GetFunction and never removed before destroy_kargs_kv, so
+ * the returned pointer stays valid without holding anything. The mutex
+ * only serializes inserts.
+ */
 struct kernel_args_metadata* get_kargs(const void* ptr) {
     struct metadata_object *object;
     struct kernel_args_metadata *metadata;
 
+    object = rhashtable_lookup_fast(&kargs_metadata_map, &ptr, metadata_object_params);
+    if (likely(object))
+        return object->metadata;
+
     mutex_lock(&kargs_metadata_map_mutex);
 
+    // someone may have inserted it while we waited for the mutex
     object = rhashtable_lookup_fast(&kargs_metadata_map, &ptr, metadata_object_params);
     if (object == NULL) {
         // Use kmalloc instead of vmalloc (small structure, no need for virtual memory mapping)
-        metadata = (struct kernel_args_metadata *) kmalloc(sizeof(struct kernel_args_metadata), GFP_KERNEL);
+        metadata = (struct kernel_args_metadata *) kzalloc(sizeof(struct kernel_args_metadata), GFP_KERNEL);
         if (unlikely(!metadata)) {
             mutex_unlock(&kargs_metadata_map_mutex);
             return NULL;
         }
-        memset(metadata, 0, sizeof(struct kernel_args_metadata));
         object = (struct metadata_object *) kmalloc(sizeof(struct metadata_object), GFP_KERNEL);
         if (unlikely(!object)) {
             kfree(metadata);
@@ -76,7 +87,12 @@ struct kernel_args_metadata* get_kargs(const void* ptr) {
         }
         object->key = ptr;
         object->metadata = metadata;
-        rhashtable_insert_fast(&kargs_metadata_map, &object->linkage, metadata_object_params);
+        if (unlikely(rhashtable_insert_fast(&kargs_metadata_map, &object->linkage, metadata_object_params))) {
+            kfree(metadata);
+            kfree(object);
+            mutex_unlock(&kargs_metadata_map_mutex);
+            return NULL;
+        }
     }
 
     mutex_unlock(&kargs_metadata_map_mutex);
@@ -30,11 +30,102 @@
 #define __KAPI_LAKE_H__
 
 #include <linux/ctype.h>
+#include <linux/completion.h>
+#include <linux/jump_label.h>
+#include <linux/ktime.h>
 #include "cuda.h"
 #include "commands.h"
+#include "lake_future.h"
 
 int lake_init_socket(void);
 void lake_destroy_socket(void);
 void lake_send_cmd(void *buf, size_t size, char sync, struct lake_cmd_ret* ret);
+struct lake_future *lake_send_cmd_future(void *buf, size_t size);
+int lake_netlink_send(int type, u32 seq, void *buf, size_t size);
+int lake_complete_cmd(u32 seq, struct lake_cmd_ret *ret);
+void lake_worker_lost(void);
+
+//in-flight command table (inflight.c)
+struct lake_inflight {
+    u32 id;     // seq sent with the command, generation << bits | slot
+    u32 gen;
+    char sync;
+    bool posted;    // sent or being sent, a lost worker fails it
+    u32 api;        // LAKE_API_* of the command, for tracing
+    u64 t_submit;   // tracing stamps, t_submit is 0 if the command is not traced
+    u64 t_send;
+    u64 sync_snap;      // synchronizes: submissions they cover, see sync.c
+    void *sync_stream;
+    struct completion cmd_done;
+    struct lake_cmd_ret ret;
+    // CMD_FUTURE only
+    atomic_t fstate;
+    lake_future_fn fn;
+    void *fn_arg;
+};
+
+int lake_inflight_init(void);
+void lake_inflight_fini(void);
+struct lake_inflight *lake_inflight_get(char sync);
+void lake_inflight_put(struct lake_inflight *cmd);
+struct lake_inflight *lake_inflight_lookup(u32 id);
+struct lake_inflight *lake_inflight_claim(u32 id);
+void lake_inflight_fail_all(struct lake_cmd_ret *ret);
+
+//futures (future.c)
+void lake_future_complete(struct lake_inflight *cmd);
+
+//synchronize elision (sync.c)
+bool lake_sync_skip(void *buf, u64 *snap, void **stream);
+void lake_sync_forwarded(void *buf);
+void lake_sync_completed(u32 api, void *stream, u64 snap);
+
+//hot path tracing (trace.c)
+DECLARE_STATIC_KEY_FALSE(lake_trace_on);
+int lake_trace_init(void);
+void lake_trace_fini(void);
+void lake_trace_record(struct lake_inflight *cmd, struct lake_cmd_ret *ret);
+
+static inline u64 lake_trace_now(void)
+{
+    return static_branch_unlikely(&lake_trace_on) ? ktime_get_ns() : 0;
+}
+
+//staging copy engine (copy.c)
+int lake_copy_init(void);
+void lake_copy_fini(void);
+
+//device memory pool (devpool.c)
+extern int lake_async_free;
+
+/*
+ * lake_send_<api>(cmd, ret): stamps the API id and sends a fixed size
+ * command the way its policy in LAKE_APIS says. VAR commands have none.
+ */
+#define LAKE_SEND_WAIT_SYNC  CMD_SYNC
+#define LAKE_SEND_WAIT_ASYNC CMD_ASYNC
+#define LAKE_SEND_WAIT_FREE  (lake_async_free && cmd->dptr ? CMD_ASYNC : CMD_SYNC)
+#define LAKE_SENDER_FIXED(fn, id, cmd_t, wait) \
+    static inline void fn(struct cmd_t *cmd, struct lake_cmd_ret *ret) \
+    { \
+        cmd->API_ID = id; \
+        lake_send_cmd(cmd, sizeof(*cmd), wait, ret); \
+    }
+#define LAKE_SENDER_SYNC(fn, id, cmd_t)  LAKE_SENDER_FIXED(fn, id, cmd_t, LAKE_SEND_WAIT_SYNC)
+#define LAKE_SENDER_ASYNC(fn, id, cmd_t) LAKE_SENDER_FIXED(fn, id, cmd_t, LAKE_SEND_WAIT_ASYNC)
+#define LAKE_SENDER_FREE(fn, id, cmd_t)  LAKE_SENDER_FIXED(fn, id, cmd_t, LAKE_SEND_WAIT_FREE)
+#define LAKE_SENDER_VAR(fn, id, cmd_t)
+#define LAKE_SENDER(name, policy, order, fields) \
+    LAKE_SENDER_##policy(lake_send_##name, LAKE_API_##name, lake_cmd_##name)
+LAKE_APIS(LAKE_SENDER)
+
+//shared memory ring transport (ring.c)
+int lake_ring_transport_init(void);
+void lake_ring_transport_fini(void);
+bool lake_ring_enabled(void);
+int lake_ring_send(u32 seq, void *buf, size_t size);
+void lake_ring_worker_connected(void);
+void lake_ring_worker_detached(void);
+void lake_ring_kick(void);
 
 #endif
\ No newline at end of file
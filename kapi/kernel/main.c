@@ -42,6 +42,33 @@ static int __init lake_kapi_init(void)
         return -1;
 	}
 
+    err = lake_ring_transport_init();
+    if (err < 0) {
+        printk(KERN_ERR "Err in ring_transport_init %d\n", err);
+        destroy_kargs_kv();
+        lake_destroy_socket();
+        return -1;
+    }
+
+    err = lake_trace_init();
+    if (err < 0) {
+        printk(KERN_ERR "Err in trace_init %d\n", err);
+        lake_ring_transport_fini();
+        destroy_kargs_kv();
+        lake_destroy_socket();
+        return -1;
+    }
+
+    err = lake_copy_init();
+    if (err < 0) {
+        printk(KERN_ERR "Err in copy_init %d\n", err);
+        lake_trace_fini();
+        lake_ring_transport_fini();
+        destroy_kargs_kv();
+        lake_destroy_socket();
+        return -1;
+    }
+
     pr_info("[lake] Registered CUDA kapi\n");
     
     return 0;
@@ -49,8 +76,11 @@ static int __init lake_kapi_init(void)
 
 static void __exit lake_kapi_exit(void)
 {
+    lake_ring_transport_fini();
     destroy_kargs_kv();
 	lake_destroy_socket();
+    lake_trace_fini();
+    lake_copy_fini();
 }
 
 MODULE_AUTHOR("Henrique Fingler");
@@ -0,0 +1,125 @@
+/*
+ * Part of LAKE: Towards a Machine Learning-Assisted Kernel with LAKE
+ *
+ * Original work:
+ *   Copyright (C) 2022–2024 Henrique Fingler
+ *   Copyright (C) 2022–2024 Isha Tarte
+ *
+ * Modifications and adaptations for LAIKA:
+ *   Copyright (C) 2024-2025 Haoming Zhuo
+ *
+ * This file is adapted from the original LAKE kernel module.
+ * Major changes include:
+ *   - Integration with LAIKA framework
+ *   - Hybrid execution support
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <linux/types.h>
+#include <linux/module.h>
+#include <linux/slab.h>
+#include <linux/string.h>
+#include "commands.h"
+#include "lake_kapi.h"
+#include "lake_shm.h"
+#include "lake_ring.h"
+#include "lake_module.h"
+#include "kargs.h"
+
+/*
+ *   Batched function lookups, see lake_module.h.
+ *   Like a batch, every command must fit in one ring slot, so long lists
+ *   of names are split over several commands.
+ */
+
+#define LAKE_MODULE_CMD_SIZE (LAKE_RING_CMD_SLOT_SIZE - sizeof(struct lake_ring_slot))
+
+static CUresult lake_get_functions(u32 api_id, void **funcs, CUmodule hmod,
+        const char * const *names, unsigned int n)
+{
+    // the hip command shares the layout of the cu one
+    struct lake_cmd_cuModuleGetFunctions *cmd;
+    struct lake_cmd_ret ret;
+    CUresult res = CUDA_SUCCESS;
+    unsigned int i, k, done = 0;
+    void **out;
+    size_t len;
+
+    cmd = kmalloc(LAKE_MODULE_CMD_SIZE, GFP_KERNEL);
+    out = kava_alloc(LAKE_MODULE_MAX_FUNCS * sizeof(void *));
+    if (!cmd || !out) {
+        pr_err("lake_get_functions: out of memory\n");
+        res = CUDA_ERROR_OUT_OF_MEMORY;
+        goto out;
+    }
+
+    while (done < n) {
+        cmd->API_ID = api_id;
+        cmd->n_funcs = 0;
+        cmd->size = sizeof(*cmd);
+        cmd->hmod = hmod;
+        cmd->funcs = (void *) kava_shm_offset(out);
+        for (i = done; i < n && cmd->n_funcs < LAKE_MODULE_MAX_FUNCS; i++) {
+            len = strlen(names[i]) + 1;
+            if (cmd->size + len > LAKE_MODULE_CMD_SIZE)
+                break;
+            memcpy((char *) cmd + cmd->size, names[i], len);
+            cmd->size += len;
+            cmd->n_funcs++;
+        }
+        if (cmd->n_funcs == 0) {
+            pr_err("lake_get_functions: kernel name too long: %s\n", names[done]);
+            res = CUDA_ERROR_INVALID_VALUE;
+            goto out;
+        }
+
+        // left NULL for names lake_uspace could not resolve, or if it never got the command
+        memset(out, 0, cmd->n_funcs * sizeof(void *));
+        lake_send_cmd((void *) cmd, cmd->size, CMD_SYNC, &ret);
+        if (ret.res != CUDA_SUCCESS && res == CUDA_SUCCESS)
+            res = ret.res;
+        for (k = 0; k < cmd->n_funcs; k++) {
+            funcs[done + k] = out[k];
+            if (!out[k])
+                continue;
+            //parse and store kargs
+            kava_parse_function_args(names[done + k], get_kargs(out[k]));
+        }
+        done += cmd->n_funcs;
+    }
+
+out:
+    if (res != CUDA_SUCCESS) {
+        for (i = done; i < n; i++)
+            funcs[i] = NULL;
+    }
+    if (out)
+        kava_free(out);
+    kfree(cmd);
+    return res;
+}
+
+CUresult lake_cuModuleGetFunctions(CUfunction *hfuncs, CUmodule hmod,
+        const char * const *names, unsigned int n)
+{
+    return lake_get_functions(LAKE_API_cuModuleGetFunctions, (void **) hfuncs, hmod, names, n);
+}
+EXPORT_SYMBOL(lake_cuModuleGetFunctions);
+
+hipError_t lake_hipModuleGetFunctions(hipFunction_t *funcs, hipModule_t hmod,
+        const char * const *names, unsigned int n)
+{
+    return lake_get_functions(LAKE_API_hipModuleGetFunctions, (void **) funcs, hmod, names, n);
+}
+EXPORT_SYMBOL(lake_hipModuleGetFunctions);
@@ -28,96 +28,124 @@
  */
 #include <linux/netlink.h>
 #include <linux/module.h>
+#include <linux/moduleparam.h>
 #include <linux/ctype.h>
 #include <linux/mm.h>
 #include <net/sock.h>
-#include <linux/xarray.h>
 #include <linux/completion.h>
-#include <linux/slab.h>
 #include <linux/delay.h>
 #include <linux/ktime.h>
 #include <linux/atomic.h>
+#include <linux/notifier.h>
+#include <linux/workqueue.h>
 #include "netlink.h"
 #include "commands.h"
+#include "lake_kapi.h"
 
 static struct sock *sk = NULL;
-//DEFINE_XARRAY_ALLOC(cmds_xa); 
-DEFINE_XARRAY(cmds_xa); 
-static struct kmem_cache *cmd_cache;
 static pid_t worker_pid = -1;
-static int max_counter = (1<<10);
-#define MAX_COUNTER_MASK ((1<<10) - 1)  // Bit mask for fast modulo operation
-
-// Use atomic operations instead of locks to improve concurrent performance
-static atomic_t id_counter = ATOMIC_INIT(0);
 
 // Use atomic operations to protect last_cu_err, avoid data races
 static atomic_t last_cu_err = ATOMIC_INIT(0);
 
-
-struct cmd_data {
-    struct completion cmd_done;
-    struct lake_cmd_ret ret;
-    char sync;
-}; //__attribute__ ((aligned (8)));
-
-
-// ret is only filled in case sync is CMD_SYNC
-void lake_send_cmd(void *buf, size_t size, char sync, struct lake_cmd_ret* ret)
+int lake_netlink_send(int type, u32 seq, void *buf, size_t size)
 {
     int err;
     struct sk_buff *skb_out;
     struct nlmsghdr *nlh;
-    struct cmd_data *cmd;
-    u32 xa_idx;
-    CUresult cu_err;
 
-    // Remove unnecessary locks, kmem_cache_alloc is thread-safe
-    cmd = (struct cmd_data*) kmem_cache_alloc(cmd_cache, GFP_KERNEL);
-    if (unlikely(!cmd)) {
-        pr_warn("Error allocating from cache\n");
-        ret->res = CUDA_ERROR_OUT_OF_MEMORY;
-        return;
+    skb_out = nlmsg_new(size, 0);
+    if (unlikely(!skb_out)) {
+        pr_err("Failed to allocate netlink skb\n");
+        return -ENOMEM;
     }
 
-    //init completion so we can wait on it
-    init_completion(&cmd->cmd_done);
-    cmd->sync = sync;
+    nlh = nlmsg_put(skb_out, 0, seq, type, size, 0);
+    NETLINK_CB(skb_out).dst_group = 0;
+    if (size)
+        memcpy(nlmsg_data(nlh), buf, size);
 
-    // Use bitwise operations instead of modulo (max_counter is a power of 2), improve performance
-    xa_idx = atomic_fetch_add(1, &id_counter) & MAX_COUNTER_MASK;
+    // netlink_unicast consumes the skb, even on error
+    err = netlink_unicast(sk, skb_out, worker_pid, 0);
+    if (unlikely(err < 0))
+        pr_err("Failed to send netlink skb to API server, error=%d\n", err);
+    return err;
+}
 
-    // Store to xarray first, can clean up immediately if it fails
-    err = xa_err(xa_store(&cmds_xa, xa_idx, (void*)cmd, GFP_KERNEL));
-    if (unlikely(err)) {
-        pr_warn("Error storing to xarray: %d\n", err);
-        kmem_cache_free(cmd_cache, cmd);
-        ret->res = CUDA_ERROR_OPERATING_SYSTEM;
-        return;
+// takes an in-flight slot for the command, may sleep
+static struct lake_inflight *lake_get_cmd(void *buf, char sync)
+{
+    u64 submit = lake_trace_now();
+    struct lake_inflight *cmd = lake_inflight_get(sync);
+
+    cmd->api = *(u32 *) buf;
+    cmd->t_submit = submit;
+    return cmd;
+}
+
+/*
+ * Sends over the ring if it is up, netlink otherwise. Once posted the
+ * command may be completed under us, by its reply or by a lost worker,
+ * so it is sent with the id the caller read before.
+ */
+static int lake_post_cmd(struct lake_inflight *cmd, u32 id, void *buf, size_t size)
+{
+    int err;
+
+    if (unlikely(cmd->t_submit))
+        cmd->t_send = ktime_get_ns();
+
+    // pairs with the barrier in lake_ring_worker_detached: either the
+    // command is failed with the others or we see the ring is gone
+    smp_store_mb(cmd->posted, true);
+
+    if (lake_ring_enabled()) {
+        err = lake_ring_send(id, buf, size);
+        if (likely(err == 0)) {
+            lake_sync_forwarded(buf);
+            return 0;
+        }
     }
 
-    //create netlink cmd
-    skb_out = nlmsg_new(size, 0);
-    if (unlikely(!skb_out)) {
-        pr_err("Failed to allocate netlink skb\n");
-        xa_erase(&cmds_xa, xa_idx);
-        kmem_cache_free(cmd_cache, cmd);
-        ret->res = CUDA_ERROR_OUT_OF_MEMORY;
+    err = lake_netlink_send(MSG_LAKE_KAPI_REQ, id, buf, size);
+    if (err < 0)
+        return err;
+    lake_sync_forwarded(buf);
+    return 0;
+}
+
+// ret is only filled in case sync is CMD_SYNC
+void lake_send_cmd(void *buf, size_t size, char sync, struct lake_cmd_ret* ret)
+{
+    int err;
+    struct lake_inflight *cmd;
+    CUresult cu_err;
+    u64 snap = 0;
+    void *stream = NULL;
+    u32 id;
+
+    // a synchronize with nothing to wait for completes here, reporting async errors like async calls do
+    if (sync == CMD_SYNC && lake_sync_skip(buf, &snap, &stream)) {
+        ret->res = (CUresult)atomic_read(&last_cu_err);
         return;
     }
-    
-    nlh = nlmsg_put(skb_out, 0, xa_idx, MSG_LAKE_KAPI_REQ, size, 0);
-    NETLINK_CB(skb_out).dst_group = 0;
-    memcpy(nlmsg_data(nlh), buf, size);
 
-    err = netlink_unicast(sk, skb_out, worker_pid, 0);
+    // preallocated slot, waits if the table is full instead of reusing a live id
+    cmd = lake_get_cmd(buf, sync);
+    cmd->sync_snap = snap;
+    cmd->sync_stream = stream;
+    id = cmd->id;
+
+    err = lake_post_cmd(cmd, id, buf, size);
     if (unlikely(err < 0)) {
-        pr_err("Failed to send netlink skb to API server, error=%d\n", err);
-        nlmsg_free(skb_out);
-        xa_erase(&cmds_xa, xa_idx);
-        kmem_cache_free(cmd_cache, cmd);
-        ret->res = CUDA_ERROR_OPERATING_SYSTEM;
-        return;
+        ret->res = err == -ENOMEM ? CUDA_ERROR_OUT_OF_MEMORY : CUDA_ERROR_OPERATING_SYSTEM;
+        if (lake_inflight_claim(id)) {
+            lake_inflight_put(cmd);
+            return;
+        }
+        // a lost worker failed it already, a sync caller still owns the slot
+        if (sync != CMD_SYNC)
+            return;
     }
 
     // sync if requested
@@ -129,8 +157,7 @@ void lake_send_cmd(void *buf, size_t size, char sync, struct lake_cmd_ret* ret)
         *ret = cmd->ret;
         
         // if we sync, its like the cmd never existed, so clear every trace
-        kmem_cache_free(cmd_cache, cmd);
-        xa_erase(&cmds_xa, xa_idx);
+        lake_inflight_put(cmd);
         
         // For sync commands, ret->res has been copied from cmd->ret, no need to check last_cu_err
         return;
@@ -144,31 +171,68 @@ void lake_send_cmd(void *buf, size_t size, char sync, struct lake_cmd_ret* ret)
         ret->res = cu_err;
 }
 
-static void netlink_recv_msg(struct sk_buff *skb)
+// a failed send still returns a future, already completed with the error,
+// and so does an elided synchronize, completed with the async error
+struct lake_future *lake_send_cmd_future(void *buf, size_t size)
 {
-    struct nlmsghdr *nlh = (struct nlmsghdr*) skb->data;
-    //struct lake_cmd_ret *ret = (struct lake_cmd_ret*) nlmsg_data(nlh);
-    void *ret = NLMSG_DATA(nlh);
-    struct cmd_data *cmd;
-    u32 xa_idx = nlh->nlmsg_seq;
-    CUresult cu_err;
+    int err;
+    struct lake_inflight *cmd;
+    struct lake_cmd_ret ret;
+    u64 snap;
+    void *stream;
+    u32 id;
 
-    if (unlikely(worker_pid == -1)) {
-        worker_pid = nlh->nlmsg_pid;
-        printk(KERN_INFO "Setting worker PID to %d\n", worker_pid);
-        return;
+    if (lake_sync_skip(buf, &snap, &stream)) {
+        cmd = lake_get_cmd(buf, CMD_FUTURE);
+        cmd->sync_snap = 0;
+        cmd->t_submit = 0;
+        memset(&ret, 0, sizeof(ret));
+        ret.res = (CUresult)atomic_read(&last_cu_err);
+        cmd->ret = ret;
+        lake_future_complete(cmd);
+        return (struct lake_future *) cmd;
     }
 
-    // xa_load internally handles concurrency, no need for additional locks
-    cmd = (struct cmd_data*) xa_load(&cmds_xa, xa_idx);
+    cmd = lake_get_cmd(buf, CMD_FUTURE);
+    cmd->sync_snap = snap;
+    cmd->sync_stream = stream;
+    id = cmd->id;
+
+    err = lake_post_cmd(cmd, id, buf, size);
+    // a lost worker may have failed it already
+    if (unlikely(err < 0) && lake_inflight_claim(id)) {
+        memset(&ret, 0, sizeof(ret));
+        ret.res = err == -ENOMEM ? CUDA_ERROR_OUT_OF_MEMORY : CUDA_ERROR_OPERATING_SYSTEM;
+        cmd->ret = ret;
+        lake_future_complete(cmd);
+    }
+    return (struct lake_future *) cmd;
+}
+
+// returns -ENOENT if the command is not in flight (anymore)
+int lake_complete_cmd(u32 id, struct lake_cmd_ret *ret)
+{
+    struct lake_inflight *cmd;
+    CUresult cu_err;
+
+    // O(1), a stale or duplicated reply does not match the slot's generation
+    cmd = lake_inflight_claim(id);
     if (unlikely(!cmd)) {
-        pr_warn("Error (0) looking up cmd %u at xarray\n", xa_idx);
-        xa_erase(&cmds_xa, xa_idx);
-        return;
+        pr_warn("Dropping reply for cmd %x, it is not in flight\n", id);
+        return -ENOENT;
     }
     
     // Direct assignment instead of memcpy (small structure)
-    cmd->ret = *(struct lake_cmd_ret*)ret;
+    cmd->ret = *ret;
+    if (unlikely(cmd->t_submit))
+        lake_trace_record(cmd, ret);
+    if (cmd->sync_snap && ret->res == CUDA_SUCCESS)
+        lake_sync_completed(cmd->api, cmd->sync_stream, cmd->sync_snap);
+
+    if (cmd->sync == CMD_FUTURE) {
+        lake_future_complete(cmd);
+        return 0;
+    }
 
     //if the cmd is async, no one will read this cmd, so clear
     if (cmd->sync == CMD_ASYNC) {
@@ -177,19 +241,102 @@ static void netlink_recv_msg(struct sk_buff *skb)
             // Use atomic operations to update last_cu_err
             atomic_set(&last_cu_err, cu_err);
         }
-        //erase from xarray
-        xa_erase(&cmds_xa, xa_idx);
-        //free from cache
-        kmem_cache_free(cmd_cache, cmd);
+        lake_inflight_put(cmd);
     }
     else {
         //if there's anyone waiting, free them
         //if the cmd is sync, whoever we woke up will clean up
         complete(&cmd->cmd_done);
     }
+    return 0;
 }
 
-static void null_constructor(void *argument) {
+/*
+ * lake_uspace closed its socket, or a doorbell could not reach it: nothing
+ * in flight will get a reply. The commands are failed from a work item,
+ * their completion callbacks must not run in whatever context noticed.
+ */
+static void worker_lost_work(struct work_struct *work)
+{
+    struct lake_cmd_ret ret;
+
+    memset(&ret, 0, sizeof(ret));
+    ret.res = CUDA_ERROR_OPERATING_SYSTEM;
+    lake_inflight_fail_all(&ret);
+}
+static DECLARE_WORK(worker_lost, worker_lost_work);
+
+void lake_worker_lost(void)
+{
+    lake_ring_worker_detached();
+    schedule_work(&worker_lost);
+}
+
+static int netlink_release_event(struct notifier_block *nb, unsigned long event, void *ptr)
+{
+    struct netlink_notify *n = ptr;
+
+    if (event == NETLINK_URELEASE && n->protocol == NETLINK_LAKE_PROT &&
+            (pid_t)n->portid == READ_ONCE(worker_pid)) {
+        pr_info("lake_uspace (PID %d) closed its socket\n", worker_pid);
+        lake_worker_lost();
+    }
+    return NOTIFY_DONE;
+}
+
+static struct notifier_block netlink_release_nb = {
+    .notifier_call = netlink_release_event,
+};
+
+/*
+ * lake_uspace coalesces the replies of a receive drain into one sendmsg,
+ * so an skb carries one or more messages. Counted to see how well that
+ * works: replies per skb is replies per syscall on the other side.
+ */
+static atomic64_t nl_rx_skbs = ATOMIC64_INIT(0);
+static atomic64_t nl_rx_replies = ATOMIC64_INIT(0);
+
+static int netlink_stats_get(char *buf, const struct kernel_param *kp)
+{
+    u64 skbs = atomic64_read(&nl_rx_skbs), replies = atomic64_read(&nl_rx_replies);
+
+    return sprintf(buf, "skbs %llu replies %llu replies_per_skb %llu.%02llu\n", skbs, replies,
+            skbs ? replies / skbs : 0, skbs ? (replies * 100 / skbs) % 100 : 0);
+}
+
+static const struct kernel_param_ops netlink_stats_ops = {
+    .get = netlink_stats_get,
+};
+module_param_cb(netlink_stats, &netlink_stats_ops, NULL, 0444);
+MODULE_PARM_DESC(netlink_stats, "Netlink skbs received from lake_uspace and the replies they carried");
+
+static void netlink_recv_msg(struct sk_buff *skb)
+{
+    struct nlmsghdr *nlh;
+    int len = skb->len, replies = 0;
+
+    for (nlh = (struct nlmsghdr*) skb->data; nlmsg_ok(nlh, len); nlh = nlmsg_next(nlh, &len)) {
+        if (unlikely(worker_pid == -1)) {
+            worker_pid = nlh->nlmsg_pid;
+            printk(KERN_INFO "Setting worker PID to %d\n", worker_pid);
+            lake_ring_worker_connected();
+            continue;
+        }
+
+        if (nlh->nlmsg_type == MSG_LAKE_KAPI_DOORBELL) {
+            lake_ring_kick();
+            continue;
+        }
+
+        if (unlikely(nlmsg_len(nlh) < (int) sizeof(struct lake_cmd_ret))) {
+            pr_warn("Dropping short reply for cmd %x\n", nlh->nlmsg_seq);
+            continue;
+        }
+        lake_complete_cmd(nlh->nlmsg_seq, (struct lake_cmd_ret*) nlmsg_data(nlh));
+        replies++;
+    }
+    atomic64_inc(&nl_rx_skbs);
+    atomic64_add(replies, &nl_rx_replies);
 }
 
 int lake_init_socket(void) {
@@ -203,27 +350,18 @@ int lake_init_socket(void) {
         return -ENOMEM;
     }
 
-    //init slab cache (xarray requires at least 4-alignment)
-    cmd_cache = kmem_cache_create("lake_cmd_cache", sizeof(struct cmd_data), 8, 0, null_constructor);
-    if(IS_ERR(cmd_cache)) {
-        pr_warn("Error creating cache: %ld\n", PTR_ERR(cmd_cache));
+    if (lake_inflight_init()) {
+        netlink_kernel_release(sk);
         return -ENOMEM;
     }
+    netlink_register_notifier(&netlink_release_nb);
     return 0;
 }
 
 void lake_destroy_socket(void) {
-    unsigned long idx = 0;
-    void* entry;
     //TODO: set a halt flag
-
-    //free up all cache entries so the kernel doesnt yell at us
-    xa_for_each(&cmds_xa, idx, entry) {
-        if (entry)
-            kmem_cache_free(cmd_cache, entry);
-    }
-
-    //kmem_cache_destroy(cmd_cache);
-    xa_destroy(&cmds_xa);
+    netlink_unregister_notifier(&netlink_release_nb);
+    flush_work(&worker_lost);
+    lake_inflight_fini();
     netlink_kernel_release(sk);
 }
\ No newline at end of file
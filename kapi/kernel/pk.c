@@ -0,0 +1,169 @@
+/*
+ * Part of LAKE: Towards a Machine Learning-Assisted Kernel with LAKE
+ *
+ * Original work:
+ *   Copyright (C) 2022–2024 Henrique Fingler
+ *   Copyright (C) 2022–2024 Isha Tarte
+ *
+ * Modifications and adaptations for LAIKA:
+ *   Copyright (C) 2024-2025 Haoming Zhuo
+ *
+ * This file is adapted from the original LAKE kernel module.
+ * Major changes include:
+ *   - Integration with LAIKA framework
+ *   - Hybrid execution support
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <linux/module.h>
+#include <linux/slab.h>
+#include "lake_kapi.h"
+#include "lake_shm.h"
+#include "lake_pk.h"
+
+/*
+ *   Persistent kernel service, see lake_pk.h.
+ */
+
+// task is polled on the hot path, quit and n only now and then
+struct lake_pk_shm {
+    int32_t task __attribute__((aligned(LAKE_RING_CACHELINE)));
+    int32_t quit __attribute__((aligned(LAKE_RING_CACHELINE)));
+    int32_t n;
+};
+
+struct lake_pk {
+    struct lake_pk_mailbox mb;
+    struct lake_pk_shm *shm;
+    void *d_shm;
+    hipStream_t streams[LAKE_PK_MAX_STAGES];
+    int n_stages;
+};
+
+struct lake_pk *lake_pk_create(int done)
+{
+    struct lake_pk *pk = kzalloc(sizeof(*pk), GFP_KERNEL);
+    if (!pk)
+        return NULL;
+
+    pk->shm = kava_alloc(sizeof(*pk->shm));
+    if (!pk->shm) {
+        pr_err("lake_pk: failed to allocate mailbox from kava_shm\n");
+        goto out_free;
+    }
+    lake_pk_mailbox_init(&pk->mb, &pk->shm->task, &pk->shm->quit, &pk->shm->n, done);
+
+    if (hipHostRegister(pk->shm, sizeof(*pk->shm), hipHostRegisterMapped) != hipSuccess) {
+        pr_err("lake_pk: failed to register mailbox\n");
+        goto out_shm;
+    }
+    if (hipHostGetDevicePointer(&pk->d_shm, pk->shm, 0) != hipSuccess) {
+        pr_err("lake_pk: failed to get device pointer of mailbox\n");
+        hipHostUnregister(pk->shm);
+        goto out_shm;
+    }
+    return pk;
+
+out_shm:
+    kava_free(pk->shm);
+out_free:
+    kfree(pk);
+    return NULL;
+}
+EXPORT_SYMBOL(lake_pk_create);
+
+void lake_pk_device_ptrs(struct lake_pk *pk, void **task, void **quit, void **n)
+{
+    char *base = (char *) pk->d_shm;
+
+    if (task)
+        *task = base + offsetof(struct lake_pk_shm, task);
+    if (quit)
+        *quit = base + offsetof(struct lake_pk_shm, quit);
+    if (n)
+        *n = base + offsetof(struct lake_pk_shm, n);
+}
+EXPORT_SYMBOL(lake_pk_device_ptrs);
+
+// every stage gets its own stream, they run concurrently and hand work over through task
+hipError_t lake_pk_launch(struct lake_pk *pk, hipFunction_t f,
+        unsigned int gridDimX, unsigned int gridDimY, unsigned int gridDimZ,
+        unsigned int blockDimX, unsigned int blockDimY, unsigned int blockDimZ,
+        unsigned int sharedMemBytes, void **kernelParams)
+{
+    hipError_t err;
+    hipStream_t *stream;
+
+    if (pk->n_stages == LAKE_PK_MAX_STAGES) {
+        pr_err("lake_pk: more than %d stages\n", LAKE_PK_MAX_STAGES);
+        return hipErrorInvalidValue;
+    }
+    stream = &pk->streams[pk->n_stages];
+    if (!*stream) {
+        err = hipStreamCreate(stream, 0);
+        if (err != hipSuccess)
+            return err;
+    }
+
+    err = hipModuleLaunchKernel(f, gridDimX, gridDimY, gridDimZ,
+            blockDimX, blockDimY, blockDimZ, sharedMemBytes, *stream, kernelParams, NULL);
+    if (err == hipSuccess)
+        pk->n_stages++;
+    return err;
+}
+EXPORT_SYMBOL(lake_pk_launch);
+
+void lake_pk_submit(struct lake_pk *pk, int n)
+{
+    lake_pk_post(&pk->mb, n);
+}
+EXPORT_SYMBOL(lake_pk_submit);
+
+int lake_pk_wait_done(struct lake_pk *pk, u64 timeout_ns)
+{
+    return lake_pk_wait(&pk->mb, timeout_ns);
+}
+EXPORT_SYMBOL(lake_pk_wait_done);
+
+// returns once every stage exited; new stages can be launched afterwards
+void lake_pk_stop(struct lake_pk *pk)
+{
+    int i;
+
+    if (!pk->n_stages)
+        return;
+    lake_pk_quit(&pk->mb);
+    for (i = 0; i < pk->n_stages; i++)
+        hipStreamSynchronize(pk->streams[i]);
+    pk->n_stages = 0;
+    lake_pk_mailbox_init(&pk->mb, &pk->shm->task, &pk->shm->quit, &pk->shm->n, pk->mb.done);
+}
+EXPORT_SYMBOL(lake_pk_stop);
+
+void lake_pk_destroy(struct lake_pk *pk)
+{
+    int i;
+
+    if (!pk)
+        return;
+    lake_pk_stop(pk);
+    for (i = 0; i < LAKE_PK_MAX_STAGES; i++) {
+        if (pk->streams[i])
+            hipStreamDestroy(pk->streams[i]);
+    }
+    hipHostUnregister(pk->shm);
+    kava_free(pk->shm);
+    kfree(pk);
+}
+EXPORT_SYMBOL(lake_pk_destroy);
@@ -0,0 +1,229 @@
+/*
+ * Part of LAKE: Towards a Machine Learning-Assisted Kernel with LAKE
+ *
+ * Original work:
+ *   Copyright (C) 2022–2024 Henrique Fingler
+ *   Copyright (C) 2022–2024 Isha Tarte
+ *
+ * Modifications and adaptations for LAIKA:
+ *   Copyright (C) 2024-2025 Haoming Zhuo
+ *
+ * This file is adapted from the original LAKE kernel module.
+ * Major changes include:
+ *   - Integration with LAIKA framework
+ *   - Hybrid execution support
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <linux/module.h>
+#include <linux/kthread.h>
+#include <linux/sched.h>
+#include <linux/spinlock.h>
+#include <linux/wait.h>
+#include <linux/ktime.h>
+#include <linux/mm.h>
+#include "lake_kapi.h"
+#include "lake_shm.h"
+#include "lake_ring.h"
+#include "netlink.h"
+
+static int ring_transport = 0;
+module_param(ring_transport, int, 0444);
+MODULE_PARM_DESC(ring_transport, "Exchange commands with lake_uspace through shared memory rings instead of netlink messages, default 0");
+
+static int ring_spin_us = 50;
+module_param(ring_spin_us, int, 0644);
+MODULE_PARM_DESC(ring_spin_us, "Time the reply poller spins on an empty ring before sleeping, default 50 us");
+
+static struct lake_ring *cmd_ring;
+static struct lake_ring *ret_ring;
+// kernel threads are the producers of the cmd ring, serialize them
+static DEFINE_SPINLOCK(cmd_ring_lock);
+static struct task_struct *rx_thread;
+static DECLARE_WAIT_QUEUE_HEAD(rx_wq);
+static bool worker_attached = false;
+
+bool lake_ring_enabled(void)
+{
+    return ring_transport && READ_ONCE(worker_attached);
+}
+
+// a parked worker that cannot be woken up will never drain the ring
+static void ring_doorbell(void)
+{
+    int err = lake_netlink_send(MSG_LAKE_KAPI_DOORBELL, 0, NULL, 0);
+    if (unlikely(err < 0)) {
+        pr_err("Failed to ring doorbell, error=%d, dropping the ring\n", err);
+        lake_worker_lost();
+    }
+}
+
+/*
+ * Returns -E2BIG if the command does not fit in a slot and -EPIPE if the
+ * worker went away while the ring was full, the caller then falls back
+ * to netlink.
+ */
+int lake_ring_send(u32 seq, void *buf, size_t size)
+{
+    int err;
+
+    spin_lock(&cmd_ring_lock);
+    while ((err = lake_ring_push(cmd_ring, seq, buf, size)) == -1) {
+        // full: the worker must be busy, but make sure it is not parked
+        spin_unlock(&cmd_ring_lock);
+        if (lake_ring_need_doorbell(cmd_ring))
+            ring_doorbell();
+        if (!READ_ONCE(worker_attached))
+            return -EPIPE;
+        cond_resched();
+        spin_lock(&cmd_ring_lock);
+    }
+    spin_unlock(&cmd_ring_lock);
+
+    if (unlikely(err))
+        return -E2BIG;
+
+    if (lake_ring_need_doorbell(cmd_ring))
+        ring_doorbell();
+    return 0;
+}
+
+// called from the netlink input path when lake_uspace rings our doorbell
+void lake_ring_kick(void)
+{
+    wake_up(&rx_wq);
+}
+
+// called once the worker pinged us: tell it where the rings are
+void lake_ring_worker_connected(void)
+{
+    struct lake_ring_setup setup;
+    int err;
+
+    if (!ring_transport)
+        return;
+
+    setup.cmd_ring = kava_shm_offset(cmd_ring);
+    setup.ret_ring = kava_shm_offset(ret_ring);
+    err = lake_netlink_send(MSG_LAKE_KAPI_RING_SETUP, 0, &setup, sizeof(setup));
+    if (err < 0) {
+        pr_err("Failed to send ring setup, staying on netlink (%d)\n", err);
+        return;
+    }
+    worker_attached = true;
+    pr_info("[lake] Using shared memory ring transport\n");
+}
+
+/*
+ * The worker is gone: new commands go to netlink, where they fail like they
+ * did before the ring, and the ones already posted are failed by the caller
+ * (lake_worker_lost). Pairs with the barrier in lake_post_cmd.
+ */
+void lake_ring_worker_detached(void)
+{
+    if (!ring_transport)
+        return;
+    WRITE_ONCE(worker_attached, false);
+    smp_mb();
+}
+
+static int ring_rx_thread(void *arg)
+{
+    struct lake_ring_slot *slot;
+    u64 idle_since = 0;
+
+    while (!kthread_should_stop()) {
+        slot = lake_ring_peek(ret_ring);
+        if (slot) {
+            lake_complete_cmd(slot->seq, (struct lake_cmd_ret *)slot->data);
+            lake_ring_pop(ret_ring);
+            idle_since = 0;
+            continue;
+        }
+
+        if (!idle_since)
+            idle_since = ktime_get_ns();
+        if (ktime_get_ns() - idle_since < (u64)ring_spin_us * NSEC_PER_USEC) {
+            cpu_relax();
+            cond_resched();
+            continue;
+        }
+
+        if (lake_ring_prepare_sleep(ret_ring))
+            wait_event_interruptible(rx_wq,
+                    !lake_ring_empty(ret_ring) || kthread_should_stop());
+        lake_ring_finish_sleep(ret_ring);
+        idle_since = 0;
+    }
+    return 0;
+}
+
+int lake_ring_transport_init(void)
+{
+    size_t cmd_bytes, ret_bytes;
+    int region;
+
+    // replies carry the tracing stamps, they must still fit in a slot
+    BUILD_BUG_ON(sizeof(struct lake_cmd_ret) > LAKE_RING_RET_SLOT_SIZE - sizeof(struct lake_ring_slot));
+
+    if (!ring_transport)
+        return 0;
+
+    // both sides poll the rings, keep them out of the uncached regions
+    cmd_bytes = lake_ring_bytes(LAKE_RING_CMD_SLOTS, LAKE_RING_CMD_SLOT_SIZE);
+    ret_bytes = lake_ring_bytes(LAKE_RING_RET_SLOTS, LAKE_RING_RET_SLOT_SIZE);
+    region = kava_shm_add_cached_region(PAGE_ALIGN(cmd_bytes) + PAGE_ALIGN(ret_bytes));
+    if (region < 0) {
+        pr_err("Failed to add a shared memory region for the rings: %d\n", region);
+        return region;
+    }
+    cmd_ring = kava_alloc_region(region, cmd_bytes);
+    ret_ring = kava_alloc_region(region, ret_bytes);
+    if (!cmd_ring || !ret_ring) {
+        pr_err("Failed to allocate rings from kava_shm\n");
+        goto out_free;
+    }
+    lake_ring_init(cmd_ring, LAKE_RING_CMD_SLOTS, LAKE_RING_CMD_SLOT_SIZE);
+    lake_ring_init(ret_ring, LAKE_RING_RET_SLOTS, LAKE_RING_RET_SLOT_SIZE);
+
+    rx_thread = kthread_run(ring_rx_thread, NULL, "lake_ring_rx");
+    if (IS_ERR(rx_thread)) {
+        pr_err("Failed to start ring poller: %ld\n", PTR_ERR(rx_thread));
+        rx_thread = NULL;
+        goto out_free;
+    }
+    return 0;
+
+out_free:
+    if (cmd_ring)
+        kava_free(cmd_ring);
+    if (ret_ring)
+        kava_free(ret_ring);
+    cmd_ring = ret_ring = NULL;
+    return -ENOMEM;
+}
+
+void lake_ring_transport_fini(void)
+{
+    worker_attached = false;
+    if (rx_thread) {
+        kthread_stop(rx_thread);
+        rx_thread = NULL;
+    }
+    if (cmd_ring)
+        kava_free(cmd_ring);
+    if (ret_ring)
+        kava_free(ret_ring);
+    cmd_ring = ret_ring = NULL;
+}
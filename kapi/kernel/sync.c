@@ -0,0 +1,222 @@
+/*
+ * Part of LAKE: Towards a Machine Learning-Assisted Kernel with LAKE
+ *
+ * Original work:
+ *   Copyright (C) 2022–2024 Henrique Fingler
+ *   Copyright (C) 2022–2024 Isha Tarte
+ *
+ * Modifications and adaptations for LAIKA:
+ *   Copyright (C) 2024-2025 Haoming Zhuo
+ *
+ * This file is adapted from the original LAKE kernel module.
+ * Major changes include:
+ *   - Integration with LAIKA framework
+ *   - Hybrid execution support
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <linux/module.h>
+#include <linux/moduleparam.h>
+#include <linux/atomic.h>
+#include <linux/hash.h>
+#include "commands.h"
+#include "lake_kapi.h"
+
+/*
+ *   Synchronize elision.
+ *   Every command that leaves work on the device (launches, async copies,
+ *   batches holding them) takes a number from submit_seq once it was handed
+ *   to the transport, and records it as the last submission of its stream.
+ *   A synchronize snapshots the number it will cover before it is sent;
+ *   lake_uspace runs it after everything sent before, so once it returns
+ *   successfully everything up to the snapshot is done. A device sync with
+ *   no submission past the last covered one, or a stream sync whose stream
+ *   has none, completes here without a round trip.
+ *
+ *   Numbers are taken after the send, so a command racing with a sync is
+ *   at worst not covered by it, and the next sync goes through.
+ *
+ *   lake_uspace runs everything in one context, so the device is the
+ *   context. Streams live in a small hash table; a stream that collides
+ *   with every slot it may use is not tracked and its syncs always go
+ *   through. Slots are not released on stream destroy, a reused handle just
+ *   starts from the state of the old one.
+ */
+
+static int sync_elision = 1;
+module_param(sync_elision, int, 0644);
+MODULE_PARM_DESC(sync_elision, "Complete synchronizes locally when nothing was submitted since the last one, default 1");
+
+#define SYNC_STREAM_BITS  10
+#define SYNC_STREAM_PROBE 4
+
+struct stream_state {
+    void *stream;
+    atomic64_t submitted;  // last number submitted on the stream
+    atomic64_t synced;     // covered by the last stream sync
+};
+
+static struct stream_state streams[1 << SYNC_STREAM_BITS];
+static atomic64_t submit_seq = ATOMIC64_INIT(0);
+static atomic64_t dev_synced = ATOMIC64_INIT(0);
+static atomic_long_t n_elided = ATOMIC_LONG_INIT(0);
+static atomic_long_t n_forwarded = ATOMIC_LONG_INIT(0);
+
+static int sync_stats_get(char *buf, const struct kernel_param *kp)
+{
+    return sprintf(buf, "elided %ld forwarded %ld\n",
+            atomic_long_read(&n_elided), atomic_long_read(&n_forwarded));
+}
+
+static const struct kernel_param_ops sync_stats_ops = {
+    .get = sync_stats_get,
+};
+module_param_cb(sync_stats, &sync_stats_ops, NULL, 0444);
+MODULE_PARM_DESC(sync_stats, "Synchronizes completed locally and sent to lake_uspace");
+
+static void atomic64_max(atomic64_t *v, s64 val)
+{
+    s64 old = atomic64_read(v);
+
+    while (old < val && !atomic64_try_cmpxchg(v, &old, val))
+        ;
+}
+
+// the stream's slot, claiming a free one if asked to; NULL if it is not tracked
+static struct stream_state *stream_lookup(void *stream, bool claim)
+{
+    u32 h = hash_ptr(stream, SYNC_STREAM_BITS), i;
+    struct stream_state *s;
+
+    for (i = 0; i < SYNC_STREAM_PROBE; i++) {
+        s = &streams[(h + i) & ((1 << SYNC_STREAM_BITS) - 1)];
+        if (READ_ONCE(s->stream) == stream)
+            return s;
+        if (!READ_ONCE(s->stream)) {
+            if (!claim)
+                return NULL;
+            if (!cmpxchg(&s->stream, NULL, stream) || READ_ONCE(s->stream) == stream)
+                return s;
+        }
+    }
+    return NULL;
+}
+
+// the stream a command leaves device work on; false if it leaves none
+static bool cmd_device_work(void *buf, void **stream)
+{
+    return lake_api_order(buf, stream) == LAKE_ORDER_WORK;
+}
+
+static void stream_submitted(void *stream, s64 seq)
+{
+    struct stream_state *s;
+
+    // work on the null stream is only covered by device syncs
+    if (!stream)
+        return;
+    s = stream_lookup(stream, true);
+    if (s)
+        atomic64_max(&s->submitted, seq);
+}
+
+// after buf was handed to the transport
+void lake_sync_forwarded(void *buf)
+{
+    struct lake_cmd_batch *batch;
+    struct lake_cmd_batch_entry *entry;
+    void *stream;
+    s64 seq;
+    u32 i;
+
+    if (*(u32 *) buf != LAKE_API_batch) {
+        if (cmd_device_work(buf, &stream))
+            stream_submitted(stream, atomic64_inc_return(&submit_seq));
+        return;
+    }
+
+    // one number for the whole batch, on every stream it touches
+    batch = (struct lake_cmd_batch *) buf;
+    entry = (struct lake_cmd_batch_entry *) (batch + 1);
+    seq = 0;
+    for (i = 0; i < batch->n_cmds; i++) {
+        if (cmd_device_work(entry + 1, &stream)) {
+            if (!seq)
+                seq = atomic64_inc_return(&submit_seq);
+            stream_submitted(stream, seq);
+        }
+        entry = (struct lake_cmd_batch_entry *) ((char *)(entry + 1) + ALIGN(entry->size, 8));
+    }
+}
+
+/*
+ * Before a command is sent: returns true if it is a synchronize with
+ * nothing to wait for. Otherwise, for a synchronize, *snap is what it
+ * covers (for lake_sync_completed) and *stream the stream it syncs.
+ */
+bool lake_sync_skip(void *buf, u64 *snap, void **stream)
+{
+    struct stream_state *s;
+    s64 dev;
+
+    *snap = 0;
+    switch (lake_api_order(buf, stream)) {
+    case LAKE_ORDER_SYNC:
+    case LAKE_ORDER_DEVSYNC:
+        break;
+    default:
+        *stream = NULL;
+        return false;
+    }
+
+    dev = atomic64_read(&dev_synced);
+    if (!*stream) {
+        // the null stream waits for the other streams, only the device state tells
+        *snap = atomic64_read(&submit_seq);
+        if (READ_ONCE(sync_elision) && (s64)*snap <= dev)
+            goto elide;
+    } else {
+        s = stream_lookup(*stream, false);
+        if (!s) {
+            // never submitted to, unless it collided with tracked streams
+            *snap = atomic64_read(&submit_seq);
+            if (READ_ONCE(sync_elision) && (s64)*snap <= dev)
+                goto elide;
+        } else {
+            *snap = atomic64_read(&s->submitted);
+            if (READ_ONCE(sync_elision) && ((s64)*snap <= dev || (s64)*snap <= atomic64_read(&s->synced)))
+                goto elide;
+        }
+    }
+    atomic_long_inc(&n_forwarded);
+    return false;
+
+elide:
+    atomic_long_inc(&n_elided);
+    return true;
+}
+
+// a synchronize returned successfully, everything up to snap is done
+void lake_sync_completed(u32 api, void *stream, u64 snap)
+{
+    struct stream_state *s;
+
+    if (api < LAKE_API_NR && lake_api_info[api].order == LAKE_ORDER_DEVSYNC) {
+        atomic64_max(&dev_synced, snap);
+        return;
+    }
+    s = stream ? stream_lookup(stream, false) : NULL;
+    if (s)
+        atomic64_max(&s->synced, snap);
+}
@@ -0,0 +1,336 @@
+/*
+ * Part of LAKE: Towards a Machine Learning-Assisted Kernel with LAKE
+ *
+ * Original work:
+ *   Copyright (C) 2022–2024 Henrique Fingler
+ *   Copyright (C) 2022–2024 Isha Tarte
+ *
+ * Modifications and adaptations for LAIKA:
+ *   Copyright (C) 2024-2025 Haoming Zhuo
+ *
+ * This file is adapted from the original LAKE kernel module.
+ * Major changes include:
+ *   - Integration with LAIKA framework
+ *   - Hybrid execution support
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <linux/module.h>
+#include <linux/debugfs.h>
+#include <linux/seq_file.h>
+#include <linux/spinlock.h>
+#include <linux/mutex.h>
+#include <linux/slab.h>
+#include <linux/mm.h>
+#include <linux/log2.h>
+#include <linux/math64.h>
+#include <linux/ktime.h>
+#include "commands.h"
+#include "lake_kapi.h"
+
+/*
+ *   Hot path tracing, under /sys/kernel/debug/lake.
+ *   A traced command is stamped when the caller submits it (before waiting
+ *   for an in-flight slot) and when it is handed to the transport; lake_uspace
+ *   stamps it when it receives it and around the handler, and sends those
+ *   back in the reply; the reply path stamps it last. All stamps are
+ *   CLOCK_MONOTONIC, the same clock on both sides. The intervals go into
+ *   per-API log2 histograms:
+ *
+ *     slot       submit -> send      waiting for a free in-flight slot
+ *     transport  send -> receive     netlink or ring, and the receive loop
+ *     queue      receive -> start    dispatcher queues and barriers
+ *     handler    start -> end        the HIP/CUDA call, device time for syncs
+ *     reply      end -> completion   reply transport
+ *     total      submit -> completion
+ *
+ *   enable   write 1/0 to start/stop tracing, off by default
+ *   hist     per-API counts, errors, mean and histogram of each interval
+ *   events   the last trace_events commands, raw stamps, oldest first
+ *   reset    write anything to clear hist and events
+ */
+
+static int trace_events = 0;
+module_param(trace_events, int, 0444);
+MODULE_PARM_DESC(trace_events, "Number of raw events kept for debugfs lake/events, 0 (default) keeps none");
+
+DEFINE_STATIC_KEY_FALSE(lake_trace_on);
+
+#define TRACE_APIS    LAKE_API_NR
+#define TRACE_BUCKETS 32  // bucket i: [2^i, 2^(i+1)) ns, the last one open ended
+
+enum {
+    STAGE_SLOT,
+    STAGE_TRANSPORT,
+    STAGE_QUEUE,
+    STAGE_HANDLER,
+    STAGE_REPLY,
+    STAGE_TOTAL,
+    NR_STAGES
+};
+
+static const char *stage_names[NR_STAGES] = {
+    "slot", "transport", "queue", "handler", "reply", "total",
+};
+
+#define API_NAME(name, policy, order, fields) #name,
+static const char *api_names[TRACE_APIS] = {
+    LAKE_APIS(API_NAME)
+};
+
+// one per cpu, only touched with preemption disabled
+struct trace_hist {
+    u64 count[TRACE_APIS];
+    u64 errors[TRACE_APIS];
+    u64 sum[TRACE_APIS][NR_STAGES];
+    u64 bucket[TRACE_APIS][NR_STAGES][TRACE_BUCKETS];
+};
+
+struct trace_event {
+    u64 submit, send, recv, start, end, done;
+    u32 api;
+    s32 res;
+};
+
+static struct trace_hist *hists;  // nr_cpu_ids of them, allocated on first enable
+static DEFINE_MUTEX(enable_lock);
+
+static struct trace_event *events;
+static u64 events_head;
+static DEFINE_SPINLOCK(events_lock);
+
+static struct dentry *trace_dir;
+
+static inline u64 interval(u64 from, u64 to)
+{
+    return from && to > from ? to - from : 0;
+}
+
+static inline void hist_add(struct trace_hist *h, u32 api, int stage, u64 ns)
+{
+    int b = ns ? ilog2(ns) : 0;
+
+    h->sum[api][stage] += ns;
+    h->bucket[api][stage][min(b, TRACE_BUCKETS - 1)]++;
+}
+
+// reply path, before the command is completed: cmd and ret are still stable
+void lake_trace_record(struct lake_inflight *cmd, struct lake_cmd_ret *ret)
+{
+    u64 done = ktime_get_ns();
+    struct trace_hist *h;
+    struct trace_event *ev;
+    unsigned long flags;
+    u32 api = cmd->api;
+
+    if (unlikely(api >= TRACE_APIS || !hists))
+        return;
+
+    h = &hists[get_cpu()];
+    h->count[api]++;
+    if (ret->res != CUDA_SUCCESS)
+        h->errors[api]++;
+    hist_add(h, api, STAGE_TOTAL, interval(cmd->t_submit, done));
+    // replies from a lake_uspace that does not stamp only have a total
+    if (ret->t_recv) {
+        hist_add(h, api, STAGE_SLOT, interval(cmd->t_submit, cmd->t_send));
+        hist_add(h, api, STAGE_TRANSPORT, interval(cmd->t_send, ret->t_recv));
+        hist_add(h, api, STAGE_QUEUE, interval(ret->t_recv, ret->t_start));
+        hist_add(h, api, STAGE_HANDLER, interval(ret->t_start, ret->t_end));
+        hist_add(h, api, STAGE_REPLY, interval(ret->t_end, done));
+    }
+    put_cpu();
+
+    if (!events)
+        return;
+    spin_lock_irqsave(&events_lock, flags);
+    ev = &events[events_head++ % trace_events];
+    ev->submit = cmd->t_submit;
+    ev->send = cmd->t_send;
+    ev->recv = ret->t_recv;
+    ev->start = ret->t_start;
+    ev->end = ret->t_end;
+    ev->done = done;
+    ev->api = api;
+    ev->res = ret->res;
+    spin_unlock_irqrestore(&events_lock, flags);
+}
+
+static int hist_show(struct seq_file *s, void *unused)
+{
+    struct trace_hist *sum;
+    u32 api;
+    int cpu, st, b;
+
+    if (!hists) {
+        seq_puts(s, "tracing was never enabled\n");
+        return 0;
+    }
+    sum = kvzalloc(sizeof(*sum), GFP_KERNEL);
+    if (!sum)
+        return -ENOMEM;
+    // racy against the reply path, good enough for statistics
+    for_each_possible_cpu(cpu) {
+        struct trace_hist *h = &hists[cpu];
+        for (api = 0; api < TRACE_APIS; api++) {
+            sum->count[api] += READ_ONCE(h->count[api]);
+            sum->errors[api] += READ_ONCE(h->errors[api]);
+            for (st = 0; st < NR_STAGES; st++) {
+                sum->sum[api][st] += READ_ONCE(h->sum[api][st]);
+                for (b = 0; b < TRACE_BUCKETS; b++)
+                    sum->bucket[api][st][b] += READ_ONCE(h->bucket[api][st][b]);
+            }
+        }
+    }
+
+    seq_puts(s, "# api stage count mean_ns log2_ns:count...\n");
+    for (api = 0; api < TRACE_APIS; api++) {
+        if (!sum->count[api])
+            continue;
+        seq_printf(s, "%s calls %llu errors %llu\n", api_names[api] ? api_names[api] : "?",
+                sum->count[api], sum->errors[api]);
+        for (st = 0; st < NR_STAGES; st++) {
+            u64 n = 0;
+            for (b = 0; b < TRACE_BUCKETS; b++)
+                n += sum->bucket[api][st][b];
+            if (!n)
+                continue;
+            seq_printf(s, "  %-9s %llu %llu", stage_names[st], n, div64_u64(sum->sum[api][st], n));
+            for (b = 0; b < TRACE_BUCKETS; b++) {
+                if (sum->bucket[api][st][b])
+                    seq_printf(s, " %d:%llu", b, sum->bucket[api][st][b]);
+            }
+            seq_putc(s, '\n');
+        }
+    }
+    kvfree(sum);
+    return 0;
+}
+DEFINE_SHOW_ATTRIBUTE(hist);
+
+static int events_show(struct seq_file *s, void *unused)
+{
+    struct trace_event *snap;
+    unsigned long flags;
+    u64 head, i, n;
+
+    if (!events) {
+        seq_puts(s, "raw events are off, load with trace_events=N\n");
+        return 0;
+    }
+    snap = kvmalloc_array(trace_events, sizeof(*snap), GFP_KERNEL);
+    if (!snap)
+        return -ENOMEM;
+    spin_lock_irqsave(&events_lock, flags);
+    memcpy(snap, events, trace_events * sizeof(*snap));
+    head = events_head;
+    spin_unlock_irqrestore(&events_lock, flags);
+
+    n = min_t(u64, head, trace_events);
+    seq_puts(s, "# api res submit send recv start end done (ns)\n");
+    for (i = head - n; i < head; i++) {
+        struct trace_event *ev = &snap[i % trace_events];
+        seq_printf(s, "%s %d %llu %llu %llu %llu %llu %llu\n",
+                ev->api < TRACE_APIS && api_names[ev->api] ? api_names[ev->api] : "?", ev->res,
+                ev->submit, ev->send, ev->recv, ev->start, ev->end, ev->done);
+    }
+    kvfree(snap);
+    return 0;
+}
+DEFINE_SHOW_ATTRIBUTE(events);
+
+static void trace_reset(void)
+{
+    unsigned long flags;
+    int cpu;
+
+    if (hists) {
+        for_each_possible_cpu(cpu)
+            memset(&hists[cpu], 0, sizeof(*hists));
+    }
+    if (events) {
+        spin_lock_irqsave(&events_lock, flags);
+        events_head = 0;
+        spin_unlock_irqrestore(&events_lock, flags);
+    }
+}
+
+static ssize_t reset_write(struct file *file, const char __user *buf, size_t len, loff_t *pos)
+{
+    trace_reset();
+    return len;
+}
+
+static const struct file_operations reset_fops = {
+    .owner = THIS_MODULE,
+    .write = reset_write,
+};
+
+static int enable_get(void *data, u64 *val)
+{
+    *val = static_branch_unlikely(&lake_trace_on);
+    return 0;
+}
+
+static int enable_set(void *data, u64 val)
+{
+    int err = 0;
+
+    mutex_lock(&enable_lock);
+    if (val && !hists) {
+        hists = kvcalloc(nr_cpu_ids, sizeof(*hists), GFP_KERNEL);
+        if (!hists)
+            err = -ENOMEM;
+    }
+    if (!err) {
+        if (val)
+            static_branch_enable(&lake_trace_on);
+        else
+            static_branch_disable(&lake_trace_on);
+    }
+    mutex_unlock(&enable_lock);
+    return err;
+}
+DEFINE_DEBUGFS_ATTRIBUTE(enable_fops, enable_get, enable_set, "%llu\n");
+
+int lake_trace_init(void)
+{
+    if (trace_events > 0) {
+        events = kvcalloc(trace_events, sizeof(*events), GFP_KERNEL);
+        if (!events) {
+            pr_err("Failed to allocate %d trace events\n", trace_events);
+            return -ENOMEM;
+        }
+    }
+
+    // tracing is optional, a kernel without debugfs just cannot read it
+    trace_dir = debugfs_create_dir("lake", NULL);
+    debugfs_create_file_unsafe("enable", 0600, trace_dir, NULL, &enable_fops);
+    debugfs_create_file("hist", 0400, trace_dir, NULL, &hist_fops);
+    debugfs_create_file("events", 0400, trace_dir, NULL, &events_fops);
+    debugfs_create_file("reset", 0200, trace_dir, NULL, &reset_fops);
+    return 0;
+}
+
+// after the transports are down, nothing records any more
+void lake_trace_fini(void)
+{
+    static_branch_disable(&lake_trace_on);
+    debugfs_remove_recursive(trace_dir);
+    trace_dir = NULL;
+    kvfree(hists);
+    kvfree(events);
+    hists = NULL;
+    events = NULL;
+}
@@ -1,4 +1,12 @@
+#include <linux/module.h>
+#include <linux/moduleparam.h>
 #include <linux/mm.h>
+#include <linux/log2.h>
+#include <linux/mutex.h>
+#include <linux/preempt.h>
+#include <linux/nodemask.h>
+#include <linux/topology.h>
+#include <linux/capability.h>
 #include <linux/slab.h>
 #include <linux/uaccess.h>
 #include <linux/dma-map-ops.h>
@@ -8,123 +16,82 @@
 #include <asm/uaccess.h>
 
 #include "lake_shm.h"
+#include "kshm_alloc.h"
 
 #define EXPORTED_WEAKLY __attribute__ ((visibility ("default"))) __attribute__ ((weak))
 
-allocator_t *shm_allocator = NULL;
-static dma_addr_t dma_handle;
-static size_t overhead = sizeof(node_t) + sizeof(footer_t);
-static size_t offset = offsetof(node_t, next);
+/*
+ * The shared memory is a set of regions, each one DMA buffer with its own
+ * allocator. At load time one region is created, or one per online NUMA
+ * node with shm_numa; more are added on demand
+ * (KAVA_SHM_ADD_REGION, kava_shm_add_region) or when every region is full
+ * and shm_grow is set. Regions are never removed before unload, so lookups
+ * only need the count published after the entry. A region's node is where
+ * its pages ended up, which need not be the node asked for: the 32-bit
+ * coherent DMA allocation falls back to whatever node has low memory.
+ *
+ * Regions are mapped uncached in lake_uspace, except cached ones
+ * (kava_shm_add_cached_region): those hold what both sides poll, like the
+ * command rings, are mapped write-back and only serve kava_alloc_region.
+ */
+struct kshm_region {
+    int id;
+    int node;
+    void *start;
+    size_t size;
+    dma_addr_t dma_handle;
+    uint32_t is_dma;
+    bool cached;
+    struct kshm_alloc heap;
+};
+
+static struct kshm_region *regions[KAVA_SHM_MAX_REGIONS];
+static int n_regions;
+static DEFINE_MUTEX(regions_lock);
+static u64 dmamask = DMA_BIT_MASK(32);
 static struct device *dev_node;
 static struct class  *dev_class;
-static long shm_size;
-
-static void add_node(bin_t *bin, node_t *node)
-{
-    node_t *cur, *prev;
-
-    node->prev = node->next = NULL;
-
-    if (bin->head == NULL) {
-        bin->head = node;
-        return;
-    }
 
-    /* List is sorted in descending order by size, find the first position less than or equal to node->size */
-    cur = bin->head;
-    prev = NULL;
-    
-    /* Fast path: if new node is largest, insert at head directly */
-    if (cur->size < node->size) {
-        node->next = bin->head;
-        bin->head->prev = node;
-        bin->head = node;
-        return;
-    }
-    
-    /* Traverse to find insertion position */
-    while (cur && cur->size >= node->size) {
-        prev = cur;
-        cur = cur->next;
-    }
+static long shm_grow = 0;
+module_param(shm_grow, long, 0644);
+MODULE_PARM_DESC(shm_grow, "Size in MB of the region added when every region is full, 0 (default) disables growth");
 
-    if (cur == NULL) {
-        /* Insert at end of list */
-        prev->next = node;
-        node->prev = prev;
-    }
-    else {
-        /* Insert at middle position */
-        node->next = cur;
-        cur->prev = node;
-        prev->next = node;
-        node->prev = prev;
-    }
-}
+static int shm_numa = 0;
+module_param(shm_numa, int, 0444);
+MODULE_PARM_DESC(shm_numa, "Create one region per online NUMA node and allocate from the caller's node first (default 0)");
 
-static void remove_node(bin_t *bin, node_t *node)
+static inline int nr_regions(void)
 {
-    /* Use O(1) deletion operation of doubly linked list, no traversal needed */
-    if (bin->head == NULL)
-        return;
-
-    if (bin->head == node) {
-        bin->head = node->next;
-        if (bin->head)
-            bin->head->prev = NULL;
-        node->next = NULL;
-        node->prev = NULL;
-        return;
-    }
-
-    /* Directly use prev/next pointers for deletion, O(1) complexity */
-    if (node->prev)
-        node->prev->next = node->next;
-    if (node->next)
-        node->next->prev = node->prev;
-    
-    node->next = NULL;
-    node->prev = NULL;
+    return smp_load_acquire(&n_regions);
 }
 
-static node_t *get_best_fit(bin_t *bin, size_t size)
+static int alloc_stats_get(char *buf, const struct kernel_param *kp)
 {
-    node_t *temp = bin->head;
-
-    /* List is sorted in descending order by size, the first node that meets the condition is the best fit */
-    if (temp == NULL)
-        return NULL;
-
-    /* Since list is sorted in descending order, the first node with size >= size is the best fit */
-    while (temp != NULL && temp->size < size) {
-        temp = temp->next;
+    struct kshm_alloc_stats st;
+    u64 free_bytes;
+    int i, n = nr_regions(), len = 0;
+
+    if (!n)
+        return sprintf(buf, "not initialized\n");
+
+    for (i = 0; i < n; i++) {
+        kshm_alloc_get_stats(&regions[i]->heap, &st);
+        free_bytes = st.total_bytes - st.used_bytes;
+        // external fragmentation: share of the free memory outside the largest free block
+        len += scnprintf(buf + len, PAGE_SIZE - len, "region %d node %d: total %llu used %llu peak %llu "
+                "largest_free %llu frag %llu%% slab %llu slab_live %llu failures %llu\n",
+                i, regions[i]->node, st.total_bytes, st.used_bytes, st.peak_bytes, st.largest_free,
+                free_bytes ? (free_bytes - st.largest_free) * 100 / free_bytes : 0,
+                st.slab_bytes, st.slab_live_bytes, st.failures);
     }
-
-    return temp;  /* Return the first node that meets the condition, or NULL */
+    return len;
 }
 
-static footer_t *get_foot(node_t *node)
-{
-    return (footer_t *)((char *)node + sizeof(node_t) + node->size);
-}
-
-static void create_foot(node_t *head)
-{
-    footer_t *foot = get_foot(head);
-    foot->header = head;
-}
-
-/*
- * The regions in the first bucket are smaller than 8 bytes.
- */
-static unsigned get_bin_index(size_t size)
-{
-    unsigned index = -2;
-    while (size >>= 1) index++;
-    if (index < 0) index = 0;
-    if (index > BIN_MAX_IDX) index = BIN_MAX_IDX;
-    return index;
-}
+static const struct kernel_param_ops alloc_stats_ops = {
+    .get = alloc_stats_get,
+};
+module_param_cb(alloc_stats, &alloc_stats_ops, NULL, 0444);
+MODULE_PARM_DESC(alloc_stats, "Shared memory allocator usage, high-water mark and fragmentation, per region");
 
 static char *mod_dev_node(struct device *dev, umode_t *mode)
 {
@@ -143,18 +110,54 @@ static int kshm_release(struct inode *inode, struct file *filp)
     return 0;
 }
 
+static void region_info(struct kshm_region *r, struct kava_shm_region_info *info)
+{
+    info->id = r->id;
+    info->node = r->node;
+    info->size = r->size;
+    info->mmap_offset = kava_shm_make_offset(r->id, 0);
+}
+
 static long kshm_ioctl(struct file *filp, unsigned int cmd,
                        unsigned long arg)
 {
     int r = -EINVAL;
     long size_in_bytes;
+    struct kava_shm_regions *table;
+    struct kava_shm_add_region add;
+    int i;
 
     switch (cmd)
     {
     case KAVA_SHM_GET_SHM_SIZE:
-        size_in_bytes = shm_size;
-        copy_to_user((void *)arg, (void *)&size_in_bytes, sizeof(long));
-        r = 0;
+        // region 0 only, for clients that do not know about regions
+        if (!nr_regions())
+            return -ENODEV;
+        size_in_bytes = regions[0]->size;
+        r = copy_to_user((void *)arg, (void *)&size_in_bytes, sizeof(long)) ? -EFAULT : 0;
+        break;
+
+    case KAVA_SHM_GET_REGIONS:
+        table = kzalloc(sizeof(*table), GFP_KERNEL);
+        if (!table)
+            return -ENOMEM;
+        table->count = nr_regions();
+        for (i = 0; i < table->count; i++)
+            region_info(regions[i], &table->regions[i]);
+        r = copy_to_user((void *)arg, table, sizeof(*table)) ? -EFAULT : 0;
+        kfree(table);
+        break;
+
+    case KAVA_SHM_ADD_REGION:
+        if (!capable(CAP_SYS_ADMIN))
+            return -EPERM;
+        if (copy_from_user(&add, (void *)arg, sizeof(add)))
+            return -EFAULT;
+        r = kava_shm_add_region(add.size, add.node);
+        if (r < 0)
+            break;
+        add.id = r;
+        r = copy_to_user((void *)arg, &add, sizeof(add)) ? -EFAULT : 0;
         break;
 
     default:
@@ -202,34 +205,41 @@ unregister_dev:
     return -1;
 }
 
-/**
- * kava_allocator_init - Initialize shared memory allocator
- * @size: size of managed shared memory
- *
- * This function initializes the static shm_allocator.
- */
-int kava_allocator_init(size_t size)
+static void region_free(struct kshm_region *r)
 {
-    void *start;
-    node_t *init_region;
-    int err;
-    u64 dmamask;
+    pr_info("[kava-shm] Deallocate shared %smemory region %d pa = 0x%lx, va = 0x%lx\n",
+            (r->is_dma ? "DMA " : ""), r->id,
+            (uintptr_t)virt_to_phys(r->start), (uintptr_t)r->start);
 
-    shm_size = size;
+    if (r->is_dma) {
+        /* BUG: dma_free_coherent has segfault in a virtual machine. */
+        dma_free_coherent(dev_node, r->size, r->start, r->dma_handle);
+    }
+    //else
+    //    vfree(r->start);
+    kshm_alloc_fini(&r->heap);
+    kfree(r);
+}
 
-    /* Register chardev */
-    err = create_chrdevice();
-    if (err) 
-        return err;
+static int region_add_locked(size_t size, int node, bool cached)
+{
+    struct kshm_region *r;
+    int err;
 
-    /* Create allocator */
-    shm_allocator = (allocator_t *)kmalloc(sizeof(allocator_t), GFP_USER);
-    memset(shm_allocator, 0, sizeof(allocator_t));
+    size = PAGE_ALIGN(size);
+    if (!size || size > KAVA_SHM_OFFSET_MASK)
+        return -EINVAL;
+    if (node != NUMA_NO_NODE && (node < 0 || node >= MAX_NUMNODES || !node_online(node)))
+        return -EINVAL;
+    if (n_regions == KAVA_SHM_MAX_REGIONS)
+        return -ENOSPC;
 
-    if (size < overhead) {
-        size = PAGE_SIZE;
-        pr_info("[kava-shm] Round up shared memory size to %ld bytes\n", size);
-    }
+    r = kzalloc_node(sizeof(*r), GFP_KERNEL, node);
+    if (!r)
+        return -ENOMEM;
+    r->id = n_regions;
+    r->size = size;
+    r->cached = cached;
 
     /* Allocate memory */
     // pr_info("[kava-shm] Executing dma_alloc_coherent\n");
@@ -238,61 +248,136 @@ int kava_allocator_init(size_t size)
     //     pr_err("dma_set_mask returned: %d\n", err);
     //     return -EIO;
     // }
-    dmamask = DMA_BIT_MASK(32);
-    dev_node->dma_mask = (u64*)&dmamask;
+    dev_node->dma_mask = &dmamask;
     dev_node->coherent_dma_mask = DMA_BIT_MASK(32);
 
-    start = dma_alloc_coherent(dev_node, size, &dma_handle, GFP_KERNEL);
-    if (start) {
-        shm_allocator->is_dma = 1;
+    set_dev_node(dev_node, node);
+    r->start = dma_alloc_coherent(dev_node, size, &r->dma_handle, GFP_KERNEL);
+    set_dev_node(dev_node, NUMA_NO_NODE);
+    if (!r->start) {
+        pr_err("[kava-shm] Failed to allocate shared memory region of %lu bytes\n", size);
+        err = -ENOMEM;
+        goto fail;
     }
-    else {
-        pr_err("[kava-shm] Failed to allocate shared memory\n");
-        kfree(shm_allocator);
-        return -ENOMEM;
+    r->is_dma = 1;
+    r->node = page_to_nid(is_vmalloc_addr(r->start) ? vmalloc_to_page(r->start) : virt_to_page(r->start));
+    if (node != NUMA_NO_NODE && r->node != node)
+        pr_info("[kava-shm] Region %d asked for node %d got node %d\n", r->id, node, r->node);
+
+    err = kshm_alloc_init(&r->heap, r->start, size, nr_cpu_ids);
+    if (err) {
+        pr_err("[kava-shm] Failed to initialize allocator: %d\n", err);
+        dma_free_coherent(dev_node, size, r->start, r->dma_handle);
+        goto fail;
     }
 
-    pr_info("[kava-shm] Allocate shared %smemory region pa = 0x%lx, va = 0x%lx\n",
-            (shm_allocator->is_dma ? "DMA " : ""),
-            (uintptr_t)virt_to_phys(start), (uintptr_t)start);
-    shm_allocator->start = (long)start;
-    shm_allocator->size = size;
-    shm_allocator->end = (long)start + size;
+    pr_info("[kava-shm] Allocate shared %s%smemory region %d of %lu KB pa = 0x%lx, va = 0x%lx\n",
+            (r->is_dma ? "DMA " : ""), (r->cached ? "cached " : ""), r->id, size >> 10,
+            (uintptr_t)virt_to_phys(r->start), (uintptr_t)r->start);
 
-    /* Initialize header */
-    init_region = (node_t *)start;
-    init_region->hole = 1;
-    init_region->size = size - overhead;
+    regions[r->id] = r;
+    smp_store_release(&n_regions, r->id + 1);
+    return r->id;
 
-    /* Initialize footer */
-    create_foot(init_region);
+fail:
+    kfree(r);
+    return err;
+}
 
-    /* Add initial region to buckets */
-    add_node(&shm_allocator->bins[get_bin_index(init_region->size)], init_region);
+/**
+ * kava_shm_add_region - Add a shared memory region
+ * @size: size of the region in bytes, rounded up to a page
+ * @node: NUMA node to allocate it on, or NUMA_NO_NODE
+ *
+ * Returns the id of the new region or a negative errno. lake_uspace maps
+ * the region the first time it sees an offset in it. May sleep.
+ */
+int kava_shm_add_region(size_t size, int node)
+{
+    int id;
 
-    return 0;
+    mutex_lock(&regions_lock);
+    id = region_add_locked(size, node, false);
+    mutex_unlock(&regions_lock);
+    return id;
+}
+EXPORT_SYMBOL(kava_shm_add_region);
+
+/**
+ * kava_shm_add_cached_region - Add a shared memory region mapped write-back
+ * @size: size of the region in bytes, rounded up to a page
+ *
+ * For memory both sides spin on, which uncached would make every poll a
+ * trip to memory. Only kava_alloc_region allocates from it. Returns the id
+ * of the new region or a negative errno. May sleep.
+ */
+int kava_shm_add_cached_region(size_t size)
+{
+    int id;
+
+    mutex_lock(&regions_lock);
+    id = region_add_locked(size, NUMA_NO_NODE, true);
+    mutex_unlock(&regions_lock);
+    return id;
+}
+EXPORT_SYMBOL(kava_shm_add_cached_region);
+
+/**
+ * kava_allocator_init - Initialize shared memory allocator
+ * @size: size of each initial shared memory region
+ *
+ * This function registers the device and creates region 0. With shm_numa
+ * and more than one node, every online node gets a region of the same
+ * size; a node that has no room for one is logged and skipped, only
+ * failing to create any region fails the load.
+ */
+int kava_allocator_init(size_t size)
+{
+    int err, node;
+
+    /* Register chardev */
+    err = create_chrdevice();
+    if (err) 
+        return err;
+
+    if (size < PAGE_SIZE) {
+        size = PAGE_SIZE;
+        pr_info("[kava-shm] Round up shared memory size to %ld bytes\n", size);
+    }
+
+    if (!shm_numa || num_online_nodes() == 1) {
+        err = kava_shm_add_region(size, NUMA_NO_NODE);
+        if (err < 0)
+            goto fail;
+        return 0;
+    }
+
+    for_each_online_node(node) {
+        err = kava_shm_add_region(size, node);
+        if (err < 0)
+            pr_warn("[kava-shm] No shared memory region on node %d: %d\n", node, err);
+    }
+    if (nr_regions())
+        return 0;
+
+fail:
+    kava_allocator_fini();
+    return err;
 }
 EXPORT_SYMBOL(kava_allocator_init);
 
 /**
- * kava_allocator_fini - Free allocated memory region
+ * kava_allocator_fini - Free allocated memory regions
  */
 void kava_allocator_fini(void)
 {
-    if (shm_allocator) {
-        pr_info("[kava-shm] Deallocate shared %smemory region pa = 0x%lx, va = 0x%lx\n",
-                (shm_allocator->is_dma ? "DMA " : ""),
-                (uintptr_t)virt_to_phys((void *)shm_allocator->start),
-                (uintptr_t)shm_allocator->start);
-
-        if (shm_allocator->is_dma) {
-            /* BUG: dma_free_coherent has segfault in a virtual machine. */
-            dma_free_coherent(dev_node, shm_allocator->size, (void *)shm_allocator->start, dma_handle);
-        }
-        //else
-        //    vfree((void *)shm_allocator->start);
-        kfree(shm_allocator);
+    int i;
+
+    for (i = n_regions - 1; i >= 0; i--) {
+        region_free(regions[i]);
+        regions[i] = NULL;
     }
+    n_regions = 0;
 
     unregister_chrdev(KAVA_SHM_DEV_MAJOR, KAVA_SHM_DEV_NAME);
     device_destroy(dev_class, MKDEV(KAVA_SHM_DEV_MAJOR, KAVA_SHM_DEV_MINOR));
@@ -301,111 +386,105 @@ void kava_allocator_fini(void)
 }
 EXPORT_SYMBOL(kava_allocator_fini);
 
-void *__kava_alloc(allocator_t *allocator, size_t size)
+static struct kshm_region *region_of(const void *p)
 {
-    unsigned index = get_bin_index(size);
-    bin_t *bin;
-    node_t *found;
-    unsigned new_idx;
-
-    /* Reduce repeated bin pointer dereferences */
-    for (; index <= BIN_MAX_IDX; index++) {
-        bin = &allocator->bins[index];
-        found = get_best_fit(bin, size);
-        if (found != NULL)
-            break;
-    }
-
-    if (found == NULL)
-        return NULL;
-
-    /* Pre-calculate split size to avoid repeated calculations */
-    if (found->size - size > MIN_NODE_SIZE) {
-        node_t *split = (node_t *)((char *)found + overhead + size);
-        split->size = found->size - size - overhead;
-        split->hole = 1;
-        create_foot(split);
-
-        new_idx = get_bin_index(split->size);
-        add_node(&allocator->bins[new_idx], split);
+    struct kshm_region *r;
+    int i, n = nr_regions();
 
-        found->size = size;
-        create_foot(found);
+    for (i = 0; i < n; i++) {
+        r = regions[i];
+        if (r->start <= p && p < r->start + r->size)
+            return r;
     }
-
-    found->hole = 0;
-    remove_node(bin, found);
-
-    // TODO: expend memory region if it is running out of space
-
-    found->prev = NULL;
-    found->next = NULL;
-    return &found->next;
+    return NULL;
 }
 
 /**
- * kava_alloc - Allocate a memory from shared memory region
+ * kava_alloc_region - Allocate a memory from one shared memory region
+ * @region: region id, as returned by kava_shm_add_region
  * @size: size of memory to allocate
  *
- * This function returns the allocated memory's kernel virtual address.
+ * For clients that keep their buffers in a region of their own.
  */
-void *kava_alloc(size_t size)
+void *kava_alloc_region(int region, size_t size)
 {
-    return __kava_alloc(shm_allocator, size);
+    if (region < 0 || region >= nr_regions())
+        return NULL;
+    return kshm_alloc(&regions[region]->heap, size);
 }
-EXPORT_SYMBOL(kava_alloc);
+EXPORT_SYMBOL(kava_alloc_region);
 
-void __kava_free(allocator_t *allocator, void *p)
+/**
+ * kava_alloc_node - Allocate a memory from shared memory, preferably on a node
+ * @size: size of memory to allocate
+ * @node: NUMA node to try first, or NUMA_NO_NODE
+ *
+ * Regions on @node are tried first, then the others in order. When they
+ * are all full and shm_grow is set a new region is added on @node, which
+ * sleeps: only callers that can sleep grow the pool, the others (atomic
+ * context, a spinlock held, preemption off, or any caller on a kernel
+ * without preempt counting, where that cannot be told) get NULL. The new
+ * region is at least shm_grow MB and big enough for @size next to a slab
+ * of every class; the pool grows once per call.
+ */
+void *kava_alloc_node(size_t size, int node)
 {
-    node_t *head = (node_t *)((char *)p - offset);
-    node_t *prev, *next;
-    bin_t *list;
-    footer_t *new_foot, *old_foot;
-    unsigned int bin_idx;
-
-    if (head == (node_t *)(uintptr_t)allocator->start) {
-        head->hole = 1;
-        bin_idx = get_bin_index(head->size);
-        add_node(&allocator->bins[bin_idx], head);
-        return;
+    void *p;
+    size_t grow;
+    bool grown = false;
+    int i, n;
+
+again:
+    n = nr_regions();
+    if (node != NUMA_NO_NODE) {
+        for (i = 0; i < n; i++) {
+            if (regions[i]->node != node || regions[i]->cached)
+                continue;
+            p = kshm_alloc(&regions[i]->heap, size);
+            if (p)
+                return p;
+        }
     }
-
-    next = (node_t *)((char *)get_foot(head) + sizeof(footer_t));
-    prev = ((footer_t *)((char *)head - sizeof(footer_t)))->header;
-
-    /* Merge previous free block */
-    if (prev->hole) {
-        bin_idx = get_bin_index(prev->size);
-        list = &allocator->bins[bin_idx];
-        remove_node(list, prev);
-
-        prev->size += overhead + head->size;
-        new_foot = get_foot(head);
-        new_foot->header = prev;
-
-        head = prev;
+    for (i = 0; i < n; i++) {
+        if ((node != NUMA_NO_NODE && regions[i]->node == node) || regions[i]->cached)
+            continue;
+        p = kshm_alloc(&regions[i]->heap, size);
+        if (p)
+            return p;
     }
 
-    /* Merge next free block */
-    if (next->hole) {
-        bin_idx = get_bin_index(next->size);
-        list = &allocator->bins[bin_idx];
-        remove_node(list, next);
-
-        old_foot = get_foot(head);
-        head->size += overhead + next->size;
-        old_foot->header = NULL;
-        next->size = 0;
-        next->hole = 0;
-
-        new_foot = get_foot(head);
-        new_foot->header = head;
+    grow = (size_t)READ_ONCE(shm_grow) << 20;
+    if (!grow || grown || !preemptible() || size > KAVA_SHM_OFFSET_MASK)
+        return NULL;
+    grown = true;
+    grow = max_t(size_t, grow, roundup_pow_of_two(PAGE_ALIGN(size)) +
+            (KSHM_NR_CLASSES * KSHM_SLAB_PAGES << KSHM_PAGE_SHIFT));
+    mutex_lock(&regions_lock);
+    // somebody else may have grown the pool while we were trying
+    if (n_regions == n && region_add_locked(grow, node, false) < 0) {
+        mutex_unlock(&regions_lock);
+        return NULL;
     }
+    mutex_unlock(&regions_lock);
+    goto again;
+}
+EXPORT_SYMBOL(kava_alloc_node);
 
-    head->hole = 1;
-    bin_idx = get_bin_index(head->size);
-    add_node(&allocator->bins[bin_idx], head);
+/**
+ * kava_alloc - Allocate a memory from shared memory region
+ * @size: size of memory to allocate
+ *
+ * This function returns the allocated memory's kernel virtual address.
+ * Small requests are aligned to their size rounded up to a power of two,
+ * larger ones to a page. With shm_numa the caller's node is preferred,
+ * so lake_uspace can run the command on a worker close to the buffer
+ * (see kava_alloc_node).
+ */
+void *kava_alloc(size_t size)
+{
+    return kava_alloc_node(size, shm_numa ? numa_node_id() : NUMA_NO_NODE);
 }
+EXPORT_SYMBOL(kava_alloc);
 
 /**
  * kava_free - Free a memory allocated by kava_alloc
@@ -413,27 +492,39 @@ void __kava_free(allocator_t *allocator, void *p)
  */
 void kava_free(void *p)
 {
-    __kava_free(shm_allocator, p);
+    struct kshm_region *r;
+
+    if (!p)
+        return;
+    r = region_of(p);
+    if (!r || kshm_free(&r->heap, p))
+        pr_err("[kava-shm] kava_free of 0x%lx which was not allocated by kava_alloc\n", (uintptr_t)p);
 }
 EXPORT_SYMBOL(kava_free);
 
 /**
- * kava_shm_offset - Offset of the address in the shared memory region
+ * kava_shm_offset - Offset of the address in the shared memory
  * @p: memory address
  *
- * This function returns -1 if p is not inside the shared memory.
+ * The offset carries the region id in its upper bits (kava_shm_make_offset),
+ * offsets in region 0 are plain byte offsets. This function returns -1 if
+ * p is not inside the shared memory.
  */
 s64 kava_shm_offset(const void *p)
 {
-    if (shm_allocator->start <= (long)p && (long)p < shm_allocator->end)
-        return (long)p - shm_allocator->start;
+    struct kshm_region *r = region_of(p);
+
+    if (r)
+        return kava_shm_make_offset(r->id, (const char *)p - (const char *)r->start);
     return -1;
 }
 EXPORT_SYMBOL(kava_shm_offset);
 
 static vm_fault_t va_shm_vm_fault(struct vm_fault *vmf)
 {
-    vmf->page = vmalloc_to_page((void *)shm_allocator->start + (vmf->pgoff << PAGE_SHIFT));
+    struct kshm_region *r = vmf->vma->vm_private_data;
+
+    vmf->page = vmalloc_to_page(r->start + (vmf->pgoff << PAGE_SHIFT));
     get_page(vmf->page);
     return 0;
 }
@@ -442,24 +533,42 @@ static const struct vm_operations_struct va_shm_vm_ops = {
     .fault = va_shm_vm_fault,
 };
 
+/*
+ * Each region is mapped on its own, at file offset
+ * kava_shm_make_offset(id, 0) (see KAVA_SHM_GET_REGIONS). A cached region
+ * keeps the attributes dma_mmap_coherent picks, write-back where DMA is
+ * coherent.
+ */
 EXPORTED_WEAKLY int kshm_mmap_helper(struct file *filp, struct vm_area_struct *vma)
 {
     u64 rsize = vma->vm_end - vma->vm_start;
-    if (rsize != shm_allocator->size || vma->vm_pgoff != 0) {
-        pr_err("[kava] Error: shared memory size does not match "
-            "%llu != %lu  or  %lu != 0\n", rsize, shm_allocator->size,
-            vma->vm_pgoff);
+    u64 offset = (u64)vma->vm_pgoff << PAGE_SHIFT;
+    int id = kava_shm_region_of(offset);
+    struct kshm_region *r;
+
+    if (id >= nr_regions() || (offset & KAVA_SHM_OFFSET_MASK)) {
+        pr_err("[kava] Error: no shared memory region at offset 0x%llx\n", offset);
+        return -EINVAL;
+    }
+    r = regions[id];
+    if (rsize != r->size) {
+        pr_err("[kava] Error: shared memory region %d size does not match "
+            "%llu != %lu\n", id, rsize, r->size);
         return -EINVAL;
     }
 
-    pr_info("[kava] Map shared memory length = 0x%lx, offset = 0x%lx\n",
-            shm_allocator->size, vma->vm_pgoff);
+    pr_info("[kava] Map shared memory region %d length = 0x%lx\n", id, r->size);
 
-    if (shm_allocator->is_dma) {
-        vma->vm_page_prot = pgprot_noncached(vma->vm_page_prot);
-        return dma_mmap_coherent(dev_node, vma, (void *)shm_allocator->start, dma_handle, shm_allocator->size);
+    if (r->is_dma) {
+        if (!r->cached)
+            vma->vm_page_prot = pgprot_noncached(vma->vm_page_prot);
+        // dma_mmap_coherent maps from the start of the buffer, not from vm_pgoff
+        vma->vm_pgoff = 0;
+        return dma_mmap_coherent(dev_node, vma, r->start, r->dma_handle, r->size);
     }
     else {
+        vma->vm_private_data = r;
+        vma->vm_pgoff = 0;
         vma->vm_ops = &va_shm_vm_ops;
     }
 	return 0;
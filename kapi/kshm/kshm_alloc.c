@@ -0,0 +1,495 @@
+#ifdef __KERNEL__
+#include <linux/errno.h>
+#include <linux/mm.h>
+#include <linux/slab.h>
+#include <linux/smp.h>
+#include <linux/string.h>
+#else
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#endif
+
+#include "kshm_alloc.h"
+
+#ifdef __KERNEL__
+#define kshm_zalloc(n)      kvzalloc(n, GFP_KERNEL)
+#define kshm_zfree(p)       kvfree(p)
+#define kshm_lock_init(l)   spin_lock_init(l)
+#define kshm_lock_fini(l)   do { } while (0)
+#define kshm_lock(l)        spin_lock(l)
+#define kshm_unlock(l)      spin_unlock(l)
+#define kshm_cpu_get()      get_cpu()
+#define kshm_cpu_put()      put_cpu()
+#else
+#define kshm_lock_init(l)   pthread_mutex_init(l, NULL)
+#define kshm_lock_fini(l)   pthread_mutex_destroy(l)
+#define kshm_lock(l)        pthread_mutex_lock(l)
+#define kshm_unlock(l)      pthread_mutex_unlock(l)
+#define kshm_cpu_put()      do { } while (0)
+#define likely(x)           __builtin_expect(!!(x), 1)
+#define unlikely(x)         __builtin_expect(!!(x), 0)
+
+static void *kshm_zalloc(size_t n)
+{
+    void *p;
+
+    n = (n + 63) & ~(size_t)63;
+    p = aligned_alloc(64, n);
+    if (p)
+        memset(p, 0, n);
+    return p;
+}
+#define kshm_zfree(p)       free(p)
+
+// each thread owns a magazine slot; threads past ncpus go to the depot directly
+static int kshm_next_slot;
+static __thread int kshm_slot = -1;
+
+static int kshm_cpu_get(void)
+{
+    if (kshm_slot < 0)
+        kshm_slot = __atomic_fetch_add(&kshm_next_slot, 1, __ATOMIC_RELAXED);
+    return kshm_slot;
+}
+#endif
+
+#define KSHM_NIL 0xffffffffu
+
+enum {
+    KSHM_PG_TAIL = 0,  // inside a block, or unused
+    KSHM_PG_FREE,      // head of a free block
+    KSHM_PG_EXTENT,    // head of a large allocation
+    KSHM_PG_SLAB,      // part of a slab
+};
+
+static inline u32 log2_down(u64 x)
+{
+    return 63 - __builtin_clzll(x);
+}
+
+static inline u32 log2_up(u64 x)
+{
+    return x <= 1 ? 0 : 64 - __builtin_clzll(x - 1);
+}
+
+static inline int size_class(size_t size)
+{
+    if (size <= (1ul << KSHM_MIN_SHIFT))
+        return 0;
+    return log2_up(size) - KSHM_MIN_SHIFT;
+}
+
+/*
+ * Page allocator, all of it under a->lock.
+ */
+
+static void block_push(struct kshm_alloc *a, u32 pfn, u32 order)
+{
+    struct kshm_page *pg = &a->pages[pfn];
+    u32 head = a->free_head[order];
+
+    pg->state = KSHM_PG_FREE;
+    pg->order = order;
+    pg->prev = KSHM_NIL;
+    pg->next = head;
+    if (head != KSHM_NIL)
+        a->pages[head].prev = pfn;
+    a->free_head[order] = pfn;
+    a->free_mask |= 1u << order;
+}
+
+static void block_del(struct kshm_alloc *a, u32 pfn)
+{
+    struct kshm_page *pg = &a->pages[pfn];
+
+    if (pg->prev != KSHM_NIL) {
+        a->pages[pg->prev].next = pg->next;
+    } else {
+        a->free_head[pg->order] = pg->next;
+        if (pg->next == KSHM_NIL)
+            a->free_mask &= ~(1u << pg->order);
+    }
+    if (pg->next != KSHM_NIL)
+        a->pages[pg->next].prev = pg->prev;
+    pg->state = KSHM_PG_TAIL;
+}
+
+// frees an aligned block, merging it with its buddies
+static void block_free(struct kshm_alloc *a, u32 pfn, u32 order)
+{
+    u32 buddy;
+
+    while (order + 1 < KSHM_MAX_ORDER) {
+        buddy = pfn ^ (1u << order);
+        if ((u64)buddy + (1u << order) > a->npages)
+            break;
+        if (a->pages[buddy].state != KSHM_PG_FREE || a->pages[buddy].order != order)
+            break;
+        block_del(a, buddy);
+        a->pages[pfn].state = KSHM_PG_TAIL;
+        pfn &= ~(1u << order);
+        order++;
+    }
+    block_push(a, pfn, order);
+}
+
+// frees any run of pages as the largest aligned blocks it contains
+static void range_free(struct kshm_alloc *a, u32 pfn, u32 n)
+{
+    u32 order;
+
+    while (n) {
+        order = log2_down(n);
+        if (pfn && (u32)__builtin_ctz(pfn) < order)
+            order = __builtin_ctz(pfn);
+        block_free(a, pfn, order);
+        pfn += 1u << order;
+        n -= 1u << order;
+    }
+}
+
+/*
+ * Free runs that span several blocks, for requests no single block can
+ * serve. Every page is the head of a free block, the head of an extent or
+ * a slab page, so walking heads visits the whole region. Slow, but only
+ * large requests in a fragmented region get here.
+ */
+
+// first run of at least n free pages, KSHM_NIL if none; *longest gets the longest run seen
+static u32 run_find(struct kshm_alloc *a, u32 n, u32 *longest)
+{
+    struct kshm_page *pg;
+    u32 pfn = 0, start = 0, len = 0, step;
+
+    *longest = 0;
+    while (pfn < a->npages) {
+        pg = &a->pages[pfn];
+        if (pg->state == KSHM_PG_FREE) {
+            if (!len)
+                start = pfn;
+            step = 1u << pg->order;
+            len += step;
+            if (len > *longest)
+                *longest = len;
+            if (len >= n)
+                return start;
+        } else {
+            step = pg->state == KSHM_PG_EXTENT ? pg->npages : 1;
+            len = 0;
+        }
+        pfn += step;
+    }
+    return KSHM_NIL;
+}
+
+// takes the blocks of a run found by run_find, and gives back what goes past n pages
+static void run_take(struct kshm_alloc *a, u32 start, u32 n)
+{
+    u32 pfn = start, end = start + n, len;
+
+    while (pfn < end) {
+        len = 1u << a->pages[pfn].order;
+        block_del(a, pfn);
+        if (pfn + len > end)
+            range_free(a, end, pfn + len - end);
+        pfn += len;
+    }
+}
+
+static u32 pages_alloc(struct kshm_alloc *a, u32 n)
+{
+    u32 order = log2_up(n);
+    u32 mask = 0, pfn, o, longest;
+
+    if (order < KSHM_MAX_ORDER)
+        mask = a->free_mask & ~((1u << order) - 1);
+    if (!mask) {
+        // no block is big enough, but free neighbours may be
+        pfn = run_find(a, n, &longest);
+        if (pfn == KSHM_NIL)
+            goto fail;
+        run_take(a, pfn, n);
+        goto found;
+    }
+
+    o = __builtin_ctz(mask);
+    pfn = a->free_head[o];
+    block_del(a, pfn);
+    while (o > order) {
+        o--;
+        block_push(a, pfn + (1u << o), o);
+    }
+    // give back what the power-of-two rounding added
+    if (n < (1u << order))
+        range_free(a, pfn + n, (1u << order) - n);
+
+found:
+    a->pages[pfn].state = KSHM_PG_EXTENT;
+    a->pages[pfn].npages = n;
+    a->used_pages += n;
+    if (a->used_pages > a->peak_pages)
+        a->peak_pages = a->used_pages;
+    return pfn;
+
+fail:
+    a->failures++;
+    return KSHM_NIL;
+}
+
+static void pages_free(struct kshm_alloc *a, u32 pfn)
+{
+    u32 n = a->pages[pfn].npages;
+
+    a->used_pages -= n;
+    range_free(a, pfn, n);
+}
+
+/*
+ * Small objects. The depot is only touched to move half a magazine at a
+ * time, the common case stays on the local CPU.
+ */
+
+// called with the class lock held, hands the first `want` objects to the caller
+static u32 slab_carve(struct kshm_alloc *a, int cls, void **objs, u32 want)
+{
+    struct kshm_class *c = &a->classes[cls];
+    size_t obj_size = 1ul << (KSHM_MIN_SHIFT + cls);
+    size_t count = (KSHM_SLAB_PAGES << KSHM_PAGE_SHIFT) / obj_size;
+    char *slab;
+    u32 pfn, i, n = 0;
+
+    kshm_lock(&a->lock);
+    pfn = pages_alloc(a, KSHM_SLAB_PAGES);
+    if (pfn != KSHM_NIL) {
+        for (i = 0; i < KSHM_SLAB_PAGES; i++) {
+            a->pages[pfn + i].state = KSHM_PG_SLAB;
+            a->pages[pfn + i].cls = cls;
+        }
+    }
+    kshm_unlock(&a->lock);
+    if (pfn == KSHM_NIL)
+        return 0;
+
+    slab = a->base + ((size_t)pfn << KSHM_PAGE_SHIFT);
+    for (i = count; i-- > 0; ) {
+        void *obj = slab + i * obj_size;
+        if (n < want) {
+            objs[n++] = obj;
+        } else {
+            *(void **)obj = c->free;
+            c->free = obj;
+            c->nfree++;
+        }
+    }
+    c->slab_bytes += KSHM_SLAB_PAGES << KSHM_PAGE_SHIFT;
+    return n;
+}
+
+static u32 depot_pop(struct kshm_alloc *a, int cls, void **objs, u32 want)
+{
+    struct kshm_class *c = &a->classes[cls];
+    u32 n = 0;
+
+    kshm_lock(&c->lock);
+    while (n < want && c->free) {
+        objs[n++] = c->free;
+        c->free = *(void **)c->free;
+    }
+    c->nfree -= n;
+    if (n == 0)
+        n = slab_carve(a, cls, objs, want);
+    kshm_unlock(&c->lock);
+    return n;
+}
+
+static void depot_push(struct kshm_alloc *a, int cls, void **objs, u32 n)
+{
+    struct kshm_class *c = &a->classes[cls];
+    u32 i;
+
+    kshm_lock(&c->lock);
+    for (i = 0; i < n; i++) {
+        *(void **)objs[i] = c->free;
+        c->free = objs[i];
+    }
+    c->nfree += n;
+    kshm_unlock(&c->lock);
+}
+
+static void *small_alloc(struct kshm_alloc *a, int cls)
+{
+    struct kshm_mag *mag;
+    void *obj = NULL;
+    int cpu = kshm_cpu_get();
+
+    if (unlikely((u32)cpu >= a->ncpus)) {
+        kshm_cpu_put();
+        if (depot_pop(a, cls, &obj, 1)) {
+            kshm_lock(&a->classes[cls].lock);
+            a->classes[cls].allocs++;
+            kshm_unlock(&a->classes[cls].lock);
+        }
+        return obj;
+    }
+
+    mag = &a->mags[cpu * KSHM_NR_CLASSES + cls];
+    if (unlikely(!mag->n))
+        mag->n = depot_pop(a, cls, mag->obj, KSHM_MAG_SIZE / 2);
+    if (likely(mag->n)) {
+        obj = mag->obj[--mag->n];
+        mag->allocs++;
+    }
+    kshm_cpu_put();
+    return obj;
+}
+
+static void small_free(struct kshm_alloc *a, int cls, void *obj)
+{
+    struct kshm_mag *mag;
+    int cpu = kshm_cpu_get();
+
+    if (unlikely((u32)cpu >= a->ncpus)) {
+        kshm_cpu_put();
+        depot_push(a, cls, &obj, 1);
+        kshm_lock(&a->classes[cls].lock);
+        a->classes[cls].frees++;
+        kshm_unlock(&a->classes[cls].lock);
+        return;
+    }
+
+    mag = &a->mags[cpu * KSHM_NR_CLASSES + cls];
+    if (unlikely(mag->n == KSHM_MAG_SIZE)) {
+        depot_push(a, cls, &mag->obj[KSHM_MAG_SIZE / 2], KSHM_MAG_SIZE / 2);
+        mag->n = KSHM_MAG_SIZE / 2;
+    }
+    mag->obj[mag->n++] = obj;
+    mag->frees++;
+    kshm_cpu_put();
+}
+
+/*
+ * The region must be page aligned; a partial last page is not used.
+ */
+int kshm_alloc_init(struct kshm_alloc *a, void *base, size_t size, u32 ncpus)
+{
+    int i;
+
+    memset(a, 0, sizeof(*a));
+    a->base = (char *)base;
+    a->ncpus = ncpus;
+    if ((size >> KSHM_PAGE_SHIFT) == 0 || (size >> KSHM_PAGE_SHIFT) >= KSHM_NIL)
+        return -EINVAL;
+    a->npages = size >> KSHM_PAGE_SHIFT;
+
+    a->pages = (struct kshm_page *)kshm_zalloc((size_t)a->npages * sizeof(struct kshm_page));
+    a->mags = (struct kshm_mag *)kshm_zalloc((size_t)ncpus * KSHM_NR_CLASSES * sizeof(struct kshm_mag));
+    if (!a->pages || !a->mags) {
+        kshm_zfree(a->pages);
+        kshm_zfree(a->mags);
+        return -ENOMEM;
+    }
+
+    kshm_lock_init(&a->lock);
+    for (i = 0; i < KSHM_NR_CLASSES; i++)
+        kshm_lock_init(&a->classes[i].lock);
+    for (i = 0; i < KSHM_MAX_ORDER; i++)
+        a->free_head[i] = KSHM_NIL;
+    range_free(a, 0, a->npages);
+    return 0;
+}
+
+void kshm_alloc_fini(struct kshm_alloc *a)
+{
+    int i;
+
+    kshm_lock_fini(&a->lock);
+    for (i = 0; i < KSHM_NR_CLASSES; i++)
+        kshm_lock_fini(&a->classes[i].lock);
+    kshm_zfree(a->pages);
+    kshm_zfree(a->mags);
+    a->pages = NULL;
+    a->mags = NULL;
+}
+
+void *kshm_alloc(struct kshm_alloc *a, size_t size)
+{
+    u32 pfn;
+
+    if (size <= KSHM_MAX_SMALL)
+        return small_alloc(a, size_class(size));
+
+    if (size > ((size_t)a->npages << KSHM_PAGE_SHIFT))
+        return NULL;
+    kshm_lock(&a->lock);
+    pfn = pages_alloc(a, (size + KSHM_PAGE_SIZE - 1) >> KSHM_PAGE_SHIFT);
+    kshm_unlock(&a->lock);
+    if (pfn == KSHM_NIL)
+        return NULL;
+    return a->base + ((size_t)pfn << KSHM_PAGE_SHIFT);
+}
+
+// returns -EINVAL if p was not handed out by kshm_alloc
+int kshm_free(struct kshm_alloc *a, void *p)
+{
+    size_t off = (char *)p - a->base;
+    struct kshm_page *pg;
+    u32 pfn;
+
+    if ((char *)p < a->base || off >= ((size_t)a->npages << KSHM_PAGE_SHIFT))
+        return -EINVAL;
+    pfn = off >> KSHM_PAGE_SHIFT;
+    pg = &a->pages[pfn];
+
+    // slab pages never change class, no lock needed to read it
+    if (pg->state == KSHM_PG_SLAB) {
+        if (off & ((1ul << (KSHM_MIN_SHIFT + pg->cls)) - 1))
+            return -EINVAL;
+        small_free(a, pg->cls, p);
+        return 0;
+    }
+
+    if (off & (KSHM_PAGE_SIZE - 1))
+        return -EINVAL;
+    kshm_lock(&a->lock);
+    if (pg->state != KSHM_PG_EXTENT) {
+        kshm_unlock(&a->lock);
+        return -EINVAL;
+    }
+    pages_free(a, pfn);
+    kshm_unlock(&a->lock);
+    return 0;
+}
+
+// counters of other CPUs are read without their owner's consent, the small object figures are approximate
+void kshm_alloc_get_stats(struct kshm_alloc *a, struct kshm_alloc_stats *st)
+{
+    u64 allocs, frees;
+    u32 cpu, longest;
+    int cls;
+
+    memset(st, 0, sizeof(*st));
+    kshm_lock(&a->lock);
+    st->total_bytes = (u64)a->npages << KSHM_PAGE_SHIFT;
+    st->used_bytes = a->used_pages << KSHM_PAGE_SHIFT;
+    st->peak_bytes = a->peak_pages << KSHM_PAGE_SHIFT;
+    run_find(a, KSHM_NIL, &longest);
+    st->largest_free = (u64)longest << KSHM_PAGE_SHIFT;
+    st->failures = a->failures;
+    kshm_unlock(&a->lock);
+
+    for (cls = 0; cls < KSHM_NR_CLASSES; cls++) {
+        struct kshm_class *c = &a->classes[cls];
+
+        kshm_lock(&c->lock);
+        st->slab_bytes += c->slab_bytes;
+        allocs = c->allocs;
+        frees = c->frees;
+        kshm_unlock(&c->lock);
+        for (cpu = 0; cpu < a->ncpus; cpu++) {
+            allocs += a->mags[cpu * KSHM_NR_CLASSES + cls].allocs;
+            frees += a->mags[cpu * KSHM_NR_CLASSES + cls].frees;
+        }
+        st->slab_live_bytes += (allocs - frees) << (KSHM_MIN_SHIFT + cls);
+    }
+}
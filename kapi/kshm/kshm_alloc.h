@@ -0,0 +1,105 @@
+/*******************************************************************************
+
+  Shared memory allocator, used by the kava_shm driver to hand out pieces of
+  the DMA region. Builds in the kernel and in userspace (kapi/test).
+
+  Requests up to KSHM_MAX_SMALL bytes are rounded up to a power of two and
+  served from per-CPU magazines; a magazine refills from, and drains to,
+  a per-class depot, which carves new slabs out of the page allocator when
+  it runs dry. Anything larger takes whole pages from a binary buddy
+  allocator, with the tail of the power-of-two block given back right away.
+  When no free block of the rounded up size is left (a few slab pages at the
+  start of a region split it in halves, quarters..), the request takes the
+  first run of neighbouring free blocks long enough instead, so it only
+  fails when no contiguous run of free pages fits it.
+  Small objects are aligned to their class size, large ones to a page.
+
+*******************************************************************************/
+
+#ifndef __KAVA_SHM_ALLOC_H__
+#define __KAVA_SHM_ALLOC_H__
+
+#ifdef __KERNEL__
+#include <linux/types.h>
+#include <linux/spinlock.h>
+typedef spinlock_t kshm_lock_t;
+#else
+#include <stddef.h>
+#include <stdint.h>
+#include <pthread.h>
+typedef uint8_t  u8;
+typedef uint32_t u32;
+typedef uint64_t u64;
+// user threads can be preempted while holding it, so no spinning
+typedef pthread_mutex_t kshm_lock_t;
+#endif
+
+#define KSHM_PAGE_SHIFT  12
+#define KSHM_PAGE_SIZE   (1ul << KSHM_PAGE_SHIFT)
+#define KSHM_MIN_SHIFT   6   // smallest class is a cacheline
+#define KSHM_NR_CLASSES  6   // 64 B .. 2 KB
+#define KSHM_MAX_SMALL   (1ul << (KSHM_MIN_SHIFT + KSHM_NR_CLASSES - 1))
+#define KSHM_MAX_ORDER   32
+#define KSHM_MAG_SIZE    32
+#define KSHM_SLAB_PAGES  4
+
+// per page metadata, kept outside the shared region
+struct kshm_page {
+    u32 next;    // free list links, free block heads only
+    u32 prev;
+    u32 npages;  // allocated extent head: its length
+    u8 state;
+    u8 order;    // free block head: its order
+    u8 cls;      // slab page: its size class
+};
+
+struct kshm_class {
+    kshm_lock_t lock;
+    void *free;       // depot, linked through the first word of each object
+    u64 nfree;
+    u64 slab_bytes;
+    u64 allocs;       // done on the depot directly, by callers without a magazine
+    u64 frees;
+} __attribute__((aligned(64)));
+
+struct kshm_mag {
+    u32 n;
+    u64 allocs;
+    u64 frees;
+    void *obj[KSHM_MAG_SIZE];
+} __attribute__((aligned(64)));
+
+struct kshm_alloc {
+    char *base;
+    u32 npages;
+    u32 ncpus;
+    struct kshm_page *pages;
+    struct kshm_mag *mags;  // ncpus * KSHM_NR_CLASSES
+
+    kshm_lock_t lock;       // page allocator
+    u32 free_mask;          // bit i set: free_head[i] is not empty
+    u32 free_head[KSHM_MAX_ORDER];
+    u64 used_pages;
+    u64 peak_pages;
+    u64 failures;
+
+    struct kshm_class classes[KSHM_NR_CLASSES];
+};
+
+struct kshm_alloc_stats {
+    u64 total_bytes;
+    u64 used_bytes;        // pages handed out, slabs included
+    u64 peak_bytes;        // high-water mark of used_bytes
+    u64 largest_free;      // longest free run, the most a single allocation can get
+    u64 slab_bytes;
+    u64 slab_live_bytes;   // small objects currently allocated
+    u64 failures;
+};
+
+int kshm_alloc_init(struct kshm_alloc *a, void *base, size_t size, u32 ncpus);
+void kshm_alloc_fini(struct kshm_alloc *a);
+void *kshm_alloc(struct kshm_alloc *a, size_t size);
+int kshm_free(struct kshm_alloc *a, void *p);
+void kshm_alloc_get_stats(struct kshm_alloc *a, struct kshm_alloc_stats *st);
+
+#endif // __KAVA_SHM_ALLOC_H__
@@ -1,164 +1,311 @@
+#ifdef __KERNEL__
 #include <linux/types.h>
+#include <linux/kernel.h>
+#include <linux/string.h>
 #include <linux/spinlock.h>
+#else
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#define pr_err(...) fprintf(stderr, __VA_ARGS__)
+#endif
 
 #include "mymemory.h"
 
+#ifdef __KERNEL__
+static DEFINE_SPINLOCK(lock);
+#define my_lock(flags)   spin_lock_irqsave(&lock, flags)
+#define my_unlock(flags) spin_unlock_irqrestore(&lock, flags)
+#else
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+#define my_lock(flags)   do { (void)(flags); pthread_mutex_lock(&lock); } while (0)
+#define my_unlock(flags) pthread_mutex_unlock(&lock)
+#endif
+
+#define POISON_FREE  0x6b
+#define POISON_ALLOC 0xa5
+
 // --- Global variables
-chunkStatus *head = NULL;
-DEFINE_SPINLOCK(lock);
+static u32 fl_bitmap;
+static u32 sl_bitmap[FL_COUNT];
+static chunkStatus *blocks[FL_COUNT][SL_COUNT];
 
 void* shm_start;
 void* shm_end;
 u64 shm_size;
 
 
-/* findChunk: search for the first chunk that fits (size equal or more) the request
-              of the user.
-     chunkStatus *headptr: pointer to the first block of memory in the heap
-     u64 size: size requested by the user
-     retval: a poiter to the block which fits the request 
-	     or NULL, in case there is no such block in the list
+static inline int my_fls(u64 x) { return 63 - __builtin_clzll(x); }
+static inline int my_ffs(u32 x) { return __builtin_ctz(x); }
+
+static inline chunkStatus *nextChunk(chunkStatus *c)
+{
+    return (chunkStatus *)((char *)c + STRUCT_SIZE + c->size);
+}
+
+// only valid if c->prev_free is set
+static inline chunkStatus *prevChunk(chunkStatus *c)
+{
+    u64 prev_size = *((u64 *)c - 1);
+    return (chunkStatus *)((char *)c - prev_size - STRUCT_SIZE);
+}
+
+static inline void setFooter(chunkStatus *c)
+{
+    *(u64 *)((char *)nextChunk(c) - sizeof(u64)) = c->size;
+}
+
+/* mappingInsert: first and second level list holding chunks of a given size.
+     u64 size: payload size of the chunk
+     int *fl, int *sl: list indexes
 */
-chunkStatus* findChunk(chunkStatus *headptr, u64 size) {
-    chunkStatus* ptr = headptr;
-    u64 required_size = size + STRUCT_SIZE;
-    
-    /* Pre-calculate required size to avoid repeated calculations */
-    while(ptr != NULL) {
-        /* Check available first, then check size, using short-circuit evaluation */
-        if(ptr->available == 1 && ptr->size >= required_size)
-            return ptr;
-        ptr = ptr->next;
+static void mappingInsert(u64 size, int *fl, int *sl)
+{
+    int f;
+
+    if (size < (1ull << FL_SHIFT)) {
+        *fl = 0;
+        *sl = size / (1ull << (FL_SHIFT - SL_LOG2));
+        return;
     }
-    return NULL;  
+    f = my_fls(size);
+    *sl = (size >> (f - SL_LOG2)) ^ SL_COUNT;
+    *fl = f - FL_SHIFT + 1;
 }
 
-/* splitChunk: split one big block into two. The first will have the size requested by the user.
-  	       the second will have the remainder.
-     chunkStatus* ptr: pointer to the block of memory which is going to be splitted.
-     u64 size: size requested by the user
-     retval: void, the function modifies the list
+/* mappingSearch: like mappingInsert, but rounds the size up to the next
+                  list so every chunk in the returned list is large enough.
 */
-void splitChunk(chunkStatus* ptr, u64 size)
+static void mappingSearch(u64 size, int *fl, int *sl)
 {
-    chunkStatus *newChunk;	
-    newChunk = (chunkStatus*)(ptr->end + size);
-    newChunk->size = ptr->size - size - STRUCT_SIZE;
-    newChunk->available = 1;
-    newChunk->next = ptr->next;
-    newChunk->prev = ptr;
-    if((newChunk->next) != NULL)
-        (newChunk->next)->prev = newChunk;
+    if (size >= (1ull << FL_SHIFT))
+        size += (1ull << (my_fls(size) - SL_LOG2)) - 1;
+    mappingInsert(size, fl, sl);
+}
 
-    ptr->size = size;
-    ptr->available = 0;
-    ptr->next = newChunk;
+static void insertChunk(chunkStatus *c)
+{
+    int fl, sl;
+
+    mappingInsert(c->size, &fl, &sl);
+    c->prev = NULL;
+    c->next = blocks[fl][sl];
+    if (c->next)
+        c->next->prev = c;
+    blocks[fl][sl] = c;
+    fl_bitmap |= 1u << fl;
+    sl_bitmap[fl] |= 1u << sl;
+}
+
+static void removeChunk(chunkStatus *c)
+{
+    int fl, sl;
+
+    mappingInsert(c->size, &fl, &sl);
+    if (c->next)
+        c->next->prev = c->prev;
+    if (c->prev) {
+        c->prev->next = c->next;
+        return;
+    }
+    blocks[fl][sl] = c->next;
+    if (!c->next) {
+        sl_bitmap[fl] &= ~(1u << sl);
+        if (!sl_bitmap[fl])
+            fl_bitmap &= ~(1u << fl);
+    }
 }
 
-/* mergeChunkPrev: merge one freed chunk with its predecessor (in case it is free as well)
-     chunkStatus* freed: pointer to the block of memory to be freed.
-     retval: void, the function modifies the list
+/* findChunk: find a free chunk of at least size bytes in O(1): the first
+              non-empty list at or above the rounded up size class.
+     u64 size: aligned size requested by the user
+     retval: a pointer to the chunk, still in its free list,
+	     or NULL, in case there is no such chunk
 */
-void mergeChunkPrev(chunkStatus *freed)
-{ 
-    chunkStatus *prev;
-    prev = freed->prev;
-    
-    if(prev != NULL && prev->available == 1) {
-        prev->size = prev->size + freed->size + STRUCT_SIZE;
-        prev->next = freed->next;
-        if( (freed->next) != NULL )
-        (freed->next)->prev = prev;
+static chunkStatus* findChunk(u64 size)
+{
+    u32 map;
+    int fl, sl;
+
+    mappingSearch(size, &fl, &sl);
+    if (fl >= FL_COUNT)
+        return NULL;
+
+    map = sl_bitmap[fl] & (~0u << sl);
+    if (!map) {
+        map = fl + 1 < FL_COUNT ? fl_bitmap & (~0u << (fl + 1)) : 0;
+        if (!map)
+            return NULL;
+        fl = my_ffs(map);
+        map = sl_bitmap[fl];
+    }
+    sl = my_ffs(map);
+    return blocks[fl][sl];
+}
+
+/* splitChunk: split one big block into two. The first will have the size requested by the user.
+  	       the second will have the remainder and goes back to the free lists.
+     chunkStatus* ptr: pointer to the chunk, already out of its free list
+     u64 size: aligned size requested by the user
+*/
+static void splitChunk(chunkStatus* ptr, u64 size)
+{
+    chunkStatus *newChunk;
+
+    if (ptr->size - size < STRUCT_SIZE + MIN_PAYLOAD) {
+        nextChunk(ptr)->prev_free = 0;
+        return;
     }
+    newChunk = (chunkStatus *)((char *)ptr + STRUCT_SIZE + size);
+    newChunk->size = ptr->size - size - STRUCT_SIZE;
+    newChunk->magic = CHUNK_FREE;
+    newChunk->prev_free = 0;
+    setFooter(newChunk);
+    insertChunk(newChunk);
+    ptr->size = size;
 }
 
-/* mergeChunkNext: merge one freed chunk with the following chunk (in case it is free as well)
-     chunkStatus* freed: pointer to the block of memory to be freed.
-     retval: void, the function modifies the list
+#ifdef MYMEMORY_DEBUG
+/* checkPoison: free chunks are filled with POISON_FREE, except for their
+                links and footer. Checks the part of a chunk being handed out.
+     chunkStatus *c: chunk out of the free lists, already split
 */
-void mergeChunkNext(chunkStatus *freed)
-{  
-    chunkStatus *next;
-    next = freed->next;
-    
-    if(next != NULL && next->available == 1) {
-        freed->size = freed->size + STRUCT_SIZE + next->size;
-        freed->next = next->next;
-        if( (next->next) != NULL )
-            (next->next)->prev = freed;
+static int checkPoison(chunkStatus *c)
+{
+    unsigned char *p = (unsigned char *)c + sizeof(chunkStatus);
+    u64 i, n = c->size - (sizeof(chunkStatus) - STRUCT_SIZE) - sizeof(u64);
+
+    for (i = 0; i < n; i++) {
+        if (p[i] != POISON_FREE) {
+            pr_err("mymalloc: chunk %p modified after free at byte %llu\n",
+                   (void *)&c->next, (unsigned long long)(sizeof(chunkStatus) - STRUCT_SIZE + i));
+            return 1;
+        }
     }
+    return 0;
 }
+#endif
 
 void mymalloc_init(void* ptr, u64 size) {
+    chunkStatus *first, *sentinel;
+    int i;
+
     shm_start = ptr;
-    shm_end = ptr+size;
+    shm_end = (char *)ptr + size;
     shm_size = size;
-    
-    head = ptr;
-    head->size = size - STRUCT_SIZE;
-    head->available = 1;
-    head->next = NULL;
-    head->prev = NULL;
-    //pr_warn("inited mymalloc\n");
+
+    fl_bitmap = 0;
+    for (i = 0; i < FL_COUNT; i++) {
+        sl_bitmap[i] = 0;
+        memset(blocks[i], 0, sizeof(blocks[i]));
+    }
+
+    // a zero sized used chunk at the end stops merges
+    size &= ~(u64)(MY_ALIGN_SIZE - 1);
+    first = ptr;
+    first->size = size - 2 * STRUCT_SIZE;
+    first->magic = CHUNK_FREE;
+    first->prev_free = 0;
+    sentinel = nextChunk(first);
+    sentinel->size = 0;
+    sentinel->magic = CHUNK_USED;
+    sentinel->prev_free = 1;
+#ifdef MYMEMORY_DEBUG
+    memset(&first->next, POISON_FREE, first->size);
+#endif
+    setFooter(first);
+    insertChunk(first);
 }
 
 /* mymalloc: allocates memory on the heap of the requested size. The block
              of memory returned should always be padded so that it begins
-             and ends on a word boundary.
+             and ends on a MY_ALIGN_SIZE boundary.
      u64 size: the number of bytes to allocate.
-     retval: a pointer to the block of memory allocated or NULL if the 
-             memory could not be allocated. 
-             (NOTE: the system also sets errno, but we are not the system, 
-                    so you are not required to do so.)
+     retval: a pointer to the block of memory allocated or NULL if the
+             memory could not be allocated.
 */
 void *mymalloc(u64 _size) {
     u64 size = MY_ALIGN(_size);
-    unsigned long flags;
-    chunkStatus *freeChunk = NULL;
-
-    //pthread_mutex_lock(&lock);
-    spin_lock_irqsave(&lock, flags);
-    freeChunk = findChunk(head, size);
-    if(freeChunk == NULL) {				//Didn't find any chunk available
-        //pthread_mutex_unlock(&lock);
-        spin_unlock_irqrestore(&lock, flags);
+    unsigned long flags = 0;
+    chunkStatus *freeChunk;
+
+    if (size < MIN_PAYLOAD)
+        size = MIN_PAYLOAD;
+
+    my_lock(flags);
+    freeChunk = findChunk(size);
+    if (freeChunk == NULL) {			//Didn't find any chunk available
+        my_unlock(flags);
         return NULL;
-    } //A chunk was found
-    if(freeChunk->size > size) //If chunk is too big, split it
-        splitChunk(freeChunk, size);
+    }
+    removeChunk(freeChunk);
+    splitChunk(freeChunk, size);
+#ifdef MYMEMORY_DEBUG
+    checkPoison(freeChunk);
+#endif
+    freeChunk->magic = CHUNK_USED;
+    my_unlock(flags);
 
-    //pthread_mutex_unlock(&lock);    
-    spin_unlock_irqrestore(&lock, flags);
-    return freeChunk->end;
+#ifdef MYMEMORY_DEBUG
+    memset(&freeChunk->next, POISON_ALLOC, freeChunk->size);
+#endif
+    return &freeChunk->next;
 }
 
-/* myfree: unallocates memory that has been allocated with mymalloc.
-     void *ptr: pointer to the first byte of a block of memory allocated by 
+/* myfree: unallocates memory that has been allocated with mymalloc and
+           merges it with free neighbours.
+     void *ptr: pointer to the first byte of a block of memory allocated by
                 mymalloc.
-     retval: 0 if the memory was successfully freed and 1 otherwise.
-             (NOTE: the system version of free returns no error.)
+     retval: 0 if the memory was successfully freed and 1 otherwise
+             (pointer outside the heap, misaligned, or already freed).
 */
 char myfree(void *ptr) {
-    unsigned long flags;
-	chunkStatus *toFree;
-
-	spin_lock_irqsave(&lock, flags);
-	//pthread_mutex_lock(&lock);
-
-	toFree = ptr - STRUCT_SIZE;	
-	if(toFree >= head ) {   //check if after end of buffer
-        toFree->available = 1;	
-        mergeChunkNext(toFree);
-        mergeChunkPrev(toFree);
-        //pthread_mutex_unlock(&lock);
-        spin_unlock_irqrestore(&lock, flags);
-        return 0;
-	}
-	else {
-        //#endif
-        //pthread_mutex_unlock(&lock);
-        spin_unlock_irqrestore(&lock, flags);
+    unsigned long flags = 0;
+    chunkStatus *toFree, *next;
+
+    if ((char *)ptr < (char *)shm_start + STRUCT_SIZE || (char *)ptr >= (char *)shm_end ||
+        ((char *)ptr - (char *)shm_start) % MY_ALIGN_SIZE != STRUCT_SIZE % MY_ALIGN_SIZE) {
+        pr_err("myfree: %p is not a mymalloc pointer\n", ptr);
         return 1;
-	}
-}
+    }
+    toFree = (chunkStatus *)((char *)ptr - STRUCT_SIZE);
+
+    my_lock(flags);
+    if (toFree->magic != CHUNK_USED) {
+        my_unlock(flags);
+        if (toFree->magic == CHUNK_FREE || toFree->magic == POISON_FREE * 0x01010101u)
+            pr_err("myfree: double free of %p\n", ptr);
+        else
+            pr_err("myfree: %p is not a mymalloc pointer\n", ptr);
+        return 1;
+    }
+    // a header absorbed by a merge keeps this (or the poison), so freeing it again is refused
+    toFree->magic = CHUNK_FREE;
+#ifdef MYMEMORY_DEBUG
+    memset(&toFree->next, POISON_FREE, toFree->size);
+#endif
 
+    next = nextChunk(toFree);
+    if (next->magic == CHUNK_FREE) {
+        removeChunk(next);
+        toFree->size += STRUCT_SIZE + next->size;
+#ifdef MYMEMORY_DEBUG
+        memset(next, POISON_FREE, sizeof(chunkStatus));
+#endif
+    }
+    if (toFree->prev_free) {
+        chunkStatus *prev = prevChunk(toFree);
+        removeChunk(prev);
+        prev->size += STRUCT_SIZE + toFree->size;
+#ifdef MYMEMORY_DEBUG
+        // the old footer of prev and our header are payload now
+        memset((char *)toFree - sizeof(u64), POISON_FREE, sizeof(u64) + STRUCT_SIZE);
+#endif
+        toFree = prev;
+    }
+    setFooter(toFree);
+    nextChunk(toFree)->prev_free = 1;
+    insertChunk(toFree);
+    my_unlock(flags);
+    return 0;
+}
@@ -1,27 +1,46 @@
 //Defines and macros
+#ifdef __KERNEL__
 #include <linux/types.h>
+#else
+#include <stddef.h>
+#include <stdint.h>
+typedef uint32_t u32;
+typedef uint64_t u64;
+#endif
 
-#define MY_ALIGN_SIZE 8
+#define MY_ALIGN_SIZE 16
 #define MY_ALIGN(size) (((size) + (MY_ALIGN_SIZE-1)) & ~(MY_ALIGN_SIZE-1))
 
-// --- Struct to store memory's block metadata
+// define to poison freed memory and check the poison when it is handed out again
+//#define MYMEMORY_DEBUG
+
+// --- Two-level segregated fit (TLSF) parameters
+#define SL_LOG2   4                        // 16 second level lists per power of two
+#define SL_COUNT  (1 << SL_LOG2)
+#define FL_SHIFT  (SL_LOG2 + 4)            // sizes below 256 B go to first level 0, 16 B apart
+#define FL_COUNT  32
+
+#define CHUNK_USED 0x55534544  // "USED"
+#define CHUNK_FREE 0x46524545  // "FREE"
+
+// --- Struct to store memory's block metadata (boundary tag)
+// A free chunk also keeps a copy of its size in its last 8 bytes, so the
+// chunk after it can find its header when they merge.
 typedef struct chunkStatus {
-  u64 size;
-  u64 available;
-  struct chunkStatus* next;
+  u64 size;                  // payload bytes
+  u32 magic;                 // CHUNK_USED or CHUNK_FREE
+  u32 prev_free;             // the chunk right before this one is free
+  struct chunkStatus* next;  // free list links, free chunks only: the payload starts here
   struct chunkStatus* prev;
-  char end[1]; 		//end represents the end of the metadata struct
 } chunkStatus;
 
-#define STRUCT_SIZE sizeof(chunkStatus)
+#define STRUCT_SIZE offsetof(chunkStatus, next)
+#define MIN_PAYLOAD MY_ALIGN(sizeof(chunkStatus) - STRUCT_SIZE + sizeof(u64))
 
-chunkStatus* findChunk(chunkStatus *headptr, u64 size);
-void splitChunk(chunkStatus* ptr, u64 size);
-void mergeChunk(chunkStatus *freed);
 void *mymalloc(u64 _size);
 char myfree(void *ptr);
 void mymalloc_init(void* ptr, u64 size);
 
 extern void* shm_start;
 extern void* shm_end;
-extern u64 shm_size;
\ No newline at end of file
+extern u64 shm_size;
@@ -18,12 +18,20 @@ function ctrl_c() {
 }
 
 cd ${ROOT}/kshm
+# add shm_grow=<MB> to add regions when the shared memory runs out; only
+# allocations from a context that can sleep grow it (kava_alloc_node)
 sudo insmod lake_shm.ko shm_size=80
 
 cd ${ROOT}/kernel
 sudo insmod lake_kapi.ko
 
+# LAKE_WORKERS dispatcher threads; the receive loop runs on the first of LAKE_CPUS,
+# workers on the following ones. LAKE_CPUS=numa spreads the workers over the NUMA
+# nodes; load lake_shm with shm_numa=1 to give each of them a region
+LAKE_WORKERS=${LAKE_WORKERS:-2}
+LAKE_CPUS=${LAKE_CPUS:-0,2,4}
+
 cd ${ROOT}/uspace
-sudo taskset 0x15 ./lake_uspace
+sudo ./lake_uspace -w ${LAKE_WORKERS} -c ${LAKE_CPUS}
 
 cd ${ROOT}
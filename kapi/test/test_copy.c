@@ -0,0 +1,320 @@
+/*
+ * Microbenchmark for the staging copy engine (include/lake_copy.h), to pick
+ * the copy_nt_min and copy_split_min parameters of lake_kapi.
+ *
+ * For every size it times memcpy, the AVX2 and AVX-512 non-temporal loops
+ * the kernel uses, and the best of those split over -t threads. A staging
+ * copy is not read again by the cpu that made it, so what it costs is the
+ * copy plus what it evicted: after each copy a 256 KB hot working set is
+ * read again and that time is added. Non-temporal stores are slower than
+ * memcpy on small, cache resident copies and win once the copy pushes the
+ * working set out; splitting wins once the copy is long enough to pay for
+ * waking the helpers up. The suggested thresholds are the sizes from which
+ * the faster variant keeps winning.
+ *
+ * Also checks the loops against memcpy for unaligned buffers and odd sizes.
+ *
+ *   ./test_copy [-t threads] [-m max size MB]
+ */
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+#include "lake_copy.h"
+
+#define MAX_THREADS  16
+#define HOT_SIZE     (256 << 10)
+#define MIN_SIZE     (4 << 10)
+#define TARGET_BYTES (256ull << 20)  // copied per measurement
+
+enum { V_MEMCPY, V_AVX2, V_AVX512, N_VARIANTS };
+static const char *variant_names[N_VARIANTS] = { "memcpy", "avx2-nt", "avx512-nt" };
+static int have[N_VARIANTS];
+
+static uint64_t errors;
+static char *hot;
+static volatile uint64_t sink;
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+// what copy.c does: align dst, vector loop, fence, tail
+static void copy_variant(int v, char *dst, const char *src, size_t n)
+{
+    size_t head, body;
+
+    if (v == V_MEMCPY) {
+        memcpy(dst, src, n);
+        return;
+    }
+    head = -(uintptr_t)dst & 63;
+    if (head > n)
+        head = n;
+    memcpy(dst, src, head);
+    dst += head;
+    src += head;
+    n -= head;
+    body = n & ~(size_t)(LAKE_NT_BLOCK - 1);
+    if (body) {
+        if (v == V_AVX512)
+            lake_nt_copy_avx512(dst, src, body);
+        else
+            lake_nt_copy_avx2(dst, src, body);
+    }
+    lake_nt_fence();
+    memcpy(dst + body, src + body, n - body);
+}
+
+static void read_hot(void)
+{
+    uint64_t sum = 0;
+    size_t i;
+
+    for (i = 0; i < HOT_SIZE; i += 64)
+        sum += *(volatile uint64_t *)(hot + i);
+    sink += sum;
+}
+
+/*
+ * Helper threads for split copies, woken through a condition variable like
+ * the kernel's workqueue wakes its workers.
+ */
+struct pool {
+    pthread_mutex_t lock;
+    pthread_cond_t go, done;
+    uint64_t gen;
+    int pending, nthreads, stop;
+    int v;
+    char *dst;
+    const char *src;
+    size_t n, per;
+};
+
+static struct pool pool = {
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .go = PTHREAD_COND_INITIALIZER,
+    .done = PTHREAD_COND_INITIALIZER,
+};
+
+static void copy_piece(int i)
+{
+    size_t first = pool.per * i, count;
+
+    if (first >= pool.n)
+        return;
+    count = pool.n - first < pool.per ? pool.n - first : pool.per;
+    copy_variant(pool.v, pool.dst + first, pool.src + first, count);
+}
+
+static void *pool_thread(void *arg)
+{
+    int id = (int)(intptr_t)arg;
+    uint64_t seen = 0;
+
+    pthread_mutex_lock(&pool.lock);
+    while (1) {
+        while (pool.gen == seen && !pool.stop)
+            pthread_cond_wait(&pool.go, &pool.lock);
+        if (pool.stop)
+            break;
+        seen = pool.gen;
+        pthread_mutex_unlock(&pool.lock);
+        copy_piece(id);
+        pthread_mutex_lock(&pool.lock);
+        if (--pool.pending == 0)
+            pthread_cond_signal(&pool.done);
+    }
+    pthread_mutex_unlock(&pool.lock);
+    return NULL;
+}
+
+static void copy_split(int v, char *dst, const char *src, size_t n)
+{
+    pthread_mutex_lock(&pool.lock);
+    pool.v = v;
+    pool.dst = dst;
+    pool.src = src;
+    pool.n = n;
+    pool.per = ((n + pool.nthreads - 1) / pool.nthreads + 4095) & ~(size_t)4095;
+    pool.pending = pool.nthreads - 1;
+    pool.gen++;
+    pthread_cond_broadcast(&pool.go);
+    pthread_mutex_unlock(&pool.lock);
+
+    copy_piece(0);
+    pthread_mutex_lock(&pool.lock);
+    while (pool.pending)
+        pthread_cond_wait(&pool.done, &pool.lock);
+    pthread_mutex_unlock(&pool.lock);
+}
+
+// ns per copy, the hot working set reread included
+static double measure(int v, int split, char *dst, const char *src, size_t n)
+{
+    uint64_t reps = TARGET_BYTES / n, i, start;
+
+    if (reps < 8)
+        reps = 8;
+    if (reps > 20000)
+        reps = 20000;
+    start = now_ns();
+    for (i = 0; i < reps; i++) {
+        if (split)
+            copy_split(v, dst, src, n);
+        else
+            copy_variant(v, dst, src, n);
+        read_hot();
+    }
+    return (double)(now_ns() - start) / reps;
+}
+
+static void check_variant(int v, char *dst, char *src)
+{
+    static const size_t sizes[] = { 0, 1, 63, 64, 255, 256, 257, 4095, 4096, 65536 + 77 };
+    size_t s, k, d;
+
+    for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        for (k = 0; k < 3; k++) {
+            for (d = 0; d < 3; d++) {
+                size_t so = k * 17, doff = d * 29, n = sizes[s];
+                memset(dst, 0xee, n + 256);
+                copy_variant(v, dst + doff, src + so, n);
+                if (memcmp(dst + doff, src + so, n) ||
+                        (doff && dst[doff - 1] != (char)0xee) || dst[doff + n] != (char)0xee) {
+                    printf("%s: wrong copy of %zu bytes, src +%zu dst +%zu\n",
+                            variant_names[v], n, so, doff);
+                    errors++;
+                }
+            }
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    size_t max_size = 64 << 20, n;
+    int threads = 4, opt, v, i, best;
+    double t[N_VARIANTS], t_split, t_best;
+    size_t nt_min = 0, split_min = 0;
+    pthread_t tids[MAX_THREADS];
+    char *src, *dst;
+
+    while ((opt = getopt(argc, argv, "t:m:")) != -1) {
+        switch (opt) {
+        case 't': threads = atoi(optarg); break;
+        case 'm': max_size = strtoul(optarg, NULL, 0) << 20; break;
+        default:
+            fprintf(stderr, "usage: %s [-t threads] [-m max size MB]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (threads < 1 || threads > MAX_THREADS || max_size < MIN_SIZE) {
+        fprintf(stderr, "bad arguments\n");
+        return 1;
+    }
+
+    __builtin_cpu_init();
+    have[V_MEMCPY] = 1;
+    have[V_AVX2] = __builtin_cpu_supports("avx2");
+    have[V_AVX512] = __builtin_cpu_supports("avx512f");
+
+    src = aligned_alloc(4096, max_size + 4096);
+    dst = aligned_alloc(4096, max_size + 4096);
+    hot = aligned_alloc(4096, HOT_SIZE);
+    if (!src || !dst || !hot) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    for (n = 0; n < max_size + 4096; n++)
+        src[n] = (char)(n * 131 + (n >> 12));
+    memset(dst, 0, max_size + 4096);
+    memset(hot, 1, HOT_SIZE);
+
+    for (v = V_AVX2; v < N_VARIANTS; v++) {
+        if (have[v])
+            check_variant(v, dst, src);
+        else
+            printf("%s: not supported by this cpu, skipped\n", variant_names[v]);
+    }
+
+    pool.nthreads = threads;
+    for (i = 1; i < threads; i++)
+        pthread_create(&tids[i], NULL, pool_thread, (void *)(intptr_t)i);
+
+    printf("ns per copy, %d KB hot set reread included; split is the best variant over %d threads\n",
+            HOT_SIZE >> 10, threads);
+    printf("%10s", "size");
+    for (v = 0; v < N_VARIANTS; v++)
+        printf("  %12s", variant_names[v]);
+    printf("  %12s\n", "split");
+    for (n = MIN_SIZE; n <= max_size; n *= 2) {
+        best = V_MEMCPY;
+        for (v = 0; v < N_VARIANTS; v++) {
+            t[v] = have[v] ? measure(v, 0, dst, src, n) : 0;
+            if (have[v] && t[v] < t[best])
+                best = v;
+        }
+        t_split = threads > 1 ? measure(best, 1, dst, src, n) : 0;
+        if (memcmp(dst, src, n)) {
+            printf("copy of %zu bytes does not match its source\n", n);
+            errors++;
+        }
+
+        printf("%8zuKB", n >> 10);
+        for (v = 0; v < N_VARIANTS; v++) {
+            if (have[v])
+                printf("  %12.0f", t[v]);
+            else
+                printf("  %12s", "-");
+        }
+        if (threads > 1)
+            printf("  %12.0f\n", t_split);
+        else
+            printf("  %12s\n", "-");
+
+        // the threshold is where the better choice starts to stay better
+        t_best = have[V_AVX512] && t[V_AVX512] < t[V_AVX2] ? t[V_AVX512] : t[V_AVX2];
+        if ((have[V_AVX2] || have[V_AVX512]) && t_best < t[V_MEMCPY]) {
+            if (!nt_min)
+                nt_min = n;
+        } else {
+            nt_min = 0;
+        }
+        if (threads > 1 && t_split < t[best]) {
+            if (!split_min)
+                split_min = n;
+        } else {
+            split_min = 0;
+        }
+    }
+
+    pthread_mutex_lock(&pool.lock);
+    pool.stop = 1;
+    pthread_cond_broadcast(&pool.go);
+    pthread_mutex_unlock(&pool.lock);
+    for (i = 1; i < threads; i++)
+        pthread_join(tids[i], NULL);
+
+    if (nt_min)
+        printf("suggested copy_nt_min=%zu\n", nt_min);
+    else
+        printf("non-temporal stores never won up to %zu MB, suggested copy_isa=0\n", max_size >> 20);
+    if (split_min)
+        printf("suggested copy_split_min=%zu copy_threads=%d\n", split_min, threads);
+    else
+        printf("splitting never won up to %zu MB, suggested copy_split_min=0\n", max_size >> 20);
+
+    free(src);
+    free(dst);
+    free(hot);
+    printf("%s (%lu errors)\n", errors ? "FAILED" : "PASSED", (unsigned long)errors);
+    return errors != 0;
+}
@@ -0,0 +1,294 @@
+/*
+ * Test for the cpu backend of lake_uspace (uspace/cpu_backend.c), driving
+ * lake_handle_cmd with the commands lake_kapi would send. Shared memory
+ * offsets are plain host pointers here.
+ *
+ * Runs a LinnOS batch (31-256-2, the kernels linnos_mix loads) and checks
+ * it against a plain C forward pass, encrypts the FIPS-197 AES-256 example
+ * block with the ecryptfs kernels, and checks the errors for unknown
+ * kernels and commands.
+ *
+ *   ./test_cpu_backend [-b batch]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include "commands.h"
+#include "kargs.h"
+#include "lake_kapi.h"
+
+#define LEN_INPUT   31
+#define LEN_LAYER_0 256
+#define MAX_BATCH   1024
+
+static uint64_t errors;
+
+#define CHECK(cond, ...) do {             \
+        if (!(cond)) {                    \
+            printf(__VA_ARGS__);          \
+            printf("\n");                 \
+            errors++;                     \
+        }                                 \
+    } while (0)
+
+void *lake_shm_address(const void* offset) {
+    return (void *) offset;
+}
+
+static struct lake_cmd_ret run(void *cmd) {
+    struct lake_cmd_ret ret;
+    memset(&ret, 0, sizeof(ret));
+    lake_handle_cmd(cmd, &ret);
+    return ret;
+}
+
+static CUdeviceptr dev_alloc(size_t size) {
+    struct lake_cmd_cuMemAlloc cmd = { LAKE_API_cuMemAlloc, size };
+    struct lake_cmd_ret ret = run(&cmd);
+    CHECK(ret.res == CUDA_SUCCESS && ret.ptr, "cuMemAlloc of %zu bytes failed: %d", size, ret.res);
+    return ret.ptr;
+}
+
+static void dev_free(CUdeviceptr ptr) {
+    struct lake_cmd_cuMemFree cmd = { LAKE_API_cuMemFree, ptr };
+    CHECK(run(&cmd).res == CUDA_SUCCESS, "cuMemFree failed");
+}
+
+static void htod(CUdeviceptr dst, const void *src, size_t size) {
+    struct lake_cmd_cuMemcpyHtoD cmd = { LAKE_API_cuMemcpyHtoD, dst, src, size };
+    CHECK(run(&cmd).res == CUDA_SUCCESS, "cuMemcpyHtoD failed");
+}
+
+static void dtoh(void *dst, CUdeviceptr src, size_t size, CUstream stream) {
+    struct lake_cmd_cuMemcpyDtoHAsync cmd = { LAKE_API_cuMemcpyDtoHAsync, dst, src, size, stream };
+    CHECK(run(&cmd).res == CUDA_SUCCESS, "cuMemcpyDtoHAsync failed");
+}
+
+static CUfunction get_function(CUmodule mod, const char *name) {
+    struct lake_cmd_cuModuleGetFunction cmd;
+    struct lake_cmd_ret ret;
+
+    cmd.API_ID = LAKE_API_cuModuleGetFunction;
+    cmd.hmod = mod;
+    strcpy(cmd.name, name);
+    ret = run(&cmd);
+    CHECK(ret.res == CUDA_SUCCESS && ret.func, "no function %s: %d", name, ret.res);
+    return ret.func;
+}
+
+// what kapi sends: the command, then the arguments serialized
+static void launch(CUfunction f, unsigned int grid, unsigned int block, CUstream stream, void **args) {
+    uint64_t buf[(sizeof(struct lake_cmd_cuLaunchKernel) + KARGS_MAX_SIZE) / 8 + 1];
+    struct lake_cmd_cuLaunchKernel *cmd = (struct lake_cmd_cuLaunchKernel *) buf;
+    struct kernel_args_metadata *meta = get_kargs(f);
+
+    memset(cmd, 0, sizeof(*cmd));
+    cmd->API_ID = LAKE_API_cuLaunchKernel;
+    cmd->f = f;
+    cmd->gridDimX = grid;
+    cmd->gridDimY = 1;
+    cmd->gridDimZ = 1;
+    cmd->blockDimX = block;
+    cmd->blockDimY = 1;
+    cmd->blockDimZ = 1;
+    cmd->hStream = stream;
+    cmd->paramsSize = meta->total_size;
+    serialize_args(meta, (u8 *) (cmd + 1), args);
+    CHECK(run(cmd).res == CUDA_SUCCESS, "launch failed");
+}
+
+static void test_linnos(CUmodule mod, CUstream stream, int batch) {
+    static long w0[LEN_LAYER_0 * LEN_INPUT], b0[LEN_LAYER_0], w1[2 * LEN_LAYER_0], b1[2];
+    static long input[MAX_BATCH * LEN_INPUT], res[MAX_BATCH * 64], mid[LEN_LAYER_0];
+    CUdeviceptr d_w0, d_b0, d_w1, d_b1, d_in, d_mid, d_res;
+    CUfunction mid_layer, final_layer;
+    void *args[4];
+    long acc, out[2];
+    int i, j, k, b;
+
+    srand(1);
+    for (i = 0; i < LEN_LAYER_0 * LEN_INPUT; i++)
+        w0[i] = rand() % 2001 - 1000;
+    for (i = 0; i < LEN_LAYER_0; i++)
+        b0[i] = rand() % 2001 - 1000;
+    for (i = 0; i < 2 * LEN_LAYER_0; i++)
+        w1[i] = rand() % 201 - 100;
+    b1[0] = rand() % 2001 - 1000;
+    b1[1] = rand() % 2001 - 1000;
+    for (i = 0; i < batch * LEN_INPUT; i++)
+        input[i] = rand() % 10;
+
+    mid_layer = get_function(mod, "_Z26prediction_mid_layer_batchPlS_S_S_");
+    final_layer = get_function(mod, "_Z28prediction_final_layer_batchPlS_S_S_");
+    d_w0 = dev_alloc(sizeof(w0));
+    d_b0 = dev_alloc(sizeof(b0));
+    d_w1 = dev_alloc(sizeof(w1));
+    d_b1 = dev_alloc(sizeof(b1));
+    d_in = dev_alloc(batch * LEN_INPUT * sizeof(long));
+    d_mid = dev_alloc(batch * LEN_LAYER_0 * sizeof(long));
+    d_res = dev_alloc(batch * 64 * sizeof(long));
+    htod(d_w0, w0, sizeof(w0));
+    htod(d_b0, b0, sizeof(b0));
+    htod(d_w1, w1, sizeof(w1));
+    htod(d_b1, b1, sizeof(b1));
+    htod(d_in, input, batch * LEN_INPUT * sizeof(long));
+
+    args[0] = &d_w0; args[1] = &d_b0; args[2] = &d_in; args[3] = &d_mid;
+    launch(mid_layer, batch, LEN_LAYER_0, stream, args);
+    args[0] = &d_w1; args[1] = &d_b1; args[2] = &d_mid; args[3] = &d_res;
+    launch(final_layer, batch, 64, stream, args);
+    dtoh(res, d_res, batch * 64 * sizeof(long), stream);
+
+    for (b = 0; b < batch; b++) {
+        for (j = 0; j < LEN_LAYER_0; j++) {
+            acc = b0[j];
+            for (k = 0; k < LEN_INPUT; k++)
+                acc += input[b * LEN_INPUT + k] * w0[j * LEN_INPUT + k];
+            mid[j] = acc < 0 ? 0 : acc;
+        }
+        for (i = 0; i < 2; i++) {
+            out[i] = b1[i];
+            for (j = 0; j < LEN_LAYER_0; j++)
+                out[i] += mid[j] * w1[i * LEN_LAYER_0 + j];
+        }
+        CHECK(res[b * 64] == out[0] && res[b * 64 + 32] == out[1],
+                "linnos: input %d gives %ld %ld, expected %ld %ld", b, res[b * 64], res[b * 64 + 32], out[0], out[1]);
+    }
+
+    dev_free(d_w0);
+    dev_free(d_b0);
+    dev_free(d_w1);
+    dev_free(d_b1);
+    dev_free(d_in);
+    dev_free(d_mid);
+    dev_free(d_res);
+}
+
+static uint8_t gf_mul(uint8_t a, uint8_t b) {
+    uint8_t p = 0;
+    while (b) {
+        if (b & 1)
+            p ^= a;
+        a = (uint8_t) ((a << 1) ^ (a & 0x80 ? 0x1b : 0));
+        b >>= 1;
+    }
+    return p;
+}
+
+static void aes_tables(uint8_t *sbox, uint8_t *rcon) {
+    uint8_t inv, x;
+    int i, j;
+
+    for (i = 0; i < 256; i++) {
+        inv = 0;
+        for (j = 1; j < 256 && i; j++) {
+            if (gf_mul((uint8_t) i, (uint8_t) j) == 1) {
+                inv = (uint8_t) j;
+                break;
+            }
+        }
+        x = inv;
+        sbox[i] = (uint8_t) (0x63 ^ x ^ (uint8_t) ((x << 1) | (x >> 7)) ^ (uint8_t) ((x << 2) | (x >> 6))
+                ^ (uint8_t) ((x << 3) | (x >> 5)) ^ (uint8_t) ((x << 4) | (x >> 4)));
+    }
+    rcon[0] = 0x8d;
+    for (i = 1, x = 1; i < 11; i++, x = gf_mul(x, 2))
+        rcon[i] = x;
+}
+
+// FIPS-197 appendix C.3
+static void test_aes(CUmodule mod, CUstream stream) {
+    static const uint8_t expected[16] = {
+        0x8e, 0xa2, 0xb7, 0xca, 0x51, 0x67, 0x45, 0xbf, 0xea, 0xfc, 0x49, 0x90, 0x4b, 0x49, 0x60, 0x89
+    };
+    uint8_t sbox[256], rcon[11], key[32], block[16];
+    CUdeviceptr d_sbox, d_rcon, d_key, d_roundkey, d_block;
+    CUfunction expand, encrypt;
+    void *args[4];
+    int i;
+
+    aes_tables(sbox, rcon);
+    for (i = 0; i < 32; i++)
+        key[i] = (uint8_t) i;
+    for (i = 0; i < 16; i++)
+        block[i] = (uint8_t) (i * 0x11);
+
+    expand = get_function(mod, "_Z24AES_key_expansion_kernelPhS_S_S_");
+    encrypt = get_function(mod, "_Z28AES_encrypt_one_block_kernelPhS_S_");
+    d_sbox = dev_alloc(sizeof(sbox));
+    d_rcon = dev_alloc(sizeof(rcon));
+    d_key = dev_alloc(sizeof(key));
+    d_roundkey = dev_alloc(240);
+    d_block = dev_alloc(sizeof(block));
+    htod(d_sbox, sbox, sizeof(sbox));
+    htod(d_rcon, rcon, sizeof(rcon));
+    htod(d_key, key, sizeof(key));
+    htod(d_block, block, sizeof(block));
+
+    args[0] = &d_sbox; args[1] = &d_rcon; args[2] = &d_key; args[3] = &d_roundkey;
+    launch(expand, 1, 1, stream, args);
+    args[0] = &d_sbox; args[1] = &d_roundkey; args[2] = &d_block;
+    launch(encrypt, 1, 1, stream, args);
+    dtoh(block, d_block, sizeof(block), stream);
+    CHECK(memcmp(block, expected, sizeof(block)) == 0, "aes: wrong ciphertext");
+
+    dev_free(d_sbox);
+    dev_free(d_rcon);
+    dev_free(d_key);
+    dev_free(d_roundkey);
+    dev_free(d_block);
+}
+
+int main(int argc, char **argv) {
+    struct lake_cmd_cuModuleLoad load;
+    struct lake_cmd_cuModuleGetFunction getf;
+    struct lake_cmd_cuStreamCreate screate = { LAKE_API_cuStreamCreate, 0 };
+    struct lake_cmd_cuStreamSynchronize ssync;
+    struct lake_cmd_ret ret;
+    uint32_t bad_cmd = 10000;
+    CUmodule mod;
+    CUstream stream;
+    int batch = 64, opt;
+
+    while ((opt = getopt(argc, argv, "b:")) != -1) {
+        switch (opt) {
+        case 'b': batch = atoi(optarg); break;
+        default:
+            fprintf(stderr, "usage: %s [-b batch]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (batch < 1 || batch > MAX_BATCH) {
+        fprintf(stderr, "bad arguments\n");
+        return 1;
+    }
+
+    CHECK(lake_backend_select("cpu", 1 << 20) == 0, "no cpu backend");
+    load.API_ID = LAKE_API_cuModuleLoad;
+    strcpy(load.fname, "linnos.cubin");
+    ret = run(&load);
+    CHECK(ret.res == CUDA_SUCCESS, "cuModuleLoad failed: %d", ret.res);
+    mod = ret.module;
+    ret = run(&screate);
+    CHECK(ret.res == CUDA_SUCCESS && ret.stream, "cuStreamCreate failed: %d", ret.res);
+    stream = ret.stream;
+
+    test_linnos(mod, stream, batch);
+    test_linnos(mod, stream, batch);   // again, from pooled memory
+    test_aes(mod, stream);
+
+    ssync.API_ID = LAKE_API_cuStreamSynchronize;
+    ssync.hStream = stream;
+    CHECK(run(&ssync).res == CUDA_SUCCESS, "cuStreamSynchronize failed");
+
+    getf.API_ID = LAKE_API_cuModuleGetFunction;
+    getf.hmod = mod;
+    strcpy(getf.name, "_Z6no_suchPf");
+    CHECK(run(&getf).res == CUDA_ERROR_NOT_FOUND, "unknown kernel found");
+    CHECK(run(&bad_cmd).res == CUDA_ERROR_INVALID_VALUE, "unknown command accepted");
+
+    printf("%s (%lu errors)\n", errors ? "FAILED" : "PASSED", (unsigned long)errors);
+    return errors != 0;
+}
@@ -0,0 +1,395 @@
+/*
+ * Test for the device memory pool of lake_uspace (uspace/devpool.c), built
+ * against a stub backend: "device memory" is malloc'd, and the device is a
+ * set of blocks with work still running on them until the next sync.
+ *
+ * Checks that freed blocks are reused for their size class, only after a
+ * sync and with one sync for a whole batch of frees, that the cache limit,
+ * double frees, trim and the counters behave, and that no block is ever
+ * handed out twice or while work runs on it under concurrent use. Then
+ * times alloc/free pairs with and without caching, the stub driver taking
+ * -d ns per call like a real driver would.
+ *
+ *   ./test_devpool [-t threads] [-n ops per thread] [-d driver ns]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+#include "devpool.h"
+
+#define MAX_LIVE 4096
+
+static uint64_t errors;
+static uint64_t driver_ns;
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+#define CHECK(cond, ...) do {             \
+        if (!(cond)) {                    \
+            printf(__VA_ARGS__);          \
+            printf("\n");                 \
+            errors++;                     \
+        }                                 \
+    } while (0)
+
+/*
+ * Stub device. Every live block has a state: handed out, busy (freed
+ * while work may still run on it) or idle, like a new one. sync turns
+ * busy into idle.
+ */
+enum { S_NONE, S_OUT, S_BUSY, S_IDLE };
+
+static pthread_mutex_t dev_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct { uint64_t ptr; int state; } dev_blocks[MAX_LIVE];
+static uint64_t dev_allocs, dev_frees, dev_syncs, dev_bytes, dev_limit = ~0ull;
+
+static void driver_delay(void)
+{
+    uint64_t end;
+
+    if (!driver_ns)
+        return;
+    end = now_ns() + driver_ns;
+    while (now_ns() < end)
+        ;
+}
+
+static int dev_find(uint64_t ptr)
+{
+    int i;
+    for (i = 0; i < MAX_LIVE; i++)
+        if (dev_blocks[i].state != S_NONE && dev_blocks[i].ptr == ptr)
+            return i;
+    return -1;
+}
+
+static int stub_alloc(uint64_t *ptr, size_t size)
+{
+    void *p;
+    int i;
+
+    driver_delay();
+    pthread_mutex_lock(&dev_lock);
+    if (dev_bytes + size > dev_limit) {
+        pthread_mutex_unlock(&dev_lock);
+        return 2;   // out of memory
+    }
+    p = malloc(size + sizeof(size_t));
+    for (i = 0; i < MAX_LIVE && dev_blocks[i].state != S_NONE; i++)
+        ;
+    if (!p || i == MAX_LIVE) {
+        pthread_mutex_unlock(&dev_lock);
+        free(p);
+        return 2;
+    }
+    *(size_t *)p = size;
+    dev_blocks[i].ptr = (uint64_t)(uintptr_t) p;
+    dev_blocks[i].state = S_IDLE;
+    dev_allocs++;
+    dev_bytes += size;
+    *ptr = dev_blocks[i].ptr;
+    pthread_mutex_unlock(&dev_lock);
+    return 0;
+}
+
+static int stub_free(uint64_t ptr)
+{
+    int i;
+
+    driver_delay();
+    pthread_mutex_lock(&dev_lock);
+    i = dev_find(ptr);
+    if (i < 0) {
+        pthread_mutex_unlock(&dev_lock);
+        printf("driver free of unknown pointer 0x%lx\n", (unsigned long) ptr);
+        errors++;
+        return 1;
+    }
+    // the driver waits for the device itself
+    dev_blocks[i].state = S_NONE;
+    dev_frees++;
+    dev_bytes -= *(size_t *)(uintptr_t) ptr;
+    free((void *)(uintptr_t) ptr);
+    pthread_mutex_unlock(&dev_lock);
+    return 0;
+}
+
+static int stub_sync(void)
+{
+    int i;
+
+    driver_delay();
+    pthread_mutex_lock(&dev_lock);
+    for (i = 0; i < MAX_LIVE; i++)
+        if (dev_blocks[i].state == S_BUSY)
+            dev_blocks[i].state = S_IDLE;
+    dev_syncs++;
+    pthread_mutex_unlock(&dev_lock);
+    return 0;
+}
+
+static const struct lake_devpool_backend stub_backend = { "stub", stub_alloc, stub_free, stub_sync };
+
+// what the handlers see: the pool gives out ptr, work runs on it, it is freed
+static void got(uint64_t ptr, size_t size)
+{
+    int i;
+
+    pthread_mutex_lock(&dev_lock);
+    i = dev_find(ptr);
+    if (i < 0)
+        CHECK(0, "pool handed out 0x%lx the driver never allocated", (unsigned long) ptr);
+    else if (dev_blocks[i].state == S_OUT)
+        CHECK(0, "pool handed out 0x%lx twice", (unsigned long) ptr);
+    else if (dev_blocks[i].state == S_BUSY)
+        CHECK(0, "pool handed out 0x%lx with work still running on it", (unsigned long) ptr);
+    else if (*(size_t *)(uintptr_t) ptr < size)
+        CHECK(0, "block 0x%lx of %zu bytes handed out for %zu", (unsigned long) ptr,
+                *(size_t *)(uintptr_t) ptr, size);
+    else
+        dev_blocks[i].state = S_OUT;
+    pthread_mutex_unlock(&dev_lock);
+}
+
+static void release(uint64_t ptr)
+{
+    int i;
+
+    pthread_mutex_lock(&dev_lock);
+    i = dev_find(ptr);
+    if (i >= 0 && dev_blocks[i].state == S_OUT)
+        dev_blocks[i].state = S_BUSY;
+    pthread_mutex_unlock(&dev_lock);
+}
+
+static uint64_t pool_alloc(struct lake_devpool *pool, size_t size)
+{
+    uint64_t ptr = 0;
+    int res = lake_devpool_alloc(pool, &ptr, size);
+
+    CHECK(res == 0, "allocation of %zu bytes failed with %d", size, res);
+    if (res == 0)
+        got(ptr, size);
+    return ptr;
+}
+
+static void pool_free(struct lake_devpool *pool, uint64_t ptr)
+{
+    int res;
+
+    release(ptr);
+    res = lake_devpool_free(pool, ptr);
+    CHECK(res == 0, "free of 0x%lx failed with %d", (unsigned long) ptr, res);
+}
+
+static void check_reuse(void)
+{
+    struct lake_devpool pool;
+    struct lake_devpool_stats st;
+    uint64_t p[8], q[8], syncs, allocs;
+    int i, j, found;
+
+    lake_devpool_init(&pool, &stub_backend, 64 << 20);
+
+    // sizes in the same class share blocks, after one sync for all of them
+    for (i = 0; i < 8; i++)
+        p[i] = pool_alloc(&pool, 100000 + i);
+    for (i = 0; i < 8; i++)
+        pool_free(&pool, p[i]);
+    syncs = dev_syncs;
+    allocs = dev_allocs;
+    for (i = 0; i < 8; i++)
+        q[i] = pool_alloc(&pool, 100000 + 7 - i);
+    CHECK(dev_syncs == syncs + 1, "8 reuses took %lu syncs", (unsigned long)(dev_syncs - syncs));
+    CHECK(dev_allocs == allocs, "8 reuses allocated %lu new blocks", (unsigned long)(dev_allocs - allocs));
+    for (i = 0; i < 8; i++) {
+        for (j = found = 0; j < 8; j++)
+            found |= q[i] == p[j];
+        CHECK(found, "0x%lx is not one of the freed blocks", (unsigned long) q[i]);
+    }
+
+    // another class does not take them
+    allocs = dev_allocs;
+    for (i = 0; i < 8; i++)
+        pool_free(&pool, q[i]);
+    p[0] = pool_alloc(&pool, 300000);
+    CHECK(dev_allocs == allocs + 1, "an allocation of another class reused a block");
+
+    // a free list still holding blocks is used without a sync
+    p[1] = pool_alloc(&pool, 100000);
+    syncs = dev_syncs;
+    pool_free(&pool, p[1]);
+    p[2] = pool_alloc(&pool, 100000);
+    CHECK(dev_syncs == syncs, "reuse took a sync while idle blocks were left");
+    pool_free(&pool, p[2]);
+    pool_free(&pool, p[0]);
+
+    lake_devpool_get_stats(&pool, &st);
+    CHECK(st.allocs == 19 && st.frees == 19, "stats count %llu allocs %llu frees", st.allocs, st.frees);
+    CHECK(st.hits == 10, "stats count %llu hits, expected 10", st.hits);
+    CHECK(st.in_use == 0, "%llu bytes in use after freeing everything", st.in_use);
+    CHECK(st.driver_allocs == dev_allocs, "stats count %llu driver allocs, the driver %lu",
+            st.driver_allocs, (unsigned long) dev_allocs);
+    CHECK(st.cached == 8 * 114688 + 327680, "%llu bytes cached", st.cached);
+
+    // double free
+    p[0] = pool_alloc(&pool, 4096);
+    pool_free(&pool, p[0]);
+    CHECK(lake_devpool_free(&pool, p[0]) != 0, "double free not reported");
+
+    allocs = dev_frees;
+    CHECK(lake_devpool_trim(&pool) == 8 * 114688 + 327680 + 4096, "trim released the wrong size");
+    CHECK(dev_frees == allocs + 10, "trim freed %lu blocks, expected 10", (unsigned long)(dev_frees - allocs));
+    lake_devpool_get_stats(&pool, &st);
+    CHECK(st.cached == 0 && st.trims == 1, "after trim %llu bytes cached, %llu trims", st.cached, st.trims);
+    lake_devpool_trim(&pool);
+}
+
+static void check_limits(void)
+{
+    struct lake_devpool pool;
+    uint64_t p[4], frees;
+    int i;
+
+    // freeing past the cache limit goes to the driver
+    lake_devpool_init(&pool, &stub_backend, 1 << 20);
+    for (i = 0; i < 4; i++)
+        p[i] = pool_alloc(&pool, 400 << 10);
+    frees = dev_frees;
+    for (i = 0; i < 4; i++)
+        pool_free(&pool, p[i]);
+    CHECK(dev_frees == frees + 2, "%lu of 4 blocks over the limit freed", (unsigned long)(dev_frees - frees));
+    lake_devpool_trim(&pool);
+
+    // no caching at all
+    lake_devpool_init(&pool, &stub_backend, 0);
+    p[0] = pool_alloc(&pool, 4096);
+    frees = dev_frees;
+    pool_free(&pool, p[0]);
+    CHECK(dev_frees == frees + 1, "free not passed through with caching off");
+
+    // out of device memory: the cache is given back and the allocation retried
+    lake_devpool_init(&pool, &stub_backend, 64 << 20);
+    p[0] = pool_alloc(&pool, 8 << 20);
+    pool_free(&pool, p[0]);
+    dev_limit = dev_bytes + (4 << 20);
+    p[1] = pool_alloc(&pool, 12 << 20);
+    dev_limit = ~0ull;
+    pool_free(&pool, p[1]);
+    lake_devpool_trim(&pool);
+
+    // large blocks are not cached
+    p[0] = pool_alloc(&pool, DEVPOOL_MAX_BLOCK + 1);
+    frees = dev_frees;
+    pool_free(&pool, p[0]);
+    CHECK(dev_frees == frees + 1, "block above DEVPOOL_MAX_BLOCK was cached");
+    lake_devpool_trim(&pool);
+
+    CHECK(dev_bytes == 0, "%lu bytes still allocated from the driver", (unsigned long) dev_bytes);
+}
+
+struct stress_arg {
+    struct lake_devpool *pool;
+    uint32_t n_ops;
+    unsigned int seed;
+};
+
+static void *stress_thread(void *arg)
+{
+    struct stress_arg *a = (struct stress_arg *) arg;
+    uint64_t live[64] = { 0 };
+    uint32_t i;
+    int k;
+
+    for (i = 0; i < a->n_ops; i++) {
+        k = rand_r(&a->seed) % 64;
+        if (live[k])
+            pool_free(a->pool, live[k]);
+        live[k] = pool_alloc(a->pool, 1 + rand_r(&a->seed) % (1 << (4 + rand_r(&a->seed) % 16)));
+        if (rand_r(&a->seed) % 64 == 0)
+            stub_sync();
+    }
+    for (k = 0; k < 64; k++)
+        if (live[k])
+            pool_free(a->pool, live[k]);
+    return NULL;
+}
+
+static double time_pairs(struct lake_devpool *pool, uint32_t n)
+{
+    uint64_t start, ptr;
+    uint32_t i;
+
+    start = now_ns();
+    for (i = 0; i < n; i++) {
+        lake_devpool_alloc(pool, &ptr, 65536);
+        lake_devpool_free(pool, ptr);
+    }
+    return (double)(now_ns() - start) / n;
+}
+
+int main(int argc, char **argv)
+{
+    struct stress_arg args[64];
+    pthread_t tids[64];
+    struct lake_devpool pool;
+    struct lake_devpool_stats st;
+    int n_threads = 4, opt, i;
+    uint32_t n_ops = 20000;
+    double t_pool, t_direct;
+
+    while ((opt = getopt(argc, argv, "t:n:d:")) != -1) {
+        switch (opt) {
+        case 't': n_threads = atoi(optarg); break;
+        case 'n': n_ops = strtoul(optarg, NULL, 0); break;
+        case 'd': driver_ns = strtoull(optarg, NULL, 0); break;
+        default:
+            fprintf(stderr, "usage: %s [-t threads] [-n ops per thread] [-d driver ns]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (n_threads < 1 || n_threads > 64) {
+        fprintf(stderr, "bad arguments\n");
+        return 1;
+    }
+
+    check_reuse();
+    check_limits();
+
+    lake_devpool_init(&pool, &stub_backend, 256 << 20);
+    for (i = 0; i < n_threads; i++) {
+        args[i].pool = &pool;
+        args[i].n_ops = n_ops;
+        args[i].seed = i + 1;
+        pthread_create(&tids[i], NULL, stress_thread, &args[i]);
+    }
+    for (i = 0; i < n_threads; i++)
+        pthread_join(tids[i], NULL);
+    lake_devpool_get_stats(&pool, &st);
+    printf("stress: %llu allocs, %llu hits, %llu driver allocs, %llu syncs\n",
+            st.allocs, st.hits, st.driver_allocs, st.syncs);
+    CHECK(st.in_use == 0, "%llu bytes in use after the stress test", st.in_use);
+    lake_devpool_trim(&pool);
+    CHECK(dev_bytes == 0, "%lu bytes leaked by the stress test", (unsigned long) dev_bytes);
+
+    if (!driver_ns)
+        driver_ns = 2000;
+    t_pool = time_pairs(&pool, 100000);
+    lake_devpool_trim(&pool);
+    lake_devpool_init(&pool, &stub_backend, 0);
+    t_direct = time_pairs(&pool, 100000 / 10);
+    printf("alloc+free of 64 KB, driver call %lu ns: %.0f ns cached, %.0f ns direct\n",
+            (unsigned long) driver_ns, t_pool, t_direct);
+
+    printf("%s (%lu errors)\n", errors ? "FAILED" : "PASSED", (unsigned long)errors);
+    return errors != 0;
+}
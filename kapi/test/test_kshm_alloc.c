@@ -0,0 +1,296 @@
+/*
+ * Stress test and benchmark for the kava_shm allocator (kshm/kshm_alloc.c),
+ * built against a malloc'd region instead of the DMA one.
+ *
+ * Every thread keeps a window of live buffers, replacing a random one at
+ * each step with a buffer of random size (mostly small, some up to
+ * -l bytes). Buffers are filled with a tag and checked before they are
+ * freed, so overlapping allocations show up as corruption. At the end
+ * everything is freed and every page outside the slabs must be available
+ * to the page allocator again.
+ *
+ * Also checks that a large allocation is not capped by the buddy blocks:
+ * after a small one put a slab at the start of a region, one of almost the
+ * whole region has to succeed.
+ *
+ *   ./test_kshm_alloc [-t threads] [-n ops per thread] [-w window] [-l max large bytes] [-m region MB]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+#include "../kshm/kshm_alloc.h"
+
+struct buf {
+    uint8_t *p;
+    size_t size;
+    uint8_t tag;
+};
+
+static struct kshm_alloc heap;
+static int n_threads = 4;
+static uint32_t n_ops = 200000;
+static uint32_t window = 256;
+static size_t max_large = 128 * 1024;
+static uint64_t errors, alloc_fails;
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static uint64_t xorshift(uint64_t *s)
+{
+    *s ^= *s << 13;
+    *s ^= *s >> 7;
+    *s ^= *s << 17;
+    return *s;
+}
+
+static size_t pick_size(uint64_t *rng)
+{
+    uint64_t r = xorshift(rng);
+
+    // one in 16 is a large buffer
+    if ((r & 15) == 0)
+        return KSHM_MAX_SMALL + 1 + (r >> 8) % (max_large - KSHM_MAX_SMALL);
+    return 1 + (r >> 8) % KSHM_MAX_SMALL;
+}
+
+static int check_buf(struct buf *b)
+{
+    size_t align = b->size <= KSHM_MAX_SMALL ? 64 : KSHM_PAGE_SIZE;
+    size_t i;
+
+    while (align < b->size && b->size <= KSHM_MAX_SMALL)
+        align <<= 1;
+    if ((uintptr_t)((char *)b->p - heap.base) % align) {
+        fprintf(stderr, "buffer of %zu bytes at offset %zu is misaligned\n",
+                b->size, (size_t)((char *)b->p - heap.base));
+        return 1;
+    }
+    for (i = 0; i < b->size; i++) {
+        if (b->p[i] != b->tag) {
+            fprintf(stderr, "buffer of %zu bytes corrupted at byte %zu\n", b->size, i);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void *stress(void *arg)
+{
+    uint64_t rng = 0x9E3779B97F4A7C15ull * ((uintptr_t)arg + 1);
+    struct buf *bufs = calloc(window, sizeof(*bufs));
+    uint64_t errs = 0, fails = 0;
+    struct buf *b;
+    uint32_t i;
+
+    for (i = 0; i < n_ops; i++) {
+        b = &bufs[xorshift(&rng) % window];
+        if (b->p) {
+            errs += check_buf(b);
+            if (kshm_free(&heap, b->p))
+                errs++;
+            b->p = NULL;
+        }
+        b->size = pick_size(&rng);
+        b->p = kshm_alloc(&heap, b->size);
+        if (!b->p) {
+            fails++;
+            continue;
+        }
+        b->tag = (uint8_t)(i | 1);
+        memset(b->p, b->tag, b->size);
+    }
+    for (i = 0; i < window; i++) {
+        if (bufs[i].p) {
+            errs += check_buf(&bufs[i]);
+            if (kshm_free(&heap, bufs[i].p))
+                errs++;
+        }
+    }
+    free(bufs);
+    __atomic_add_fetch(&errors, errs, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&alloc_fails, fails, __ATOMIC_RELAXED);
+    return NULL;
+}
+
+// alloc/free pairs of one size, the steady state of a module's staging buffers
+static double pair_ns(size_t size, uint32_t n)
+{
+    uint64_t start = now_ns();
+    uint32_t i;
+    void *p;
+
+    for (i = 0; i < n; i++) {
+        p = kshm_alloc(&heap, size);
+        if (!p || kshm_free(&heap, p))
+            errors++;
+    }
+    return (double)(now_ns() - start) / n;
+}
+
+// takes the largest free block until none is left, returns the bytes obtained and frees them
+static uint64_t drain_pages(void)
+{
+    struct kshm_alloc_stats st;
+    uint64_t total = 0;
+    void *list = NULL, *p;
+
+    for (;;) {
+        kshm_alloc_get_stats(&heap, &st);
+        if (!st.largest_free)
+            break;
+        p = kshm_alloc(&heap, st.largest_free);
+        if (!p)
+            break;
+        *(void **)p = list;
+        list = p;
+        total += st.largest_free;
+    }
+    while (list) {
+        p = list;
+        list = *(void **)p;
+        if (kshm_free(&heap, p))
+            errors++;
+    }
+    return total;
+}
+
+// a slab at page 0 leaves no free block of more than half the region, but one long free run
+static void check_large_after_small(void)
+{
+    struct kshm_alloc a;
+    struct kshm_alloc_stats st;
+    size_t size = 32 << 20, big;
+    void *region = aligned_alloc(KSHM_PAGE_SIZE, size);
+    void *small, *p;
+
+    if (!region || kshm_alloc_init(&a, region, size, 1)) {
+        printf("out of memory\n");
+        errors++;
+        free(region);
+        return;
+    }
+    small = kshm_alloc(&a, 64);
+    kshm_alloc_get_stats(&a, &st);
+    big = size - st.slab_bytes;
+    if (st.largest_free != big) {
+        printf("largest free %lu after a small allocation, expected %lu\n", (unsigned long)st.largest_free,
+                (unsigned long)big);
+        errors++;
+    }
+    // not a power of two, more than half the region
+    p = kshm_alloc(&a, 24 << 20);
+    if (!p || kshm_free(&a, p)) {
+        printf("24 MB allocation failed in a 32 MB region with one slab\n");
+        errors++;
+    }
+    p = kshm_alloc(&a, big);
+    if (!p || kshm_free(&a, p)) {
+        printf("%lu byte allocation failed with as much free\n", (unsigned long)big);
+        errors++;
+    }
+    if (kshm_alloc(&a, big + KSHM_PAGE_SIZE)) {
+        printf("allocation larger than the free pages succeeded\n");
+        errors++;
+    }
+    kshm_free(&a, small);
+    kshm_alloc_get_stats(&a, &st);
+    if (st.used_bytes != st.slab_bytes || st.largest_free != size - st.slab_bytes) {
+        printf("pages lost after the large allocations\n");
+        errors++;
+    }
+    kshm_alloc_fini(&a);
+    free(region);
+}
+
+int main(int argc, char **argv)
+{
+    struct kshm_alloc_stats st;
+    size_t region_mb = 64;
+    pthread_t *threads;
+    uint64_t start, elapsed;
+    void *region;
+    int opt, i;
+
+    while ((opt = getopt(argc, argv, "t:n:w:l:m:")) != -1) {
+        switch (opt) {
+        case 't': n_threads = atoi(optarg); break;
+        case 'n': n_ops = strtoul(optarg, NULL, 0); break;
+        case 'w': window = strtoul(optarg, NULL, 0); break;
+        case 'l': max_large = strtoul(optarg, NULL, 0); break;
+        case 'm': region_mb = strtoul(optarg, NULL, 0); break;
+        default:
+            fprintf(stderr, "usage: %s [-t threads] [-n ops per thread] [-w window] "
+                    "[-l max large bytes] [-m region MB]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (n_threads < 1 || !window || max_large <= KSHM_MAX_SMALL) {
+        fprintf(stderr, "bad arguments\n");
+        return 1;
+    }
+
+    region = aligned_alloc(KSHM_PAGE_SIZE, region_mb << 20);
+    threads = calloc(n_threads, sizeof(*threads));
+    // the main thread takes the first magazine slot, so the last stress
+    // thread has none and goes through the depot on every call
+    if (!region || !threads || kshm_alloc_init(&heap, region, region_mb << 20, n_threads)) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    check_large_after_small();
+
+    printf("alloc+free pair: 64 B %.1f ns, 2 KB %.1f ns, 64 KB %.1f ns, 1 MB %.1f ns\n",
+            pair_ns(64, 1000000), pair_ns(2048, 1000000),
+            pair_ns(64 << 10, 100000), pair_ns(1 << 20, 100000));
+
+    start = now_ns();
+    for (i = 0; i < n_threads; i++)
+        pthread_create(&threads[i], NULL, stress, (void *)(uintptr_t)i);
+    for (i = 0; i < n_threads; i++)
+        pthread_join(threads[i], NULL);
+    elapsed = now_ns() - start;
+
+    kshm_alloc_get_stats(&heap, &st);
+    printf("%d threads x %u ops in %.3f ms, %.2f Mops/s, %lu failed allocations\n",
+            n_threads, n_ops, elapsed / 1e6, (double)n_threads * n_ops * 1e3 / elapsed,
+            (unsigned long)alloc_fails);
+    printf("region %lu KB, peak %lu KB, slabs %lu KB\n",
+            (unsigned long)(st.total_bytes >> 10), (unsigned long)(st.peak_bytes >> 10),
+            (unsigned long)(st.slab_bytes >> 10));
+
+    if (st.slab_live_bytes) {
+        printf("%lu bytes of small objects still live after freeing everything\n",
+                (unsigned long)st.slab_live_bytes);
+        errors++;
+    }
+    if (st.used_bytes != st.slab_bytes) {
+        printf("%lu bytes in use, expected only the %lu bytes of slabs\n",
+                (unsigned long)st.used_bytes, (unsigned long)st.slab_bytes);
+        errors++;
+    }
+    // every page outside the slabs must be allocatable again, in as few blocks as the slabs allow
+    if (drain_pages() != st.total_bytes - st.slab_bytes) {
+        printf("free pages were lost\n");
+        errors++;
+    }
+    if (kshm_free(&heap, (char *)heap.base + 8) == 0) {
+        printf("free of a bad pointer was accepted\n");
+        errors++;
+    }
+
+    kshm_alloc_fini(&heap);
+    free(region);
+    free(threads);
+    printf("%s (%lu errors)\n", errors ? "FAILED" : "PASSED", (unsigned long)errors);
+    return errors != 0;
+}
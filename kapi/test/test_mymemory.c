@@ -0,0 +1,192 @@
+/*
+ * Microbenchmark for the TLSF allocator in kshm/mymemory.c, built against a
+ * malloc'd heap.
+ *
+ * For each live object count the heap is filled up to that many buffers
+ * (mostly pages, like eCryptfs staging buffers, the rest 16 B to 16 KB),
+ * then a random buffer is freed and replaced at every step. Reports
+ * alloc and free latency percentiles per count; with a first-fit list they
+ * grow with the count, here they should stay flat. Also checks that
+ * buffers do not overlap, that double and bogus frees are refused and that
+ * the heap coalesces back into one chunk.
+ *
+ *   ./test_mymemory [-n replacements per count] [-m heap MB] [-l max live objects]
+ *
+ * Build with -DMYMEMORY_DEBUG to run it with poisoning.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include "../kshm/mymemory.h"
+
+struct buf {
+    uint8_t *p;
+    uint32_t size;
+    uint8_t tag;
+};
+
+static uint64_t errors;
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static uint64_t xorshift(uint64_t *s)
+{
+    *s ^= *s << 13;
+    *s ^= *s >> 7;
+    *s ^= *s << 17;
+    return *s;
+}
+
+static int cmp_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+static uint32_t pick_size(uint64_t *rng)
+{
+    uint64_t r = xorshift(rng);
+
+    if (r % 10 < 7)
+        return 4096;
+    return 16 + (r >> 8) % (16384 - 16);
+}
+
+// fills the first and last bytes, enough to catch overlaps without timing memset
+static void fill(struct buf *b, uint8_t tag)
+{
+    b->tag = tag;
+    b->p[0] = tag;
+    b->p[b->size - 1] = tag;
+}
+
+static void check(struct buf *b)
+{
+    if (b->p[0] != b->tag || b->p[b->size - 1] != b->tag) {
+        fprintf(stderr, "buffer of %u bytes at %p was overwritten\n", b->size, (void *)b->p);
+        errors++;
+    }
+}
+
+static void report(const char *what, uint64_t *lat, uint32_t n)
+{
+    qsort(lat, n, sizeof(*lat), cmp_u64);
+    printf("  %s ns: p50 %lu  p99 %lu  p99.9 %lu  max %lu\n", what,
+           (unsigned long)lat[n / 2], (unsigned long)lat[(uint64_t)n * 99 / 100],
+           (unsigned long)lat[(uint64_t)n * 999 / 1000], (unsigned long)lat[n - 1]);
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t n_ops = 200000, max_live = 16384, live, i, j;
+    uint64_t *alloc_lat, *free_lat, t, rng = 0x9E3779B97F4A7C15ull;
+    size_t heap_mb = 256;
+    struct buf *bufs, *b;
+    void *heap, *p;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:m:l:")) != -1) {
+        switch (opt) {
+        case 'n': n_ops = strtoul(optarg, NULL, 0); break;
+        case 'm': heap_mb = strtoul(optarg, NULL, 0); break;
+        case 'l': max_live = strtoul(optarg, NULL, 0); break;
+        default:
+            fprintf(stderr, "usage: %s [-n replacements per count] [-m heap MB] [-l max live objects]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    heap = aligned_alloc(4096, heap_mb << 20);
+    bufs = calloc(max_live, sizeof(*bufs));
+    alloc_lat = malloc(n_ops * sizeof(*alloc_lat));
+    free_lat = malloc(n_ops * sizeof(*free_lat));
+    if (!heap || !bufs || !alloc_lat || !free_lat || !n_ops) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    mymalloc_init(heap, heap_mb << 20);
+
+    live = 0;
+    for (j = 256; j <= max_live; j *= 4) {
+        for (; live < j; live++) {
+            b = &bufs[live];
+            b->size = pick_size(&rng);
+            b->p = mymalloc(b->size);
+            if (!b->p) {
+                fprintf(stderr, "heap full at %u live objects, use a larger -m\n", live);
+                return 1;
+            }
+            fill(b, (uint8_t)live | 1);
+        }
+
+        for (i = 0; i < n_ops; i++) {
+            b = &bufs[xorshift(&rng) % live];
+            check(b);
+            t = now_ns();
+            if (myfree(b->p))
+                errors++;
+            free_lat[i] = now_ns() - t;
+
+            b->size = pick_size(&rng);
+            t = now_ns();
+            b->p = mymalloc(b->size);
+            alloc_lat[i] = now_ns() - t;
+            if (!b->p) {
+                fprintf(stderr, "allocation of %u bytes failed with %u live objects\n", b->size, live);
+                return 1;
+            }
+            fill(b, (uint8_t)i | 1);
+        }
+        printf("%u live objects:\n", live);
+        report("alloc", alloc_lat, n_ops);
+        report("free ", free_lat, n_ops);
+    }
+
+    for (i = 0; i < live; i++) {
+        check(&bufs[i]);
+        if (myfree(bufs[i].p))
+            errors++;
+    }
+
+    printf("expect three refused frees:\n");
+    fflush(stdout);
+    if (myfree(bufs[0].p) == 0) {
+        printf("double free was accepted\n");
+        errors++;
+    }
+    if (myfree((char *)heap + 8) == 0) {
+        printf("misaligned free was accepted\n");
+        errors++;
+    }
+    if (myfree((char *)heap - 4096) == 0) {
+        printf("free outside the heap was accepted\n");
+        errors++;
+    }
+
+    // everything is free again: one chunk spanning the heap minus two headers.
+    // Lookups round up to the next size class, so ask for the class below.
+    t = (heap_mb << 20) - 2 * STRUCT_SIZE;
+    t &= ~((1ull << (63 - __builtin_clzll(t) - SL_LOG2)) - 1);
+    p = mymalloc(t);
+    if (!p) {
+        printf("heap did not coalesce\n");
+        errors++;
+    } else if (myfree(p)) {
+        errors++;
+    }
+
+    free(heap);
+    free(bufs);
+    free(alloc_lat);
+    free(free_lat);
+    printf("%s (%lu errors)\n", errors ? "FAILED" : "PASSED", (unsigned long)errors);
+    return errors != 0;
+}
@@ -0,0 +1,295 @@
+/*
+ * Cross-node penalty benchmark, for the NUMA placement of kava_shm regions
+ * and lake_uspace workers (include/lake_numa.h).
+ *
+ * For every pair of nodes (memory node, cpu node) a buffer is first-touched
+ * by a thread pinned on the memory node, then a thread pinned on the cpu
+ * node copies it out (what a worker does for a HtoD from shared memory)
+ * and chases pointers through it (dependent loads, one per cacheline).
+ * Prints both as node x node matrices and the penalty of running on the
+ * wrong node, which is what routing a stream to a worker near its buffer
+ * saves.
+ *
+ * Also checks that the sysfs topology is consistent and, when the kernel
+ * has NUMA, that the first touch put the pages on the memory node. On a
+ * single node machine it measures the local case only; boot with
+ * numa=fake=2 (or more) to exercise the cross-node paths.
+ *
+ *   ./test_numa [-m buffer MB] [-n copies per pair]
+ */
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <errno.h>
+#include <sched.h>
+#include <pthread.h>
+#include <sys/syscall.h>
+#include "lake_numa.h"
+
+#define MAX_CPUS 1024
+#define LINE     64
+
+struct job {
+    int cpu;
+    void (*fn)(struct job *);
+    char *buf;
+    double result;
+};
+
+static size_t buf_size = 64 << 20;
+static int n_copies = 8;
+static uint64_t errors;
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static uint64_t xorshift(uint64_t *s)
+{
+    *s ^= *s << 13;
+    *s ^= *s >> 7;
+    *s ^= *s << 17;
+    return *s;
+}
+
+static void *job_thread(void *arg)
+{
+    struct job *j = arg;
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+    CPU_SET(j->cpu, &set);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set)) {
+        fprintf(stderr, "could not pin to cpu %d\n", j->cpu);
+        errors++;
+    }
+    j->fn(j);
+    return NULL;
+}
+
+static void run_on(int cpu, void (*fn)(struct job *), struct job *j)
+{
+    pthread_t t;
+
+    j->cpu = cpu;
+    j->fn = fn;
+    pthread_create(&t, NULL, job_thread, j);
+    pthread_join(t, NULL);
+}
+
+/*
+ * Every cacheline holds the offset of the next one, in a random cycle
+ * through the whole buffer, so the chase defeats the prefetchers.
+ */
+static void first_touch(struct job *j)
+{
+    size_t n = buf_size / LINE, i, k;
+    uint64_t rng = 0x9E3779B97F4A7C15ull, t;
+    uint64_t *perm;
+
+    j->buf = aligned_alloc(4096, buf_size);
+    perm = malloc(n * sizeof(*perm));
+    if (!j->buf || !perm) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+    for (i = 0; i < n; i++)
+        perm[i] = i;
+    for (i = n - 1; i > 0; i--) {
+        k = xorshift(&rng) % (i + 1);
+        t = perm[i];
+        perm[i] = perm[k];
+        perm[k] = t;
+    }
+    memset(j->buf, 0, buf_size);
+    for (i = 0; i < n; i++)
+        *(uint64_t *)(j->buf + perm[i] * LINE) = perm[(i + 1) % n] * LINE;
+    free(perm);
+}
+
+static uint64_t checksum(const char *buf)
+{
+    uint64_t sum = 0;
+    size_t i;
+
+    for (i = 0; i < buf_size; i += LINE)
+        sum += *(const uint64_t *)(buf + i);
+    return sum;
+}
+
+// GB/s
+static void copy_out(struct job *j)
+{
+    char *dst = aligned_alloc(4096, buf_size);
+    uint64_t start;
+    int i;
+
+    if (!dst) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+    memset(dst, 0, buf_size);
+    start = now_ns();
+    for (i = 0; i < n_copies; i++)
+        memcpy(dst, j->buf, buf_size);
+    j->result = (double)buf_size * n_copies / (now_ns() - start);
+    if (checksum(dst) != checksum(j->buf)) {
+        fprintf(stderr, "copy on cpu %d does not match its source\n", j->cpu);
+        errors++;
+    }
+    free(dst);
+}
+
+// ns per dependent load
+static void chase(struct job *j)
+{
+    size_t n = buf_size / LINE, i;
+    volatile uint64_t off = 0;
+    uint64_t start;
+
+    start = now_ns();
+    for (i = 0; i < n; i++)
+        off = *(uint64_t *)(j->buf + off);
+    j->result = (double)(now_ns() - start) / n;
+    if (off != 0) {
+        // a full cycle ends where it started
+        fprintf(stderr, "pointer chase did not close its cycle\n");
+        errors++;
+    }
+}
+
+// node of the page at p, -1 if the kernel cannot tell (no NUMA)
+static int page_node(void *p)
+{
+    int status = -1;
+
+    if (syscall(SYS_move_pages, 0, 1, &p, NULL, &status, 0) < 0)
+        return -1;
+    return status < 0 ? -1 : status;
+}
+
+static int check_placement(char *buf, int node)
+{
+    int i, on_node = 0, known = 0, samples = 64, nd;
+
+    for (i = 0; i < samples; i++) {
+        nd = page_node(buf + (buf_size / samples) * i);
+        if (nd < 0)
+            continue;
+        known++;
+        on_node += nd == node;
+    }
+    if (known && on_node * 2 < known) {
+        printf("only %d of %d sampled pages of a buffer touched on node %d are on it\n",
+                on_node, known, node);
+        return 1;
+    }
+    return 0;
+}
+
+static void print_matrix(const char *title, double *m, int *nodes, int n, const char *fmt)
+{
+    int i, k;
+
+    printf("%s\n  mem\\cpu", title);
+    for (k = 0; k < n; k++)
+        printf("  node %-4d", nodes[k]);
+    printf("\n");
+    for (i = 0; i < n; i++) {
+        printf("  node %-3d", nodes[i]);
+        for (k = 0; k < n; k++)
+            printf(fmt, m[i * n + k]);
+        printf("\n");
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int cpus[MAX_CPUS], nodes[LAKE_NUMA_MAX_NODES], node_cpu[LAKE_NUMA_MAX_NODES];
+    int nnodes, n = 0, node, i, k, c, opt;
+    double *bw, *lat, local, worst_bw, worst_lat;
+    struct job mem, job;
+
+    while ((opt = getopt(argc, argv, "m:n:")) != -1) {
+        switch (opt) {
+        case 'm': buf_size = strtoul(optarg, NULL, 0) << 20; break;
+        case 'n': n_copies = atoi(optarg); break;
+        default:
+            fprintf(stderr, "usage: %s [-m buffer MB] [-n copies per pair]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (!buf_size || n_copies < 1) {
+        fprintf(stderr, "bad arguments\n");
+        return 1;
+    }
+
+    // nodes with cpus, and the sysfs views of them must agree
+    nnodes = lake_numa_nodes();
+    for (node = 0; node < nnodes && node < LAKE_NUMA_MAX_NODES; node++) {
+        c = lake_node_cpus(node, cpus, MAX_CPUS);
+        for (i = 0; i < c; i++) {
+            if (lake_cpu_node(cpus[i]) != node) {
+                printf("cpu %d is listed on node %d but sysfs puts it on node %d\n",
+                        cpus[i], node, lake_cpu_node(cpus[i]));
+                errors++;
+            }
+        }
+        if (!c)
+            continue;
+        nodes[n] = node;
+        node_cpu[n++] = cpus[c - 1];
+    }
+    if (!n) {
+        printf("no cpus found in sysfs\n");
+        return 1;
+    }
+    printf("%d node(s) with cpus out of %d, buffer %zu MB\n", n, nnodes, buf_size >> 20);
+    if (n == 1)
+        printf("single node: only the local case is measured, boot with numa=fake=2 for more\n");
+
+    bw = calloc(n * n, sizeof(*bw));
+    lat = calloc(n * n, sizeof(*lat));
+    for (i = 0; i < n; i++) {
+        run_on(node_cpu[i], first_touch, &mem);
+        errors += check_placement(mem.buf, nodes[i]);
+        for (k = 0; k < n; k++) {
+            job.buf = mem.buf;
+            run_on(node_cpu[k], copy_out, &job);
+            bw[i * n + k] = job.result;
+            run_on(node_cpu[k], chase, &job);
+            lat[i * n + k] = job.result;
+        }
+        free(mem.buf);
+    }
+
+    print_matrix("copy bandwidth GB/s:", bw, nodes, n, "  %9.2f");
+    print_matrix("dependent load latency ns:", lat, nodes, n, "  %9.1f");
+
+    // penalty of the worst remote node against the local one, per memory node
+    for (i = 0; i < n && n > 1; i++) {
+        local = bw[i * n + i];
+        worst_bw = local;
+        worst_lat = lat[i * n + i];
+        for (k = 0; k < n; k++) {
+            if (bw[i * n + k] < worst_bw)
+                worst_bw = bw[i * n + k];
+            if (lat[i * n + k] > worst_lat)
+                worst_lat = lat[i * n + k];
+        }
+        printf("memory on node %d: remote copy %.0f%% slower, remote load %.2fx the latency\n",
+                nodes[i], (local / worst_bw - 1) * 100, worst_lat / lat[i * n + i]);
+    }
+
+    free(bw);
+    free(lat);
+    printf("%s (%lu errors)\n", errors ? "FAILED" : "PASSED", (unsigned long)errors);
+    return errors != 0;
+}
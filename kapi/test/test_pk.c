@@ -0,0 +1,137 @@
+/*
+ * Harness for the persistent kernel mailbox (lake_pk.h).
+ *
+ * Two CPU threads stand in for a two-stage persistent kernel, like the
+ * LinnOS mid/final layer pair: stage 1 squares the inputs, stage 2 sums
+ * them, each hands over through the task value. The main thread posts
+ * batches and waits with lake_pk_wait. Checks every result, that a wait
+ * with nobody serving it times out, and that quit stops both stages.
+ * Reports post-to-done latency.
+ *
+ *   ./test_pk [-n batches] [-d stage delay us]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "lake_pk.h"
+
+#define MAX_BATCH 32
+#define STAGE_2   2
+#define DONE      8
+
+static int32_t task, quit, n;
+static int64_t inputs[MAX_BATCH], mid[MAX_BATCH], result;
+static unsigned int stage_delay_us = 0;
+
+static void *stage_1(void *arg)
+{
+    int r, i;
+
+    while ((r = lake_pk_stage_poll(&task, &quit, LAKE_PK_POSTED)) >= 0) {
+        if (!r) {
+            lake_ring_relax();
+            continue;
+        }
+        for (i = 0; i < n; i++)
+            mid[i] = inputs[i] * inputs[i];
+        if (stage_delay_us)
+            lake_pk_sleep_us(stage_delay_us);
+        lake_pk_stage_finish(&task, STAGE_2);
+    }
+    return NULL;
+}
+
+static void *stage_2(void *arg)
+{
+    int r, i;
+    int64_t sum;
+
+    while ((r = lake_pk_stage_poll(&task, &quit, STAGE_2)) >= 0) {
+        if (!r) {
+            lake_ring_relax();
+            continue;
+        }
+        for (sum = 0, i = 0; i < n; i++)
+            sum += mid[i];
+        result = sum;
+        lake_pk_stage_finish(&task, DONE);
+    }
+    return NULL;
+}
+
+static int cmp_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+int main(int argc, char **argv)
+{
+    struct lake_pk_mailbox mb;
+    pthread_t t1, t2;
+    uint32_t n_batches = 100000, b;
+    uint64_t *lat, start, errors = 0;
+    int64_t expect;
+    int opt, i, bs;
+
+    while ((opt = getopt(argc, argv, "n:d:")) != -1) {
+        switch (opt) {
+        case 'n': n_batches = atoi(optarg); break;
+        case 'd': stage_delay_us = atoi(optarg); break;
+        default:
+            fprintf(stderr, "usage: %s [-n batches] [-d stage delay us]\n", argv[0]);
+            return 1;
+        }
+    }
+    lat = calloc(n_batches, sizeof(*lat));
+    if (!lat)
+        return 1;
+
+    lake_pk_mailbox_init(&mb, &task, &quit, &n, DONE);
+
+    // nothing serves the mailbox yet: the wait must give up
+    lake_pk_post(&mb, 1);
+    if (lake_pk_wait(&mb, 1000 * 1000) != -1) {
+        printf("wait without a device did not time out\n");
+        errors++;
+    }
+    lake_pk_mailbox_init(&mb, &task, &quit, &n, DONE);
+
+    pthread_create(&t1, NULL, stage_1, NULL);
+    pthread_create(&t2, NULL, stage_2, NULL);
+
+    for (b = 0; b < n_batches; b++) {
+        bs = 1 + b % MAX_BATCH;
+        for (expect = 0, i = 0; i < bs; i++) {
+            inputs[i] = (int64_t)b + i;
+            expect += inputs[i] * inputs[i];
+        }
+
+        start = lake_pk_now_ns();
+        lake_pk_post(&mb, bs);
+        if (lake_pk_wait(&mb, 0) != 0 || result != expect) {
+            if (errors++ < 10)
+                printf("batch %u: got %lld expected %lld\n", b, (long long)result, (long long)expect);
+        }
+        lat[b] = lake_pk_now_ns() - start;
+        if (mb.spin_ns < LAKE_PK_SPIN_MIN_NS || mb.spin_ns > LAKE_PK_SPIN_MAX_NS) {
+            printf("spin budget %llu out of bounds\n", (unsigned long long)mb.spin_ns);
+            errors++;
+        }
+    }
+
+    lake_pk_quit(&mb);
+    pthread_join(t1, NULL);
+    pthread_join(t2, NULL);
+
+    qsort(lat, n_batches, sizeof(*lat), cmp_u64);
+    printf("%u batches, latency p50 %.2f us p99 %.2f us, spin budget %.2f us\n", n_batches,
+            lat[n_batches / 2] / 1000.0, lat[(uint64_t)n_batches * 99 / 100] / 1000.0,
+            mb.spin_ns / 1000.0);
+    printf("%s (%lu errors)\n", errors ? "FAILED" : "PASSED", (unsigned long)errors);
+    free(lat);
+    return errors != 0;
+}
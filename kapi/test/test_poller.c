@@ -0,0 +1,273 @@
+/*
+ * Load generator for the spin-then-park policy of the lake_uspace receive
+ * loop (uspace/poller.c), to pick its -s and -f options.
+ *
+ * A producer thread writes timestamps into a pipe with exponentially
+ * distributed gaps (or in bursts), a consumer runs the receive loop of
+ * main.c on it: nonblocking reads, the poller deciding when to stop
+ * polling and park in poll(). For every load it reports the wakeup
+ * latency (stamp to read) and the cpu time the consumer burned, always
+ * parking, always spinning -s us, and adapting.
+ *
+ * Also checks the budget the poller picks for dense and sparse arrivals,
+ * and that no message is lost.
+ *
+ *   ./test_poller [-s max spin us] [-d ms per run]
+ */
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/resource.h>
+#include "lake_ring.h"
+#include "poller.h"
+
+#define MAX_SAMPLES (1 << 20)
+
+static uint64_t errors;
+
+#define CHECK(cond, ...) do {             \
+        if (!(cond)) {                    \
+            printf(__VA_ARGS__);          \
+            printf("\n");                 \
+            errors++;                     \
+        }                                 \
+    } while (0)
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static uint64_t thread_cpu_ns(void)
+{
+    struct rusage ru;
+    getrusage(RUSAGE_THREAD, &ru);
+    return (ru.ru_utime.tv_sec + ru.ru_stime.tv_sec) * 1000000000ull +
+        (ru.ru_utime.tv_usec + ru.ru_stime.tv_usec) * 1000ull;
+}
+
+// drives a poller through arrivals at a fixed gap, returns its last budget
+static uint64_t budget_after(uint64_t spin_max, int adaptive, uint64_t gap)
+{
+    struct lake_poller p;
+    uint64_t t = 1000;
+    int i;
+
+    lake_poller_init(&p, spin_max, adaptive);
+    for (i = 0; i < 8; i++) {
+        lake_poller_idle(&p, t);
+        t += gap;
+        lake_poller_activity(&p, t);
+    }
+    lake_poller_idle(&p, t);
+    return p.budget_ns;
+}
+
+static void check_policy(void)
+{
+    struct lake_poller p;
+
+    lake_poller_init(&p, 0, 1);
+    CHECK(lake_poller_idle(&p, 100) == 1, "spin 0 does not park right away");
+    lake_poller_init(&p, 50000, 1);
+    CHECK(lake_poller_idle(&p, 100) == 0, "parks before spinning");
+    CHECK(lake_poller_idle(&p, 100 + 49999) == 0, "parks before its budget ran out");
+    CHECK(lake_poller_idle(&p, 100 + 50000) == 1, "spins past its budget");
+    CHECK(lake_poller_idle(&p, 200000) == 1, "spins again after a park");
+    lake_poller_activity(&p, 300000);
+    CHECK(p.stats.arrivals == 1 && p.stats.spin_hits == 0 && p.stats.parks == 2,
+            "wrong counters: %lu arrivals %lu hits %lu parks", (unsigned long)p.stats.arrivals,
+            (unsigned long)p.stats.spin_hits, (unsigned long)p.stats.parks);
+
+    CHECK(budget_after(50000, 0, 1000000) == 50000, "fixed spin adapted");
+    CHECK(budget_after(50000, 1, 10000) == 20000, "dense arrivals: budget %lu, expected 20000",
+            (unsigned long)budget_after(50000, 1, 10000));
+    CHECK(budget_after(50000, 1, 1000000) == 50000 / 8, "sparse arrivals: budget %lu, expected %d",
+            (unsigned long)budget_after(50000, 1, 1000000), 50000 / 8);
+    CHECK(budget_after(50000, 1, 100) == 50000 / 8, "back to back arrivals: budget below the minimum");
+    CHECK(budget_after(50000, 1, 40000) == 50000, "budget above spin max");
+}
+
+struct run {
+    int fds[2];
+    uint64_t mean_ns;      // 0: bursts
+    uint64_t duration_ns;
+    uint64_t sent;
+    volatile int done;
+};
+
+static double exp_gap(uint64_t mean, unsigned int *seed)
+{
+    double u = (rand_r(seed) + 1.0) / ((double)RAND_MAX + 2.0);
+    return -log(u) * mean;
+}
+
+static void wait_until(uint64_t t)
+{
+    struct timespec ts;
+    uint64_t now = now_ns();
+
+    if (t > now + 60000) {
+        t -= 50000;
+        ts.tv_sec = t / 1000000000ull;
+        ts.tv_nsec = t % 1000000000ull;
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+    }
+    while (now_ns() < t)
+        lake_ring_relax();
+}
+
+static void *producer(void *arg)
+{
+    struct run *r = (struct run *)arg;
+    uint64_t start = now_ns(), next = start, stamp;
+    unsigned int seed = 1;
+    int i;
+
+    while (next < start + r->duration_ns) {
+        if (r->mean_ns) {
+            next += (uint64_t)exp_gap(r->mean_ns, &seed);
+            wait_until(next);
+            stamp = now_ns();
+            if (write(r->fds[1], &stamp, sizeof(stamp)) != sizeof(stamp))
+                break;
+            r->sent++;
+            continue;
+        }
+        // bursts of 8 commands 5us apart, 2ms apart
+        for (i = 0; i < 8; i++) {
+            wait_until(next);
+            stamp = now_ns();
+            if (write(r->fds[1], &stamp, sizeof(stamp)) != sizeof(stamp))
+                break;
+            r->sent++;
+            next += 5000;
+        }
+        next += 2000000;
+    }
+    r->done = 1;
+    return NULL;
+}
+
+static int cmp_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+static uint64_t *lat;
+
+static void run_load(const char *load, uint64_t mean_ns, uint64_t duration_ns, uint64_t spin_max, int adaptive,
+        const char *mode)
+{
+    struct run r;
+    struct lake_poller p;
+    struct pollfd pfd;
+    pthread_t tid;
+    uint64_t stamps[64], received = 0, cpu, start, wall;
+    ssize_t n;
+    int i;
+
+    memset(&r, 0, sizeof(r));
+    r.mean_ns = mean_ns;
+    r.duration_ns = duration_ns;
+    if (pipe(r.fds)) {
+        perror("pipe");
+        exit(1);
+    }
+    fcntl(r.fds[0], F_SETFL, O_NONBLOCK);
+    lake_poller_init(&p, spin_max, adaptive);
+
+    start = now_ns();
+    cpu = thread_cpu_ns();
+    pthread_create(&tid, NULL, producer, &r);
+    while (!r.done || received < r.sent) {
+        n = read(r.fds[0], stamps, sizeof(stamps));
+        if (n > 0) {
+            uint64_t t = now_ns();
+            for (i = 0; i < n / 8; i++) {
+                if (received < MAX_SAMPLES)
+                    lat[received] = t - stamps[i];
+                received++;
+            }
+            lake_poller_activity(&p, t);
+        } else if (lake_poller_idle(&p, now_ns())) {
+            pfd.fd = r.fds[0];
+            pfd.events = POLLIN;
+            poll(&pfd, 1, 100);
+        } else {
+            lake_ring_relax();
+        }
+    }
+    cpu = thread_cpu_ns() - cpu;
+    wall = now_ns() - start;
+    pthread_join(tid, NULL);
+    close(r.fds[0]);
+    close(r.fds[1]);
+
+    CHECK(received == r.sent, "%s %s: sent %lu, received %lu", load, mode, (unsigned long)r.sent,
+            (unsigned long)received);
+    if (received > MAX_SAMPLES)
+        received = MAX_SAMPLES;
+    qsort(lat, received, sizeof(*lat), cmp_u64);
+    printf("%-10s %-9s %8lu %9.1f %9.1f %9.1f %8.0f%% %7.1f%%\n", load, mode, (unsigned long)received,
+            received ? lat[received / 2] / 1000.0 : 0, received ? lat[received * 99 / 100] / 1000.0 : 0,
+            received ? lat[received - 1] / 1000.0 : 0, 100.0 * cpu / wall,
+            p.stats.arrivals ? 100.0 * p.stats.spin_hits / p.stats.arrivals : 0);
+}
+
+int main(int argc, char **argv)
+{
+    static const struct { const char *name; uint64_t mean_ns; } loads[] = {
+        { "10us", 10000 }, { "40us", 40000 }, { "200us", 200000 }, { "1ms", 1000000 }, { "bursts", 0 },
+    };
+    uint64_t spin_us = 50, duration_ms = 300;
+    unsigned int l;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "s:d:")) != -1) {
+        switch (opt) {
+        case 's': spin_us = strtoul(optarg, NULL, 0); break;
+        case 'd': duration_ms = strtoul(optarg, NULL, 0); break;
+        default:
+            fprintf(stderr, "usage: %s [-s max spin us] [-d ms per run]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (!spin_us || !duration_ms) {
+        fprintf(stderr, "bad arguments\n");
+        return 1;
+    }
+
+    check_policy();
+
+    lat = malloc(MAX_SAMPLES * sizeof(*lat));
+    if (!lat) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    if (sysconf(_SC_NPROCESSORS_ONLN) < 2)
+        printf("one cpu: the spinning consumer starves the producer, timings are not meaningful\n");
+    printf("wakeup latency in us, consumer cpu in %% of a core, spin %lu us\n", (unsigned long)spin_us);
+    printf("%-10s %-9s %8s %9s %9s %9s %9s %8s\n", "gaps", "mode", "msgs", "p50", "p99", "max", "cpu",
+            "caught");
+    for (l = 0; l < sizeof(loads) / sizeof(loads[0]); l++) {
+        run_load(loads[l].name, loads[l].mean_ns, duration_ms * 1000000, 0, 0, "park");
+        run_load(loads[l].name, loads[l].mean_ns, duration_ms * 1000000, spin_us * 1000, 0, "spin");
+        run_load(loads[l].name, loads[l].mean_ns, duration_ms * 1000000, spin_us * 1000, 1, "adaptive");
+    }
+    free(lat);
+
+    printf("%s (%lu errors)\n", errors ? "FAILED" : "PASSED", (unsigned long)errors);
+    return errors != 0;
+}
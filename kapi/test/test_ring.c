@@ -0,0 +1,209 @@
+/*
+ * Loopback harness for the shared memory ring transport (lake_ring.h).
+ *
+ * Drives both ends from userspace: the main thread plays the kernel
+ * submitting commands, a second thread plays the kernel reply poller and
+ * a third one plays lake_uspace. Doorbells are eventfds instead of
+ * netlink messages. Checks that every reply matches its command and
+ * arrives in order, and reports round trip latency.
+ *
+ *   ./test_ring [-n commands] [-i inter-arrival us] [-s spin us]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sys/eventfd.h>
+#include "commands.h"
+#include "lake_ring.h"
+
+static struct lake_ring *cmd_ring, *ret_ring;
+static int worker_efd, rx_efd;
+static uint64_t spin_ns = 50 * 1000;
+static uint32_t n_cmds = 1000000;
+static uint64_t *submit_ts, *lat;
+static volatile int done = 0;
+static uint64_t doorbells_worker, doorbells_rx, errors;
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static void ring_doorbell(int efd)
+{
+    uint64_t one = 1;
+    if (write(efd, &one, sizeof(one)) != sizeof(one))
+        perror("write eventfd");
+}
+
+// spin for spin_ns, then park on the eventfd; same protocol as both real ends
+static void wait_for_work(struct lake_ring *r, int efd, uint64_t *idle_since)
+{
+    struct pollfd pfd = { .fd = efd, .events = POLLIN };
+    uint64_t v;
+
+    if (!*idle_since) {
+        *idle_since = now_ns();
+        return;
+    }
+    if (now_ns() - *idle_since < spin_ns) {
+        lake_ring_relax();
+        return;
+    }
+    if (lake_ring_prepare_sleep(r)) {
+        if (poll(&pfd, 1, 100) > 0 && read(efd, &v, sizeof(v)) < 0)
+            perror("read eventfd");
+    }
+    lake_ring_finish_sleep(r);
+    *idle_since = 0;
+}
+
+// lake_uspace side: answer every cuMemAlloc with bytesize * 3
+static void *worker_thread(void *arg)
+{
+    struct lake_ring_slot *slot;
+    struct lake_cmd_cuMemAlloc *cmd;
+    struct lake_cmd_ret ret;
+    uint32_t seq;
+    uint64_t idle_since = 0;
+
+    while (!done) {
+        slot = lake_ring_peek(cmd_ring);
+        if (!slot) {
+            wait_for_work(cmd_ring, worker_efd, &idle_since);
+            continue;
+        }
+        idle_since = 0;
+        seq = slot->seq;
+        cmd = (struct lake_cmd_cuMemAlloc *)slot->data;
+        memset(&ret, 0, sizeof(ret));
+        ret.res = cmd->API_ID == LAKE_API_cuMemAlloc ? CUDA_SUCCESS : CUDA_ERROR_INVALID_VALUE;
+        ret.ptr = cmd->bytesize * 3;
+        lake_ring_pop(cmd_ring);
+
+        while (lake_ring_push(ret_ring, seq, &ret, sizeof(ret)) == -1)
+            lake_ring_relax();
+        if (lake_ring_need_doorbell(ret_ring)) {
+            doorbells_rx++;
+            ring_doorbell(rx_efd);
+        }
+    }
+    return NULL;
+}
+
+// kernel reply poller side
+static void *rx_thread(void *arg)
+{
+    struct lake_ring_slot *slot;
+    struct lake_cmd_ret *ret;
+    uint32_t expected = 0;
+    uint64_t idle_since = 0;
+
+    while (expected < n_cmds) {
+        slot = lake_ring_peek(ret_ring);
+        if (!slot) {
+            wait_for_work(ret_ring, rx_efd, &idle_since);
+            continue;
+        }
+        idle_since = 0;
+        ret = (struct lake_cmd_ret *)slot->data;
+        if (slot->seq != expected || ret->res != CUDA_SUCCESS ||
+                ret->ptr != (CUdeviceptr)expected * 3) {
+            if (errors++ < 10)
+                fprintf(stderr, "bad reply: seq %u (expected %u) res %d ptr %llu\n",
+                        slot->seq, expected, ret->res, (unsigned long long)ret->ptr);
+        }
+        lat[expected] = now_ns() - submit_ts[expected];
+        lake_ring_pop(ret_ring);
+        expected++;
+    }
+    return NULL;
+}
+
+static int cmp_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+int main(int argc, char **argv)
+{
+    struct lake_cmd_cuMemAlloc cmd;
+    pthread_t worker, rx;
+    uint64_t interval_ns = 0, start, elapsed, next;
+    uint32_t i;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:i:s:")) != -1) {
+        switch (opt) {
+        case 'n': n_cmds = strtoul(optarg, NULL, 0); break;
+        case 'i': interval_ns = strtoull(optarg, NULL, 0) * 1000; break;
+        case 's': spin_ns = strtoull(optarg, NULL, 0) * 1000; break;
+        default:
+            fprintf(stderr, "usage: %s [-n commands] [-i inter-arrival us] [-s spin us]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    cmd_ring = aligned_alloc(LAKE_RING_CACHELINE,
+            lake_ring_bytes(LAKE_RING_CMD_SLOTS, LAKE_RING_CMD_SLOT_SIZE));
+    ret_ring = aligned_alloc(LAKE_RING_CACHELINE,
+            lake_ring_bytes(LAKE_RING_RET_SLOTS, LAKE_RING_RET_SLOT_SIZE));
+    submit_ts = calloc(n_cmds, sizeof(uint64_t));
+    lat = calloc(n_cmds, sizeof(uint64_t));
+    if (!cmd_ring || !ret_ring || !submit_ts || !lat) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    lake_ring_init(cmd_ring, LAKE_RING_CMD_SLOTS, LAKE_RING_CMD_SLOT_SIZE);
+    lake_ring_init(ret_ring, LAKE_RING_RET_SLOTS, LAKE_RING_RET_SLOT_SIZE);
+    worker_efd = eventfd(0, 0);
+    rx_efd = eventfd(0, 0);
+
+    pthread_create(&worker, NULL, worker_thread, NULL);
+    pthread_create(&rx, NULL, rx_thread, NULL);
+
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.API_ID = LAKE_API_cuMemAlloc;
+    start = now_ns();
+    next = start;
+    for (i = 0; i < n_cmds; i++) {
+        if (interval_ns) {
+            while (now_ns() < next)
+                ;
+            next += interval_ns;
+        }
+        cmd.bytesize = i;
+        submit_ts[i] = now_ns();
+        while (lake_ring_push(cmd_ring, i, &cmd, sizeof(cmd)) == -1)
+            lake_ring_relax();
+        if (lake_ring_need_doorbell(cmd_ring)) {
+            doorbells_worker++;
+            ring_doorbell(worker_efd);
+        }
+    }
+
+    pthread_join(rx, NULL);
+    elapsed = now_ns() - start;
+    done = 1;
+    ring_doorbell(worker_efd);
+    pthread_join(worker, NULL);
+
+    qsort(lat, n_cmds, sizeof(uint64_t), cmp_u64);
+    printf("%u commands in %.3f ms, %.2f Mcmd/s\n", n_cmds, elapsed / 1e6,
+            n_cmds / (elapsed / 1e3));
+    printf("round trip ns: p50 %lu  p99 %lu  max %lu\n",
+            (unsigned long)lat[n_cmds / 2], (unsigned long)lat[(uint64_t)n_cmds * 99 / 100],
+            (unsigned long)lat[n_cmds - 1]);
+    printf("doorbells: worker %lu  reply poller %lu\n",
+            (unsigned long)doorbells_worker, (unsigned long)doorbells_rx);
+    printf("%s (%lu bad replies)\n", errors ? "FAILED" : "PASSED", (unsigned long)errors);
+    return errors ? 1 : 0;
+}
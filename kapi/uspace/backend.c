@@ -0,0 +1,260 @@
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "commands.h"
+#include "lake_shm.h"
+#include "lake_kapi.h"
+#include "devpool.h"
+
+/*
+ * Device backends.
+ *
+ * A backend is a handler per LAKE_API_* id: "gpu" (handlers.c) calls the
+ * CUDA and HIP drivers, "cpu" (cpu_backend.c) emulates a device on the
+ * host. lake_uspace runs one of them, picked at start. What does not
+ * depend on the device lives here: command dispatch, batches, batched
+ * function lookups, the device memory pools and what the dispatcher needs
+ * to know about a command.
+ */
+
+struct lake_devpool lake_pools[LAKE_DEVPOOL_NR];
+
+const struct lake_api_info lake_api_info[LAKE_API_NR] = {
+    LAKE_APIS(LAKE_API_INFO)
+};
+
+static const struct lake_backend *backends[] = {
+#ifndef LAKE_CPU_ONLY
+    &lake_gpu_backend,
+#endif
+    &lake_cpu_backend,
+};
+
+static const struct lake_backend *backend;   // set by lake_backend_select before any command
+
+int lake_backend_select(const char *name, size_t pool_bytes) {
+    unsigned int i;
+
+    for (i = 0; i < sizeof(backends) / sizeof(backends[0]); i++) {
+        if (strcmp(name, backends[i]->name) == 0)
+            break;
+    }
+    if (i == sizeof(backends) / sizeof(backends[0])) {
+        printf("Unknown backend %s\n", name);
+        return -1;
+    }
+    backend = backends[i];
+    printf("Using the %s backend\n", backend->name);
+    if (pool_bytes)
+        printf("Caching up to %zu MB of freed device memory per API\n", pool_bytes >> 20);
+    return backend->init(pool_bytes);
+}
+
+void lake_handler_thread_sync_ctx(void) {
+    if (backend->thread_sync)
+        backend->thread_sync();
+}
+
+/*********************
+ *  batch
+ *********************/
+int lake_handler_batch(void* buf, struct lake_cmd_ret* cmd_ret) {
+    struct lake_cmd_batch *cmd = (struct lake_cmd_batch *) buf;
+    struct lake_cmd_batch_entry *entry = (struct lake_cmd_batch_entry *) (cmd + 1);
+    char *end = ((char*) buf) + cmd->size;
+    struct lake_cmd_ret ret;
+    uint32_t i;
+
+    cmd_ret->res = CUDA_SUCCESS;
+    cmd_ret->batch_failed = 0;
+    for (i = 0; i < cmd->n_cmds && i < LAKE_BATCH_MAX_CMDS; i++) {
+        if ((char*)(entry + 1) > end || (char*)(entry + 1) + entry->size > end || *((uint32_t*)(entry + 1)) == LAKE_API_batch) {
+            printf("Malformed batch, dropping commands %u..%u\n", i, cmd->n_cmds);
+            cmd_ret->res = CUDA_ERROR_INVALID_VALUE;
+            break;
+        }
+        lake_handle_cmd(entry + 1, &ret);
+        if (ret.res != CUDA_SUCCESS) {
+            if (!cmd_ret->batch_failed)
+                cmd_ret->res = ret.res;
+            cmd_ret->batch_failed |= 1ull << i;
+        }
+        entry = (struct lake_cmd_batch_entry *) ((char*)(entry + 1) + ((entry->size + 7) & ~7u));
+    }
+    cmd_ret->pPitch = i;
+    return 0;
+}
+
+/*********************
+ *  cu/hipModuleGetFunctions
+ *********************/
+static int lake_module_get_functions(int hip, void* buf, struct lake_cmd_ret* cmd_ret) {
+    // the hip command shares the layout of the cu one
+    struct lake_cmd_cuModuleGetFunctions *cmd = (struct lake_cmd_cuModuleGetFunctions *) buf;
+    void **funcs = (void **) lake_shm_address(cmd->funcs);
+    char *name = cmd->names, *end = ((char*) buf) + cmd->size;
+    CUresult res;
+    uint32_t i;
+
+    cmd_ret->res = CUDA_SUCCESS;
+    cmd_ret->batch_failed = 0;
+    if (!funcs || cmd->n_funcs > LAKE_MODULE_MAX_FUNCS) {
+        cmd_ret->res = CUDA_ERROR_INVALID_VALUE;
+        return 0;
+    }
+    for (i = 0; i < cmd->n_funcs; i++) {
+        if (name >= end || !memchr(name, 0, end - name)) {
+            printf("Malformed function list, dropping names %u..%u\n", i, cmd->n_funcs);
+            res = CUDA_ERROR_INVALID_VALUE;
+        } else {
+            res = backend->get_function(hip, cmd->hmod, name, &funcs[i]);
+            name += strlen(name) + 1;
+        }
+        if (res != CUDA_SUCCESS) {
+            funcs[i] = NULL;
+            if (!cmd_ret->batch_failed)
+                cmd_ret->res = res;
+            cmd_ret->batch_failed |= 1ull << i;
+        }
+    }
+    return 0;
+}
+
+int lake_handler_cuModuleGetFunctions(void* buf, struct lake_cmd_ret* cmd_ret) {
+    return lake_module_get_functions(0, buf, cmd_ret);
+}
+
+int lake_handler_hipModuleGetFunctions(void* buf, struct lake_cmd_ret* cmd_ret) {
+    return lake_module_get_functions(1, buf, cmd_ret);
+}
+
+/*********************
+ *  devpoolStats/devpoolTrim
+ *********************/
+int lake_handler_devpoolStats(void* buf, struct lake_cmd_ret* cmd_ret) {
+    struct lake_cmd_devpoolStats *cmd = (struct lake_cmd_devpoolStats *) buf;
+    struct lake_devpool_stats *stats = (struct lake_devpool_stats *) lake_shm_address(cmd->stats);
+    int i;
+
+    if (!stats) {
+        cmd_ret->res = CUDA_ERROR_INVALID_VALUE;
+        return 0;
+    }
+    for (i = 0; i < LAKE_DEVPOOL_NR; i++)
+        lake_devpool_get_stats(&lake_pools[i], &stats[i]);
+    cmd_ret->res = CUDA_SUCCESS;
+    return 0;
+}
+
+int lake_handler_devpoolTrim(void* buf, struct lake_cmd_ret* cmd_ret) {
+    uint64_t released = 0;
+    int i;
+
+    for (i = 0; i < LAKE_DEVPOOL_NR; i++)
+        released += lake_devpool_trim(&lake_pools[i]);
+    cmd_ret->ptr = released;
+    cmd_ret->res = CUDA_SUCCESS;
+    return 0;
+}
+
+void lake_handle_cmd(void* buf, struct lake_cmd_ret* cmd_ret) {
+    uint32_t cmd_id = *((uint32_t*) buf);
+    if (cmd_id >= backend->n_handlers) {
+        memset(cmd_ret, 0, sizeof(*cmd_ret));
+        cmd_ret->res = CUDA_ERROR_INVALID_VALUE;
+        printf("Command %u is not known to the %s backend\n", cmd_id, backend->name);
+        return;
+    }
+    backend->handlers[cmd_id](buf, cmd_ret);
+    if(cmd_ret->res != 0) {
+        printf("Command %u returned error %d\n", cmd_id, cmd_ret->res);
+    }
+}
+
+/*
+ * Stream a command is ordered on, used by the dispatcher to pick a worker.
+ * NULL means the command is ordered against everything (null stream,
+ * allocations, context/module management, device-wide syncs).
+ */
+static CUstream lake_single_cmd_stream(void* buf) {
+    void *stream;
+    switch (lake_api_order(buf, &stream)) {
+    case LAKE_ORDER_WORK:
+    case LAKE_ORDER_SYNC:
+        return (CUstream) stream;
+    default:
+        return NULL;
+    }
+}
+
+CUstream lake_cmd_stream(void* buf) {
+    struct lake_cmd_batch *batch;
+    struct lake_cmd_batch_entry *entry;
+    CUstream stream = NULL, s;
+    char *end;
+    uint32_t i;
+
+    if (*((uint32_t*) buf) != LAKE_API_batch)
+        return lake_single_cmd_stream(buf);
+
+    //a batch stays on a stream worker only if all its commands use the same stream
+    batch = (struct lake_cmd_batch *) buf;
+    end = ((char*) buf) + batch->size;
+    entry = (struct lake_cmd_batch_entry *) (batch + 1);
+    for (i = 0; i < batch->n_cmds && i < LAKE_BATCH_MAX_CMDS; i++) {
+        if ((char*)(entry + 1) + sizeof(struct lake_cmd_cuLaunchKernel) > end)
+            return NULL;
+        s = lake_single_cmd_stream(entry + 1);
+        if (!s || (stream && s != stream))
+            return NULL;
+        stream = s;
+        entry = (struct lake_cmd_batch_entry *) ((char*)(entry + 1) + ((entry->size + 7) & ~7u));
+    }
+    return stream;
+}
+
+/*
+ * Shared memory offset of the host buffer a stream command copies from or
+ * to, -1 if it has none. For a batch, the first such buffer. The dispatcher
+ * uses it to keep a stream on a worker near its buffers.
+ */
+static int64_t lake_single_cmd_host_offset(void* buf) {
+    uint32_t cmd_id = *((uint32_t*) buf);
+    switch (cmd_id) {
+    case LAKE_API_cuMemcpyHtoDAsync:
+        return (int64_t) ((struct lake_cmd_cuMemcpyHtoDAsync *) buf)->srcHost;
+    case LAKE_API_cuMemcpyDtoHAsync:
+        return (int64_t) ((struct lake_cmd_cuMemcpyDtoHAsync *) buf)->dstHost;
+    case LAKE_API_hipMemcpyHtoDAsync:
+        return (int64_t) ((struct lake_cmd_hipMemcpyHtoDAsync *) buf)->srcHost;
+    case LAKE_API_hipMemcpyDtoHAsync:
+        return (int64_t) ((struct lake_cmd_hipMemcpyDtoHAsync *) buf)->dstHost;
+    default:
+        return -1;
+    }
+}
+
+int64_t lake_cmd_host_offset(void* buf) {
+    struct lake_cmd_batch *batch;
+    struct lake_cmd_batch_entry *entry;
+    int64_t off;
+    char *end;
+    uint32_t i;
+
+    if (*((uint32_t*) buf) != LAKE_API_batch)
+        return lake_single_cmd_host_offset(buf);
+
+    batch = (struct lake_cmd_batch *) buf;
+    end = ((char*) buf) + batch->size;
+    entry = (struct lake_cmd_batch_entry *) (batch + 1);
+    for (i = 0; i < batch->n_cmds && i < LAKE_BATCH_MAX_CMDS; i++) {
+        if ((char*)(entry + 1) + sizeof(struct lake_cmd_cuLaunchKernel) > end)
+            break;
+        off = lake_single_cmd_host_offset(entry + 1);
+        if (off >= 0)
+            return off;
+        entry = (struct lake_cmd_batch_entry *) ((char*)(entry + 1) + ((entry->size + 7) & ~7u));
+    }
+    return -1;
+}
@@ -0,0 +1,325 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "commands.h"
+#include "lake_shm.h"
+#include "lake_kapi.h"
+#include "kargs.h"
+#include "devpool.h"
+#include "cpu_backend.h"
+
+/*
+ * cpu backend: the device is emulated on the host, so lake_kapi and the
+ * kernel modules run without a GPU (tests, CI, development machines).
+ *
+ * Device memory is host memory, a device pointer is its address. Kernels
+ * are the C ports in cpu_kernels.c, found by name, and run when their
+ * launch is handled. Every command is done when its handler returns: the
+ * dispatcher already runs the commands of a stream in order on one worker
+ * and null stream commands after everything received before them, which
+ * is what a device guarantees, so synchronizing has nothing left to wait
+ * for. Contexts, streams and modules are handles that only need to be
+ * distinct.
+ */
+
+// the GPU kernels read a little past their buffers, device allocations
+// are padded and zeroed so the ports read the same thing every time
+#define CPU_MEM_ALIGN 256
+#define CPU_MEM_SLACK 4096
+#define CPU_PITCH     256
+
+static uint64_t cpu_streams;
+static char cpu_ctx, cpu_module;
+
+static int cpu_mem_alloc(uint64_t *ptr, size_t size) {
+    size_t bytes = (size + CPU_MEM_SLACK + CPU_MEM_ALIGN - 1) & ~(size_t)(CPU_MEM_ALIGN - 1);
+    void *mem = aligned_alloc(CPU_MEM_ALIGN, bytes);
+
+    if (!mem)
+        return CUDA_ERROR_OUT_OF_MEMORY;
+    memset(mem, 0, bytes);
+    *ptr = (uint64_t)(uintptr_t) mem;
+    return 0;
+}
+
+static int cpu_mem_free(uint64_t ptr) {
+    free((void *)(uintptr_t) ptr);
+    return 0;
+}
+
+static int cpu_mem_sync(void) {
+    return 0;
+}
+
+static const struct lake_devpool_backend cpu_pool_backend = {
+    "cpu", cpu_mem_alloc, cpu_mem_free, cpu_mem_sync
+};
+
+static int cpu_init(size_t max_cached) {
+    int i;
+    for (i = 0; i < LAKE_DEVPOOL_NR; i++)
+        lake_devpool_init(&lake_pools[i], &cpu_pool_backend, max_cached);
+    return 0;
+}
+
+static CUresult cpu_get_function(int hip, void *module, const char *name, void **func) {
+    const struct lake_cpu_kernel *k;
+
+    if (module != &cpu_module)
+        return CUDA_ERROR_INVALID_HANDLE;
+    k = lake_cpu_kernel_find(name);
+    if (!k) {
+        printf("No cpu port of kernel %s\n", name);
+        return CUDA_ERROR_NOT_FOUND;
+    }
+    kava_parse_function_args(name, get_kargs(k));
+    *func = (void *) k;
+    return CUDA_SUCCESS;
+}
+
+static CUresult cpu_launch(const void *f, unsigned int gridDimX, unsigned int gridDimY, unsigned int gridDimZ,
+        unsigned int blockDimX, unsigned int blockDimY, unsigned int blockDimZ,
+        unsigned int sharedMemBytes, uint8_t *serialized) {
+    const struct lake_cpu_kernel *k = (const struct lake_cpu_kernel *) f;
+    struct lake_cpu_launch launch = {
+        { gridDimX, gridDimY, gridDimZ }, { blockDimX, blockDimY, blockDimZ }, sharedMemBytes
+    };
+    void* args[KARGS_MAX_ARGS];
+
+    if (!k)
+        return CUDA_ERROR_INVALID_HANDLE;
+    construct_args(get_kargs(k), args, serialized);
+    k->fn(&launch, args);
+    return CUDA_SUCCESS;
+}
+
+static CUresult cpu_copy(void *dst, const void *src, size_t count) {
+    if (!dst || !src)
+        return CUDA_ERROR_INVALID_VALUE;
+    memcpy(dst, src, count);
+    return CUDA_SUCCESS;
+}
+
+static int cpu_handler_success(void* buf, struct lake_cmd_ret* cmd_ret) {
+    cmd_ret->res = CUDA_SUCCESS;
+    return 0;
+}
+
+/*********************
+ *  init, devices and contexts
+ *********************/
+static int cpu_handler_DeviceGet(void* buf, struct lake_cmd_ret* cmd_ret) {
+    struct lake_cmd_cuDeviceGet *cmd = (struct lake_cmd_cuDeviceGet *) buf;
+    cmd_ret->device = 0;
+    cmd_ret->res = cmd->ordinal == 0 ? CUDA_SUCCESS : CUDA_ERROR_INVALID_DEVICE;
+    return 0;
+}
+
+static int cpu_handler_CtxCreate(void* buf, struct lake_cmd_ret* cmd_ret) {
+    cmd_ret->pctx = (CUcontext) &cpu_ctx;
+    cmd_ret->res = CUDA_SUCCESS;
+    return 0;
+}
+
+// memory does not go away with the context here, give back what is cached
+static int cpu_handler_cuCtxDestroy(void* buf, struct lake_cmd_ret* cmd_ret) {
+    lake_devpool_trim(&lake_pools[LAKE_DEVPOOL_CU]);
+    cmd_ret->res = CUDA_SUCCESS;
+    return 0;
+}
+
+static int cpu_handler_hipCtxDestroy(void* buf, struct lake_cmd_ret* cmd_ret) {
+    lake_devpool_trim(&lake_pools[LAKE_DEVPOOL_HIP]);
+    cmd_ret->res = CUDA_SUCCESS;
+    return 0;
+}
+
+/*********************
+ *  modules and launches
+ *********************/
+static int cpu_handler_ModuleLoad(void* buf, struct lake_cmd_ret* cmd_ret) {
+    cmd_ret->module = (CUmodule) &cpu_module;
+    cmd_ret->res = CUDA_SUCCESS;
+    return 0;
+}
+
+static int cpu_handler_cuModuleGetFunction(void* buf, struct lake_cmd_ret* cmd_ret) {
+    struct lake_cmd_cuModuleGetFunction *cmd = (struct lake_cmd_cuModuleGetFunction *) buf;
+    cmd_ret->res = cpu_get_function(0, cmd->hmod, cmd->name, (void**) &cmd_ret->func);
+    return 0;
+}
+
+static int cpu_handler_hipModuleGetFunction(void* buf, struct lake_cmd_ret* cmd_ret) {
+    struct lake_cmd_hipModuleGetFunction *cmd = (struct lake_cmd_hipModuleGetFunction *) buf;
+    cmd_ret->res = cpu_get_function(1, cmd->hmod, cmd->name, (void**) &cmd_ret->func);
+    return 0;
+}
+
+static int cpu_handler_cuLaunchKernel(void* buf, struct lake_cmd_ret* cmd_ret) {
+    struct lake_cmd_cuLaunchKernel *cmd = (struct lake_cmd_cuLaunchKernel *) buf;
+    cmd_ret->res = cpu_launch(cmd->f, cmd->gridDimX, cmd->gridDimY, cmd->gridDimZ,
+        cmd->blockDimX, cmd->blockDimY, cmd->blockDimZ, cmd->sharedMemBytes, (uint8_t *) (cmd + 1));
+    return 0;
+}
+
+static int cpu_handler_hipModuleLaunchKernel(void* buf, struct lake_cmd_ret* cmd_ret) {
+    struct lake_cmd_hipModuleLaunchKernel *cmd = (struct lake_cmd_hipModuleLaunchKernel *) buf;
+    cmd_ret->res = cpu_launch(cmd->f, cmd->gridDimX, cmd->gridDimY, cmd->gridDimZ,
+        cmd->blockDimX, cmd->blockDimY, cmd->blockDimZ, cmd->sharedMemBytes, (uint8_t *) (cmd + 1));
+    return 0;
+}
+
+/*********************
+ *  memory
+ *********************/
+static int cpu_handler_cuMemAlloc(void* buf, struct lake_cmd_ret* cmd_ret) {
+    struct lake_cmd_cuMemAlloc *cmd = (struct lake_cmd_cuMemAlloc *) buf;
+    cmd_ret->res = (CUresult) lake_devpool_alloc(&lake_pools[LAKE_DEVPOOL_CU], (uint64_t *) &cmd_ret->ptr, cmd->bytesize);
+    return 0;
+}
+
+static int cpu_handler_cuMemFree(void* buf, struct lake_cmd_ret* cmd_ret) {
+    struct lake_cmd_cuMemFree *cmd = (struct lake_cmd_cuMemFree *) buf;
+    cmd_ret->res = (CUresult) lake_devpool_free(&lake_pools[LAKE_DEVPOOL_CU], cmd->dptr);
+    return 0;
+}
+
+static int cpu_handler_hipMalloc(void* buf, struct lake_cmd_ret* cmd_ret) {
+    struct lake_cmd_hipMalloc *cmd = (struct lake_cmd_hipMalloc *) buf;
+    cmd_ret->res = (CUresult) lake_devpool_alloc(&lake_pools[LAKE_DEVPOOL_HIP], (uint64_t *) &cmd_ret->ptr, cmd->bytesize);
+    return 0;
+}
+
+static int cpu_handler_hipFree(void* buf, struct lake_cmd_ret* cmd_ret) {
+    struct lake_cmd_hipFree *cmd = (struct lake_cmd_hipFree *) buf;
+    cmd_ret->res = (CUresult) lake_devpool_free(&lake_pools[LAKE_DEVPOOL_HIP], (uint64_t) cmd->dptr);
+    return 0;
+}
+
+// not pooled, like on the gpu backend: the pool frees it when it comes back
+static int cpu_handler_cuMemAllocPitch(void* buf, struct lake_cmd_ret* cmd_ret) {
+    struct lake_cmd_cuMemAllocPitch *cmd = (struct lake_cmd_cuMemAllocPitch *) buf;
+    cmd_ret->pPitch = (cmd->WidthInBytes + CPU_PITCH - 1) & ~(size_t)(CPU_PITCH - 1);
+    cmd_ret->res = (CUresult) cpu_mem_alloc((uint64_t *) &cmd_ret->ptr, cmd_ret->pPitch * cmd->Height);
+    return 0;
+}
+
+static int cpu_handler_cuMemcpyHtoD(void* buf, struct lake_cmd_ret* cmd_ret) {
+    struct lake_cmd_cuMemcpyHtoD *cmd = (struct lake_cmd_cuMemcpyHtoD *) buf;
+    cmd_ret->res = cpu_copy((void *)(uintptr_t) cmd->dstDevice, lake_shm_address(cmd->srcHost), cmd->ByteCount);
+    return 0;
+}
+
+static int cpu_handler_cuMemcpyDtoH(void* buf, struct lake_cmd_ret* cmd_ret) {
+    struct lake_cmd_cuMemcpyDtoH *cmd = (struct lake_cmd_cuMemcpyDtoH *) buf;
+    cmd_ret->res = cpu_copy(lake_shm_address(cmd->dstHost), (void *)(uintptr_t) cmd->srcDevice, cmd->ByteCount);
+    return 0;
+}
+
+static int cpu_handler_cuMemcpyHtoDAsync(void* buf, struct lake_cmd_ret* cmd_ret) {
+    struct lake_cmd_cuMemcpyHtoDAsync *cmd = (struct lake_cmd_cuMemcpyHtoDAsync *) buf;
+    cmd_ret->res = cpu_copy((void *)(uintptr_t) cmd->dstDevice, lake_shm_address(cmd->srcHost), cmd->ByteCount);
+    return 0;
+}
+
+static int cpu_handler_cuMemcpyDtoHAsync(void* buf, struct lake_cmd_ret* cmd_ret) {
+    struct lake_cmd_cuMemcpyDtoHAsync *cmd = (struct lake_cmd_cuMemcpyDtoHAsync *) buf;
+    cmd_ret->res = cpu_copy(lake_shm_address(cmd->dstHost), (void *)(uintptr_t) cmd->srcDevice, cmd->ByteCount);
+    return 0;
+}
+
+static int cpu_handler_hipMemcpyHtoD(void* buf, struct lake_cmd_ret* cmd_ret) {
+    struct lake_cmd_hipMemcpyHtoD *cmd = (struct lake_cmd_hipMemcpyHtoD *) buf;
+    cmd_ret->res = cpu_copy((void *)(uintptr_t) cmd->dstDevice, lake_shm_address(cmd->srcHost), cmd->ByteCount);
+    return 0;
+}
+
+static int cpu_handler_hipMemcpyDtoH(void* buf, struct lake_cmd_ret* cmd_ret) {
+    struct lake_cmd_hipMemcpyDtoH *cmd = (struct lake_cmd_hipMemcpyDtoH *) buf;
+    cmd_ret->res = cpu_copy(lake_shm_address(cmd->dstHost), (void *)(uintptr_t) cmd->srcDevice, cmd->ByteCount);
+    return 0;
+}
+
+static int cpu_handler_hipMemcpyHtoDAsync(void* buf, struct lake_cmd_ret* cmd_ret) {
+    struct lake_cmd_hipMemcpyHtoDAsync *cmd = (struct lake_cmd_hipMemcpyHtoDAsync *) buf;
+    cmd_ret->res = cpu_copy((void *)(uintptr_t) cmd->dstDevice, lake_shm_address(cmd->srcHost), cmd->ByteCount);
+    return 0;
+}
+
+static int cpu_handler_hipMemcpyDtoHAsync(void* buf, struct lake_cmd_ret* cmd_ret) {
+    struct lake_cmd_hipMemcpyDtoHAsync *cmd = (struct lake_cmd_hipMemcpyDtoHAsync *) buf;
+    cmd_ret->res = cpu_copy(lake_shm_address(cmd->dstHost), (void *)(uintptr_t) cmd->srcDevice, cmd->ByteCount);
+    return 0;
+}
+
+// shared memory is host memory the device can use as is
+static int cpu_handler_hipHostGetDevicePointer(void* buf, struct lake_cmd_ret* cmd_ret) {
+    struct lake_cmd_hipHostGetDevicePointer *cmd = (struct lake_cmd_hipHostGetDevicePointer *) buf;
+    void *host = lake_shm_address(cmd->hstPtr);
+    cmd_ret->ptr = (CUdeviceptr)(uintptr_t) host;
+    cmd_ret->res = host ? CUDA_SUCCESS : CUDA_ERROR_INVALID_VALUE;
+    return 0;
+}
+
+/*********************
+ *  streams
+ *********************/
+static int cpu_handler_StreamCreate(void* buf, struct lake_cmd_ret* cmd_ret) {
+    uint64_t id = __atomic_add_fetch(&cpu_streams, 1, __ATOMIC_RELAXED);
+    // the dispatcher hashes streams without their low bits
+    cmd_ret->stream = (CUstream)(uintptr_t) (id << 4);
+    cmd_ret->res = CUDA_SUCCESS;
+    return 0;
+}
+
+static int cpu_handler_nvml(void* buf, struct lake_cmd_ret* cmd_ret) {
+    cmd_ret->ptr = 0;
+    cmd_ret->res = CUDA_SUCCESS;
+    return 0;
+}
+
+//order matters, need to match enum in src/kapi/include/commands.h
+// commands served by a handler shared with others, or by backend.c
+#define cpu_handler_cuInit                  cpu_handler_success
+#define cpu_handler_cuDeviceGet             cpu_handler_DeviceGet
+#define cpu_handler_cuCtxCreate             cpu_handler_CtxCreate
+#define cpu_handler_cuModuleLoad            cpu_handler_ModuleLoad
+#define cpu_handler_cuModuleUnload          cpu_handler_success
+#define cpu_handler_cuCtxSynchronize        cpu_handler_success
+#define cpu_handler_cuStreamCreate          cpu_handler_StreamCreate
+#define cpu_handler_cuStreamSynchronize     cpu_handler_success
+#define cpu_handler_cuStreamDestroy         cpu_handler_success
+#define cpu_handler_kleioLoadModel          cpu_handler_success
+#define cpu_handler_kleioInference          cpu_handler_success
+#define cpu_handler_kleioForceGC            cpu_handler_success
+#define cpu_handler_nvmlRunningProcs        cpu_handler_nvml
+#define cpu_handler_nvmlUtilRate            cpu_handler_nvml
+#define cpu_handler_hipInit                 cpu_handler_success
+#define cpu_handler_hipDeviceGet            cpu_handler_DeviceGet
+#define cpu_handler_hipHostMalloc           cpu_handler_success
+#define cpu_handler_hipHostFree             cpu_handler_success
+#define cpu_handler_hipHostRegister         cpu_handler_success
+#define cpu_handler_hipHostUnregister       cpu_handler_success
+#define cpu_handler_hipCtxCreate            cpu_handler_CtxCreate
+#define cpu_handler_hipDeviceSynchronize    cpu_handler_success
+#define cpu_handler_hipModuleLoad           cpu_handler_ModuleLoad
+#define cpu_handler_hipStreamCreate         cpu_handler_StreamCreate
+#define cpu_handler_hipStreamSynchronize    cpu_handler_success
+#define cpu_handler_hipStreamDestroy        cpu_handler_success
+#define cpu_handler_batch                   lake_handler_batch
+#define cpu_handler_cuModuleGetFunctions    lake_handler_cuModuleGetFunctions
+#define cpu_handler_hipModuleGetFunctions   lake_handler_hipModuleGetFunctions
+#define cpu_handler_devpoolStats            lake_handler_devpoolStats
+#define cpu_handler_devpoolTrim             lake_handler_devpoolTrim
+
+// cpu_handler_<name> for every command of LAKE_APIS, in id order
+#define CPU_HANDLER(name, policy, order, fields) cpu_handler_##name,
+static const lake_handler_fn cpu_handlers[LAKE_API_NR] = {
+    LAKE_APIS(CPU_HANDLER)
+};
+
+const struct lake_backend lake_cpu_backend = {
+    "cpu", cpu_handlers, LAKE_API_NR,
+    cpu_init, NULL, cpu_get_function
+};
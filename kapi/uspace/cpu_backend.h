@@ -0,0 +1,29 @@
+#ifndef __LAKE_USPACE_CPU_BACKEND_H__
+#define __LAKE_USPACE_CPU_BACKEND_H__
+
+#include <stdint.h>
+
+/*
+ * Kernels of the cpu backend (cpu_kernels.c): C ports of the GPU kernels
+ * the kernel modules load, found by the mangled name the modules ask for.
+ * A kernel gets the launch geometry and the argument pointers the driver
+ * would get, and runs every block and thread of the grid in turn; work
+ * after a __syncthreads() starts once every thread of the block (or grid,
+ * where the GPU code relies on that) finished the work before it.
+ */
+struct lake_cpu_launch {
+    unsigned int grid[3];
+    unsigned int block[3];
+    unsigned int shared_bytes;
+};
+
+typedef void (*lake_cpu_kernel_fn)(const struct lake_cpu_launch *launch, void **args);
+
+struct lake_cpu_kernel {
+    const char *name;
+    lake_cpu_kernel_fn fn;
+};
+
+const struct lake_cpu_kernel *lake_cpu_kernel_find(const char *name);
+
+#endif
@@ -0,0 +1,612 @@
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+#include "cpu_backend.h"
+
+/*
+ * CPU ports of the LinnOS, KML, MLLB and AES-GCM kernels, for the cpu
+ * backend. They follow the GPU code statement by statement, indexing
+ * quirks included, so a module gets the same results from either
+ * backend. Only x dimensions are used, like the kernels do.
+ *
+ * Persistent kernels (they loop on flags until told to quit) are not
+ * ported: modules only start them on the gpu backend.
+ */
+
+#define ARG(i, type) (*(type *) args[i])
+
+#define FOR_BLOCKS(l, b)  for (b = 0; b < (l)->grid[0]; b++)
+#define FOR_THREADS(l, t) for (t = 0; t < (l)->block[0]; t++)
+
+/*********************
+ *  LinnOS (linnos_mix/kernels.cpp)
+ *********************/
+#define LINNOS_LEN_INPUT   31
+#define LINNOS_LEN_LAYER_0 256
+
+static void prediction_mid_layer_batch(const struct lake_cpu_launch *l, void **args) {
+    long *weight_0_T = ARG(0, long *), *bias_0 = ARG(1, long *);
+    long *input_vec = ARG(2, long *), *mid_res = ARG(3, long *);
+    int stride = l->block[0], j, k, offset;
+    unsigned int b, t;
+    long acc;
+
+    FOR_BLOCKS(l, b) {
+        FOR_THREADS(l, t) {
+            for (j = t, offset = t * LINNOS_LEN_INPUT; j < LINNOS_LEN_LAYER_0;
+                    j += stride, offset += LINNOS_LEN_INPUT * stride) {
+                acc = 0;
+                for (k = 0; k < LINNOS_LEN_INPUT; k++)
+                    acc += input_vec[b * LINNOS_LEN_INPUT + k] * weight_0_T[offset + k];
+                acc += bias_0[t];
+                mid_res[b * stride + j] = acc < 0 ? 0 : acc;
+            }
+        }
+    }
+}
+
+// prediction_mid_layer_1_batch and prediction_mid_layer_2_batch
+static void prediction_mid_layer_n_batch(const struct lake_cpu_launch *l, void **args) {
+    long *weight = ARG(0, long *), *bias = ARG(1, long *);
+    long *in = ARG(2, long *), *out = ARG(3, long *);
+    int stride = l->block[0], j, k, offset;
+    unsigned int b, t;
+    long acc;
+
+    FOR_BLOCKS(l, b) {
+        FOR_THREADS(l, t) {
+            for (j = t, offset = t * 256; j < LINNOS_LEN_LAYER_0; j += stride, offset += 256 * stride) {
+                acc = 0;
+                for (k = 0; k < 256; k++)
+                    acc += weight[offset + k] * in[b * 256 + k];
+                acc += bias[t];
+                out[b * stride + j] = acc < 0 ? 0 : acc;
+            }
+        }
+    }
+}
+
+static void prediction_final_layer_batch(const struct lake_cpu_launch *l, void **args) {
+    long *weight_1_T = ARG(0, long *), *bias_1 = ARG(1, long *);
+    long *mid_res = ARG(2, long *), *final_res = ARG(3, long *);
+    unsigned int b, t, dim = l->block[0];
+    long *res;
+    int k, i;
+
+    FOR_BLOCKS(l, b) {
+        res = final_res + b * dim;
+        FOR_THREADS(l, t) {
+            res[t] = 0;
+            if (t < 32) {
+                for (k = t; k < LINNOS_LEN_LAYER_0; k += 32)
+                    res[t] += mid_res[b * LINNOS_LEN_LAYER_0 + k] * weight_1_T[k];
+            } else {
+                for (k = t - 32; k < LINNOS_LEN_LAYER_0; k += 32)
+                    res[t] += mid_res[b * LINNOS_LEN_LAYER_0 + k] * weight_1_T[k + 256];
+            }
+        }
+        // __syncthreads(), then threads 0 and 32 reduce
+        for (i = 1; i < 32; i++)
+            res[0] += res[i];
+        res[0] += bias_1[0];
+        if (dim > 32) {
+            for (i = 1; i < 32; i++)
+                res[32] += res[32 + i];
+            res[32] += bias_1[1];
+        }
+    }
+}
+
+/*********************
+ *  KML (kml_mix/kernels.cpp)
+ *********************/
+
+/*
+ * The kernels read a long long out of a float for the first guess of
+ * their inverse square root; only the low half of the result is kept, so
+ * only the lowest bit of the upper half (past the float) matters. It is
+ * taken as 0, the Newton steps make the difference vanish anyway.
+ */
+static float kml_sqrt(float x) {
+    uint32_t bits, lo;
+    long long i;
+    float r;
+    int n;
+
+    memcpy(&bits, &x, sizeof(bits));
+    i = (long long) bits;
+    i = 0x5fe6eb50c7b537a9 - (i >> 1);
+    lo = (uint32_t) i;
+    memcpy(&r, &lo, sizeof(r));
+    for (n = 0; n < 5; n++)
+        r = r * (1.5f - 0.5f * x * r * r);
+    return r * x;
+}
+
+// the whole grid finishes the statistics before any thread normalizes
+static void normalize_fused(const struct lake_cpu_launch *l, void **args) {
+    int batch_size = ARG(0, int);
+    float *inputs = ARG(1, float *), *avg_base = ARG(2, float *), *avg_out = ARG(3, float *);
+    float *last_values = ARG(4, float *), *var_out = ARG(5, float *), *final_out = ARG(6, float *);
+    const int MAX = 5 * batch_size, k1 = 10, k2 = 9;
+    unsigned int b, t;
+    int uid, idx, j, base_idx;
+    float sum;
+
+    FOR_BLOCKS(l, b) {
+        FOR_THREADS(l, t) {
+            uid = b * l->block[0] + t;
+            if (uid < 5) {
+                sum = 0;
+                for (j = 0; j < batch_size; j++)
+                    sum += inputs[j * 5 + t];
+                avg_out[uid] = avg_base[uid] * k1 / (k2 + batch_size) + sum / (k2 + batch_size);
+            }
+            if (uid > 15 && uid <= 20) {
+                idx = uid - 16;
+                sum = 0;
+                for (j = 0; j < batch_size; j++)
+                    sum += (last_values[idx] - inputs[j * 5 + idx]) * (last_values[idx] - inputs[j * 5 + idx]);
+                var_out[idx] = avg_base[idx] * k1 / (k2 + batch_size) + sum / (k2 + batch_size);
+                var_out[idx] = kml_sqrt(var_out[idx]);
+            }
+        }
+    }
+    FOR_BLOCKS(l, b) {
+        FOR_THREADS(l, t) {
+            uid = b * l->block[0] + t;
+            base_idx = b * 32 + t % 5;
+            if (uid < MAX)
+                final_out[base_idx] = (inputs[base_idx] - avg_out[t % 5]) / var_out[t % 5];
+        }
+    }
+}
+
+static void fused_forward(const struct lake_cpu_launch *l, void **args) {
+    float *input = ARG(0, float *);
+    int *result = ARG(1, int *);
+    float *d_b0 = ARG(4, float *), *wt0 = ARG(5, float *);
+    float *d_b1 = ARG(7, float *), *wt1 = ARG(8, float *);
+    float *d_b2 = ARG(10, float *);
+    float *d_out0 = ARG(12, float *), *d_out1 = ARG(13, float *), *d_out2 = ARG(14, float *);
+    float *my_row, *my_out, acc;
+    unsigned int b, t;
+    int i, idx;
+
+    FOR_BLOCKS(l, b) {
+        my_row = input + b * 5;
+        my_out = d_out0 + b * 15;
+        FOR_THREADS(l, t) {
+            if (t < 15) {
+                acc = 0;
+                for (i = 0; i < 5; i++)
+                    acc += my_row[i] * wt0[i * 5 + t];
+                my_out[t] = acc + d_b0[t];
+            }
+        }
+        my_row = d_out0 + b * 15;
+        my_out = d_out1 + b * 5;
+        FOR_THREADS(l, t) {
+            if (t < 5) {
+                acc = 0;
+                for (i = 0; i < 15; i++)
+                    acc += my_row[i] * wt1[i * 15 + t];
+                my_out[t] = acc + d_b1[t];
+            }
+        }
+        // the GPU code uses wt1 and 15 inputs here too
+        my_row = d_out1 + b * 5;
+        my_out = d_out2 + b * 4;
+        FOR_THREADS(l, t) {
+            if (t < 4) {
+                acc = 0;
+                for (i = 0; i < 15; i++)
+                    acc += my_row[i] * wt1[i * 15 + t];
+                my_out[t] = acc + d_b2[t];
+            }
+        }
+        my_row = d_out2 + b * 4;
+        idx = 0;
+        for (i = 1; i < 3; i++) {
+            if (my_row[i] > my_row[idx])
+                idx = i;
+        }
+        result[b] = idx;
+    }
+}
+
+/*********************
+ *  MLLB (mllb_mix/kernels.cpp, kernels.cu)
+ *********************/
+static void mllb_infer_v2(const struct lake_cpu_launch *l, void **args) {
+    float *inputs = ARG(0, float *), *w1 = ARG(1, float *), *b1 = ARG(2, float *);
+    float *w2 = ARG(3, float *), b2 = ARG(4, float), *results = ARG(5, float *);
+    float hidden[10], acc, output, *input;
+    unsigned int b, t, tid;
+    int i, j;
+
+    FOR_BLOCKS(l, b) {
+        FOR_THREADS(l, t) {
+            tid = b * l->block[0] + t;
+            if (tid >= 65536)
+                continue;
+            input = inputs + tid * 15;
+            for (j = 0; j < 10; j++) {
+                acc = 0;
+                for (i = 0; i < 15; i++)
+                    acc += input[i] * w1[i * 10 + j];
+                hidden[j] = acc + b1[j];
+                hidden[j] = hidden[j] > 0 ? hidden[j] : 0;
+            }
+            output = 0;
+            for (j = 0; j < 10; j++)
+                output += hidden[j] * w2[j];
+            results[tid] = output + b2;
+        }
+    }
+}
+
+// shared memory the GPU code reads without writing it is zero here
+static void mllb_infer_v2_cuda(const struct lake_cpu_launch *l, void **args) {
+    float *inputs = ARG(0, float *), *w1 = ARG(1, float *), *b1 = ARG(2, float *);
+    float *w2 = ARG(3, float *), b2 = ARG(4, float), *results = ARG(5, float *);
+    unsigned int b, t, inputs_per_block = l->block[0] / 16;
+    float sm[10 * 8], acc, res, *input;
+    int i;
+
+    FOR_BLOCKS(l, b) {
+        memset(sm, 0, sizeof(sm));
+        FOR_THREADS(l, t) {
+            if (t < 10) {
+                input = inputs + b * inputs_per_block + t % 16;
+                acc = 0;
+                for (i = 0; i < 15; i++)
+                    acc += input[i] * w1[i * 15 + t];
+                acc += b1[t];
+                sm[t % 16 + t] = acc > 0 ? acc : 0;
+            }
+        }
+        res = 0;
+        for (i = 0; i < 10; i++)
+            res += sm[i] * w2[i];
+        results[b * inputs_per_block] = res + b2;
+    }
+}
+
+/*********************
+ *  AES-GCM (ecryptfs/crypto/gcm_kernels.cpp), AES-256
+ *********************/
+#define AES_Nb 4
+#define AES_Nk 8
+#define AES_Nr 14
+#define AES_BLOCKLEN 16
+#define AES_GCM_STEP 64
+
+typedef uint8_t aes_state_t[4][4];
+
+static void aes_key_expansion(uint8_t *sbox, uint8_t *Rcon, uint8_t *RoundKey, uint8_t *Key) {
+    unsigned int i, j, k;
+    uint8_t tempa[4], u8tmp;
+
+    for (i = 0; i < AES_Nk * 4; i++)
+        RoundKey[i] = Key[i];
+    for (i = AES_Nk; i < AES_Nb * (AES_Nr + 1); ++i) {
+        k = (i - 1) * 4;
+        tempa[0] = RoundKey[k + 0];
+        tempa[1] = RoundKey[k + 1];
+        tempa[2] = RoundKey[k + 2];
+        tempa[3] = RoundKey[k + 3];
+        if (i % AES_Nk == 0) {
+            u8tmp = tempa[0];
+            tempa[0] = tempa[1];
+            tempa[1] = tempa[2];
+            tempa[2] = tempa[3];
+            tempa[3] = u8tmp;
+            for (j = 0; j < 4; j++)
+                tempa[j] = sbox[tempa[j]];
+            tempa[0] = tempa[0] ^ Rcon[i / AES_Nk];
+        }
+        if (i % AES_Nk == 4) {
+            for (j = 0; j < 4; j++)
+                tempa[j] = sbox[tempa[j]];
+        }
+        j = i * 4;
+        k = (i - AES_Nk) * 4;
+        RoundKey[j + 0] = RoundKey[k + 0] ^ tempa[0];
+        RoundKey[j + 1] = RoundKey[k + 1] ^ tempa[1];
+        RoundKey[j + 2] = RoundKey[k + 2] ^ tempa[2];
+        RoundKey[j + 3] = RoundKey[k + 3] ^ tempa[3];
+    }
+}
+
+static void aes_add_round_key(uint8_t r, aes_state_t *state, uint8_t *RoundKey) {
+    int i, j;
+    for (i = 0; i < 4; ++i)
+        for (j = 0; j < 4; ++j)
+            (*state)[i][j] ^= RoundKey[(r * AES_Nb * 4) + (i * AES_Nb) + j];
+}
+
+static void aes_sub_bytes(uint8_t *sbox, aes_state_t *state) {
+    int i, j;
+    for (i = 0; i < 4; ++i)
+        for (j = 0; j < 4; ++j)
+            (*state)[j][i] = sbox[(*state)[j][i]];
+}
+
+static void aes_shift_rows(aes_state_t *state) {
+    uint8_t temp;
+
+    temp           = (*state)[0][1];
+    (*state)[0][1] = (*state)[1][1];
+    (*state)[1][1] = (*state)[2][1];
+    (*state)[2][1] = (*state)[3][1];
+    (*state)[3][1] = temp;
+
+    temp           = (*state)[0][2];
+    (*state)[0][2] = (*state)[2][2];
+    (*state)[2][2] = temp;
+    temp           = (*state)[1][2];
+    (*state)[1][2] = (*state)[3][2];
+    (*state)[3][2] = temp;
+
+    temp           = (*state)[0][3];
+    (*state)[0][3] = (*state)[3][3];
+    (*state)[3][3] = (*state)[2][3];
+    (*state)[2][3] = (*state)[1][3];
+    (*state)[1][3] = temp;
+}
+
+static uint8_t aes_xtime(uint8_t x) {
+    return (uint8_t) ((x << 1) ^ (((x >> 7) & 1) * 0x1b));
+}
+
+static void aes_mix_columns(aes_state_t *state) {
+    uint8_t Tmp, Tm, t;
+    int i;
+
+    for (i = 0; i < 4; ++i) {
+        t   = (*state)[i][0];
+        Tmp = (*state)[i][0] ^ (*state)[i][1] ^ (*state)[i][2] ^ (*state)[i][3];
+        Tm  = (*state)[i][0] ^ (*state)[i][1]; Tm = aes_xtime(Tm); (*state)[i][0] ^= Tm ^ Tmp;
+        Tm  = (*state)[i][1] ^ (*state)[i][2]; Tm = aes_xtime(Tm); (*state)[i][1] ^= Tm ^ Tmp;
+        Tm  = (*state)[i][2] ^ (*state)[i][3]; Tm = aes_xtime(Tm); (*state)[i][2] ^= Tm ^ Tmp;
+        Tm  = (*state)[i][3] ^ t;              Tm = aes_xtime(Tm); (*state)[i][3] ^= Tm ^ Tmp;
+    }
+}
+
+static void aes_cipher(uint8_t *sbox, aes_state_t *state, uint8_t *RoundKey) {
+    uint8_t r;
+
+    aes_add_round_key(0, state, RoundKey);
+    for (r = 1; r < AES_Nr; ++r) {
+        aes_sub_bytes(sbox, state);
+        aes_shift_rows(state);
+        aes_mix_columns(state);
+        aes_add_round_key(r, state, RoundKey);
+    }
+    aes_sub_bytes(sbox, state);
+    aes_shift_rows(state);
+    aes_add_round_key(AES_Nr, state, RoundKey);
+}
+
+static uint32_t get_be32(uint8_t *a) {
+    return ((uint32_t) a[0] << 24) | ((uint32_t) a[1] << 16) | ((uint32_t) a[2] << 8) | a[3];
+}
+
+static void put_be32(uint8_t *a, uint32_t val) {
+    a[0] = (val >> 24) & 0xff;
+    a[1] = (val >> 16) & 0xff;
+    a[2] = (val >> 8) & 0xff;
+    a[3] = val & 0xff;
+}
+
+static void gf_mult_fast(uint64_t *last4, uint64_t *HL, uint64_t *HH, uint8_t *x, uint8_t *output) {
+    uint8_t lo, hi, rem;
+    uint64_t zh, zl;
+    int i;
+
+    lo = (uint8_t) (x[15] & 0x0f);
+    zh = HH[lo];
+    zl = HL[lo];
+    for (i = 15; i >= 0; i--) {
+        lo = (uint8_t) (x[i] & 0x0f);
+        hi = (uint8_t) (x[i] >> 4);
+        if (i != 15) {
+            rem = (uint8_t) (zl & 0x0f);
+            zl = (zh << 60) | (zl >> 4);
+            zh = (zh >> 4);
+            zh ^= (uint64_t) last4[rem] << 48;
+            zh ^= HH[lo];
+            zl ^= HL[lo];
+        }
+        rem = (uint8_t) (zl & 0x0f);
+        zl = (zh << 60) | (zl >> 4);
+        zh = (zh >> 4);
+        zh ^= (uint64_t) last4[rem] << 48;
+        zh ^= HH[hi];
+        zl ^= HL[hi];
+    }
+    put_be32(output, zh >> 32);
+    put_be32(output + 4, zh);
+    put_be32(output + 8, zl >> 32);
+    put_be32(output + 12, zl);
+}
+
+static void gf_build_table(uint8_t *h, uint64_t *HL, uint64_t *HH) {
+    uint64_t hi, lo, vl, vh, *HiL, *HiH;
+    uint32_t T;
+    int i, j;
+
+    hi = get_be32(h);
+    lo = get_be32(h + 4);
+    vh = (uint64_t) hi << 32 | lo;
+    hi = get_be32(h + 8);
+    lo = get_be32(h + 12);
+    vl = (uint64_t) hi << 32 | lo;
+
+    HL[8] = vl;
+    HH[8] = vh;
+    HH[0] = 0;
+    HL[0] = 0;
+    for (i = 4; i > 0; i >>= 1) {
+        T = (uint32_t) (vl & 1) * 0xe1000000U;
+        vl = (vh << 63) | (vl >> 1);
+        vh = (vh >> 1) ^ ((uint64_t) T << 32);
+        HL[i] = vl;
+        HH[i] = vh;
+    }
+    for (i = 2; i < 16; i <<= 1) {
+        HiL = HL + i;
+        HiH = HH + i;
+        vh = *HiH;
+        vl = *HiL;
+        for (j = 1; j < i; j++) {
+            HiH[j] = vh ^ HH[j];
+            HiL[j] = vl ^ HL[j];
+        }
+    }
+}
+
+// the single thread kernels do their work in thread 0
+static int has_thread_0(const struct lake_cpu_launch *l) {
+    return l->grid[0] && l->block[0];
+}
+
+static void AES_key_expansion_kernel(const struct lake_cpu_launch *l, void **args) {
+    if (has_thread_0(l))
+        aes_key_expansion(ARG(0, uint8_t *), ARG(1, uint8_t *), ARG(3, uint8_t *), ARG(2, uint8_t *));
+}
+
+static void AES_encrypt_one_block_kernel(const struct lake_cpu_launch *l, void **args) {
+    if (has_thread_0(l))
+        aes_cipher(ARG(0, uint8_t *), (aes_state_t *) ARG(2, uint8_t *), ARG(1, uint8_t *));
+}
+
+static void AES_GCM_setup_gf_mult_table_kernel(const struct lake_cpu_launch *l, void **args) {
+    uint64_t *last4 = ARG(0, uint64_t *), *HL = ARG(2, uint64_t *), *HH = ARG(3, uint64_t *);
+    uint64_t *HL_long = ARG(4, uint64_t *), *HH_long = ARG(5, uint64_t *);
+    uint64_t *HL_sqr_long = ARG(6, uint64_t *), *HH_sqr_long = ARG(7, uint64_t *);
+    uint8_t *h = ARG(1, uint8_t *), h_long[16], h_sqr_long[16], tmp[16];
+    int i;
+
+    if (!has_thread_0(l))
+        return;
+    gf_build_table(h, HL, HH);
+    memcpy(h_long, h, 16);
+    for (i = 0; i < AES_GCM_STEP - 1; i++) {
+        gf_mult_fast(last4, HL, HH, h_long, tmp);
+        memcpy(h_long, tmp, 16);
+    }
+    gf_build_table(h_long, HL_long, HH_long);
+    memcpy(h_sqr_long, h_long, 16);
+    for (i = 0; i < AES_GCM_STEP - 1; i++) {
+        gf_mult_fast(last4, HL_long, HH_long, h_sqr_long, tmp);
+        memcpy(h_sqr_long, tmp, 16);
+    }
+    gf_build_table(h_sqr_long, HL_sqr_long, HH_sqr_long);
+}
+
+static void AES_GCM_xcrypt_kernel(const struct lake_cpu_launch *l, void **args) {
+    uint8_t *dst = ARG(0, uint8_t *), *sbox = ARG(1, uint8_t *), *roundkey = ARG(2, uint8_t *);
+    uint8_t *nonce = ARG(3, uint8_t *), *src = ARG(4, uint8_t *);
+    uint32_t size = ARG(5, uint32_t);
+    uint64_t tid, n = (uint64_t) l->grid[0] * l->block[0];
+    uint8_t buffer[16];
+    int i;
+
+    // every block is xored with the same counter block, see the GPU code
+    if (!n || !size)
+        return;
+    memcpy(buffer, nonce, 12);
+    put_be32(buffer + 12, 1);
+    aes_cipher(sbox, (aes_state_t *) buffer, roundkey);
+    for (tid = 0; tid < n && tid * AES_BLOCKLEN < size; tid++) {
+        for (i = 0; i < AES_BLOCKLEN; i++)
+            dst[tid * AES_BLOCKLEN + i] = src[tid * AES_BLOCKLEN + i] ^ buffer[i];
+    }
+}
+
+static void AES_GCM_mac_kernel(const struct lake_cpu_launch *l, void **args) {
+    uint64_t *last4 = ARG(0, uint64_t *), *HL = ARG(1, uint64_t *), *HH = ARG(2, uint64_t *);
+    int num_parts = ARG(3, int);
+    uint8_t *input = ARG(4, uint8_t *), *output = ARG(6, uint8_t *), v[16], u[16];
+    uint32_t num_block = ARG(5, uint32_t);
+    int64_t tid, n = (int64_t) l->grid[0] * l->block[0];
+    int head_size, i, j;
+
+    for (tid = 0; tid < n && tid < num_parts; tid++) {
+        memset(v, 0, sizeof(v));
+        head_size = num_block % num_parts;
+        if (tid >= num_parts - head_size)
+            memcpy(v, input + (head_size + tid - num_parts) * 16, 16);
+        for (i = head_size + tid; i < (int) num_block; i += num_parts) {
+            gf_mult_fast(last4, HL, HH, v, u);
+            for (j = 0; j < 16; j++)
+                v[j] = u[j] ^ input[i * 16 + j];
+        }
+        memcpy(output + tid * 16, v, 16);
+    }
+}
+
+static void AES_GCM_mac_final_kernel(const struct lake_cpu_launch *l, void **args) {
+    uint64_t *last4 = ARG(0, uint64_t *), *HL = ARG(1, uint64_t *), *HH = ARG(2, uint64_t *);
+    uint8_t *sbox = ARG(3, uint8_t *), *roundkey = ARG(4, uint8_t *), *nonce = ARG(5, uint8_t *);
+    uint8_t *x = ARG(6, uint8_t *), *mac = ARG(8, uint8_t *), u[16], v[16];
+    uint32_t input_size = ARG(7, uint32_t);
+    int i;
+
+    if (!has_thread_0(l))
+        return;
+    gf_mult_fast(last4, HL, HH, x, v);
+    memset(u, 0, sizeof(u));
+    put_be32(u + 12, input_size * 8);
+    for (i = 0; i < 16; i++)
+        u[i] ^= v[i];
+    gf_mult_fast(last4, HL, HH, u, v);
+    memcpy(u, nonce, 12);
+    put_be32(u + 12, 1);
+    aes_cipher(sbox, (aes_state_t *) u, roundkey);
+    for (i = 0; i < 16; i++)
+        mac[i] = v[i] ^ u[i];
+}
+
+static void AES_GCM_next_nonce_kernel(const struct lake_cpu_launch *l, void **args) {
+    uint8_t *nonce = ARG(0, uint8_t *);
+    int i;
+
+    if (!has_thread_0(l))
+        return;
+    for (i = 0; i < 12; i++) {
+        nonce[i]++;
+        if (nonce[i] > 0)
+            break;
+    }
+}
+
+static const struct lake_cpu_kernel cpu_kernels[] = {
+    { "_Z26prediction_mid_layer_batchPlS_S_S_", prediction_mid_layer_batch },
+    { "_Z28prediction_mid_layer_1_batchPlS_S_S_", prediction_mid_layer_n_batch },
+    { "_Z28prediction_mid_layer_2_batchPlS_S_S_", prediction_mid_layer_n_batch },
+    { "_Z28prediction_final_layer_batchPlS_S_S_", prediction_final_layer_batch },
+    { "_Z15normalize_fusediPfS_S_S_S_S_", normalize_fused },
+    { "_Z13fused_forwardPfPiiS_S_S_S_S_S_S_S_S_S_S_S_", fused_forward },
+    { "_Z13mllb_infer_v2PfS_S_S_fS_", mllb_infer_v2 },
+    { "_Z18mllb_infer_v2_cudaPfS_S_S_fS_", mllb_infer_v2_cuda },
+    { "_Z24AES_key_expansion_kernelPhS_S_S_", AES_key_expansion_kernel },
+    { "_Z28AES_encrypt_one_block_kernelPhS_S_", AES_encrypt_one_block_kernel },
+    { "_Z34AES_GCM_setup_gf_mult_table_kernelPmPhS_S_S_S_S_S_", AES_GCM_setup_gf_mult_table_kernel },
+    { "_Z21AES_GCM_xcrypt_kernelPhS_S_S_S_j", AES_GCM_xcrypt_kernel },
+    { "_Z18AES_GCM_mac_kernelPmS_S_iPhjS0_", AES_GCM_mac_kernel },
+    { "_Z24AES_GCM_mac_final_kernelPmS_S_PhS0_S0_S0_jS0_", AES_GCM_mac_final_kernel },
+    { "_Z25AES_GCM_next_nonce_kernelPh", AES_GCM_next_nonce_kernel },
+};
+
+const struct lake_cpu_kernel *lake_cpu_kernel_find(const char *name) {
+    unsigned int i;
+
+    for (i = 0; i < sizeof(cpu_kernels) / sizeof(cpu_kernels[0]); i++) {
+        if (strcmp(cpu_kernels[i].name, name) == 0)
+            return &cpu_kernels[i];
+    }
+    return NULL;
+}
@@ -0,0 +1,253 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "devpool.h"
+
+/*
+ * Every block the pool handed out or keeps is in a hash table by device
+ * pointer. A freed block goes to the deferred list of its size class: the
+ * device may still run work on it. When an allocation finds no reusable
+ * block but there are deferred ones of its class, and at least
+ * DEVPOOL_SYNC_BATCH blocks are deferred overall, the pool synchronizes the
+ * device once and every deferred block becomes reusable; with fewer it
+ * allocates a new block instead. Frees are synchronized in batches instead
+ * of one by one, and a loop that frees and allocates one buffer does not
+ * pay a sync per iteration.
+ *
+ * Blocks are rounded up to their class, at most 25% more than asked. A
+ * pointer the pool does not know (pitched allocations, blocks above
+ * DEVPOOL_MAX_BLOCK, anything allocated while caching is off) is freed
+ * straight away.
+ */
+
+#define DEVPOOL_MIN_SHIFT 9
+#define DEVPOOL_EINVAL    1   // CUDA_ERROR_INVALID_VALUE, hipErrorInvalidValue
+
+struct devpool_block {
+    uint64_t ptr;
+    size_t size;   // of its class
+    int cls;
+    int in_use;
+    struct devpool_block *hnext;
+    struct devpool_block *next;   // in a free or deferred list
+};
+
+static int size_class(size_t size, size_t *class_size) {
+    int f, s;
+
+    if (size <= (1ul << DEVPOOL_MIN_SHIFT)) {
+        *class_size = 1ul << DEVPOOL_MIN_SHIFT;
+        return 0;
+    }
+    // 2^f <= size - 1 < 2^(f+1), split in quarters
+    f = 63 - __builtin_clzll(size - 1);
+    s = ((size - 1) >> (f - 2)) & 3;
+    *class_size = (1ul << f) + ((size_t)(s + 1) << (f - 2));
+    return 1 + (f - DEVPOOL_MIN_SHIFT) * 4 + s;
+}
+
+static struct devpool_block **hash_slot(struct lake_devpool *pool, uint64_t ptr) {
+    return &pool->hash[((ptr >> 8) * 0x9E3779B97F4A7C15ull) >> (64 - DEVPOOL_HASH_BITS)];
+}
+
+static struct devpool_block *lookup(struct lake_devpool *pool, uint64_t ptr) {
+    struct devpool_block *b;
+
+    for (b = *hash_slot(pool, ptr); b; b = b->hnext) {
+        if (b->ptr == ptr)
+            return b;
+    }
+    return NULL;
+}
+
+static void unhash(struct lake_devpool *pool, struct devpool_block *b) {
+    struct devpool_block **p = hash_slot(pool, b->ptr);
+
+    while (*p != b)
+        p = &(*p)->hnext;
+    *p = b->hnext;
+}
+
+static void undefer(struct lake_devpool *pool) {
+    struct devpool_block *b;
+    int c;
+
+    for (c = 0; c < DEVPOOL_CLASSES; c++) {
+        while ((b = pool->deferred[c])) {
+            pool->deferred[c] = b->next;
+            b->next = pool->free_list[c];
+            pool->free_list[c] = b;
+        }
+    }
+    pool->n_deferred = 0;
+}
+
+void lake_devpool_init(struct lake_devpool *pool, const struct lake_devpool_backend *be, size_t max_cached) {
+    memset(pool, 0, sizeof(*pool));
+    pthread_mutex_init(&pool->lock, NULL);
+    pool->be = be;
+    pool->max_cached = max_cached;
+}
+
+static uint64_t trim_locked(struct lake_devpool *pool) {
+    struct devpool_block *b, **lists[2] = { pool->free_list, pool->deferred };
+    uint64_t released = 0;
+    int c, l;
+
+    for (l = 0; l < 2; l++) {
+        for (c = 0; c < DEVPOOL_CLASSES; c++) {
+            while ((b = lists[l][c])) {
+                lists[l][c] = b->next;
+                unhash(pool, b);
+                // a driver free waits for the device, deferred blocks are safe too
+                pool->be->free(b->ptr);
+                pool->stats.driver_frees++;
+                released += b->size;
+                free(b);
+            }
+        }
+    }
+    pool->n_deferred = 0;
+    pool->stats.cached -= released;
+    pool->stats.trims++;
+    return released;
+}
+
+int lake_devpool_alloc(struct lake_devpool *pool, uint64_t *ptr, size_t size) {
+    struct devpool_block *b;
+    size_t class_size;
+    int cls, res;
+
+    if (!pool->max_cached || size > DEVPOOL_MAX_BLOCK) {
+        res = pool->be->alloc(ptr, size);
+        pthread_mutex_lock(&pool->lock);
+        pool->stats.allocs++;
+        pool->stats.driver_allocs++;
+        pthread_mutex_unlock(&pool->lock);
+        return res;
+    }
+
+    cls = size_class(size, &class_size);
+    pthread_mutex_lock(&pool->lock);
+    pool->stats.allocs++;
+    if (!pool->free_list[cls] && pool->deferred[cls] && pool->n_deferred >= DEVPOOL_SYNC_BATCH) {
+        res = pool->be->sync();
+        pool->stats.syncs++;
+        if (res == 0)
+            undefer(pool);
+    }
+    b = pool->free_list[cls];
+    if (b) {
+        pool->free_list[cls] = b->next;
+        b->in_use = 1;
+        pool->stats.hits++;
+        pool->stats.cached -= b->size;
+        pool->stats.in_use += b->size;
+        *ptr = b->ptr;
+        pthread_mutex_unlock(&pool->lock);
+        return 0;
+    }
+
+    b = (struct devpool_block *) malloc(sizeof(*b));
+    if (!b) {
+        pthread_mutex_unlock(&pool->lock);
+        return pool->be->alloc(ptr, size);
+    }
+    res = pool->be->alloc(ptr, class_size);
+    if (res) {
+        // what the pool keeps may be what is missing
+        if (pool->stats.cached) {
+            trim_locked(pool);
+            res = pool->be->alloc(ptr, class_size);
+        }
+    }
+    if (res) {
+        pthread_mutex_unlock(&pool->lock);
+        free(b);
+        return res;
+    }
+    pool->stats.driver_allocs++;
+    b->ptr = *ptr;
+    b->size = class_size;
+    b->cls = cls;
+    b->in_use = 1;
+    b->next = NULL;
+    b->hnext = *hash_slot(pool, b->ptr);
+    *hash_slot(pool, b->ptr) = b;
+    pool->stats.in_use += b->size;
+    pthread_mutex_unlock(&pool->lock);
+    return 0;
+}
+
+int lake_devpool_free(struct lake_devpool *pool, uint64_t ptr) {
+    struct devpool_block *b;
+
+    if (!ptr)
+        return 0;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->stats.frees++;
+    b = lookup(pool, ptr);
+    if (!b) {
+        pool->stats.driver_frees++;
+        pthread_mutex_unlock(&pool->lock);
+        return pool->be->free(ptr);
+    }
+    if (!b->in_use) {
+        pthread_mutex_unlock(&pool->lock);
+        printf("Device pointer 0x%lx freed twice\n", (unsigned long) ptr);
+        return DEVPOOL_EINVAL;
+    }
+
+    b->in_use = 0;
+    pool->stats.in_use -= b->size;
+    if (pool->stats.cached + b->size > pool->max_cached) {
+        unhash(pool, b);
+        pool->stats.driver_frees++;
+        pthread_mutex_unlock(&pool->lock);
+        ptr = b->ptr;
+        free(b);
+        return pool->be->free(ptr);
+    }
+    b->next = pool->deferred[b->cls];
+    pool->deferred[b->cls] = b;
+    pool->n_deferred++;
+    pool->stats.cached += b->size;
+    pthread_mutex_unlock(&pool->lock);
+    return 0;
+}
+
+uint64_t lake_devpool_trim(struct lake_devpool *pool) {
+    uint64_t released;
+
+    pthread_mutex_lock(&pool->lock);
+    released = trim_locked(pool);
+    pthread_mutex_unlock(&pool->lock);
+    return released;
+}
+
+// the context went away with all its memory: drop every block without freeing it
+void lake_devpool_forget(struct lake_devpool *pool) {
+    struct devpool_block *b;
+    int i;
+
+    pthread_mutex_lock(&pool->lock);
+    for (i = 0; i < (1 << DEVPOOL_HASH_BITS); i++) {
+        while ((b = pool->hash[i])) {
+            pool->hash[i] = b->hnext;
+            free(b);
+        }
+    }
+    memset(pool->free_list, 0, sizeof(pool->free_list));
+    memset(pool->deferred, 0, sizeof(pool->deferred));
+    pool->n_deferred = 0;
+    pool->stats.in_use = 0;
+    pool->stats.cached = 0;
+    pthread_mutex_unlock(&pool->lock);
+}
+
+void lake_devpool_get_stats(struct lake_devpool *pool, struct lake_devpool_stats *stats) {
+    pthread_mutex_lock(&pool->lock);
+    *stats = pool->stats;
+    pthread_mutex_unlock(&pool->lock);
+}
@@ -0,0 +1,51 @@
+#ifndef __LAKE_USPACE_DEVPOOL_H__
+#define __LAKE_USPACE_DEVPOOL_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <pthread.h>
+#include "lake_devpool.h"
+
+/*
+ * Caching device memory pool, see include/lake_devpool.h. The driver is
+ * reached through a backend, so the pool can be tested without a GPU
+ * (test/test_devpool.c). Backend calls return 0 or a driver error.
+ */
+struct lake_devpool_backend {
+    const char *name;
+    int (*alloc)(uint64_t *ptr, size_t size);
+    int (*free)(uint64_t ptr);
+    int (*sync)(void);   // waits for all work on the device
+};
+
+// 4 classes per power of two from 512 bytes to 1 GB, larger blocks are not cached
+#define DEVPOOL_CLASSES   88
+#define DEVPOOL_MAX_BLOCK (1ull << 30)
+#define DEVPOOL_HASH_BITS 12
+// deferred blocks worth a device sync
+#define DEVPOOL_SYNC_BATCH 8
+
+struct devpool_block;
+
+struct lake_devpool {
+    const struct lake_devpool_backend *be;
+    pthread_mutex_t lock;
+    size_t max_cached;   // 0 disables caching
+    struct devpool_block *free_list[DEVPOOL_CLASSES];  // reusable
+    struct devpool_block *deferred[DEVPOOL_CLASSES];   // freed since the last device sync
+    struct devpool_block *hash[1 << DEVPOOL_HASH_BITS];
+    unsigned int n_deferred;
+    struct lake_devpool_stats stats;
+};
+
+// one per API, set up by the backend in use (backend.c)
+extern struct lake_devpool lake_pools[LAKE_DEVPOOL_NR];
+
+void lake_devpool_init(struct lake_devpool *pool, const struct lake_devpool_backend *be, size_t max_cached);
+int lake_devpool_alloc(struct lake_devpool *pool, uint64_t *ptr, size_t size);
+int lake_devpool_free(struct lake_devpool *pool, uint64_t ptr);
+uint64_t lake_devpool_trim(struct lake_devpool *pool);
+void lake_devpool_forget(struct lake_devpool *pool);
+void lake_devpool_get_stats(struct lake_devpool *pool, struct lake_devpool_stats *stats);
+
+#endif
@@ -0,0 +1,330 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <poll.h>
+#include <sched.h>
+#include <pthread.h>
+#include <sys/eventfd.h>
+#include "commands.h"
+#include "lake_ring.h"
+#include "lake_kapi.h"
+#include "lake_numa.h"
+
+/*
+ * Dispatcher: the receive loop hands commands to a pool of workers.
+ *
+ * Commands on a non-null stream go to the worker owning that stream, so
+ * they run in order while other streams proceed in parallel. Everything
+ * else (null stream, allocations, module/context management, device-wide
+ * syncs) is a barrier and runs on worker 0, after every command received
+ * before it was started. Stream commands received after a barrier wait
+ * for it in turn.
+ *
+ * A stream is bound to its worker the first time it is seen. If its first
+ * command carries a host buffer, the worker is picked among those on the
+ * NUMA node of that buffer's shared memory region, so the copies do not
+ * cross the interconnect; later commands stay on the same worker whatever
+ * their buffers, which keeps them in order. Barriers stay on worker 0.
+ *
+ * With zero workers commands run inline in the receive loop.
+ */
+
+#define LAKE_MAX_WORKERS  32
+#define WORK_QUEUE_SLOTS  256
+#define WORK_SPIN_NS      (50 * 1000)
+#define STREAM_BIND_SLOTS 1024  // power of two
+
+struct lake_work {
+    uint32_t origin;
+    uint32_t barrier;
+    uint64_t t_recv;
+    uint64_t ticket;                  // barrier: its number; stream cmd: barriers to wait for
+    uint64_t snap[LAKE_MAX_WORKERS];  // barrier: commands each worker must have completed
+    char cmd[];
+};
+
+#define WORK_SLOT_SIZE (sizeof(struct lake_ring_slot) + sizeof(struct lake_work) + LAKE_RING_CMD_SLOT_SIZE)
+
+struct lake_worker {
+    pthread_t thread;
+    int id;
+    int cpu;
+    int node;
+    int efd;
+    struct lake_ring *q;
+    uint64_t enqueued;  // only touched by the dispatcher
+    uint64_t completed;
+};
+
+static struct lake_worker workers[LAKE_MAX_WORKERS];
+static int n_workers = 0;
+static volatile int stopping = 0;
+static uint64_t barriers_issued = 0;  // only touched by the dispatcher
+static uint64_t barriers_done = 0;
+
+// stream -> worker, open addressing; only touched by the dispatcher.
+// Entries are never removed: a stream handle reused after a destroy keeps its worker.
+static struct {
+    CUstream stream;
+    int worker;
+} stream_binds[STREAM_BIND_SLOTS];
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+void lake_reply(int origin, uint32_t seq, struct lake_cmd_ret *cmd_ret) {
+    if (origin == LAKE_ORIGIN_RING)
+        lake_ring_reply(seq, cmd_ret);
+    else
+        lake_send_reply(seq, cmd_ret);
+}
+
+// timestamps read back by the kernel's tracing (kernel/trace.c)
+static void lake_stamp_reply(struct lake_cmd_ret *cmd_ret, uint64_t t_recv, uint64_t t_start) {
+    cmd_ret->t_recv = t_recv;
+    cmd_ret->t_start = t_start;
+    cmd_ret->t_end = now_ns();
+}
+
+static void wait_until(uint64_t *counter, uint64_t target) {
+    int spins = 0;
+    while (__atomic_load_n(counter, __ATOMIC_ACQUIRE) < target) {
+        if (++spins < 1000)
+            lake_ring_relax();
+        else
+            sched_yield();
+    }
+}
+
+static void worker_wait_for_work(struct lake_worker *w, uint64_t *idle_since) {
+    struct pollfd pfd = { .fd = w->efd, .events = POLLIN };
+    uint64_t v;
+
+    if (!*idle_since) {
+        *idle_since = now_ns();
+        return;
+    }
+    if (now_ns() - *idle_since < WORK_SPIN_NS) {
+        lake_ring_relax();
+        return;
+    }
+    if (lake_ring_prepare_sleep(w->q)) {
+        if (poll(&pfd, 1, 100) > 0 && read(w->efd, &v, sizeof(v)) < 0)
+            perror("read eventfd");
+    }
+    lake_ring_finish_sleep(w->q);
+    *idle_since = 0;
+}
+
+static void *worker_loop(void *arg) {
+    struct lake_worker *w = (struct lake_worker *) arg;
+    struct lake_ring_slot *slot;
+    struct lake_work *work;
+    struct lake_cmd_ret cmd_ret;
+    uint64_t idle_since = 0, t_start;
+    int i;
+
+    if (w->cpu >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(w->cpu, &set);
+        if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set))
+            printf("Could not pin worker %d to cpu %d\n", w->id, w->cpu);
+    }
+
+    while (!stopping) {
+        slot = lake_ring_peek(w->q);
+        if (!slot) {
+            worker_wait_for_work(w, &idle_since);
+            continue;
+        }
+        idle_since = 0;
+        work = (struct lake_work *) slot->data;
+
+        if (work->barrier) {
+            for (i = 1; i < n_workers; i++)
+                wait_until(&workers[i].completed, work->snap[i]);
+        } else {
+            wait_until(&barriers_done, work->ticket);
+        }
+
+        lake_handler_thread_sync_ctx();
+        t_start = now_ns();
+        lake_handle_cmd(work->cmd, &cmd_ret);
+        lake_stamp_reply(&cmd_ret, work->t_recv, t_start);
+        if (work->barrier)
+            __atomic_store_n(&barriers_done, work->ticket, __ATOMIC_RELEASE);
+        lake_reply(work->origin, slot->seq, &cmd_ret);
+
+        lake_ring_pop(w->q);
+        __atomic_store_n(&w->completed, w->completed + 1, __ATOMIC_RELEASE);
+    }
+    return NULL;
+}
+
+static uint64_t stream_hash(CUstream stream) {
+    return ((uint64_t)(uintptr_t) stream >> 4) * 0x9E3779B97F4A7C15ull;
+}
+
+// a stream worker for a new stream, on node if any worker runs there
+static int bind_worker(CUstream stream, int node) {
+    int i, n = 0, candidates[LAKE_MAX_WORKERS];
+    uint64_t h = stream_hash(stream) >> 32;
+
+    if (node >= 0) {
+        for (i = 1; i < n_workers; i++)
+            if (workers[i].node == node)
+                candidates[n++] = i;
+    }
+    if (n)
+        return candidates[h % n];
+    return 1 + h % (n_workers - 1);
+}
+
+static struct lake_worker *pick_worker(CUstream stream, void *cmd) {
+    uint32_t i, slot;
+    int64_t off;
+
+    if (!stream || n_workers == 1)
+        return &workers[0];
+
+    slot = (uint32_t) (stream_hash(stream) >> 40);
+    for (i = 0; i < STREAM_BIND_SLOTS; i++) {
+        slot &= STREAM_BIND_SLOTS - 1;
+        if (stream_binds[slot].stream == stream)
+            return &workers[stream_binds[slot].worker];
+        if (!stream_binds[slot].stream)
+            break;
+        slot++;
+    }
+
+    off = lake_cmd_host_offset(cmd);
+    // a full table is no problem as long as unbound streams always hash the same way
+    if (i == STREAM_BIND_SLOTS)
+        return &workers[bind_worker(stream, -1)];
+    stream_binds[slot].stream = stream;
+    stream_binds[slot].worker = bind_worker(stream, off >= 0 ? lake_shm_node(off) : -1);
+    return &workers[stream_binds[slot].worker];
+}
+
+// copies the command, so the caller can release its buffer right away
+void lake_dispatch(int origin, uint32_t seq, void *cmd, uint32_t size) {
+    struct lake_cmd_ret cmd_ret;
+    struct lake_ring_slot *slot;
+    struct lake_work *work;
+    struct lake_worker *w;
+    CUstream stream;
+    uint64_t t_recv = now_ns();
+    int i;
+
+    if (n_workers == 0) {
+        lake_handle_cmd(cmd, &cmd_ret);
+        lake_stamp_reply(&cmd_ret, t_recv, t_recv);
+        lake_reply(origin, seq, &cmd_ret);
+        return;
+    }
+
+    if (size > LAKE_RING_CMD_SLOT_SIZE) {
+        printf("Command of %u bytes is too large for the dispatcher\n", size);
+        memset(&cmd_ret, 0, sizeof(cmd_ret));
+        cmd_ret.res = CUDA_ERROR_INVALID_VALUE;
+        lake_reply(origin, seq, &cmd_ret);
+        return;
+    }
+
+    stream = lake_cmd_stream(cmd);
+    w = pick_worker(stream, cmd);
+    while ((slot = lake_ring_reserve(w->q)) == NULL)
+        lake_ring_relax();
+
+    work = (struct lake_work *) slot->data;
+    work->origin = origin;
+    work->t_recv = t_recv;
+    work->barrier = stream == NULL;
+    if (work->barrier) {
+        work->ticket = ++barriers_issued;
+        for (i = 1; i < n_workers; i++)
+            work->snap[i] = workers[i].enqueued;
+    } else {
+        work->ticket = barriers_issued;
+    }
+    memcpy(work->cmd, cmd, size);
+    slot->seq = seq;
+    slot->size = sizeof(*work) + size;
+    lake_ring_commit(w->q);
+    w->enqueued++;
+
+    if (lake_ring_need_doorbell(w->q)) {
+        uint64_t one = 1;
+        if (write(w->efd, &one, sizeof(one)) != sizeof(one))
+            perror("write eventfd");
+    }
+}
+
+// cpus is a comma separated list, worker i is pinned to the (i+1)th entry (wrapping)
+int lake_dispatch_init(int nworkers, int *cpus, int ncpus) {
+    int i;
+
+    if (nworkers > LAKE_MAX_WORKERS) {
+        printf("Limiting dispatcher to %d workers\n", LAKE_MAX_WORKERS);
+        nworkers = LAKE_MAX_WORKERS;
+    }
+
+    for (i = 0; i < nworkers; i++) {
+        struct lake_worker *w = &workers[i];
+        w->id = i;
+        w->cpu = ncpus > 0 ? cpus[(i + 1) % ncpus] : -1;
+        w->node = w->cpu >= 0 ? lake_cpu_node(w->cpu) : -1;
+        w->enqueued = w->completed = 0;
+        w->efd = eventfd(0, 0);
+        w->q = (struct lake_ring *) aligned_alloc(LAKE_RING_CACHELINE,
+                lake_ring_bytes(WORK_QUEUE_SLOTS, WORK_SLOT_SIZE));
+        if (w->efd < 0 || !w->q) {
+            printf("Error allocating dispatcher worker %d\n", i);
+            return -1;
+        }
+        lake_ring_init(w->q, WORK_QUEUE_SLOTS, WORK_SLOT_SIZE);
+    }
+    // workers read n_workers, set it before they start
+    n_workers = nworkers;
+
+    for (i = 0; i < nworkers; i++) {
+        if (pthread_create(&workers[i].thread, NULL, worker_loop, &workers[i])) {
+            printf("Error starting dispatcher worker %d\n", i);
+            return -1;
+        }
+    }
+    if (nworkers)
+        printf("Dispatching to %d workers\n", nworkers);
+    for (i = 0; i < nworkers; i++) {
+        if (workers[i].cpu >= 0)
+            printf("  worker %d: cpu %d node %d\n", i, workers[i].cpu, workers[i].node);
+    }
+    return 0;
+}
+
+void lake_dispatch_fini(void) {
+    uint64_t one = 1;
+    int i;
+
+    stopping = 1;
+    for (i = 0; i < n_workers; i++) {
+        if (write(workers[i].efd, &one, sizeof(one)) != sizeof(one))
+            perror("write eventfd");
+    }
+    for (i = 0; i < n_workers; i++) {
+        pthread_join(workers[i].thread, NULL);
+        close(workers[i].efd);
+        free(workers[i].q);
+    }
+    n_workers = 0;
+}
@@ -8,9 +8,78 @@
 #include "lake_kapi.h"
 #include "kargs.h"
 #include "handler_helpers.h"
+#include "devpool.h"
 
 #define DRY_RUN 0
 
+/*
+ * Contexts are current per thread. Remember the last one created so
+ * dispatcher workers can make it current before running a command.
+ */
+static CUcontext lake_cur_ctx = NULL;
+static int lake_cur_ctx_is_hip = 0;
+static __thread CUcontext lake_thread_ctx = NULL;
+
+static void lake_set_cur_ctx(CUcontext ctx, int is_hip) {
+    lake_cur_ctx_is_hip = is_hip;
+    __atomic_store_n(&lake_cur_ctx, ctx, __ATOMIC_RELEASE);
+    lake_thread_ctx = ctx;
+}
+
+/*
+ * Device memory pools, one per API (include/lake_devpool.h). A pool only
+ * ever holds memory of the context current when it was allocated; kernel
+ * modules use one context per API, and destroying it drops its pool.
+ */
+static int cu_pool_alloc(uint64_t *ptr, size_t size) {
+    return cuMemAlloc((CUdeviceptr *) ptr, size);
+}
+
+static int cu_pool_free(uint64_t ptr) {
+    return cuMemFree((CUdeviceptr) ptr);
+}
+
+static int cu_pool_sync(void) {
+    return cuCtxSynchronize();
+}
+
+static int hip_pool_alloc(uint64_t *ptr, size_t size) {
+    return hipMalloc((void **) ptr, size);
+}
+
+static int hip_pool_free(uint64_t ptr) {
+    return hipFree((hipDeviceptr_t) ptr);
+}
+
+static int hip_pool_sync(void) {
+    return hipDeviceSynchronize();
+}
+
+static const struct lake_devpool_backend pool_backends[LAKE_DEVPOOL_NR] = {
+    { "cu", cu_pool_alloc, cu_pool_free, cu_pool_sync },
+    { "hip", hip_pool_alloc, hip_pool_free, hip_pool_sync },
+};
+
+static int gpu_init(size_t max_cached) {
+    int i;
+    for (i = 0; i < LAKE_DEVPOOL_NR; i++)
+        lake_devpool_init(&lake_pools[i], &pool_backends[i], max_cached);
+    return 0;
+}
+
+static void gpu_thread_sync(void) {
+    CUcontext ctx = __atomic_load_n(&lake_cur_ctx, __ATOMIC_ACQUIRE);
+    if (ctx == lake_thread_ctx)
+        return;
+    if (ctx) {
+        if (lake_cur_ctx_is_hip)
+            hipCtxSetCurrent(ctx);
+        else
+            cuCtxSetCurrent(ctx);
+    }
+    lake_thread_ctx = ctx;
+}
+
 /*********************
  *  cuInit    
  *********************/
@@ -35,6 +104,8 @@ static int lake_handler_cuDeviceGet(void* buf, struct lake_cmd_ret* cmd_ret) {
 static int lake_handler_cuCtxCreate(void* buf, struct lake_cmd_ret* cmd_ret) {
         struct lake_cmd_cuCtxCreate *cmd = (struct lake_cmd_cuCtxCreate *) buf;
     cmd_ret->res = cuCtxCreate_v2(&cmd_ret->pctx, cmd->flags, cmd->dev);
+    if (cmd_ret->res == CUDA_SUCCESS)
+        lake_set_cur_ctx(cmd_ret->pctx, 0);
     return 0;
 }
 
@@ -43,7 +114,7 @@ static int lake_handler_cuCtxCreate(void* buf, struct lake_cmd_ret* cmd_ret) {
  *********************/
 static int lake_handler_cuModuleLoad(void* buf, struct lake_cmd_ret* cmd_ret) {
         struct lake_cmd_cuModuleLoad *cmd = (struct lake_cmd_cuModuleLoad *) buf;
-    cmd_ret->res = cuModuleLoad(&cmd_ret->module, cmd->fname);
+    cmd_ret->res = lake_module_load(0, cmd->fname, (void**) &cmd_ret->module);
     return 0;
 }
 
@@ -52,7 +123,7 @@ static int lake_handler_cuModuleLoad(void* buf, struct lake_cmd_ret* cmd_ret) {
  *********************/
 static int lake_handler_cuModuleUnload(void* buf, struct lake_cmd_ret* cmd_ret) {
         struct lake_cmd_cuModuleUnload *cmd = (struct lake_cmd_cuModuleUnload *) buf;
-    cmd_ret->res = cuModuleUnload(cmd->hmod);
+    cmd_ret->res = lake_module_unload(0, cmd->hmod);
     return 0;
 }
 
@@ -61,9 +132,7 @@ static int lake_handler_cuModuleUnload(void* buf, struct lake_cmd_ret* cmd_ret)
  *********************/
 static int lake_handler_cuModuleGetFunction(void* buf, struct lake_cmd_ret* cmd_ret) {
         struct lake_cmd_cuModuleGetFunction *cmd = (struct lake_cmd_cuModuleGetFunction *) buf;
-    cmd_ret->res = cuModuleGetFunction(&cmd_ret->func, cmd->hmod, cmd->name);
-    struct kernel_args_metadata* meta = get_kargs(cmd_ret->func);
-    kava_parse_function_args(cmd->name, meta);
+    cmd_ret->res = lake_module_get_function(0, cmd->hmod, cmd->name, (void**) &cmd_ret->func);
     return 0;
 }
 
@@ -74,8 +143,8 @@ static int lake_handler_cuLaunchKernel(void* buf, struct lake_cmd_ret* cmd_ret)
         struct lake_cmd_cuLaunchKernel *cmd = (struct lake_cmd_cuLaunchKernel *) buf;
     struct kernel_args_metadata* meta = get_kargs(cmd->f);
     uint8_t *serialized = ((u8*)buf) + sizeof(struct lake_cmd_cuLaunchKernel);
-    void* args = malloc(meta->func_argc * sizeof(void*));
-    construct_args(meta, args, serialized), 
+    void* args[KARGS_MAX_ARGS];
+    construct_args(meta, args, serialized);
     cmd_ret->res = cuLaunchKernel(cmd->f, cmd->gridDimX, cmd->gridDimY,
         cmd->gridDimZ, cmd->blockDimX, cmd->blockDimY, cmd->blockDimZ, cmd->sharedMemBytes,
         cmd->hStream, args, cmd->extra);
@@ -89,6 +158,10 @@ static int lake_handler_cuLaunchKernel(void* buf, struct lake_cmd_ret* cmd_ret)
 static int lake_handler_cuCtxDestroy(void* buf, struct lake_cmd_ret* cmd_ret) {
         struct lake_cmd_cuCtxDestroy *cmd = (struct lake_cmd_cuCtxDestroy *) buf;
     cmd_ret->res = cuCtxDestroy(cmd->ctx);
+    lake_devpool_forget(&lake_pools[LAKE_DEVPOOL_CU]);
+    lake_module_forget(0);
+    if (cmd->ctx == lake_cur_ctx)
+        lake_set_cur_ctx(NULL, 0);
     return 0;
 }
 
@@ -97,7 +170,7 @@ static int lake_handler_cuCtxDestroy(void* buf, struct lake_cmd_ret* cmd_ret) {
  *********************/
 static int lake_handler_cuMemAlloc(void* buf, struct lake_cmd_ret* cmd_ret) {
         struct lake_cmd_cuMemAlloc *cmd = (struct lake_cmd_cuMemAlloc *) buf;
-    cmd_ret->res = cuMemAlloc(&cmd_ret->ptr, cmd->bytesize);
+    cmd_ret->res = (CUresult) lake_devpool_alloc(&lake_pools[LAKE_DEVPOOL_CU], (uint64_t *) &cmd_ret->ptr, cmd->bytesize);
     return 0;
 }
 
@@ -133,7 +206,7 @@ static int lake_handler_cuCtxSynchronize(void* buf, struct lake_cmd_ret* cmd_ret
  *********************/
 static int lake_handler_cuMemFree(void* buf, struct lake_cmd_ret* cmd_ret) {
         struct lake_cmd_cuMemFree *cmd = (struct lake_cmd_cuMemFree *) buf;
-    cmd_ret->res = cuMemFree(cmd->dptr);
+    cmd_ret->res = (CUresult) lake_devpool_free(&lake_pools[LAKE_DEVPOOL_CU], cmd->dptr);
     return 0;
 }
 
@@ -256,7 +329,8 @@ static int lake_handler_hipHostMalloc(void* buf, struct lake_cmd_ret* cmd_ret) {
 struct lake_cmd_hipHostMalloc *cmd = (struct lake_cmd_hipHostMalloc *) buf;
 void* ptr = NULL;
 cmd_ret->res = hipHostMalloc(&ptr, cmd->size, cmd->flags);
-//cmd_ret->ptr = (CUdeviceptr)ptr;
+// the caller frees it with hipHostFree, dropping it here leaked it
+cmd_ret->ptr = (CUdeviceptr)ptr;
 return 0;
 }
 
@@ -295,26 +369,26 @@ return 0;
 static int lake_handler_hipCtxCreate(void* buf, struct lake_cmd_ret* cmd_ret) {
     struct lake_cmd_hipCtxCreate *cmd = (struct lake_cmd_hipCtxCreate *) buf;
     cmd_ret->res = hipCtxCreate(&cmd_ret->pctx, cmd->flags, cmd->dev);
+    if (cmd_ret->res == hipSuccess)
+        lake_set_cur_ctx(cmd_ret->pctx, 1);
     return 0;
 }
 
 static int lake_handler_hipModuleGetFunction(void* buf, struct lake_cmd_ret* cmd_ret) {
     struct lake_cmd_hipModuleGetFunction *cmd = (struct lake_cmd_hipModuleGetFunction *) buf;
-    cmd_ret->res = hipModuleGetFunction(&cmd_ret->func, cmd->hmod, cmd->name);
-    struct kernel_args_metadata* meta = get_kargs(cmd_ret->func);
-    kava_parse_function_args(cmd->name, meta);
+    cmd_ret->res = lake_module_get_function(1, cmd->hmod, cmd->name, (void**) &cmd_ret->func);
     return 0;
 }
 
 static int lake_handler_hipMalloc(void* buf, struct lake_cmd_ret* cmd_ret) {
     struct lake_cmd_hipMalloc *cmd = (struct lake_cmd_hipMalloc *) buf;
-    cmd_ret->res = hipMalloc(&cmd_ret->ptr, cmd->bytesize);
+    cmd_ret->res = (CUresult) lake_devpool_alloc(&lake_pools[LAKE_DEVPOOL_HIP], (uint64_t *) &cmd_ret->ptr, cmd->bytesize);
     return 0;
 }
 
 static int lake_handler_hipFree(void* buf, struct lake_cmd_ret* cmd_ret) {
     struct lake_cmd_hipFree *cmd = (struct lake_cmd_hipFree *) buf;
-    cmd_ret->res = hipFree(cmd->dptr);
+    cmd_ret->res = (CUresult) lake_devpool_free(&lake_pools[LAKE_DEVPOOL_HIP], (uint64_t) cmd->dptr);
     return 0;
 }
 
@@ -343,8 +417,8 @@ static int lake_handler_hipModuleLaunchKernel(void* buf, struct lake_cmd_ret* cm
     struct lake_cmd_hipModuleLaunchKernel *cmd = (struct lake_cmd_hipModuleLaunchKernel *) buf;
 struct kernel_args_metadata* meta = get_kargs(cmd->f);
 uint8_t *serialized = ((u8*)buf) + sizeof(struct lake_cmd_hipModuleLaunchKernel);
-void* args = malloc(meta->func_argc * sizeof(void*));
-construct_args(meta, args, serialized), 
+void* args[KARGS_MAX_ARGS];
+construct_args(meta, args, serialized);
 cmd_ret->res = hipModuleLaunchKernel(cmd->f, cmd->gridDimX, cmd->gridDimY,
     cmd->gridDimZ, cmd->blockDimX, cmd->blockDimY, cmd->blockDimZ, cmd->sharedMemBytes,
     cmd->hStream, args, cmd->extra);
@@ -354,7 +428,7 @@ return 0;
 
 static int lake_handler_hipModuleLoad(void* buf, struct lake_cmd_ret* cmd_ret) {
     struct lake_cmd_hipModuleLoad *cmd = (struct lake_cmd_hipModuleLoad *) buf;
-cmd_ret->res = hipModuleLoad(&cmd_ret->module, cmd->fname);
+cmd_ret->res = lake_module_load(1, cmd->fname, (void**) &cmd_ret->module);
 return 0;
 }
 
@@ -379,6 +453,10 @@ return 0;
 static int lake_handler_hipCtxDestroy(void* buf, struct lake_cmd_ret* cmd_ret) {
     struct lake_cmd_hipCtxDestroy *cmd = (struct lake_cmd_hipCtxDestroy *) buf;
 cmd_ret->res = hipCtxDestroy(cmd->ctx);
+lake_devpool_forget(&lake_pools[LAKE_DEVPOOL_HIP]);
+lake_module_forget(1);
+if (cmd->ctx == lake_cur_ctx)
+    lake_set_cur_ctx(NULL, 1);
 return 0;
 }
 
@@ -389,66 +467,18 @@ return 0;
 }
 
 /*********************
- * 
+ *
  *  END OF HANDLERS
  *    
  *********************/
 
-//order matters, need to match enum in src/kapi/include/commands.h
-static int (*kapi_handlers[])(void* buf, struct lake_cmd_ret* cmd_ret) = {
-    lake_handler_cuInit,
-    lake_handler_cuDeviceGet,
-    lake_handler_cuCtxCreate,
-    lake_handler_cuModuleLoad,
-    lake_handler_cuModuleUnload,
-    lake_handler_cuModuleGetFunction,
-    lake_handler_cuLaunchKernel,
-    lake_handler_cuCtxDestroy,
-    lake_handler_cuMemAlloc,
-    lake_handler_cuMemcpyHtoD,
-    lake_handler_cuMemcpyDtoH,
-    lake_handler_cuCtxSynchronize,
-    lake_handler_cuMemFree,
-    lake_handler_cuStreamCreate,
-    lake_handler_cuStreamSynchronize,
-    lake_handler_cuStreamDestroy,
-    lake_handler_cuMemcpyHtoDAsync,
-    lake_handler_cuMemcpyDtoHAsync,
-    lake_handler_cuMemAllocPitch,
-    lake_handler_kleioLoadModel,
-    lake_handler_kleioInference,
-    lake_handler_kleioForceGC,
-    lake_handler_nvmlRunningProcs,
-    lake_handler_nvmlUtilRate,
-    lake_handler_hipInit,
-    lake_handler_hipDeviceGet,
-    lake_handler_hipHostMalloc,
-    lake_handler_hipHostGetDevicePointer,
-    lake_handler_hipHostFree,
-    lake_handler_hipHostRegister,
-    lake_handler_hipHostUnregister,
-    lake_handler_hipCtxCreate,
-    lake_handler_hipModuleGetFunction,
-    lake_handler_hipMalloc,
-    lake_handler_hipFree,
-    lake_handler_hipMemcpyHtoDAsync,
-    lake_handler_hipMemcpyHtoD,
-    lake_handler_hipMemcpyDtoH,
-    lake_handler_hipDeviceSynchronize,
-    lake_handler_hipModuleLaunchKernel,
-    lake_handler_hipModuleLoad,
-    lake_handler_hipStreamCreate,
-    lake_handler_hipStreamSynchronize,
-    lake_handler_hipStreamDestroy,
-    lake_handler_hipCtxDestroy,
-    lake_handler_hipMemcpyDtoHAsync
+// lake_handler_<name> for every command of LAKE_APIS, in id order
+#define GPU_HANDLER(name, policy, order, fields) lake_handler_##name,
+static const lake_handler_fn kapi_handlers[LAKE_API_NR] = {
+    LAKE_APIS(GPU_HANDLER)
 };
 
-void lake_handle_cmd(void* buf, struct lake_cmd_ret* cmd_ret) {
-    uint32_t cmd_id = *((uint32_t*) buf);
-    kapi_handlers[cmd_id](buf, cmd_ret);
-    if(cmd_ret->res != 0) {
-        printf("Command %u returned error %d\n", cmd_id, cmd_ret->res);
-    }
-}
-
+const struct lake_backend lake_gpu_backend = {
+    "gpu", kapi_handlers, LAKE_API_NR,
+    gpu_init, gpu_thread_sync, lake_module_get_function
+};
@@ -1,30 +1,59 @@
 #include <map>
 #include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
 #include "kargs.h"
 
 std::map<uint64_t, struct kernel_args_metadata*> kargs_metadata_map;
+// entries are added by GetFunction and looked up by launches, possibly from other workers
+static pthread_rwlock_t kargs_lock = PTHREAD_RWLOCK_INITIALIZER;
 
 void init_kargs_kv() {
 }   
 
+// launches tend to repeat the same function, remember the last one per thread
+static thread_local uint64_t last_key = 0;
+static thread_local struct kernel_args_metadata *last_metadata = NULL;
+
 struct kernel_args_metadata* get_kargs(const void* ptr) {
     uint64_t key = (uint64_t) ptr;
+    struct kernel_args_metadata *metadata;
+
+    // entries are never removed before destroy_kargs_kv, a cached pointer stays valid
+    if (last_metadata && last_key == key)
+        return last_metadata;
+
+    pthread_rwlock_rdlock(&kargs_lock);
     auto it = kargs_metadata_map.find(key);
+    metadata = it == kargs_metadata_map.end() ? NULL : it->second;
+    pthread_rwlock_unlock(&kargs_lock);
+    if (metadata) {
+        last_key = key;
+        last_metadata = metadata;
+        return metadata;
+    }
 
+    pthread_rwlock_wrlock(&kargs_lock);
+    it = kargs_metadata_map.find(key);
     if (it == kargs_metadata_map.end()) {
-        struct kernel_args_metadata *metadata = new struct kernel_args_metadata();
+        metadata = new struct kernel_args_metadata();
         memset(metadata, 0, sizeof(struct kernel_args_metadata));
         kargs_metadata_map[key] = metadata;
-        return metadata;
+    } else {
+        metadata = it->second;
     }
-
-    return it->second;
+    pthread_rwlock_unlock(&kargs_lock);
+    last_key = key;
+    last_metadata = metadata;
+    return metadata;
 }
 
 void destroy_kargs_kv()
 {
+    pthread_rwlock_wrlock(&kargs_lock);
     for (auto it = kargs_metadata_map.begin(); it != kargs_metadata_map.end(); it++) {
         delete it->second;
     }
+    kargs_metadata_map.clear();
+    pthread_rwlock_unlock(&kargs_lock);
 }
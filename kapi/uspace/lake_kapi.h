@@ -6,13 +6,62 @@
 
 int lake_init_socket();
 void lake_handle_cmd(void* buf, struct lake_cmd_ret* cmd_ret);
-void lake_recv();
+CUstream lake_cmd_stream(void* buf);
+int64_t lake_cmd_host_offset(void* buf);
+void lake_handler_thread_sync_ctx(void);
+int lake_recv();
 void lake_destroy_socket();
+int lake_socket_fd();
+void lake_send_doorbell();
+void lake_send_reply(uint32_t seq, struct lake_cmd_ret *cmd_ret);
+
+//shared memory ring transport
+struct lake_ring_setup;
+void lake_ring_attach(struct lake_ring_setup *setup);
+int lake_ring_active(void);
+int lake_ring_poll(void);
+void lake_ring_park(void);
+void lake_ring_reply(uint32_t seq, struct lake_cmd_ret *cmd_ret);
+
+//dispatcher: where a command came from, so the reply goes back the same way
+#define LAKE_ORIGIN_NETLINK 0
+#define LAKE_ORIGIN_RING    1
+int lake_dispatch_init(int nworkers, int *cpus, int ncpus);
+void lake_dispatch_fini(void);
+void lake_dispatch(int origin, uint32_t seq, void *cmd, uint32_t size);
+void lake_reply(int origin, uint32_t seq, struct lake_cmd_ret *cmd_ret);
+
+//device backends (backend.c)
+typedef int (*lake_handler_fn)(void* buf, struct lake_cmd_ret* cmd_ret);
+struct lake_backend {
+    const char *name;
+    const lake_handler_fn *handlers;  // indexed by LAKE_API_*
+    uint32_t n_handlers;
+    int (*init)(size_t pool_bytes);
+    void (*thread_sync)(void);        // before a dispatcher worker runs a command, may be NULL
+    CUresult (*get_function)(int hip, void *module, const char *name, void **func);
+};
+extern const struct lake_backend lake_gpu_backend;
+extern const struct lake_backend lake_cpu_backend;
+int lake_backend_select(const char *name, size_t pool_bytes);
+//handlers shared by the backends
+int lake_handler_batch(void* buf, struct lake_cmd_ret* cmd_ret);
+int lake_handler_cuModuleGetFunctions(void* buf, struct lake_cmd_ret* cmd_ret);
+int lake_handler_hipModuleGetFunctions(void* buf, struct lake_cmd_ret* cmd_ret);
+int lake_handler_devpoolStats(void* buf, struct lake_cmd_ret* cmd_ret);
+int lake_handler_devpoolTrim(void* buf, struct lake_cmd_ret* cmd_ret);
+
+//module and function handle cache
+CUresult lake_module_load(int hip, const char *fname, void **module);
+CUresult lake_module_unload(int hip, void *module);
+CUresult lake_module_get_function(int hip, void *module, const char *name, void **func);
+void lake_module_forget(int hip);
 
 //shm helpers
 int lake_shm_init(void);
 void lake_shm_fini(void);
 void *lake_shm_address(const void* offset);
+int lake_shm_node(int64_t offset);
 
 
 #endif
\ No newline at end of file
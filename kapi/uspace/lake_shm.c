@@ -6,22 +6,91 @@
 #include <unistd.h>
 #include <sys/mman.h>
 #include <string.h>
+#include <pthread.h>
 #include "lake_shm.h"
 
-static char *kshm_base = NULL;
+// region i is mapped at kshm_bases[i]; regions added later are mapped on first use
+static char *kshm_bases[KAVA_SHM_MAX_REGIONS];
+static uint64_t kshm_sizes[KAVA_SHM_MAX_REGIONS];
+static int kshm_nodes[KAVA_SHM_MAX_REGIONS];
+static pthread_mutex_t kshm_map_lock = PTHREAD_MUTEX_INITIALIZER;
 static int kshm_fd = 0;
-static uint64_t kshm_size = 0;
+
+static char *lake_shm_map_region(int id)
+{
+    struct kava_shm_regions table;
+    struct kava_shm_region_info *info;
+    char *base;
+
+    pthread_mutex_lock(&kshm_map_lock);
+    base = kshm_bases[id];
+    if (base)
+        goto out;
+
+    if (ioctl(kshm_fd, KAVA_SHM_GET_REGIONS, &table)) {
+        printf("Failed IOCTL to shared memory driver: %s\n", strerror(errno));
+        goto out;
+    }
+    if ((uint32_t)id >= table.count) {
+        printf("Shared memory region %d does not exist\n", id);
+        goto out;
+    }
+    info = &table.regions[id];
+
+    base = (char *)mmap(NULL, info->size, PROT_READ | PROT_WRITE, MAP_SHARED, kshm_fd, info->mmap_offset);
+    if (base == MAP_FAILED) {
+        printf("Failed to mmap shared memory region %d: %s\n", id, strerror(errno));
+        base = NULL;
+        goto out;
+    }
+    printf("mmap shared memory region %d (node %d) to 0x%lx, size=0x%lx\n",
+            id, info->node, (uintptr_t)base, info->size);
+    kshm_sizes[id] = info->size;
+    kshm_nodes[id] = info->node;
+    __atomic_store_n(&kshm_bases[id], base, __ATOMIC_RELEASE);
+
+out:
+    pthread_mutex_unlock(&kshm_map_lock);
+    return base;
+}
 
 void *lake_shm_address(const void* ptr_offset)
 {
     int64_t offset = (int64_t) ptr_offset;
-    //printf("Translating offset %lld\n", offset);
-    return (void *)(kshm_base + offset);
+    int id = kava_shm_region_of(offset);
+    char *base;
+
+    if (id >= KAVA_SHM_MAX_REGIONS) {
+        printf("Bad shared memory offset 0x%lx\n", offset);
+        return NULL;
+    }
+    base = __atomic_load_n(&kshm_bases[id], __ATOMIC_ACQUIRE);
+    if (!base) {
+        base = lake_shm_map_region(id);
+        if (!base)
+            return NULL;
+    }
+    return (void *)(base + (offset & KAVA_SHM_OFFSET_MASK));
+}
+
+// NUMA node the memory at a shared memory offset lives on, -1 if unknown or any
+int lake_shm_node(int64_t offset)
+{
+    int id = kava_shm_region_of(offset);
+
+    if (offset < 0 || id >= KAVA_SHM_MAX_REGIONS)
+        return -1;
+    if (!__atomic_load_n(&kshm_bases[id], __ATOMIC_ACQUIRE) && !lake_shm_map_region(id))
+        return -1;
+    return kshm_nodes[id];
 }
 
 int lake_shm_init(void)
 {
     char dev_name[64];
+    struct kava_shm_regions table;
+    uint32_t i;
+
     sprintf(dev_name, "/dev/%s", KAVA_SHM_DEV_NAME);
     kshm_fd = open(dev_name, O_RDWR);
 
@@ -31,23 +100,17 @@ int lake_shm_init(void)
         return errno;
     }
 
-    int ret = ioctl(kshm_fd, KAVA_SHM_GET_SHM_SIZE, &kshm_size);
+    int ret = ioctl(kshm_fd, KAVA_SHM_GET_REGIONS, &table);
     if (ret) {
         printf("Failed IOCTL to shared memory driver\n");
         return ret;
     }
-    else {
-        printf("Request shared memory size: %lu MB   %lu\n", kshm_size>>20, kshm_size);
-    }
 
-    kshm_base = (char *)mmap(NULL, kshm_size, PROT_READ | PROT_WRITE, MAP_SHARED, kshm_fd, 0);
-    if (kshm_base == MAP_FAILED) {
-        printf("Failed to mmap shared memory regionn\n");
-        return (int)(uintptr_t)kshm_base;
-    }
-    else {
-        printf("mmap shared memory region to 0x%lx, size=0x%lx\n",
-                (uintptr_t)kshm_base, kshm_size);
+    for (i = 0; i < table.count; i++) {
+        printf("Request shared memory region %u size: %lu MB   %lu\n", i,
+                table.regions[i].size >> 20, table.regions[i].size);
+        if (!lake_shm_map_region(i))
+            return -1;
     }
 
     return 0;
@@ -55,9 +118,13 @@ int lake_shm_init(void)
 
 void lake_shm_fini(void)
 {
-    if (kshm_fd > 0 && kshm_base) {
-        munmap(kshm_base, kshm_size);
-        kshm_base = NULL;
+    int i;
+
+    for (i = 0; i < KAVA_SHM_MAX_REGIONS; i++) {
+        if (kshm_bases[i]) {
+            munmap(kshm_bases[i], kshm_sizes[i]);
+            kshm_bases[i] = NULL;
+        }
     }
 
     if (kshm_fd > 0) {
@@ -1,13 +1,41 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 #include <signal.h>
+#include <sched.h>
+#include <time.h>
 #include "lake_kapi.h"
+#include "lake_numa.h"
+#include "lake_ring.h"
+#include "poller.h"
+
+#define MAX_CPUS 256
+#define DEFAULT_POOL_MB 1024
+#define DEFAULT_SPIN_US 50
+#ifdef LAKE_CPU_ONLY
+#define DEFAULT_BACKEND "cpu"
+#else
+#define DEFAULT_BACKEND "gpu"
+#endif
 
 volatile sig_atomic_t stop_running = 0;
+static struct lake_poller poller;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
 
 void exit_handler(int dummy) {
     stop_running = 1;
+    printf("Receive loop: %lu arrivals, %lu caught spinning, %lu parks, %lu ms spent spinning\n",
+            (unsigned long) poller.stats.arrivals, (unsigned long) poller.stats.spin_hits,
+            (unsigned long) poller.stats.parks, (unsigned long) (poller.stats.spin_ns / 1000000));
     //TODO: sock is blocking, so it never quits the loop, just quit here
     sleep(1);
     lake_destroy_socket();
@@ -15,17 +43,131 @@ void exit_handler(int dummy) {
     exit(0);
 }
 
-int main() {
+static void usage(const char *prog) {
+    printf("usage: %s [-w workers] [-c cpu,cpu,...|numa] [-p MB] [-b gpu|cpu] [-s us] [-f]\n", prog);
+    printf("  -w  number of dispatcher worker threads, 0 runs commands in the receive loop (default 0)\n");
+    printf("  -c  cpus to pin to: the receive loop takes the first one, workers the following ones\n");
+    printf("      numa: the receive loop and worker 0 on node 0, stream workers spread over the nodes\n");
+    printf("  -p  freed device memory kept for reuse per API, 0 frees right away (default %d)\n",
+            DEFAULT_POOL_MB);
+    printf("  -b  device backend: gpu calls the drivers, cpu emulates the device on the host (default %s)\n",
+            DEFAULT_BACKEND);
+    printf("  -s  longest the receive loop polls after a command before it sleeps, 0 always sleeps (default %d)\n",
+            DEFAULT_SPIN_US);
+    printf("  -f  always poll that long, instead of adapting to the gaps between commands\n");
+}
+
+static int parse_cpus(char *list, int *cpus) {
+    int n = 0;
+    char *tok = strtok(list, ",");
+    while (tok && n < MAX_CPUS) {
+        cpus[n++] = atoi(tok);
+        tok = strtok(NULL, ",");
+    }
+    return n;
+}
+
+/*
+ * Stream workers go round robin over the nodes, so every node with shared
+ * memory has a worker to run the streams whose buffers live there.
+ * Returns the number of cpus, one per thread (worker i takes cpus[i + 1]).
+ */
+static int numa_cpus(int nworkers, int *cpus) {
+    int node_cpus[LAKE_NUMA_MAX_NODES][MAX_CPUS];
+    int node_n[LAKE_NUMA_MAX_NODES], used[LAKE_NUMA_MAX_NODES] = { 0 };
+    int nnodes = lake_numa_nodes(), node, i, n = 0, k;
+
+    if (nnodes > LAKE_NUMA_MAX_NODES)
+        nnodes = LAKE_NUMA_MAX_NODES;
+    for (node = 0; node < nnodes; node++)
+        node_n[node] = lake_node_cpus(node, node_cpus[node], MAX_CPUS);
+    if (!node_n[0])
+        return 0;
+
+    // receive loop, then worker 0
+    cpus[n++] = node_cpus[0][used[0]++ % node_n[0]];
+    cpus[n++] = node_cpus[0][used[0]++ % node_n[0]];
+    for (i = 1; i < nworkers && n < MAX_CPUS; i++) {
+        // skip nodes without cpus (memory only)
+        for (k = 0; k < nnodes; k++) {
+            node = (i - 1 + k) % nnodes;
+            if (node_n[node])
+                break;
+        }
+        cpus[n++] = node_cpus[node][used[node]++ % node_n[node]];
+    }
+    return n;
+}
+
+int main(int argc, char **argv) {
+    int nworkers = 0, ncpus = 0, opt, numa = 0, adaptive = 1, n;
+    uint64_t spin_us = DEFAULT_SPIN_US;
+    size_t pool_mb = DEFAULT_POOL_MB;
+    const char *backend = DEFAULT_BACKEND;
+    int cpus[MAX_CPUS];
+
+    while ((opt = getopt(argc, argv, "w:c:p:b:s:fh")) != -1) {
+        switch (opt) {
+        case 'w':
+            nworkers = atoi(optarg);
+            break;
+        case 'c':
+            if (strcmp(optarg, "numa") == 0)
+                numa = 1;
+            else
+                ncpus = parse_cpus(optarg, cpus);
+            break;
+        case 'p':
+            pool_mb = strtoul(optarg, NULL, 0);
+            break;
+        case 'b':
+            backend = optarg;
+            break;
+        case 's':
+            spin_us = strtoul(optarg, NULL, 0);
+            break;
+        case 'f':
+            adaptive = 0;
+            break;
+        default:
+            usage(argv[0]);
+            return opt == 'h' ? 0 : 1;
+        }
+    }
+
+    if (numa)
+        ncpus = numa_cpus(nworkers, cpus);
+
+    if (ncpus > 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpus[0], &set);
+        if (sched_setaffinity(0, sizeof(set), &set))
+            printf("Could not pin receive loop to cpu %d\n", cpus[0]);
+    }
+
     signal(SIGINT, exit_handler);
     printf("Starting uspace lake kapi with pid %d\n", getpid());
+    if (lake_backend_select(backend, pool_mb << 20))
+        return 1;
+    if (lake_dispatch_init(nworkers, cpus, ncpus))
+        return 1;
     lake_init_socket();
     lake_shm_init();
 
+    lake_poller_init(&poller, spin_us * 1000, adaptive);
     while(!stop_running) {
-        lake_recv();
+        n = lake_recv();
+        if (lake_ring_active())
+            n += lake_ring_poll();
+        if (n)
+            lake_poller_activity(&poller, now_ns());
+        else if (lake_poller_idle(&poller, now_ns()))
+            lake_ring_park();
+        else
+            lake_ring_relax();
     }
     printf("Quitting\n");
     //lake_destroy_socket();
     return 0;
 }
-
@@ -0,0 +1,234 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <cuda.h>
+#include <hip_runtime_api_mini.h>
+#include "commands.h"
+#include "lake_kapi.h"
+#include "kargs.h"
+
+/*
+ * Module and function handle cache.
+ *
+ * Kernel modules load their code objects and resolve their kernels at
+ * init, and a module loaded again (failover, a new build of the .ko only)
+ * asks for the same files and names. Loaded modules are kept by API, path
+ * and file identity (device, inode, size, mtime), so loading an unchanged
+ * file returns the handle it got last time without the driver reading
+ * and parsing the code object again. Resolved functions are kept by
+ * module and name, with their arguments already parsed.
+ *
+ * Unload only drops a reference: an unused module stays loaded until its
+ * file changes or its slot is needed. Loading a file that changed gets a
+ * new module, the old one is unloaded once it is unused. Destroying a
+ * context takes its modules with it, so the ctx-destroy handlers forget
+ * every cached handle of that API.
+ *
+ * Loads are rare, everything runs under one lock.
+ */
+
+#define MODCACHE_MODULES   32
+#define MODCACHE_FUNCTIONS 256
+
+struct modcache_module {
+    void *module;      // NULL if the slot is free
+    int hip;
+    int stale;         // its file changed, unload when unused
+    unsigned int refs;
+    uint64_t last_used;
+    dev_t dev;
+    ino_t ino;
+    off_t size;
+    struct timespec mtime;
+    char path[256];
+};
+
+struct modcache_function {
+    void *module;      // NULL if the slot is free
+    int hip;
+    void *func;
+    char name[256];
+};
+
+static struct modcache_module modules[MODCACHE_MODULES];
+static struct modcache_function functions[MODCACHE_FUNCTIONS];
+static unsigned int next_function = 0;
+static uint64_t use_clock = 0;
+static pthread_mutex_t modcache_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static CUresult driver_load(int hip, const char *fname, void **module) {
+    if (hip)
+        return (CUresult) hipModuleLoad((hipModule_t *) module, fname);
+    return cuModuleLoad((CUmodule *) module, fname);
+}
+
+static CUresult driver_unload(int hip, void *module) {
+    if (hip)
+        return (CUresult) hipModuleUnload((hipModule_t) module);
+    return cuModuleUnload((CUmodule) module);
+}
+
+static CUresult driver_get_function(int hip, void *module, const char *name, void **func) {
+    if (hip)
+        return (CUresult) hipModuleGetFunction((hipFunction_t *) func, (hipModule_t) module, name);
+    return cuModuleGetFunction((CUfunction *) func, (CUmodule) module, name);
+}
+
+static void drop_functions(void *module) {
+    int i;
+    for (i = 0; i < MODCACHE_FUNCTIONS; i++) {
+        if (functions[i].module == module)
+            functions[i].module = NULL;
+    }
+}
+
+static void evict(struct modcache_module *m) {
+    drop_functions(m->module);
+    driver_unload(m->hip, m->module);
+    m->module = NULL;
+}
+
+static int same_file(struct modcache_module *m, struct stat *st) {
+    return m->dev == st->st_dev && m->ino == st->st_ino && m->size == st->st_size &&
+        m->mtime.tv_sec == st->st_mtim.tv_sec && m->mtime.tv_nsec == st->st_mtim.tv_nsec;
+}
+
+// a free slot, or the least recently used idle one after unloading it
+static struct modcache_module *take_slot(void) {
+    struct modcache_module *lru = NULL;
+    int i;
+
+    for (i = 0; i < MODCACHE_MODULES; i++) {
+        if (!modules[i].module)
+            return &modules[i];
+        if (!modules[i].refs && (!lru || modules[i].last_used < lru->last_used))
+            lru = &modules[i];
+    }
+    if (lru)
+        evict(lru);
+    return lru;
+}
+
+static struct modcache_module *find_module(void *module) {
+    int i;
+    for (i = 0; i < MODCACHE_MODULES; i++) {
+        if (modules[i].module && modules[i].module == module)
+            return &modules[i];
+    }
+    return NULL;
+}
+
+CUresult lake_module_load(int hip, const char *fname, void **module) {
+    struct modcache_module *m;
+    struct stat st;
+    CUresult res;
+    int i;
+
+    // without a file identity there is nothing to key on, let the driver report it
+    if (stat(fname, &st) || strlen(fname) >= sizeof(m->path))
+        return driver_load(hip, fname, module);
+
+    pthread_mutex_lock(&modcache_lock);
+    for (i = 0; i < MODCACHE_MODULES; i++) {
+        m = &modules[i];
+        if (!m->module || m->stale || m->hip != hip || strcmp(m->path, fname))
+            continue;
+        if (same_file(m, &st)) {
+            m->refs++;
+            m->last_used = ++use_clock;
+            *module = m->module;
+            pthread_mutex_unlock(&modcache_lock);
+            return CUDA_SUCCESS;
+        }
+        // the file changed: new loads get a new module
+        if (m->refs)
+            m->stale = 1;
+        else
+            evict(m);
+    }
+
+    res = driver_load(hip, fname, module);
+    if (res == CUDA_SUCCESS) {
+        m = take_slot();
+        if (m) {
+            m->module = *module;
+            m->hip = hip;
+            m->stale = 0;
+            m->refs = 1;
+            m->last_used = ++use_clock;
+            m->dev = st.st_dev;
+            m->ino = st.st_ino;
+            m->size = st.st_size;
+            m->mtime = st.st_mtim;
+            strcpy(m->path, fname);
+        }
+    }
+    pthread_mutex_unlock(&modcache_lock);
+    return res;
+}
+
+CUresult lake_module_unload(int hip, void *module) {
+    struct modcache_module *m;
+    CUresult res = CUDA_SUCCESS;
+
+    pthread_mutex_lock(&modcache_lock);
+    m = find_module(module);
+    if (!m) {
+        // loaded while the cache was full
+        drop_functions(module);
+        res = driver_unload(hip, module);
+    } else if (m->refs && --m->refs == 0 && m->stale) {
+        evict(m);
+    }
+    pthread_mutex_unlock(&modcache_lock);
+    return res;
+}
+
+CUresult lake_module_get_function(int hip, void *module, const char *name, void **func) {
+    struct modcache_function *f;
+    CUresult res;
+    int i;
+
+    pthread_mutex_lock(&modcache_lock);
+    for (i = 0; i < MODCACHE_FUNCTIONS; i++) {
+        f = &functions[i];
+        if (f->module == module && strcmp(f->name, name) == 0) {
+            *func = f->func;
+            pthread_mutex_unlock(&modcache_lock);
+            return CUDA_SUCCESS;
+        }
+    }
+
+    res = driver_get_function(hip, module, name, func);
+    if (res == CUDA_SUCCESS) {
+        kava_parse_function_args(name, get_kargs(*func));
+        // a full table just costs a lookup, replace entries in turn
+        if (strlen(name) < sizeof(f->name)) {
+            f = &functions[next_function++ % MODCACHE_FUNCTIONS];
+            f->module = module;
+            f->hip = hip;
+            f->func = *func;
+            strcpy(f->name, name);
+        }
+    }
+    pthread_mutex_unlock(&modcache_lock);
+    return res;
+}
+
+// the context went away with its modules: drop every handle of this API without unloading it
+void lake_module_forget(int hip) {
+    int i;
+
+    pthread_mutex_lock(&modcache_lock);
+    for (i = 0; i < MODCACHE_MODULES; i++) {
+        if (modules[i].module && modules[i].hip == hip)
+            modules[i].module = NULL;
+    }
+    for (i = 0; i < MODCACHE_FUNCTIONS; i++) {
+        if (functions[i].module && functions[i].hip == hip)
+            functions[i].module = NULL;
+    }
+    pthread_mutex_unlock(&modcache_lock);
+}
@@ -1,83 +1,192 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <errno.h>
 #include <unistd.h>
 #include <inttypes.h>
+#include <sys/socket.h>
 #include <linux/netlink.h>
 #include <netlink/netlink.h>
 #include <netlink/msg.h>
 #include <signal.h>
+#include <pthread.h>
 #include "netlink.h"
 #include "commands.h"
 #include "lake_kapi.h"
 
 static struct nl_sock *sk = NULL;
+static int sk_fd = -1;
+static uint32_t sk_port;
 
-static void lake_send_cmd(uint32_t seqn, void* buf, size_t len) {
-    int err;
-    struct nl_msg *msg;
-    struct nlmsghdr *nlh;
+/*
+ * The receive loop drains up to NL_RECV_BATCH datagrams per recvmmsg, each
+ * may carry several messages. While it handles them, replies are not sent
+ * one by one: they are appended to a preallocated buffer and go to the
+ * kernel in one sendmsg when the drain is over (or the buffer is full),
+ * several netlink messages in one skb. Replies from dispatcher workers
+ * join the batch if a drain is running, or are sent right away otherwise.
+ */
+#define NL_RECV_BATCH 32
+#define NL_RECV_BUF   (64 << 10)
+#define NL_REPLY_BUF  (64 << 10)
 
-    msg = nlmsg_alloc_simple(MSG_LAKE_KAPI_REP, 0);
-    if (!msg)
-        printf("error on nlmsg_alloc_simple\n");
-   
-    if(buf && len) {
-        err = nlmsg_append(msg, buf, len, NLMSG_ALIGNTO);
-        if (err < 0)
-            printf("error on nlmsg_append %d\n", err);
-    }
+static struct mmsghdr recv_msgs[NL_RECV_BATCH];
+static struct iovec recv_iov[NL_RECV_BATCH];
+static char *recv_bufs;
 
-    nl_complete_msg(sk, msg);
-   
-    nlh = nlmsg_hdr(msg);
-    nlh->nlmsg_seq = seqn;
-    err = nl_send(sk, msg);
-    if(err < 0)
-        printf("error on nl_send %d\n", err);
+// replies can come from any dispatcher worker
+static pthread_mutex_t send_lock = PTHREAD_MUTEX_INITIALIZER;
+static char reply_buf[NL_REPLY_BUF] __attribute__((aligned(NLMSG_ALIGNTO)));
+static size_t reply_len;
+static int draining;
 
-    nlmsg_free(msg);
+static struct {
+    uint64_t recv_calls, recv_msgs;
+    uint64_t send_calls, send_msgs;
+} nl_stats;
+
+static void flush_replies_locked(void) {
+    struct sockaddr_nl kernel = { AF_NETLINK, 0, 0, 0 };
+    struct iovec iov = { reply_buf, reply_len };
+    struct msghdr msg;
+
+    if (!reply_len)
+        return;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_name = &kernel;
+    msg.msg_namelen = sizeof(kernel);
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    if (sendmsg(sk_fd, &msg, 0) < 0)
+        perror("error on netlink sendmsg");
+    nl_stats.send_calls++;
+    reply_len = 0;
 }
 
-static int netlink_recv_msg(struct nl_msg *msg, void *arg) {
+static void lake_send_msg(int type, uint32_t seqn, void* buf, size_t len) {
     struct nlmsghdr *nlh;
-    nlh = nlmsg_hdr(msg);
+    size_t size = NLMSG_SPACE(len);
+
+    pthread_mutex_lock(&send_lock);
+    if (reply_len + size > NL_REPLY_BUF)
+        flush_replies_locked();
+    nlh = (struct nlmsghdr *) (reply_buf + reply_len);
+    nlh->nlmsg_len = NLMSG_LENGTH(len);
+    nlh->nlmsg_type = type;
+    nlh->nlmsg_flags = NLM_F_REQUEST;
+    nlh->nlmsg_seq = seqn;
+    nlh->nlmsg_pid = sk_port;
+    if (buf && len)
+        memcpy(NLMSG_DATA(nlh), buf, len);
+    reply_len += size;
+    nl_stats.send_msgs++;
+    if (!draining)
+        flush_replies_locked();
+    pthread_mutex_unlock(&send_lock);
+}
+
+void lake_send_reply(uint32_t seq, struct lake_cmd_ret *cmd_ret) {
+    if (cmd_ret->res != 0) {
+        printf("CUDA API failed, returned %d\n", cmd_ret->res);
+    }
+    lake_send_msg(MSG_LAKE_KAPI_REP, seq, cmd_ret, sizeof(*cmd_ret));
+}
+
+void lake_send_doorbell() {
+    lake_send_msg(MSG_LAKE_KAPI_DOORBELL, 0, 0, 0);
+}
+
+static void netlink_recv_msg(struct nlmsghdr *nlh) {
     uint32_t seq = nlh->nlmsg_seq;
-    //printf("received msg with seq %u\n", seq);
-    void* data = nlmsg_data(nlh);
-    struct lake_cmd_ret cmd_ret;
-    lake_handle_cmd(data, &cmd_ret);
-    //printf("command handled, replying\n");
-    if (cmd_ret.res != 0) {
-        printf("CUDA API failed, returned %d\n", cmd_ret.res);
+    void* data = NLMSG_DATA(nlh);
+
+    if (nlh->nlmsg_type < NLMSG_MIN_TYPE)
+        return;
+    if (nlh->nlmsg_type == MSG_LAKE_KAPI_RING_SETUP) {
+        lake_ring_attach((struct lake_ring_setup*) data);
+        return;
     }
-    lake_send_cmd(seq, &cmd_ret, sizeof(cmd_ret));
+    // a doorbell only has to wake us up, the ring is drained by the main loop
+    if (nlh->nlmsg_type == MSG_LAKE_KAPI_DOORBELL)
+        return;
+
+    lake_dispatch(LAKE_ORIGIN_NETLINK, seq, data, nlh->nlmsg_len - NLMSG_HDRLEN);
 }
 
 void lake_destroy_socket() {
+    if (nl_stats.send_calls)
+        printf("Netlink: %" PRIu64 " messages in %" PRIu64 " receives, %" PRIu64 " replies in %" PRIu64
+                " sends (%.2f per send)\n", nl_stats.recv_msgs, nl_stats.recv_calls, nl_stats.send_msgs,
+                nl_stats.send_calls, (double) nl_stats.send_msgs / nl_stats.send_calls);
     nl_socket_free(sk);
+    free(recv_bufs);
 }
 
-void lake_recv() {
-    nl_recvmsgs_default(sk);
+// returns the number of messages handled
+int lake_recv() {
+    struct nlmsghdr *nlh;
+    int n, i, len, handled = 0;
+
+    n = recvmmsg(sk_fd, recv_msgs, NL_RECV_BATCH, MSG_DONTWAIT, NULL);
+    if (n <= 0) {
+        if (n < 0 && errno != EAGAIN && errno != EINTR)
+            perror("error on netlink recvmmsg");
+        return 0;
+    }
+    nl_stats.recv_calls++;
+
+    pthread_mutex_lock(&send_lock);
+    draining = 1;
+    pthread_mutex_unlock(&send_lock);
+
+    for (i = 0; i < n; i++) {
+        if (recv_msgs[i].msg_hdr.msg_flags & MSG_TRUNC)
+            printf("Netlink message larger than %d bytes, dropped\n", NL_RECV_BUF);
+        len = recv_msgs[i].msg_len;
+        for (nlh = (struct nlmsghdr *) recv_iov[i].iov_base; NLMSG_OK(nlh, len); nlh = NLMSG_NEXT(nlh, len)) {
+            netlink_recv_msg(nlh);
+            handled++;
+        }
+    }
+    nl_stats.recv_msgs += handled;
+
+    pthread_mutex_lock(&send_lock);
+    draining = 0;
+    flush_replies_locked();
+    pthread_mutex_unlock(&send_lock);
+    return handled;
+}
+
+int lake_socket_fd() {
+    return nl_socket_get_fd(sk);
 }
 
 int lake_init_socket() {
     int err;
     int retry_count = 0;
     const int max_retries = 10;
+    int i;
 
     sk = nl_socket_alloc();
-    if (!sk) {
+    recv_bufs = (char *) malloc((size_t) NL_RECV_BATCH * NL_RECV_BUF);
+    if (!sk || !recv_bufs) {
         fprintf(stderr, "Error allocating netlink socket\n");
         return -1;
     }
-    
-    nl_socket_modify_cb(sk, NL_CB_VALID, NL_CB_CUSTOM, netlink_recv_msg, NULL);
+    for (i = 0; i < NL_RECV_BATCH; i++) {
+        recv_iov[i].iov_base = recv_bufs + (size_t) i * NL_RECV_BUF;
+        recv_iov[i].iov_len = NL_RECV_BUF;
+        recv_msgs[i].msg_hdr.msg_iov = &recv_iov[i];
+        recv_msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
     nl_socket_disable_seq_check(sk);
     
     // Increase buffer size to improve performance
     nl_socket_set_buffer_size(sk, 2*1024*1024, 2*1024*1024);
-    nl_socket_set_msg_buf_size(sk, 2*1024*1024);
 
     nl_socket_disable_auto_ack(sk);
     nl_socket_set_passcred(sk, 0);
@@ -106,8 +215,10 @@ int lake_init_socket() {
         return -1;
     }
 
+    sk_fd = nl_socket_get_fd(sk);
+    sk_port = nl_socket_get_local_port(sk);
     //ping so kernel can get our pid
-    lake_send_cmd(0, 0, 0);
+    lake_send_msg(MSG_LAKE_KAPI_REP, 0, 0, 0);
     printf("Netlink connected, message sent to kernel\n");
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,62 @@
+#include <string.h>
+#include "poller.h"
+
+void lake_poller_init(struct lake_poller *p, uint64_t spin_max_ns, int adaptive) {
+    int i;
+
+    memset(p, 0, sizeof(*p));
+    p->spin_max_ns = spin_max_ns;
+    p->adaptive = adaptive;
+    // start large, like the predictors do
+    for (i = 0; i < POLLER_IA_SZ; i++)
+        p->ia[i] = spin_max_ns;
+}
+
+static uint64_t spin_budget(struct lake_poller *p) {
+    uint64_t avg = 0, min = p->spin_max_ns >> 3;
+    int i;
+
+    if (!p->adaptive)
+        return p->spin_max_ns;
+    for (i = 0; i < POLLER_IA_SZ; i++)
+        avg += p->ia[i];
+    avg >>= POLLER_IA_SHIFT;
+    if (avg > p->spin_max_ns)
+        return min;
+    avg *= 2;
+    if (avg < min)
+        return min;
+    return avg < p->spin_max_ns ? avg : p->spin_max_ns;
+}
+
+void lake_poller_activity(struct lake_poller *p, uint64_t now) {
+    uint64_t gap;
+
+    if (!p->idle_since)
+        return;
+    gap = now - p->idle_since;
+    p->stats.arrivals++;
+    if (!p->parked) {
+        p->stats.spin_hits++;
+        p->stats.spin_ns += gap;
+    }
+    p->ia_cur = (p->ia_cur + 1) % POLLER_IA_SZ;
+    p->ia[p->ia_cur] = gap;
+    p->idle_since = 0;
+    p->parked = 0;
+}
+
+int lake_poller_idle(struct lake_poller *p, uint64_t now) {
+    if (!p->idle_since) {
+        p->idle_since = now;
+        p->budget_ns = spin_budget(p);
+    }
+    if (!p->parked) {
+        if (now - p->idle_since < p->budget_ns)
+            return 0;
+        p->stats.spin_ns += now - p->idle_since;
+        p->parked = 1;
+    }
+    p->stats.parks++;
+    return 1;
+}
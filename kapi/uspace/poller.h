@@ -0,0 +1,48 @@
+#ifndef __LAKE_USPACE_POLLER_H__
+#define __LAKE_USPACE_POLLER_H__
+
+#include <stdint.h>
+
+/*
+ * Spin-then-park policy of the receive loop. After the loop found work it
+ * keeps polling for a while before it parks on the socket: a command that
+ * comes in while it spins is picked up without a scheduler wakeup, one
+ * that comes later pays for the wakeup but no core burns meanwhile.
+ *
+ * The spin budget follows the idle gaps the loop saw before its last few
+ * arrivals, averaged like the inter-arrival times of the LinnOS predictors
+ * (linnos_mix/predictors.c): twice the average gap when that is within
+ * spin_max_ns, so the next command is likely caught spinning, and only
+ * spin_max_ns / 8 when commands come further apart than a spin could wait.
+ * spin_max_ns 0 parks right away; without adaptive the loop always spins
+ * spin_max_ns. Knows nothing about sockets or rings, so test/test_poller.c
+ * can drive it.
+ */
+#define POLLER_IA_SZ    4
+#define POLLER_IA_SHIFT 2
+
+struct lake_poller_stats {
+    uint64_t arrivals;     // times the loop found work after being idle
+    uint64_t spin_hits;    // ... while spinning
+    uint64_t parks;
+    uint64_t spin_ns;      // time spent spinning
+};
+
+struct lake_poller {
+    uint64_t spin_max_ns;
+    int adaptive;
+    uint64_t ia[POLLER_IA_SZ];
+    unsigned int ia_cur;
+    uint64_t budget_ns;    // spin of the current idle period
+    uint64_t idle_since;   // 0 while there is work
+    int parked;
+    struct lake_poller_stats stats;
+};
+
+void lake_poller_init(struct lake_poller *p, uint64_t spin_max_ns, int adaptive);
+// the loop found work
+void lake_poller_activity(struct lake_poller *p, uint64_t now);
+// the loop found nothing: 1 if it should park now, 0 to poll again
+int lake_poller_idle(struct lake_poller *p, uint64_t now);
+
+#endif
@@ -0,0 +1,71 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <poll.h>
+#include <pthread.h>
+#include "commands.h"
+#include "lake_ring.h"
+#include "lake_kapi.h"
+
+// upper bound on a park, so SIGINT gets noticed
+#define RING_PARK_MS  100
+
+static struct lake_ring *cmd_ring = NULL;
+static struct lake_ring *ret_ring = NULL;
+// replies can come from any dispatcher worker
+static pthread_mutex_t reply_lock = PTHREAD_MUTEX_INITIALIZER;
+
+void lake_ring_attach(struct lake_ring_setup *setup) {
+    cmd_ring = (struct lake_ring*) lake_shm_address((void*) setup->cmd_ring);
+    ret_ring = (struct lake_ring*) lake_shm_address((void*) setup->ret_ring);
+    printf("Using shared memory rings (cmd %u x %u, ret %u x %u)\n",
+            cmd_ring->nslots, cmd_ring->slot_size, ret_ring->nslots, ret_ring->slot_size);
+}
+
+int lake_ring_active(void) {
+    return cmd_ring != NULL;
+}
+
+void lake_ring_reply(uint32_t seq, struct lake_cmd_ret *cmd_ret) {
+    pthread_mutex_lock(&reply_lock);
+    while (lake_ring_push(ret_ring, seq, cmd_ret, sizeof(*cmd_ret)) == -1) {
+        // the kernel poller is behind, make sure it is awake
+        if (lake_ring_need_doorbell(ret_ring))
+            lake_send_doorbell();
+        lake_ring_relax();
+    }
+    pthread_mutex_unlock(&reply_lock);
+    if (lake_ring_need_doorbell(ret_ring))
+        lake_send_doorbell();
+}
+
+// drains the command ring, returns the number of commands handled
+int lake_ring_poll(void) {
+    struct lake_ring_slot *slot;
+    int n = 0;
+
+    while ((slot = lake_ring_peek(cmd_ring)) != NULL) {
+        // the dispatcher copies (or runs) the command, then the slot can go
+        lake_dispatch(LAKE_ORIGIN_RING, slot->seq, slot->data, slot->size);
+        lake_ring_pop(cmd_ring);
+        n++;
+    }
+    return n;
+}
+
+/*
+ * Called by the main loop when its spin budget (poller.c) ran out. Parks
+ * on the netlink socket until a netlink command comes in or, with the
+ * rings up, the kernel rings the doorbell.
+ */
+void lake_ring_park(void) {
+    struct pollfd pfd;
+
+    if (!cmd_ring || lake_ring_prepare_sleep(cmd_ring)) {
+        pfd.fd = lake_socket_fd();
+        pfd.events = POLLIN;
+        poll(&pfd, 1, RING_PARK_MS);
+    }
+    if (cmd_ring)
+        lake_ring_finish_sleep(cmd_ring);
+}
@@ -33,6 +33,7 @@
 #include <asm/fpu/api.h>
 #include <linux/string.h>
 #include "lake_shm.h"
+#include "lake_pk.h"
 #include "cpu.h"
 #else
 
@@ -609,6 +610,9 @@ static int run_dgpu(void) {
 
 
 
+// fused_forward_persistent writes 3 into the task flag once a batch is done
+#define KML_PK_DONE 3
+
 static int run_persistent(void) {
     int i, j, x;
     //const int n = 1024;
@@ -632,32 +636,25 @@ static int run_persistent(void) {
     gpu_get_cufunc(hsaco_path, "_Z26normalize_fused_persistentiPfS_S_S_S_S_PiS0_", &normalize_fused_persistent);
     gpu_get_cufunc(hsaco_path, "_Z24fused_forward_persistentPfPiiS_S_S_S_S_S_S_S_S_S_S_S_S0_S0_", &fused_forward_persistent);
     setup_gpu(0);
-    // Create two different streams
-    hipStream_t stream1, stream2;
-    #ifdef __KERNEL__
-    check_error(hipStreamCreate(&stream1,0), "hipStreamCreate stream1", __LINE__);
-    check_error(hipStreamCreate(&stream2,0), "hipStreamCreate stream2", __LINE__);
-    #else
-    check_error(hipStreamCreate(&stream1), "hipStreamCreate stream1", __LINE__);
-    check_error(hipStreamCreate(&stream2), "hipStreamCreate stream2", __LINE__);
-    #endif
     comp_run_times = (u64*) vmalloc(RUNS*sizeof(u64));
     total_run_times = (u64*) vmalloc(RUNS*sizeof(u64));
-    // persistent kernel synchronization flag
-    int* h_task_flag_1 = (int*)kava_alloc(sizeof(int));
-    int* h_quit_flag = (int*)kava_alloc(sizeof(int));
-    hipHostRegister(h_task_flag_1, sizeof(int), hipHostRegisterMapped | hipExtHostRegisterCoarseGrained);
-    hipHostRegister(h_quit_flag, sizeof(int), hipHostRegisterMapped);
-    void* d_task_flag_1; hipHostGetDevicePointer(&d_task_flag_1, h_task_flag_1, 0);
-    void* d_quit_flag; hipHostGetDevicePointer(&d_quit_flag, h_quit_flag, 0);
+    // persistent kernel mailbox, each stage gets its own stream
+    struct lake_pk *pk = lake_pk_create(KML_PK_DONE);
+    if (!pk) {
+        PRINT("Failed to create persistent kernel mailbox\n");
+        vfree(comp_run_times);
+        vfree(total_run_times);
+        return -1;
+    }
+    void* d_task_flag_1;
+    void* d_quit_flag;
+    lake_pk_device_ptrs(pk, &d_task_flag_1, &d_quit_flag, NULL);
 
 
     // Track resources allocated within the loop
     void *h_inputs_mapped = NULL;
     
     for (i = 0 ; i < n_batches ; i++) {
-        // Reset synchronization flag before each batch starts
-        *h_task_flag_1 = 0; *h_quit_flag = 0;
         batch_size = batch_sizes[i];
         
         // // Free resources allocated in the previous iteration (if any)
@@ -723,12 +720,12 @@ static int run_persistent(void) {
             &batch_size, &d_inputs_mapped, &d_intital_stats, &local_average,&readahead_norm_online_data_last_values, &local_variance, &d_readahead_norm_online_data,&d_task_flag_1, &d_quit_flag};
             int blocks = (batch_size+159) / 160; //ceil
             int tpb = batch_size < 160 ? 32 : 160; //at least 32 threads, at most 160 (32*5)
-            check_error(hipModuleLaunchKernel(normalize_fused_persistent, 
+            check_error(lake_pk_launch(pk, normalize_fused_persistent, 
 				blocks, 1, 1,          //blocks
 				tpb, 1, 1,   //threads per block
 				0,   //shared mem
-                stream1, fargs, NULL),
-			"hipModuleLaunchKernel stream1", __LINE__);
+                fargs),
+			"lake_pk_launch normalize", __LINE__);
         // Launch persistent kernel 2 - run on stream2
         void *args[] = {
 		    &d_readahead_norm_online_data, &d_result_mapped, &batch_size,
@@ -739,36 +736,30 @@ static int run_persistent(void) {
 	        };
             int sync=0;
             int zg = sync == 0 ? 1 : 69; 
-            check_error(hipModuleLaunchKernel( fused_forward_persistent, 
+            check_error(lake_pk_launch(pk, fused_forward_persistent, 
 				batch_size, 1, zg,          //blocks
 				16, 1, 1,   //threads per block
 				0,   //shared mem
-                stream2, args, NULL),
-			"hipModuleLaunchKernel stream2", __LINE__);
+                args),
+			"lake_pk_launch forward", __LINE__);
                 // do some warmup
             for (j = 0 ; j < 100 ; j++) {
-                 *h_task_flag_1 = 1;
-                 while (*h_task_flag_1 != 3) {
-                    __sync_synchronize();
-                }
+                lake_pk_submit(pk, batch_size);
+                lake_pk_wait_done(pk, 0);
             }
 
 
         for (j = 0 ; j < RUNS ; j++) {
             t_start = ktime_get_ns();
             // -------------------------------RUN-1-------------------------------
-             *h_task_flag_1 = 1;
-             while (*h_task_flag_1 != 3) {
-            __sync_synchronize();   // PRINT("h_task_flag_1 = %d,h_quit_flag = %d\n", *h_task_flag_1, *h_quit_flag);
-            }
+            lake_pk_submit(pk, batch_size);
+            lake_pk_wait_done(pk, 0);
             // -------------------------------RUN-2-------------------------------
              t_stop = ktime_get_ns();
             total_run_times[j] = (t_stop - t_start);
 	    }
 
-        *h_quit_flag = 1;
-        hipStreamSynchronize(stream1);
-        hipStreamSynchronize(stream2);
+        lake_pk_stop(pk);
         
 	    avg = 0; avg_total = 0;
         for (j = 0 ; j < RUNS; j++) {
@@ -814,16 +805,7 @@ static int run_persistent(void) {
     }
 
     // Free resources allocated outside the loop
-    if (h_task_flag_1) {
-        hipHostUnregister(h_task_flag_1);
-        kava_free(h_task_flag_1);
-        h_task_flag_1 = NULL;
-    }
-    if (h_quit_flag) {
-        hipHostUnregister(h_quit_flag);
-        kava_free(h_quit_flag);
-        h_quit_flag = NULL;
-    }
+    lake_pk_destroy(pk);
     if (comp_run_times) {
         vfree(comp_run_times);
         comp_run_times = NULL;
@@ -833,9 +815,6 @@ static int run_persistent(void) {
         total_run_times = NULL;
     }
     
-    check_error(hipStreamDestroy(stream1), "hipStreamDestroy stream1", __LINE__);
-    check_error(hipStreamDestroy(stream2), "hipStreamDestroy stream2", __LINE__);
-    
     return 0;
 }
 
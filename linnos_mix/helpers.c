@@ -29,6 +29,7 @@
 #include "variables.h"
 #include "helpers.h"
 #include "predictors.h"
+#include "predictors_q8.h"
 
 
 static void gpu_init(int dev) {
@@ -63,34 +64,80 @@ static void gpu_init_cuda(int dev) {
     }
 }
 
-static void gpu_get_cufunc(const char* cubin, char* kname, hipFunction_t *func) {
+// all kernels of a module in one lookup, funcs[i] receives the handle of knames[i]
+#define MAX_KERNELS 12
+
+static void gpu_get_cufuncs(const char* cubin, const char **knames, hipFunction_t **funcs, int n) {
+    hipFunction_t handles[MAX_KERNELS];
     hipModule_t hipModule;
     hipError_t res;
+    int i;
+
     res = hipModuleLoad(&hipModule, cubin);
     if (res != hipSuccess) {
         PRINT("cannot load module: %d\n", res);
-    }   
+    }
 
-    res = hipModuleGetFunction(func, hipModule, kname);
+    res = lake_hipModuleGetFunctions(handles, hipModule, knames, n);
     if (res != hipSuccess){
         PRINT("cannot acquire kernel handle\n");
-    }   
+    }
+    for (i = 0; i < n; i++)
+        *funcs[i] = handles[i];
 }
 
-static void gpu_get_cufunc_cuda(const char* cubin, char* kname, CUfunction *func) {
+static void gpu_get_cufuncs_cuda(const char* cubin, const char **knames, CUfunction **funcs, int n) {
+    CUfunction handles[MAX_KERNELS];
     CUmodule cuModule;
     CUresult res;
+    int i;
+
     res = cuModuleLoad(&cuModule, cubin);
     if (res != CUDA_SUCCESS) {
         PRINT("cannot load module: %d\n", res);
     }
 
-    res = cuModuleGetFunction(func, cuModule, kname);
+    res = lake_cuModuleGetFunctions(handles, cuModule, knames, n);
     if (res != CUDA_SUCCESS){
         PRINT("cannot acquire kernel handle\n");
     }
+    for (i = 0; i < n; i++)
+        *funcs[i] = handles[i];
+}
+
+static const char *linnos_knames[] = {
+    "_Z28prediction_final_layer_batchPlS_S_S_",
+    "_Z26prediction_mid_layer_batchPlS_S_S_",
+    "_Z28prediction_mid_layer_1_batchPlS_S_S_",
+    "_Z28prediction_mid_layer_2_batchPlS_S_S_",
+    "_Z31prediction_q8_final_layer_batchPaPiPhPl",
+    "_Z29prediction_q8_mid_layer_batchPaPiPlPhi",
+    "_Z31prediction_q8_mid_layer_m_batchPaPiPhS1_i",
+    "_Z39prediction_final_layer_batch_persistentPlS_S_S_PiS0_",
+    "_Z37prediction_mid_layer_batch_persistentPlS_S_S_PiS0_",
+};
+
+static void gpu_get_linnos_kernels(const char* hsaco_path) {
+    hipFunction_t *funcs[] = {
+        &batch_linnos_final_layer_kernel, &batch_linnos_mid_layer_kernel,
+        &batch_linnos_mid_layer_1_kernel, &batch_linnos_mid_layer_2_kernel,
+        &batch_linnos_q8_final_layer_kernel, &batch_linnos_q8_mid_layer_kernel,
+        &batch_linnos_q8_mid_layer_m_kernel,
+        &batch_linnos_final_layer_kernel_persistent, &batch_linnos_mid_layer_kernel_persistent,
+    };
+    gpu_get_cufuncs(hsaco_path, linnos_knames, funcs, 9);
 }
 
+// no persistent kernels on cuda
+static void gpu_get_linnos_kernels_cuda(const char* cubin_path) {
+    CUfunction *funcs[] = {
+        &batch_linnos_final_layer_kernel_cuda, &batch_linnos_mid_layer_kernel_cuda,
+        &batch_linnos_mid_layer_1_kernel_cuda, &batch_linnos_mid_layer_2_kernel_cuda,
+        &batch_linnos_q8_final_layer_kernel_cuda, &batch_linnos_q8_mid_layer_kernel_cuda,
+        &batch_linnos_q8_mid_layer_m_kernel_cuda,
+    };
+    gpu_get_cufuncs_cuda(cubin_path, linnos_knames, funcs, 7);
+}
 
 //this is multi ssd ready
 void copy_weights(long **weights, struct GPU_weights *state) {
@@ -166,6 +213,39 @@ void copy_weights(long **weights, struct GPU_weights *state) {
     }
 }
 
+// the int8 model goes to the device in one piece, the kernels get pointers into it
+static void gpu_q8_fields(struct linnos_q8 *q, struct GPU_weights_q8 *state) {
+    char *base = state->model;
+    int i;
+
+    state->weight_0_T = base + offsetof(struct linnos_q8, weight_0_T);
+    state->weight_1_T = base + offsetof(struct linnos_q8, weight_1_T);
+    state->weight_M_T[0] = base + offsetof(struct linnos_q8, weight_M_1_T);
+    state->weight_M_T[1] = base + offsetof(struct linnos_q8, weight_M_2_T);
+    state->bias_0 = base + offsetof(struct linnos_q8, bias_0);
+    state->bias_M[0] = base + offsetof(struct linnos_q8, bias_M_1);
+    state->bias_M[1] = base + offsetof(struct linnos_q8, bias_M_2);
+    for (i = 0; i < 3; i++) {
+        state->bias_1[i] = base + offsetof(struct linnos_q8, bias_1) + i * sizeof(q->bias_1[0]);
+        state->requant_mul[i] = q->requant_mul[i];
+    }
+}
+
+void copy_weights_q8(struct linnos_q8 *q, struct GPU_weights_q8 *state) {
+    struct linnos_q8 *kbuf;
+
+    check_error(hipMalloc((void**) &state->model, sizeof(*q)), "hipMalloc ", __LINE__);
+    kbuf = (struct linnos_q8*) kava_alloc(sizeof(*q));
+    memcpy(kbuf, q, sizeof(*q));
+    check_error(hipMemcpyHtoD((hipDeviceptr_t )state->model, kbuf, sizeof(*q)), "hipMemcpyHtoD", __LINE__);
+    kava_free(kbuf);
+    gpu_q8_fields(q, state);
+}
+
+void gpu_cleanup_q8(struct GPU_weights_q8 *state) {
+    hipFree((hipDeviceptr_t)state->model);
+}
+
 void copy_results_from_gpu(u64 n_inputs) {
     hipMemcpyDtoH(gpu_outputs, d_final_res_i, sizeof(long) * 64 * n_inputs);
 }
@@ -176,13 +256,7 @@ void initialize_gpu(const char* hsaco_path, int max_batch_size) {
     //     return;
     // }
     gpu_init(0);
-    gpu_get_cufunc(hsaco_path, "_Z28prediction_final_layer_batchPlS_S_S_", &batch_linnos_final_layer_kernel);
-    gpu_get_cufunc(hsaco_path, "_Z26prediction_mid_layer_batchPlS_S_S_", &batch_linnos_mid_layer_kernel);
-    gpu_get_cufunc(hsaco_path, "_Z28prediction_mid_layer_1_batchPlS_S_S_", &batch_linnos_mid_layer_1_kernel);
-    gpu_get_cufunc(hsaco_path, "_Z28prediction_mid_layer_2_batchPlS_S_S_", &batch_linnos_mid_layer_2_kernel);
-
-    gpu_get_cufunc(hsaco_path, "_Z39prediction_final_layer_batch_persistentPlS_S_S_PiS0_", &batch_linnos_final_layer_kernel_persistent);
-    gpu_get_cufunc(hsaco_path, "_Z37prediction_mid_layer_batch_persistentPlS_S_S_PiS0_", &batch_linnos_mid_layer_kernel_persistent);
+    gpu_get_linnos_kernels(hsaco_path);
 
     check_error(hipMalloc((void**) &d_input_vec_i, sizeof(long) * LEN_INPUT * max_batch_size), "hipMalloc ", __LINE__);
     check_error(hipMalloc((void**) &d_mid_res_i,   sizeof(long) * LEN_LAYER_0 * max_batch_size), "hipMalloc ", __LINE__);
@@ -206,10 +280,7 @@ void initialize_gpu_cuda(const char* cubin_path, int max_batch_size) {
         return;
     }
     gpu_init_cuda(0);
-    gpu_get_cufunc_cuda(cubin_path, "_Z28prediction_final_layer_batchPlS_S_S_", &batch_linnos_final_layer_kernel_cuda);
-    gpu_get_cufunc_cuda(cubin_path, "_Z26prediction_mid_layer_batchPlS_S_S_", &batch_linnos_mid_layer_kernel_cuda);
-    gpu_get_cufunc_cuda(cubin_path, "_Z28prediction_mid_layer_1_batchPlS_S_S_", &batch_linnos_mid_layer_1_kernel_cuda);
-    gpu_get_cufunc_cuda(cubin_path, "_Z28prediction_mid_layer_2_batchPlS_S_S_", &batch_linnos_mid_layer_2_kernel_cuda);
+    gpu_get_linnos_kernels_cuda(cubin_path);
 
     check_error(cuMemAlloc((CUdeviceptr*) &d_input_vec_i_cuda, sizeof(long) * LEN_INPUT * max_batch_size), "cuMemAlloc ", __LINE__);
     check_error(cuMemAlloc((CUdeviceptr*) &d_mid_res_i_cuda,   sizeof(long) * LEN_LAYER_0 * max_batch_size), "cuMemAlloc ", __LINE__);
@@ -287,6 +358,8 @@ void multi_gpu_cleanup_dev(struct GPU_weights *state, int dev) {
 
     for(batch = 0 ; batch < MAX_DEV_BATCHES ; batch++){
         //pr_warn("Freeing for %d/%d\n", dev, batch);
+        //a batch that timed out may still use the buffers, its reply comes before this one
+        hipStreamSynchronize(cu_streams[dev][batch]);
         hipFree(multi_d_input_vec_i[dev][batch]);
         hipFree(multi_d_mid_res_i[dev][batch]);
         hipFree(multi_d_mid_res_1_i[dev][batch]);
@@ -295,6 +368,7 @@ void multi_gpu_cleanup_dev(struct GPU_weights *state, int dev) {
 
         kava_free(multi_inputs_to_gpu[dev][batch]);        
         kava_free(multi_gpu_outputs[dev][batch]);
+        lake_batch_free(multi_batches[dev][batch]);
 
         hipStreamDestroy(cu_streams[dev][batch]);
     }
@@ -307,13 +381,7 @@ void multi_initialize_gpu(const char* hsaco_path, int max_batch_size, int ndev)
         return;
 
     gpu_init(0);
-    gpu_get_cufunc(hsaco_path, "_Z28prediction_final_layer_batchPlS_S_S_", &batch_linnos_final_layer_kernel);
-    gpu_get_cufunc(hsaco_path, "_Z26prediction_mid_layer_batchPlS_S_S_", &batch_linnos_mid_layer_kernel);
-    gpu_get_cufunc(hsaco_path, "_Z28prediction_mid_layer_1_batchPlS_S_S_", &batch_linnos_mid_layer_1_kernel);
-    gpu_get_cufunc(hsaco_path, "_Z28prediction_mid_layer_2_batchPlS_S_S_", &batch_linnos_mid_layer_2_kernel);
-
-    gpu_get_cufunc(hsaco_path, "_Z39prediction_final_layer_batch_persistentPlS_S_S_PiS0_", &batch_linnos_final_layer_kernel_persistent);
-    gpu_get_cufunc(hsaco_path, "_Z37prediction_mid_layer_batch_persistentPlS_S_S_PiS0_", &batch_linnos_mid_layer_kernel_persistent);
+    gpu_get_linnos_kernels(hsaco_path);
     
     for(dev = 0 ; dev < ndev ; dev++){
         for(batch = 0 ; batch < MAX_DEV_BATCHES ; batch++){
@@ -332,20 +400,50 @@ void multi_initialize_gpu(const char* hsaco_path, int max_batch_size, int ndev)
             multi_gpu_outputs[dev][batch] = kava_alloc(64 * max_batch_size * sizeof(long));
             if (!multi_gpu_outputs[dev][batch]) 
                 pr_warn("error allocating inputs_to_gpu:  %lu\n", LEN_INPUT * max_batch_size * sizeof(long));
+
+            multi_batches[dev][batch] = lake_batch_alloc();
+            if (!multi_batches[dev][batch])
+                pr_warn("error allocating command batch\n");
         }
     }
 }
 
+//the copies and the launches in between are recorded in multi_batches[dev][batch_id]
+//and sent to the GPU as one command when the results are copied back
 void multi_copy_inputs_to_gpu(u64 n_inputs, int dev, int batch_id) {
-    hipMemcpyHtoDAsync(multi_d_input_vec_i[dev][batch_id], multi_inputs_to_gpu[dev][batch_id], sizeof(long) * LEN_INPUT * n_inputs, cu_streams[dev][batch_id]);
+    lake_batch_hipMemcpyHtoDAsync(multi_batches[dev][batch_id], multi_d_input_vec_i[dev][batch_id], 
+            multi_inputs_to_gpu[dev][batch_id], sizeof(long) * LEN_INPUT * n_inputs, cu_streams[dev][batch_id]);
 }
 
-void multi_copy_results_from_gpu(u64 n_inputs, int dev, int batch_id) {
-    hipMemcpyDtoHAsync(multi_gpu_outputs[dev][batch_id], 
+// a stuck or failed batch should not stall the IO path, the caller falls back to the cpu
+#define GPU_RESULTS_TIMEOUT_US 10000
+
+//on a timeout the batch may still read its inputs and write its outputs: the future is
+//handed back in *late and the caller must keep the buffers until it completes
+bool multi_copy_results_from_gpu(u64 n_inputs, int dev, int batch_id, struct lake_future **late) {
+    struct lake_batch *b = multi_batches[dev][batch_id];
+    struct lake_future *f;
+    struct lake_cmd_ret ret;
+    CUresult err;
+
+    *late = NULL;
+    lake_batch_hipMemcpyDtoHAsync(b, multi_gpu_outputs[dev][batch_id], 
             multi_d_final_res_i[dev][batch_id], 
             sizeof(long) * 64 * n_inputs, 
             cu_streams[dev][batch_id]);
-    hipStreamSynchronize(cu_streams[dev][batch_id]);
+    lake_batch_hipStreamSynchronize(b, cu_streams[dev][batch_id]);
+    f = lake_batch_submit(b);
+    err = lake_future_wait(f, usecs_to_jiffies(GPU_RESULTS_TIMEOUT_US), &ret);
+    if (err == CUDA_ERROR_NOT_READY)
+        *late = f;
+    else
+        lake_future_release(f);
+    if (unlikely(err != CUDA_SUCCESS)) {
+        pr_warn_ratelimited("batch %d of dev %d failed (%d, cmds %llx), using cpu\n", batch_id, dev, err,
+                err == CUDA_ERROR_NOT_READY ? 0 : ret.batch_failed);
+        return false;
+    }
+    return true;
 }
 
 
@@ -422,6 +520,22 @@ void copy_weights_cuda(long **weights, struct GPU_weights *state) {
 }
 
 
+void copy_weights_q8_cuda(struct linnos_q8 *q, struct GPU_weights_q8 *state) {
+    struct linnos_q8 *kbuf;
+
+    check_error(cuMemAlloc((CUdeviceptr*) &state->model, sizeof(*q)), "cuMemAlloc ", __LINE__);
+    kbuf = (struct linnos_q8*) kava_alloc(sizeof(*q));
+    memcpy(kbuf, q, sizeof(*q));
+    check_error(cuMemcpyHtoD((CUdeviceptr )state->model, kbuf, sizeof(*q)), "cuMemcpyHtoD", __LINE__);
+    kava_free(kbuf);
+    gpu_q8_fields(q, state);
+}
+
+void gpu_cleanup_q8_cuda(struct GPU_weights_q8 *state) {
+    cuMemFree((CUdeviceptr)state->model);
+}
+
+
 void gpu_cleanup_cuda(struct GPU_weights *state) {
     int i;
     //("Cleaning up dGPU state\n");
@@ -50,6 +50,8 @@
 #include <hip_runtime_api_mini.h>
 
 #include "lake_shm.h"
+#include "lake_batch.h"
+#include "lake_module.h"
 #else
 #include <cuda.h>
 #include <stdio.h>
@@ -82,6 +84,12 @@ void copy_weights_cuda(long **weights, struct GPU_weights *state);
 void initialize_gpu_cuda(const char* cubin_path, int max_batch_size);
 void gpu_cleanup_cuda(struct GPU_weights *state);
 
+struct linnos_q8;
+void copy_weights_q8(struct linnos_q8 *q, struct GPU_weights_q8 *state);
+void gpu_cleanup_q8(struct GPU_weights_q8 *state);
+void copy_weights_q8_cuda(struct linnos_q8 *q, struct GPU_weights_q8 *state);
+void gpu_cleanup_q8_cuda(struct GPU_weights_q8 *state);
+
 
 void check_malloc(void *p, const char* error_str, int line);
 void expand_input_n_times(char* input, int n);
@@ -96,7 +104,7 @@ void copy_results_from_gpu_cuda(u64 n_inputs);
 void multi_gpu_cleanup(struct GPU_weights *state, int dev);
 void multi_initialize_gpu(const char* hsaco_path, int max_batch_size, int ndev);
 void multi_copy_inputs_to_gpu(u64 n_inputs, int dev, int batch_id);
-void multi_copy_results_from_gpu(u64 n_inputs, int dev, int batch_id);
+bool multi_copy_results_from_gpu(u64 n_inputs, int dev, int batch_id, struct lake_future **late);
 void multi_gpu_cleanup_dev(struct GPU_weights *state, int dev);
 
 #endif
\ No newline at end of file
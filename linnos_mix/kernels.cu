@@ -160,6 +160,69 @@ __global__ void prediction_final_layer_batch(long *weight_1_T_ent, long *bias_1_
 	}
 }
 
+/*
+ * int8 model, see predictors_q8.h: int32 sums, uint8 activations. Same
+ * launch shapes as the long kernels; the last layer still writes longs so
+ * the results are read like theirs.
+ */
+#define LINNOS_Q8_SHIFT 24
+#define LINNOS_Q8_MAX 255
+
+__device__ unsigned char q8_requant(int acc, int mul) {
+	long long v;
+	if (acc <= 0)
+		return 0;
+	v = ((long long)acc * mul + (1LL << (LINNOS_Q8_SHIFT - 1))) >> LINNOS_Q8_SHIFT;
+	return v > LINNOS_Q8_MAX ? LINNOS_Q8_MAX : v;
+}
+
+__global__ void prediction_q8_mid_layer_batch(signed char *weight_0_T_ent, int *bias_0_ent, long *input_vec_i, unsigned char *mid_res_i, int requant_mul) {
+	int j, k, acc;
+
+	int threadId = threadIdx.x;
+	int stride = blockDim.x;
+	int input_ind = blockIdx.x*LEN_INPUT;
+	for (j = threadId; j < LEN_LAYER_0; j+=stride) {
+		acc = bias_0_ent[j];
+		for (k = 0; k < LEN_INPUT; k++)
+			acc += (int)input_vec_i[input_ind + k] * weight_0_T_ent[j*LEN_INPUT + k];
+		mid_res_i[blockIdx.x*LEN_LAYER_0 + j] = q8_requant(acc, requant_mul);
+	}
+}
+
+__global__ void prediction_q8_mid_layer_m_batch(signed char *weight_M, int *bias_M, unsigned char *mid_res_i, unsigned char *mid_res_m_i, int requant_mul) {
+	int j, k, acc;
+
+	int threadId = threadIdx.x;
+	int stride = blockDim.x;
+	int input_ind = blockIdx.x*LEN_LAYER_0;
+	for (j = threadId; j < LEN_LAYER_0; j+=stride) {
+		acc = bias_M[j];
+		for (k = 0; k < LEN_LAYER_0; k++)
+			acc += mid_res_i[input_ind + k] * weight_M[j*LEN_LAYER_0 + k];
+		mid_res_m_i[input_ind + j] = q8_requant(acc, requant_mul);
+	}
+}
+
+__global__ void prediction_q8_final_layer_batch(signed char *weight_1_T_ent, int *bias_1_ent, unsigned char *mid_res_i, long *dd_final_res_i) {
+	int index = blockIdx.x;
+	int threadId = threadIdx.x;
+	int dim = blockDim.x;
+	int out = threadId < 32 ? 0 : 1;
+	int k, acc = 0;
+	int update_index = index*dim + threadId;
+
+	for (k = threadId - 32*out; k < LEN_LAYER_0; k += 32)
+		acc += mid_res_i[index*LEN_LAYER_0 + k] * weight_1_T_ent[out*LEN_LAYER_0 + k];
+	dd_final_res_i[update_index] = acc;
+	__syncthreads();
+	if (threadId == 0 || threadId == 32) {
+		for (k = 1; k < 32; k++)
+			dd_final_res_i[update_index] += dd_final_res_i[update_index + k];
+		dd_final_res_i[update_index] += bias_1_ent[out];
+	}
+}
+
 // static long *weight_0_T_ent, * bias_0_ent, *weight_1_T_ent, * bias_1_ent; 
 // static long input_vec_i[31] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,9,0,0,0,9,0,0,0,9};
 // static long *parallel_input;
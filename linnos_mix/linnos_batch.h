@@ -0,0 +1,209 @@
+/*
+ * Part of LAKE: Towards a Machine Learning-Assisted Kernel with LAKE
+ *
+ * Original work:
+ *   Copyright (C) 2022–2024 Henrique Fingler
+ *   Copyright (C) 2022–2024 Isha Tarte
+ *
+ * Modifications and adaptations for LAIKA:
+ *   Copyright (C) 2024-2025 Haoming Zhuo
+ *
+ * This file is adapted from the original LAKE kernel module.
+ * Major changes include:
+ *   - Integration with LAIKA framework
+ *   - Hybrid execution support
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef __LINNOS_BATCH_H
+#define __LINNOS_BATCH_H
+
+/*
+ * Lock-free formation of the LinnOS gpu batches (gpu_batch_entry in
+ * predictors.c). Every device has MAX_DEV_BATCHES slots used in turn; a
+ * slot's state word holds the generation of the batch it is forming, a
+ * closed bit and the number of tickets taken.
+ *
+ * An arrival takes a ticket with one fetch-add and is in the batch if the
+ * word it got back was open and the ticket is below the batch size limit;
+ * otherwise it moves on to the next slot. The ticket is its place in the
+ * batch buffers. Closing is a cmpxchg that sets the closed bit on the word
+ * as its closer read it, so the tickets in that word are the batch and
+ * exactly one request closes it: the one that fills it, one that sees its
+ * window expired, or the first request once the window ran out.
+ *
+ * The closer waits for the members' inputs (ready), runs the batch and
+ * publishes its generation in done; members wait for that and read their
+ * result. The last one out reopens the slot for the next generation, so a
+ * slot is never refilled while somebody still reads it; a batch whose gpu
+ * reply is late holds it until the reply is in.
+ *
+ * Waiting is left to the caller, so test/test_batch.c can drive this in
+ * userspace threads.
+ */
+
+#ifdef __KERNEL__
+#include <linux/types.h>
+#include <linux/atomic.h>
+#include <linux/compiler.h>
+#include <asm/barrier.h>
+#include <asm/processor.h>
+#else
+#include <stdint.h>
+#include <stdbool.h>
+typedef uint32_t u32;
+typedef uint64_t u64;
+typedef int64_t s64;
+typedef struct { int counter; } atomic_t;
+typedef struct { s64 counter; } atomic64_t;
+#define atomic_read(v)                 __atomic_load_n(&(v)->counter, __ATOMIC_RELAXED)
+#define atomic_read_acquire(v)         __atomic_load_n(&(v)->counter, __ATOMIC_ACQUIRE)
+#define atomic_set(v, i)               __atomic_store_n(&(v)->counter, i, __ATOMIC_RELAXED)
+#define atomic_inc_return(v)           __atomic_add_fetch(&(v)->counter, 1, __ATOMIC_SEQ_CST)
+#define atomic_inc_return_release(v)   __atomic_add_fetch(&(v)->counter, 1, __ATOMIC_RELEASE)
+#define atomic64_read(v)               __atomic_load_n(&(v)->counter, __ATOMIC_RELAXED)
+#define atomic64_set_release(v, i)     __atomic_store_n(&(v)->counter, i, __ATOMIC_RELEASE)
+#define atomic64_fetch_add(i, v)       __atomic_fetch_add(&(v)->counter, i, __ATOMIC_SEQ_CST)
+#define atomic64_try_cmpxchg(v, o, n)  \
+    __atomic_compare_exchange_n(&(v)->counter, o, n, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)
+#define READ_ONCE(x)                   __atomic_load_n(&(x), __ATOMIC_RELAXED)
+#define WRITE_ONCE(x, v)               __atomic_store_n(&(x), v, __ATOMIC_RELAXED)
+#define smp_load_acquire(p)            __atomic_load_n(p, __ATOMIC_ACQUIRE)
+#define smp_store_release(p, v)        __atomic_store_n(p, v, __ATOMIC_RELEASE)
+#if defined(__x86_64__) || defined(__i386__)
+#define cpu_relax()                    __builtin_ia32_pause()
+#else
+#define cpu_relax()                    __atomic_signal_fence(__ATOMIC_SEQ_CST)
+#endif
+#endif
+
+#define LINNOS_BATCH_CLOSED    (1LL << 32)
+#define LINNOS_BATCH_GEN_SHIFT 33
+#define LINNOS_BATCH_GEN_MASK  ((1U << (64 - LINNOS_BATCH_GEN_SHIFT)) - 1)
+
+struct linnos_batch {
+	atomic64_t state;	//gen << LINNOS_BATCH_GEN_SHIFT | closed | tickets
+	atomic_t ready;		//members whose input is in the batch buffers
+	atomic_t exited;	//members done with the slot
+	s64 first_arrival;	//of ticket 0, 0 until it wrote it
+	u32 size;		//set by the closer, 0 while forming
+	u32 done;		//generation of the last batch run in this slot
+	bool use_cpu;		//members predict on their own
+} __attribute__((aligned(64)));
+
+static inline u32 linnos_batch_gen(s64 word) {
+	return (u64)word >> LINNOS_BATCH_GEN_SHIFT;
+}
+
+static inline void linnos_batch_reopen(struct linnos_batch *b, u32 gen) {
+	atomic_set(&b->ready, 0);
+	atomic_set(&b->exited, 0);
+	WRITE_ONCE(b->first_arrival, 0);
+	WRITE_ONCE(b->size, 0);
+	atomic64_set_release(&b->state, (s64)(gen & LINNOS_BATCH_GEN_MASK) << LINNOS_BATCH_GEN_SHIFT);
+}
+
+static inline void linnos_batch_init(struct linnos_batch *b) {
+	b->done = 0;
+	b->use_cpu = true;
+	linnos_batch_reopen(b, 1);
+}
+
+/*
+ * Takes a ticket, the arrival's place in the batch, or -1 if the slot is
+ * closed or already holds max requests. *gen is the batch's generation.
+ */
+static inline int linnos_batch_join(struct linnos_batch *b, u32 max, u32 *gen) {
+	s64 old = atomic64_fetch_add(1, &b->state);
+
+	if ((old & LINNOS_BATCH_CLOSED) || (u32)old >= max)
+		return -1;
+	*gen = linnos_batch_gen(old);
+	return (u32)old;
+}
+
+//ticket 0 starts the batch's window
+static inline void linnos_batch_start(struct linnos_batch *b, s64 now) {
+	WRITE_ONCE(b->first_arrival, now);
+}
+
+static inline bool linnos_batch_expired(struct linnos_batch *b, s64 now, s64 window) {
+	s64 first = READ_ONCE(b->first_arrival);
+
+	return first && now - first >= window;
+}
+
+//the member's input is in the batch buffers
+static inline void linnos_batch_ready(struct linnos_batch *b) {
+	atomic_inc_return_release(&b->ready);
+}
+
+/*
+ * Tries to close batch gen. True if this caller closed it and has to run
+ * it, *size is then the number of members.
+ */
+static inline bool linnos_batch_close(struct linnos_batch *b, u32 gen, u32 max, u32 *size) {
+	s64 old = atomic64_read(&b->state);
+
+	do {
+		if ((old & LINNOS_BATCH_CLOSED) || linnos_batch_gen(old) != gen)
+			return false;
+	} while (!atomic64_try_cmpxchg(&b->state, &old, old | LINNOS_BATCH_CLOSED));
+
+	*size = (u32)old < max ? (u32)old : max;
+	WRITE_ONCE(b->size, *size);
+	return true;
+}
+
+/*
+ * Closer: waits for the members between their ticket and their input,
+ * which is a few stores (preemption is off in gpu_batch_entry).
+ */
+static inline void linnos_batch_wait_ready(struct linnos_batch *b, u32 size) {
+	while ((u32)atomic_read_acquire(&b->ready) < size)
+		cpu_relax();
+}
+
+/*
+ * Closer: one more exit before the slot reopens, for whoever still uses
+ * the batch buffers after the batch was published (a late gpu reply).
+ */
+static inline void linnos_batch_hold(struct linnos_batch *b) {
+	WRITE_ONCE(b->size, READ_ONCE(b->size) + 1);
+}
+
+//closer: the results are in place, members may read them
+static inline void linnos_batch_publish(struct linnos_batch *b, u32 gen, bool use_cpu) {
+	b->use_cpu = use_cpu;
+	smp_store_release(&b->done, gen);
+}
+
+static inline bool linnos_batch_done(struct linnos_batch *b, u32 gen) {
+	return smp_load_acquire(&b->done) == gen;
+}
+
+/*
+ * A member is done with the slot. The last one out (the closer's own exit
+ * comes after it set the size) reopens it and returns true.
+ */
+static inline bool linnos_batch_exit(struct linnos_batch *b, u32 gen) {
+	u32 n = atomic_inc_return(&b->exited);
+
+	if (n != READ_ONCE(b->size))
+		return false;
+	linnos_batch_reopen(b, gen + 1);
+	return true;
+}
+
+#endif
@@ -33,6 +33,7 @@
 #include <asm/fpu/api.h>
 #include "cuda.h"
 #include "lake_shm.h"
+#include "lake_pk.h"
 //uspace
 #else
 #define kava_free(X) free(X)
@@ -59,6 +60,7 @@ u64 get_tsns() {
 #include "test_weights.h"
 #include "helpers.h"
 #include "predictors.h"
+#include "predictors_q8.h"
 #include "variables.h"
 #define FEAT_31
 #define LEN_INPUT 31
@@ -97,6 +99,44 @@ char *cpu_patterns[3]= {
 };
 char out[1024];
 
+static bool (*cpu_models[3])(char *feat_vec, int n_vecs, long **weights) = {
+    cpu_prediction_model, cpu_prediction_model_plus_1, cpu_prediction_model_plus_2
+};
+
+//the int8 model against the long one, on random bytes and on random digits like LinnOS feeds it
+static void check_q8_cpu(char *inputs, int n, u64 q8_disagree[2][3]) {
+    char digits[LEN_INPUT];
+    char *input;
+    int bnum, i, nn;
+
+    for (bnum = 0; bnum < n; bnum++) {
+        input = inputs + LEN_INPUT * bnum;
+        for (i = 0; i < LEN_INPUT; i++)
+            digits[i] = (u8)input[i] % 10;
+        for (nn = 0; nn < 3; nn++) {
+            if (cpu_prediction_model_q8(input, 1, &test_weights_q8, nn) != cpu_models[nn](input, 1, test_weights))
+                q8_disagree[0][nn]++;
+            if (cpu_prediction_model_q8(digits, 1, &test_weights_q8, nn) != cpu_models[nn](digits, 1, test_weights))
+                q8_disagree[1][nn]++;
+        }
+    }
+}
+
+static void print_q8_summary(u64 q8_disagree[2][3], u64 n, u64 q8_gpu_mismatches) {
+    static const char *kinds[2] = { "bytes", "digits" };
+    u64 rate;
+    int kind, nn;
+
+    for (kind = 0; kind < 2; kind++) {
+        for (nn = 0; nn < 3; nn++) {
+            rate = q8_disagree[kind][nn] * 10000 / n;
+            PRINT("linnos+%d int8 model, random %s: %llu/%llu disagree with the long model (%llu.%02llu%%)\n",
+                    nn, kinds[kind], q8_disagree[kind][nn], n, rate / 100, rate % 100);
+        }
+    }
+    PRINT("int8 model: %llu gpu/cpu mismatches\n", q8_gpu_mismatches);
+}
+
 static int run_apu(void) {
 
     //zerocpy pointer
@@ -113,7 +153,9 @@ static int run_apu(void) {
     const int n = 1024;
     bool res;
     u64 false_count=0, true_count=0;
-    u64 result_mismatches = 0;
+    u64 result_mismatches = 0, simd_mismatches = 0;
+    u64 q8_disagree[2][3] = {{0}}, q8_gpu_mismatches = 0;
+    struct GPU_weights_q8 state_q8;
     int batch_size;
     char input[31] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,9,0,0,0,9,0,0,0,9};
     u64 t_start, t_stop, c_start, c_stop;
@@ -344,6 +386,7 @@ static int run_apu(void) {
 
     if(check_correctness) {
         char *input_64 = kava_alloc(64 * LEN_INPUT * sizeof(char));
+        copy_weights_q8(&test_weights_q8, &state_q8);
         for(int k = 0; k < CORRECTNESS_CHECKS; k++) {
             //generate random input
             #ifdef __KERNEL__ 
@@ -360,6 +403,14 @@ static int run_apu(void) {
             
             for(int bnum = 0; bnum < 64; bnum++) {
                 int cpu_result = cpu_prediction_model(input_64 + LEN_INPUT * bnum * sizeof(char), 1, test_weights);
+                if (cpu_result != cpu_prediction_model_scalar(input_64 + LEN_INPUT * bnum, 1, test_weights))
+                    simd_mismatches++;
+                if (cpu_prediction_model_plus_1(input_64 + LEN_INPUT * bnum, 1, test_weights) !=
+                        cpu_prediction_model_plus_1_scalar(input_64 + LEN_INPUT * bnum, 1, test_weights))
+                    simd_mismatches++;
+                if (cpu_prediction_model_plus_2(input_64 + LEN_INPUT * bnum, 1, test_weights) !=
+                        cpu_prediction_model_plus_2_scalar(input_64 + LEN_INPUT * bnum, 1, test_weights))
+                    simd_mismatches++;
                 res = gpu_outputs[bnum*64]>=(gpu_outputs[bnum * 64 + 32])? false: true;
                 //res = h_results_mapped[bnum*64]>=(h_results_mapped[bnum * 64 + 32])? false: true;
                 //PRINT("Test [%d]: (%d) %s\n", bnum, res, res==cpu_result ? "Ok" : "WRONG");
@@ -367,8 +418,21 @@ static int run_apu(void) {
                 if (cpu_result) true_count++;
                 else false_count++;
             }            
+            check_q8_cpu(input_64, 64, q8_disagree);
+            for (nn = 0; nn < 3; nn++) {
+                gpu_predict_batch_q8(0, 64, &state_q8, nn);
+                copy_results_from_gpu(64);
+                for (int bnum = 0; bnum < 64; bnum++) {
+                    res = gpu_outputs[bnum*64]>=(gpu_outputs[bnum * 64 + 32])? false: true;
+                    if (res != cpu_prediction_model_q8(input_64 + LEN_INPUT * bnum, 1, &test_weights_q8, nn))
+                        q8_gpu_mismatches++;
+                }
+            }
         }
-        PRINT("CPU prediction summary: %llu trues, %llu falses %llu result_mismatches\n", true_count, false_count, result_mismatches);
+        PRINT("CPU prediction summary: %llu trues, %llu falses %llu result_mismatches %llu simd_mismatches\n",
+                true_count, false_count, result_mismatches, simd_mismatches);
+        print_q8_summary(q8_disagree, 64 * CORRECTNESS_CHECKS, q8_gpu_mismatches);
+        gpu_cleanup_q8(&state_q8);
         // Free input_64
         if (input_64) {
             kava_free(input_64);
@@ -391,6 +455,9 @@ static int run_apu(void) {
     return 0;
 }
 
+// last stage of the LinnOS persistent kernels writes 8 into the task flag
+#define LINNOS_PK_DONE 8
+
 static int run_persistent(void) {
 
     //zerocpy pointer
@@ -406,18 +473,16 @@ static int run_persistent(void) {
     int n_batches = sizeof(batch_sizes)/sizeof(int);
     int max_batch_size = batch_sizes[n_batches-1];
     const int n = max_batch_size;
-    bool res;
-    u64 false_count=0, true_count=0;
-    u64 result_mismatches = 0;
     int batch_size;
     char input[31] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,9,0,0,0,9,0,0,0,9};
-    u64 t_start, t_stop, c_start, c_stop;
-    u64* comp_run_times, *comp_run_times_1, *comp_run_times_2;
+    u64 c_start, c_stop;
+    u64* comp_run_times;
     u64* total_run_times;
-    u64 avg, avg_1, avg_2, avg_total;
-    u64 best, best_total;
+    u64 avg;
     int nn;
     struct GPU_weights state;
+    struct lake_pk *pk;
+    void *d_task_flag, *d_quit_flag;
 
     initialize_gpu(hsaco_path, max_batch_size);
     copy_weights(test_weights, &state);
@@ -433,89 +498,23 @@ static int run_persistent(void) {
 	for(int b = 0 ; b < n; b++) 
 		for(int j = 0; j < LEN_INPUT; j++)
 			inputs_to_gpu[b*31 + j] =  (long) input[j];
-//Persistent Kernel Set Flags---------------------------------
-
- int* h_task_flag = (int*)kava_alloc(sizeof(int));
- int* h_quit_flag = (int*)kava_alloc(sizeof(int));
- if (!h_task_flag || !h_quit_flag) {
-     PRINT("Failed to allocate memory for flags\n");
-     vfree(comp_run_times);
-     vfree(total_run_times);
-     return -1;
- }
- if (hipHostRegister(h_task_flag, sizeof(int), hipHostRegisterMapped | hipExtHostRegisterCoarseGrained) != hipSuccess) {
-     PRINT("Failed to register h_task_flag\n");
-     kava_free(h_task_flag);
-     kava_free(h_quit_flag);
-     vfree(comp_run_times);
-     vfree(total_run_times);
-     return -1;
- }
- if (hipHostRegister(h_quit_flag, sizeof(int), hipHostRegisterMapped) != hipSuccess) {
-     PRINT("Failed to register h_quit_flag\n");
-     hipHostUnregister(h_task_flag);
-     kava_free(h_task_flag);
-     kava_free(h_quit_flag);
-     vfree(comp_run_times);
-     vfree(total_run_times);
-     return -1;
- }
- void* d_task_flag; 
- if (hipHostGetDevicePointer(&d_task_flag, h_task_flag, 0) != hipSuccess) {
-     PRINT("Failed to get device pointer for d_task_flag\n");
-     hipHostUnregister(h_task_flag);
-     hipHostUnregister(h_quit_flag);
-     kava_free(h_task_flag);
-     kava_free(h_quit_flag);
-     vfree(comp_run_times);
-     vfree(total_run_times);
-     return -1;
- }
- void* d_quit_flag; 
- if (hipHostGetDevicePointer(&d_quit_flag, h_quit_flag, 0) != hipSuccess) {
-     PRINT("Failed to get device pointer for d_quit_flag\n");
-     hipHostUnregister(h_task_flag);
-     hipHostUnregister(h_quit_flag);
-     kava_free(h_task_flag);
-     kava_free(h_quit_flag);
-     vfree(comp_run_times);
-     vfree(total_run_times);
-     return -1;
- }
-//Persistent Kernel Set Streams---------------------------------
-
-hipStream_t stream1, stream2, stream3, stream4;
-#ifdef __KERNEL__
-check_error(hipStreamCreate(&stream1,0), "hipStreamCreate stream1", __LINE__);
-check_error(hipStreamCreate(&stream2,0), "hipStreamCreate stream2", __LINE__);
-check_error(hipStreamCreate(&stream3,0), "hipStreamCreate stream3", __LINE__);
-check_error(hipStreamCreate(&stream4,0), "hipStreamCreate stream4", __LINE__);
-#else
-check_error(hipStreamCreate(&stream1), "hipStreamCreate stream1", __LINE__);
-check_error(hipStreamCreate(&stream2), "hipStreamCreate stream2", __LINE__);
-check_error(hipStreamCreate(&stream3), "hipStreamCreate stream3", __LINE__);
-check_error(hipStreamCreate(&stream4), "hipStreamCreate stream4", __LINE__);
-#endif
-
+//Persistent Kernel mailbox---------------------------------
+    pk = lake_pk_create(LINNOS_PK_DONE);
+    if (!pk) {
+        PRINT("Failed to create persistent kernel mailbox\n");
+        vfree(comp_run_times);
+        vfree(total_run_times);
+        return -1;
+    }
+    lake_pk_device_ptrs(pk, &d_task_flag, &d_quit_flag, NULL);
 
     for (nn = 0 ; nn < 1 ; nn++) {
         // measuring GPU time
         for (i = 0 ; i < n_batches ; i++) {
             batch_size = batch_sizes[i];
             
-            // Critical fix: At the start of each iteration, ensure the persistent kernel has stopped
-            // before safely freeing previously allocated memory
-            if (i > 0) {
-                // Stop the previous persistent kernel (if still running)
-                *h_quit_flag = 1;
-                __sync_synchronize();
-                hipStreamSynchronize(stream1);
-                hipStreamSynchronize(stream2);
-                hipStreamSynchronize(stream3);
-            }
-            
-            // Free memory allocated in previous iteration (if exists)
-            // Note: Must free only after the persistent kernel has stopped
+            // the stages of the previous batch size still use the buffers, stop them first
+            lake_pk_stop(pk);
             if (h_results_mapped) {
                 hipHostUnregister(h_results_mapped);
                 kava_free(h_results_mapped);
@@ -527,9 +526,6 @@ check_error(hipStreamCreate(&stream4), "hipStreamCreate stream4", __LINE__);
                 h_inputs_mapped = NULL;
             }
             
-            // Reset synchronization flags before each batch starts
-            *h_task_flag = 0; *h_quit_flag = 0;
-            __sync_synchronize();
             //zerocpy setup memory--------------------------
 
             h_inputs_mapped = kava_alloc(sizeof(long) * LEN_INPUT * batch_size);
@@ -589,104 +585,38 @@ check_error(hipStreamCreate(&stream4), "hipStreamCreate stream4", __LINE__);
             void *args1[] = {
                 &state.weights[1], &state.weights[3], &d_mid_res_i, &d_results_mapped, &d_task_flag, &d_quit_flag
             };
-            void *args2[] = {
-                &state.weights[4], &state.weights[5], &d_mid_res_i, &d_mid_res_1_i, &d_task_flag, &d_quit_flag
-            };
-            void *args3[] = {
-                &state.weights[6], &state.weights[7], &d_mid_res_1_i, &d_mid_res_2_i, &d_task_flag, &d_quit_flag
-            };
 
 //Start Persistent Kernel LAYER+0---------------------------------
-            // Critical fix: persistent kernel is launched once in the first iteration
-            // but memory is reallocated in each iteration, so we need to ensure:
-            // 1. Launch persistent kernel in the first iteration
-            // 2. In subsequent iterations, the persistent kernel has stopped (via quit_flag), then relaunch
-            // 3. Or use fixed memory (not recommended, as batch_size changes)
-            // Here we adopt the approach: relaunch persistent kernel in each iteration to ensure using current memory pointers
-            if (nn==0 && i==0){
-                // First launch of persistent kernel
-                check_error(hipModuleLaunchKernel(batch_linnos_mid_layer_kernel_persistent, 
-                            batch_size, 1, 1,          //blocks
-                            256, 1, 1,   //threads per block
-                            0,   //shared mem
-                            stream1, args, NULL),
-                        "hipModuleLaunchKernel", __LINE__);
-
-                check_error(hipModuleLaunchKernel(batch_linnos_final_layer_kernel_persistent, 
-                            batch_size, 1, 1,          //blocks
-                            64, 1, 1,   //threads per block
-                            0,   //shared mem
-                            stream2, args1, NULL),
-                        "hipModuleLaunchKernel", __LINE__);
-            } else if (nn==0 && i>0) {
-                // Subsequent iterations: relaunch persistent kernel with new memory pointers
-                // Note: previous kernel has already been stopped and synchronized at the start of the loop
-                check_error(hipModuleLaunchKernel(batch_linnos_mid_layer_kernel_persistent, 
-                            batch_size, 1, 1,          //blocks
-                            256, 1, 1,   //threads per block
-                            0,   //shared mem
-                            stream1, args, NULL),
-                        "hipModuleLaunchKernel", __LINE__);
-
-                check_error(hipModuleLaunchKernel(batch_linnos_final_layer_kernel_persistent, 
-                            batch_size, 1, 1,          //blocks
-                            64, 1, 1,   //threads per block
-                            0,   //shared mem
-                            stream2, args1, NULL),
-                        "hipModuleLaunchKernel", __LINE__);
-            }
-//Start Persistent Kernel LAYER+1---------------------------------
-            // if (nn==1){
-            //     check_error(hipModuleLaunchKernel(batch_linnos_mid_layer_kernel_persistent, 
-            //         batch_size, 1, 1,          //blocks
-            //         256, 1, 1,   //threads per block
-            //         0,   //shared mem
-            //         stream1, args, NULL),
-            //     "hipModuleLaunchKerne0", __LINE__);
-
-            //     check_error(hipModuleLaunchKernel(batch_linnos_final_layer_kernel_persistent, 
-            //         batch_size, 1, 1,          //blocks
-            //         64, 1, 1,   //threads per block
-            //         0,   //shared mem
-            //         stream2, args1, NULL),
-            //     "hipModuleLaunchKernel", __LINE__);
-
-            //     check_error(hipModuleLaunchKernel(batch_linnos_mid_layer_1_kernel_persistent, 
-            //         batch_size, 1, 1,          //blocks
-            //         256, 1, 1,   //threads per block
-            //         0,   //shared mem
-            //         stream3, args2, NULL),
-            //     "hipModuleLaunchKerne2", __LINE__);      
-                   
-            // }
+            // relaunched for every batch size so the stages use the current buffers
+            check_error(lake_pk_launch(pk, batch_linnos_mid_layer_kernel_persistent, 
+                        batch_size, 1, 1,          //blocks
+                        256, 1, 1,   //threads per block
+                        0,   //shared mem
+                        args),
+                    "lake_pk_launch", __LINE__);
+
+            check_error(lake_pk_launch(pk, batch_linnos_final_layer_kernel_persistent, 
+                        batch_size, 1, 1,          //blocks
+                        64, 1, 1,   //threads per block
+                        0,   //shared mem
+                        args1),
+                    "lake_pk_launch", __LINE__);
             
             for (j = 0 ; j < 100; j++) {
-                *h_task_flag = 1;
-                while (*h_task_flag != 8) {
-                    __sync_synchronize();  
-                    }
-                }
+                lake_pk_submit(pk, batch_size);
+                lake_pk_wait_done(pk, 0);
+            }
 
             for (j = 0 ; j < RUNS ; j++) {
-
                 // Measure persistent kernel
                 c_start = ktime_get_ns();
-                *h_task_flag = 1;
-                while (*h_task_flag != 8) {
-                    __sync_synchronize();   
-                    //PRINT("h_task_flag_1 = %d,h_quit_flag = %d\n", *h_task_flag, *h_quit_flag);
-                    }
+                lake_pk_submit(pk, batch_size);
+                lake_pk_wait_done(pk, 0);
                 c_stop = ktime_get_ns();
                 comp_run_times[j] = (c_stop - c_start);
-                }
+            }
                 
-            *h_quit_flag = 1;
-            __sync_synchronize();
-
-            hipStreamSynchronize(stream1);
-            hipStreamSynchronize(stream2);
-            hipStreamSynchronize(stream3);
-            hipStreamSynchronize(stream4);
+            lake_pk_stop(pk);
             avg = 0; 
 
             for (j = 0 ; j < RUNS ; j++) {
@@ -695,23 +625,12 @@ check_error(hipStreamCreate(&stream4), "hipStreamCreate stream4", __LINE__);
             avg = avg / (1000*RUNS); 
             //sprintf("_PK_%s%d,%lld\n", "linnos+0_APU_PK_batch_", batch_size, avg);
             PRINT("linnos+0_APU_PK_batch_%d,%lu\n", batch_size, avg);
-            //PRINT("%s", out);
-            
-            // At the end of each iteration, ensure persistent kernel has stopped before freeing memory
-            // Note: Memory is not freed here because the persistent kernel may still be using it
-            // Memory will be freed at the start of the next iteration, or after the loop ends
         }
 
     }
     
-    // After the loop ends, ensure persistent kernel has stopped, then free the last allocated memory
-    *h_quit_flag = 1;
-    __sync_synchronize();
-    hipStreamSynchronize(stream1);
-    hipStreamSynchronize(stream2);
-    hipStreamSynchronize(stream3);
-    hipStreamSynchronize(stream4);
-
+    // stages are stopped, free the last allocated memory
+    lake_pk_destroy(pk);
     if (h_results_mapped) {
         hipHostUnregister(h_results_mapped);
         kava_free(h_results_mapped);
@@ -723,14 +642,6 @@ check_error(hipStreamCreate(&stream4), "hipStreamCreate stream4", __LINE__);
         h_inputs_mapped = NULL;
     }
     
-    hipHostUnregister(h_task_flag);
-    hipHostUnregister(h_quit_flag);
-    kava_free(h_task_flag);
-    kava_free(h_quit_flag);
-    check_error(hipStreamDestroy(stream1), "hipStreamDestroy stream1", __LINE__);
-    check_error(hipStreamDestroy(stream2), "hipStreamDestroy stream2", __LINE__);
-    check_error(hipStreamDestroy(stream3), "hipStreamDestroy stream3", __LINE__);
-    check_error(hipStreamDestroy(stream4), "hipStreamDestroy stream4", __LINE__);
     gpu_cleanup(&state);
     vfree(comp_run_times);
     vfree(total_run_times);
@@ -749,7 +660,9 @@ static int run_dgpu(void) {
     const int n = max_batch_size;
     bool res;
     u64 false_count=0, true_count=0;
-    u64 result_mismatches = 0;
+    u64 result_mismatches = 0, simd_mismatches = 0;
+    u64 q8_disagree[2][3] = {{0}}, q8_gpu_mismatches = 0;
+    struct GPU_weights_q8 state_q8;
     int batch_size;
     char input[31] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,9,0,0,0,9,0,0,0,9};
     u64 t_start, t_stop, c_start, c_stop;
@@ -811,6 +724,7 @@ static int run_dgpu(void) {
 
     if(check_correctness) {
         char *input_64 = kava_alloc(64 * LEN_INPUT * sizeof(char));
+        copy_weights_q8_cuda(&test_weights_q8, &state_q8);
         for(int k = 0; k < CORRECTNESS_CHECKS; k++) {
             //generate random input
             #ifdef __KERNEL__ 
@@ -827,14 +741,35 @@ static int run_dgpu(void) {
             
             for(int bnum = 0; bnum < 64; bnum++) {
                 int cpu_result = cpu_prediction_model(input_64 + LEN_INPUT * bnum * sizeof(char), 1, test_weights);
+                if (cpu_result != cpu_prediction_model_scalar(input_64 + LEN_INPUT * bnum, 1, test_weights))
+                    simd_mismatches++;
+                if (cpu_prediction_model_plus_1(input_64 + LEN_INPUT * bnum, 1, test_weights) !=
+                        cpu_prediction_model_plus_1_scalar(input_64 + LEN_INPUT * bnum, 1, test_weights))
+                    simd_mismatches++;
+                if (cpu_prediction_model_plus_2(input_64 + LEN_INPUT * bnum, 1, test_weights) !=
+                        cpu_prediction_model_plus_2_scalar(input_64 + LEN_INPUT * bnum, 1, test_weights))
+                    simd_mismatches++;
                 res = gpu_outputs[bnum*64]>=(gpu_outputs[bnum * 64 + 32])? false: true;
                 //PRINT("Test [%d]: (%d) %s\n", bnum, res, res==cpu_result ? "Ok" : "WRONG");
                 if (res!=cpu_result) result_mismatches++;
                 if (cpu_result) true_count++;
                 else false_count++;
             }            
+            check_q8_cpu(input_64, 64, q8_disagree);
+            for (nn = 0; nn < 3; nn++) {
+                gpu_predict_batch_q8_cuda(0, 64, &state_q8, nn);
+                copy_results_from_gpu_cuda(64);
+                for (int bnum = 0; bnum < 64; bnum++) {
+                    res = gpu_outputs[bnum*64]>=(gpu_outputs[bnum * 64 + 32])? false: true;
+                    if (res != cpu_prediction_model_q8(input_64 + LEN_INPUT * bnum, 1, &test_weights_q8, nn))
+                        q8_gpu_mismatches++;
+                }
+            }
         }
-        PRINT("CPU prediction summary: %llu trues, %llu falses %llu result_mismatches\n", true_count, false_count, result_mismatches);
+        PRINT("CPU prediction summary: %llu trues, %llu falses %llu result_mismatches %llu simd_mismatches\n",
+                true_count, false_count, result_mismatches, simd_mismatches);
+        print_q8_summary(q8_disagree, 64 * CORRECTNESS_CHECKS, q8_gpu_mismatches);
+        gpu_cleanup_q8_cuda(&state_q8);
     }
 
     gpu_cleanup_cuda(&state);
@@ -853,6 +788,10 @@ static int run_dgpu(void) {
  */
 static int __init linnos_init(void)
 {   
+    int err = cpu_prediction_pack(test_weights, 2);
+
+    if (err)
+        PRINT("linnos: cpu model stays scalar (%d)\n", err);
     run_persistent();
     run_apu();
     run_dgpu();
@@ -861,7 +800,7 @@ static int __init linnos_init(void)
 
 static void __exit linnos_fini(void)
 {
-
+    cpu_prediction_release();
 }
 
 module_init(linnos_init);
@@ -26,12 +26,19 @@
  * You should have received a copy of the GNU General Public License
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
-#include <linux/delay.h>
 #include <linux/ktime.h>
 #include <linux/vmalloc.h>
+#include <linux/percpu.h>
+#include <linux/moduleparam.h>
 #include <asm/fpu/api.h>
-#include <linux/completion.h>
+#include <asm/cpufeature.h>
+#include <asm/simd.h>
+#include <linux/atomic.h>
+#include <linux/wait.h>
+#include <linux/preempt.h>
 #include "predictors.h"
+#include "predictors_simd.h"
+#include "linnos_batch.h"
 #include "variables.h"
 #include "helpers.h"
 #include "cuda.h"
@@ -55,49 +62,249 @@ u32* window_size_hist; //allocated in main.c of kernel_hook, 128 elements
 u32 n_used_gpu = 0;
 u32 ios_on_device[NUMBER_DEVICES];
 
-u16 current_batch[NUMBER_DEVICES];
-spinlock_t batch_entry[NUMBER_DEVICES];
 //GPU inference variables
 struct GPU_weights gpu_weights[NUMBER_DEVICES]; //per-ssd weights, we are not going to have more than NUMBER_DEVICES ssds..
 
-spinlock_t per_batch_lock[NUMBER_DEVICES][MAX_DEV_BATCHES];
-struct completion batch_completed[NUMBER_DEVICES][MAX_DEV_BATCHES];
-struct completion finalize_batch[NUMBER_DEVICES][MAX_DEV_BATCHES];
-u16 n_exited[NUMBER_DEVICES][MAX_DEV_BATCHES];
-u16 waiting[NUMBER_DEVICES][MAX_DEV_BATCHES];
+//batch formation, see linnos_batch.h
+struct linnos_batch batches[NUMBER_DEVICES][MAX_DEV_BATCHES];
+atomic_t cur_batch[NUMBER_DEVICES]; //batches opened so far, % MAX_DEV_BATCHES is the slot arrivals join
+wait_queue_head_t batch_wq[NUMBER_DEVICES]; //members wait here for their batch to run
 u64 window_start_ns[NUMBER_DEVICES][MAX_DEV_BATCHES];
-bool use_cpu_instead[NUMBER_DEVICES][MAX_DEV_BATCHES];
-//0=idle, 1=id0 waiting, 2=running
-
-bool batch_closed[NUMBER_DEVICES][MAX_DEV_BATCHES];
-s64 first_arrival[NUMBER_DEVICES][MAX_DEV_BATCHES];
 
 #define ia_avg_sz 4
 #define ia_avg_shift 2
 u32 ia_avgs[NUMBER_DEVICES][ia_avg_sz];
-u32 ia_cur[NUMBER_DEVICES];
-s64 last_arrival[NUMBER_DEVICES];
+atomic_t ia_cur[NUMBER_DEVICES];
+atomic64_t last_arrival[NUMBER_DEVICES];
 
+//us per cpu inference of each model size, measured on this cpu once a weight set is packed
 u32 cpu_times[] = {7, 101, 196};
 
+//vectorized cpu models, see predictors_simd.h
+static int cpu_simd = LINNOS_SIMD_AVX512;
+module_param(cpu_simd, int, 0444);
+MODULE_PARM_DESC(cpu_simd, "Widest vector unit of the cpu models: 0 scalar, 1 avx2, 2 avx512 (default)");
+static int cpu_simd_models = 7;
+module_param(cpu_simd_models, int, 0444);
+MODULE_PARM_DESC(cpu_simd_models, "Model sizes that use the vector unit, bit 0 for +0, 1 for +1, 2 for +2, default 7");
+
+static enum linnos_simd_level simd_level;
+//one weight set per device and the test weights
+static struct linnos_cpu_packed *cpu_packed[NUMBER_DEVICES + 1];
+static struct linnos_cpu_scratch __percpu *cpu_scratch;
+
+static enum linnos_simd_level cpu_simd_detect(void) {
+	if (cpu_simd >= LINNOS_SIMD_AVX512 && boot_cpu_has(X86_FEATURE_AVX512F) &&
+			boot_cpu_has(X86_FEATURE_AVX512BW) &&
+			cpu_has_xfeatures(XFEATURE_MASK_SSE | XFEATURE_MASK_YMM | XFEATURE_MASK_AVX512, NULL))
+		return LINNOS_SIMD_AVX512;
+	if (cpu_simd >= LINNOS_SIMD_AVX2 && boot_cpu_has(X86_FEATURE_AVX2) &&
+			cpu_has_xfeatures(XFEATURE_MASK_SSE | XFEATURE_MASK_YMM, NULL))
+		return LINNOS_SIMD_AVX2;
+	return LINNOS_SIMD_NONE;
+}
+
+static bool weights_fit(long *w, int n, long limit) {
+	int j;
+
+	for (j = 0; j < n; j++)
+		if (w[j] < -limit || w[j] > limit)
+			return false;
+	return true;
+}
+
+//times the vector models of a packed set, best of a few rounds so an interrupt doesn't count
+#define CPU_TIMES_ROUNDS 4
+#define CPU_TIMES_RUNS 16
+static void cpu_times_measure(long **weights, int n_mid) {
+	static bool (*const models[])(char *, int, long **) = {
+		cpu_prediction_model, cpu_prediction_model_plus_1, cpu_prediction_model_plus_2,
+	};
+	char feat_vec[LEN_INPUT];
+	u64 start, best, ns;
+	int m, r, i;
+
+	//a feature vector is digits
+	for (i = 0; i < LEN_INPUT; i++)
+		feat_vec[i] = i % 10;
+	for (m = 0; m <= n_mid; m++) {
+		if (!(cpu_simd_models & (1 << m)))
+			continue;
+		best = U64_MAX;
+		for (r = 0; r < CPU_TIMES_ROUNDS; r++) {
+			start = ktime_get_ns();
+			for (i = 0; i < CPU_TIMES_RUNS; i++)
+				models[m](feat_vec, 1, weights);
+			ns = ktime_get_ns() - start;
+			if (ns < best)
+				best = ns;
+		}
+		cpu_times[m] = best / CPU_TIMES_RUNS / 1000 + 1;
+		pr_warn("linnos+%d on the cpu: %llu ns per input\n", m, best / CPU_TIMES_RUNS);
+	}
+}
+
+/*
+ * Makes the cpu models use the vector kernels for this weight set, called
+ * once its weights are final and before it predicts; n_mid is the number of
+ * 256x256 layers in weights[4..7]. Fails and leaves the set on the scalar
+ * models when the cpu has no usable vector unit or when the weights are too
+ * large for the packed layout, which could change results. Mid layers that
+ * are too large only keep the bigger models scalar.
+ */
+int cpu_prediction_pack(long **weights, int n_mid) {
+	struct linnos_cpu_packed *p = NULL;
+	long *weight_0_T_ent = weights[0], *weight_1_T_ent = weights[1];
+	int i, m;
+
+	simd_level = cpu_simd_detect();
+	if (simd_level == LINNOS_SIMD_NONE || !weight_0_T_ent)
+		return -ENODEV;
+	if (!weights_fit(weight_0_T_ent, LEN_LAYER_0 * LEN_INPUT, S16_MAX) ||
+			!weights_fit(weight_1_T_ent, LEN_LAYER_1 * LEN_LAYER_0, S32_MAX))
+		return -ERANGE;
+	for (m = 0; m < n_mid; m++)
+		if (!weights_fit(weights[4 + 2*m], LEN_LAYER_0 * LEN_LAYER_0, LINNOS_SIMD_MAX_W_M))
+			break;
+	n_mid = m;
+
+	if (!cpu_scratch) {
+		cpu_scratch = alloc_percpu(struct linnos_cpu_scratch);
+		if (!cpu_scratch)
+			return -ENOMEM;
+	}
+	for (i = 0; i < ARRAY_SIZE(cpu_packed); i++) {
+		if (cpu_packed[i] && cpu_packed[i]->src == weight_0_T_ent) {
+			p = cpu_packed[i];
+			break;
+		}
+	}
+	for (i = 0; !p && i < ARRAY_SIZE(cpu_packed); i++) {
+		if (!cpu_packed[i]) {
+			cpu_packed[i] = vzalloc(sizeof(*p));
+			if (!cpu_packed[i])
+				return -ENOMEM;
+		}
+		if (!cpu_packed[i]->src)
+			p = cpu_packed[i];
+	}
+	if (!p)
+		return -ENOSPC;
+
+	WRITE_ONCE(p->src, NULL);
+	linnos_cpu_pack_weights(p, weights, n_mid);
+	smp_store_release(&p->src, weight_0_T_ent);
+
+	cpu_times_measure(weights, n_mid);
+	return 0;
+}
+
+//at module exit, once nothing predicts anymore
+void cpu_prediction_release(void) {
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(cpu_packed); i++) {
+		vfree(cpu_packed[i]);
+		cpu_packed[i] = NULL;
+	}
+	free_percpu(cpu_scratch);
+	cpu_scratch = NULL;
+}
+
+static inline struct linnos_cpu_packed *cpu_packed_get(long **weights) {
+	int i;
+
+	if (simd_level == LINNOS_SIMD_NONE || !weights[0])
+		return NULL;
+	for (i = 0; i < ARRAY_SIZE(cpu_packed); i++)
+		if (cpu_packed[i] && smp_load_acquire(&cpu_packed[i]->src) == weights[0])
+			return cpu_packed[i];
+	return NULL;
+}
+
+/*
+ * Predicts with the vector kernels if this set and model size can, true
+ * then and *res is the prediction.
+ */
+static bool cpu_prediction_simd(char *feat_vec, long **weights, int n_mid, bool *res) {
+	struct linnos_cpu_packed *p;
+	s64 final_res_i[LEN_LAYER_1];
+	bool ok;
+
+	if (!(cpu_simd_models & (1 << n_mid)))
+		return false;
+	p = cpu_packed_get(weights);
+	//an interrupt that came in while the fpu was in use stays scalar
+	if (!p || p->n_mid < n_mid || !may_use_simd())
+		return false;
+
+	kernel_fpu_begin();
+	if (simd_level == LINNOS_SIMD_AVX512)
+		ok = linnos_cpu_avx512(p, n_mid, feat_vec, 1, this_cpu_ptr(cpu_scratch), final_res_i);
+	else
+		ok = linnos_cpu_avx2(p, n_mid, feat_vec, 1, this_cpu_ptr(cpu_scratch), final_res_i);
+	kernel_fpu_end();
+
+	if (ok)
+		*res = (final_res_i[0]>=final_res_i[1])? false: true;
+	return ok;
+}
+
+/*
+ * Predicts the n inputs of a closed batch in one pass over the weights
+ * per chunk. inputs holds LEN_INPUT longs per input like multi_inputs_to_gpu,
+ * outputs gets the last layer of input i at [i*64] and [i*64+32], where the
+ * gpu kernels put it, so gpu_get_prediction reads both. False if the batch
+ * cannot run on the vector kernels, every input predicts on its own then.
+ */
+bool cpu_prediction_batch(long *inputs, int n, long **weights, int n_mid, long *outputs) {
+	struct linnos_cpu_packed *p;
+	char feat_vecs[LINNOS_SIMD_CHUNK * LEN_INPUT];
+	s64 final_res_i[LINNOS_SIMD_CHUNK * LEN_LAYER_1];
+	int i, j, k, chunk;
+	bool ok = true;
+
+	if (!(cpu_simd_models & (1 << n_mid)))
+		return false;
+	p = cpu_packed_get(weights);
+	if (!p || p->n_mid < n_mid || !may_use_simd())
+		return false;
+
+	for (i = 0; ok && i < n; i += chunk) {
+		chunk = min(n - i, LINNOS_SIMD_CHUNK);
+		//back to the chars they were made from
+		for (j = 0; j < chunk * LEN_INPUT; j++)
+			feat_vecs[j] = inputs[i*LEN_INPUT + j];
+
+		//one chunk at a time, preemption is off in between
+		kernel_fpu_begin();
+		if (simd_level == LINNOS_SIMD_AVX512)
+			ok = linnos_cpu_avx512(p, n_mid, feat_vecs, chunk, this_cpu_ptr(cpu_scratch), final_res_i);
+		else
+			ok = linnos_cpu_avx2(p, n_mid, feat_vecs, chunk, this_cpu_ptr(cpu_scratch), final_res_i);
+		kernel_fpu_end();
+
+		for (k = 0; ok && k < chunk; k++) {
+			outputs[(i+k)*64] = final_res_i[2*k];
+			outputs[(i+k)*64 + 32] = final_res_i[2*k + 1];
+		}
+	}
+	return ok;
+}
+
 void predictors_mgpu_init(void) {
 	int i, j;
 	for (i=0 ; i < NUMBER_DEVICES ; i++) {
-		current_batch[i] = 0;
+		atomic_set(&cur_batch[i], 0);
 		ios_on_device[i] = 0;
-		last_arrival[i] = 0;
-		ia_cur[i] = 0;
-		spin_lock_init(&batch_entry[i]);
+		atomic64_set(&last_arrival[i], 0);
+		atomic_set(&ia_cur[i], 0);
+		init_waitqueue_head(&batch_wq[i]);
 		for (j=0 ; j < ia_avg_sz ; j++)
 			ia_avgs[i][j] = 800*_us; //start large
 		for (j=0 ; j < MAX_DEV_BATCHES ; j++) {
-			n_exited[i][j] = 0;
 			window_start_ns[i][j] = 0;
-			waiting[i][j] = 0;
-			init_completion(&batch_completed[i][j]);
-			init_completion(&finalize_batch[i][j]);
-			spin_lock_init(&per_batch_lock[i][j]);
-			batch_closed[i][j] = false;
+			linnos_batch_init(&batches[i][j]);
 		}
 	}
 }
@@ -117,21 +324,21 @@ void multi_gpu_predict_batch(char *__feat_vec, int n_vecs, long **weights, int d
 		&weights[1], &weights[3], &multi_d_mid_res_i[dev][batch], &multi_d_final_res_i[dev][batch]
 	};
 
-    check_error(hipModuleLaunchKernel(batch_linnos_mid_layer_kernel, 
+    check_error(lake_batch_hipModuleLaunchKernel(multi_batches[dev][batch],batch_linnos_mid_layer_kernel, 
 				n_vecs, 1, 1,          //blocks
 				256, 1, 1,   //threads per block
 				0,   //shared mem
                 cu_streams[dev][batch], 
 				args, NULL),
-			"hipModuleLaunchKernel", __LINE__);
+			"lake_batch_hipModuleLaunchKernel", __LINE__);
 
-    check_error(hipModuleLaunchKernel(batch_linnos_final_layer_kernel, 
+    check_error(lake_batch_hipModuleLaunchKernel(multi_batches[dev][batch],batch_linnos_final_layer_kernel, 
 				n_vecs, 1, 1,          //blocks
 				64, 1, 1,   //threads per block
 				0,   //shared mem
                 cu_streams[dev][batch], 
 				args1, NULL),
-			"hipModuleLaunchKernel", __LINE__);
+			"lake_batch_hipModuleLaunchKernel", __LINE__);
 }
 
 void multi_gpu_predict_batch_plus_1(char *__feat_vec, int n_vecs, long **weights, int dev, int batch) {
@@ -146,28 +353,28 @@ void multi_gpu_predict_batch_plus_1(char *__feat_vec, int n_vecs, long **weights
 		&weights[4], &weights[5], &multi_d_mid_res_i[dev][batch], &multi_d_mid_res_1_i[dev][batch]
 	};
 
-    check_error(hipModuleLaunchKernel(batch_linnos_mid_layer_kernel, 
+    check_error(lake_batch_hipModuleLaunchKernel(multi_batches[dev][batch],batch_linnos_mid_layer_kernel, 
 				n_vecs, 1, 1,          //blocks
 				256, 1, 1,   //threads per block
 				0,   //shared mem
                 cu_streams[dev][batch], 
 				args, NULL),
-			"hipModuleLaunchKernel", __LINE__);
+			"lake_batch_hipModuleLaunchKernel", __LINE__);
 
-	check_error(hipModuleLaunchKernel(batch_linnos_mid_layer_1_kernel, 
+	check_error(lake_batch_hipModuleLaunchKernel(multi_batches[dev][batch],batch_linnos_mid_layer_1_kernel, 
 				n_vecs, 1, 1,          //blocks
 				256, 1, 1,   //threads per block
 				0,   //shared mem
                 cu_streams[dev][batch], args2, NULL),
-			"hipModuleLaunchKernel", __LINE__);
+			"lake_batch_hipModuleLaunchKernel", __LINE__);
 
-    check_error(hipModuleLaunchKernel(batch_linnos_final_layer_kernel, 
+    check_error(lake_batch_hipModuleLaunchKernel(multi_batches[dev][batch],batch_linnos_final_layer_kernel, 
 				n_vecs, 1, 1,          //blocks
 				64, 1, 1,   //threads per block
 				0,   //shared mem
                 cu_streams[dev][batch], 
 				args1, NULL),
-			"hipModuleLaunchKernel", __LINE__);
+			"lake_batch_hipModuleLaunchKernel", __LINE__);
 }
 
 void multi_gpu_predict_batch_plus_2(char *__feat_vec, int n_vecs, long **weights, int dev, int batch) {
@@ -187,66 +394,74 @@ void multi_gpu_predict_batch_plus_2(char *__feat_vec, int n_vecs, long **weights
 		&weights[6], &weights[7], &multi_d_mid_res_1_i[dev][batch], &multi_d_mid_res_2_i[dev][batch]
 	};
 
-    check_error(hipModuleLaunchKernel(batch_linnos_mid_layer_kernel, 
+    check_error(lake_batch_hipModuleLaunchKernel(multi_batches[dev][batch],batch_linnos_mid_layer_kernel, 
 				n_vecs, 1, 1,          //blocks
 				256, 1, 1,   //threads per block
 				0,   //shared mem
                 cu_streams[dev][batch], 
 				args, NULL),
-			"hipModuleLaunchKernel", __LINE__);
+			"lake_batch_hipModuleLaunchKernel", __LINE__);
 
-	check_error(hipModuleLaunchKernel(batch_linnos_mid_layer_1_kernel, 
+	check_error(lake_batch_hipModuleLaunchKernel(multi_batches[dev][batch],batch_linnos_mid_layer_1_kernel, 
 				n_vecs, 1, 1,          //blocks
 				256, 1, 1,   //threads per block
 				0,   //shared mem
                 cu_streams[dev][batch], args2, NULL),
-			"hipModuleLaunchKernel", __LINE__);
+			"lake_batch_hipModuleLaunchKernel", __LINE__);
 
-	check_error(hipModuleLaunchKernel(batch_linnos_mid_layer_1_kernel, 
+	check_error(lake_batch_hipModuleLaunchKernel(multi_batches[dev][batch],batch_linnos_mid_layer_1_kernel, 
 				n_vecs, 1, 1,          //blocks
 				256, 1, 1,   //threads per block
 				0,   //shared mem
                 cu_streams[dev][batch], args3, NULL),
-			"hipModuleLaunchKernel", __LINE__);
+			"lake_batch_hipModuleLaunchKernel", __LINE__);
 
-    check_error(hipModuleLaunchKernel(batch_linnos_final_layer_kernel, 
+    check_error(lake_batch_hipModuleLaunchKernel(multi_batches[dev][batch],batch_linnos_final_layer_kernel, 
 				n_vecs, 1, 1,          //blocks
 				64, 1, 1,   //threads per block
 				0,   //shared mem
                 cu_streams[dev][batch], 
 				args1, NULL),
-			"hipModuleLaunchKernel", __LINE__);
+			"lake_batch_hipModuleLaunchKernel", __LINE__);
 }
 
-void do_gpu_inference(int n_vecs, long **weights, int dev, int batch_id) {
+bool do_gpu_inference(int n_vecs, long **weights, int dev, int batch_id, struct lake_future **late) {
 	multi_copy_inputs_to_gpu(n_vecs, dev, batch_id);
 	multi_gpu_predict_batch(0, n_vecs, weights, dev, batch_id);
-	multi_copy_results_from_gpu(n_vecs, dev, batch_id);
+	return multi_copy_results_from_gpu(n_vecs, dev, batch_id, late);
 }
 
-void do_gpu_inference_plus_one(int n_vecs, long **weights, int dev, int batch_id) {
+bool do_gpu_inference_plus_one(int n_vecs, long **weights, int dev, int batch_id, struct lake_future **late) {
 	multi_copy_inputs_to_gpu(n_vecs, dev, batch_id);
 	multi_gpu_predict_batch_plus_1(0, n_vecs, weights, dev, batch_id);
-	multi_copy_results_from_gpu(n_vecs, dev, batch_id);
+	return multi_copy_results_from_gpu(n_vecs, dev, batch_id, late);
 }
 
-void do_gpu_inference_plus_two(int n_vecs, long **weights, int dev, int batch_id) {
+bool do_gpu_inference_plus_two(int n_vecs, long **weights, int dev, int batch_id, struct lake_future **late) {
 	multi_copy_inputs_to_gpu(n_vecs, dev, batch_id);
 	multi_gpu_predict_batch_plus_2(0, n_vecs, weights, dev, batch_id);
-	multi_copy_results_from_gpu(n_vecs, dev, batch_id);
+	return multi_copy_results_from_gpu(n_vecs, dev, batch_id, late);
+}
+
+//the gpu reply of a batch that timed out came in, its slot may be reused
+static void gpu_batch_late(struct lake_cmd_ret *ret, void *arg) {
+	struct linnos_batch *b = arg;
+
+	linnos_batch_exit(b, linnos_batch_gen(atomic64_read(&b->state)));
 }
 
 //this is what an IO calls when it calls predict()
 bool gpu_batch_entry(char *feat_vec, int n_vecs, long **weights) {
-	u16 my_id;
-	u16 my_batch;
+	struct linnos_batch *b;
+	int my_id = -1;
+	u32 my_batch, my_gen, size, seq;
 	bool my_prediction, use_cpu, skip;
 	s64 my_arrival;
 	u32 i, this_dev=99;
-	unsigned long irqflags, err;
 	s64 dif;
 	bool is_last = false;
-	bool inf_fast = false;
+	bool gpu_ok;
+	struct lake_future *late;
 	s64 ia_avg = 0;
 
 	for(i = 0; i < NUMBER_DEVICES ; i++) {
@@ -260,27 +475,9 @@ bool gpu_batch_entry(char *feat_vec, int n_vecs, long **weights) {
 		return false;
 	}
 
-enter_again:
-	spin_lock_irqsave(&batch_entry[this_dev], irqflags);
-	my_batch = current_batch[this_dev];
-	my_id = waiting[this_dev][my_batch];
-	//check this batch out
-	
-	//should we NOT get in this batch bc its running?
-	if (batch_closed[this_dev][my_batch] == true) {
-		//lets loop and try another
-		current_batch[this_dev] = (current_batch[this_dev]+1) % MAX_DEV_BATCHES;
-		//pr_warn("batch is closed, increasing by one to %d\n", current_batch[this_dev]);
-		spin_unlock_irqrestore(&batch_entry[this_dev], irqflags);
-		udelay(2); //we can afford 2 for a reschedule
-		goto enter_again;
-	}
-
 	my_arrival = ktime_get_ns();
-	dif = my_arrival - last_arrival[this_dev];
-	ia_cur[this_dev] = (ia_cur[this_dev]+1)% ia_avg_sz ;
-	ia_avgs[this_dev][ia_cur[this_dev]] = dif;
-	last_arrival[this_dev] = my_arrival;
+	dif = my_arrival - atomic64_xchg(&last_arrival[this_dev], my_arrival);
+	ia_avgs[this_dev][(u32)atomic_inc_return(&ia_cur[this_dev]) % ia_avg_sz] = dif;
 
 	ia_avg = 0;
 	for (i = 0 ; i < ia_avg_sz ; i++)
@@ -295,174 +492,121 @@ enter_again:
 	skip |= (window_size_ns <= WINDOW_THRESHOLD);
 	//skip = true;
 	if(skip) {
-		spin_unlock_irqrestore(&batch_entry[this_dev], irqflags);
 		n_skipped++;
 		my_prediction = cpu_prediction_model(feat_vec, n_vecs, weights);
 		
 		return no_reject ? false : my_prediction;
 	}
 
-	//we can. would we close this batch?
-	dif = my_arrival - first_arrival[this_dev][my_batch];
-	is_last = dif >= window_size_ns;
-	is_last = is_last && my_id; //cant be first
-	if (is_last || my_id >= max_batch_size) {
-		//pr_warn("i am last of batch %d  time dif? %d  [%lld]!\n", my_batch, is_last, dif);
-		//if so, increase current batch
-		current_batch[this_dev] = (current_batch[this_dev]+1) % MAX_DEV_BATCHES;
-		//we are last, mark batch as full
-		is_last = true;
-		batch_closed[this_dev][my_batch] = true;
-	}
-	//we can but not we are not last
-	else {
-		//pr_warn("  not last\n");
-		is_last = false;
+	//get a ticket in the open batch; closed or full ones move the device on to the next slot.
+	//preemption stays off until our input is in, a closer spins on that
+	preempt_disable();
+	for (i = 0; i < MAX_DEV_BATCHES; i++) {
+		seq = atomic_read(&cur_batch[this_dev]);
+		my_batch = seq % MAX_DEV_BATCHES;
+		b = &batches[this_dev][my_batch];
+		my_id = linnos_batch_join(b, max_batch_size, &my_gen);
+		if (my_id >= 0)
+			break;
+		atomic_cmpxchg(&cur_batch[this_dev], seq, seq + 1);
 	}
-
-	//add one to batch size
-	waiting[this_dev][my_batch] += 1;
-	if (my_id == 0) {
-		//pr_warn("id 0 reiniting batch %d\n", my_batch);
-		reinit_completion(&finalize_batch[this_dev][my_batch]);
-		reinit_completion(&batch_completed[this_dev][my_batch]);
-		use_cpu = true;
-		n_exited[this_dev][my_batch] = 0;
-		first_arrival[this_dev][my_batch] = ktime_get_ns();
+	//every slot is still running or being read
+	if (unlikely(my_id < 0)) {
+		preempt_enable();
+		n_skipped++;
+		my_prediction = cpu_prediction_model(feat_vec, n_vecs, weights);
+		return no_reject ? false : my_prediction;
 	}
-	//let others execute
-	spin_unlock_irqrestore(&batch_entry[this_dev], irqflags);
-
-	// for (i = 0 ; i < ia_avg_sz ; i++)
-	// 	ia_avg += ia_avgs[this_dev][i];
-	// ia_avg = ia_avg >> ia_avg_shift;
-	
-	// //if (cpu_gpu_threshold * ia_avg  > cpu_times[model_size] * ia_avg) { //use cpu
-	// if (ia_avg >= window_size_ns) {
-	// 	my_arrival = ktime_get_ns();
-	// 	tdiff = my_arrival - last_arrival[this_dev][my_batch];
-	// 	last_arrival[this_dev][my_batch] = my_arrival;
-	// 	ia_cur[this_dev] += 1;
-	// 	ia_avgs[this_dev][ ia_cur[this_dev] % ia_avg_sz ] = tdiff;
-	// 	waiting[this_dev][my_batch] = 0;
-	// 	spin_unlock_irqrestore(&per_batch_lock[this_dev][my_batch], irqflags);
-	// 	goto lonely;
-	// }
+	if (my_id == 0)
+		linnos_batch_start(b, my_arrival);
 
 	//copy inputs to intermediary buffer, but we need to convert into longs for gpu
 	for (i = 0 ; i < LEN_INPUT ; i++)
 		multi_inputs_to_gpu[this_dev][my_batch][my_id*LEN_INPUT+i] = (long) feat_vec[i];
+	linnos_batch_ready(b);
+	preempt_enable();
 
-	//last closes everything
-	if (is_last) {
-last_req_close:
-		//record in histogram
-		window_size_hist[waiting[this_dev][my_batch]] += 1;
-		//pr_warn(">> closing batch %d size %d\n", my_batch, waiting[this_dev][my_batch]);
+	//we fill the batch or its window is over: try to close it
+	is_last = my_id + 1 >= max_batch_size;
+	is_last |= my_id && linnos_batch_expired(b, my_arrival, window_size_ns);
+	if (is_last && linnos_batch_close(b, my_gen, max_batch_size, &size))
+		goto last_req_close;
 
-		//lonely request :(
-		if(waiting[this_dev][my_batch] <= 1) {
-			use_cpu = true;
-			goto reset_this_batch;
-		}
-		//not big enough for gpu
-		else if(waiting[this_dev][my_batch] < cpu_gpu_threshold) {
-			use_cpu_instead[this_dev][my_batch] = true;
-			use_cpu = true;
-		}
-		//use the gpu
-		else {
-			use_cpu_instead[this_dev][my_batch] = false;
-			use_cpu = false;
-			n_used_gpu++;
-			//my_prediction = false; //XXX
-			if (model_size == 0) do_gpu_inference(waiting[this_dev][my_batch], 
-				gpu_weights[this_dev].weights, this_dev, my_batch); 
-			else if (model_size == 1) do_gpu_inference_plus_one(waiting[this_dev][my_batch], 
-				gpu_weights[this_dev].weights, this_dev, my_batch); 
-			else do_gpu_inference_plus_two(waiting[this_dev][my_batch], 
-				gpu_weights[this_dev].weights, this_dev, my_batch); 
+	//maybe this batch will never have a last, so we have to handle it. first may becomes last
+	if (my_id == 0 &&
+			!wait_event_timeout(batch_wq[this_dev], linnos_batch_done(b, my_gen),
+				usecs_to_jiffies((window_size_ns)/1000)) &&
+			linnos_batch_close(b, my_gen, max_batch_size, &size))
+		goto last_req_close;
+
+	//wait until the last wakes us up; if it takes too long we predict on our own
+	use_cpu = true;
+	if (wait_event_timeout(batch_wq[this_dev], linnos_batch_done(b, my_gen),
+				usecs_to_jiffies((window_size_ns*5)/1000)) || linnos_batch_done(b, my_gen)) {
+		use_cpu = b->use_cpu;
+		if (!use_cpu) 
 			my_prediction = gpu_get_prediction(this_dev, my_batch, my_id);
-		}
+	}
+	linnos_batch_exit(b, my_gen);
 
-		//let everyone go now
-		n_exited[this_dev][my_batch] += 1;
-		//pr_warn(" last %d: waking up all\n", my_batch);
-		complete_all(&batch_completed[this_dev][my_batch]);
-
-		//wait for everyone to quit
-		//pr_warn(" last %d: waiting for everyone to quit\n", my_batch);
-		//wait_for_completion(&finalize_batch[this_dev][my_batch]);
-		err = wait_for_completion_timeout(&batch_completed[this_dev][my_batch], usecs_to_jiffies((window_size_ns*10)/1000));
-		if (err == 0) {
-			//pr_warn("!!!!!!!!!!!!!!!!!!!!!!!!!!! LAST WAITED FOR TOO LONG\n");
-		}
-		
-		//pr_warn(" last %d: done \n", my_batch);
-reset_this_batch:
-		//reset
-		waiting[this_dev][my_batch] = 0;
-		batch_closed[this_dev][my_batch] = false;
-
-		if (use_cpu)
-			my_prediction = cpu_prediction_model(feat_vec, n_vecs, weights);
+	if (use_cpu) 
+		my_prediction = cpu_prediction_model(feat_vec, n_vecs, weights);
 			
-		return no_reject ? false : my_prediction;
-	}
+	return no_reject ? false : my_prediction;
 
-	//not last
-	//maybe this batch will never have a last, so we have to handle it. first may becomes last
-	if (my_id == 0) {
-		err = wait_for_completion_timeout(&batch_completed[this_dev][my_batch], usecs_to_jiffies((window_size_ns)/1000));
-		//if this was a timeout, do what the last would to
-		if(err == 0) {
-			//pr_warn(" id0: timed out\n");
-			//race condition: there is a chance id 0 woke up just after someone got in
-			//and who got in could be last or not
-			// if last, we have to wait
-			// if not, we are the last
-			spin_lock_irqsave(&per_batch_lock[this_dev][my_batch], irqflags);
-			//someone closed this batch, so there is a last already
-			if (batch_closed[this_dev][my_batch] == true) {
-				//fall through
-				//pr_warn(" !!!!!!!!: falling through, id0 timedout but there is last\n");
-				spin_unlock_irqrestore(&per_batch_lock[this_dev][my_batch], irqflags);
-			}
-			//it's either only us or there are more, but they are just waiting
-			else { 
-				//pr_warn("!!!!!!!!!!!!!!!! id0 : becoming last \n");
-				batch_closed[this_dev][my_batch] = true;
-				spin_unlock_irqrestore(&per_batch_lock[this_dev][my_batch], irqflags);
-				goto last_req_close;
-			} 
-		}
+	//last closes everything
+last_req_close:
+	//new arrivals go to the next slot
+	atomic_cmpxchg(&cur_batch[this_dev], seq, seq + 1);
+	linnos_batch_wait_ready(b, size);
+	//record in histogram
+	window_size_hist[size] += 1;
+	//pr_warn(">> closing batch %d size %d\n", my_batch, size);
+
+	//lonely request :(
+	if(size <= 1) {
+		use_cpu = true;
 	}
-
-	//wait until the last wake us up
-	//wait_for_completion(&batch_completed[this_dev][my_batch]);
-	err = wait_for_completion_timeout(&batch_completed[this_dev][my_batch], usecs_to_jiffies((window_size_ns*5)/1000));
-	if (err == 0) {
-		//fall through
-		//pr_warn("!!!!!!!!!!!!!!!!!!!!!!!! THIS SHOULDNT HAVE HAPPENED  !! %d id %d\n", my_batch, my_id);
+	//not big enough for gpu: predict the whole batch here, with the model the waiters
+	//would run on their own, and they read their slot like after the gpu
+	else if(size < cpu_gpu_threshold) {
+		use_cpu = !cpu_prediction_batch(multi_inputs_to_gpu[this_dev][my_batch], size,
+			weights, 0, multi_gpu_outputs[this_dev][my_batch]);
+		if (!use_cpu)
+			my_prediction = gpu_get_prediction(this_dev, my_batch, my_id);
 	}
-
-	use_cpu = use_cpu_instead[this_dev][my_batch];
-	if (!use_cpu) 
-		my_prediction = gpu_get_prediction(this_dev, my_batch, my_id);
-
-	//spin_lock_irqsave(&per_batch_lock[this_dev][my_batch], irqflags);
-	n_exited[this_dev][my_batch] += 1;
-	//pr_warn("%d/%d/%d:  %d/%d left\n", this_dev, my_batch, my_id, n_exited[this_dev][my_batch], this_batch_size[this_dev][my_batch]);
-	//we are the last one to exit, inform last
-	if (n_exited[this_dev][my_batch] == waiting[this_dev][my_batch]) {
-		complete(&finalize_batch[this_dev][my_batch]);
-		//pr_warn("%d/%d/%d: Waking up first!", this_dev, my_batch, my_id);
+	//use the gpu
+	else {
+		use_cpu = false;
+		n_used_gpu++;
+		//my_prediction = false; //XXX
+		if (model_size == 0) gpu_ok = do_gpu_inference(size, 
+			gpu_weights[this_dev].weights, this_dev, my_batch, &late); 
+		else if (model_size == 1) gpu_ok = do_gpu_inference_plus_one(size, 
+			gpu_weights[this_dev].weights, this_dev, my_batch, &late); 
+		else gpu_ok = do_gpu_inference_plus_two(size, 
+			gpu_weights[this_dev].weights, this_dev, my_batch, &late); 
+		//the batch failed or timed out, everyone in it predicts on the cpu
+		if (unlikely(!gpu_ok))
+			use_cpu = true;
+		//a timed out batch still owns the slot's buffers, the next batch here
+		//(maybe on the cpu) can't have them until its reply is in
+		if (unlikely(late)) {
+			linnos_batch_hold(b);
+			lake_future_then(late, gpu_batch_late, b);
+		}
+		else
+			my_prediction = gpu_get_prediction(this_dev, my_batch, my_id);
 	}
-	//spin_unlock_irqrestore(&per_batch_lock[this_dev][my_batch], irqflags);
 
-	if (use_cpu) 
+	//let everyone go now
+	linnos_batch_publish(b, my_gen, use_cpu);
+	wake_up_all(&batch_wq[this_dev]);
+	linnos_batch_exit(b, my_gen);
+
+	if (use_cpu)
 		my_prediction = cpu_prediction_model(feat_vec, n_vecs, weights);
-			
+		
 	return no_reject ? false : my_prediction;
 }
 
@@ -581,14 +725,79 @@ void gpu_predict_batch_plus_2(char *__feat_vec, int n_vecs, long **weights) {
 	}
 }
 
+//int8 model, see predictors_q8.h; the uint8 activations live in the mid result buffers
+void gpu_predict_batch_q8(char *__feat_vec, int n_vecs, struct GPU_weights_q8 *state, int n_mid) {
+	hipDeviceptr_t mid[3] = { d_mid_res_i, d_mid_res_1_i, d_mid_res_2_i };
+	void *args[] = {
+		&state->weight_0_T, &state->bias_0, &d_input_vec_i, &mid[0], &state->requant_mul[0]
+	};
+	void *args1[] = {
+		&state->weight_1_T, &state->bias_1[n_mid], &mid[n_mid], &d_final_res_i
+	};
+	int i;
+
+    check_error(hipModuleLaunchKernel(batch_linnos_q8_mid_layer_kernel, 
+				n_vecs, 1, 1,          //blocks
+				256, 1, 1,   //threads per block
+				0,   //shared mem
+                NULL, args, NULL),
+			"hipModuleLaunchKernel", __LINE__);
+
+	for (i = 0; i < n_mid; i++) {
+		void *args_m[] = {
+			&state->weight_M_T[i], &state->bias_M[i], &mid[i], &mid[i + 1], &state->requant_mul[i + 1]
+		};
+		check_error(hipModuleLaunchKernel(batch_linnos_q8_mid_layer_m_kernel, 
+				n_vecs, 1, 1,          //blocks
+				256, 1, 1,   //threads per block
+				0,   //shared mem
+				NULL, args_m, NULL),
+			"hipModuleLaunchKernel", __LINE__);
+	}
+
+    check_error(hipModuleLaunchKernel(batch_linnos_q8_final_layer_kernel, 
+				n_vecs, 1, 1,          //blocks
+				64, 1, 1,   //threads per block
+				0,   //shared mem
+                NULL, args1, NULL),
+			"hipModuleLaunchKernel", __LINE__);
+	if(PREDICT_GPU_SYNC == 1) {
+		check_error(hipDeviceSynchronize(), "hipDeviceSynchronize", __LINE__);
+	}
+}
+
 bool fake_prediction_model(char *feat_vec, int n_vecs, long **weights) {
 	//pr_warn("FAKE\n");
 	return false;
 }
+bool cpu_prediction_model(char *feat_vec, int n_vecs, long **weights) {
+	bool end;
+
+	if (cpu_prediction_simd(feat_vec, weights, 0, &end))
+		return no_reject ? false : end;
+	return cpu_prediction_model_scalar(feat_vec, n_vecs, weights);
+}
+
+bool cpu_prediction_model_plus_1(char *feat_vec, int n_vecs, long **weights) {
+	bool end;
+
+	if (cpu_prediction_simd(feat_vec, weights, 1, &end))
+		return no_reject ? false : end;
+	return cpu_prediction_model_plus_1_scalar(feat_vec, n_vecs, weights);
+}
+
+bool cpu_prediction_model_plus_2(char *feat_vec, int n_vecs, long **weights) {
+	bool end;
+
+	if (cpu_prediction_simd(feat_vec, weights, 2, &end))
+		return no_reject ? false : end;
+	return cpu_prediction_model_plus_2_scalar(feat_vec, n_vecs, weights);
+}
+
 //dont remove dead code
 #pragma GCC push_options
 #pragma GCC optimize (DEADFLAG)
-bool cpu_prediction_model(char *feat_vec, int n_vecs, long **weights) {
+bool cpu_prediction_model_scalar(char *feat_vec, int n_vecs, long **weights) {
 	long input_vec_i[LEN_INPUT], mid_res_i[LEN_LAYER_0], final_res_i[LEN_LAYER_1];
 	long *weight_0_T_ent, * bias_0_ent, *weight_1_T_ent, * bias_1_ent; 
 	int i, j, k, offset;
@@ -678,7 +887,7 @@ bool cpu_prediction_model(char *feat_vec, int n_vecs, long **weights) {
 	return no_reject ? false : end; 
 }
 
-bool cpu_prediction_model_plus_1(char *feat_vec, int n_vecs, long **weights) {
+bool cpu_prediction_model_plus_1_scalar(char *feat_vec, int n_vecs, long **weights) {
 	long input_vec_i[LEN_INPUT], mid_res_i[LEN_LAYER_0], mid_res_m_1[LEN_LAYER_M_1], final_res_i[LEN_LAYER_1];
 	long *weight_0_T_ent, * bias_0_ent, *weight_1_T_ent, * bias_1_ent, *weight_M_1, *bias_M_1; 
 	int i, j, k, offset;
@@ -787,7 +996,7 @@ bool cpu_prediction_model_plus_1(char *feat_vec, int n_vecs, long **weights) {
 	return no_reject ? false : end; 
 }
 
-bool cpu_prediction_model_plus_2(char *feat_vec, int n_vecs, long **weights) {
+bool cpu_prediction_model_plus_2_scalar(char *feat_vec, int n_vecs, long **weights) {
 	long input_vec_i[LEN_INPUT], mid_res_i[LEN_LAYER_0], mid_res_m_1[LEN_LAYER_M_1], mid_res_m_2[LEN_LAYER_M_2], final_res_i[LEN_LAYER_1];
 	long *weight_0_T_ent, * bias_0_ent, *weight_1_T_ent, * bias_1_ent, *weight_M_1, *bias_M_1, *weight_M_2, *bias_M_2; 
 	int i, j, k, offset;
@@ -1028,4 +1237,45 @@ void gpu_predict_batch_plus_2_cuda(char *__feat_vec, int n_vecs, long **weights)
 	if(PREDICT_GPU_SYNC == 1) {
 		check_error(cuCtxSynchronize(), "cuCtxSynchronize", __LINE__);
 	}
-}
\ No newline at end of file
+}
+
+//int8 model, see predictors_q8.h; the uint8 activations live in the mid result buffers
+void gpu_predict_batch_q8_cuda(char *__feat_vec, int n_vecs, struct GPU_weights_q8 *state, int n_mid) {
+	CUdeviceptr mid[3] = { d_mid_res_i_cuda, d_mid_res_1_i_cuda, d_mid_res_2_i_cuda };
+	void *args[] = {
+		&state->weight_0_T, &state->bias_0, &d_input_vec_i_cuda, &mid[0], &state->requant_mul[0]
+	};
+	void *args1[] = {
+		&state->weight_1_T, &state->bias_1[n_mid], &mid[n_mid], &d_final_res_i_cuda
+	};
+	int i;
+
+    check_error(cuLaunchKernel(batch_linnos_q8_mid_layer_kernel_cuda, 
+				n_vecs, 1, 1,          //blocks
+				256, 1, 1,   //threads per block
+				0,   //shared mem
+                NULL, args, NULL),
+			"cuLaunchKernel", __LINE__);
+
+	for (i = 0; i < n_mid; i++) {
+		void *args_m[] = {
+			&state->weight_M_T[i], &state->bias_M[i], &mid[i], &mid[i + 1], &state->requant_mul[i + 1]
+		};
+		check_error(cuLaunchKernel(batch_linnos_q8_mid_layer_m_kernel_cuda, 
+				n_vecs, 1, 1,          //blocks
+				256, 1, 1,   //threads per block
+				0,   //shared mem
+				NULL, args_m, NULL),
+			"cuLaunchKernel", __LINE__);
+	}
+
+    check_error(cuLaunchKernel(batch_linnos_q8_final_layer_kernel_cuda, 
+				n_vecs, 1, 1,          //blocks
+				64, 1, 1,   //threads per block
+				0,   //shared mem
+                NULL, args1, NULL),
+			"cuLaunchKernel", __LINE__);
+	if(PREDICT_GPU_SYNC == 1) {
+		check_error(cuCtxSynchronize(), "cuCtxSynchronize", __LINE__);
+	}
+}
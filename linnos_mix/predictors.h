@@ -40,12 +40,12 @@
 #ifdef __KERNEL__
 #include <linux/types.h>
 #include <linux/completion.h>
+#include "variables.h"
 #else
 #include <stdbool.h>
+struct GPU_weights_q8;
 #endif
 
-#include "variables.h"
-
 
 #ifdef __KERNEL__
 //these externs are for batching
@@ -64,12 +64,20 @@ bool gpu_batch_entry(char *feat_vec, int n_vecs, long **weights);
 bool cpu_prediction_model(char *feat_vec, int n_vecs, long **weights);
 bool cpu_prediction_model_plus_1(char *feat_vec, int n_vecs, long **weights);
 bool cpu_prediction_model_plus_2(char *feat_vec, int n_vecs, long **weights);
+bool cpu_prediction_model_scalar(char *feat_vec, int n_vecs, long **weights);
+bool cpu_prediction_model_plus_1_scalar(char *feat_vec, int n_vecs, long **weights);
+bool cpu_prediction_model_plus_2_scalar(char *feat_vec, int n_vecs, long **weights);
+int cpu_prediction_pack(long **weights, int n_mid);
+bool cpu_prediction_batch(long *inputs, int n, long **weights, int n_mid, long *outputs);
+void cpu_prediction_release(void);
 void gpu_predict_batch(char *__feat_vec, int n_vecs, long **weights);
 void gpu_predict_batch_plus_1(char *__feat_vec, int n_vecs, long **weights);
 void gpu_predict_batch_plus_2(char *__feat_vec, int n_vecs, long **weights);
 void gpu_predict_batch_cuda(char *__feat_vec, int n_vecs, long **weights);
 void gpu_predict_batch_plus_1_cuda(char *__feat_vec, int n_vecs, long **weights);
 void gpu_predict_batch_plus_2_cuda(char *__feat_vec, int n_vecs, long **weights);
+void gpu_predict_batch_q8(char *__feat_vec, int n_vecs, struct GPU_weights_q8 *state, int n_mid);
+void gpu_predict_batch_q8_cuda(char *__feat_vec, int n_vecs, struct GPU_weights_q8 *state, int n_mid);
 
 void multi_gpu_predict_batch(char *__feat_vec, int n_vecs, long **weights, int dev, int batch);
 void multi_gpu_predict_batch_plus_1(char *__feat_vec, int n_vecs, long **weights, int dev, int batch);
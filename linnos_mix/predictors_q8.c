@@ -0,0 +1,75 @@
+/*
+ * Part of LAKE: Towards a Machine Learning-Assisted Kernel with LAKE
+ *
+ * Original work:
+ *   Copyright (C) 2022–2024 Henrique Fingler
+ *   Copyright (C) 2022–2024 Isha Tarte
+ *
+ * Modifications and adaptations for LAIKA:
+ *   Copyright (C) 2024-2025 Haoming Zhuo
+ *
+ * This file is adapted from the original LAKE kernel module.
+ * Major changes include:
+ *   - Integration with LAIKA framework
+ *   - Hybrid execution support
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "predictors_q8.h"
+
+/*
+ * The int8 cpu model, see predictors_q8.h. Plain integer code: the sums
+ * are int32 and nothing here needs the fpu, so it runs in any context.
+ */
+static void q8_layer(const s8 *w, const s32 *bias, const u8 *in, u8 *out, s32 mul) {
+	int j, k;
+
+	for (j = 0; j < LEN_LAYER_0; j++, w += LEN_LAYER_0) {
+		s32 acc = bias[j];
+
+		for (k = 0; k < LEN_LAYER_0; k++)
+			acc += in[k] * w[k];
+		out[j] = linnos_q8_requant(acc, mul);
+	}
+}
+
+bool cpu_prediction_model_q8(char *feat_vec, int n_vecs, struct linnos_q8 *q, int n_mid) {
+	u8 mid_res[3][LEN_LAYER_0];
+	const s8 *w = q->weight_0_T;
+	const u8 *last;
+	s32 final_res[LEN_LAYER_1];
+	int i, j, k;
+	bool end;
+
+	for (j = 0; j < LEN_LAYER_0; j++, w += LEN_INPUT) {
+		s32 acc = q->bias_0[j];
+
+		for (i = 0; i < LEN_INPUT; i++)
+			acc += feat_vec[i] * w[i];
+		mid_res[0][j] = linnos_q8_requant(acc, q->requant_mul[0]);
+	}
+	if (n_mid > 0)
+		q8_layer(q->weight_M_1_T, q->bias_M_1, mid_res[0], mid_res[1], q->requant_mul[1]);
+	if (n_mid > 1)
+		q8_layer(q->weight_M_2_T, q->bias_M_2, mid_res[1], mid_res[2], q->requant_mul[2]);
+
+	last = mid_res[n_mid];
+	for (i = 0; i < LEN_LAYER_1; i++) {
+		final_res[i] = q->bias_1[n_mid][i];
+		for (k = 0; k < LEN_LAYER_0; k++)
+			final_res[i] += last[k] * q->weight_1_T[i * LEN_LAYER_0 + k];
+	}
+	end = (final_res[0]>=final_res[1])? false: true;
+	return no_reject ? false : end;
+}
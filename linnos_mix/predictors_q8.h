@@ -0,0 +1,79 @@
+/*
+ * Part of LAKE: Towards a Machine Learning-Assisted Kernel with LAKE
+ *
+ * Original work:
+ *   Copyright (C) 2022–2024 Henrique Fingler
+ *   Copyright (C) 2022–2024 Isha Tarte
+ *
+ * Modifications and adaptations for LAIKA:
+ *   Copyright (C) 2024-2025 Haoming Zhuo
+ *
+ * This file is adapted from the original LAKE kernel module.
+ * Major changes include:
+ *   - Integration with LAIKA framework
+ *   - Hybrid execution support
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef __LINNOS_PREDICTORS_Q8_H
+#define __LINNOS_PREDICTORS_Q8_H
+
+#include <linux/types.h>
+#include "predictors.h"
+
+/*
+ * int8 LinnOS model, converted from the long weights by quantize_weights.py
+ * (see there for the calibration). Weights are int8 with one scale per
+ * layer, activations uint8, every layer sums into int32: 31 inputs of at
+ * most 255 * 127, or 256 of at most 255 * 127, cannot overflow.
+ *
+ * Biases are stored at the scale of their layer's sums. The hidden layers
+ * turn their sums into the next activations with linnos_q8_requant, the
+ * last layer compares its two sums like the long model does; it reads
+ * layer 0, M_1 or M_2 depending on the model size, each at its own scale,
+ * so it has one pair of biases per size.
+ *
+ * The weights are about 8 times smaller than the long ones, one struct
+ * holds all three model sizes and is copied to a device in one piece.
+ */
+#define LINNOS_Q8_SHIFT 24
+#define LINNOS_Q8_MAX 255
+
+struct linnos_q8 {
+	s8 weight_0_T[LEN_LAYER_0 * LEN_INPUT];
+	s8 weight_1_T[LEN_LAYER_1 * LEN_LAYER_0];
+	s8 weight_M_1_T[LEN_LAYER_M_1 * LEN_LAYER_0];
+	s8 weight_M_2_T[LEN_LAYER_M_2 * LEN_LAYER_M_1];
+	s32 bias_0[LEN_LAYER_0];
+	s32 bias_M_1[LEN_LAYER_M_1];
+	s32 bias_M_2[LEN_LAYER_M_2];
+	s32 bias_1[3][LEN_LAYER_1];	//+0, +1, +2
+	s32 requant_mul[3];		//layers 0, M_1, M_2
+};
+
+extern struct linnos_q8 test_weights_q8;
+
+//sum of a hidden layer (bias included) to the activation of the next one
+static inline u8 linnos_q8_requant(s32 acc, s32 mul) {
+	s64 v;
+
+	if (acc <= 0)
+		return 0;
+	v = ((s64)acc * mul + (1LL << (LINNOS_Q8_SHIFT - 1))) >> LINNOS_Q8_SHIFT;
+	return v > LINNOS_Q8_MAX ? LINNOS_Q8_MAX : v;
+}
+
+bool cpu_prediction_model_q8(char *feat_vec, int n_vecs, struct linnos_q8 *q, int n_mid);
+
+#endif
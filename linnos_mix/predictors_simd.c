@@ -0,0 +1,338 @@
+/*
+ * Part of LAKE: Towards a Machine Learning-Assisted Kernel with LAKE
+ *
+ * Original work:
+ *   Copyright (C) 2022–2024 Henrique Fingler
+ *   Copyright (C) 2022–2024 Isha Tarte
+ *
+ * Modifications and adaptations for LAIKA:
+ *   Copyright (C) 2024-2025 Haoming Zhuo
+ *
+ * This file is adapted from the original LAKE kernel module.
+ * Major changes include:
+ *   - Integration with LAIKA framework
+ *   - Hybrid execution support
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifdef __KERNEL__
+#include <linux/compiler.h>
+#endif
+#include "predictors_simd.h"
+
+/*
+ * The vector kernels of the cpu models, see predictors_simd.h.
+ * Callers hold kernel_fpu_begin and checked the cpu has the unit, each
+ * function enables its own instruction set. Plain vector types only, so
+ * there is no need for the compiler's intrinsics headers in the kernel;
+ * the two instructions without a C operator are written out.
+ */
+typedef short v16hi __attribute__((vector_size(32)));
+typedef int v8si __attribute__((vector_size(32)));
+typedef long long v4di __attribute__((vector_size(32)));
+typedef short v32hi __attribute__((vector_size(64)));
+typedef int v16si __attribute__((vector_size(64)));
+typedef long long v8di __attribute__((vector_size(64)));
+
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#define TARGET_AVX512 __attribute__((target("avx512f,avx512bw")))
+
+void linnos_cpu_pack_weights(struct linnos_cpu_packed *p, long **weights, int n_mid)
+{
+	long *weight_0_T_ent = weights[0], *weight_1_T_ent = weights[1];
+	long *bias_0_ent = weights[2], *bias_1_ent = weights[3];
+	long *weight_M, *bias_M;
+	int b, i, c, k, j, m;
+
+	for (b = 0; b < LINNOS_SIMD_BLOCKS; b++)
+		for (i = 0; i < LINNOS_SIMD_PAIRS_0; i++)
+			for (c = 0; c < LINNOS_SIMD_COLS; c++)
+				for (k = 0; k < 2; k++) {
+					j = 2*i + k;
+					p->w0[b][i][c][k] = j < LEN_INPUT ?
+						weight_0_T_ent[(b*LINNOS_SIMD_COLS + c) * LEN_INPUT + j] : 0;
+				}
+	for (j = 0; j < LEN_LAYER_0; j++)
+		p->b0[j] = bias_0_ent[j];
+	for (m = 0; m < n_mid; m++) {
+		weight_M = weights[4 + 2*m];
+		bias_M = weights[5 + 2*m];
+		for (b = 0; b < LINNOS_SIMD_BLOCKS; b++)
+			for (i = 0; i < LINNOS_SIMD_PAIRS_M; i++)
+				for (c = 0; c < LINNOS_SIMD_COLS; c++)
+					for (k = 0; k < 2; k++)
+						p->wm[m][b][i][c][k] =
+							weight_M[(b*LINNOS_SIMD_COLS + c) * LEN_LAYER_0 + 2*i + k];
+		for (j = 0; j < LEN_LAYER_0; j++)
+			p->bm[m][j] = bias_M[j];
+	}
+	p->n_mid = n_mid;
+	for (i = 0; i < LEN_LAYER_1; i++) {
+		for (j = 0; j < LEN_LAYER_0; j++)
+			p->w1[i][j] = weight_1_T_ent[i*LEN_LAYER_0 + j];
+		p->b1[i] = bias_1_ent[i];
+	}
+}
+
+//inputs 2*pair and 2*pair+1 as the scalar model reads them, in the halves of one word
+static inline s32 input_pair(const char *feat_vec, int pair)
+{
+	s16 lo = feat_vec[2*pair];
+	s16 hi = 2*pair+1 < LEN_INPUT ? feat_vec[2*pair+1] : 0;
+
+	return (u16)lo | ((u32)(u16)hi << 16);
+}
+
+static inline void inputs_to_pairs(const char *feat_vecs, int n, struct linnos_cpu_scratch *s)
+{
+	int i, k;
+
+	for (i = 0; i < n; i++)
+		for (k = 0; k < LINNOS_SIMD_PAIRS_0; k++)
+			s->x[i][0][k] = input_pair(feat_vecs + i*LEN_INPUT, k);
+}
+
+/*
+ * Splits the activations of n inputs into limbs, bits is the or of all of
+ * them (they are relu outputs, so never negative). Returns the number of
+ * limbs, 0 if they do not fit.
+ */
+static inline int act_to_limbs(const s64 (*act)[LEN_LAYER_0], int n, u64 bits, struct linnos_cpu_scratch *s)
+{
+	const u64 mask = (1 << LINNOS_SIMD_LIMB_BITS) - 1;
+	int limbs, i, l, k, shift;
+
+	for (limbs = 1; limbs <= LINNOS_SIMD_MAX_LIMBS; limbs++)
+		if (!(bits >> (limbs * LINNOS_SIMD_LIMB_BITS)))
+			break;
+	if (limbs > LINNOS_SIMD_MAX_LIMBS)
+		return 0;
+
+	for (i = 0; i < n; i++)
+		for (l = 0; l < limbs; l++) {
+			shift = l * LINNOS_SIMD_LIMB_BITS;
+			for (k = 0; k < LINNOS_SIMD_PAIRS_M; k++)
+				s->x[i][l][k] = ((act[i][2*k] >> shift) & mask) |
+					(((act[i][2*k+1] >> shift) & mask) << 16);
+		}
+	return limbs;
+}
+
+//bias plus the limb sums of one block, relu; returns the or of the outputs
+static inline u64 limbs_to_act(const s32 (*sums)[LINNOS_SIMD_COLS], int limbs, const s64 *bias, s64 *out)
+{
+	u64 bits = 0;
+	s64 v;
+	int c, l;
+
+	for (c = 0; c < LINNOS_SIMD_COLS; c++) {
+		v = bias[c];
+		for (l = 0; l < limbs; l++)
+			v += (s64)sums[l][c] * (1ll << (l * LINNOS_SIMD_LIMB_BITS));
+		out[c] = v < 0 ? 0 : v;
+		bits |= out[c];
+	}
+	return bits;
+}
+
+static TARGET_AVX2 inline v8si madd_avx2(v16hi a, const v16hi *b)
+{
+	v8si r;
+	asm("vpmaddwd %2, %1, %0" : "=x" (r) : "x" (a), "m" (*b));
+	return r;
+}
+
+//signed 64 bit products of the low 32 bits of each lane
+static TARGET_AVX2 inline v4di muldq_avx2(v4di a, v4di b)
+{
+	v4di r;
+	asm("vpmuldq %2, %1, %0" : "=x" (r) : "x" (a), "x" (b));
+	return r;
+}
+
+//sums of one block of 16 neurons for one input, limbs is a constant
+static TARGET_AVX2 __always_inline void block_avx2(const v16hi *w, int pairs, const s32 (*x)[LINNOS_SIMD_PAIRS_M],
+		const int limbs, s32 (*sums)[LINNOS_SIMD_COLS])
+{
+	v8si acc[LINNOS_SIMD_MAX_LIMBS][2], xb;
+	int k, l;
+
+	for (l = 0; l < limbs; l++)
+		acc[l][0] = acc[l][1] = (v8si){};
+	for (k = 0; k < pairs; k++, w += 2)
+		for (l = 0; l < limbs; l++) {
+			xb = (v8si){} + x[l][k];
+			acc[l][0] += madd_avx2((v16hi)xb, &w[0]);
+			acc[l][1] += madd_avx2((v16hi)xb, &w[1]);
+		}
+	for (l = 0; l < limbs; l++) {
+		*(v8si *)&sums[l][0] = acc[l][0];
+		*(v8si *)&sums[l][8] = acc[l][1];
+	}
+}
+
+static TARGET_AVX2 u64 layer_avx2(const s16 *w, const s64 *bias, int pairs, int limbs, int n,
+		struct linnos_cpu_scratch *s, s64 (*out)[LEN_LAYER_0])
+{
+	s32 sums[LINNOS_SIMD_MAX_LIMBS][LINNOS_SIMD_COLS] __aligned(32);
+	u64 bits = 0;
+	int b, i;
+
+	for (b = 0; b < LINNOS_SIMD_BLOCKS; b++, w += pairs * LINNOS_SIMD_COLS * 2) {
+		for (i = 0; i < n; i++) {
+			if (limbs == 1)
+				block_avx2((const v16hi *)w, pairs, s->x[i], 1, sums);
+			else if (limbs == 2)
+				block_avx2((const v16hi *)w, pairs, s->x[i], 2, sums);
+			else
+				block_avx2((const v16hi *)w, pairs, s->x[i], 3, sums);
+			bits |= limbs_to_act(sums, limbs, &bias[b*LINNOS_SIMD_COLS], &out[i][b*LINNOS_SIMD_COLS]);
+		}
+	}
+	return bits;
+}
+
+static TARGET_AVX2 void final_avx2(const struct linnos_cpu_packed *p, const s64 (*act)[LEN_LAYER_0], int n,
+		u64 bits, s64 *final_res)
+{
+	v4di acc, a, w;
+	int i, o, j;
+
+	for (i = 0; i < n; i++)
+		for (o = 0; o < LEN_LAYER_1; o++) {
+			acc = (v4di){};
+			for (j = 0; j < LEN_LAYER_0; j += 4) {
+				a = *(const v4di *)&act[i][j];
+				w = *(const v4di *)&p->w1[o][j];
+				//weights fit in 32 bits, activations usually do too
+				acc += bits >> 31 ? a * w : muldq_avx2(a, w);
+			}
+			final_res[2*i + o] = acc[0] + acc[1] + acc[2] + acc[3] + p->b1[o];
+		}
+}
+
+TARGET_AVX2 bool linnos_cpu_avx2(const struct linnos_cpu_packed *p, int n_mid, const char *feat_vecs, int n,
+		struct linnos_cpu_scratch *s, s64 *final_res)
+{
+	s64 (*in)[LEN_LAYER_0] = s->act[0], (*out)[LEN_LAYER_0] = s->act[1], (*t)[LEN_LAYER_0];
+	u64 bits;
+	int m, limbs;
+
+	inputs_to_pairs(feat_vecs, n, s);
+	bits = layer_avx2(&p->w0[0][0][0][0], p->b0, LINNOS_SIMD_PAIRS_0, 1, n, s, in);
+	for (m = 0; m < n_mid; m++) {
+		limbs = act_to_limbs((const s64 (*)[LEN_LAYER_0])in, n, bits, s);
+		if (!limbs)
+			return false;
+		bits = layer_avx2(&p->wm[m][0][0][0][0], p->bm[m], LINNOS_SIMD_PAIRS_M, limbs, n, s, out);
+		t = in;
+		in = out;
+		out = t;
+	}
+	final_avx2(p, (const s64 (*)[LEN_LAYER_0])in, n, bits, final_res);
+	return true;
+}
+
+static TARGET_AVX512 inline v16si madd_avx512(v32hi a, const v32hi *b)
+{
+	v16si r;
+	asm("vpmaddwd %2, %1, %0" : "=v" (r) : "v" (a), "m" (*b));
+	return r;
+}
+
+static TARGET_AVX512 inline v8di muldq_avx512(v8di a, v8di b)
+{
+	v8di r;
+	asm("vpmuldq %2, %1, %0" : "=v" (r) : "v" (a), "v" (b));
+	return r;
+}
+
+static TARGET_AVX512 __always_inline void block_avx512(const v32hi *w, int pairs, const s32 (*x)[LINNOS_SIMD_PAIRS_M],
+		const int limbs, s32 (*sums)[LINNOS_SIMD_COLS])
+{
+	v16si acc[LINNOS_SIMD_MAX_LIMBS], xb;
+	int k, l;
+
+	for (l = 0; l < limbs; l++)
+		acc[l] = (v16si){};
+	for (k = 0; k < pairs; k++, w++)
+		for (l = 0; l < limbs; l++) {
+			xb = (v16si){} + x[l][k];
+			acc[l] += madd_avx512((v32hi)xb, w);
+		}
+	for (l = 0; l < limbs; l++)
+		*(v16si *)sums[l] = acc[l];
+}
+
+static TARGET_AVX512 u64 layer_avx512(const s16 *w, const s64 *bias, int pairs, int limbs, int n,
+		struct linnos_cpu_scratch *s, s64 (*out)[LEN_LAYER_0])
+{
+	s32 sums[LINNOS_SIMD_MAX_LIMBS][LINNOS_SIMD_COLS] __aligned(64);
+	u64 bits = 0;
+	int b, i;
+
+	for (b = 0; b < LINNOS_SIMD_BLOCKS; b++, w += pairs * LINNOS_SIMD_COLS * 2) {
+		for (i = 0; i < n; i++) {
+			if (limbs == 1)
+				block_avx512((const v32hi *)w, pairs, s->x[i], 1, sums);
+			else if (limbs == 2)
+				block_avx512((const v32hi *)w, pairs, s->x[i], 2, sums);
+			else
+				block_avx512((const v32hi *)w, pairs, s->x[i], 3, sums);
+			bits |= limbs_to_act(sums, limbs, &bias[b*LINNOS_SIMD_COLS], &out[i][b*LINNOS_SIMD_COLS]);
+		}
+	}
+	return bits;
+}
+
+static TARGET_AVX512 void final_avx512(const struct linnos_cpu_packed *p, const s64 (*act)[LEN_LAYER_0], int n,
+		u64 bits, s64 *final_res)
+{
+	v8di acc, a, w;
+	int i, o, j;
+
+	for (i = 0; i < n; i++)
+		for (o = 0; o < LEN_LAYER_1; o++) {
+			acc = (v8di){};
+			for (j = 0; j < LEN_LAYER_0; j += 8) {
+				a = *(const v8di *)&act[i][j];
+				w = *(const v8di *)&p->w1[o][j];
+				acc += bits >> 31 ? a * w : muldq_avx512(a, w);
+			}
+			final_res[2*i + o] = acc[0] + acc[1] + acc[2] + acc[3] + acc[4] + acc[5] + acc[6] + acc[7] +
+				p->b1[o];
+		}
+}
+
+TARGET_AVX512 bool linnos_cpu_avx512(const struct linnos_cpu_packed *p, int n_mid, const char *feat_vecs, int n,
+		struct linnos_cpu_scratch *s, s64 *final_res)
+{
+	s64 (*in)[LEN_LAYER_0] = s->act[0], (*out)[LEN_LAYER_0] = s->act[1], (*t)[LEN_LAYER_0];
+	u64 bits;
+	int m, limbs;
+
+	inputs_to_pairs(feat_vecs, n, s);
+	bits = layer_avx512(&p->w0[0][0][0][0], p->b0, LINNOS_SIMD_PAIRS_0, 1, n, s, in);
+	for (m = 0; m < n_mid; m++) {
+		limbs = act_to_limbs((const s64 (*)[LEN_LAYER_0])in, n, bits, s);
+		if (!limbs)
+			return false;
+		bits = layer_avx512(&p->wm[m][0][0][0][0], p->bm[m], LINNOS_SIMD_PAIRS_M, limbs, n, s, out);
+		t = in;
+		in = out;
+		out = t;
+	}
+	final_avx512(p, (const s64 (*)[LEN_LAYER_0])in, n, bits, final_res);
+	return true;
+}
@@ -0,0 +1,121 @@
+/*
+ * Part of LAKE: Towards a Machine Learning-Assisted Kernel with LAKE
+ *
+ * Original work:
+ *   Copyright (C) 2022–2024 Henrique Fingler
+ *   Copyright (C) 2022–2024 Isha Tarte
+ *
+ * Modifications and adaptations for LAIKA:
+ *   Copyright (C) 2024-2025 Haoming Zhuo
+ *
+ * This file is adapted from the original LAKE kernel module.
+ * Major changes include:
+ *   - Integration with LAIKA framework
+ *   - Hybrid execution support
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef __LINNOS_PREDICTORS_SIMD_H
+#define __LINNOS_PREDICTORS_SIMD_H
+
+#ifdef __KERNEL__
+#include <linux/types.h>
+#include <linux/cache.h>
+#else
+#include <stdint.h>
+#include <stdbool.h>
+typedef int16_t s16;
+typedef uint16_t u16;
+typedef int32_t s32;
+typedef uint32_t u32;
+typedef int64_t s64;
+typedef uint64_t u64;
+#define __aligned(x) __attribute__((aligned(x)))
+#endif
+#include "predictors.h"
+
+/*
+ * Vectorized cpu models. The weights are repacked once into 16 bit
+ * integers laid out for the vector units (cpu_prediction_pack), the
+ * kernels below run between kernel_fpu_begin/end and give the same
+ * results as the scalar models.
+ *
+ * Every layer but the last multiplies 16 bit activations and weights into
+ * 32 bit sums two inputs at a time (vpmaddwd), 16 neurons per block:
+ * w[block][pair][neuron][2] holds the weights of inputs 2*pair and 2*pair+1,
+ * an odd last input is padded with a zero weight. A block is a few KB and
+ * is used by every input of a chunk before the next one is read.
+ * Activations of the 256x256 layers are wider than 16 bits, they are split
+ * into 15 bit limbs that each get their own 32 bit sum; the limbs are
+ * shifted back together in 64 bits. Packing refuses weights for which one
+ * of those sums could overflow. The last layer multiplies into 64 bits.
+ *
+ * All 256 wide layers share the layout, so LEN_LAYER_M_1 and LEN_LAYER_M_2
+ * have to be LEN_LAYER_0.
+ *
+ * The packing and the kernels also build in userspace, test/test_simd.c
+ * compares them with the scalar models.
+ */
+#define LINNOS_SIMD_COLS 16
+#define LINNOS_SIMD_BLOCKS (LEN_LAYER_0 / LINNOS_SIMD_COLS)
+#define LINNOS_SIMD_PAIRS_0 ((LEN_INPUT + 1) / 2)
+#define LINNOS_SIMD_PAIRS_M (LEN_LAYER_0 / 2)
+#define LINNOS_SIMD_LIMB_BITS 15
+#define LINNOS_SIMD_MAX_LIMBS 3
+//LEN_LAYER_0 limbs times this stay below 2^31
+#define LINNOS_SIMD_MAX_W_M 255
+//inputs per kernel call
+#define LINNOS_SIMD_CHUNK 4
+
+enum linnos_simd_level {
+	LINNOS_SIMD_NONE,
+	LINNOS_SIMD_AVX2,
+	LINNOS_SIMD_AVX512,
+};
+
+struct linnos_cpu_packed {
+	s16 w0[LINNOS_SIMD_BLOCKS][LINNOS_SIMD_PAIRS_0][LINNOS_SIMD_COLS][2];
+	s16 wm[2][LINNOS_SIMD_BLOCKS][LINNOS_SIMD_PAIRS_M][LINNOS_SIMD_COLS][2];
+	s64 b0[LEN_LAYER_0];
+	s64 bm[2][LEN_LAYER_0];
+	s64 w1[LEN_LAYER_1][LEN_LAYER_0];
+	s64 b1[LEN_LAYER_1];
+	int n_mid;	//256x256 layers packed, the model sizes this set can run
+	long *src;	//weights[0] of the set this was packed from
+} __aligned(64);
+
+//per cpu, only touched between kernel_fpu_begin/end
+struct linnos_cpu_scratch {
+	s64 act[2][LINNOS_SIMD_CHUNK][LEN_LAYER_0];
+	s32 x[LINNOS_SIMD_CHUNK][LINNOS_SIMD_MAX_LIMBS][LINNOS_SIMD_PAIRS_M];
+} __aligned(64);
+
+/*
+ * Lays weights[0..3] and the n_mid 256x256 layers from weights[4] out in p,
+ * the caller checked they fit. Leaves p->src alone.
+ */
+void linnos_cpu_pack_weights(struct linnos_cpu_packed *p, long **weights, int n_mid);
+
+/*
+ * Runs n <= LINNOS_SIMD_CHUNK inputs of LEN_INPUT chars through layer 0,
+ * n_mid 256x256 layers and the last layer, final_res[2*i] and [2*i+1] get
+ * the outputs of input i. False if an activation did not fit in the limbs,
+ * the inputs have to go to the scalar model then.
+ */
+bool linnos_cpu_avx2(const struct linnos_cpu_packed *p, int n_mid, const char *feat_vecs, int n,
+		struct linnos_cpu_scratch *s, s64 *final_res);
+bool linnos_cpu_avx512(const struct linnos_cpu_packed *p, int n_mid, const char *feat_vecs, int n,
+		struct linnos_cpu_scratch *s, s64 *final_res);
+
+#endif
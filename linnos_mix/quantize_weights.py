@@ -0,0 +1,220 @@
+#!/usr/bin/env python3
+"""
+Converts the long LinnOS weights of test_weights.c into the int8 model of
+predictors_q8.h and writes it to test_weights_q8.c.
+
+Weights get one scale per layer: a layer whose weights fit in int8 keeps
+them as they are, wider ones are divided by max|w| / 127. Activations are
+uint8 with one scale per layer, calibrated by running the long model on
+random feature vectors: the largest activation seen (or a percentile of
+them, -p) maps to 255. Biases are moved to the scale of their layer's
+int32 sums. Every layer but the last turns its int32 sums into the next
+activations with a fixed point multiply, the last one compares its two
+sums like the long model does.
+
+Afterwards it replays other random feature vectors through both models
+and reports how often the quantized model disagrees with the long one.
+
+    python3 quantize_weights.py [-n calibration vectors] [-t test vectors]
+                               [-p percentile] [--inputs digits|bytes]
+                               [-i test_weights.c] [-o test_weights_q8.c]
+"""
+import argparse
+import random
+import re
+import sys
+from operator import mul
+
+LEN_INPUT = 31
+LEN_LAYER_0 = 256
+LEN_LAYER_1 = 2
+# keep in sync with predictors_q8.h
+Q8_SHIFT = 24
+Q8_MAX = 255
+
+ARRAYS = ("weight_0_T", "weight_1_T", "bias_0", "bias_1",
+          "weight_M_1_T", "bias_M_1", "weight_M_2_T", "bias_M_2")
+
+
+def parse_weights(path):
+    with open(path) as f:
+        src = f.read()
+    weights = {}
+    for name in ARRAYS:
+        m = re.search(r"long\s+%s\s*\[[^\]]*\]\s*=\s*\{([^}]*)\}" % name, src)
+        if not m:
+            sys.exit("%s: no long %s[]" % (path, name))
+        weights[name] = [int(v) for v in m.group(1).replace("\n", " ").split(",") if v.strip()]
+    return weights
+
+
+def rows(values, width):
+    return [values[i:i + width] for i in range(0, len(values), width)]
+
+
+def flat(r):
+    return [v for row in r for v in row]
+
+
+def random_vector(rng, inputs):
+    # feature vectors of LinnOS are decimal digits, check_correctness in
+    # main.c feeds random bytes
+    if inputs == "digits":
+        return [rng.randrange(10) for _ in range(LEN_INPUT)]
+    return [rng.randrange(-128, 128) for _ in range(LEN_INPUT)]
+
+
+def dense_relu(w_rows, bias, x):
+    return [max(0, sum(map(mul, r, x)) + b) for r, b in zip(w_rows, bias)]
+
+
+def long_model(w, x):
+    """Activations of the three hidden layers and the +0/+1/+2 results."""
+    acts = [dense_relu(w["weight_0_T"], w["bias_0"], x)]
+    acts.append(dense_relu(w["weight_M_1_T"], w["bias_M_1"], acts[0]))
+    acts.append(dense_relu(w["weight_M_2_T"], w["bias_M_2"], acts[1]))
+    res = []
+    for a in acts:
+        out = [sum(map(mul, r, a)) + b for r, b in zip(w["weight_1_T"], w["bias_1"])]
+        res.append(out[0] < out[1])
+    return acts, res
+
+
+def weight_scale(r):
+    m = max(abs(v) for row in r for v in row)
+    return 1.0 if m <= 127 else m / 127.0
+
+
+def quantize(values, scale, lo, hi, what):
+    q = [int(round(v / scale)) for v in values]
+    if min(q) < lo or max(q) > hi:
+        sys.exit("%s does not fit in [%d, %d] at scale %g" % (what, lo, hi, scale))
+    return q
+
+
+def requant(acc, mult):
+    if acc <= 0:
+        return 0
+    return min(Q8_MAX, (acc * mult + (1 << (Q8_SHIFT - 1))) >> Q8_SHIFT)
+
+
+def q8_model(q, x):
+    acts = []
+    a = x
+    for l, (wk, bk) in enumerate((("weight_0_T", "bias_0"), ("weight_M_1_T", "bias_M_1"),
+                                  ("weight_M_2_T", "bias_M_2"))):
+        a = [requant(sum(map(mul, r, a)) + b, q["requant_mul"][l]) for r, b in zip(q[wk], q[bk])]
+        acts.append(a)
+    res = []
+    for l, a in enumerate(acts):
+        out = [sum(map(mul, r, a)) + b for r, b in zip(q["weight_1_T"], q["bias_1"][l])]
+        res.append(out[0] < out[1])
+    return res
+
+
+def calibrate(w, args):
+    rng = random.Random(args.seed)
+    seen = [[], [], []]
+    for _ in range(args.calib):
+        acts, _ = long_model(w, random_vector(rng, args.inputs))
+        for l in range(3):
+            seen[l].append(max(acts[l]))
+    scales = []
+    for l in range(3):
+        s = sorted(seen[l])
+        top = s[min(len(s) - 1, int(len(s) * args.percentile / 100.0))]
+        scales.append(max(top, 1) / float(Q8_MAX))
+    return scales
+
+
+def convert(w, act_scales):
+    s_w = {k: weight_scale(w[k]) for k in ("weight_0_T", "weight_M_1_T", "weight_M_2_T", "weight_1_T")}
+    q = {k: rows(quantize(flat(w[k]), s_w[k], -127, 127, k), len(w[k][0])) for k in s_w}
+    # scale of the int32 sums of each layer: input scale times weight scale
+    acc = [s_w["weight_0_T"], act_scales[0] * s_w["weight_M_1_T"], act_scales[1] * s_w["weight_M_2_T"]]
+    q["bias_0"] = quantize(w["bias_0"], acc[0], -2**31, 2**31 - 1, "bias_0")
+    q["bias_M_1"] = quantize(w["bias_M_1"], acc[1], -2**31, 2**31 - 1, "bias_M_1")
+    q["bias_M_2"] = quantize(w["bias_M_2"], acc[2], -2**31, 2**31 - 1, "bias_M_2")
+    q["bias_1"] = [quantize(w["bias_1"], act_scales[l] * s_w["weight_1_T"], -2**31, 2**31 - 1, "bias_1")
+                   for l in range(3)]
+    q["requant_mul"] = []
+    for l in range(3):
+        m = int(round(acc[l] / act_scales[l] * (1 << Q8_SHIFT)))
+        if not 0 < m < 2**31:
+            sys.exit("layer %d: requantization multiplier %d out of range" % (l, m))
+        q["requant_mul"].append(m)
+    return q, s_w, acc
+
+
+def report(w, q, args):
+    for inputs in ("digits", "bytes"):
+        rng = random.Random(args.seed + 1)
+        disagree = [0, 0, 0]
+        trues = [0, 0, 0]
+        for _ in range(args.tests):
+            x = random_vector(rng, inputs)
+            _, ref = long_model(w, x)
+            res = q8_model(q, x)
+            for l in range(3):
+                disagree[l] += ref[l] != res[l]
+                trues[l] += ref[l]
+        for l in range(3):
+            print("%-6s linnos+%d: %d/%d disagree (%.2f%%), long model says true %d times"
+                  % (inputs, l, disagree[l], args.tests, 100.0 * disagree[l] / args.tests, trues[l]))
+
+
+def c_array(name, values, per_line=32):
+    lines = [", ".join(str(v) for v in values[i:i + per_line]) for i in range(0, len(values), per_line)]
+    return "\t.%s = {\n\t\t%s\n\t},\n" % (name, ",\n\t\t".join(lines))
+
+
+def write_c(path, q, args):
+    with open(path, "w") as f:
+        f.write("//generated by quantize_weights.py from test_weights.c, do not edit\n")
+        f.write("//calibrated on %d %s vectors, percentile %g\n" % (args.calib, args.inputs, args.percentile))
+        f.write('#include "predictors_q8.h"\n\n')
+        f.write("struct linnos_q8 test_weights_q8 = {\n")
+        for k in ("weight_0_T", "weight_1_T", "weight_M_1_T", "weight_M_2_T"):
+            f.write(c_array(k, flat(q[k])))
+        for k in ("bias_0", "bias_M_1", "bias_M_2"):
+            f.write(c_array(k, q[k]))
+        f.write("\t.bias_1 = {\n%s\t},\n" % "".join("\t\t{ %d, %d },\n" % tuple(b) for b in q["bias_1"]))
+        f.write("\t.requant_mul = { %s },\n" % ", ".join(str(m) for m in q["requant_mul"]))
+        f.write("};\n")
+
+
+def main():
+    p = argparse.ArgumentParser(description="Quantize the LinnOS weights to int8")
+    p.add_argument("-i", "--input", default="test_weights.c")
+    p.add_argument("-o", "--output", default="test_weights_q8.c")
+    p.add_argument("-n", "--calib", type=int, default=2000, help="calibration vectors")
+    p.add_argument("-t", "--tests", type=int, default=2000, help="test vectors for the report")
+    p.add_argument("-p", "--percentile", type=float, default=100.0,
+                   help="percentile of the per vector activation maxima that maps to 255")
+    p.add_argument("--inputs", choices=("digits", "bytes"), default="digits")
+    p.add_argument("--seed", type=int, default=1)
+    args = p.parse_args()
+
+    raw = parse_weights(args.input)
+    w = dict(raw)
+    w["weight_0_T"] = rows(raw["weight_0_T"], LEN_INPUT)
+    for k in ("weight_M_1_T", "weight_M_2_T", "weight_1_T"):
+        w[k] = rows(raw[k], LEN_LAYER_0)
+
+    act_scales = calibrate(w, args)
+    q, s_w, acc = convert(w, act_scales)
+    for l, name in enumerate(("layer 0", "layer M_1", "layer M_2")):
+        print("%-9s activation scale %-12.6g sum scale %-12.6g requant %d >> %d"
+              % (name, act_scales[l], acc[l], q["requant_mul"][l], Q8_SHIFT))
+    print("weight scales: " + ", ".join("%s %g" % kv for kv in sorted(s_w.items())))
+    long_bytes = 8 * sum(len(raw[k]) for k in ARRAYS)
+    q8_bytes = sum(len(raw[k]) for k in ("weight_0_T", "weight_1_T", "weight_M_1_T", "weight_M_2_T")) + \
+        4 * (3 * LEN_LAYER_0 + 3 * LEN_LAYER_1 + 3)
+    print("footprint: %d bytes long, %d bytes int8 (%.1fx)" % (long_bytes, q8_bytes, long_bytes / float(q8_bytes)))
+
+    report(w, q, args)
+    write_c(args.output, q, args)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,307 @@
+/*
+ * Stress harness for the lock-free LinnOS batch formation (linnos_batch.h).
+ *
+ * Threads play concurrent IOs of one device and go through the steps of
+ * gpu_batch_entry (predictors.c): take a ticket in the open slot or move
+ * on to the next one, write their input, close the batch when it is full
+ * or its window ran out, or wait for the closer. The wait queue is a
+ * condition variable, the "gpu" is the closer computing f(input) for every
+ * member, optionally after a delay. With -l every n-th batch times out
+ * instead: its members predict on their own and a reply thread plays the
+ * late gpu reply, writing the batch's outputs a while later.
+ *
+ * Checks that every batch of every slot is closed exactly once and in
+ * generation order, that each member reads the result of its own input
+ * from a slot nobody reopened yet, that a late reply finds its slot still
+ * held, and that members add up to the closed batch sizes. Reports how the
+ * requests were served.
+ *
+ *   ./test_batch [-t threads] [-n requests per thread] [-b max batch size]
+ *                [-w window us] [-g gpu us] [-l every n-th batch is late]
+ */
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include "linnos_batch.h"
+
+#define SLOTS 16      // MAX_DEV_BATCHES
+#define MAX_BATCH 256
+
+static struct linnos_batch batches[SLOTS];
+static atomic_t cur_batch;
+static uint64_t inputs[SLOTS][MAX_BATCH];
+static uint64_t outputs[SLOTS][MAX_BATCH];
+static uint32_t closed_gen[SLOTS];
+
+static pthread_mutex_t wq_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t wq;
+
+static uint32_t max_batch = 32, n_reqs = 100000, late_every = 0;
+static uint64_t window_ns = 50 * 1000, gpu_ns = 0;
+
+// batches whose gpu reply is late, for the reply thread
+static struct late { struct linnos_batch *b; uint32_t slot, gen, size; } late_q[SLOTS];
+static uint32_t late_head, late_tail;
+static int late_stop;
+static pthread_mutex_t late_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t late_cv = PTHREAD_COND_INITIALIZER;
+
+static uint64_t errors, n_members, n_sizes, n_closes, n_full, n_timeouts, n_late, n_busy, n_gpu_late;
+
+#define CHECK(cond, ...) do {                          \
+        if (!(cond)) {                                 \
+            printf(__VA_ARGS__);                       \
+            printf("\n");                              \
+            __atomic_add_fetch(&errors, 1, __ATOMIC_RELAXED); \
+        }                                              \
+    } while (0)
+
+#define COUNT(c, n) __atomic_add_fetch(&(c), n, __ATOMIC_RELAXED)
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static uint64_t f(uint64_t x)
+{
+    return x * 0x9e3779b97f4a7c15ull + 1;
+}
+
+// wait_event_timeout on the device's wait queue
+static int wait_done(struct linnos_batch *b, uint32_t gen, uint64_t timeout_ns)
+{
+    uint64_t t = now_ns() + timeout_ns;
+    struct timespec ts = { t / 1000000000ull, t % 1000000000ull };
+    int ok;
+
+    pthread_mutex_lock(&wq_lock);
+    while (!(ok = linnos_batch_done(b, gen)) &&
+            pthread_cond_timedwait(&wq, &wq_lock, &ts) == 0)
+        ;
+    ok = linnos_batch_done(b, gen);
+    pthread_mutex_unlock(&wq_lock);
+    return ok;
+}
+
+static void wake_all(void)
+{
+    pthread_mutex_lock(&wq_lock);
+    pthread_cond_broadcast(&wq);
+    pthread_mutex_unlock(&wq_lock);
+}
+
+static void run_batch(struct linnos_batch *b, uint32_t slot, uint32_t gen, uint32_t size)
+{
+    uint64_t t, closes;
+    uint32_t i;
+
+    CHECK(size >= 1 && size <= max_batch, "slot %u gen %u: size %u", slot, gen, size);
+    CHECK(gen == closed_gen[slot] + 1, "slot %u: closed gen %u after gen %u", slot, gen, closed_gen[slot]);
+    closed_gen[slot] = gen;
+    closes = COUNT(n_closes, 1);
+    COUNT(n_sizes, size);
+    if (size == max_batch)
+        COUNT(n_full, 1);
+
+    linnos_batch_wait_ready(b, size);
+    for (i = 0; i < size; i++)
+        outputs[slot][i] = f(inputs[slot][i]);
+    t = now_ns() + gpu_ns;
+    while (gpu_ns && now_ns() < t)
+        cpu_relax();
+    // the gpu timed out: the reply thread gets the slot until the reply is in
+    if (late_every && closes % late_every == 0) {
+        COUNT(n_gpu_late, 1);
+        linnos_batch_hold(b);
+        pthread_mutex_lock(&late_lock);
+        late_q[late_tail++ % SLOTS] = (struct late) { b, slot, gen, size };
+        pthread_cond_signal(&late_cv);
+        pthread_mutex_unlock(&late_lock);
+        linnos_batch_publish(b, gen, true);
+        wake_all();
+        return;
+    }
+    linnos_batch_publish(b, gen, false);
+    wake_all();
+}
+
+// plays the late replies of lake_future_then in gpu_batch_entry
+static void *replies(void *arg)
+{
+    struct late l;
+    uint64_t t;
+    uint32_t i;
+
+    pthread_mutex_lock(&late_lock);
+    while (!late_stop || late_head != late_tail) {
+        if (late_head == late_tail) {
+            pthread_cond_wait(&late_cv, &late_lock);
+            continue;
+        }
+        l = late_q[late_head++ % SLOTS];
+        pthread_mutex_unlock(&late_lock);
+
+        t = now_ns() + window_ns;
+        while (now_ns() < t)
+            cpu_relax();
+        CHECK(linnos_batch_gen(atomic64_read(&l.b->state)) == l.gen &&
+                (atomic64_read(&l.b->state) & LINNOS_BATCH_CLOSED),
+                "slot %u gen %u: reopened before its late reply", l.slot, l.gen);
+        // the late DtoH
+        for (i = 0; i < l.size; i++)
+            outputs[l.slot][i] = 0;
+        linnos_batch_exit(l.b, l.gen);
+
+        pthread_mutex_lock(&late_lock);
+    }
+    pthread_mutex_unlock(&late_lock);
+    return NULL;
+}
+
+// one IO, the flow of gpu_batch_entry
+static void request(uint64_t input)
+{
+    struct linnos_batch *b = NULL;
+    uint32_t i, seq = 0, slot = 0, gen = 0, size;
+    uint64_t arrival = now_ns();
+    int id = -1, closer = 0, done;
+
+    for (i = 0; i < SLOTS; i++) {
+        seq = atomic_read(&cur_batch);
+        slot = seq % SLOTS;
+        b = &batches[slot];
+        id = linnos_batch_join(b, max_batch, &gen);
+        if (id >= 0)
+            break;
+        __atomic_compare_exchange_n(&cur_batch.counter, (int *)&seq, seq + 1, 0,
+                __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+    }
+    if (id < 0) {
+        COUNT(n_busy, 1);
+        return;
+    }
+    COUNT(n_members, 1);
+    if (id == 0)
+        linnos_batch_start(b, arrival);
+    inputs[slot][id] = input;
+    linnos_batch_ready(b);
+
+    if ((id + 1 >= (int)max_batch || (id && linnos_batch_expired(b, arrival, window_ns))) &&
+            linnos_batch_close(b, gen, max_batch, &size))
+        closer = 1;
+    else if (id == 0 && !wait_done(b, gen, window_ns) && linnos_batch_close(b, gen, max_batch, &size)) {
+        COUNT(n_timeouts, 1);
+        closer = 1;
+    }
+
+    if (closer) {
+        __atomic_compare_exchange_n(&cur_batch.counter, (int *)&seq, seq + 1, 0,
+                __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+        run_batch(b, slot, gen, size);
+        done = 1;
+    } else {
+        done = wait_done(b, gen, window_ns * 5 + gpu_ns * 5);
+    }
+
+    if (done && !b->use_cpu) {
+        CHECK(outputs[slot][id] == f(input), "slot %u gen %u id %d: read %lx, expected %lx", slot, gen,
+                id, (unsigned long)outputs[slot][id], (unsigned long)f(input));
+        CHECK(linnos_batch_gen(atomic64_read(&b->state)) == gen, "slot %u gen %u: reopened under member %d",
+                slot, gen, id);
+    } else if (!done) {
+        COUNT(n_late, 1);
+    }
+    linnos_batch_exit(b, gen);
+}
+
+static void *worker(void *arg)
+{
+    uint64_t t = (uintptr_t)arg;
+    uint32_t i;
+
+    for (i = 0; i < n_reqs; i++) {
+        request(t << 32 | i);
+        if (!(i & 7))
+            sched_yield();
+    }
+    return NULL;
+}
+
+int main(int argc, char **argv)
+{
+    pthread_condattr_t attr;
+    pthread_t *tids, reply_tid;
+    uint64_t start, wall;
+    uint32_t i, n_threads = 8;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "t:n:b:w:g:l:")) != -1) {
+        switch (opt) {
+        case 't': n_threads = strtoul(optarg, NULL, 0); break;
+        case 'n': n_reqs = strtoul(optarg, NULL, 0); break;
+        case 'b': max_batch = strtoul(optarg, NULL, 0); break;
+        case 'w': window_ns = strtoull(optarg, NULL, 0) * 1000; break;
+        case 'g': gpu_ns = strtoull(optarg, NULL, 0) * 1000; break;
+        case 'l': late_every = strtoul(optarg, NULL, 0); break;
+        default:
+            fprintf(stderr, "usage: %s [-t threads] [-n requests per thread] [-b max batch size] "
+                    "[-w window us] [-g gpu us] [-l every n-th batch is late]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (!n_threads || !n_reqs || !max_batch || max_batch > MAX_BATCH || !window_ns) {
+        fprintf(stderr, "bad arguments\n");
+        return 1;
+    }
+
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&wq, &attr);
+    atomic_set(&cur_batch, 0);
+    for (i = 0; i < SLOTS; i++) {
+        linnos_batch_init(&batches[i]);
+        closed_gen[i] = 0;
+    }
+
+    tids = calloc(n_threads, sizeof(*tids));
+    pthread_create(&reply_tid, NULL, replies, NULL);
+    start = now_ns();
+    for (i = 0; i < n_threads; i++)
+        pthread_create(&tids[i], NULL, worker, (void *)(uintptr_t)i);
+    for (i = 0; i < n_threads; i++)
+        pthread_join(tids[i], NULL);
+    wall = now_ns() - start;
+    pthread_mutex_lock(&late_lock);
+    late_stop = 1;
+    pthread_cond_signal(&late_cv);
+    pthread_mutex_unlock(&late_lock);
+    pthread_join(reply_tid, NULL);
+    free(tids);
+
+    CHECK(n_members + n_busy == (uint64_t)n_threads * n_reqs, "%lu members and %lu without a slot of %lu requests",
+            (unsigned long)n_members, (unsigned long)n_busy, (unsigned long)n_threads * n_reqs);
+    CHECK(n_sizes == n_members, "closed batches hold %lu requests, %lu joined", (unsigned long)n_sizes,
+            (unsigned long)n_members);
+    for (i = 0; i < SLOTS; i++)
+        CHECK(atomic_read(&batches[i].exited) == 0 && !(atomic64_read(&batches[i].state) & LINNOS_BATCH_CLOSED),
+                "slot %u not reopened after its last batch", i);
+
+    printf("%u threads x %u requests, batch <= %u, window %lu us, gpu %lu us: %.0f requests/s\n", n_threads,
+            n_reqs, max_batch, (unsigned long)(window_ns / 1000), (unsigned long)(gpu_ns / 1000),
+            1e9 * n_threads * n_reqs / wall);
+    printf("batches %lu (full %lu, closed by first on timeout %lu), avg size %.2f, members timed out %lu, "
+            "no free slot %lu, late gpu replies %lu\n", (unsigned long)n_closes, (unsigned long)n_full,
+            (unsigned long)n_timeouts, n_closes ? (double)n_sizes / n_closes : 0, (unsigned long)n_late,
+            (unsigned long)n_busy, (unsigned long)n_gpu_late);
+    printf("%s (%lu errors)\n", errors ? "FAILED" : "PASSED", (unsigned long)errors);
+    return errors != 0;
+}
@@ -0,0 +1,151 @@
+/*
+ * Checks the vectorized cpu models (predictors_simd.c) against the scalar
+ * ones of predictors.c on the test weights.
+ *
+ * Packs test_weights.c like cpu_prediction_pack does and runs random
+ * feature vectors through the AVX2 and AVX-512 kernels the cpu has, for
+ * the +0, +1 and +2 models, in chunks of 1 to LINNOS_SIMD_CHUNK inputs per
+ * call: one like cpu_prediction_model, more like cpu_prediction_batch.
+ * Every input of a chunk is checked on its own. Half the vectors are digits,
+ * what LinnOS feeds, half are random bytes like check_correctness in
+ * main.c. Both outputs of the last layer have to be the ones of the
+ * scalar model, which ref() computes the same way. A kernel may refuse an
+ * input whose activations do not fit its limbs (the caller goes scalar
+ * then); those are counted, not errors.
+ *
+ *   ./test_simd [-n inputs for +0] [-m inputs for +1 and +2]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include "predictors_simd.h"
+#include "test_weights.h"
+
+static long *weights[8] = {
+    weight_0_T, weight_1_T, bias_0, bias_1, weight_M_1_T, bias_M_1, weight_M_2_T, bias_M_2,
+};
+
+static struct linnos_cpu_packed packed __aligned(64);
+static struct linnos_cpu_scratch scratch __aligned(64);
+
+static uint64_t errors;
+
+#define CHECK(cond, ...) do {             \
+        if (!(cond)) {                    \
+            printf(__VA_ARGS__);          \
+            printf("\n");                 \
+            errors++;                     \
+        }                                 \
+    } while (0)
+
+typedef bool (*kernel_fn)(const struct linnos_cpu_packed *, int, const char *, int,
+        struct linnos_cpu_scratch *, s64 *);
+
+// cpu_prediction_model_scalar and its +1/+2 versions
+static void ref(const char *feat_vec, int n_mid, s64 *final_res)
+{
+    long in[LEN_LAYER_0], out[LEN_LAYER_0], sum;
+    int i, j, m;
+
+    for (j = 0; j < LEN_LAYER_0; j++) {
+        sum = weights[2][j];
+        for (i = 0; i < LEN_INPUT; i++)
+            sum += (long)feat_vec[i] * weights[0][j * LEN_INPUT + i];
+        in[j] = sum < 0 ? 0 : sum;
+    }
+    for (m = 0; m < n_mid; m++) {
+        for (j = 0; j < LEN_LAYER_0; j++) {
+            sum = weights[5 + 2 * m][j];
+            for (i = 0; i < LEN_LAYER_0; i++)
+                sum += in[i] * weights[4 + 2 * m][j * LEN_LAYER_0 + i];
+            out[j] = sum < 0 ? 0 : sum;
+        }
+        memcpy(in, out, sizeof(in));
+    }
+    for (j = 0; j < LEN_LAYER_1; j++) {
+        sum = weights[3][j];
+        for (i = 0; i < LEN_LAYER_0; i++)
+            sum += in[i] * weights[1][j * LEN_LAYER_0 + i];
+        final_res[j] = sum;
+    }
+}
+
+static void random_vector(char *feat_vec, int digits)
+{
+    int i;
+
+    for (i = 0; i < LEN_INPUT; i++)
+        feat_vec[i] = digits ? rand() % 10 : (char)rand();
+}
+
+// n inputs in chunks of 1, 2, .. LINNOS_SIMD_CHUNK in turn
+static void check_kernel(const char *name, kernel_fn kernel, int n_mid, long n)
+{
+    char feat_vecs[LINNOS_SIMD_CHUNK * LEN_INPUT];
+    s64 expected[LINNOS_SIMD_CHUNK * LEN_LAYER_1], res[LINNOS_SIMD_CHUNK * LEN_LAYER_1];
+    long t, refused = 0, bad = 0;
+    int i, chunk;
+
+    srand(1);
+    for (t = 0; t < n; t += chunk) {
+        chunk = 1 + t % LINNOS_SIMD_CHUNK;
+        if (chunk > n - t)
+            chunk = n - t;
+        for (i = 0; i < chunk; i++) {
+            random_vector(feat_vecs + i * LEN_INPUT, t < n / 2);
+            ref(feat_vecs + i * LEN_INPUT, n_mid, expected + i * LEN_LAYER_1);
+        }
+        if (!kernel(&packed, n_mid, feat_vecs, chunk, &scratch, res)) {
+            refused += chunk;
+            continue;
+        }
+        for (i = 0; i < chunk; i++) {
+            if (res[2 * i] == expected[2 * i] && res[2 * i + 1] == expected[2 * i + 1])
+                continue;
+            if (!bad++)
+                CHECK(0, "%s linnos+%d input %ld (%d of a chunk of %d): %lld %lld, expected %lld %lld", name,
+                        n_mid, t + i, i, chunk, (long long)res[2 * i], (long long)res[2 * i + 1],
+                        (long long)expected[2 * i], (long long)expected[2 * i + 1]);
+        }
+    }
+    CHECK(bad == 0, "%s linnos+%d: %ld of %ld inputs differ", name, n_mid, bad, n);
+    printf("%-7s linnos+%d: %ld inputs, %ld differ, %ld left to the scalar model\n", name, n_mid, n, bad, refused);
+}
+
+int main(int argc, char **argv)
+{
+    long n = 200000, n_big = 60000;
+    int opt, m;
+
+    while ((opt = getopt(argc, argv, "n:m:")) != -1) {
+        switch (opt) {
+        case 'n': n = strtol(optarg, NULL, 0); break;
+        case 'm': n_big = strtol(optarg, NULL, 0); break;
+        default:
+            fprintf(stderr, "usage: %s [-n inputs for +0] [-m inputs for +1 and +2]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (n <= 0 || n_big <= 0) {
+        fprintf(stderr, "bad arguments\n");
+        return 1;
+    }
+
+    linnos_cpu_pack_weights(&packed, weights, 2);
+    __builtin_cpu_init();
+    for (m = 0; m <= 2; m++) {
+        if (__builtin_cpu_supports("avx2"))
+            check_kernel("avx2", linnos_cpu_avx2, m, m ? n_big : n);
+        else
+            printf("no avx2, skipped\n");
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+            check_kernel("avx512", linnos_cpu_avx512, m, m ? n_big : n);
+        else
+            printf("no avx512, skipped\n");
+    }
+
+    printf("%s (%lu errors)\n", errors ? "FAILED" : "PASSED", (unsigned long)errors);
+    return errors != 0;
+}
@@ -0,0 +1,4410 @@
+//generated by quantize_weights.py from test_weights.c, do not edit
+//calibrated on 2000 digits vectors, percentile 100
+#include "predictors_q8.h"
+
+struct linnos_q8 test_weights_q8 = {
+	.weight_0_T = {
+		-37, 12, -10, -9, -3, -2, -19, 16, -5, -26, 6, -1, -39, 12, 0, -8, 1, 0, -6, -14, -6, -1, 0, -22, -3, 9, -12, -34, -14, -7, -3, 0,
+		-5, -2, 0, -2, 1, 1, -1, -1, 6, -1, -1, 5, 3, -4, 1, 1, -3, 1, -1, -7, -3, 0, 3, -1, -1, 1, -1, -5, 1, -2, -5, -1,
+		-2, -2, 5, -8, 3, 1, -6, -5, 3, -1, -8, -2, 0, -3, 2, -6, 0, -3, -4, 1, -4, -6, -2, -4, 0, -3, -1, -2, 2, 0, 1, -2,
+		3, -4, 0, -4, -3, -4, 2, 2, -6, -4, 2, 3, -1, -4, -7, -6, 0, -1, 2, 0, -2, 1, -4, 0, 1, -4, 0, -5, -1, 3, -6, 0,
+		-4, -5, 2, 2, 3, 3, -1, -5, 1, -2, -4, -2, 0, 2, -1, -2, -3, -3, -5, -5, 2, 1, -2, -5, 2, -3, -1, -11, 0, -1, -12, 0,
+		-3, -3, -8, -6, -9, 3, -3, 59, -5, -1, -3, -3, 0, -1, 0, -4, -3, -3, 0, 2, 0, -1, 6, 1, -4, -2, -1, 2, 0, 0, -4, -5,
+		5, -3, 0, 1, -2, -3, -50, 0, -3, -1, 1, 0, 0, 0, -3, -2, -2, -4, -3, -2, -3, -8, -2, 0, 0, -8, 11, 2, 5, 13, -6, 15,
+		-5, -26, 8, -3, -2, -42, 2, -8, -2, -5, 3, -1, 13, -13, -2, -15, -13, 1, 3, -7, -5, -2, 5, 5, -9, 0, -4, -11, -11, -5, -5, -3,
+		-13, -2, 1, 1, 1, 15, 2, -37, -5, -12, -1, -13, 17, -5, -14, -16, -16, 3, 0, -46, 15, 3, -6, -8, 4, 7, 9, 0, -6, -16, 8, 7,
+		29, -18, 7, 45, 18, -15, 3, -12, -8, -9, 19, 9, 4, 1, 13, -30, 0, 1, -41, -21, -7, -6, -12, -1, -2, -11, -5, -2, -1, -3, 0, -10,
+		-2, -3, 56, -6, 0, 0, 0, -4, 0, 0, -4, -2, -2, 7, -6, 0, -2, 0, 0, -3, -3, -9, -5, 1, -7, 1, -7, -3, -45, 7, 3, -11,
+		-9, -42, 26, 0, 16, -9, -11, -4, 11, 4, -1, -1, 9, 15, -9, -6, -4, 9, -2, -2, 3, -6, -1, 15, -5, 0, 8, 0, -1, -4, -1, -2,
+		-21, 1, 0, 11, -3, -5, -2, -12, 0, -7, -1, -19, -4, 2, -5, -3, -1, -3, -6, 29, -2, -9, 11, 12, -20, -11, 7, -7, -23, -23, -7, -37,
+		20, 3, 11, 12, -1, -4, -10, -10, -6, -7, -28, 9, -2, 7, -15, -25, 3, 4, 1, -2, 0, 0, -2, -7, -11, 7, -7, -27, -1, -4, -30, 1,
+		-3, 8, -3, 0, -3, 29, -5, 5, -2, 7, -28, 6, -4, -13, -3, -17, 5, -2, -2, -20, 4, 3, -27, 1, -6, -6, 0, -13, -5, 14, 5, -26,
+		-5, 1, 11, 5, 9, -1, 2, 0, 4, 0, 0, -5, -12, -1, -2, -13, -15, -9, 1, -13, 3, -4, 2, 9, 2, -11, -3, 2, 58, -50, 5, 6,
+		-5, -3, -6, -6, 1, 0, -5, 21, 10, -2, 1, 33, -11, -13, -1, -9, -4, -1, 2, -7, -7, 1, 5, -48, -2, 18, -1, -3, -9, -8, 25, 14,
+		-7, -7, 1, -10, -16, -2, 13, 2, 9, -13, -4, 0, 7, -2, 0, 1, -2, 0, 1, 1, 4, 3, -7, 1, -8, 0, -4, 6, -3, -1, -2, -1,
+		-6, 2, 3, -6, -5, -4, 1, 1, -6, -1, -4, -5, -4, 16, -2, -4, 16, -1, -6, 15, 1, -4, -12, 2, -4, -71, -8, -6, -5, -6, -4, -4,
+		-8, -7, -6, -3, -5, -6, -4, -4, -32, -3, -3, -4, 2, 1, -3, -4, -6, 1, 3, -5, -4, 0, 2, -3, -5, 3, -2, -1, -7, 1, 1, 1,
+		-4, 1, -5, 0, 2, -4, -5, 1, -5, -4, 2, -3, 12, -3, -6, -27, 0, -5, -29, -8, 2, -8, -9, 7, -58, 9, -11, -6, 2, -11, -11, -25,
+		3, -17, 1, 17, -7, 6, 5, -9, -8, -14, -10, 0, -2, -14, -4, -4, -6, 1, -1, -3, 1, -2, 58, -3, -1, -2, 1, -3, -2, 3, -5, -5,
+		-2, 0, -2, -2, 0, 12, -5, 1, -4, -1, -35, -17, -2, -16, -9, 2, -17, 1, -3, -1, 6, -5, 3, -1, -9, -7, -6, -32, -2, -5, 13, -2,
+		-8, -12, -3, -13, -10, -7, -46, 4, -28, 5, -9, -8, -6, -24, -21, 11, -1, -13, 7, -10, 0, -11, 1, 20, 5, 4, -5, 13, 2, -15, -12, -29,
+		6, -11, 5, -4, 7, 5, -2, -5, 3, -6, 1, -5, -1, -1, 2, -4, 4, -1, 3, -2, 0, -3, 0, -1, -2, -3, 1, -4, 1, 1, 1, -5,
+		1, 0, 1, -7, -1, -3, -3, 3, 2, 7, 12, -10, -1, 11, -9, -1, 0, 4, -22, -4, -4, 1, -9, 5, -2, 27, 7, 0, -10, -7, -21, 9,
+		-2, -14, -8, -11, -12, -13, -10, -8, -23, -17, -3, -12, -14, -10, -3, 25, -21, 4, 19, 2, -4, -11, -11, -5, -14, -49, 4, 13, -16, -21, 10, 0,
+		-12, -17, -8, -6, -4, -1, 1, 0, -2, -6, -2, 1, -3, 4, -3, 1, -1, 1, 0, -5, -2, -5, -4, -3, -5, 0, 2, -4, -3, -3, -3, 0,
+		-2, 0, 0, 3, -2, -15, 17, -4, 3, 2, 4, 0, -15, -2, -19, 5, -14, 0, 17, 5, 2, -1, -2, -7, -2, -1, 7, -15, -21, -26, 25, 13,
+		6, -3, 3, -5, -3, -2, 2, 1, 1, 1, -5, -3, 0, 3, -1, 3, -1, -6, -2, 2, -6, -5, -6, -5, 0, 2, -1, -1, -5, 1, -1, 0,
+		-4, -5, 0, -3, 1, -4, -3, -1, 0, -6, -2, -3, -1, -1, 5, -4, 2, 1, 1, -2, -4, 2, 0, 0, 2, -2, 0, -1, -5, -5, -4, 2,
+		7, -5, -31, 6, 6, 2, -7, 6, -9, -27, 10, -3, -5, 9, 5, 0, -8, 1, 7, 10, 4, 8, -3, 11, -8, -4, -12, -16, -3, -11, -12, 6,
+		-3, -4, 2, 3, -10, 1, 0, 4, -5, 9, 0, -40, 7, 0, 8, -21, -3, 1, 22, 9, -6, -11, 9, -3, -20, 7, -10, -2, -11, 3, -4, 9,
+		-4, -15, -2, -10, -18, 8, -31, 9, -6, 5, 12, 10, -8, -5, -1, -10, -1, 2, 15, 0, -7, 4, 7, -7, 3, 22, -25, -17, 4, 3, 4, -3,
+		6, -6, 2, 4, -4, -2, 5, 8, 3, 17, -7, 2, 0, 2, -5, -3, -1, 5, 3, -2, 12, -24, 0, -16, 9, -35, -3, -7, -29, 0, 0, -32,
+		2, 0, -1, -9, -1, -2, -9, -2, 127, -11, 0, -6, -2, -1, -1, -13, 1, 0, 0, 4, -2, -1, 0, -9, 0, 1, 0, -25, -26, 17, -28, 6,
+		-11, -28, 0, -13, -30, 3, -9, -15, 18, -7, -14, 2, -3, -9, -67, -1, -4, 3, -26, 9, 5, -15, -9, -9, -24, -3, -9, -4, 1, -3, 6, -7,
+		-17, -1, 3, -17, -2, -5, -2, -47, -7, 34, -1, -6, -1, 1, 9, -6, 1, 13, 3, -4, 2, -21, -3, -9, 0, 0, -3, 1, -4, 0, -4, -1,
+		-4, -8, -1, -2, 0, 31, -2, -4, 1, 2, -2, 0, 6, -1, 0, -2, -1, 0, -6, -2, -1, 0, -1, 0, 4, 19, -1, -2, 7, 7, -1, 3,
+		-14, -15, 11, -10, 73, 5, -3, -12, -8, -9, 0, -16, -13, 2, 2, -2, 1, 5, -21, 1, -6, -19, 7, 5, -3, -2, 5, 3, -5, -2, -2, 1,
+		4, -3, 2, -3, 1, -1, 0, 2, -2, -4, -2, -5, 2, -4, -3, 2, -3, 0, -4, -2, -6, -4, -7, -4, -3, -8, -7, -3, 0, -2, -3, -3,
+		-1, 1, 24, 4, 1, 0, -2, -1, 1, 4, 3, -2, -2, 9, 1, -1, -5, -2, -4, -2, -4, 6, 24, 1, 15, 11, -1, -6, -15, 4, -3, -17,
+		1, -8, 3, -3, 4, -18, -6, -10, 6, -2, -3, -22, 11, -2, 3, 12, -8, -25, -13, -4, 11, -15, 1, 6, 12, -19, 5, -15, -11, -15, 11, 4,
+		-72, 11, 3, -44, -6, -16, -2, -32, 0, -8, -6, -16, 13, 8, 3, 12, -1, 0, -3, -4, -1, -3, 1, -3, 1, 4, -5, -4, -3, -3, -6, -3,
+		-2, 1, -4, 2, 0, 1, -2, -5, 0, 1, 0, 1, -6, -6, -4, -6, -2, -5, -4, -5, -10, -4, 4, -1, -9, 8, -5, -15, -13, -13, -7, 21,
+		-17, 7, 14, -1, 0, 14, -2, -3, -7, 22, -12, -1, 5, -9, -3, -6, -1, -13, -29, -2, 1, -6, 3, 1, -12, -1, -39, -21, -3, -9, -36, -6,
+		14, -4, -3, -6, 27, 0, -5, 4, 29, 11, -3, -1, -4, 4, 2, 0, 3, 1, 0, 4, 0, 0, -1, -3, -3, 3, -2, 1, -1, 0, 1, -3,
+		-3, -4, -2, 3, 3, -5, -1, -5, -1, -6, -6, -3, -1, -5, -3, 1, 1, -2, 3, 3, 0, 8, 2, -5, 0, -2, -6, -29, -1, -5, -3, -5,
+		-1, 1, -5, 0, 1, -6, -5, -1, -1, -2, 1, 2, -3, 0, -1, 6, -18, 4, -4, 6, 2, -1, -6, 12, 12, -6, 10, 0, -6, 3, 1, -12,
+		7, 1, 1, 0, -5, -8, -6, -4, -8, 1, 7, -8, -12, -1, -7, -5, -4, 1, -2, 4, 1, 1, 0, -6, -3, -2, 4, 1, 0, -3, -1, 0,
+		2, 0, -1, -6, 3, -7, -4, -3, -4, -7, 1, -4, 4, 3, 0, 7, -2, -4, 3, 3, -2, 1, -1, -3, -19, 2, 1, -15, -2, -2, -8, -10,
+		-4, -2, 1, -6, -4, -3, -3, -1, 3, -5, -6, 0, -3, -1, 4, 0, -3, -3, -1, -4, 0, -4, -3, -2, 1, -1, 4, 6, -3, -1, 4, -3,
+		-2, -5, -2, -2, -1, -4, 3, -6, -9, 2, 11, -22, -5, 14, -12, -15, 9, -17, 5, 7, -5, -20, -2, -11, 3, 6, -14, 8, 2, 29, -9, -6,
+		-11, -3, -4, -20, -15, -1, 14, 4, 3, -9, 1, -7, 3, 3, 0, 2, 0, -8, 0, 2, -5, -8, 0, -4, 3, -7, -4, -1, 0, -6, 0, -9,
+		1, -1, 1, -3, 3, -2, -3, 2, -23, 11, -6, -11, 13, 2, -25, 1, 1, 6, -1, -2, -24, 0, 1, -46, -19, -4, 0, -51, -14, -4, 3, 19,
+		-6, 0, 0, 29, 9, -4, -3, -27, 4, 10, -31, -33, -1, -10, 19, -5, -33, -13, -9, -17, 13, 1, -33, 4, -10, -5, 23, -10, -15, -15, -10, 14,
+		-6, -4, -30, -12, 1, 1, -2, -1, -1, -2, -3, -4, 3, -1, -6, 1, 0, -5, 2, 1, 2, 1, 0, -1, -2, 0, 1, 3, 0, 0, -5, 2,
+		-3, -6, -7, -1, -4, 6, -4, 1, 1, -2, 0, 1, -1, -5, -5, -2, -4, -20, 0, 1, 1, -1, -5, -1, -2, -1, -5, 2, -4, -1, -5, -3,
+		-6, -1, -2, -9, 7, 2, -2, 5, -3, -1, 6, 5, 1, -4, -1, -7, -4, -1, 1, -2, 1, 2, -1, -5, -3, -6, -4, -10, -2, -4, 0, 2,
+		-3, -2, -5, 3, -2, 1, -2, 5, -10, 2, 2, -4, 1, 0, -6, -8, 0, 0, -2, -4, -7, 1, 3, -4, 0, -4, -6, 0, -6, -5, -4, -1,
+		2, 2, -4, -1, 0, -8, -4, -3, -10, 0, 1, -13, 4, -1, 12, 9, -3, -4, 1, 0, -4, -5, 0, -2, -2, -4, -2, -1, -5, 7, -18, -2,
+		-3, -3, 1, -9, -8, -2, -17, -10, 9, -10, 6, -12, 3, 67, 3, 0, 0, -18, -20, 4, -20, 10, -1, 0, -19, 19, -4, -16, 2, -9, 4, 2,
+		-14, 14, -6, -15, -5, 3, -2, 18, 6, 9, -17, -5, 8, -3, -2, -18, 3, -1, -4, 16, 3, -12, -7, -8, -7, -6, -16, 20, 11, -2, 6, -19,
+		8, -1, -16, 7, -2, -16, 4, -19, -33, -28, -3, -21, -9, -2, -72, 2, -16, 5, 13, 7, -19, 2, 5, 10, -6, -6, -5, 16, -18, -2, 3, 10,
+		9, -1, -5, -7, 10, 0, -8, 4, 5, 3, -39, 18, -8, -8, -16, 10, -13, -4, 5, -11, -5, -39, -3, 0, -2, -14, 4, 1, -3, 2, -2, -6,
+		3, -4, -2, 0, -10, -3, 2, -8, -1, 3, -4, -3, -3, -4, 0, -2, 2, -2, -4, -1, 4, -1, -3, 3, 1, -5, 3, -2, -13, 7, -4, 1,
+		9, 2, -2, 15, -10, -36, 2, -4, -52, -8, 3, -49, 5, 3, 3, 12, -19, -6, -10, -11, 8, 0, -3, -5, -9, -8, 3, -3, -10, -13, 4, -8,
+		-4, 3, 2, -11, 3, -9, -1, 19, -4, -8, 4, 1, 1, 3, 7, 8, 9, -15, 26, 13, -27, -4, 14, -27, -7, 1, 1, -25, -9, 7, -11, -4,
+		-1, -12, 10, -13, 14, 0, -28, 18, -1, -1, -1, -8, -8, 17, 4, -1, 6, -5, -7, 4, -2, -6, -11, -6, -31, -2, -10, 6, -6, 2, -5, 3,
+		5, -21, -3, -17, -5, -9, 1, -3, 4, 0, -13, -8, -15, 11, -3, 2, -7, 6, -11, 4, -2, -5, 7, -14, -9, -3, -1, -13, -8, -4, -13, 3,
+		-2, -1, 3, -1, 90, -11, -1, 1, -4, -3, -2, -7, 5, -5, -2, 1, -8, -2, -4, 10, -7, -1, -2, -15, 8, 2, -6, -13, 2, -7, -10, 2,
+		-9, 3, 1, 5, -4, 1, 7, 2, -3, -11, 10, -5, -9, -14, 12, 0, -6, 0, 13, 3, -16, 5, 2, -3, -3, 5, 4, 2, 4, 0, -5, 3,
+		1, 1, -29, -2, 1, -1, 0, 0, -4, -8, 0, -1, -5, -12, -3, -2, -3, -6, -1, -4, -1, 20, -2, -4, 16, -7, -1, 19, 5, 2, 0, -6,
+		-2, -27, 1, 0, -1, -1, -14, -9, 5, 5, 4, -2, 2, -4, -9, -12, -5, -23, -5, -3, 14, -7, 2, -2, 5, 2, -4, 2, -8, -10, 4, -60,
+		11, 15, -11, 4, -5, -9, 5, 4, -5, -5, 3, -10, 6, -4, -19, 15, -5, -2, 0, -3, -5, 1, 1, 0, -7, -2, 10, 4, 1, 0, 1, -17,
+		-4, -8, 27, 5, -8, 3, 5, -3, -7, -15, 7, -4, -14, -2, 9, 3, -23, 8, 5, 3, 1, 6, 2, -3, -2, -8, 0, -3, 0, -2, -8, -6,
+		-4, 1, -6, -4, -1, 0, 3, -3, -1, 0, 1, -4, -5, -8, 2, 0, 1, -7, -4, -8, -20, 4, 0, -40, -10, 0, -24, -10, -9, -29, -3, 3,
+		-7, 19, 0, -32, 5, -1, -16, -2, -3, 9, -8, -5, -13, 15, 3, -8, 2, 2, -4, 3, 4, -2, 4, 4, -6, -2, -2, 0, 5, -2, 2, -3,
+		-3, 1, -5, -4, 0, -7, -4, -1, -3, -6, 2, -4, -5, -2, -4, 0, -3, -5, -1, -4, -3, -4, -4, -4, 1, -1, -3, 2, 1, -3, -3, -2,
+		-4, 0, 2, -2, 3, -3, -3, 1, 1, 0, -4, -5, 2, -4, -4, 17, 0, -2, -14, -9, -2, 1, -1, 0, 0, 8, -17, -11, -1, -11, 8, -7,
+		-14, 18, 6, -12, -3, -7, 9, -9, 3, 5, -11, 1, -15, -19, -23, -7, -17, -7, -10, -18, -7, -3, 2, -9, 8, 47, -3, 3, -6, 0, -6, -3,
+		-36, -7, -6, 2, 23, 12, -7, -9, 25, -5, -8, -1, 4, 6, -4, 10, 4, 1, 8, 1, 4, -11, 0, 0, -6, 3, -8, -15, -10, -3, -12, -3,
+		1, -16, -2, 13, -5, -8, 2, -3, 1, -7, -1, 1, -1, 10, -2, 5, 6, -7, -11, -44, 0, 6, -3, 4, 13, -33, -23, 3, -11, -12, 6, -8,
+		0, -7, 0, -4, 1, 7, -22, -7, -15, 0, -2, 3, -3, 2, 3, -5, 7, -1, -1, 1, -1, -3, -38, 1, 0, -1, -5, -1, -3, 1, 2, -2,
+		-1, -3, -2, 0, 0, -13, -2, -1, 1, 1, -4, 2, 0, -3, 0, 0, -5, 1, 2, -4, -2, -4, 3, -6, 1, 1, -2, -1, 0, -1, -1, -3,
+		1, -3, 2, -2, 4, -1, -5, -3, 4, 0, -1, 0, -4, 0, -3, 3, 0, -3, -4, -4, 2, 1, -2, -3, 0, -4, -4, 1, -2, 4, 0, -4,
+		-2, -5, -5, -1, -5, 1, 0, 3, -9, 10, 1, 15, 0, 0, -15, -2, 10, 9, -9, -26, -7, -2, -5, -11, -8, -7, -18, 3, -7, 2, 15, 2,
+		-28, -13, 12, 5, 6, 3, -18, -6, -4, 12, 2, -3, -19, -1, -4, 2, -6, -1, -32, -40, -8, 26, 4, -2, 1, 19, 1, 2, -3, 29, 2, 3,
+		0, 41, 4, 3, -2, -1, -10, 7, -3, -6, -15, -3, -17, -3, 1, -9, -5, 3, 7, -3, -9, -22, 3, 2, 4, -7, -27, 0, 3, -20, -2, 7,
+		20, -44, -5, -1, -9, 9, -2, 18, -3, 0, 0, 21, -16, -8, -11, 0, -17, -9, 2, 6, -2, -3, -15, -14, 3, -3, -5, 2, 16, -4, -1, 17,
+		-15, 0, -1, -20, -10, 2, -10, -8, -1, -69, -4, 2, 2, 11, 2, -8, 18, 2, -4, -2, -29, 5, -23, -4, -5, -9, 27, -16, 9, -2, -37, -34,
+		-12, -2, 4, -2, -3, 5, -4, 4, -21, 13, 0, -14, -14, 6, 12, 6, -10, 23, -6, -6, -1, 27, -21, -13, 1, -5, -19, -8, -3, -6, -2, -8,
+		1, 36, -1, 3, 24, -3, -1, 36, 14, -1, 0, -5, 3, -89, -8, -1, -4, 1, -3, -6, 3, -2, -9, -4, -15, -7, -7, -2, -34, 3, 1, -6,
+		1, 2, -19, -7, -5, -2, -3, -34, -12, -1, -21, -6, 1, 2, -3, 5, -56, -4, -7, 11, -7, 0, 4, 3, -6, 11, 14, -7, -10, -19, -8, -2,
+		-1, -2, 6, 3, -3, 5, -5, -1, 1, 3, -4, -9, 2, 0, -7, -3, 2, 2, -9, -6, -4, -3, -1, 2, -5, 1, 7, -6, -3, -4, 16, 8,
+		1, 7, -11, 11, -2, 13, 0, -16, -5, -5, 13, 1, -3, 0, -29, -10, 10, 12, -22, -54, -5, 9, 6, -4, -15, 0, -8, 2, -12, 9, 17, -9,
+		-2, -10, -1, 3, 0, -20, 23, -3, -13, -13, 0, -6, 24, -1, -7, 1, -2, 1, 11, 2, 2, -14, 1, -1, -10, -2, -8, 0, -21, 1, 3, -7,
+		12, -12, -16, -10, -16, -20, -1, 9, -1, 21, -10, 19, -3, -17, -17, -2, 11, -13, 4, -29, -6, -3, 4, 2, -7, 5, -1, -4, 2, 2, -3, -5,
+		-3, -7, 2, -4, -3, 0, 0, 23, 1, -1, 1, -4, 1, -1, 0, -1, -4, -1, 3, -6, -3, -2, -1, -1, -1, -2, -16, 5, 7, -10, -26, -11,
+		2, -34, 10, 7, 8, -13, -15, -6, -11, 14, -2, 1, -8, 17, 12, -12, 3, 12, 10, -3, -4, 16, -9, -9, -12, 0, 6, -25, -4, 1, -22, -11,
+		-16, -4, -8, 9, -1, 10, 9, 8, -34, 12, 1, -4, 6, -54, 1, -4, 23, -59, -2, 1, -21, -23, 4, 1, -16, -10, -15, -19, 12, -4, -6, -15,
+		-9, 3, -8, 3, -2, 8, -8, 12, 16, -10, -6, 8, 3, -22, 0, 5, -1, -8, 2, -20, -5, 8, 7, -15, 7, -13, -12, -7, -6, -19, 10, -1,
+		-10, 2, -4, 15, -6, -1, 8, -3, -7, -5, 11, 1, -19, -1, 13, -13, -9, 6, 5, 6, 6, -12, 12, 1, -4, 16, 0, -4, 22, 5, -2, 2,
+		2, -4, -56, -5, -3, -16, -3, -4, -4, -13, -2, -6, -5, -10, -2, -4, -7, -16, -2, -8, -1, 7, 0, 2, 1, -1, -5, 4, -1, 2, 7, 2,
+		-5, -2, 4, 1, -5, -4, -11, -5, -4, -6, -8, 0, 1, 0, -9, 3, -1, -6, -5, -1, -3, -21, -9, -7, 18, -13, -5, 15, 0, -4, -15, 6,
+		13, 21, -2, 0, -5, -6, 6, -4, -20, 3, -12, -24, 1, 7, -5, -41, -3, -13, -24, 2, -1, -1, 2, -1, -5, -1, 1, -2, -1, -5, 1, 1,
+		-1, 2, 1, -5, 0, -1, 2, 0, -3, -1, -1, 3, -4, -4, 3, -1, 0, -4, 5, 1, -3, 7, -6, -2, 5, 3, -3, 2, 2, 2, -32, -3,
+		-1, -13, 3, -2, -3, -6, -1, 1, -3, -15, 1, -1, -4, -15, -1, 0, -6, -12, -29, 2, -5, -27, 6, -6, -19, -1, -37, -3, -1, 0, -17, -4,
+		-12, 7, 3, 2, 3, 2, -6, 0, 5, 9, -12, -3, 38, -10, -9, -3, 3, 2, -1, 2, -4, -1, -4, -2, -1, 3, 1, -6, -4, 3, 2, 2,
+		-3, -2, 2, -5, -6, -1, -5, 2, 0, -1, 0, 1, -1, -4, -4, -2, -4, 0, 5, 2, -1, 0, -6, -1, 4, 0, -5, 4, -4, -5, 3, 1,
+		2, -4, 2, -4, -2, -2, -4, 2, -6, -3, -2, -3, 1, 1, 0, 8, -14, -1, 11, -10, -15, 0, -9, 1, 14, -4, -7, -36, 3, -6, 4, -9,
+		-7, 4, -1, -21, -13, 2, -4, 2, -11, 19, -5, 3, 8, 5, -11, -1, 9, 5, 1, 13, 10, 4, 16, 5, -8, 14, 7, 4, 10, 6, -23, 4,
+		-11, 4, -11, -6, -24, -16, 4, -9, 13, 11, -16, -11, -16, 14, -8, -20, 7, 1, -12, -1, 2, -5, -10, -6, 62, -8, -6, 13, -14, 2, -5, -17,
+		10, -12, 0, -21, -2, -4, -9, 22, -8, 1, 2, -22, -2, -1, -3, -3, 0, -37, 12, -2, -8, 1, 0, 96, -6, 0, -7, 2, -4, 0, -43, 6,
+		1, 2, -17, -7, -3, 0, 4, -6, -1, -5, -4, 1, 1, 1, -1, 2, -6, 3, -2, 3, -2, -8, 0, -2, -1, 4, -1, -3, -5, -1, -2, -1,
+		-2, 3, 1, -2, 0, 1, 1, 0, 0, 4, -3, 0, 2, -1, 0, 3, -2, -2, 2, 1, -6, -1, -2, 0, -8, -3, -4, 0, -1, -5, -4, 1,
+		0, -1, 0, 0, -1, -1, -4, -1, 1, -3, -3, -3, 0, -5, -2, 3, -2, 4, 0, 0, 0, 2, -1, 2, -1, -1, 1, -3, -3, 3, -3, -4,
+		-2, -5, -5, 2, -4, -4, -4, 4, -1, -1, -4, -6, -5, 2, 2, -3, -1, -1, -4, 6, -4, -2, 3, -8, -5, 1, 4, 5, -1, 1, -5, 0,
+		-5, 1, -4, 2, 0, 0, 6, 11, -11, 2, -4, 3, 13, -20, 1, -1, -15, -2, 3, 4, -10, -24, -4, -4, -9, 11, -4, 7, -8, 31, 7, -4,
+		2, 2, -11, 7, -13, 2, 5, -8, -4, -5, 1, 0, -1, 2, -3, -4, -3, 3, 2, 1, 4, -2, -2, -4, 0, -4, -5, -3, 6, -6, -3, 2,
+		-2, -2, -2, -1, 9, -7, -3, 7, 6, -14, 13, -2, 3, 14, 6, -13, -23, -14, -6, 5, -2, 5, -10, 15, 15, -19, 4, 1, -14, 2, -2, -16,
+		2, 1, -2, -6, -1, -4, -5, 1, -5, 0, -7, 2, 0, 3, -6, 27, -9, -2, 1, -7, -6, -3, 5, 4, -1, -3, -6, -7, -6, -1, 12, -9,
+		-3, -3, 1, 0, 2, 1, -2, 0, -1, -4, 1, 4, 2, -1, -2, -1, -4, -5, -6, -4, -3, 4, 4, -2, -2, -4, -4, -3, -1, -2, 4, -2,
+		-2, 1, -7, -2, -1, -5, -2, 1, 1, -1, 3, -4, 3, 8, 3, -5, 1, -4, -1, 2, 3, -5, -1, 1, -2, -5, 1, -1, -4, -6, -4, -1,
+		2, 1, -7, -3, 3, -4, -1, 3, -6, 3, -3, 0, 0, 3, -1, -7, -5, -3, 0, -2, -4, -6, 4, -4, -2, 3, -5, 7, 2, -4, -2, 13,
+		0, -2, 7, -13, 9, -14, 19, -2, -25, -15, 10, -9, 22, -4, 15, -4, -1, 1, 19, -8, -1, -4, -15, -2, -8, -14, -8, -15, -12, -9, 3, -3,
+		-1, 3, 1, -2, -4, -3, 2, -2, -3, 0, 0, -1, -1, -4, -3, -5, -4, 3, -4, 2, 1, 0, 1, -1, -1, 4, -2, 0, -4, -5, -3, -1,
+		-2, -1, 0, -2, -5, -4, 3, 0, -4, -4, -4, -6, 3, -2, -6, -3, -7, -3, 0, -5, 2, 0, -4, 1, -8, -5, -2, 0, 4, 0, -6, -14,
+		8, -14, 6, 8, -17, -2, 4, 0, -33, -10, -6, 4, 4, -5, 12, -10, 8, 5, 0, 12, -13, -6, -15, -5, -5, 0, 0, 5, -3, -4, 4, -1,
+		-4, 4, -5, -4, 4, -3, 1, -3, -2, -5, 0, -6, 1, -4, -2, -1, 1, 1, -4, 0, -1, 2, -2, 0, -4, -1, 8, 0, -1, 5, -7, -6,
+		12, 5, -2, 6, -4, -5, -26, 0, -1, 10, -2, -2, -5, -12, 3, -3, -4, -6, -1, -4, -5, -21, 0, -3, -2, 4, -45, 0, 6, -29, -7, -32,
+		14, 6, -27, 9, 0, 75, 27, -6, -26, -8, 8, -8, -48, 0, 4, -5, -43, -15, -1, -2, 22, -7, -4, -9, -6, 0, -15, 1, -3, -2, 0, -14,
+		-1, 2, -20, -7, 1, 1, 6, 10, 2, -1, -4, 5, -20, -5, 0, 11, 9, 3, -10, -2, -20, 4, -17, 0, 2, -27, 7, 1, -1, 5, 2, -6,
+		6, 8, -2, 5, -17, -5, 0, -4, 5, 3, -6, 1, -18, 4, 8, 8, -19, -8, 10, -9, -21, -4, 7, 2, 2, 4, 8, -3, 18, -43, 1, 3,
+		4, -10, 109, -10, -3, -28, -4, -8, 1, -7, 3, 4, -6, -17, 7, -9, -5, 1, 4, -3, -4, -13, -15, -5, -17, -9, -2, -17, 0, -7, -6, -7,
+		-5, 14, 18, 1, 28, 7, -4, 6, -2, 4, -7, -10, 9, 3, -8, -16, 22, 6, 2, 6, -42, -26, 2, -41, 16, -18, -40, 17, -23, -32, 6, -10,
+		-30, 17, -1, -59, 2, 4, 0, -52, -3, -9, 4, 19, -9, -8, -16, 6, -13, 7, 7, -9, -5, -2, -10, -5, -4, -10, -7, -6, -6, -1, -2, 75,
+		3, 0, 1, 1, -4, -5, 3, -2, -3, -1, 3, 0, -2, -4, 3, -3, -1, -3, -19, 3, -8, -7, -9, -3, -13, -3, -5, -20, -3, -4, 17, 7,
+		1, 6, -1, -4, -2, -4, -3, -1, 1, -10, 7, -4, -2, 11, -5, -4, -1, -9, -1, -3, -10, 10, -11, -16, -17, 4, 6, -9, -1, 4, -9, -7,
+		5, -5, 1, 5, 0, -5, -7, -6, 12, 13, 8, -17, 23, -1, -19, -6, 7, 0, -1, 0, -16, 5, 7, -11, -11, -10, -7, -4, -15, -7, -1, 12,
+		-5, 0, 1, 17, 5, -1, -6, -5, 13, -2, -7, -9, -10, -6, -9, -3, -13, -6, -2, -19, -9, -4, 7, 6, 0, 5, 3, 4, -22, -15, -8, -5,
+		-3, -1, -7, -10, -5, 6, -6, -14, -5, -6, 11, 11, -4, -10, 1, 1, 0, 0, -5, -3, 0, 1, -1, -1, 6, 0, -2, 3, -3, -6, 2, 0,
+		-8, 2, -7, -3, 0, 4, -5, -2, -2, -5, -3, -1, -3, 17, -29, -7, 11, 10, 1, 7, -11, -4, 6, -14, 0, 82, 13, -7, 8, -12, -7, -3,
+		7, -16, 3, -15, 6, -10, 0, 5, -16, 14, 0, 0, -1, -1, -1, 4, -4, -7, 1, -1, 1, -1, -7, -4, 10, -4, -1, 9, -7, -3, -1, 0,
+		-2, -2, -4, 5, 3, 0, -2, -6, 0, -3, -3, -20, 17, 3, 0, -2, -4, -2, 3, -2, 8, -10, -12, -31, -13, -7, -19, 7, -13, 0, -5, -3,
+		-1, -5, 27, 8, -3, 10, 4, -5, -6, -9, 10, 13, 2, 5, 19, -22, -16, 3, -10, -20, 1, 5, -8, 11, -6, -5, -23, 3, -19, 8, -12, -3,
+		-2, -8, 4, -26, -11, 5, 10, -8, 1, 21, 2, 5, 3, -9, 7, 3, 6, -13, 2, 4, -11, -24, 5, -12, 7, 6, -4, -11, -20, -10, -11, 8,
+		8, -3, 5, -12, 1, 2, -8, 4, 4, 22, -4, 16, -1, -14, -30, -3, -17, -7, -19, -7, 3, 2, 1, 5, -3, 6, -21, 13, 8, -4, 0, 20,
+		-6, 1, -3, 1, 13, -7, 0, 4, 1, -1, -6, -1, 0, -1, -1, 0, 4, 3, -8, 1, -2, -1, 0, 2, 3, -7, -10, 2, 0, -6, -3, -1,
+		-7, -7, -10, -1, -2, -7, -20, 3, 1, -13, 0, -6, -10, -6, -10, -16, 5, -3, 23, -23, -16, 15, 4, -23, -4, 11, 8, 6, -2, -1, 15, -33,
+		-8, 18, -3, 4, -9, -2, -6, -5, -19, 12, -6, -28, 6, 5, -11, 13, 4, -19, 1, 4, 18, 10, -4, -41, 16, -3, -1, -3, -28, -1, -10, -2,
+		-19, -4, -3, -6, -5, -11, -3, -10, -3, -25, -3, 2, 3, -5, 12, -5, 5, 1, 6, 5, 9, -43, -8, -7, -13, -10, -8, 25, -6, 7, 0, 26,
+		7, 1, 1, 19, 1, 0, -23, -1, -8, -20, 5, -1, -15, 12, -9, -26, 1, 2, 23, 5, -3, -4, -36, -14, 2, -13, 23, -3, -8, -13, 15, -4,
+		7, 2, -11, 1, -5, 5, -9, 2, -6, 5, 6, -13, 10, -11, -26, 12, -5, -18, 7, -11, -19, -6, -7, 6, -23, -5, -6, 2, 4, -17, 1, -8,
+		-3, 7, 0, 3, 9, -9, -4, -7, 4, 0, -11, -3, -4, -16, -3, -9, 10, 0, -15, 7, 6, 5, -18, -1, -15, 9, -11, -10, -1, -14, 5, 1,
+		5, 4, -1, 0, 1, -2, 2, -6, -1, 2, -3, -1, -10, -4, -1, -4, -1, 1, -7, -1, -6, 1, -4, 0, -2, 0, -1, -5, 0, -1, -1, 5,
+		-19, -11, 7, 7, -9, 3, -39, 13, 0, -8, -2, -16, 16, -12, -8, -6, -7, -19, -5, 0, -12, -42, -6, 2, 1, 7, -13, -1, 3, -10, 4, 2,
+		-4, 0, -3, -3, 4, 2, 0, -1, 3, -3, -36, 2, -1, -5, 1, -5, -2, -7, 0, -3, -3, 0, -4, 0, -2, -9, -1, -2, -4, 0, 1, 0,
+		-10, -6, -6, -6, -5, -2, -6, -5, -1, 11, 5, 2, 2, -4, -3, 0, -2, -1, -3, -4, 2, 1, 0, 0, 0, -9, 0, -4, 29, 0, 0, 21,
+		4, -6, 5, -3, 2, -13, -2, 2, -83, -9, -6, 18, -10, 0, 3, 11, -6, -6, -1, -12, -2, -3, -5, -21, -5, 1, -3, 4, -2, -3, 6, 1,
+		-4, 5, 1, 0, -1, 2, 0, -43, 0, -4, -4, 0, 2, -1, 3, -1, -1, -1, -1, -2, -5, -2, -8, -3, -1, -1, 10, 3, -17, 1, -22, -4,
+		4, 5, 10, -1, 10, -15, 2, 18, -4, 25, -24, -31, 2, -2, -10, 1, -5, -32, 8, -9, 7, -26, 6, -26, -5, -3, -6, -5, 2, -10, -18, -1,
+		-27, -20, -2, -5, -1, -2, 28, 2, 1, -38, -2, 11, 1, -59, -10, 2, -4, -36, 1, -4, 3, -49, 8, -4, -26, 3, -16, -24, 11, -5, -18, 5,
+		-15, -24, 3, 0, -20, 4, -19, 16, -7, -3, 4, -19, -1, -12, 5, -17, 4, -9, 4, -8, -2, 6, -2, -8, 13, 1, 3, -21, -6, 2, -20, -9,
+		-16, 1, -5, -4, 12, -8, 3, -10, -18, -12, 15, 6, -11, 7, 19, 4, -3, 0, 10, -10, 9, -3, -1, 1, -6, 2, 2, -1, 3, -2, -1, 6,
+		2, 2, -11, -2, 1, -1, -4, -5, -6, 1, -5, -1, -7, -4, 2, -3, -2, -4, -4, -3, -5, -21, 1, 0, -17, -17, 4, -14, 5, -20, -25, 19,
+		-7, 62, 5, -7, 8, 4, -4, 5, 8, -5, 1, -9, -15, -1, -5, 5, 27, -18, -3, -9, -3, 13, -8, -1, 0, -9, -6, -6, 2, -9, 8, 4,
+		-17, 20, -3, -23, 5, -6, 0, 15, 3, -11, -18, -11, -1, -14, 0, -17, 6, -2, -14, 1, -6, 3, -8, -30, -3, -3, 3, -9, -7, 11, 4, 13,
+		6, 3, -16, -9, 6, 0, -7, 0, -22, -9, 21, -6, -27, 9, 28, -25, -14, -4, -3, 0, 0, -4, 0, 0, 0, 0, 0, 9, 0, 0, 0, 5,
+		0, 13, 0, 0, 0, 11, 0, 0, 0, 12, 0, 0, 0, 20, 0, 0, 0, -3, 2, -5, 0, 4, -2, 4, -5, 3, 4, -4, -3, 0, -1, -5,
+		-1, -5, -5, -5, 1, 2, -6, 0, 4, -4, -1, -3, -4, 4, -4, -1, 1, -1, -6, 0, -4, -6, 3, 2, 0, 1, -2, 1, -5, -4, -1, 2,
+		-3, 2, -5, 0, -7, 2, -4, -7, 0, -1, -6, 1, -1, -3, 1, 3, -3, -2, -2, -3, -3, 2, -1, -3, -3, -1, -4, -1, -2, -5, -5, -5,
+		-3, -3, 5, -2, -2, 0, -4, 1, -1, -4, 3, 3, -4, 4, 2, -1, -5, -4, -4, -2, 5, -3, 1, 5, -5, 3, 0, -2, -2, -3, -6, -2,
+		1, 2, -3, -1, -1, -6, -6, 0, -6, -3, -2, -1, 1, 6, 0, 1, 7, 3, -11, 1, 5, -4, -1, -4, -9, 5, 3, -2, 6, -9, -1, 4,
+		13, -7, -14, 1, 8, -3, 0, -1, 3, 0, -6, -21, 23, -12, -19, -24, -6, 9, -31, -33, 1, -7, -2, -1, 3, 19, -2, 7, 0, -12, -7, -6,
+		13, -12, -47, 11, -11, 8, -5, -6, 9, -4, -2, -5, -29, 1, -5, -2, -19, 4, 3, 2, -10, -16, 6, 4, -18, -10, 18, 14, -12, -10, -10, 12,
+		-5, -12, 2, -22, -3, 5, 14, -7, -1, -7, 12, 1, 4, 17, 3, -3, 9, 2, -10, -6, 7, -5, 43, -11, 2, 22, -4, -2, 0, 25, 18, -5,
+		-2, -10, -6, -26, -8, 2, -2, 2, 1, -1, 4, -1, 5, -1, -3, 7, -6, -6, -3, 1, -3, -11, -6, -8, -4, 0, -4, -6, 0, -6, -1, 2,
+		6, 2, -2, 1, 3, -4, 2, -4, 6, 1, -3, 1, -3, -4, 3, -3, 0, 2, -6, 2, 2, -3, -4, -2, 3, -1, -1, -3, -4, 2, -3, 3,
+		-3, 1, -2, 4, -4, -1, -2, -2, 8, -1, 12, -2, 1, -2, -4, 8, 9, -1, 5, -1, 17, -18, 7, 3, -13, -20, -14, -4, -10, -5, 8, 1,
+		-5, 3, -26, -5, 0, -9, -4, -1, -1, -5, -3, 2, 4, -1, -5, 4, -5, 1, 1, -3, 0, -2, -5, -2, 1, 0, -1, 1, -3, 1, -2, 0,
+		-3, 1, -3, -3, -5, -1, -9, 4, 2, -19, -4, -6, 0, 0, -3, -4, -12, 3, 13, 0, -15, -14, 0, 2, -20, -12, -12, 4, 11, 0, -11, 1,
+		13, 16, -2, -7, -3, -18, -11, 2, 6, -12, -3, -17, 9, 3, -12, -4, -23, -3, -31, 10, -1, -20, 6, 6, 4, -2, 3, -9, -1, 4, -2, -9,
+		-4, -10, -24, -1, 2, -4, 1, -4, -4, 1, -5, 4, 2, 1, -5, -4, -1, 2, -2, -3, -2, -3, 0, -3, 0, -4, -2, 0, -2, 0, 4, -1,
+		-4, -5, -4, 1, -3, 0, 5, -2, 1, -1, -8, 1, -2, 0, -5, 3, -3, 6, 1, -3, -2, 5, -1, -4, -3, -10, -6, 2, -6, -9, -3, -3,
+		1, -3, 5, -25, 2, 1, 2, -12, -10, -4, -8, -19, -16, 9, 10, -2, -6, -2, -2, -13, -32, 0, 2, -7, 7, -1, -20, -8, -28, 20, -12, 10,
+		-11, -6, 3, -12, -5, -26, -13, 7, -12, -8, 13, -5, -33, 1, -16, -2, 2, -3, -14, 13, -5, 8, 3, 8, 4, -3, 0, 15, 5, 3, -17, 2,
+		-1, 1, 4, 2, -4, 5, 0, 1, 2, -3, 0, -1, -1, 1, 0, -6, -3, -3, 3, -3, -7, 0, -1, -11, -3, -1, -6, -10, -1, -2, 7, -3,
+		2, 1, 3, -1, 7, -2, -1, -1, 1, -4, 4, -4, -4, 2, -5, -1, -1, 0, 1, -2, -6, 5, -6, -4, 0, -2, -8, -6, -6, 3, 0, 1,
+		7, -3, -6, 5, 3, 0, 21, 4, -4, 9, 27, 5, 27, -4, -4, 6, -3, -2, -13, -9, 6, 8, -2, -5, 18, 2, -6, -1, 1, -2, -5, -1,
+		0, -1, -3, 5, 1, 1, 0, -8, -9, 0, 0, -5, 1, 4, -3, -5, 1, -5, -4, -2, 2, -2, -9, -5, -7, -3, -8, 20, 13, -1, 24, -11,
+		-7, -16, -2, -1, 14, 4, 3, -26, -23, -2, -3, 4, -2, -6, 13, 10, -6, 3, 29, 10, -3, -6, -22, 11, -2, -4, -8, 1, 6, 5, 8, -2,
+		-1, 9, -1, -3, -1, -5, -32, -15, -14, 7, 5, 0, -19, -7, -11, -8, -6, 17, -14, -8, 7, 27, 8, 0, 0, -10, 8, 6, -34, 9, -3, -42,
+		-6, -3, -45, 14, -37, 22, 16, 0, 5, 7, -12, -21, -11, -3, -4, -8, 0, 3, 5, -1, -3, 9, -5, 1, 11, 13, 7, 4, -6, -5, -6, -3,
+		5, 0, -7, -1, 1, -7, -7, 9, 1, -23, -4, -22, -20, -36, -24, 22, 10, -10, -3, 16, 2, 7, 2, -2, 3, 1, -4, -4, -5, -4, 3, -2,
+		5, 1, -2, 2, -2, -2, 3, -3, -1, -3, 2, 1, -4, 1, -5, 1, -5, 1, -4, -3, -4, -2, 3, -1, -2, 4, 3, -4, -2, -5, 1, -4,
+		1, -5, -3, -3, -7, -6, -1, -4, 2, -4, 2, 1, -1, -1, -4, -5, -1, -2, -5, 1, -1, -3, 3, -2, 6, -1, 6, 13, -12, -14, 2, -7,
+		4, -9, -11, -10, 10, 3, -11, 6, -13, -1, -7, -6, 20, 2, 0, -4, -2, 6, -26, -5, -11, 0, -8, -14, -7, -15, -5, -13, 8, -3, 10, 11,
+		-3, 20, -3, 4, -30, 5, -4, -35, -13, -5, -2, 5, 8, 6, -5, -21, -19, -13, -60, 14, 1, 5, 8, -1, -14, -3, -18, -2, -7, -6, -9, -13,
+		11, -4, -9, 4, 6, -19, -10, 11, 1, -19, 2, 7, 1, -2, -4, -3, -9, -7, -3, -6, 1, -5, 0, -2, -1, 0, -6, 3, 3, -2, 3, 1,
+		-4, -5, -6, -2, -7, 6, 0, -5, 1, -2, -5, 0, -3, 2, -6, 2, -3, 3, -44, 2, 5, -23, -3, -1, -4, -37, 11, 3, 9, 23, -3, -4,
+		3, -19, -5, -3, 24, -5, -3, -3, 4, 17, 0, -1, 1, 2, -2, -6, 7, -1, -1, 6, -3, -6, 10, 4, -1, 3, -2, 0, -52, 0, -1, -1,
+		-1, 0, 0, -4, 1, -4, -2, -7, -4, -1, -2, -10, 1, -2, -1, 12, -4, 6, -21, -4, -11, -32, 12, -2, -11, 1, -14, -36, 15, 6, -11, -12,
+		-7, -4, -24, 3, 3, -13, -19, -2, -11, -26, 11, 0, 2, 4, -23, -7, -6, 19, 23, -6, 15, 9, -7, -10, -47, -2, 1, -18, 9, -20, -2, -8,
+		-19, 9, 6, -9, 2, -6, 3, -9, -6, -13, -11, -12, 4, 0, 1, -4, -2, -3, 4, -10, 4, 2, 5, 7, -5, 62, 10, -12, -10, -6, -9, 5,
+		11, 4, 11, -7, -6, 3, -1, 0, 5, -12, -3, -21, 2, -1, -1, -2, 1, -4, -2, -4, 1, -1, 2, 2, 2, -6, -5, -2, -5, 0, 1, -6,
+		-4, -5, -4, -4, 1, -3, -1, -5, 0, 0, 0, -4, -1, -4, 0, -4, -2, 0, 2, -4, -5, -9, 1, 1, -7, -1, 0, 3, -1, -4, 0, 1,
+		-4, -4, 3, -2, -2, 0, 3, -1, 2, -4, -36, 7, -4, 5, -11, -13, -25, 7, -14, -10, 1, -4, -49, -4, -5, -9, 12, 1, 1, 15, -2, -1,
+		-6, -25, -13, -13, 9, 2, 13, 1, -8, -30, 17, -6, -12, -8, 0, -10, 2, -3, -19, 2, -5, -26, 15, 2, -29, -25, 3, -5, 27, 3, 3, 4,
+		27, 0, -8, -5, 4, -2, -8, 0, 4, -1, -3, 3, -4, 1, 2, -7, -4, 4, 1, -5, 3, -3, 0, -3, -2, -2, -2, 2, -2, -7, 1, 0,
+		-5, 2, -1, 2, 1, -4, 1, 23, 6, 0, 13, 1, 0, 8, -1, 1, 4, 3, 0, 54, 2, -14, 15, 0, -19, 0, 8, -11, -5, -9, 12, -9,
+		-1, 1, 8, 6, 1, 2, -3, -1, 0, -5, -6, -3, 2, -3, -3, -6, 0, -6, -4, -1, -1, 4, 1, 2, -2, -4, -2, -6, 0, 2, 1, 0,
+		2, -2, -1, -4, -2, 3, -1, -4, 2, -2, 0, 4, -5, -5, -3, 4, 1, -1, 1, 3, -4, -5, 0, -5, 2, -1, -2, -2, 0, 1, -5, -4,
+		0, -4, -1, -3, 2, -5, -2, 1, -4, -5, 2, -2, -5, 2, -5, 1, -2, -5, -1, 0, -3, 3, -2, 2, -5, -5, 3, -1, 0, -3, 0, -2,
+		-2, -3, -4, -1, 6, -2, 6, 10, 1, 22, 2, -1, -3, -14, 9, 4, -31, 3, 15, 1, -6, -7, 9, 9, -12, -3, 15, 12, -5, -11, -4, -19,
+		-33, -12, 0, 0, -21, -10, -6, -8, -22, -3, 2, 4, 13, -24, -12, 4, 0, 22, 9, 0, 0, 24, 2, -8, 2, -21, -7, -2, 0, 8, -8, 8,
+		-7, -13, -45, -1, 1, 14, -3, -10, -2, -1, -6, 10, -7, 2, 15, -11, -25, 0, -7, 6, 3, 0, -3, 4, 21, -33, -27, -11, 16, -4, 0, 9,
+		-16, 0, -11, -9, 5, -19, -8, -22, -9, -11, -1, 0, -15, 11, -9, 3, -4, -4, -3, -16, 14, 2, 2, -31, 14, 3, -7, -23, -19, 1, -16, 4,
+		-2, 0, -4, 3, 4, -2, 0, 0, 2, -5, -1, -5, 1, 0, -2, -3, 1, -3, -4, -3, -4, -3, -5, -2, -5, -3, 4, -6, -1, -5, -4, -20,
+		5, 1, -4, -4, 0, -14, -2, 4, -6, -10, 14, 12, 5, -15, -16, -21, -31, -9, -12, -23, -11, 2, -3, 10, 4, -3, -39, 6, 5, -11, 2, -4,
+		14, -12, 2, -13, 2, 5, 8, -38, 5, -14, 14, -12, 17, -12, -4, -10, -26, 11, 0, -11, -7, 5, 4, -1, 3, -11, -11, -4, 6, -1, -1, 9,
+		13, -1, 13, -10, 5, 13, 9, -6, -9, 10, 2, -5, -26, -10, -6, 1, -1, 0, -13, 4, 10, -11, 6, 22, 10, -8, -2, -4, 9, 5, -2, -26,
+		4, 3, -23, 2, 2, 12, -6, -3, -5, -19, -15, -2, -8, -9, -1, -13, -8, 4, -11, -5, 2, -6, -8, 7, -17, -30, -11, -1, -1, 6, -1, -4,
+		-8, -7, -3, -4, 8, -4, 66, 0, 2, 0, -3, 2, -5, -1, -5, -2, -3, -4, -1, -3, -1, 6, -5, -6, -3, 4, -4, -19, 5, 1, 8, 3,
+		12, -14, 7, -10, -6, 1, -5, 5, 19, -28, -11, 0, 14, 6, 0, -1, 6, -11, -6, 2, -2, 6, -1, 0, -7, -3, -3, 0, 0, -2, 2, 0,
+		-2, 3, -3, 0, 18, -3, 0, -1, 1, -1, -1, 0, -2, -4, -1, 1, -4, -5, 0, -2, -6, -3, -1, 1, -2, 1, 1, 0, -1, -2, 0, -5,
+		-1, 0, 2, -2, -2, -6, -3, 1, 3, -3, -5, -3, -1, 0, -2, -1, -5, 0, -3, -2, -5, -3, 12, 4, 3, 6, 12, -7, 5, 1, -2, -8,
+		-3, 2, 5, -21, 0, 17, -9, -17, 1, 2, 1, -26, -5, 18, -19, 4, -2, 9, 4, -13, -30, -23, 1, 3, -22, 18, -20, 4, 3, 1, -25, -3,
+		-13, -32, 6, -8, -5, 9, -14, -9, -14, -8, -11, 3, -1, -5, 7, -1, 23, -10, -7, 6, -3, -4, 1, 3, -3, -8, -4, -3, -1, 2, -5, -5,
+		1, -6, -2, -1, -8, -3, 1, 0, -1, -1, -5, -2, 1, 1, -1, -5, -1, 1, 2, -38, -8, -14, -8, 2, 4, -10, 23, 0, -8, -6, 3, -13,
+		19, 10, -24, -27, 0, 1, -24, -7, -21, -15, 15, -12, -8, 2, -2, 3, -48, -7, -3, 7, -16, -6, 6, -1, 0, 5, -4, -5, -6, -20, -2, -3,
+		-2, -4, -3, 7, -11, 13, -5, -10, -27, -17, -5, -26, 1, -4, 14, -20, 12, 4, -5, -3, 2, 2, -5, -1, 3, 1, 5, -7, -3, 0, -6, -4,
+		-4, -2, 1, -2, 5, -6, 2, 1, 8, -2, -8, -8, 4, 2, 1, -6, 0, 2, -3, 12, -9, -5, 13, 1, -2, -9, 5, -2, -38, 0, -4, -8,
+		-9, -2, -7, 12, -1, -4, -9, -5, -1, -1, -2, -15, -4, -5, -1, -20, -4, -3, 3, 4, -2, -4, 1, -3, 7, -2, -2, 20, 30, 0, 20, 3,
+		-1, -2, 19, 2, -2, 0, 21, 3, -1, -1, 37, 2, -3, -1, 20, 8, -5, 18, 8, 7, 12, 0, -5, 7, 9, -9, -47, -9, -3, -9, 3, 1,
+		-7, -9, 2, -6, -11, -19, 5, -2, -5, -18, 3, -6, -7, 10, -2, 0, 2, 23, 1, -24, -6, 0, 2, -3, 4, -17, -3, 3, 18, -4, -10, -8,
+		9, 6, -1, 1, -9, -3, -8, -6, 5, -3, -7, -8, -7, -6, -2, 17, -4, -4, 25, 6, -2, 18, -16, 0, -32, 19, -11, 13, 5, -9, 1, 15,
+		2, -5, -24, 3, -12, -7, 13, -19, -8, -3, -4, -37, -13, -2, -24, 12, -4, -28, 4, -8, -19, 12, -6, -51, -20, 3, 34, 9, 3, -6, 20, -9,
+		-11, -7, -20, 7, -12, 6, 4, -5, -1, -4, -15, -10, -9, -3, 1, -2, -17, -7, -1, -6, -1, 0, -16, 14, -10, -7, 3, 7, -5, -20, 17, -4,
+		-10, -44, -1, -11, -31, 29, -2, -10, 2, -16, -1, -2, -13, -1, -1, -2, 0, -2, -5, -3, -1, 73, 33, 2, 21, 3, 0, -1, 21, 3, -1, 0,
+		26, 3, 0, 0, 38, 5, 0, -1, 7, 15, -10, -9, -5, -8, -13, -1, 3, 8, -7, -8, 4, 8, 5, -25, -7, 1, -10, 11, -8, 3, -9, -2,
+		-1, -2, -14, 4, 9, 7, -10, 18, -2, -1, 10, 4, -4, 4, 2, -1, 5, 2, -1, -33, 1, -2, -12, -1, 0, 0, -17, -4, -6, -2, -7, -2,
+		-3, 0, -3, 0, -3, -3, -2, 7, -34, 0, -33, 7, -2, -9, 12, 1, -31, 1, -2, 19, -1, -11, -1, -17, -4, -15, 9, 1, -1, -8, -6, -22,
+		-12, -4, -15, -9, -9, 18, 7, -1, 29, 9, 1, 8, 4, 0, -6, -8, -6, -64, -8, -3, -3, 14, 3, -1, -3, 12, -4, -8, -3, 2, -2, -10,
+		-46, -11, -11, -1, -39, 7, -18, -33, 11, -3, -9, 2, -1, -34, 9, -9, 0, 15, 8, -37, 8, -51, 3, -6, 0, -5, 0, -3, -3, -8, -13, 19,
+		-4, 5, -8, 4, 3, -8, 1, -6, 0, 4, -5, -6, -4, 3, 2, -2, -5, -4, 6, 1, 2, -1, 5, -3, -4, -9, 5, 1, -5, -6, -6, -2,
+		-8, -2, -38, -1, -3, -6, -13, 5, -7, -4, -3, -7, -1, -3, -24, 8, -3, 38, 10, 2, -7, 21, 3, 1, -2, -14, 3, -3, -9, 0, 7, 1,
+		-8, 0, -4, 1, -5, -5, -5, -2, 1, 1, 4, -2, -4, -6, -3, -6, 7, 0, -3, -8, 2, -1, -4, 1, 2, 2, -1, -2, -4, -1, 1, 1
+	},
+	.weight_1_T = {
+		-18, -13, 2, 6, -9, -8, -6, -1, -12, 2, 14, -9, 10, -1, -21, 40, 18, 24, -9, 13, 15, 15, 16, -18, 0, 9, 16, 16, -25, 4, -25, 20,
+		19, -6, -6, 11, -4, -15, 4, 26, 34, -1, -9, 12, -25, -8, 2, -1, 5, -3, -6, 4, 1, 9, -1, 13, -4, -18, 12, 0, 4, -24, 8, 19,
+		5, -7, 2, -20, -18, 27, 0, 7, -17, 14, -16, 2, 13, -16, 24, 17, 1, 21, 23, -4, 4, 26, 2, 20, -7, 7, -17, 17, 10, 16, 9, -3,
+		-70, 16, 25, -10, -6, -17, 25, -18, 6, 5, 2, -6, -67, -28, -6, -12, -2, -3, 3, 0, -3, -22, -11, 19, -5, 20, -8, -11, 27, 20, 20, 16,
+		19, 11, -8, -10, -1, 19, 6, -7, -21, -3, -2, 29, -2, -21, 17, -21, -6, 24, -9, 25, -9, 8, 16, -14, -12, -127, 21, 16, -7, 22, 23, 7,
+		-4, -10, 8, -3, 16, 29, 1, -24, -10, 6, 11, -21, -9, 5, 5, 27, -2, 32, -16, -20, -4, -10, 14, 13, 2, 50, -9, -5, -18, 14, -13, -16,
+		-8, -7, 22, -9, 22, -1, 15, -12, 13, 3, 8, 17, 21, 28, 1, 19, 5, 9, 19, 10, 9, -21, -8, 26, 14, 11, 12, 9, 17, 11, -22, 0,
+		12, 7, 29, -17, -16, -4, 68, -3, 11, 14, 18, 26, 30, 42, 12, -13, 14, -4, 12, 0, 44, -24, -15, -7, -23, 11, 8, 29, -3, 19, 17, -27,
+		-8, -17, 11, 6, 9, -5, -14, -1, -24, 21, 2, -20, 7, 10, -16, -27, 22, -5, -13, 14, 7, -3, -7, 12, 11, 10, 21, -5, -22, 2, 27, -26,
+		8, -9, -3, -7, -23, 14, 8, 31, 22, 3, -6, 18, 2, 40, 2, -10, -1, -12, -4, 0, -2, 14, -18, 5, 2, -19, 11, -16, 0, -26, -1, 14,
+		10, 14, 6, -3, -16, 23, -1, 9, -10, 7, -14, 8, 20, 17, 13, 20, -1, 16, -18, 10, -11, -25, 9, 24, -15, -10, 10, 13, -27, 8, -1, 10,
+		71, 9, 16, -22, -12, -9, 20, -28, 0, 1, 0, -10, 59, 5, -12, 24, -6, -2, -12, -6, -5, -10, -9, -2, -20, 19, 3, -17, -29, -45, 23, 17,
+		2, 18, 6, 4, 0, 2, -6, -5, -3, 3, -2, 25, -15, -16, 3, -22, -17, 26, 35, 5, -19, 0, 21, -13, -20, 115, 24, 10, -4, -16, 18, 0,
+		-10, -7, 2, -12, -15, -8, 4, -28, -20, -32, 1, 10, 8, 3, -3, 18, -2, -9, -19, -27, 13, -2, 24, -8, -3, -18, -2, -1, -17, 1, -20, -6,
+		5, -3, -17, -10, -16, -9, 19, 3, 8, 6, -1, 14, 26, -18, -3, 21, -3, -14, 24, -5, 3, -3, -8, 17, 16, 11, 16, 3, 18, 9, -19, 18,
+		18, 4, 28, 2, -6, -11, -17, -3, -8, 12, 8, 27, 27, -19, 9, -21, 3, -9, -8, -3, -46, 7, -9, 5, 9, 11, 1, 24, -9, 17, 8, -10
+	},
+	.weight_M_1_T = {
+		-85, 31, 89, 66, 50, -45, 6, 73, 20, -100, -67, -98, -95, 67, 42, -92, 21, -61, 50, -8, -65, 89, -50, 23, 29, -35, 6, -51, 85, 22, 16, -89,
+		-16, -1, 6, -67, -63, 31, 62, -74, -92, -40, -33, 67, 37, 18, -79, -51, -56, -95, -81, 36, 22, 91, -42, -55, -31, -86, 5, 65, -95, -58, -96, 16,
+		-27, 72, 83, 89, -21, -30, 29, -1, 61, -100, 57, 25, 63, 49, -62, -5, -88, -56, 37, 19, 47, 98, 64, -29, -33, 64, -6, 68, -100, -68, -83, 6,
+		58, -93, -35, -61, 63, 0, -3, 73, -45, 45, -19, 18, 26, -94, 42, 54, 19, 3, 34, -23, 16, 36, 65, -33, -18, -44, -64, -19, -43, 72, 34, 60,
+		-81, 90, 29, 79, -37, 64, 93, -73, -48, 69, -9, 62, -10, -1, 10, 88, -39, 13, -83, -62, 18, 77, -23, -54, 28, -82, 71, -68, -57, -86, -11, -89,
+		-92, 62, 17, -51, -24, -9, 56, -99, 69, -15, 85, 85, -83, -42, 54, 41, -73, 32, -63, 32, 29, 36, 62, -7, 89, -35, -40, -98, -10, 64, 27, 39,
+		69, -13, -65, -78, -100, 95, 57, -11, -65, -8, -98, -6, -90, 85, 76, 14, 97, -6, 59, 42, 82, -18, -18, -13, -44, -64, -78, -93, -89, -47, -46, 10,
+		-51, 84, -88, 12, -74, -11, 17, -8, -36, -55, 69, -62, 37, 52, -94, -87, -49, -36, -78, 90, -54, -100, 36, 99, 16, 84, -78, 99, -42, -50, -83, 16,
+		-19, 3, 81, -37, -98, 92, 49, 84, 40, -39, -75, -76, 25, -49, 94, -65, 74, -95, 77, 84, -81, 37, 29, 94, 51, 4, -38, 82, -8, -94, -59, -90,
+		13, 24, 4, -94, -89, 96, 69, 0, 28, -26, 19, -5, 27, -61, 20, 43, -17, -38, 34, 5, -56, -32, -40, -21, 90, 85, -66, -91, -56, -58, -38, 64,
+		-17, 85, -12, 3, 98, 71, -89, 35, 60, 19, 37, -1, 27, 52, -49, 33, -17, 60, 82, -92, -21, 76, 1, -20, -3, -57, 98, -2, 61, 85, 73, 21,
+		-81, 33, 68, -52, 45, -91, -28, 7, -88, -80, 99, -82, -96, -25, 60, 92, 16, -43, 35, -87, -8, -95, -10, -71, -49, 17, -39, 79, 71, -17, -50, -66,
+		-33, 94, -66, 8, 58, 26, -76, -59, 5, -2, 49, 21, -62, -35, 85, -94, -43, -68, 21, -77, -70, -58, -44, -100, -9, 24, -85, -72, -58, -84, -32, -6,
+		-68, 17, -60, 41, 10, -1, -42, -71, -68, 18, 81, 91, -2, -72, 56, 76, 21, 2, 63, -20, -97, -32, -26, -66, 86, -52, 68, -66, 43, 77, -4, 13,
+		36, -14, -81, -84, -56, -87, 41, 68, 27, -100, -84, -85, 45, -37, -22, -94, -25, 61, 4, 85, 54, 70, -10, -93, 9, -85, -2, -69, -14, -86, -84, -98,
+		0, -29, 89, 44, -25, 37, -54, -63, -3, -80, -67, -89, -53, 89, 37, -31, 0, -87, 36, -84, -51, -8, -67, 61, -91, -52, 60, -47, 42, -73, 29, -14,
+		-31, -75, -80, -48, 61, -69, 7, 95, -88, 70, -24, 94, -45, 16, -67, 3, -86, 69, 79, -72, 92, 35, 69, -15, -38, 16, -3, 98, 84, -51, -47, 64,
+		50, -38, -30, 65, -81, -81, -62, -16, -18, -70, 30, -98, -29, 97, 46, -26, 73, -96, 96, 12, -27, -5, 85, -39, 5, -2, 81, 94, 87, 86, 17, 29,
+		97, 63, 52, -71, 49, 44, -43, 30, 96, 57, -80, -81, 56, 53, -32, -70, 93, 57, 48, -34, -3, 1, -11, -36, 9, 34, 75, -87, 25, 15, -79, -19,
+		-100, 14, 13, -3, -62, 1, 93, -48, 98, -22, 48, 98, 30, -37, -18, 53, -84, 92, 92, -76, -25, -100, 4, 12, 61, 31, 42, 6, -33, -91, 67, 70,
+		-97, -20, 29, -26, 3, -29, -44, 89, 92, -5, 0, -74, 83, 38, -94, 59, -19, -45, -27, 43, -67, 5, 6, -68, 72, -93, 11, 9, -63, -76, -17, 12,
+		-68, 38, -62, 98, -84, -97, 8, 30, -62, 25, -95, -9, -58, -95, -26, -92, -83, -11, -14, 47, 61, -55, -22, -98, -40, 60, 71, -13, -40, -11, 94, -90,
+		-82, 7, -96, -15, 7, 4, -49, -44, 28, 9, -79, -7, 44, 64, -4, -55, -36, 18, 77, 51, -4, -13, -10, -21, 38, 95, -71, 45, -6, -48, 5, -10,
+		99, 82, -4, -10, -69, -45, -86, -82, -51, -28, -40, -46, 65, 6, 21, -12, 25, 24, 43, 40, -53, 68, 93, 71, 10, 94, -70, 70, 41, 41, -28, -64,
+		98, -24, 39, -88, -92, -21, 20, 94, -33, 88, -47, 15, 11, 57, 43, 19, 91, -52, -5, 31, 80, 50, -48, 29, 65, 16, -97, -38, 11, -81, 67, -43,
+		20, 72, 4, 42, -46, 38, 83, 1, 69, 70, 54, 31, -100, 94, 2, 27, 14, 57, -63, -30, 78, 78, -95, 63, -1, -61, -72, 57, -49, 77, 28, 71,
+		21, -18, -9, 72, 38, 48, 7, -4, -38, 16, 85, -19, -12, -9, -42, -58, 67, 62, -37, -59, -10, 35, -54, 44, -26, -81, -36, -92, 81, -61, 17, -74,
+		54, 29, -52, -21, 22, -66, -97, -79, 34, -20, -98, -3, -84, 79, 71, -84, 30, -56, 23, 5, 17, 40, 46, 79, -10, 92, -49, -99, 54, -88, 30, -5,
+		-78, -46, -8, -60, -60, 25, -33, 7, -42, 88, -87, -29, -2, 1, 57, -22, -77, -10, 93, -92, -90, -42, -51, 95, 65, 67, 53, 30, 96, -49, -97, 47,
+		-73, -100, -97, -92, 76, 35, 65, 52, 41, -59, 60, -94, 75, -67, -13, -7, 31, 57, 4, 32, 71, -56, -89, 47, -82, -28, 13, -80, 30, 17, -62, -78,
+		-69, -96, 77, 87, 26, 98, -82, -39, -76, -46, -58, -6, 98, 69, -70, -30, -27, -96, -40, 41, 99, -39, -25, 25, -46, -64, -83, -37, -73, -63, -75, 62,
+		71, 82, -86, -49, -10, 31, -94, -65, 85, 12, 52, 44, -71, -83, 24, -60, -85, 37, -61, -66, 57, 12, 26, -24, -30, -44, 0, -100, 52, 16, -91, -51,
+		28, 16, -32, -55, -1, -52, -97, -72, -49, 0, -31, 87, -16, 25, -91, -17, -87, -1, 66, -17, -99, -22, 50, -3, 26, 98, 2, -82, -19, -25, 71, 5,
+		-100, -26, -48, 35, 38, 82, 0, -95, -58, -100, 24, -75, -98, -25, -30, -96, 35, -84, -56, 38, -88, 57, 62, -9, 74, 83, -50, -55, 98, 84, -35, 93,
+		62, 79, 96, 65, -8, 38, -16, -90, 14, -57, -21, -26, 48, 70, 80, -15, 58, -62, 29, -80, 16, 40, 81, 40, 12, 61, -26, 23, 72, -96, 12, 24,
+		-95, 44, 86, -11, 31, -81, -54, 16, -26, -51, -33, 45, 12, 95, -3, -5, 38, 45, -19, -28, 62, -94, 17, -94, -48, -23, 9, -6, -40, 48, -63, -90,
+		-30, 11, 73, -18, 58, 1, -11, -20, 85, 71, -47, 82, -37, 66, -42, 28, 66, -19, 84, 69, 16, 48, 59, -39, -34, -59, 49, -49, -82, 63, -45, 18,
+		-16, 50, -33, 16, 73, -41, -88, 48, 84, 17, 28, -17, 91, 24, -59, -22, -35, 19, 62, -87, -57, 13, -87, 43, -13, -75, -65, -4, 94, 95, -44, 26,
+		-38, 14, 77, 51, 94, 37, 34, -34, -22, 43, 45, 51, 91, -74, -69, 97, 6, 59, 25, -48, 47, 11, 63, 49, 0, -17, -39, -95, 52, 19, 72, 90,
+		-58, -62, 18, 14, -48, -5, 85, 20, 53, 86, -64, -27, -67, 62, 75, 37, 65, 70, -20, -72, 22, -28, 30, 23, -3, 81, -45, -87, -63, -41, -95, 32,
+		89, 13, 17, -28, -77, -87, -9, -54, 43, 67, -66, 61, 93, 59, -87, -58, -67, -70, -18, -86, -11, 79, -43, 22, -49, -50, -13, -31, 37, 31, -86, 81,
+		76, 34, 54, 75, -67, 20, -71, 31, 3, 79, 12, 22, -1, 13, 64, -14, 24, 57, 18, 46, -45, 48, 19, 52, -9, -88, -90, 39, 30, 47, -16, 1,
+		5, -47, -42, -44, -1, 73, 65, 48, 30, 13, 2, 41, -21, -89, 47, -24, -9, 1, -43, -19, -22, 98, 84, 54, 78, 37, -5, -83, -6, -98, 66, 62,
+		51, 47, -50, -65, -55, 73, 54, 81, -6, 49, 33, 30, -86, 57, -52, -66, 49, 99, 52, 91, 93, 46, 27, 47, 56, 52, -30, -9, -96, 54, 80, -65,
+		90, -59, -62, 67, 95, -27, 8, -14, 2, 23, -45, -47, 33, 95, -92, 9, -97, 1, -25, -97, -72, 70, 43, -48, -36, -49, -30, -67, 78, 0, 16, 87,
+		-27, 45, 83, -16, -60, 81, -25, -68, -81, -57, 54, 87, -39, 44, -84, 1, 74, 97, 54, -30, -55, -41, 12, 2, 34, 9, -80, -88, -64, -55, 59, 90,
+		-8, 44, 82, 56, 73, 66, 1, 89, -31, 23, -33, 77, -87, -49, 98, -56, -67, 82, -55, -87, -61, 17, 40, 31, -77, -95, -96, -85, 87, -33, -63, -58,
+		-52, -12, 54, 94, 7, -6, 13, -11, 24, 8, -26, -29, -27, -45, -43, 62, -40, 70, 20, 31, 5, -43, -39, 53, -23, -6, 79, 5, -18, 91, 35, -28,
+		76, 8, 22, -37, 8, -95, 54, 67, -83, 13, 86, 11, 78, -12, 44, 25, 26, -88, 85, 99, 85, -47, -76, -76, -19, 17, -70, -47, -98, -96, -53, 31,
+		28, -30, 65, 40, 70, 90, 50, 23, -18, -52, -31, 1, -30, 37, 92, 67, 59, -79, 47, 15, 28, 80, -100, 95, -43, 3, 3, 30, 74, 5, -11, 96,
+		88, 76, -43, 69, -30, -72, 98, 40, 73, 21, 98, -58, -84, -80, -24, -62, 88, -38, -3, 57, -99, 62, 27, -7, 12, -5, 79, -100, 80, -1, 4, -91,
+		-55, 49, -42, 97, -81, 44, -14, -27, 32, 4, 46, 72, -87, -51, 53, -60, -2, 50, 99, 18, 60, 46, -90, -85, 20, -3, 34, 85, -33, -16, 66, 4,
+		31, -3, -71, 76, 74, 87, 96, -80, -79, -60, 11, -9, 63, 43, 59, -13, -84, -44, -92, -28, 67, -93, -90, -59, -73, -62, -52, 80, -59, -8, 55, -61,
+		49, 87, 36, -96, 85, -66, -78, 73, 64, 65, 96, -8, -33, -54, -73, -83, 20, -52, 88, -58, -32, 43, 46, -35, -33, -7, -57, -94, 48, 76, 26, -19,
+		58, 12, 52, -29, 17, 52, -31, -57, -65, -70, 35, -25, 66, 56, -37, -60, 40, 69, 95, 40, 52, -40, 94, -87, 72, -78, -62, -52, -3, 85, -13, -28,
+		83, 7, -91, 3, 72, -4, -6, 41, 83, -54, -39, 94, 48, 90, -79, 75, 28, 19, -82, 21, 0, -76, -17, 59, -24, 99, 54, -65, -7, 91, -15, 89,
+		22, 91, -54, -16, -19, 38, 9, 68, 40, -28, -66, -58, 84, -29, -81, -91, 78, -66, 11, 38, 66, -64, 9, -21, 83, 17, -89, 22, -15, 15, 61, -92,
+		1, -40, -75, 82, 40, -44, -42, 38, 72, -18, -73, -48, 3, 71, -93, 42, 68, -55, -69, -85, 9, -45, 19, 14, -33, -31, 97, -88, -7, 99, 33, 42,
+		-57, -53, -64, -32, 63, -19, 88, -32, 28, 11, 98, -6, -21, 82, -35, 83, -45, 5, 81, 98, -38, -92, 42, 65, 39, -97, -93, -35, 61, 0, -37, -1,
+		79, -12, -80, -85, 10, 39, -90, 59, -69, -90, -97, -11, -60, 41, -57, 32, -38, 22, -37, -61, -55, 20, 81, 34, -90, -61, -2, -15, -1, -16, -86, 43,
+		-10, -89, -64, 97, -84, 61, -93, -44, 38, 8, 89, -53, 18, -34, 32, 89, 91, -64, -94, -54, -89, -94, -32, -56, -40, 49, -23, -41, 94, 58, 81, -81,
+		-47, -34, -87, -78, 77, -21, 98, -80, 11, 20, 6, 63, 17, 92, -21, 15, 50, -94, -67, -72, -91, 18, -63, 19, -17, 68, 9, -80, 35, -96, -86, -92,
+		-64, 45, -22, -11, 32, 60, 98, 5, -80, -27, 44, 40, 72, 38, -11, -33, -13, 69, 80, -76, 40, -38, 21, 73, 79, -88, 64, 85, 82, -73, 24, 86,
+		-11, -50, 1, -60, 71, 64, 40, -57, -30, 98, 83, -53, 70, -63, 22, 27, 49, -56, 49, -74, -82, -46, -4, -2, 7, 18, -29, -12, 51, -16, -64, 64,
+		88, -84, -31, -77, 89, 35, -76, 33, 99, 70, 85, -68, 84, 0, 44, -64, 0, -48, 87, -49, -26, -59, -22, -61, -73, -44, 54, 3, 74, -44, 27, 79,
+		-54, 60, -42, 94, 87, 23, -84, 10, -98, 34, 59, 81, 28, 10, -94, 7, -94, 50, 55, -41, -97, 37, 86, -85, 58, 36, 73, -65, -72, -10, 34, 64,
+		-91, 55, -95, 55, -6, 7, 85, -30, -15, -16, 38, 60, -91, 52, -29, 41, 38, -3, 10, -52, 56, -98, 40, 47, -10, -26, 29, 85, 94, -51, 7, 72,
+		77, -22, 50, 62, -73, 34, 62, -89, -87, 62, 87, 15, 10, 59, -60, 8, -100, -73, -49, 3, 43, 10, -67, -73, -8, 39, 39, 61, 15, -60, -79, -34,
+		-26, -99, -68, 79, 18, -42, -91, 51, -36, -37, 54, -7, -94, -78, -32, -65, 9, 64, -22, 62, -44, -47, 32, 50, -30, 42, -43, -24, 54, -93, -4, 5,
+		18, -11, 87, -85, -56, -5, -1, 50, -37, -23, -53, -33, -41, 50, 27, 41, -92, 10, 51, -58, -76, -57, 79, -45, -97, -58, -72, -51, -63, -47, -77, -95,
+		4, -100, 34, 77, -59, -59, -40, 54, 49, 9, -27, -17, 23, 61, -35, 14, 68, -9, -73, 52, -48, 77, 9, 57, -16, 81, -97, 41, -100, 78, 26, -89,
+		22, 94, -25, 38, -56, -39, -42, -34, 28, -37, -66, -23, 91, -25, 94, -87, -34, 8, 31, 87, 82, -23, 37, 88, -53, -16, -19, -46, -3, 45, -22, 7,
+		7, -25, -88, -19, 5, -49, 78, -25, 12, 0, 94, -38, -74, 89, 15, -16, 32, 69, -47, 72, -87, -11, 19, 57, -7, 62, -97, -68, 0, 39, 14, 44,
+		-71, -12, -95, -15, -47, 40, -73, -19, 13, -8, 86, -75, 8, 60, 34, -20, 96, -29, -27, -30, 58, 47, -35, 88, -10, 77, -61, 44, -63, -63, -43, -82,
+		83, 36, 20, 8, 32, -39, -12, 45, 14, 4, -20, 12, 37, 47, 31, 65, -16, 45, 96, 70, -42, -84, 38, 8, -5, -57, -46, -71, -24, -30, 17, -65,
+		53, 31, 55, 36, 92, -97, 37, -100, -63, -69, -89, 8, -39, -29, 50, 23, 73, -13, -12, -31, 29, -35, 42, -6, 55, 5, -6, 10, 55, -52, -98, -11,
+		-18, 63, 57, 60, 27, -23, 80, -82, 49, -86, -8, -22, -22, -64, -58, 2, -53, 84, 34, -8, 22, 84, -20, -46, 3, 11, 35, -58, -34, 74, -5, -69,
+		63, 58, -71, -31, -25, -65, 53, -78, -77, 23, -69, 29, -95, 93, 93, -14, -92, 12, 19, 28, -47, -40, -31, -30, 49, -100, 3, -4, 57, -50, 14, 34,
+		98, 28, 65, 24, -14, 7, -46, 33, -46, 15, -17, -69, 33, 39, -8, 13, -11, 69, 60, -57, 82, -71, -46, -83, -94, 51, 41, 78, 17, -42, -93, -65,
+		-25, -10, -15, 87, -30, 50, -57, 49, 39, -6, 88, -98, 18, -57, 46, 55, -5, -43, -10, -21, 75, 65, 36, -80, -18, -36, 62, -5, -24, 89, 25, 84,
+		41, -29, -67, -96, 38, -38, -23, 69, -93, -47, -99, 0, -55, -20, -93, 26, -6, 47, -34, -27, -96, -90, 29, 21, -83, -95, -20, 10, -51, -85, 49, -69,
+		23, 63, -29, 24, -88, -21, 1, 93, 49, 24, 7, -34, 77, 17, -32, 98, 82, -48, -62, 77, 96, 36, -75, 84, -99, 30, -60, 26, -62, -98, -14, -76,
+		8, 30, -27, -59, 59, -20, 51, 45, 15, -91, -10, -56, -66, -49, 47, -100, 71, -12, -74, -57, 50, -24, -40, -19, -61, 71, -78, 30, 30, -42, -81, -87,
+		-10, 46, 84, -64, -43, 91, -59, -13, 75, -33, -82, -52, -84, -2, 55, -27, 94, -52, -6, -51, -42, -37, 39, 17, -64, -82, 20, 4, -68, -23, 55, 95,
+		-46, -67, -95, -39, -89, 61, 98, 34, 34, 97, 14, -50, -39, 9, 74, 74, 2, 43, -2, -23, -62, 48, -9, -69, -12, -38, 32, -83, 79, 28, 64, -10,
+		-74, 50, 95, 10, 4, 79, 27, -69, 22, 49, 31, -59, 75, 32, -11, -43, 22, 94, 75, -1, -91, 96, 1, -2, 8, -57, 10, -70, 61, 73, -91, -29,
+		56, 27, -82, -10, -29, -57, -15, 69, 53, 79, -85, -87, -4, 89, -40, 34, 77, 43, 43, -22, -42, -6, -71, 43, 36, -34, 14, 44, 51, 54, 14, -95,
+		-54, -6, 1, 5, -45, -46, 86, -10, 5, -92, -37, -51, -28, -81, -7, -67, -31, -41, -91, -12, -42, -40, 6, -17, 78, 23, 50, 7, 71, 57, 83, -7,
+		-29, 39, 19, -49, -80, 47, 78, -11, -82, -63, -17, 62, 12, -66, -5, -16, 47, -15, -48, -5, -49, -78, -79, -11, 19, 73, 7, 35, -42, 17, -57, 20,
+		26, 33, 37, -39, 39, 20, 2, 55, -85, -86, -94, 82, -11, 16, -64, 94, 29, 38, 25, 54, 37, 13, 81, 61, -5, 67, 13, -27, 38, -45, 80, 84,
+		29, -93, 76, -37, -4, 72, -24, 75, -79, -89, 7, -27, -19, 91, -65, -21, -75, 51, -81, -100, 12, -30, -88, 74, -22, -6, 71, 51, 35, -38, 1, -14,
+		30, -28, -20, -40, 43, 44, 37, 28, 32, -97, -30, 9, -93, -65, 22, 81, 55, -18, 21, 43, 82, 45, 62, -2, -75, 27, -33, -37, 27, 90, -4, -25,
+		-97, 77, -75, 34, 87, 62, -73, -31, 61, -96, 88, -32, -24, 59, 75, -17, 51, 91, -28, -66, -33, 32, 82, 69, 93, 15, 24, 12, -39, 37, 48, -70,
+		31, -85, -34, 69, -36, 13, 62, -73, 74, 98, 64, -91, -96, -12, -47, -76, -77, -56, -21, -82, 79, 21, -32, 78, 31, -47, 46, -60, -51, -73, 73, -95,
+		-20, 1, -92, -24, -66, 97, -68, 13, 95, -48, -3, -92, 14, 47, -30, -65, 88, 96, -27, -82, -75, 65, -27, -17, -76, -57, 25, -8, 15, -54, 1, 46,
+		52, -13, 3, 44, 22, -49, -28, -83, 34, 97, -29, 4, -98, 72, -39, -33, -2, -85, -8, 89, -19, -13, -17, -38, 72, 32, 31, 16, -50, 29, -23, 78,
+		66, 65, 30, -83, -6, 54, -16, 72, -6, -25, -43, 51, 70, 95, 25, 82, 85, -79, -99, 76, 84, 29, -83, -99, 18, 1, -66, -3, -73, -16, 65, 49,
+		-59, 17, 47, 58, 86, 15, 54, 48, 92, 35, 54, 87, -36, -47, 45, -52, -19, -75, -70, -39, -86, -56, 85, -63, -47, 89, -31, -12, 10, -66, 60, 7,
+		48, 83, 3, 32, 45, -49, 18, -42, -73, 43, 75, 29, -89, 43, 17, -31, 72, -14, -64, -13, -60, -80, -97, 93, -34, 78, -22, -53, 3, 86, 7, -41,
+		48, -30, -8, 17, 22, -60, -8, 43, 2, -27, 90, 63, 21, -94, 12, -41, 24, -80, 85, 72, -26, 66, -41, 17, 74, 66, 84, -69, 17, -40, -58, 11,
+		40, 46, 18, -49, -31, -82, -59, -39, 69, -60, -65, -59, 42, 20, -6, -51, -66, -88, 29, -57, -24, -8, -30, -91, -95, 24, -28, -1, 82, 61, -45, 71,
+		12, -83, -75, -24, 86, -97, 63, -48, 51, -2, -37, -79, -83, -85, -28, -14, -43, -62, -19, 77, 60, 14, 28, -6, 94, 71, -94, 77, -91, -2, -91, 70,
+		-27, -97, -76, -40, -90, -58, 98, 21, -43, 10, 70, 48, 22, 35, 5, 31, -80, -87, -62, 35, -46, -44, -10, -66, -81, 18, -55, -66, 60, -41, -64, 22,
+		-22, -90, -95, 63, 5, -67, -93, 31, 48, 80, -66, 44, 28, -94, 20, 7, -29, -93, -89, -19, 22, 10, 19, -89, -45, 88, 87, -14, 24, 77, 95, 77,
+		63, 95, 0, -35, -42, 54, 62, 40, -90, -29, 2, -2, -80, -41, 68, 83, -10, -4, 51, 75, -26, -22, -53, -13, -8, -80, 32, 7, -83, 7, -73, -73,
+		-18, -41, 13, 94, 51, -42, -20, 45, 15, 97, -36, -91, 7, 71, 96, 75, 4, -30, 65, 68, -27, 47, -17, 1, 31, 68, 91, 39, 21, -18, -32, -32,
+		97, 9, 76, 55, 94, 48, 89, -92, 77, -27, -50, 25, 12, -69, 93, -80, -47, -41, -58, 64, -10, 90, 50, 14, 69, -55, 0, 88, 54, 28, -71, 43,
+		-68, -53, 4, -65, 23, 46, 0, 48, 67, -97, -24, 41, -29, 26, -37, 30, -39, -6, -17, -33, -48, 58, 89, 82, 86, -22, 27, 54, 0, -73, 66, -31,
+		-25, -18, -43, -33, 25, -5, 19, -79, -82, -88, -94, -88, 1, 82, 53, 94, 81, -95, 72, -6, -18, -100, -6, 50, -82, -22, -92, -17, 94, -31, -31, -65,
+		47, 19, 19, -89, 27, -56, -53, 31, -5, 71, -16, -67, -62, -74, -33, 76, 82, -60, -31, -85, 10, -91, -63, -17, 61, 46, 62, 28, -12, 57, 69, 21,
+		99, -3, -73, -87, -1, 3, 68, -25, -17, 47, 91, 79, -65, -64, -13, 99, -2, -59, 23, -67, -71, -67, -21, -21, 56, -35, -23, 42, -100, -56, 22, 89,
+		-97, -70, 39, -93, -4, -6, 92, 21, -67, 49, 70, 54, -38, 68, 18, 71, -39, -58, 90, 66, -71, -27, 75, 39, -66, 69, 2, -70, -46, 57, -52, -53,
+		-9, 21, -49, -11, -69, 49, -65, 57, -92, 70, 51, -79, -20, -68, -6, 64, 52, -44, -18, 46, -58, -41, -2, 17, 5, -31, 69, 83, 34, -79, -96, 41,
+		-93, -87, -77, 9, 86, 80, -91, -98, 96, -79, 12, 47, 94, 29, 51, -52, 48, -41, -34, -85, 73, -73, -29, -97, 56, -2, 3, -33, 80, -65, 69, -63,
+		79, -35, 32, -32, -40, 38, -12, -45, 95, 10, 23, 98, 83, 52, -28, -79, 50, -93, 2, -17, 26, 67, -28, -37, 22, -40, 5, 6, 91, -55, -41, -89,
+		71, 82, 65, -4, 94, 28, 46, -54, -9, 8, 88, -58, -41, -67, 7, -89, 48, -91, 60, 92, -63, 61, -43, -52, 92, 55, 96, -44, -4, 87, 86, -28,
+		51, 79, 80, 10, 8, -56, -29, -8, -73, 52, -8, 42, 89, 48, 92, 55, 98, 46, -82, -38, 53, -46, -81, 38, 48, 21, -22, 91, 34, -31, -2, 15,
+		-32, -82, -47, 25, -37, -7, 79, -73, -44, -6, 17, 76, 0, -43, -63, -75, 41, 14, -85, 79, 33, -58, 11, 1, -24, 19, -1, -63, -14, 35, 10, 21,
+		89, 48, 85, -64, -90, 31, 64, 31, -41, -92, 18, -49, -88, 91, -57, 34, 49, 20, -48, -19, -21, -48, 6, -95, -44, -92, 77, 56, -84, 57, 88, -44,
+		73, 60, 63, 79, 59, 16, 54, -36, -53, -34, -91, -64, 83, -95, 8, 8, -32, -81, 65, -22, 9, -16, -97, 32, -78, 33, -58, -72, -92, -52, 83, -91,
+		37, 58, -48, -13, 3, 13, -6, -76, 32, -63, -21, 68, -52, 51, 16, 14, 40, 75, 81, -29, -41, -98, -95, 37, -20, -54, 2, -64, -88, -13, 45, -30,
+		-80, 71, -86, 14, 72, 76, 83, 13, -69, 47, -36, -45, 15, -39, -55, -47, 37, -26, -93, 75, -61, -68, -14, -30, -99, 28, -44, -26, -44, 32, -29, 84,
+		-92, 86, -47, -53, 6, 41, 8, -61, 2, -98, 35, -41, 65, 12, -57, 58, 57, -46, 7, -60, -14, 69, 96, -57, 82, -60, -63, 42, 70, -32, 65, 10,
+		12, -83, -91, 34, -56, 21, -9, 69, -44, 94, -34, -51, 50, -93, -27, -66, -47, -21, 68, 10, -69, 61, 18, 99, 2, -4, 42, 51, -96, -6, -27, 46,
+		-44, 14, 23, 34, -84, -14, -82, 32, 61, -32, 17, -49, -18, -60, -48, -100, -52, -69, 99, 55, 11, -57, -75, -10, -79, 39, 33, 69, -57, 13, -53, -31,
+		62, 60, -35, 10, -20, 90, -95, -18, -23, 62, -22, -53, 45, -98, 91, 21, -48, 58, 51, -62, -93, 76, 15, 90, 25, 12, -36, -67, 93, -90, -63, -57,
+		-97, -24, -65, -5, 83, -36, 69, 64, 91, 37, -74, -14, 86, 47, -19, 17, 13, 70, 17, -13, 70, -23, -77, 51, 17, -8, 79, -30, -53, -60, -80, 3,
+		96, 15, 54, -25, -16, -27, -58, -99, -88, 73, 9, 11, 25, 63, -14, -38, -29, 41, 56, -54, 16, 7, -82, -58, -80, 45, 61, -9, -52, 99, -24, 64,
+		37, 91, 22, -44, -79, -5, -32, 71, -21, 45, -7, -46, 0, 47, -10, -30, -45, 64, 11, 96, 98, 49, -23, -63, 71, -4, 0, 57, -20, 68, -17, 60,
+		86, 17, -8, -94, -86, -21, 67, -59, -53, 32, -4, 81, -73, 92, 10, 42, -9, -94, 75, -9, -50, 3, -18, -17, 68, -40, 8, 56, -32, -27, -30, -65,
+		-68, 60, -27, -42, 54, -5, -91, 21, 11, -59, 23, -8, 0, 26, -52, 9, 24, -18, 1, 7, 52, 45, 86, 39, -69, -64, -87, -40, -87, -26, -68, -66,
+		-38, -97, 45, 72, -52, 62, 75, 41, -33, 85, 2, -70, -65, 66, 65, -19, -11, 23, -13, -37, 41, 91, -62, 49, -86, -8, 96, 44, -43, -40, 3, 91,
+		-34, -91, -23, 48, -2, -10, 54, 40, -6, 87, -72, 79, 18, 32, 70, -56, -48, 27, 34, -54, 7, -94, -63, -85, 71, 94, 29, -48, 46, 82, 23, 13,
+		-39, -54, -24, 12, -15, 61, 77, -25, 99, -31, 28, -10, 56, -43, -22, -91, 1, -48, -66, 51, 96, 25, 40, -10, 9, 86, -34, -3, 67, 55, -47, -13,
+		-24, -47, -7, 24, -71, 24, -39, -40, 83, -100, -81, -29, 21, 88, 19, -31, -95, 89, 45, 0, -15, -30, 59, 96, 79, 97, -47, 34, 91, 96, 26, 14,
+		-25, -19, 89, -54, 16, 70, -69, -80, 60, 13, -56, 38, 69, 68, 10, -60, 16, -25, -12, -48, -69, 96, 74, 40, 47, 94, -10, -51, 57, 50, -43, -8,
+		12, -66, 8, 93, -54, 32, -13, -74, -54, 85, 67, 62, 15, 67, 88, 7, -97, 80, -77, -60, -75, -98, -79, 74, 28, 78, -56, -66, -47, 64, 7, -30,
+		-80, -8, 63, 39, -95, -98, 71, -63, -1, 88, 16, 1, 78, -35, 99, -95, -55, -60, 39, 8, -74, 75, -6, -11, 8, 23, -39, -80, 54, 97, 18, 4,
+		78, -74, 28, -6, 81, -70, -51, 2, -27, -34, 76, -57, 68, -74, 42, -70, 63, -4, 13, -76, -63, -61, -28, -69, 92, 26, 19, 21, -78, 49, -33, -96,
+		86, 90, 43, -34, -94, -60, -48, 84, 69, -32, -22, 39, 69, 49, 71, -51, -44, -12, -6, -47, -92, 25, -33, -53, 14, -11, 54, 27, 34, 24, -55, -58,
+		28, -76, -62, -7, -52, 73, -25, 35, -51, -66, 23, 14, 33, -43, -80, 26, -93, -49, 58, 95, -86, 0, -89, 10, 8, -98, -83, 10, 9, -31, 66, 11,
+		52, -54, 23, 89, -32, 1, 66, 79, 77, 75, 10, -47, 42, 91, -24, -75, -72, 97, -75, -49, -92, -34, -88, -43, 98, 45, 96, -42, -61, 35, -65, -81,
+		-40, -49, 55, 59, 12, 81, -70, -38, -67, 25, -21, 66, -12, 21, 41, -48, -11, -31, 59, 86, -82, 53, 61, 79, 51, 64, 35, -45, 95, 52, 19, -87,
+		-8, 26, -50, -3, 34, 44, -53, -3, -87, 22, -17, -29, 15, -98, 67, -11, -7, -42, 51, -99, 67, -95, 88, -25, 90, -62, -32, -9, -2, -100, -8, 11,
+		-69, -90, -52, 90, -71, 43, -11, -82, -53, -85, -8, 89, -66, -12, -6, -46, 33, 88, -90, 21, -25, 22, 48, -14, -5, 20, 98, 30, 53, 96, -67, 66,
+		56, -47, 98, -91, 96, -11, -30, -7, 68, 56, -63, 4, -34, -25, -67, -77, 78, -16, -74, -3, 53, -40, 12, 48, 73, 35, 85, -59, -35, 27, -17, 63,
+		21, -43, 8, 51, -46, -84, 22, 55, -6, -52, 38, 34, -56, -18, -84, -70, -66, -27, 6, -81, 39, -88, 95, 60, -78, 60, 24, -6, 81, 90, 83, -56,
+		11, 85, 15, 69, 57, -66, 12, -46, -97, -45, 82, -49, -78, 95, 63, 55, -19, -40, -43, 74, 43, -73, -61, 57, -60, 75, -74, -58, -91, 11, -58, 80,
+		53, -21, -25, -99, -60, 36, -48, 86, 57, -46, -81, -21, -49, 27, -19, 86, -72, 16, 63, 76, -60, -10, 86, 58, -59, 3, -24, -2, -28, -50, 35, -12,
+		74, -57, -35, 30, 61, 23, -98, 98, 90, 28, -26, 47, -21, -7, 38, -24, -24, 84, -78, -58, -60, -16, 2, 7, -26, 46, 62, -85, -100, 25, 70, 59,
+		-9, 28, 46, 25, 22, 48, 22, -66, -49, -15, -87, -87, 85, 93, -73, 0, -61, 70, 7, -71, -84, -77, -75, -84, 1, 15, -50, 85, -97, -65, -47, 96,
+		41, 69, -19, -49, 17, 56, -51, -87, 7, 45, -81, 85, -3, -19, 0, -42, 24, -29, 25, 52, 44, -100, -61, 5, 11, 75, 50, 6, 36, 17, -9, -84,
+		-11, -49, -71, 39, -14, 98, -100, 13, -100, -63, 71, 62, -47, 67, -90, -73, -18, 46, -53, 82, 70, -90, 93, 35, -86, -79, 33, -81, -38, -55, -48, 73,
+		32, -14, -98, 19, -19, 10, -62, 83, 71, 78, -28, -100, 72, -79, -91, 72, -48, 24, 63, 9, 72, 16, -62, -41, -32, -39, 95, -9, 38, -53, -69, -70,
+		-23, -52, 73, -67, -13, -22, 75, -41, -78, -93, -84, -30, 45, 99, 6, 32, -46, 1, -82, -1, 15, -73, 98, -18, -81, -94, -75, -79, -45, 10, 51, -36,
+		81, -77, -16, 37, -62, -87, -42, -55, 35, 53, -6, 30, -77, 16, 55, 3, -49, 6, -50, 58, -74, 24, 19, -58, 16, -31, 83, 13, -76, 18, -2, -39,
+		57, -48, 75, 10, 83, 30, -73, -36, -22, 54, 93, 68, -49, 65, 80, 22, -51, 66, -23, 17, -34, 36, -37, 15, 37, 44, -70, 29, -34, 78, 93, 93,
+		63, 32, -92, -46, -45, -87, 96, -93, 23, -92, -95, 22, -73, 1, -70, 75, -13, -10, 18, -2, 69, -40, -81, -96, 4, 35, -37, -49, -11, 45, -66, -90,
+		35, 63, -90, -98, -68, 26, -78, 89, -67, -52, 14, 89, 65, -47, -51, -10, 4, 11, -60, -9, -44, -59, -56, 63, 23, 92, -22, -49, 32, -79, -65, 77,
+		51, -85, -58, 89, -38, 63, -24, -32, -58, -26, -2, 43, 44, 20, -81, 11, 19, -26, 90, -53, -53, 7, -27, -41, -87, -21, 50, 71, 49, -19, 58, 42,
+		88, 16, 80, 44, 8, -94, -58, -83, -96, -52, 26, 89, 28, 72, -59, -39, 52, 36, 97, 43, 8, 97, -51, -76, 96, 31, 2, 13, 61, 70, -40, 96,
+		-43, 82, -77, -97, -38, -30, -15, 68, 76, 82, -21, 14, -73, 35, -19, 28, -49, -48, 23, -72, 45, -80, -40, -68, 78, 58, -59, -51, 5, -10, -88, 6,
+		-93, -59, 2, -41, -30, 2, -99, 6, -62, -57, -13, -84, 13, -100, 72, 28, -83, 54, -28, -98, -100, -65, -44, -16, 19, -33, 26, 7, 38, -21, 87, 58,
+		45, -86, -42, 74, -10, -92, 42, 37, -17, 96, -3, 82, -52, 1, -57, 83, 42, 78, 97, -74, -59, -6, 22, -21, -59, -16, 40, 9, 77, 65, 37, 75,
+		-27, 76, -72, -53, -63, 55, 20, -95, -37, 18, 22, 42, -52, 32, -76, -10, 50, 46, -45, 20, 57, 33, 40, 19, 92, 73, -58, 69, 96, 73, -10, 78,
+		95, -10, -91, -98, -31, 42, 40, 95, -36, -69, 21, -16, 39, 24, -44, -6, -78, -98, 13, -67, 85, -99, 55, 79, 98, -59, 93, -5, 6, -58, 3, -94,
+		-10, 78, -46, -77, -65, -3, 86, -41, 25, 1, -97, -9, -23, -40, 43, 6, 75, -47, -89, 33, -87, 98, 17, -75, 31, -23, 87, -1, 67, 32, -6, 60,
+		32, -37, 4, -15, -41, 41, 27, -22, -52, 51, 25, -8, -99, 0, 35, -82, 11, -81, 1, -54, -29, 79, 81, 76, -28, -95, -67, 63, -34, -46, 39, 29,
+		-78, -95, 50, 68, 34, -47, 81, -58, -6, 87, -67, -88, 83, 89, 39, -21, 39, -1, -5, 58, 84, 91, 91, 56, 1, -44, -56, -23, -54, 74, -4, 26,
+		74, 47, 41, 27, -14, -72, -62, -44, -74, 33, 29, -2, -35, 48, 58, 46, 53, 37, -47, -8, -61, 36, -77, -5, -85, 56, 77, -6, 65, 41, -98, 89,
+		8, -45, 43, 12, -58, 25, -75, 4, 62, 36, 51, 89, -28, 61, 85, 54, 73, -58, -10, -6, 74, 30, -53, 20, 1, 86, -83, 7, 33, 6, 99, 78,
+		-17, 78, 18, 52, -9, -25, 4, -71, 65, 92, 49, -74, -10, 34, -41, -30, -37, -98, -99, -92, 54, -59, 32, -11, 35, 99, -34, -43, 40, -71, -49, 27,
+		-77, 80, -96, -29, -96, 90, 9, -86, -41, 4, 20, 26, 64, 75, 38, -21, -6, 65, 89, -18, 13, 28, -89, -98, -3, -8, -16, 66, 24, 66, 64, 40,
+		75, -65, -1, 45, 51, -20, -93, -48, 27, -36, -45, -90, 79, 32, 46, -14, 20, 30, 97, -92, -6, -96, -2, 52, -86, -48, 55, -59, -21, -28, 90, -81,
+		-28, -84, 3, -12, -13, -67, -32, 86, 73, 7, -89, 40, -24, 10, -17, -57, 64, -2, -59, -18, 64, 71, 49, -24, 54, -11, 76, -81, 28, -57, -36, -25,
+		17, 18, 93, 16, -35, -94, -41, 57, 37, -72, 31, -73, -54, 70, -30, -73, -80, -5, -45, -32, -26, 29, 97, 67, 1, -39, 46, -2, -39, 12, 80, 34,
+		-95, 16, 50, 67, 13, -93, 94, -41, -64, -18, 48, 85, -33, 76, -61, 17, -1, 14, -40, -62, 94, 0, 75, -73, 61, -13, -92, 85, 35, -82, 57, -28,
+		-30, 50, -88, -40, -42, -20, -38, -45, -26, -31, -23, 70, 34, 88, 24, -19, -37, 41, -59, 95, 39, -20, -90, 58, 65, -100, 12, 82, -28, -3, 28, -41,
+		45, -74, -79, 71, 37, 47, -82, 30, -6, 41, -20, -74, -38, -25, 39, -74, -98, -22, 37, -8, -56, -56, 22, -55, -68, -99, 93, 99, 0, -34, 56, 39,
+		-42, -6, 97, -85, -52, -98, -25, -85, -73, 63, -4, -29, -23, -69, 74, -24, -19, -37, -27, -7, -97, -31, -48, -68, -89, 40, 67, 11, -73, 52, 13, 39,
+		86, -87, 96, -47, 27, -65, -63, -25, -58, 34, -45, 44, 66, 26, 78, -24, -45, -95, 92, -75, 97, -79, -50, -8, 40, -77, -55, -78, 31, -58, -34, 7,
+		-31, -15, -61, 19, -61, -44, 42, -22, -61, -6, 50, -85, 44, -21, 71, 10, -78, 31, 93, -71, -11, -56, 25, -69, -51, 3, 54, -81, 54, 12, 47, 60,
+		53, 43, 37, 29, 82, -62, -82, 13, -44, 0, -76, 62, 75, 94, -63, -30, 83, -21, 84, 54, -88, -21, -88, -45, -19, -78, 41, -30, 70, 99, -39, 39,
+		-77, -6, -70, -5, 27, -50, 28, 55, -37, -33, -47, 44, 12, -96, 48, -95, -40, -40, 12, -75, -89, -20, -12, -25, 77, -4, -90, -17, -36, 47, -99, 13,
+		73, -20, 77, 36, -99, -49, 89, 43, -95, 52, 34, -34, 20, 75, 59, 85, 14, 51, 36, -88, 44, -27, 18, -13, 91, 15, 20, 61, 97, 7, -6, -77,
+		-15, 19, 22, 74, 88, -99, 0, -35, -53, 77, -5, 22, 92, 49, 81, -35, 11, -58, 88, -8, -74, -1, 48, 72, 48, 90, 76, 49, 63, 3, -73, -5,
+		67, 57, 2, 29, -58, -6, 70, -39, -14, -13, 84, 7, 70, -62, 85, 95, -42, -42, 45, -95, -50, 51, 27, -68, 65, 86, -70, 87, -96, -4, -42, -17,
+		23, -81, 29, 48, 13, 92, -56, -27, -47, 59, 29, 62, 6, -65, 22, 5, 44, 72, -68, -29, 51, 54, 48, 87, -16, -63, -90, 50, 28, 63, -20, -39,
+		22, -36, -41, 9, -95, 73, 60, 24, 43, -20, -89, -60, -71, 52, 9, -81, 26, -32, 69, 86, 39, 61, -74, -71, -62, -41, -49, -85, -94, -78, -52, 35,
+		89, -60, 52, -51, 99, -99, 18, 81, 42, -75, -45, 95, -56, 26, -78, 0, 40, -35, -82, -53, -10, 54, -32, 63, 35, 39, -38, -15, 64, 67, 4, -59,
+		-56, -4, 31, -51, 93, 65, -12, -35, -11, 13, -22, 90, 96, 37, 16, 55, 19, -51, 45, -4, 62, 3, 70, 93, 64, 57, -17, -81, 74, -89, 68, 44,
+		-18, -79, -89, 20, -81, 0, -14, -38, -96, -34, -60, 24, -39, 37, 77, 94, -77, -5, 86, -86, 4, 31, 47, 34, -100, -67, 21, -14, -37, 6, -11, 94,
+		-49, 31, 13, 60, 60, 47, 93, -98, -30, -65, -76, -100, 84, 18, 96, 48, 69, -77, 86, -65, 21, 11, -85, 42, 41, 38, 45, 70, 3, 0, -34, -95,
+		99, -96, -40, -50, 73, -15, -79, 57, 54, -70, 22, -7, 46, 98, 84, 61, 70, 12, 47, 76, -59, 1, -6, -2, -8, -2, 25, -77, 23, -33, -31, 83,
+		-88, 34, 45, 53, 19, -29, -75, 77, 54, -35, -3, 84, 52, -87, 77, -81, -66, 68, -89, -53, -30, -66, -7, 97, 54, 59, -77, -8, 25, -10, 1, -6,
+		-66, 49, 86, 21, -91, 89, -27, -83, 83, 47, 45, -25, -22, -23, -42, -68, 81, -7, -41, -72, 69, -1, -36, -13, 8, -53, 61, 64, -28, -21, -35, 10,
+		67, -75, 75, 91, -2, -67, -34, -100, 7, 89, 30, -26, 33, 88, -75, 71, -70, -83, -9, -62, 64, -48, -12, -78, 71, 90, 59, 5, -84, -44, -60, -77,
+		40, -86, 11, -40, 81, -43, -57, 55, -40, -71, 64, -23, -31, 69, 19, 25, -41, 81, 31, 42, 39, 59, -73, -72, -26, -45, 16, 38, -58, 51, 45, 28,
+		89, -82, 11, 63, 90, 92, 18, -78, -47, 24, 73, -67, -19, 36, 6, 93, 53, -94, 71, 68, 78, -34, 13, -17, 38, -45, -43, 11, -74, 22, 34, -82,
+		50, -30, 24, -76, -71, -98, -8, 29, 8, -60, 87, -18, -69, -57, -77, -15, 31, 58, -87, -53, -92, 15, -36, -93, -95, 36, -81, -35, -52, -90, -8, 79,
+		-35, -67, 24, 20, -60, -16, -54, -83, -35, -1, -1, -38, 62, -44, 98, -74, -42, 81, -12, 38, 20, 29, 39, 35, -88, 13, 48, -36, 3, -76, -86, 8,
+		73, 79, 71, 35, -60, 52, -100, -55, -25, 45, 1, 71, 98, -30, -19, 62, -46, 40, 79, 10, -7, -79, -93, 9, -53, 78, 13, -10, 25, -66, -53, -24,
+		-62, 57, 86, -77, -40, -100, 68, 16, 51, 84, 43, -59, -25, 53, 2, -80, 53, -23, -91, -79, -40, 44, -32, -5, 32, -18, -85, -80, -96, 82, -89, 54,
+		-74, -86, -42, 55, -14, -32, -15, -34, 99, 50, 90, 6, 41, 46, -15, 81, -3, 24, 8, 44, 74, 38, 34, 84, 15, 59, 21, -28, 4, 67, 25, 13,
+		-91, -58, 6, -49, 91, -80, 93, -75, -84, -66, -82, -71, -93, -80, -42, 12, -99, 32, 47, -95, 60, -55, 98, 49, -45, -17, 2, 94, -89, -27, 49, 11,
+		-59, 69, 16, 44, -87, -15, -22, -8, 35, -45, -24, 99, -13, -42, -86, 34, -11, 94, -92, 18, -13, -90, 90, 6, -1, -84, -82, 64, 48, -92, -90, 21,
+		-8, -42, 45, 42, 18, 73, -91, -58, -88, 73, -12, -80, -78, 12, -42, -9, -98, -41, -92, -10, -78, -19, -13, 92, -69, -38, -19, 53, 10, -39, 37, -47,
+		7, 66, -63, -3, 58, 36, -12, -87, -27, -24, -34, -1, 59, 37, -9, -48, 52, -13, 13, 87, 59, 87, -76, 24, -73, 0, -47, 86, -34, -26, 53, 70,
+		48, -76, -50, 6, 24, 57, 93, -98, 83, 28, -70, -61, 38, -47, 44, 19, 20, 2, 84, -51, -24, -11, -88, 94, -77, -38, 37, 89, -49, -14, -97, -90,
+		49, 87, 38, -27, 23, 27, 21, 81, -35, -71, 22, -48, -27, 89, 99, -29, -73, 80, -14, -10, -15, -27, -82, 83, 0, 23, 16, -73, 9, -42, 51, 55,
+		76, 76, 8, 19, 66, 12, 40, -49, -97, -15, -81, 41, 20, 81, -2, 33, -37, 56, 36, -95, 9, -34, -85, -88, -37, -76, -56, 14, -38, 43, 38, 12,
+		81, -25, -38, 57, 41, -82, -12, -55, 22, 64, -27, 87, 2, -50, 34, -48, -43, 40, 60, -50, -96, -51, 61, 96, -83, 25, 81, -62, 87, -21, -55, -83,
+		37, 40, 77, 64, -54, -35, 54, -16, 36, -99, 25, 10, -51, -16, 59, 76, -15, 73, -60, 22, 63, 48, 11, -70, 43, 34, 43, 41, 92, -30, 56, 22,
+		-73, -80, -65, -67, -60, 4, -29, -92, 68, -34, -86, -24, 92, -1, 65, 97, -51, -55, 5, 10, -100, -2, -58, 21, -5, -13, 72, -73, -75, -19, 24, -63,
+		-41, -35, -17, -32, 40, 81, -29, 36, 9, 55, 88, -85, -51, -82, -78, 4, -50, -85, 31, 58, 58, 43, -71, -68, 77, -89, -90, -52, 76, 32, -59, -18,
+		14, 15, -29, 56, 73, -49, 48, -93, 80, 80, -61, 64, -72, -28, 8, -85, 31, 99, -89, -47, 45, 58, -36, -93, -90, 15, -6, 25, 85, -53, -28, 27,
+		9, 81, -11, 19, 99, 87, -96, -15, 12, -7, -49, 84, -50, -41, -68, -19, -78, 16, -89, 31, -6, 78, 70, 11, -66, -68, -90, 80, 0, -49, 86, -77,
+		66, 38, -41, 78, -57, -46, -65, 50, -25, 22, -11, 28, -29, 65, 88, -30, -63, -80, 15, 67, -11, 15, -15, 38, 65, 81, -19, -80, -16, 17, -41, 13,
+		76, -92, -53, 96, 95, -11, -92, -19, 3, -55, -45, 70, 1, 64, -41, -37, -41, 89, -41, 20, 58, -51, -15, 29, 21, -48, -45, -69, 62, 69, 79, 4,
+		33, -93, 44, -14, -32, -39, 80, 15, 93, -65, -64, -18, -78, -72, 0, 72, 58, -99, -41, 31, -25, -24, -26, -27, 32, 85, -51, -61, -46, 61, 70, -89,
+		-52, -98, 56, 46, 39, 98, 10, -76, 63, 20, 8, -42, -75, 79, -97, -65, 2, 60, -30, -43, 24, -93, -71, -12, -55, 49, 35, 63, -39, 58, -35, -17,
+		-23, -53, 68, 37, -24, 68, 48, -70, 97, -45, -88, -27, 76, -49, -1, 8, -56, -71, 77, 32, -29, -16, 17, -83, 18, -28, 50, 3, 88, 26, 68, -22,
+		26, 28, 19, 88, 38, 29, -70, 67, -5, 83, -34, 20, 40, 18, 26, 63, -91, -26, -48, 27, 53, -23, 30, 53, 97, -1, 87, 40, -45, -1, -23, 51,
+		57, -55, -94, 51, -10, -88, 76, -13, -98, -26, 67, -44, -26, -87, -34, -75, -95, -10, 65, 88, 44, 95, 57, 30, 72, 44, -51, 18, -62, -94, -16, 61,
+		29, 50, -40, 92, 68, -39, -95, -2, -75, -6, -48, 52, -79, 67, 74, 80, 61, 46, 50, 27, 15, 31, 8, -47, -62, -87, -5, -91, 77, 49, -39, 14,
+		59, 84, -41, -87, 70, 63, 33, 3, -97, -50, -58, -38, 47, -15, 51, -24, 73, 15, 36, 28, 47, -47, 42, -96, 99, 14, 1, 17, -86, 20, -81, -91,
+		55, 81, 59, 45, -23, 17, -59, -68, -41, 43, -5, 68, -27, -47, 92, -93, 22, -87, 21, -6, -92, -19, 94, -23, -52, -54, -78, 34, 5, 27, 40, -45,
+		-89, 50, 33, -19, 44, -83, 24, 39, 33, 62, 14, 26, 53, -28, -20, 87, 88, -48, 60, -69, -28, -68, 64, -95, -41, -70, 98, 11, 25, -90, 71, -87,
+		-9, -90, 79, -52, 67, 2, 47, 35, 8, -85, 80, 93, -67, 17, -59, 1, 98, 32, 20, 23, -14, -8, -11, 33, 48, 55, -18, 92, -54, -85, 74, 41,
+		-68, -73, 62, -8, 45, -45, 41, -33, -78, -77, -57, -49, -60, -82, -100, -94, 60, 77, 15, 71, 24, 73, 51, -43, -4, 45, 31, 14, 28, 49, 98, 28,
+		-59, 53, 66, 25, -95, 73, 5, 99, 40, 55, 29, 8, -70, -46, 57, 5, -43, 50, -66, 96, 87, 90, 92, -80, 86, -58, 28, -89, -17, -3, 13, 97,
+		-56, -15, -22, 21, -9, 52, -95, -51, 42, -6, 34, 92, -63, 81, 31, -10, 78, -26, -21, 64, 0, 80, 75, 60, -79, -48, -35, -39, -24, -13, -86, -40,
+		-91, -67, 96, 78, 79, 56, -77, 97, -99, 27, -95, -77, 19, 17, 63, 58, 35, 65, -73, 78, -26, 44, 23, 63, 68, 50, -48, 20, 55, 71, 76, 27,
+		-71, 98, -72, -95, -51, 39, -81, -40, -94, 84, 48, 86, -59, -27, -65, 59, 19, -98, -66, 5, 0, -65, 91, 57, -37, -30, 28, 6, -24, -8, -20, 84,
+		9, -98, -19, 93, -24, 52, 25, 17, 97, -11, -34, -20, 57, 69, 99, -2, 21, -75, 32, -47, 68, 80, -50, 41, -51, 12, -81, -4, -85, 72, 26, 60,
+		-16, -56, -18, 68, -18, 97, 14, -1, 75, 0, 36, -40, -49, 0, 61, -44, 86, 46, -69, -62, 3, 71, -51, 18, 87, -14, -41, -7, 57, 13, 11, -56,
+		61, 79, 85, -42, -89, -71, -95, 25, 11, -78, 90, 96, 98, 69, 70, 76, 18, 50, 1, -89, -37, 52, -77, 25, 59, 91, -34, 16, -100, -2, -98, 39,
+		-60, 82, -94, 25, -55, 24, -74, -45, 74, 4, 90, -60, -23, -67, 76, -36, 51, -11, -36, -91, -51, -56, -81, 12, -14, 16, -34, 47, -32, 73, 57, 61,
+		-83, -46, -86, -31, 45, -91, 49, -34, -7, -75, 99, -86, -61, 64, -15, -34, -12, -12, 95, -91, -54, -13, 91, 84, 42, -85, -53, -13, 76, 84, -35, -71,
+		-99, -21, -61, -48, -48, 27, -88, 11, 8, 92, 57, 93, -18, -75, -63, -12, -45, 10, 28, 40, 35, -31, -91, 85, 73, -92, 74, -91, 72, 67, -22, -3,
+		-63, -31, -55, 26, 78, 32, -95, 69, -87, -61, -51, 86, 60, 42, -58, -9, 79, 90, -16, -16, -11, -47, -3, 36, -55, -90, -97, -68, -73, -86, 19, -22,
+		-15, -5, 9, -77, -49, -22, 33, 92, 44, 65, -91, 53, 80, 5, 84, 5, 83, -50, 73, 97, -4, -93, 11, 49, -13, -33, -56, -86, -36, 53, -97, 25,
+		7, 36, -77, 29, 91, 74, 54, -83, -76, -6, 45, -17, -96, -17, 82, 36, -54, 74, -89, 32, 96, 7, -15, -24, 92, 90, 57, 86, -32, -67, -17, -55,
+		67, -98, -98, 20, 85, 38, 73, 78, 42, -14, -11, -83, -10, -15, 18, -91, 46, 48, -63, 9, 22, 8, -67, -52, 71, 48, 61, -39, 82, -46, 43, 54,
+		-51, -64, 8, 9, 58, -90, 26, -67, -99, -69, 45, -6, -88, 98, 17, -23, 12, 79, -84, -67, -34, 94, -83, -78, -74, 60, -67, 2, -7, 94, 72, 5,
+		-83, 52, -22, -30, 31, -94, -20, -64, 39, -59, 3, 73, 60, 12, -24, -54, -95, 5, 95, -88, 63, 51, 52, -64, 57, 97, 35, 64, 27, -12, -70, 97,
+		-29, 96, 45, 37, -83, 46, -33, -62, -17, 42, -79, -67, 65, -71, -63, -82, -2, -4, 66, -31, 16, -69, -93, 52, -92, 96, 44, -62, -24, -66, 18, -20,
+		-27, -6, 75, -89, -16, -16, 1, 70, -73, -29, 93, -32, 11, -42, -12, 58, -44, -40, -36, 16, -73, -87, 80, 29, -60, 79, -5, 92, 4, -98, 36, -14,
+		29, -26, -54, -20, -91, 65, 95, -24, -87, 29, -74, -55, -50, -93, 92, 40, 64, -72, 42, 36, -65, 33, -53, 20, 71, 6, 98, 62, 5, 5, 96, -87,
+		-39, 8, 75, -69, 27, 29, -59, 34, 70, 51, 59, -33, 63, 44, 26, 12, -51, -96, -54, 18, 31, -78, 46, -89, -32, -73, -18, -90, 30, -44, 12, -52,
+		25, -68, -33, 71, -7, 32, -10, -81, 41, 80, 3, 85, -14, 55, -24, 45, -20, -7, 8, 37, -94, -28, -62, -94, 73, 45, 4, 78, 2, -79, -48, -61,
+		77, 93, -50, -14, -37, 10, -3, 44, 77, -35, 24, -1, 2, -1, -87, -63, 97, -94, 40, -89, -36, -36, -99, -40, -32, -15, 82, 42, 37, 43, 89, 13,
+		73, 14, 40, -26, 78, 0, 95, 89, 68, 59, 33, -6, -43, 28, 48, -6, -24, -2, 92, 57, -39, -30, 46, -48, 86, -33, 35, -23, 30, 97, -60, -17,
+		-17, -11, 64, -32, -83, 30, 91, 87, 23, 27, 90, -82, -82, -13, 39, 69, -21, 98, -17, 67, -73, 60, -51, 90, -25, 4, -86, -94, -10, -85, 45, 17,
+		-63, -94, -32, 64, -19, 57, 44, 94, -13, -18, 56, 40, -18, 18, -28, -2, -39, -64, 44, 26, 53, -50, -32, 58, -48, -6, 80, 81, -44, -83, -63, -21,
+		87, -39, 69, -63, -41, 3, 32, -60, 18, -41, -28, -60, -32, -54, 39, -73, 60, -5, 97, -73, -97, 96, 96, 73, 70, -32, 59, 52, 86, 34, -5, 94,
+		-28, 42, -65, 44, 10, 77, 59, -60, 88, 21, 93, -18, -51, -72, -17, -59, 63, -28, -58, -9, -18, -15, 40, 67, -99, 33, 13, -75, 48, -20, 12, -27,
+		74, -41, 28, 0, -53, 87, -35, 13, 33, -59, -48, -12, 52, -31, 78, 59, 34, 18, -80, -86, -97, 12, 95, 52, -5, -4, -29, 83, 37, -94, 42, 44,
+		-26, -37, -49, 26, -2, -17, -18, 93, -13, -67, 74, 42, -15, -42, 87, -59, 1, 80, 61, -48, -93, -94, 87, -67, -32, 81, -42, 11, 72, 21, -97, 29,
+		-64, 13, 8, -10, -38, -71, 59, -53, -60, 8, -2, 60, -4, -30, -91, 2, -70, 16, -47, 0, -21, 34, 55, 62, 77, -67, -59, 5, 31, -81, 46, 71,
+		-80, 68, 10, -19, -53, 7, 77, -56, -10, -68, -55, -92, 1, 9, 22, -1, 3, 64, 72, 98, 99, 59, -36, 51, 91, 68, -1, 17, -98, 80, -68, 61,
+		73, -71, 92, -59, -96, 42, 15, 77, -81, -78, -29, 40, -90, -38, -40, 98, -91, -97, 43, -11, 27, 25, -26, 78, 5, 0, -74, 24, 27, -70, -39, 58,
+		-46, -22, 92, -18, 55, -35, 26, -49, -44, -52, -18, 27, 8, -82, 93, -67, -74, -9, -76, -19, -90, -74, -23, -49, 74, -48, -67, 53, -32, -86, -98, -91,
+		31, -18, 51, 66, 36, 3, 11, 33, 6, -53, -9, -55, 71, -71, 64, -5, 18, 52, -4, -89, 61, -31, 5, -20, -72, -24, -41, 34, 60, -31, -63, -15,
+		-41, -75, -73, -62, 16, 60, -83, 65, -36, -18, -9, -75, 40, -21, 83, 53, 96, 41, 68, -53, 95, 98, 8, -58, 27, -90, 57, 94, 51, -35, 71, -55,
+		4, 56, -14, -37, 12, -85, 78, 90, -91, 46, -55, -36, 27, 75, -56, -56, -100, -47, -47, 62, 11, -72, 25, 83, -22, 36, 9, 38, 51, -63, 63, -80,
+		-48, -95, 12, 32, -75, 66, -17, 22, -68, 10, 67, -86, 58, 35, 88, 69, -66, -89, -12, 18, 71, -8, 17, 71, 4, -72, 54, -41, 12, 60, 95, -78,
+		-58, 39, -9, 67, -43, -12, 87, 50, 82, -1, 10, 4, -18, -66, 92, 7, -72, 79, -46, 37, -100, 25, -50, -94, 90, 14, -38, -84, -38, 81, -32, 15,
+		22, 35, -100, -48, 50, -19, 83, 45, -41, -46, -21, 59, 40, -95, 41, -100, 47, -42, -95, 15, -1, 3, -95, -26, 73, 53, -95, -31, 96, 87, 78, 35,
+		93, -83, -1, -100, -45, 16, -35, 82, 60, 96, -40, 97, 16, 78, 44, 42, 1, 58, -94, -68, -96, 47, -3, 97, -41, 98, -85, -11, -95, -66, -41, -18,
+		30, 14, 16, -62, -59, -71, 32, -50, -84, -49, -17, -87, 27, -68, 95, 40, 33, -93, -25, 74, 49, -90, 44, 3, -55, 92, 77, -3, 42, -56, -46, 16,
+		64, -16, 49, -95, -63, -49, 60, 5, 38, -33, -61, -88, -82, -26, 16, -47, 54, 7, 25, 64, 27, -72, 75, 84, 49, -4, -16, -41, 78, -82, 76, 46,
+		-7, -12, 92, -87, 79, 54, 88, 85, -61, -76, 54, 25, 39, -77, 84, -30, 39, -15, 82, 44, 77, 62, 92, 5, 21, 95, -57, -18, 12, -71, -85, -85,
+		1, -60, 75, 87, 79, -77, -96, -12, -52, 86, 42, 84, 27, 21, -2, -64, 29, -85, -94, -59, 94, -90, -4, -36, -6, 71, -19, 62, -88, 31, 2, -84,
+		-98, 59, -79, -9, -9, -95, -42, 73, -49, -77, -45, 50, -51, -4, 93, -59, -67, 72, -86, 85, -42, -51, -49, -17, 30, 72, 90, -17, 64, -45, -52, -51,
+		-68, 13, -31, -22, -97, 61, 83, 9, 40, 32, -40, 73, 44, 84, -18, 58, 22, 41, -87, 58, -12, -27, 45, -5, 74, 20, 95, -28, -6, 76, -26, -70,
+		-98, 25, 28, 8, -93, 63, -6, 38, 49, -4, -27, -46, -98, -54, 29, -11, -74, 95, 34, 22, 71, -91, 73, 78, 23, -3, 5, 67, -62, 50, -54, 74,
+		-89, -16, -39, 2, 69, 51, -4, -88, -95, -39, 39, -36, -77, 44, -52, -51, -46, -35, 90, -48, -71, 16, 81, 18, 22, -85, -35, 65, -27, 0, 79, 9,
+		-5, 9, 27, -72, 60, 60, -82, 90, 49, 82, 85, -79, -6, -88, -90, -34, -14, -87, -23, -42, 8, 5, 48, -17, -67, 61, 23, -29, 60, 13, 69, 42,
+		94, 70, 31, 1, -4, -89, -84, 1, -11, 71, -63, -91, -13, 68, 3, -69, 20, 16, 80, -30, 24, -95, -87, 14, -63, 39, -2, -53, -81, 78, 13, -62,
+		-12, 6, 35, -81, -57, -39, 85, -4, 47, -11, -79, -89, 6, 87, -75, 62, 63, -25, -34, -89, 67, 76, -77, -72, 19, 82, 7, -72, 52, 56, -35, 29,
+		-13, 22, -95, -85, 2, 12, -33, -29, 14, -21, -32, 79, -9, 40, -66, -91, -16, -96, 21, -92, 70, 76, -62, 83, 83, -94, -27, -66, 41, 11, -93, -31,
+		34, 60, 69, 41, -50, 69, 25, 59, -92, -62, 19, -25, -53, -59, -79, -56, 89, 50, -37, -59, 86, 7, 71, 82, -17, -90, -26, -38, 84, -74, 4, 20,
+		-64, 89, 69, 90, 43, 25, 87, -6, -54, 32, 12, 25, -40, 33, 99, -90, -76, 19, 63, -74, -34, 6, 62, 42, 50, 35, 84, -88, 87, -96, -47, -94,
+		96, -30, 74, 44, 95, -89, -30, 89, -73, -23, 77, 46, -43, -87, -49, -6, -51, -23, 63, 74, 49, 29, 9, -65, -18, 20, 76, 99, -55, -98, 11, -54,
+		5, 19, -63, -93, 41, -59, 4, 9, -74, 12, 60, -82, -67, 23, 24, 83, -29, -79, 90, -45, -79, -95, 30, -18, -38, -91, -76, 21, 35, -89, -6, -81,
+		-82, 78, 27, -91, -78, -42, 54, 64, -28, -79, -75, 88, -14, 94, 41, -23, 91, 34, 93, -22, 53, -9, 54, -74, 84, -59, 65, -29, -58, 56, -15, 6,
+		17, 14, -52, 40, -87, 22, -48, 2, -12, -16, -34, -63, -96, 70, -15, 1, 90, 51, -78, 68, -53, 81, 59, 32, -10, 27, -33, -1, 3, -99, -85, 72,
+		87, -82, -8, 60, 95, -30, 91, 59, -24, 58, 82, 94, 54, -20, -69, -62, 68, 10, -97, -65, 61, -71, 60, -98, 76, 38, -44, -22, 43, 42, 63, -71,
+		-90, -55, 97, 18, 97, 80, -18, 39, 12, 21, -88, 0, -76, -88, 44, -92, -97, -55, 29, -29, 9, -32, 76, 79, -88, 68, -59, -63, 13, -89, -58, 53,
+		60, -25, -10, -28, 6, 31, -6, -86, -49, 2, -83, 50, 39, -88, -55, 83, 0, 98, -69, 53, 36, -40, 2, -17, -19, 70, 89, -99, -99, -56, 44, -62,
+		24, 69, -87, -84, 0, -99, 54, -33, 63, -65, -84, 51, 8, -68, -75, 65, -44, 2, -62, -80, 37, 36, 41, -68, -31, 25, -10, 68, 13, -38, 72, 85,
+		-70, -83, -35, 4, 39, 21, 44, -55, -70, -42, -11, 82, -41, 13, -80, 75, -67, -60, -81, -90, 54, -53, 58, 17, -100, -16, -8, -30, -66, -19, -49, 90,
+		18, 3, -25, 75, -18, -79, -59, 10, -23, 40, 19, -83, 0, -79, 67, -81, 34, -75, 0, 69, 65, 1, 34, -92, 85, -17, -10, 26, 87, 68, 71, 6,
+		41, 63, -71, -98, 14, 36, -13, 31, -26, 34, 47, -30, 43, 7, 68, -83, -28, -11, 81, -10, -36, 33, -45, 8, 44, -91, 62, -10, -63, -66, 6, -93,
+		-12, -86, 11, -68, 2, -41, -78, 60, 98, -73, -80, -14, 88, 22, -10, -97, -58, 60, -41, 13, 2, 74, -57, -61, 72, 10, -78, 60, 65, -3, 28, 16,
+		57, 61, 47, 30, 77, -73, 24, -31, 18, -4, 29, 4, 62, 64, 16, 31, -100, -38, 53, 18, 8, -84, 33, -68, -30, 48, -21, -74, 59, -71, 49, 44,
+		98, 0, 24, -66, -92, 84, 94, 55, 48, -38, -87, -78, 89, -17, -76, -30, 13, 25, -92, 50, 6, -10, 20, 6, 50, 27, -48, -67, 54, -66, 22, 26,
+		97, 23, -6, -18, -67, -53, 85, -85, 58, 72, -91, -2, -23, 38, 52, -15, -82, 10, -63, 90, 27, 8, -50, 19, -77, -10, -36, -19, -90, -33, 84, 52,
+		42, -45, 10, -33, -39, -48, -33, 0, 82, -7, -49, -49, -95, -16, -69, -47, 91, 16, -18, 6, 90, 84, 79, 12, -13, -56, 98, 39, 59, -17, 72, -7,
+		-87, 36, -84, -46, 62, 95, 85, 52, -35, -9, -34, 48, -21, -29, -24, -39, -24, 31, -64, 96, -94, -49, -36, 0, 74, -39, -47, -59, 12, 81, 74, -96,
+		4, -75, 31, 22, -30, -83, -24, 59, 53, -72, 60, 64, -83, 92, -62, -68, 24, 2, 30, 23, 49, 49, -100, -5, 63, 20, 55, 9, 82, -77, 56, -91,
+		70, 52, -7, -56, -50, -51, -100, 91, 96, -76, -39, 68, 87, 37, 72, 97, -1, -57, -79, 54, -78, 90, -94, -7, 81, -3, -31, -91, -43, 18, 33, -74,
+		86, -39, 45, 35, 43, -89, -46, 18, 87, 21, -96, 94, -76, 33, 78, 94, -94, 14, 26, -8, 42, 64, 70, 50, -33, 95, -4, -16, -19, -97, 97, 74,
+		80, 13, 74, -28, 17, -73, -95, -75, 44, 53, -47, 27, -61, -36, -77, 80, 46, 84, 17, -33, 84, 87, 64, -27, 38, 53, -100, -90, 12, 93, 16, -39,
+		79, -70, 2, -39, -24, -56, -95, 79, 29, -83, -17, -68, 77, -50, -41, -5, 62, 11, 77, -11, 90, -58, -16, -49, 80, -33, 25, -92, -13, 21, 35, 46,
+		67, 88, 89, -6, -66, 75, -95, -18, 7, 70, -10, 72, 89, 64, -92, -36, -50, -9, -31, -22, -84, -51, -7, 96, 19, -76, 13, 33, 9, -11, -46, -92,
+		32, -32, 57, -2, -63, -64, -23, -56, -58, -39, -5, -56, -25, 54, -96, -70, 9, 50, 46, 95, -10, 63, -72, 75, -66, 17, -55, 11, 1, -36, 87, 10,
+		-8, -54, 0, 60, -48, 98, 7, -77, 0, 20, 15, -67, -16, 77, -13, -92, 40, -70, 99, 20, 4, -38, 23, -9, 28, 57, 34, 92, 9, -47, 57, -21,
+		8, 62, -4, -68, -54, -18, -9, 76, 53, -91, 34, 45, -56, -5, 76, -12, -70, 90, -56, 47, 27, 69, -34, 48, -65, -75, 38, -2, -23, 22, 70, 31,
+		-5, 35, 32, 84, -25, -30, 40, -54, 10, 53, 85, -90, -87, -36, 69, 74, -13, -62, -53, -58, -77, -4, -37, -85, 35, 58, 5, 93, 99, 28, -29, -62,
+		50, -45, 22, -67, 49, -87, 87, 56, -33, -60, -81, -67, -42, 59, 74, -37, -43, 80, -54, 46, -22, -4, 68, 78, -97, 91, 79, 29, 37, -61, -72, 29,
+		87, 57, 0, -18, 44, 5, 69, 50, -31, -6, -36, -88, -78, 14, 29, -24, -12, -83, 29, 98, -59, -2, -5, 89, 4, -17, -71, 26, -41, -3, -26, -47,
+		38, -17, -61, -60, 92, -40, -43, 53, -42, -83, -13, -95, 47, -36, -11, -47, 22, 40, -62, -73, -27, -79, 37, -44, -67, 8, -4, 71, -37, -20, 41, -47,
+		-8, 33, -83, 75, 7, 89, -46, 93, 39, 20, 27, 1, -71, -48, 53, -63, 27, 98, -72, 49, 44, -10, -36, -11, 16, -87, -41, -52, 34, 99, 83, 4,
+		-40, -76, -8, -55, 56, 51, -25, -25, 32, -96, -19, -25, -36, 94, -32, 48, 39, 50, 27, 67, 88, -7, 93, -88, -48, -26, 7, 47, -14, -56, -40, 97,
+		-93, 55, -95, 99, -1, 44, 38, 29, 14, 18, 94, 53, 53, 44, 75, 52, -11, 9, 49, 69, 45, -26, -60, 67, 16, -58, 15, -89, 1, 53, -4, 51,
+		-99, -52, -41, -96, -19, 30, -43, -77, 27, 53, -18, 30, -76, 43, -96, -21, -11, 32, 70, 56, -15, -61, 91, 49, 46, -39, 18, 83, 42, -65, 49, -36,
+		78, -26, -48, -62, 32, -15, 27, -35, 36, 55, -68, 48, 13, -6, 9, 29, -82, -97, -50, -85, -99, 8, -48, -25, -82, 1, -92, -40, 21, -27, -36, -12,
+		-86, -39, 72, 43, 22, -29, 10, 64, -66, -18, 43, -19, -94, -9, -74, 59, -54, -42, -8, -46, 52, -56, -75, 56, 77, 0, 11, -80, -5, -97, -49, 23,
+		-50, -67, 74, 62, 53, -37, -71, -71, 83, 67, 8, -98, -69, 86, 63, 90, 14, -51, -56, -44, -31, -71, 51, 17, -47, 86, -8, 76, -55, 32, 35, -87,
+		-58, -28, 99, 9, -73, 61, 77, -87, 43, -41, -70, -39, 91, -32, -79, 47, 65, -95, 55, 78, -27, -34, -28, 73, 43, -16, -64, -56, -31, 72, -94, -70,
+		-93, 96, 53, 20, 3, -12, -41, -31, -18, -19, 67, 74, -8, -19, 80, 19, 20, 20, -90, 8, -22, -93, 55, -54, -71, -46, -93, -67, -59, -1, -86, 29,
+		58, -87, 8, -29, 81, -20, -52, -92, -60, 29, 80, 39, -39, 93, -77, 64, -5, 99, -39, -77, 89, 15, -52, 0, -10, 85, 93, 71, 81, -18, -99, -91,
+		-93, 32, -8, 7, -25, 33, 9, -23, -40, -83, -62, 4, 94, 50, 13, 24, -98, 42, -45, 56, 26, 44, -21, 72, 12, -73, 26, -59, -23, 20, -59, -26,
+		-11, -85, -90, -28, -21, -39, 80, 3, 23, -32, 34, 98, 38, 64, 67, -84, 0, 50, 89, -98, -26, -70, 54, 71, -98, 32, -93, -47, -98, 4, -69, -56,
+		-29, -52, -65, -85, -99, -7, -55, -72, 52, -42, 82, -56, -1, 9, 1, -95, 70, 2, -83, 68, 54, 69, -12, -88, 0, 95, 58, -15, 41, -18, -56, 96,
+		16, 61, 98, 17, 41, 99, -73, -29, 96, -6, -73, 29, -30, 23, 17, -95, 87, -3, 17, -45, -27, 44, 59, -21, 4, 78, 6, -10, 23, -18, -24, 98,
+		-31, 14, -13, -39, 92, -45, 19, -31, 31, -14, 6, 46, 96, -51, 80, 9, -64, -51, -50, 40, -32, 62, 82, -73, -39, -16, 52, -45, 73, -20, -48, -77,
+		77, 95, -3, 35, -26, 87, 1, -44, -59, -78, 18, -17, -84, -41, -56, -100, 62, 88, 81, 49, -40, 24, 77, 82, 42, -50, 50, 80, -28, 33, 86, 9,
+		9, 83, 69, 20, 73, 70, -2, 40, -39, -78, -13, 79, -30, 28, 36, -75, -67, -22, -37, -88, 9, 24, -67, 26, 99, 32, 57, 36, -67, 17, -100, -92,
+		97, -54, -5, 14, -36, 75, -62, -61, 25, 33, -64, 93, 84, 2, -94, -96, -52, -35, -82, -30, 87, 34, -78, 60, 85, -67, -40, 94, -63, -26, -93, 9,
+		-30, -40, 66, 2, 4, 77, -30, -83, -3, -94, 35, 55, 49, -22, -3, 70, -94, 98, 0, -64, -21, 64, 80, 31, -94, -15, -32, 12, 44, -78, 33, 34,
+		18, 62, 95, 93, 17, -43, -99, 78, -82, -58, -5, 26, -72, 85, -79, -50, 20, 37, -56, -22, 36, -17, 5, 31, 77, 53, 34, 84, 82, 99, -39, 4,
+		89, 67, -21, -53, 52, 43, 72, -61, 53, -89, -48, 0, 17, -77, 16, -90, -83, 25, -2, -46, 24, 83, 96, -79, -12, 65, -49, -45, -82, -12, 30, 27,
+		39, -23, -16, -71, -86, 24, -62, -97, -19, -53, 16, 42, -28, 75, -27, -38, 1, 12, 70, -56, -62, 14, -49, -78, 67, 23, 63, 92, -74, 11, -59, 7,
+		72, 37, 39, 8, -11, 60, 58, -18, -34, -43, -20, -72, -81, -88, 95, 63, 72, 18, 17, 21, 90, -83, -33, -34, -54, 7, 76, 38, 52, -62, 41, 84,
+		49, -63, -55, -57, -90, 25, -80, 26, 46, 25, 7, 67, 5, 92, 88, -85, 43, 63, -46, 19, 17, -69, -46, 3, -51, 3, -24, -14, 3, 61, -9, 95,
+		-7, 67, 63, -60, -41, -45, 8, -63, -31, 12, 87, 66, 38, -21, -82, -27, 72, -92, -63, 57, 20, -17, -43, -49, -12, -30, 8, 62, -4, -17, 70, -1,
+		12, -89, -71, -84, -15, 22, -66, 88, 65, 61, 77, -88, -8, 52, 67, -81, -15, -96, -17, -63, -18, -2, -95, -59, 63, -6, -42, 27, -42, 16, 4, -40,
+		-21, -96, 85, -42, 34, 20, 28, 50, -20, 13, -39, -21, -98, -60, -10, 73, -16, 12, 86, -32, -93, 79, -94, 28, 60, 74, 69, -75, -71, -84, 55, 41,
+		96, 44, 50, -74, 28, 66, 43, 20, 88, 65, -18, -75, 73, 76, 5, -77, 2, 16, 37, 78, 26, -42, 16, -24, 99, -42, 81, -23, -18, -5, -46, -55,
+		-33, 94, -43, -13, -37, -22, -62, -28, -81, -98, -78, -18, 62, -4, -33, 98, 71, -65, 75, -96, 90, -6, 13, -95, -48, 43, -12, 29, 94, 28, -66, 6,
+		-45, -4, -33, -89, -45, 93, 90, -97, 33, -81, -88, 54, 18, 87, -37, 88, -100, 55, -30, 63, 98, -99, -44, -94, -65, -39, -21, 88, -88, -89, 72, -80,
+		-47, -49, 81, 46, -9, 88, -32, -93, 62, 54, -59, -50, -29, -59, 63, 73, 15, -3, 76, 38, 89, -52, 81, -56, -71, -39, -45, 51, 84, -90, -11, 75,
+		-17, 75, 0, 60, 72, -65, 98, 69, -66, -60, 54, -50, 16, 33, -62, 70, -95, 29, 99, -34, -17, 31, 68, -31, 20, -26, -32, -7, -84, 11, 82, 78,
+		91, 20, -63, 55, 29, 0, 39, 67, 36, 95, 91, -94, -90, 43, -90, -61, 60, -81, 38, 76, -81, 30, 3, -88, 98, 43, 41, -12, 26, -42, 88, 41,
+		-9, -23, 21, -84, 18, -89, 70, -88, 57, -49, 29, 8, 33, 18, -54, -92, -26, -8, -8, 86, 7, 62, 40, -34, 10, -66, 33, 31, -99, 77, 73, 0,
+		4, -28, 89, -38, 76, -94, -80, -8, -77, 5, -58, -22, -53, 91, 54, -65, -60, -100, 61, 36, -79, 92, 62, -71, -95, 72, -57, 19, 80, 63, -62, 39,
+		-36, 79, 90, -83, -3, -31, 8, 56, -61, 32, -50, 28, 46, -22, -55, 34, 31, 96, 75, 55, 83, 94, -7, -6, -55, 97, -42, 52, 1, -94, 55, -42,
+		27, -25, 58, 54, -28, 66, -43, 34, -73, -73, -2, 54, -95, -57, -80, 74, 60, 24, -12, 40, 19, 46, 97, 91, 18, -81, 30, -36, 56, 54, -4, -96,
+		85, -87, -71, 80, 15, -96, 89, 93, 27, 91, -86, -79, -22, -24, -98, -38, -70, 35, 65, -16, 32, 90, 74, -31, -96, 17, -73, -100, -27, 30, -97, -56,
+		56, -45, -15, 39, -44, 85, -10, -13, 23, -16, -17, 42, -7, -94, 69, -19, -96, 97, -12, 27, -72, 16, 94, 53, -88, 53, 29, 89, -17, 47, -79, -87,
+		-83, 14, 54, 91, -3, -19, -62, -86, 45, 33, 32, -83, 8, -40, -64, 96, 18, -78, 86, -5, 1, 57, -93, -3, 26, -90, -32, -31, -25, -35, 20, 85,
+		50, -38, 63, -56, -98, -29, -26, -14, -45, -92, 99, -9, -63, -55, -50, -51, -27, -63, 20, 90, -61, 67, 86, 2, -73, -44, -59, -91, 69, -95, -16, 32,
+		-6, -18, 12, -94, -91, 92, -55, 20, -66, 9, -7, -61, 24, 53, 4, 42, -33, 78, 90, 8, 5, -43, 59, 88, -70, -24, -19, -60, -31, 77, 19, 41,
+		-83, 55, 89, 9, 49, 52, 64, -77, 48, -7, 5, -81, 51, 32, -91, -69, 58, 65, -39, 26, -12, -44, -65, 52, -60, -10, -56, -71, -15, 48, 87, -74,
+		64, 55, 48, 86, 94, -51, -51, 52, 43, 5, 59, 10, 3, -83, -85, -80, -69, 36, 54, -49, -60, -20, -81, 28, 50, 15, -41, -22, -48, -71, 40, 27,
+		61, -49, 60, 78, 97, 29, -37, 92, 95, -42, 72, -84, 98, 94, -42, 62, 77, 45, -77, -99, 96, 34, -7, 96, -6, 71, -63, -64, -22, -82, 78, 70,
+		-43, -48, -10, -23, -83, -89, 60, -45, 88, 69, 66, 12, -3, 53, -84, 18, 69, 38, -53, -49, -33, 61, -40, 60, 32, 40, -98, 70, 14, -78, 91, -52,
+		-48, -95, 41, -74, 42, -44, 65, 20, 71, -1, 83, 24, 1, 71, -44, 12, -47, -77, 92, -20, -56, -71, 80, 46, -30, -73, -91, -78, 22, 80, -55, 96,
+		-57, 64, 73, -16, 51, -9, -74, -83, 26, -90, 44, -63, 80, -61, -43, -20, 89, 68, 16, -49, -54, -42, -43, 27, -52, 9, 20, 10, 49, -38, 78, -68,
+		-66, -35, -16, 42, -63, -6, 1, 27, -85, 2, -49, -55, 33, 26, 39, -44, -88, -30, 43, -94, 25, -16, -57, -99, -87, -52, 4, -48, 60, 41, -41, -16,
+		86, 94, -92, -72, -63, 12, 37, -79, 22, 60, -68, 40, 2, -10, 46, -69, 53, -30, -100, 43, -77, 77, 53, -56, 74, 68, -94, -79, -41, -10, 45, -59,
+		-59, 31, -97, -29, -44, -82, 46, -6, -21, -73, 49, -1, 53, 93, -26, -81, 4, -14, 97, -31, -79, -46, 97, 10, -56, 62, 14, -76, 29, -75, 56, -69,
+		-69, 4, -5, 16, -55, -19, 85, 73, 85, -60, 95, 38, -6, -72, -81, 65, -9, -44, -42, -28, -82, -80, 70, -74, -65, 15, -2, -66, -87, 24, 62, -33,
+		43, -75, 53, 97, -28, -83, 49, 65, 52, -8, 51, 55, 62, -85, 16, 39, 15, 21, -53, 2, 87, -16, 40, -99, 19, -3, -18, 34, -2, -81, 4, -48,
+		-60, -100, 53, -33, 41, -28, -83, -70, -23, 31, 79, -15, 34, -37, -49, 32, 38, -73, -46, 94, 62, 95, -6, 4, 82, 28, -24, -28, -21, 32, -71, -36,
+		67, -81, -48, -60, 75, 66, -55, -46, -5, 46, -25, 17, -38, -96, -12, 50, -32, 97, -58, 99, 45, 40, 38, 83, -29, -37, -39, 13, -73, 7, -70, -77,
+		59, 95, 96, 5, -10, 72, -49, 54, -16, -7, -17, 25, -40, -84, -54, 44, -90, 84, 45, 99, 40, 64, -36, -74, -86, -52, -80, 89, 49, -62, -22, -56,
+		30, 55, 45, 38, 23, 85, 96, 41, 5, 62, -87, 23, 64, 48, -31, -17, -37, 37, 74, -97, 42, -22, -13, 4, 9, 95, 38, -58, 3, -13, -70, 83,
+		-69, -72, 78, 36, -62, -48, -82, 17, 26, 3, -65, 3, 5, 2, -30, -17, -49, -67, 77, 69, 75, -85, 12, -96, 93, 76, -10, 97, 0, -6, 2, -56,
+		5, -37, 85, 1, -83, -76, -49, 4, -46, -63, -1, 44, 57, -15, 71, 81, -41, -11, 89, 39, 29, -54, -70, -30, 1, 9, -51, 67, -7, -8, -20, -92,
+		82, 32, -10, 61, 48, 0, -54, 63, 43, 53, 29, 94, 81, 79, -28, 7, 75, 70, 21, 48, 91, 35, 81, -91, 3, 4, -66, 47, 36, 6, 1, -100,
+		-22, 85, -87, -70, 34, 93, 56, 80, 56, 54, 25, -24, -18, 66, 28, -84, 33, 54, -16, 97, -39, 94, -73, 73, -21, 32, 79, -9, -27, -94, 82, 88,
+		-38, 86, -41, -56, -60, -22, -28, 2, 6, -80, -16, 47, 24, 38, -56, -97, -17, -84, -57, 33, 33, 19, -43, 10, 65, -10, 64, -54, 81, -27, 64, -95,
+		30, 25, 26, -98, 96, -87, 22, 17, 80, 6, -96, 89, -39, 12, 45, 20, 29, 94, -69, -87, -90, -99, 27, -1, 78, 76, -89, -95, 0, 0, -29, 87,
+		22, -20, 8, -70, -56, 75, 66, 24, -1, -67, 61, 5, 38, -47, -62, -66, 69, 97, 47, -89, -79, -39, -63, 65, -89, -66, -28, -55, 44, -59, -39, -66,
+		34, 89, -61, 72, -33, 72, -38, 39, -70, 20, -2, 25, 44, -6, -19, 56, -97, -59, -96, 80, 99, -22, 95, -50, 1, -53, 98, -63, 55, 88, -1, -46,
+		21, -76, 3, 75, 33, -6, 44, 95, -38, -91, -25, 17, 80, -59, -45, -19, -4, -24, -88, -88, -79, 17, -70, 93, 77, 93, 24, 71, 60, 98, 26, 49,
+		-33, 67, -33, -50, 81, 14, -68, 38, -89, -49, -87, 23, -84, 12, 58, -20, -35, 16, -71, 75, 8, 62, -66, 65, -97, -100, 88, 31, -21, -75, -87, 52,
+		31, 60, -78, -52, -45, 42, -26, -32, 29, 11, 28, 47, 71, 79, 12, -25, -25, -77, 71, -79, 43, 25, -89, 30, -3, -52, -71, 58, -24, -13, -29, 88,
+		-31, -32, 40, -86, -3, -12, 86, -60, 99, -52, -11, 1, 29, -35, -91, -2, -84, -68, -24, 29, -26, 97, -96, -91, -7, -76, -27, -85, -12, 54, -1, -22,
+		-5, 65, 82, -89, 27, 73, 50, 63, 89, -98, 52, -61, 33, 33, -14, -70, 54, -37, -90, 96, 12, -37, -12, -16, 24, 30, -32, -97, -4, 58, -60, -16,
+		18, -44, 45, 51, 66, 34, -85, -26, 12, 71, 32, 77, 34, -49, 27, -97, -36, -19, 69, 53, -82, -39, 80, -42, -50, -7, 10, 66, -23, 50, 62, 75,
+		-96, -45, 8, 67, 37, 25, -94, -3, -23, -20, 18, 5, 5, -44, -65, -56, -66, 71, -6, -28, 65, 23, -53, 36, 61, -97, 69, 75, 80, 82, -16, -11,
+		30, -18, -17, 63, -55, -42, -66, -97, -49, 6, 35, 8, 33, 58, 53, -43, 64, -95, -37, -64, 61, -35, -64, -46, -8, 80, -42, 65, -29, -41, 96, 7,
+		67, 24, 94, -15, -22, -46, 59, 54, -17, 14, 48, 22, 23, 69, 89, 77, 95, -2, -80, 29, 75, 41, -74, 43, 82, 78, 62, -57, -84, -74, 88, -95,
+		-71, -17, -14, -78, 74, 66, 55, 42, -70, -38, 14, 55, 59, 5, 55, -50, 28, 95, 18, 45, -94, -82, 61, 36, 35, 7, 28, -32, -96, 85, 82, -100,
+		14, 24, 83, -88, 2, -31, 10, -78, 96, -17, -40, -54, 80, 21, -69, -5, -7, 60, 33, -19, 21, -56, -44, 54, 99, -34, -59, -43, 19, -21, -87, 71,
+		10, -60, 60, -25, 56, 17, -40, 6, -99, 51, 58, -98, 40, 12, 15, -7, -41, -59, 18, -33, 48, -12, -14, -41, -18, 52, 82, -44, -58, -7, -57, -67,
+		32, -12, -13, 66, -53, 88, 44, -7, -88, 52, 80, -38, 19, 66, 0, -54, 83, -98, 41, -53, 34, -37, 33, 18, 49, -31, 36, 6, -29, 90, 64, -52,
+		88, -5, -72, -86, 16, -19, 58, 51, 79, 35, -10, -15, 50, -5, 79, 19, 32, 80, 8, -42, -25, -30, 40, 63, 85, 53, -62, 82, 25, 38, -2, 97,
+		12, 97, -33, 84, 35, 77, -12, 5, -29, 60, -21, -1, -26, 7, 15, -67, 13, 15, 94, -80, 66, -56, -84, 49, 75, -19, 44, -44, 2, -98, 45, -4,
+		-64, -32, 79, -88, -71, 79, -62, -49, 0, 29, -79, -8, 3, 97, 95, 37, 30, -66, 98, -86, -65, 94, -21, 51, 61, 3, -34, 37, 26, 40, 86, -18,
+		-74, -56, 43, 9, 25, 18, -93, -69, -46, -46, -47, 41, 49, 59, 98, 57, 73, -96, 21, 2, 9, 22, 7, -79, -16, -36, -90, 29, 97, -81, -12, -91,
+		68, -6, -9, -12, -35, 9, 70, 57, -66, -40, -39, 72, -78, -3, 54, 9, -56, -5, -73, 19, 57, -44, 88, 56, 86, -40, -77, -29, 64, 18, -96, 30,
+		90, 88, 27, -2, 76, -42, -53, 24, -94, -33, -60, 14, 54, -65, -75, 59, -5, -82, -18, -59, -2, -76, 24, -19, -69, 88, 44, -57, -22, -50, -84, -84,
+		-72, -43, -85, -94, -61, -23, -48, 13, 95, 88, -66, 56, -80, -61, -23, -78, 34, 1, 9, 51, -6, 97, 86, -56, 86, 70, 86, -44, -8, -39, -24, 84,
+		0, -52, -100, -62, 37, -37, -2, -49, -39, -94, 37, -92, 54, 93, 47, -97, 24, -89, 26, -23, 90, 98, -5, 74, -10, -45, 4, 96, 42, 95, 7, -74,
+		-80, -30, 37, 21, -38, 19, 72, -94, -46, 87, -36, 30, 76, -26, -22, 72, 54, -71, -21, 23, 83, 31, 77, 15, 76, -90, -47, 96, -65, 98, 31, -15,
+		81, 78, -87, -53, 5, 90, -5, -1, -85, -21, -26, 69, -85, 25, 44, 56, 97, 58, -56, -20, 88, 66, 47, 32, 67, -13, -75, -71, 24, 3, -59, -11,
+		-33, -69, 78, 38, -36, 87, -38, 6, 57, 95, -36, -41, -21, 61, 82, -82, -88, -2, -28, 78, 84, 82, 26, 14, 10, -78, -54, -61, 60, -89, 90, 92,
+		43, -40, 14, 91, -19, -22, -26, 7, 47, 51, -96, -98, -91, -61, -59, 62, -59, 37, -55, 94, -78, -6, -11, 98, -66, -55, -26, -80, -80, -33, -29, 71,
+		48, -31, -17, 18, 66, -46, 84, 7, 80, 43, 3, 90, -66, 52, -63, -81, 27, 43, 63, 86, 92, -3, -4, 57, 35, 75, -66, 12, 3, -21, 88, -2,
+		-1, -79, 19, 86, -71, -92, -18, 61, -75, 31, -36, 75, 30, 15, 32, -21, -70, -4, 53, 90, -78, -14, -12, -12, 82, 47, -28, 48, -42, -89, 68, -53,
+		-43, 20, -58, 83, -6, 33, -18, 8, 94, 84, 83, 75, -51, -14, -9, 5, -89, 20, -19, -23, 8, 11, 9, -8, -69, 10, 88, 68, 36, -81, 70, 75,
+		-17, 82, 98, -12, -7, -97, -68, -32, -82, -58, 74, 62, 35, -39, 40, -92, 86, -56, -63, 55, 22, -46, -43, 25, -14, -12, 66, -51, 92, 89, 72, -28,
+		72, 96, 1, -22, -7, 0, -73, -60, -31, -56, -77, -34, -59, -19, -73, -21, -32, 18, -56, -30, 87, -22, 35, -14, -81, -34, -7, 79, -23, -92, -83, 53,
+		19, 59, 29, -70, 84, 52, -48, 9, -21, 20, -45, -35, 12, 22, -1, 83, 20, 95, 13, 15, -97, -24, 97, 82, 4, 2, -71, -1, -2, 39, -59, -19,
+		-80, -87, 89, 65, 38, 95, 78, 74, -27, -24, -39, -97, -60, -11, -58, -42, -31, -42, -50, -50, -66, 13, -58, -79, -87, -16, -81, -37, 54, -89, 62, 90,
+		68, -1, -92, -100, 50, 72, -82, 53, -48, 64, 62, -49, 44, -46, 47, -43, 77, -56, 30, 14, -1, -59, -55, -92, -80, 48, -22, 74, -43, -86, 74, 14,
+		-83, -97, 9, 51, 99, 19, -66, 60, -9, 80, -14, 75, 75, -63, 5, -27, 81, 10, 40, 47, -62, -17, 20, -91, 12, -52, -16, 27, -72, 57, -6, -70,
+		-100, 57, 91, 63, -74, 60, -58, -23, -98, -52, -65, 0, -21, 61, 44, 32, -8, -60, -25, -99, 49, 19, -70, 39, -51, -98, -74, -53, -17, 98, 88, 74,
+		-2, 36, 33, -59, -30, -75, -75, 7, -65, 64, 18, -3, -51, 52, -7, 38, -60, -96, 37, -99, 86, 56, 79, 1, 58, 77, 12, 51, -55, -87, -67, -9,
+		70, -96, -62, -83, 7, 30, 68, -26, -49, 35, 72, -91, 27, -29, 96, -14, -67, 83, -86, 47, -39, 38, -76, 35, 64, 20, 51, 42, -56, 36, 25, 29,
+		-3, -43, 46, 94, 43, 14, -46, 32, -60, -94, -19, 3, -42, -64, 33, 32, 86, -93, 20, -41, 86, 66, -84, -51, -95, 24, -44, -85, -11, 39, -21, -6,
+		-1, 25, -24, -88, 60, 84, -47, 50, -21, -3, 77, -90, 47, 69, -43, -74, 99, -24, -93, 50, -21, -52, -81, -49, -78, -95, 40, 29, -17, 73, -48, 25,
+		39, -82, 84, 61, -87, 78, -14, 52, -87, 58, 73, 75, 51, -29, -3, 24, -56, 58, -93, -40, 95, 60, -32, -33, -62, 27, -39, 46, -89, -6, -49, 25,
+		-27, 76, -97, 39, -99, -86, 8, -25, 6, 53, 98, -59, 54, 61, -17, 3, -76, 63, 65, -83, 15, -34, 2, 52, -25, 45, 46, 61, -15, -41, 19, -87,
+		73, 8, 2, -10, -85, 73, -74, 92, -17, 97, 76, -7, -39, -22, -27, 58, -5, 43, 56, -91, 23, -92, 25, -68, -47, -20, 34, -87, -66, 68, 70, 90,
+		-48, -28, -67, -44, 50, -75, -20, 78, 53, 17, 10, 20, 73, 9, 5, -83, -16, 80, -74, -36, -97, -40, 18, 84, -51, 87, 56, 95, -90, 83, -34, -56,
+		-44, -2, -2, 63, 27, -79, 42, -94, -33, -88, -10, -45, -43, 89, 66, -64, 9, 41, -46, 24, -71, -30, 48, 53, 67, -46, -78, 8, -72, -99, -33, -12,
+		-76, 43, 40, 3, -44, 43, 92, -87, 92, -80, -49, -59, 99, -30, 26, 89, -46, -92, 86, -98, 86, 5, -97, 37, -13, 52, 86, -72, 87, -100, 37, 68,
+		42, 20, 86, -67, 38, -91, -95, -78, -25, 92, -15, 16, -67, -25, -41, -13, 67, 61, -86, -63, 5, -36, -42, -67, -90, 77, 68, -5, -21, -47, 44, 97,
+		70, 78, -71, -75, -78, -86, 73, 38, -83, 63, 36, -52, 78, 90, -61, 94, 45, -60, 43, 57, -17, 73, 72, 41, -96, 63, 11, -85, -3, 17, 63, 13,
+		-85, 92, -46, 75, -76, 93, 25, 2, -44, 92, -100, -8, -26, -11, 83, 53, 20, -17, 88, -17, -41, -63, -95, -87, 69, -98, 86, 33, 45, 19, 65, 97,
+		72, -32, -7, 36, -89, -26, 65, 24, 85, 37, 38, 51, 24, -3, -58, -77, 63, 6, -57, -20, 58, -18, -73, -46, 0, 90, 16, 67, 36, -23, -5, 22,
+		79, 51, -8, 57, 13, -38, -33, -19, -89, -42, -46, -97, 7, -28, -73, 32, 25, -70, -77, -52, 1, -70, 95, 6, -27, 92, 88, -23, 43, -27, 50, 12,
+		53, 57, 46, -90, -18, 72, -10, -64, -6, 57, -94, -94, 9, -33, -17, 93, -26, 80, -81, -68, -66, -61, -20, -31, 82, 86, 80, -23, -36, -23, 54, 53,
+		-8, -30, -36, -2, 31, 90, -15, 98, 66, -71, -50, -3, 27, 44, -28, -57, 79, -86, 23, -38, 4, -53, -62, -40, 2, 86, -25, 53, -5, 1, -2, 3,
+		-83, 89, -44, 14, -23, 61, 31, 64, 55, 41, -77, 38, -74, 41, 54, -59, -19, 57, 96, 57, -81, 70, -19, 64, -81, 16, 58, 82, 81, -46, 44, 91,
+		7, 32, 15, 57, 96, 9, -73, -58, 93, -31, 48, -89, 86, -17, -46, -22, -21, -85, -57, -5, -95, -68, 17, -14, -51, -95, 24, -94, -74, 65, -20, -96,
+		57, 75, 20, 99, -67, -78, 81, -35, -28, 11, 31, 25, 26, 33, -50, -84, 89, -100, -64, -85, 38, 92, 48, 42, 32, 86, 39, 57, 28, 76, 11, -40,
+		-55, 3, 4, 75, 18, -43, 92, -78, 65, 62, -4, -23, 46, 52, -55, -6, 99, -90, -97, -17, -13, -16, 69, -12, 20, 89, 95, -27, 24, 23, 7, 47,
+		-56, 69, -6, 61, -88, -89, -78, -45, -68, -63, -55, 61, 91, 11, -42, 9, 40, -72, -57, -85, -19, -24, -33, -32, 26, -98, -79, 47, -32, -53, -94, -8,
+		-100, -41, -22, -85, -23, -85, 83, 44, -37, 10, -83, -92, 84, -81, -46, -47, 22, 76, -34, 39, 0, -93, 56, -95, 49, -89, -30, -62, -96, 7, 99, 25,
+		-28, 95, 63, -40, 2, -4, 62, 98, -36, 64, -40, -61, 21, 36, -27, 79, 0, 32, 85, -46, -81, -68, 34, -24, 62, -63, 83, 33, 12, 59, 59, 62,
+		-1, -34, 79, 58, -95, 86, 62, 18, -2, 25, -45, -18, 83, 55, 58, 9, 6, 84, -50, 73, -42, 85, 22, 39, -94, 2, 50, -56, 1, -21, -10, 6,
+		-70, 2, 44, -96, 18, 18, 52, -81, -34, 3, -69, 24, -39, -89, -13, 53, -3, 51, 93, 67, -56, 84, -46, -31, 91, 81, 43, 12, -80, 57, 86, 82,
+		48, 61, 29, -1, 32, 71, -38, 51, -77, -60, 4, 43, -23, 30, 16, 95, 91, -61, -96, -76, 48, 47, 61, 69, 22, 56, -45, -66, 89, -45, 96, -63,
+		-3, -58, 15, -8, 64, -23, -27, -28, 15, 64, 75, -98, 1, -89, 82, 30, -94, 26, 2, 86, -11, 93, -88, -1, 58, 78, -96, 26, -9, 70, 22, 99,
+		-44, 28, 63, 99, 25, -10, 63, -37, 71, -2, 3, 56, 19, 51, 22, 16, 75, 11, -74, 98, -98, 69, 8, -15, 21, 28, 83, 85, -24, -1, -33, 93,
+		65, 32, 86, 58, 79, 83, -79, 46, -48, -73, 64, -99, -64, -96, 14, -74, 7, 26, -99, 59, -47, -34, -30, 27, 21, -83, 67, -32, 2, -44, -85, -63,
+		55, -22, -79, 39, 72, -96, -18, 10, -65, 96, 39, 57, 71, -80, 23, 16, 16, 44, -50, -66, -41, -83, -25, -28, -37, 70, -100, -25, -82, 22, -87, -29,
+		50, 87, -92, 64, 26, 29, 38, 58, 6, -23, -1, 92, 21, -47, -27, -35, 51, 96, -90, -50, -64, 42, 22, 85, 22, 63, -96, -53, 74, -17, 4, 56,
+		-100, 48, -53, 13, -17, -67, 57, 53, -5, 25, -37, -42, -82, 2, -74, 16, -14, 31, 9, 0, 15, 94, -11, 18, 24, -77, 86, 98, -96, -97, 19, 53,
+		44, 87, 73, 13, 96, 2, -87, 60, -43, 71, 68, 74, 32, 74, -77, -3, 19, -44, -28, 83, -16, 1, 76, 44, -41, 28, 16, 44, 55, 35, 54, -54,
+		-17, -16, -40, 83, 81, 65, -23, -50, 60, 66, -100, -80, 95, 32, 73, 79, 36, -46, -12, 68, -97, 60, -50, 59, 57, 25, 78, -62, 5, -48, -72, 81,
+		-27, 6, 14, -51, -17, 43, 91, -38, 15, 93, -64, 54, 71, 41, -43, 74, -72, 84, 17, -91, -17, 82, 53, -17, -64, 9, 76, -100, 0, -33, 99, 67,
+		-81, 95, -83, 33, -18, 18, 50, -43, -90, 41, -60, 1, 24, 11, -47, -65, 71, 78, 64, -21, -6, 82, 88, 46, -14, 69, 52, 35, -92, 72, 5, -50,
+		-5, -53, -9, 23, 86, -67, 44, 37, -58, 5, 54, 36, -50, -25, -86, 46, -25, 96, -89, -17, 57, 88, 27, -16, 38, 42, 6, -64, -19, -36, -82, -17,
+		81, 89, -92, 14, -98, 12, 55, -65, -80, 80, 58, -95, -72, 76, 33, -26, 90, -43, 27, 82, 77, -6, 45, -74, 11, -28, 21, -54, -62, 38, -14, -58,
+		-28, -52, 45, 71, -32, -25, -15, 4, 10, 93, 42, 90, 50, -54, -64, 58, 5, -62, -4, 29, 90, -29, -44, 70, -97, -94, 87, 17, -76, -87, 39, -57,
+		15, 19, 88, -43, -12, 72, -73, 92, 71, -36, 76, -28, 98, -41, 92, -44, -83, -93, 46, -24, 99, 10, -37, -71, -40, -10, 98, -95, 81, -90, 52, -8,
+		-1, 40, -95, 57, -90, 26, -36, 90, -6, 13, 93, 27, 59, 55, 66, 31, -19, 70, -59, 60, -68, 62, 75, -100, 37, 24, 68, 95, 29, -65, -88, -11,
+		-63, 99, -22, -52, -6, -39, -69, 48, 0, -65, -43, -98, 91, -81, -56, 0, 23, -5, -32, 62, 29, 45, -67, 91, -95, -49, 57, 55, -83, 98, 8, -32,
+		44, 25, -78, 12, 36, -15, -18, 43, -14, 79, -85, 50, -19, 53, 23, -60, -85, -29, -55, -70, -25, -45, -40, -70, -92, -35, 78, 1, -79, -86, 45, -84,
+		24, -2, -71, 6, -8, 53, 22, -20, -87, -70, 31, 27, -43, -41, -20, 0, 55, 78, -85, -88, -99, -54, -80, -19, -88, 32, -60, -31, 67, 27, 23, -99,
+		-87, 46, 91, -87, -27, -78, -27, -50, 41, 33, 83, -58, 92, 30, 51, 43, -89, -90, -39, -53, 31, 56, -41, 60, 30, -80, 98, -21, 89, -17, -96, 88,
+		-75, 71, 81, -51, -21, 26, -50, -68, -89, -24, 68, 20, 87, -46, 33, 12, 71, 91, 46, -72, -79, 99, -73, -40, -3, -84, 65, -37, -98, 56, -79, -5,
+		16, 3, -9, -45, -9, 20, -28, -36, 86, -1, -45, -61, -70, -59, 53, -63, 21, 50, 53, -4, -9, -35, -6, 36, 49, 56, -75, -32, 77, 81, -92, -82,
+		63, 41, 25, 46, -30, 58, -38, 47, 47, -6, 5, 51, -4, 78, -71, -21, -40, 51, -30, -70, -76, -13, 11, -89, -15, 78, 49, 32, -79, -60, 74, -86,
+		-17, -92, -94, 66, 19, -45, 28, 93, -8, -94, -35, -99, -65, 78, -93, -43, 22, 39, 59, 15, -97, -34, 20, 40, 14, -61, 69, -38, -73, -99, 54, -60,
+		30, 17, -8, -73, 11, 31, -15, 41, -17, 82, 69, 60, -26, 22, 2, -59, 45, -74, 38, -4, -25, 86, -43, -78, -32, -52, 24, -57, 57, -63, -46, -81,
+		5, 2, 82, -69, -87, 70, 29, 73, 9, 87, -17, -66, 67, -55, 53, -67, 9, 90, -41, 10, 67, 87, -76, -4, -71, 95, -24, 57, -32, 34, -86, -10,
+		57, -76, -6, -15, -6, 53, -3, -99, -98, 81, -33, 44, -26, 97, 79, -3, 13, 61, -45, 87, 46, 86, -64, 43, -78, -38, -34, -3, 93, 45, 86, -23,
+		-54, -77, 45, 20, -31, 26, -52, -85, -74, -61, 17, -4, -97, -5, 40, -61, 72, -64, 49, -22, 86, -78, 81, -54, -63, 11, 70, 68, 58, 14, -78, 78,
+		-36, 19, 20, -32, 80, -28, 47, -49, -14, 86, 69, 24, -23, -29, -98, 30, -28, 6, -42, 82, 95, -58, -32, 38, -11, 23, 13, 13, 31, 21, 12, 36,
+		-72, 35, -87, -85, -40, -16, 6, -62, -44, -42, 94, -71, -40, -7, -13, 58, -75, 31, -4, 9, -2, -51, 46, 16, -57, -64, -28, 21, 80, 47, -15, -100,
+		32, 41, -27, -85, -21, -53, 89, 7, 25, -6, 9, -87, -9, 18, -13, 30, -25, -37, -66, 40, -35, 8, -31, 37, 86, 18, 10, -98, -42, 14, -80, 94,
+		99, -11, 71, -28, -76, 70, -55, 59, -68, 10, 50, -60, 82, 41, 85, 35, 17, -28, -14, 72, -53, 26, -42, -87, 48, -97, -80, -61, -57, 39, 29, 62,
+		-19, 6, -83, -20, 23, -54, 7, 98, 14, -43, 64, 90, -68, 51, -48, 4, -25, -15, 84, -53, 55, -92, 51, -84, -28, -60, -11, 53, -24, -79, -99, 79,
+		47, 59, -7, -81, -44, -90, -35, -50, 63, -82, 55, -94, 8, 71, 2, -30, -91, -100, -66, -53, -22, -18, -55, -7, -20, 50, 54, -47, 85, -93, 48, -3,
+		15, 7, 77, 19, 54, 80, 8, -65, -28, 7, -36, -88, -98, 8, -83, -20, -26, 77, -56, 62, -96, -52, -86, 78, -36, -26, 54, 88, -32, 72, 43, -84,
+		88, -38, 60, 27, -39, 72, 45, -35, -68, 10, 81, 67, -32, -29, -92, -56, 39, 33, 74, 21, -100, -31, 8, 50, -96, 99, -46, 9, -57, -95, -83, -35,
+		0, 44, -68, 18, 58, -55, -74, -43, -21, 81, 56, -91, 96, 33, 27, 98, -30, 32, -47, -57, 92, 30, 21, 33, -98, -97, -39, -27, 14, 38, -77, -2,
+		-74, 8, 85, -60, 64, 10, 64, -36, 56, -36, 22, -89, 47, -7, -2, -55, -58, 59, -71, 95, -34, -9, 19, 99, 53, 69, -96, -27, -65, 24, 70, 44,
+		-77, -86, 77, 85, 38, 26, 41, 70, 33, 63, 6, -14, -69, 6, 76, -94, -74, 51, 86, -12, -34, -30, -35, 14, 9, -15, 93, 16, -38, 22, -89, -68,
+		-39, -83, -80, 71, 5, -17, 88, -65, -8, 74, 54, -41, -72, -50, 56, -15, 86, -1, 78, -71, -69, 72, 52, -46, 49, -67, -39, -57, 10, -93, -57, 8,
+		-19, 34, -66, 23, -44, -55, -96, 35, 70, 98, 90, -28, -41, -36, -70, 59, -43, 14, -45, -37, 17, -21, 3, 36, 56, -73, -16, 6, 41, -61, -100, 52,
+		-74, -24, -38, -61, -72, 39, 75, 2, 23, 40, -37, -81, 81, 40, -5, -19, -62, 99, 32, -27, -54, -86, 7, 59, 59, -84, 48, -83, 65, 84, -88, 5,
+		39, -40, -1, 7, -22, -87, 7, 27, 22, -90, 10, -79, -68, 75, -76, -32, -5, 72, -30, -34, 32, -29, -36, -69, -44, 14, 61, 24, -50, -61, 74, -96,
+		69, 65, -84, 97, -17, 28, -96, 11, -47, -31, -47, -1, 21, 46, 55, -52, 81, -13, -43, -35, 2, -95, 31, -7, 71, 91, 50, -89, -81, -75, 24, 61,
+		24, 72, 42, -76, 47, 36, -64, 41, -25, 13, -38, 98, 79, -53, -76, -80, -55, 87, 45, 30, 79, -89, -14, 92, -40, 11, 25, -69, -15, 94, 25, 48,
+		22, 69, -99, -32, 47, -37, -96, -52, 93, -31, 65, -19, -64, -7, -38, 77, -48, -56, -34, -41, 12, 55, -26, -3, 1, 91, 14, 61, 24, 95, 92, 56,
+		-75, -19, 83, -46, -46, -31, -50, -95, 22, -32, 24, 84, 19, -43, 73, -87, -29, 14, 32, 73, -88, -20, -75, 55, -32, 28, -38, 58, -51, 27, 94, -23,
+		-70, 63, -23, 84, 81, -84, -84, -36, 26, -41, -91, 41, 71, -23, -75, -12, -29, -26, 59, 34, 92, 55, 39, -29, 90, 98, -9, 28, 63, -63, 49, -25,
+		-42, -52, 34, 23, 87, -91, -33, -94, -51, -67, -51, -35, -3, 45, 61, -40, -19, 90, 6, -1, -49, -99, -43, -6, 94, 71, -51, -24, -90, -60, 12, 73,
+		68, 41, -8, -12, 47, 96, -26, -24, -95, -89, -49, -99, 3, 2, 1, 87, -87, -63, -89, 96, -69, -63, -65, 69, 27, -44, 97, 31, -92, -79, 95, -22,
+		-93, 81, 76, -48, -40, -17, -42, 15, -79, -71, 29, 70, -75, -86, 32, 18, -85, -70, -48, 8, 91, -15, 88, -89, 34, 83, -1, -3, -42, -58, 42, 32,
+		-95, -42, 87, -30, 25, 96, -44, 19, -49, 44, -18, -46, 21, -45, 10, -6, -79, 53, 41, -25, -24, -78, 28, 79, -85, -44, 31, -45, 95, -42, 89, 72,
+		-7, 53, 14, 55, -74, -55, -75, 22, -20, 37, 75, 10, -32, -55, 36, 34, -12, -89, 38, -20, 44, 17, -80, -41, 93, -46, -47, 96, -29, 61, 91, -66,
+		-44, -88, -75, -84, -91, 51, -13, -1, 83, 90, -31, 42, 44, -85, 19, 7, -5, -50, -82, -72, -18, 10, -5, -88, 86, -46, -96, 64, -31, 88, -1, 32,
+		-90, -26, -85, 5, 86, -41, -24, 20, -35, 45, -34, -7, 73, -86, -19, -19, -41, 50, -81, -89, -39, 31, -38, -75, 32, -22, 78, -9, -19, 50, -27, -16,
+		54, 41, 88, 30, -74, 47, -89, -90, 86, -33, -40, 56, -33, 71, 89, 63, 45, 29, -26, -32, -1, 3, -83, 82, -92, 32, -4, -60, -5, -47, 68, -26,
+		42, 11, -4, -96, -58, -55, 86, -82, 44, 50, -95, -90, -27, 13, -98, 19, 15, -82, -37, -74, -64, 30, -4, -89, -56, -75, 5, -39, 22, 8, -15, -45,
+		59, -93, -3, 79, -60, -78, -36, -12, 55, -49, 85, -59, -86, -60, -54, 99, -81, 16, 44, -26, -3, -65, 60, 65, -67, 13, 46, -66, -94, -38, -17, -96,
+		52, 84, -30, 91, -75, -50, 74, 91, 64, 57, -32, 56, 60, 90, -60, 23, -40, 48, -11, 66, -4, 15, 25, -51, 88, 4, 6, -38, 26, -100, -63, 68,
+		-77, 51, -55, 36, -42, 8, -94, 91, 45, -92, -52, 33, -98, 51, 82, 62, 36, 7, -72, 42, -13, 60, -59, 66, -51, 71, -10, -86, 40, -6, 0, -12,
+		-99, -28, 36, -30, 80, 25, -9, -59, 29, -19, -6, 26, 8, 11, -80, -79, -8, 55, 76, -74, -97, 14, -83, 45, 98, -62, -41, 69, 66, 8, 31, 64,
+		-17, -82, 58, 22, -45, -34, 28, -4, -74, 25, 56, -39, -69, 18, -67, 83, 34, -40, -76, 99, 2, 14, -65, -27, -80, -94, 14, 70, 92, -46, 5, -11,
+		9, 68, -23, 11, -46, 17, 3, 43, -44, -8, -48, 27, -52, -75, -88, -72, 57, -59, -60, 21, -94, 62, 82, 92, 38, -41, -76, -53, 13, -33, 94, 13,
+		65, -76, 11, 96, -28, 86, 73, -22, 87, -96, -91, 56, 29, 0, -99, -76, -55, -11, 11, -12, -73, 95, 51, -82, 93, 30, -92, -36, 58, 34, -85, -29,
+		-90, -44, -37, -59, -95, 79, 34, 67, -94, 41, 91, 47, -66, -99, -62, -84, 8, -93, -64, 57, 95, -34, 98, -11, 35, -43, -31, 95, 33, -10, 42, 84,
+		17, 77, -38, 83, -49, 85, -89, -55, -63, 71, 30, -20, 51, 65, 37, 90, -2, -45, -46, 10, -25, 26, 42, -7, 13, -16, 62, 48, 56, -62, 48, -37,
+		-21, 38, 97, -53, -47, 74, 2, -19, 87, -15, 49, 46, -47, -17, 42, -30, -15, -34, -38, 57, 23, 33, -88, 97, -76, 92, 52, 12, 64, -29, 23, 19,
+		-18, -49, -18, -62, 84, 74, -82, 15, -3, 20, 74, 61, -71, -57, 77, -100, 66, 41, 32, -43, -46, -82, -10, -56, -85, 67, -10, -58, 98, 98, 66, -72,
+		-48, 88, 42, 34, -20, -4, -33, 98, 12, 33, -15, -70, 27, -23, -37, 23, -52, 89, -56, 25, 37, 23, -28, -63, -47, 61, -53, 11, 8, -34, 17, 9,
+		82, -72, -78, -92, 67, 32, 33, -51, -51, -78, 30, 19, -44, 49, 44, 36, -60, -37, -9, -95, 57, -20, 78, 74, 13, -1, -11, 13, -18, 56, 12, 35,
+		53, 38, -70, 93, -60, -2, 65, 76, 85, -2, 21, 93, 38, 14, -56, 52, 26, -42, -12, 18, 79, 47, -75, -21, -51, 68, -100, 54, 9, 6, -58, -22,
+		-15, 21, -67, -36, 22, -62, 8, 18, 76, -36, 27, 99, -82, 24, 9, -53, -23, -63, 56, 98, 85, -27, -77, 61, -54, -33, 43, -43, 48, -4, -84, 97,
+		-40, 56, 65, -86, 30, 44, -13, -40, 75, -22, -1, -44, -96, 45, 10, -41, 49, 95, 21, -39, -26, 15, 64, -14, 95, -43, -53, -77, 61, -55, 48, 3,
+		88, 46, -66, -16, 86, -10, -70, 48, -12, 71, 10, 12, -5, -51, 32, 51, 71, -58, 7, -83, -24, 56, -51, 41, -49, -41, 52, -89, 67, 60, -70, -77,
+		-54, -68, 6, -51, -51, -3, 59, 50, -96, -91, -7, 62, 51, -45, -10, -81, -7, -41, -17, 22, -2, -81, 15, 64, 64, -8, 4, -53, 84, 76, 93, -54,
+		-49, 15, 43, -11, 53, 5, -99, -39, 30, -30, 3, -48, -72, -70, 56, -51, -75, -62, 93, 77, 11, 23, 97, -93, -66, -63, 32, 12, 73, -40, -12, -56,
+		71, -74, 68, 78, 98, 85, 92, 66, -17, -16, -25, -92, -3, 61, -22, -53, 99, 79, 35, 50, 24, -20, 40, -47, 18, 56, 88, -93, 97, -55, -90, -81,
+		88, -3, 91, 9, -61, -76, -1, -1, -99, -62, -9, 10, 90, -15, 79, -89, -89, 14, -75, -17, 77, 45, 95, 69, -76, -10, -48, 18, -42, 57, -57, 21,
+		-60, 43, -74, 99, 48, 44, -93, -75, 27, -87, 63, 32, -5, 32, 60, 1, 52, 62, 56, 52, -78, 67, 46, -75, 87, 24, -44, 16, -27, -81, -65, -16,
+		-94, 32, 48, 44, 29, -90, 77, 65, 40, 90, 24, 85, 10, 15, 29, -55, 19, -42, -86, -5, -46, 29, -90, 26, 92, -59, 35, -42, 48, -94, 59, 9,
+		-24, -30, 19, -71, 71, -13, -47, -44, -3, -79, -19, -10, 7, -59, 50, 7, -32, -24, -54, 97, -16, 51, -3, 68, -55, 19, -62, -34, -87, -63, 39, 7,
+		-45, -74, 30, 83, -66, 95, 70, 25, 49, 15, 10, -87, 13, 69, 82, 16, 15, 72, -29, -29, -74, 90, 80, -38, -42, -29, 22, -45, 48, -15, -8, 79,
+		-40, 99, -23, 53, -60, 90, 4, 87, 28, -76, 72, -64, 12, -42, -7, 85, -57, 5, -92, 47, -78, 55, 22, 79, -93, 0, 30, -89, 86, 75, -27, -33,
+		-82, -50, -76, -14, 20, 32, -90, 20, 45, 70, -15, -34, -90, 70, -44, -57, 3, 85, -81, 88, -95, 56, 58, -17, -92, 22, -75, 59, 31, 54, 19, 82,
+		22, -76, 33, -58, 39, -17, 2, 9, -3, -23, 39, -5, -33, 10, -23, -1, 17, 84, -15, -87, 77, -78, 84, -32, 88, 93, -56, -42, 2, -61, -22, 14,
+		-40, 85, 95, -95, 51, -13, -12, 96, 11, -97, 4, -49, -80, 99, -51, -75, -80, -57, -53, -71, 10, -1, 63, -3, 83, 52, 67, -40, -57, -14, 0, 51,
+		67, -13, 12, 79, -9, -51, -68, -85, -68, 22, 31, -31, -61, -85, -38, 58, -94, 61, 49, -100, -48, -60, 57, 93, 77, 6, 82, -65, 93, -97, -18, -23,
+		26, -38, 81, 43, -19, -67, 40, 88, 93, 13, 0, 83, -16, -29, 41, -59, 35, 27, 29, 39, -10, -39, 35, 54, 20, 34, 7, 71, -68, -35, 70, -11,
+		42, -20, -87, -43, -16, 13, 46, -17, -94, -32, 34, -51, -13, 98, -18, -87, 62, -88, 94, -10, -89, -38, 61, -45, 61, 5, 28, -29, 11, -40, -94, -93,
+		-66, -94, 21, 69, 55, -40, 59, -93, -5, 95, -32, 31, 22, 0, 12, -28, 88, -35, -96, -89, -69, 78, -82, 71, -35, -38, -6, -66, -7, 7, 29, 75,
+		6, -51, 87, -34, -38, 81, -43, -8, 93, -39, -31, 90, -15, -9, -66, -96, -50, 41, -12, 38, 15, -18, -23, -12, -46, -23, 53, -91, 81, -95, 18, -79,
+		47, -56, 76, -88, -77, 87, 40, 83, 60, 51, -23, 37, -9, 18, 78, -76, 95, -47, 75, -15, 90, -48, 66, 59, 25, -79, -14, -100, -32, -74, -10, -99,
+		21, -56, -36, -94, 5, 5, -99, 53, -99, -27, 20, 23, 66, 75, 77, -40, 30, -65, 42, -72, 46, 46, 2, 19, 88, -2, -70, 14, 47, 77, -35, 83,
+		80, 43, -33, 90, -32, -32, -8, 78, -61, -94, 92, -44, -73, 35, -70, 7, -78, 45, -3, 59, 55, -44, -64, 32, -1, 63, 85, -96, -70, -58, 88, -63,
+		31, 1, 76, -84, -94, 51, -23, -86, 73, -69, 91, -22, -3, 55, -50, -3, -100, -4, -21, 78, -29, 78, -62, 83, 35, -6, 81, -24, -36, -92, -69, -20,
+		-18, -86, -17, -54, -19, -11, -8, -34, -12, 30, 25, 24, -47, 6, 90, 64, -88, 56, -29, -61, -75, -1, -48, 52, -32, 64, 39, -57, 77, 90, 9, -71,
+		-40, 9, 42, -91, -85, -59, 46, -7, -77, 21, -66, -42, 65, 6, -51, -80, -25, 47, -37, -43, 19, -21, -91, 8, 90, 79, 50, 69, -34, -34, 21, 99,
+		7, -21, -46, -73, -52, 71, 49, 85, -16, -29, 4, 73, -85, 37, -47, 26, 70, -2, -35, -75, -91, -62, 18, 7, -8, 80, -45, -89, -21, -94, 65, -24,
+		71, -42, -35, -13, 64, 10, -23, -49, -90, 71, -48, -96, -16, -69, -14, -28, 48, -85, -37, 64, 67, 41, 63, -55, 44, 17, -71, -18, -63, -96, 55, 29,
+		54, 25, -71, 22, -20, -75, -29, 86, -69, -58, -48, -16, -76, -28, -5, 13, 64, -20, 11, 6, -65, 14, -92, 12, -3, -60, 37, -44, 71, 21, 84, -83,
+		-17, -83, -3, -79, -11, 80, 88, 46, -33, 71, 94, 96, 36, -6, 72, 59, 23, -48, -57, 12, -78, -87, -50, -95, -81, -15, 44, -32, -46, 2, 62, 61,
+		-27, -64, -91, 15, 20, 29, -51, -79, 71, 38, -46, 24, -4, -92, 27, 50, -27, -86, 33, -55, -96, 50, 0, 65, -72, -59, -29, -36, 5, 2, -37, 15,
+		-39, 94, 30, 63, -20, 18, 48, -53, -54, 2, -62, -61, 69, 28, -51, 12, 25, -37, -16, 66, 98, 83, 82, 83, 64, 63, 43, -95, 93, -46, -58, -69,
+		-74, -16, -81, -79, 55, 48, -98, 37, -8, -58, -83, -63, 24, -84, -78, 74, -60, -73, 28, -34, -87, 84, -7, -26, 63, -31, 62, 70, -82, 17, 72, 72,
+		58, -89, -74, 62, 51, -73, 91, 47, 0, -32, 26, -48, 10, -29, 90, -78, 50, 15, -94, -67, 90, -7, -88, -18, 24, 57, 21, -6, 41, -58, -55, -26,
+		41, -86, -35, -40, 47, -5, -77, -21, -12, 16, 86, -17, 15, -5, 66, -73, 4, 19, -19, 85, -63, -39, 15, -96, 34, -93, 87, -68, -48, -71, 12, -60,
+		93, 18, 65, 8, -69, 51, 49, -92, -70, -12, 34, -64, -90, -67, 16, 16, -26, 88, -51, -4, 20, -97, 78, 3, 26, -93, -19, -16, 94, -20, -43, -27,
+		43, 14, 1, -42, 43, -48, -66, -10, -57, 52, 54, -97, 4, 63, 71, -88, 74, -27, -100, -68, 21, -93, 78, -35, 22, -93, -20, 70, 65, -25, -43, -96,
+		-65, -62, 33, 2, 9, 52, 33, -51, 98, 20, -74, 30, 63, -19, -89, -8, -39, 90, -61, 92, 84, -52, 15, -94, 23, 8, -61, -13, -11, -91, 63, 13,
+		24, 4, 98, 62, 60, 77, 21, 43, -16, -19, 88, -97, 75, -27, 65, -79, -17, -91, 87, -79, -49, 26, -67, 28, -83, 13, -72, 9, -28, -81, -98, -11,
+		-47, -26, -59, -43, -94, -83, -38, 22, -79, 91, -45, -5, -56, -77, -23, -90, -78, 3, 14, -78, -82, 11, 47, -77, 75, -84, 75, 23, -80, 43, 35, -35,
+		87, 88, 61, -15, 74, -77, 10, -89, -37, 14, 74, -52, -87, 27, 46, 99, 37, -47, -57, 96, -90, -88, -78, 39, -23, -3, -94, 92, -86, -66, 71, -55,
+		54, -72, 6, 78, -46, -94, -99, 57, -10, -9, -31, -43, 85, 17, -84, -52, 46, -88, -18, 86, 14, 48, -41, -22, -88, -8, 98, 92, 66, -89, -57, -45,
+		-69, -60, 64, -73, -40, -97, 76, 23, 20, -7, -15, 81, -27, -98, -63, 38, -77, 12, 42, -21, 54, 38, -42, 85, 75, -22, -15, 15, -41, 81, 7, -17,
+		-71, 6, 38, -19, -91, -6, -43, -44, 17, -95, 9, 86, 2, -33, 15, -91, -14, -81, -41, 61, 3, -24, 89, -80, -70, 67, -16, -27, -68, -91, 44, 33,
+		-47, -66, 64, 87, -97, -29, -69, 84, -67, -58, -89, 4, 35, 11, -47, -84, 97, -27, -70, -5, -32, -72, 62, 21, -36, 42, -36, 36, 93, 43, -8, 29,
+		-99, -47, -77, -10, -64, 24, 92, 71, -94, -79, -13, 44, -100, 87, -77, -18, -15, 39, -29, -51, -22, -54, -58, 71, -81, 84, 10, -42, -74, 80, 81, -13,
+		-67, -79, 23, 3, -57, -17, -96, -75, -91, -81, -24, -43, -51, -12, 96, 98, 34, -71, 51, -42, -100, 72, 10, 45, 49, 91, -57, -8, -69, -4, 19, -82,
+		-38, 19, -82, -92, -4, 49, 7, 36, -29, 47, -7, 69, 70, 42, 0, -48, 78, -36, -22, 99, 31, -4, 59, -8, 38, 47, 98, -41, 28, -87, 50, 18,
+		-22, -2, 50, -60, -15, -6, -8, 31, -67, -57, -60, 48, -58, -6, 50, -54, 80, 93, -62, -39, 9, -18, 2, -66, -14, -92, -11, -67, 36, -7, 33, 92,
+		88, 58, 63, 2, -24, 77, 82, -85, 6, 95, 54, -14, 79, 63, -14, -56, 32, -59, -43, 22, 33, 25, 1, 37, 15, 92, 0, -45, -97, -49, 51, 70,
+		-11, 5, 86, -48, -41, -13, -23, 26, 68, -91, 52, 79, -66, -19, 92, -69, -62, -41, 90, -37, -93, 56, 8, -86, -17, 34, -60, 95, 21, 56, 33, -59,
+		12, -74, 24, 89, 37, -56, -53, 79, -45, 66, 31, -11, -2, -34, -18, 55, -12, -32, -92, -100, -93, -86, -33, 51, -67, -3, -82, 52, 15, -31, 64, -84,
+		-11, -28, 68, 71, -99, -74, -67, -4, -75, -46, 35, -3, -70, 20, 2, 40, -49, 29, 70, -6, -58, -69, -48, -13, 23, 78, 36, 72, 84, 21, -56, -53,
+		-24, 83, -24, 19, 19, 85, -45, -18, -33, 4, 19, 73, 87, 66, -22, 73, 51, 58, -82, -7, -4, 41, -8, -12, -35, 96, 11, 97, 89, 34, -70, 85,
+		-26, -86, 41, -94, -36, -2, 20, 63, 60, -16, 25, -21, -2, -5, -14, -4, -14, -34, 65, 0, -10, 24, -52, 91, -26, 64, 98, 38, -82, 20, 93, -74,
+		-15, -49, -16, -23, 45, -16, -60, 22, 14, -54, -37, 37, -19, -69, 59, -96, 24, 53, 24, 31, -18, 59, -27, 24, 72, 22, -35, -74, 59, -28, 68, 75,
+		52, 57, -96, 19, 36, -68, -11, -2, 34, 23, -30, -34, 32, -84, -91, 19, -44, 9, 0, 32, -75, -75, 47, -60, 68, -36, 75, 88, -99, 26, 89, 36,
+		60, 31, -77, 27, -71, 62, -26, -75, -70, 85, -50, 82, -13, -49, -90, 85, -88, 17, 40, -32, 55, -56, 62, -70, 38, -89, 42, 4, -57, 54, -5, -55,
+		-79, -86, 62, 65, -37, -74, 95, 40, 69, -1, 24, 38, 8, 5, 51, -68, 36, 44, -48, -22, 10, -60, -39, 65, -80, 33, -15, -66, -97, 33, 94, 50,
+		26, 25, -27, -20, -8, -12, -30, -90, -8, 52, -90, 63, 91, -50, -23, 35, -38, -45, -55, 15, 63, 50, -86, -19, 63, 94, 4, -62, 50, -85, -26, 7,
+		95, 81, 40, 41, 84, -50, -31, -21, 38, 58, -29, 0, -16, -5, -35, -23, -95, 43, -21, 36, 1, -100, -33, 31, 42, 3, -19, 87, 31, 73, 40, 94,
+		15, -32, 53, 26, -12, -52, -23, 59, -82, -82, 87, 15, -72, 17, 46, 93, 81, 95, -4, 42, 42, 59, -79, 3, -92, -95, -66, -88, -90, 71, -68, -25,
+		-30, -44, -2, 5, 72, 51, 79, -48, 77, -67, -20, -55, -57, 41, 98, 64, -34, 1, -97, -53, 49, -72, 26, -2, -80, -85, 80, 72, -6, 93, -58, -70,
+		15, -64, -19, -85, -1, 57, -12, -78, -42, 44, -73, -75, -18, 9, 54, 3, 60, 28, 76, -31, 62, -39, -64, -20, 82, 38, -81, 97, 98, -21, -72, 30,
+		-20, -41, 12, 97, 64, -86, -81, -61, -76, -22, -68, -4, 75, -61, -13, -6, 95, 51, 86, -38, 89, -93, -9, -14, 2, -8, -95, 95, 88, -32, 39, -45,
+		-11, 4, -94, -91, 75, 13, -35, 90, -86, -64, 26, -21, -15, -16, -18, -52, -30, -98, 3, 51, 30, 22, 57, 6, 6, -96, -75, 65, -45, -90, 53, 51,
+		86, 30, -76, 99, -17, 23, 59, -96, 8, -34, -41, 58, -99, 48, 89, -8, 98, 99, -69, 48, 75, 45, -12, -38, 19, -18, 64, -35, 77, -20, -36, 90,
+		21, 10, -97, 90, -53, 98, 58, 90, 4, -6, 79, 58, 5, 92, 42, 99, -50, -49, -1, -43, -67, -65, 57, -17, 45, 15, 16, 4, -18, 55, -75, -32,
+		89, 62, -54, -61, 75, 68, -56, -17, 78, -5, 77, -87, 73, 99, -84, 67, -53, -20, 81, -45, 61, -51, 6, 68, -26, 66, 39, -78, 59, 53, -11, 0,
+		20, 79, 10, -21, 94, -5, -39, -59, 23, 36, 12, 70, 93, -76, 54, 5, 94, -54, -6, 95, -48, -50, 96, -5, 88, -35, -53, -85, 58, -75, -51, -13,
+		88, -93, 88, -39, -70, 55, -18, 40, -47, -12, -15, -32, 60, 38, -52, 28, -35, -68, 28, 53, 36, 83, 54, 16, 83, 44, -14, -3, 43, 82, -69, -8,
+		85, -67, 51, -17, 78, -99, -4, -42, -22, -94, -71, 99, -54, -67, 50, -81, 56, 73, 87, 89, 80, 35, -78, 64, 96, 26, 13, -13, -79, -73, -20, 21,
+		83, 46, -73, -9, 83, 94, 98, 29, -46, 45, -40, -18, 91, -3, 58, -72, -35, -2, -74, 4, -86, 57, 87, -68, 77, -39, 57, -10, 83, -86, -51, -95,
+		-64, -32, -25, -13, 61, 65, -17, -14, 90, 13, 77, 28, 27, -8, 79, -66, -86, 47, -47, -83, 9, -52, 90, -39, 84, 55, 81, 12, 59, 68, -52, 17,
+		-61, 83, -68, 3, -59, -5, -100, -47, -10, -11, -95, -25, -34, -40, -37, 9, 58, 0, -93, -26, -19, 23, -84, 78, 84, 5, -27, 94, 15, 60, -51, 54,
+		72, 28, 8, -59, 94, -56, 58, -54, -81, 16, 3, 52, -90, 33, 27, -99, 66, -27, 95, 55, 22, 73, 76, 24, 1, -49, 71, -81, 39, 5, 33, -45,
+		-62, -5, -29, 29, 12, 4, -46, 3, 62, 21, -22, -71, 55, 55, -83, 38, 59, -37, 84, 46, -92, -75, 2, -44, -94, -68, -30, -92, -57, 3, 11, 2,
+		-19, 32, 77, 20, 69, 59, -77, -3, 50, -56, 29, 88, -98, 24, 48, -4, 37, 94, -83, 57, -47, -18, -53, 70, -99, 54, -16, 35, 35, 61, -21, 52,
+		-64, 10, 51, -2, -82, -9, 53, -5, -77, 95, 85, -11, -68, 55, -8, -21, -24, -24, -77, -99, -41, -17, 90, -80, -78, -71, -16, -11, -30, -73, 50, -16,
+		26, -53, 4, 37, -19, 97, -6, 30, -70, 19, 46, -36, -12, 66, -85, 63, -21, -60, 29, 31, -64, 53, -83, 48, -35, 7, 12, 9, -70, -7, 69, 45,
+		97, -45, -1, -17, -17, 57, 69, 47, 5, 21, -64, 36, 93, 10, -34, 75, 20, 93, 58, 0, 18, 52, -12, 42, 97, -27, 91, -4, 17, -2, 33, -31,
+		-91, -95, 54, 96, -43, 53, 35, -90, -1, 59, 22, -24, -40, -17, -54, 63, -78, 93, -21, -10, 19, 92, 52, -69, -78, 1, 30, 29, 31, -36, 17, -65,
+		92, 31, 14, -24, 79, -28, 74, -76, -28, 22, -61, -92, -68, -39, -85, 69, -21, 0, -85, 97, -63, -21, -8, -50, 81, 62, 32, -11, 25, 22, 67, 48,
+		-100, 6, -46, 43, -50, 69, -14, 22, -70, -30, -69, -40, -71, -43, 54, -7, -7, 77, -7, 1, 58, -79, 15, -60, 44, -85, -12, -32, -72, -48, -90, -69,
+		79, -30, -64, 82, 11, -68, 15, -46, 58, 17, -54, -20, 36, 65, -96, 10, -93, 88, 33, -83, 42, -89, -35, -34, -59, -22, -49, -13, -34, -21, -8, -100,
+		-45, 58, -23, 94, 67, -81, -69, 42, -53, -82, 95, 99, -58, 35, -38, 55, -59, 22, -17, -16, -70, 10, 58, -11, -73, 58, 1, -76, -7, 99, 0, -55,
+		25, -61, 16, 85, 16, -18, -34, 64, 82, -79, -84, 48, -26, -97, -46, -87, -52, -3, -28, -43, -82, -16, 38, -66, 74, -83, -90, 98, -65, 95, 74, -93,
+		-76, -69, -74, 54, -49, 93, -44, 26, -76, -93, 57, -85, 41, 33, -97, 8, 13, -8, -95, -98, 86, -75, -27, -99, -62, -71, -55, -7, -43, -65, -36, -82,
+		-27, -64, 75, -74, -68, -52, 42, 48, 95, 19, -88, 42, 66, 93, -31, 79, -31, 10, 33, -67, -32, -15, 17, 96, 16, -9, -48, -24, -22, -31, -55, -39,
+		31, 52, -1, 24, -32, 29, -50, 68, 59, 86, -94, 79, -36, 40, 38, 6, 39, -93, 10, -67, 73, 3, 5, -40, -29, -76, 24, -62, 86, -18, -54, -85,
+		85, 91, 51, 45, 27, 11, 92, -70, 21, -62, 99, -40, 53, -82, 94, 66, 91, -27, 79, 79, -54, -11, 24, -79, -51, -18, -28, 8, -20, -22, 3, -20,
+		-21, -38, -94, -9, -86, 36, -90, -97, -20, 25, 41, -66, 41, -79, 89, 63, -62, -45, 58, -12, 64, 15, -64, 61, 11, -66, -82, -84, -16, 70, -38, -10,
+		83, -76, 99, -40, -99, -28, -51, 25, 65, 26, -56, -27, 36, -98, 90, -50, -8, -92, -56, -21, 21, 41, 85, -62, 31, 7, 93, 19, 38, 9, 25, -13,
+		-67, 80, -17, 41, -13, -70, 83, 7, 9, 80, -59, -3, 38, -31, 0, -33, -5, 16, -79, 9, 52, 97, 82, 97, 82, 89, 76, -53, -11, 55, -8, 17,
+		55, 97, 24, -15, -4, -22, 7, -50, 81, 69, 8, 90, -14, 22, 62, 26, 22, -28, 95, 44, 56, -2, -79, 99, -58, -84, -82, 7, -79, 61, 56, -20,
+		-40, -34, -58, 95, 59, 37, -3, 90, -63, -51, -88, 88, 5, 69, 86, -70, 27, -51, 29, -21, -34, -1, -9, 95, 4, -65, -31, -5, -51, 52, 70, -12,
+		-68, -66, -84, -14, 12, -27, 57, -82, -82, 5, 26, -88, 59, 11, -55, 65, 24, 89, -7, -45, -12, 51, 32, -86, 53, 80, 60, 54, 73, 50, -17, -67,
+		79, -62, 72, 60, -25, -56, 4, 58, 58, 76, -93, 65, -70, 81, -80, 38, 34, 10, -17, -5, -56, 2, 54, -32, -14, 15, 76, 46, -30, -100, -41, 33,
+		-11, -94, 55, -95, -96, 61, 14, 30, 16, -43, 82, -4, -58, -62, 81, 21, -43, 40, 1, 9, 43, -67, 66, 6, 72, -24, 44, 89, 61, 65, -76, 79,
+		-46, -66, 81, 48, 1, -56, -35, 47, -93, -81, 54, -60, 57, -4, -35, 40, -7, 94, 7, -62, 68, 47, -50, -49, 7, -83, 27, 95, -76, 17, 32, -93,
+		75, 8, 57, 86, -91, 57, -36, 66, 53, 70, 22, 87, -1, 28, -86, 6, -75, 30, 36, -18, -67, -14, -52, -7, -32, 61, -2, 94, -71, 50, 92, -31,
+		-27, 62, 88, -70, -96, -7, -99, -32, 58, -47, -53, -100, -4, 89, 34, -49, 93, 99, -98, -33, -53, 64, -55, -76, -62, 58, -29, -48, -99, 6, 91, 22,
+		-59, 55, -12, -53, -19, -88, -41, 17, -5, 56, -65, -40, 95, 74, 70, -88, -89, -53, 60, -90, -78, 54, 81, 52, -4, -55, -17, -69, 94, 28, -52, 39,
+		-17, -74, 65, -98, 41, 16, 14, -24, 93, 88, -73, -57, -45, -100, 30, 8, 96, -43, 92, -49, 69, 14, -12, -58, -27, -4, 9, -38, -36, -8, -14, 75,
+		-61, -79, -28, -93, 72, -26, 43, 90, -47, 30, -51, 91, 85, 28, 33, -72, 86, 79, 24, 77, -62, 32, 50, 36, -22, 29, 55, -89, -33, 77, 88, 11,
+		-40, 36, 80, 61, -75, -40, 80, 22, 54, -76, 93, -24, 83, 13, -50, -15, 72, -61, -58, 64, 17, -39, -17, -95, 63, 63, -28, -3, 61, -88, -90, -35,
+		-8, 23, 30, 44, -8, -61, 54, -27, 69, 63, -50, 95, 34, 28, -72, -41, -1, 8, 86, -95, -86, 93, 84, 21, -12, -12, -87, 69, 12, -24, -45, 86,
+		-43, -11, -29, -73, -7, -35, 91, 0, -77, -27, -77, -7, -11, -94, 1, -77, 47, 67, -45, -28, 44, -55, -78, -3, 21, 1, -61, -79, 57, 87, -67, 47,
+		37, 92, -88, -97, -90, -23, -59, 81, -25, -8, 97, -93, -74, 48, -83, 77, 79, 21, -90, -66, 37, 64, -39, 53, 16, -11, 14, 13, -29, -29, -69, 75,
+		-30, 53, -10, -93, 32, -35, -42, -3, 82, -100, 88, 75, 8, 47, -78, 97, -31, 80, -58, 80, 17, 68, -70, -48, -75, 15, -49, 37, 97, -3, -73, 55,
+		53, 82, 46, 72, 91, -11, -36, -60, 69, 53, 20, -1, -69, -83, -84, 94, 42, -58, -25, 71, -55, 20, -11, 27, -41, 81, -73, 34, -3, -15, -41, -23,
+		43, -66, 42, 93, -35, 13, 5, 11, -31, 32, -33, -32, 23, -33, 74, -61, -8, 59, -69, 42, -7, 27, -58, 52, -30, -82, 86, -73, 47, -66, 23, -54,
+		18, 63, 4, 96, 4, 87, 83, 2, -97, 83, 13, 11, -60, -79, 52, -4, -15, -68, -50, -42, 42, -43, 55, 13, -7, 49, -21, 94, 6, -3, 52, 36,
+		-59, 54, -95, -34, 64, 75, 3, 27, -49, 8, -4, -81, -39, 47, -71, 75, 14, 14, 5, 76, 85, -27, 59, 90, -71, -1, -48, 16, 90, -94, -22, 56,
+		46, 40, 64, -80, 18, 32, 28, -25, -17, 38, 16, -75, 85, -72, -45, 38, 86, -45, 31, 77, 79, 72, -37, 58, -53, 20, 6, -15, 38, 94, -88, -77,
+		3, 99, -33, -86, -29, 70, -28, 33, 78, -55, -35, -29, -5, -77, 79, 1, 94, 15, -54, 93, 87, 28, 28, -7, -12, -7, 69, 49, 29, -21, -41, 91,
+		76, 72, 97, 54, 77, 78, 22, 78, -90, -13, -10, -78, -91, 53, -6, 91, -22, -27, 95, -100, 43, 34, 2, 90, -65, 16, -41, -87, 51, -76, 20, -63,
+		37, 39, -85, -48, 99, -84, -21, 54, 33, 55, 41, 65, -12, -2, -8, 31, -31, -7, -86, 14, 70, -44, 0, 86, -98, -45, -85, -49, 6, 56, -24, 33,
+		32, -69, -15, -75, -47, 93, 84, -89, -69, -98, 40, 52, 84, 52, 37, -100, -61, -20, -56, 7, -67, -15, -79, -18, 62, 58, 65, 46, 61, -79, -54, -8,
+		38, -24, 18, 7, -62, -3, 65, 44, -14, -6, -67, -79, -85, -17, -48, 23, -71, -38, 51, 56, -70, -32, -52, 94, -16, 24, -95, 90, 5, 15, 96, 21,
+		14, 13, 34, 46, -92, 42, 10, -60, -47, -17, 74, -46, -79, 39, 84, -26, 28, -23, -18, -40, -22, -41, 9, -55, -41, 74, -22, 1, 27, -31, 66, 43,
+		34, -14, 49, 5, -40, -69, -86, -75, 55, -87, 66, -86, 34, 16, 61, -65, 82, -56, -46, 63, 55, -86, 17, 54, -71, -16, -76, 84, -36, 21, -66, -61,
+		77, 20, -95, 24, 91, -12, 3, 87, -34, 45, -75, -50, -45, 25, -42, 14, -38, -28, -83, 93, -91, 78, -44, 51, 40, -61, 34, 45, 35, 84, 81, 66,
+		31, -26, 14, 71, 57, 43, 28, -21, 14, 25, 67, -36, 72, -12, 14, -82, -26, 95, -77, -60, -22, -30, -11, 60, -29, -19, 91, 19, -99, -96, -87, 58,
+		-62, -12, -19, 32, -71, 64, 33, -72, 27, -49, -43, -23, -66, -96, 64, -93, 36, 39, -21, -29, 12, 25, 43, -99, 37, 80, 26, 26, 7, -13, 39, -76,
+		89, -81, 28, -85, -4, -19, -29, 78, -27, 28, 33, 90, 52, -94, -75, -98, 63, 35, 90, -7, 68, 49, -53, -90, -19, 11, 71, -58, 20, -86, 47, 73,
+		58, 59, -25, -46, 1, -95, 65, 14, 84, -69, 27, 88, -5, 23, -19, -90, -5, -95, -86, -70, 75, -43, 59, 65, 69, 73, -95, 2, 21, 25, -47, -57,
+		-90, 51, -56, 50, -39, -40, 13, -90, 53, 12, -68, -15, 33, -11, -65, -61, 57, 10, -63, -50, -9, -30, 68, 31, -16, 90, 88, -27, 90, 95, 56, 8,
+		-10, 6, -39, 18, -49, -100, 82, -85, 15, 14, 3, -13, 43, -94, 18, -4, 98, -13, -80, -57, -66, -43, 9, -91, -81, -45, 85, 62, -57, 36, 33, -18,
+		-31, 55, -54, -28, 91, 74, 10, 60, 45, 71, -13, 54, -3, 77, -45, -83, 46, 60, 36, 55, 98, 38, -61, -25, -4, -25, 74, 59, 62, -85, -52, 47,
+		-41, -75, 7, 39, 17, -29, -43, -47, 48, -52, 77, 88, 92, -53, -2, 42, -77, 68, -19, 68, 70, 91, -51, 0, -95, 72, -62, -83, 97, -5, 69, -3,
+		-72, 42, 80, 91, -75, -16, 99, -99, -82, -67, -75, 1, -31, -91, -51, 82, 53, -22, 88, 24, -67, -75, 72, -63, -58, 55, 16, 19, 40, -51, -85, -81,
+		79, -9, 74, -18, -66, -83, 55, -42, -75, -44, -86, 20, 80, -50, -48, 82, 14, -74, -43, -26, -48, 86, 87, 85, 1, -96, -87, -45, 26, -53, 19, 73,
+		61, 84, 98, 94, -5, -47, -69, -1, 32, -84, 59, 22, 90, -93, -62, -60, -100, 36, -35, -18, 90, 70, -47, 97, 89, -41, -19, 78, 53, -29, -19, 80,
+		-18, 6, -55, 92, -95, -61, -73, 94, -81, 16, 6, -11, -10, 15, 11, 63, -55, -31, -66, 45, 72, -12, -10, -34, -75, 53, 39, 80, -95, -58, 25, -58,
+		4, -24, -18, -88, -97, -63, -74, 81, 77, -94, 29, -77, 39, -89, 24, 87, -70, 14, -38, 26, -74, -73, -33, 33, 20, -26, -15, -71, 48, -37, 21, 71,
+		-97, 82, -11, -19, -44, 88, -13, -97, 37, -63, 79, 35, 36, 60, -13, -22, 52, -39, 37, -42, -78, 25, -95, 8, -30, 26, 16, 53, -87, 55, 85, 25,
+		67, 92, -35, -49, -83, -70, 85, -82, 14, 27, 80, -76, 42, 99, -79, -40, -70, -70, 86, -84, -31, -70, -34, 67, 82, -31, 5, -73, 59, 38, 84, -92,
+		-99, -58, 18, 6, 73, 94, -93, 1, -7, -53, 37, -17, -99, -99, -89, 71, 25, -33, 86, 61, 24, -9, -37, -93, 2, -6, 62, -32, 55, -2, 63, 35,
+		-99, 89, 63, -80, -49, 92, 45, -8, -28, 77, 32, 8, -42, 31, -76, 74, 54, -37, 27, -23, 7, -77, 22, -56, -88, -86, -66, 50, 33, -48, -51, -89,
+		43, 14, -55, -81, 15, -18, -93, 86, 17, 20, -31, -57, -20, -1, -13, 71, 22, -22, 10, -27, 15, 31, 54, -65, 57, 0, 41, -40, -76, -56, 62, 32,
+		38, -33, 29, -25, -53, -76, 15, -6, -18, -77, 36, 68, -78, 40, -71, -82, 54, -4, 2, 86, 82, -41, -98, -57, -60, 53, -33, 36, -3, 95, 25, -69,
+		-40, -2, -18, -32, -61, 30, 15, -37, -98, -47, -68, -45, -56, 11, -73, 37, 79, 98, 29, 28, 11, 82, 14, -68, 4, -79, 98, -21, 43, -55, -60, 62,
+		-47, -90, -58, 97, 45, 91, -99, 27, -50, 65, -14, 97, -74, -94, -91, 39, -41, -19, -4, 24, 59, 37, -26, -27, 77, -36, -13, -81, -75, -63, 99, 85,
+		-57, 49, -29, 21, 29, 24, 99, 29, 74, -76, 89, -36, -96, 75, 60, 41, -78, -39, -31, -58, 27, -10, 2, 78, -16, -73, 85, 26, 89, -56, -37, -88,
+		13, -74, -75, -86, 17, -49, 2, -84, -94, 57, 97, 38, 14, -85, 19, -62, -55, 16, 76, -19, 18, 47, -85, -16, 60, 2, -32, 96, 66, 4, 24, -31,
+		67, -84, 96, -8, -88, 88, -10, 88, 13, 35, -42, 84, -83, 27, -90, -40, -39, -93, -45, -26, -41, 18, -82, -48, 49, -24, 61, -4, -81, -80, 87, -89,
+		83, 15, -79, -79, -28, -78, -77, 99, -34, 21, 7, 80, 94, -92, 86, -62, 88, -77, -32, 42, 92, 5, 45, -98, -92, -46, 83, -28, -47, 40, -78, -38,
+		63, -14, 0, 48, -88, 57, -68, -29, 11, -72, 40, 12, 39, -33, -79, 99, -46, 15, -20, -83, 10, 11, 63, 65, 49, -61, -69, 97, -40, -29, -30, -93,
+		34, 40, 25, -86, -48, -22, 34, 38, -74, -6, 36, 0, 21, -8, 37, 89, -42, -35, -83, -18, -27, 99, 78, 43, -31, 88, -4, -52, 11, -59, 72, -21,
+		99, -94, -36, -91, 61, 94, 58, 32, 91, -7, 23, 58, 8, -79, -88, -64, -82, 29, 29, -76, -88, 23, -40, -31, 57, -49, -44, 84, 32, -93, -61, 55,
+		-33, -68, 41, 21, 82, 3, 61, -60, -79, 96, 99, 62, -76, -70, -62, -8, -87, 54, -15, -4, -74, 45, -45, -84, 99, 57, -90, -66, 55, -77, -78, -75,
+		95, -91, 35, 23, 65, -13, 84, -86, -76, 80, 11, -32, 91, 55, 63, -98, 32, -96, 32, -90, 60, 85, -75, -34, -62, 83, -77, -83, -27, -33, -64, -71,
+		-1, -57, -43, -23, 29, 31, 1, -4, 40, -93, 85, -67, -11, -15, 58, 0, 90, -57, 25, 6, 67, 19, -3, 38, 48, -40, -20, -9, -89, -93, 72, -31,
+		72, 25, 12, 50, -36, 44, -41, 72, -15, 58, 13, -46, 3, -87, -87, -14, -55, 70, 16, -94, 33, -56, -78, -73, 92, -31, 89, -79, 74, 97, -60, 53,
+		-95, -79, 15, 72, -55, -31, 20, 58, 46, -22, 2, 10, -70, 90, 11, 61, -21, -12, -11, 79, 47, 24, -46, -31, 42, 59, 53, -91, -43, 53, -32, -48,
+		-48, -15, 19, 51, 93, 26, 55, -77, -11, 79, 67, -32, -55, -50, 15, 72, -60, 72, 2, -76, 6, 13, -83, -5, 46, 69, -31, 25, -62, 78, 86, -73,
+		28, 82, -56, 11, -32, -7, 8, 97, -12, 14, 35, -71, 38, 71, -99, 48, -57, 54, 6, -96, 15, -85, 4, 68, 70, -70, 71, -92, 65, 13, 37, -98,
+		-11, 50, -65, 70, 88, -21, -95, -57, 81, 40, -32, -68, -19, 64, 99, -24, 42, -28, -30, -61, 35, -77, -78, 4, -20, -54, -46, 84, -1, -36, -44, -22,
+		97, -22, 60, 52, -47, -68, -86, -43, 22, -3, 45, 54, -57, -33, -85, -38, -28, -75, -72, 58, -75, -68, -74, -88, -88, 90, 51, 57, 71, -96, -13, 55,
+		51, 51, -65, 54, 98, 24, -36, -9, -91, -50, -38, 49, -77, 8, -36, -84, -89, -26, 76, 15, -80, 93, 22, 20, -9, -2, -85, -99, -1, 8, 58, -92,
+		22, 45, 99, -30, 54, 95, 53, 85, 77, 64, -80, 84, 33, 47, 83, -21, 46, -9, 38, -42, -47, -5, -66, 61, 33, 3, 94, -77, 87, -30, -76, 74,
+		-63, -60, 67, -42, 47, 77, 20, 66, -9, -66, 8, 16, 42, -37, -77, 3, -84, 48, -53, -25, 99, 88, 31, 80, 10, 24, 78, -66, -83, -17, -56, 5,
+		54, -74, -51, -4, -86, -33, -96, -11, 80, -10, 5, -53, -37, -61, 21, -87, -49, 37, 11, -42, 28, 39, 18, -4, 57, 10, -81, 29, 17, 21, -28, 35,
+		-9, -77, 71, -97, 81, 11, -78, 22, -71, 85, -69, 61, -9, -79, 88, 99, -44, -87, -13, 50, -40, 31, -42, -49, 1, -45, 53, -55, 18, -16, 3, 73,
+		-82, 47, 50, -92, 56, -91, -78, 14, 70, 9, -71, -65, 97, -65, -7, -60, -62, 24, 15, 45, 61, 91, 31, 15, 89, 93, -50, -56, 33, -19, -27, -26,
+		-16, 6, -78, -45, 4, 94, -77, -59, -54, 26, 93, -43, -12, -1, 63, -77, 25, -55, 69, 93, -69, 63, 33, -53, 47, 33, -85, -20, 42, -55, 49, -5,
+		-24, -6, 60, 76, 49, -95, -88, 29, 74, -95, 92, 83, -27, -63, 82, -95, -48, -95, -77, -29, 14, 97, 35, 97, 2, 40, 62, -72, 31, 5, -41, -41,
+		-21, -85, -38, -46, -85, 32, -24, 55, -88, 12, 68, -84, -13, -49, -65, 66, -61, 98, 26, 99, 33, 92, 31, 28, 23, -79, -9, 36, -27, -97, -5, 64,
+		27, 34, 58, 42, -65, 61, -79, 26, 56, -16, -16, -98, 7, 68, -5, -46, 43, 28, -98, -60, -58, -76, 25, -62, -84, -85, 24, -17, 84, 14, 51, -93,
+		29, 30, -39, 32, 35, -15, 71, -52, 52, -18, -54, -82, 21, -40, -23, 29, 33, 67, 9, 24, 91, -10, 6, 30, -91, -93, -14, -35, -43, 7, 56, 1,
+		24, -12, -1, 0, 21, -57, -93, 35, 39, -60, -30, -47, 90, 29, -4, -19, 68, 24, -76, -80, 33, 19, -28, 68, 13, 64, -93, -11, 23, 78, -39, 9,
+		72, 84, -83, -18, 84, 89, 96, -58, -96, 32, -9, 99, -97, 80, 56, -68, 46, 94, 82, -10, 53, -52, 72, 2, -50, -35, 51, 89, 98, -100, 69, -28,
+		-27, 51, -68, 5, -32, 69, -40, -29, 60, 97, 94, -23, -12, 68, -8, -88, 50, -26, -37, 50, 72, -10, -98, -48, -97, -25, 69, -1, 48, -81, -14, 26,
+		12, 29, 75, -97, 32, 11, 96, -27, -55, -58, 45, 87, 37, 78, -65, -63, -51, 1, 93, -9, -66, 35, -43, -74, 57, -23, -39, 44, -11, 22, 98, -77,
+		96, 52, -92, -28, -69, 54, 11, 44, 68, -14, 36, -27, -4, -14, 59, -26, -84, 49, -5, 60, 25, -54, 90, 62, 26, 98, -91, 82, 86, -32, 76, 46,
+		12, 21, 87, 0, 94, -68, -100, -43, -88, -12, 42, -39, 40, -74, -22, -20, 5, -32, -11, 84, -42, -28, -54, 15, -32, 6, -39, 44, 91, -74, 42, -43,
+		-1, -24, 59, 33, -48, 17, 7, -33, -75, -98, 24, 59, -25, -54, -65, -77, -94, 38, -87, -56, 24, -65, -13, 66, 56, 47, 29, -93, -39, -29, 62, -74,
+		-11, -68, 11, -4, -97, -83, -51, 23, -87, 92, 77, -100, -52, 42, -88, 98, -97, 2, -19, 81, -29, -58, 44, 66, -22, 89, 3, 84, 69, -89, 18, -30,
+		-3, 43, -66, 4, 10, -60, -66, 17, -20, -79, 28, -24, -24, 41, -57, -38, 15, -7, 84, -20, -39, -89, -89, -83, 51, 66, -31, 82, 66, 34, 76, -55,
+		58, -92, -14, -57, 91, 17, -33, -16, 72, 17, -87, 35, 60, 82, -100, -3, 42, 86, -16, 38, -55, 9, 46, -74, 11, -34, -41, 69, 18, 56, 10, -2,
+		46, 45, -44, -20, -34, 4, -94, -99, 93, 20, -36, 59, -19, -39, -17, 26, 92, 25, -4, -62, -81, 78, 57, -31, 99, -58, 15, 72, -24, 98, 32, -47,
+		53, 26, 42, 49, -86, 70, 50, -61, 8, 91, 61, 80, 39, -35, 25, 27, 16, -96, 39, -2, 48, -62, -9, -3, 42, 87, 83, -67, -93, -4, 50, -67,
+		-6, 85, -17, 35, 38, 54, -19, -5, -63, 30, -19, -73, -78, -25, -66, 99, 41, 0, -24, -61, 94, 96, 97, -68, 39, -36, -95, 43, -57, 7, 73, 64,
+		-52, -59, 99, 3, -51, -19, 78, -57, -3, 96, 94, -61, -50, 10, 40, 98, -59, -25, -42, -68, -36, 23, -88, -53, 59, -8, -73, -37, 85, -66, -19, -61,
+		-16, 85, -52, 59, -7, 68, -2, 43, -14, 69, 91, 33, 5, 97, 56, 92, -16, 26, -58, -5, -29, 67, 72, 93, -93, -4, 67, 42, 87, 9, -53, -8,
+		-56, 3, 44, 78, 78, 85, 62, -60, 67, -90, -98, 6, -70, -35, 95, -14, 5, -77, 14, 23, 43, 50, 74, -36, -97, -25, -63, -80, 78, 83, 54, 9,
+		70, 94, -12, 2, 72, -20, -37, 40, -69, -38, -44, 56, 47, 72, 69, 73, 0, 14, -7, 79, -45, 6, 20, -28, 48, -12, -32, -29, 70, -96, 93, 22,
+		-49, 84, -48, 68, -51, -18, 76, 47, -93, -74, 8, 59, 93, 46, 60, 59, 76, 60, -61, 40, 67, -64, 78, 57, -94, -29, -89, 28, 56, 98, -55, -38,
+		-49, 68, -42, -16, -85, 17, 43, -27, 11, 4, 13, 0, 24, 38, -7, -47, 61, 56, -40, -42, -100, -4, 14, 62, 90, -59, -36, 38, 70, -44, 44, -72,
+		-80, 95, -90, -29, -29, -24, 32, -62, 9, -57, -92, 96, 68, -14, 82, 32, -9, -92, 57, 33, 60, -64, 84, -52, 44, -4, -78, 43, 41, -93, 28, 10,
+		-16, 47, -15, 33, -95, -81, -47, -13, -48, 76, -46, 27, 62, 19, -94, -1, 86, 29, 2, -42, -41, -53, -15, 26, -29, 46, -35, 24, 57, -6, -23, -41,
+		-24, -64, -63, 54, -28, 91, 93, 27, 19, -64, -28, 68, -35, -50, -48, -52, 90, 95, -82, -76, -100, 27, -27, 38, 34, -14, -37, 62, -62, -76, 88, 60,
+		16, -75, -45, -3, 51, -99, -90, 64, 60, -23, -55, 68, 46, -83, -8, 49, -14, -22, 48, 71, 66, -11, -38, 86, -60, -81, -30, 12, -51, 95, -18, -80,
+		45, -71, 53, 68, 28, 42, 29, -67, 93, 67, 22, -87, -90, 71, -47, -50, 13, -90, -7, -89, -12, 35, 43, -3, -50, 29, 71, -71, 89, 49, -34, -30,
+		-8, 52, 39, 80, -46, 51, -90, 80, 19, -59, -73, -53, -42, 12, 38, -28, 1, 87, 92, 22, 62, 69, -30, 60, -61, 57, 87, 26, -28, -67, -23, -27,
+		-33, -2, 74, -67, 12, -95, -58, 5, -29, -48, -68, -5, 95, 79, 43, -41, -96, 22, -65, 57, 95, -7, -17, 87, 42, 40, 98, -18, -94, -59, 25, -29,
+		42, 30, 17, 14, -17, -75, 0, -90, 49, 39, -52, -24, -91, -67, -69, 10, -83, -24, -29, 52, -19, -56, -25, 70, -43, 69, 96, -73, -37, 87, -25, 11,
+		-59, 42, -82, -6, 83, -25, 73, 78, 92, -82, -55, -35, -49, 92, -28, 39, -62, 95, -8, 6, 41, 66, 83, -72, -50, 36, -90, 25, -20, -19, 61, 42,
+		9, -34, 71, -40, -10, 99, 88, -90, 17, 13, -33, 81, 68, 57, -42, -92, -52, 82, 11, 14, -25, 37, -85, 25, -55, 65, -60, 97, -46, 58, -96, 23,
+		-88, -78, 28, 77, 75, 40, -55, 30, -55, 55, -43, 48, 93, -90, 22, 37, 69, 69, 18, 58, 51, 33, -86, 28, 19, 87, 94, 46, 49, 66, -43, -99,
+		-97, 85, -74, 58, 72, -1, 76, -30, -5, 87, 99, -93, 28, -29, 59, 15, 90, 10, -70, -30, -85, -33, 85, 3, -20, 91, 22, -55, -71, -72, -3, 72,
+		69, -54, 34, 9, -67, -14, -65, 35, 36, -76, -15, -36, -56, -93, 15, 23, 72, 92, -7, -61, -28, -46, 89, 88, 64, -40, -81, -59, 63, 72, 23, 56,
+		-25, 51, -39, -83, 41, 0, 61, -20, -57, 12, -66, -11, 9, -60, -91, 53, 69, -59, -87, 54, -8, 46, 65, -12, -37, 99, -91, -81, 76, -41, -88, 65,
+		9, 59, 42, 58, 44, -80, 67, 6, -44, -6, 42, -33, -51, 96, 58, 70, -66, 44, 73, 69, -63, 39, -99, 91, -25, -99, -75, 0, -56, -29, -38, -21,
+		-97, 93, -25, 88, -64, 58, 82, 53, -65, 35, 28, 33, -85, -20, 86, -50, -26, -74, -18, -43, -4, 2, 25, 66, -97, -83, -43, -9, 68, 55, -70, -37,
+		85, 21, -50, 29, -41, 73, 64, 38, 98, -4, 26, -99, 31, -72, -96, -73, 52, 47, -88, 13, -3, -32, 17, -23, -4, 60, -14, -37, 98, 28, -40, 70,
+		-50, 0, -44, -99, -76, -95, 1, -32, -44, -84, 40, 0, 10, -21, 0, -68, -76, 25, -63, 74, 6, -49, 55, 60, 93, 99, -72, -54, -24, -84, -95, 10,
+		82, -97, -37, 10, 48, 8, 45, -76, -65, -30, 52, 88, 38, 72, 47, -78, 0, 16, -42, -87, 8, 52, -68, -91, 91, 36, -68, 61, 91, -2, -8, -7,
+		30, -45, -86, 32, -65, -62, 48, 29, 68, -43, -72, 60, -15, 98, -40, -26, -30, 61, 22, 70, -31, 97, 98, 72, -74, 24, 21, -36, 67, 42, -7, -75,
+		2, 0, -67, -4, -35, 18, -97, -44, -57, 70, 75, 57, -58, -81, 97, -86, 5, 15, 54, 72, 99, -55, 71, -34, 13, -77, 34, -6, -87, 55, -22, -96,
+		-66, 46, 59, 28, -13, 42, 32, -80, -56, -9, 77, -85, -56, -32, -87, -33, 90, 69, 62, 67, 54, -52, 61, 88, -30, 69, 9, 7, 64, 16, 71, -43,
+		-13, -69, -25, -60, 69, -63, 59, -45, -30, -11, 20, 42, 80, 98, 77, 65, 13, 87, 91, -24, 51, 20, -18, -81, -96, 22, -62, -69, -3, 58, -78, -87,
+		-16, 62, -27, -4, 0, -69, 93, -3, 43, 70, 48, 27, -28, 95, -17, -98, -87, 63, -25, -13, -59, -15, -48, -34, 74, 2, -67, -62, -3, -94, 76, 82,
+		-58, -12, 38, -14, 60, 39, 31, 10, 23, -43, 34, 26, -52, -52, -69, 58, -59, -43, 55, 47, -22, 19, -17, 83, 22, -2, -68, 33, -67, -63, -46, -54,
+		-21, -28, -39, 16, 6, -42, 62, -75, -7, 6, 13, 14, 90, 98, -25, -53, 1, -61, -10, 39, 89, 2, -100, 97, -62, -88, 34, -22, -28, -68, -95, 88,
+		57, 64, 86, 91, 78, 1, 14, -39, 17, -1, -79, -61, -5, 88, 57, -13, 60, 78, -43, -73, -80, -91, -9, 4, 79, 63, -23, -97, -69, 12, -50, -73,
+		-7, 1, -70, 69, 68, -75, -73, 48, 69, 28, -47, 42, 42, -18, 25, -30, 86, -11, 62, 37, 11, 74, -35, -52, -73, 59, -73, 49, 65, -6, -61, 9,
+		-42, -10, 92, 39, -9, -97, -44, -36, -90, 10, -32, 73, 20, 41, -64, -51, -22, -66, -68, 26, -39, 21, -33, -47, -7, 33, 85, 9, 2, -66, -97, 16,
+		-35, 80, -64, -2, -31, -96, 7, 80, -84, 55, -65, -80, 24, 7, 82, 47, 67, -17, 6, 81, 47, -26, 54, 10, 88, -17, -22, -76, -61, -16, 35, -97,
+		-67, 57, 63, 92, -37, -41, 15, -53, -73, 56, 3, -20, 25, -26, 96, -83, 50, -40, 79, -78, -60, -39, -86, 98, -52, 50, -74, 2, 21, -82, 75, -69,
+		-34, -38, 31, -1, -89, -18, 80, 22, 25, -32, -46, -14, -65, 44, 48, 73, -70, 39, -45, -96, 19, 36, -61, 73, -96, 20, -42, -78, 22, 28, 46, 33,
+		63, -3, 28, 13, -92, -23, -89, 21, 92, 71, 27, -38, -88, -71, -79, -74, -43, -1, 55, -98, -32, -69, -61, -19, 81, 27, 32, -35, 24, -24, 8, -23,
+		35, 14, -32, -81, 95, -44, -27, 85, -91, -65, -16, 24, -42, -85, -79, -14, -88, 74, 75, 8, -64, -79, -80, 73, -33, 67, -54, 3, 40, -67, 98, 3,
+		-31, -56, -21, 58, 44, 8, 70, 93, -62, 37, 51, -11, -44, 87, -71, -7, -55, 13, -18, 34, -4, -66, 57, 90, 98, 23, -21, -18, 64, -76, -57, -66,
+		-2, -46, -66, -27, 23, 14, 78, -79, 2, -93, 70, 80, -85, 26, -98, -30, 42, -22, -18, -95, -100, 14, -90, -97, 98, 69, -28, 77, -61, 3, -49, -14,
+		58, 80, 6, -4, -63, -44, 31, 54, 71, -18, -97, -95, 65, -43, 98, 80, 48, 69, -81, -8, -80, 78, 7, -6, 12, 10, -36, 17, 30, -85, -9, 97,
+		71, -27, 73, 84, 93, 24, -23, 26, -20, 42, -24, -53, -18, -1, -62, 59, 94, -14, 72, -98, -92, 38, -98, -68, 89, -68, 72, -91, 89, -32, 52, -43,
+		41, -18, -3, -71, 88, 38, -58, 12, -98, 86, -12, 6, -71, -16, 53, -6, -44, -77, -8, 31, -93, -13, 42, 72, 92, -33, 99, 80, -57, 41, 3, 76,
+		-58, -24, -45, -74, 68, 53, 73, 79, -92, -32, 89, 74, -8, 27, -11, 39, 76, 77, -83, -67, 16, -2, 2, -50, -50, -57, -15, -73, 16, 59, 51, -82,
+		-96, 55, -60, 51, 49, -75, 66, -92, 14, -92, 90, -98, 14, -41, -60, -93, -47, 83, -40, -39, 64, 33, 24, 54, 56, -96, 75, -71, 56, 89, -78, -98,
+		20, 14, -56, -17, -64, -44, -88, 25, 51, 94, -17, 45, -3, -40, -45, -45, 32, 82, 94, -35, -65, -7, 86, 37, -34, 78, 50, 37, 39, -43, 24, 59,
+		-76, -91, -64, 31, 27, -11, -13, -26, 59, -64, 34, 60, 70, -53, -58, -17, -78, -77, 71, -9, 57, -15, -25, 12, 83, 98, -7, 11, 47, -88, 69, 5,
+		82, 56, 6, -4, -5, -97, 73, -71, -86, -34, -77, -96, -35, 15, 94, -10, -41, -37, 43, 53, 11, 42, 5, 94, 30, 2, -50, 60, -56, -25, -25, 10,
+		24, -91, -68, -91, 36, 14, -37, 12, -76, 96, -77, -76, 80, -55, -34, 7, -54, 49, 23, 27, -68, -86, -55, 41, -47, 74, 34, -49, -4, 9, -17, -52,
+		39, 33, -19, -86, 73, 32, -74, 93, -59, -90, -75, 54, 2, -37, 13, -81, -98, -62, -3, -93, 91, 7, -71, -58, -39, 75, 53, -72, 38, -87, -29, -64,
+		-70, -83, 0, -49, 95, -30, 55, 80, 63, -3, -7, 43, 22, 27, 19, -13, -45, -75, 98, 98, -16, -20, 62, 99, 41, 89, -59, 88, -22, -54, -86, -44,
+		73, -15, 12, 30, 48, -68, 52, 14, -37, -7, -50, -24, 74, 65, 36, -22, 2, -48, -13, -49, -61, -87, 68, -80, -1, 42, 96, -57, 85, 24, -48, -24,
+		16, 72, 69, 96, -53, 77, 76, -67, 54, 8, -79, -2, 96, 53, -59, -13, -97, -60, 15, -49, 59, 23, 86, 50, 20, 46, -13, 20, 7, -43, 93, -68,
+		-93, -40, 41, -2, -11, 40, 42, -29, -28, -65, 62, 15, 63, 40, 85, -65, 37, -24, 22, 85, -66, -19, 61, -25, 85, 54, -28, -97, 90, -32, 13, -38,
+		41, 80, -3, -50, -76, 84, 42, -65, 15, 87, -73, -4, -52, 80, -10, -29, 26, -20, 41, 12, -63, -28, -73, -8, -75, -99, -21, -30, -30, 73, 99, -34,
+		-11, -57, 68, -70, 41, 62, 57, 28, -6, -25, -28, 27, -16, 72, -69, -57, -60, 25, -50, -39, -84, -24, 84, -10, 49, 12, 48, 80, 91, -93, 17, -63,
+		98, -37, 60, 43, 46, -64, -97, -29, 20, 30, 12, -37, 54, 47, -84, -3, -39, 86, 28, -27, 5, -47, -92, -57, 96, 27, -75, 67, 76, -19, -45, 30,
+		14, -94, 25, -77, 87, 59, -13, -5, -61, 70, -96, -49, 90, -30, -18, -65, -85, 1, -99, -12, -46, -99, -21, -5, 19, -93, -98, -45, 66, 6, 85, -9,
+		63, -51, 84, -9, -35, 62, 13, 48, -1, -46, 47, -63, 9, 26, -9, 62, -59, -60, -25, 53, -54, 73, 98, 80, 36, 71, 81, 2, -15, 20, 74, -77,
+		-82, -13, -87, -41, -75, 49, -57, 55, -18, 92, -44, -74, 30, -48, -40, -17, 62, -26, 36, 30, 45, -23, -67, -13, 45, 4, -98, -6, -88, -38, 27, 47,
+		-99, 79, -95, 64, -57, -67, 90, 41, -84, 83, -10, 13, -100, -43, 25, -37, 63, -16, -68, 77, 15, 74, 66, 11, -92, 97, -7, 79, -90, -13, 93, 61,
+		93, 84, -9, 95, -70, -30, -100, -20, -61, 82, -70, 57, -91, -76, -1, -37, -27, -28, 4, -55, 33, 36, -3, -54, 74, -75, 54, 84, -72, 8, 29, 64,
+		-12, -10, 45, -18, -46, -71, 53, -43, -32, 85, -11, -16, 21, -87, -97, -13, 57, 32, -62, -99, 16, -10, 76, -24, -100, -6, 14, -18, 39, -91, -70, -10,
+		-47, -22, -66, 48, 93, 93, -60, 45, 94, 36, -1, 78, 65, 55, -69, 5, -47, 32, -5, -67, -40, -34, -22, -83, -8, -1, -34, 10, -56, -93, -25, 48,
+		-29, -15, 37, 14, -33, 32, -63, -16, 39, -75, 28, 27, 93, 4, -61, -61, -7, 15, 18, 16, 99, -49, 6, 1, 26, 52, -64, 37, 40, -71, -86, 7,
+		26, -16, 13, -92, -52, -44, 44, -74, -67, 40, 29, -66, 32, -97, 2, -2, 79, -15, -44, -81, 93, -71, 2, -19, 51, 47, 85, -9, -47, -72, -49, 83,
+		-100, -34, 47, 9, 95, -18, 11, -55, -71, -6, -32, -88, 15, 64, 38, -92, 97, 63, 70, -19, 47, 18, 68, 90, 34, -100, 66, 93, -15, -6, 79, 50,
+		45, 38, -3, -62, 62, -96, 77, -15, -83, 55, -57, -83, 28, -86, -70, 77, 20, 34, -38, -81, -72, 80, 19, 25, -6, 72, 45, -97, -7, 86, 73, -91,
+		5, 75, -25, 93, -13, -50, 1, 16, -9, 75, 22, 5, -64, -70, -21, 4, 22, 26, -19, 30, -74, -65, -92, -38, -35, -3, -45, 47, -94, -60, 87, -4,
+		-22, 62, -5, -97, 32, 13, 79, -39, 61, 90, 83, -36, 44, 69, 32, 70, -80, 66, 40, -98, 32, -13, -44, -60, -83, 33, -24, -11, 11, 14, 58, 74,
+		77, 36, 24, 52, 31, 73, 67, -92, -44, -51, -4, -21, 44, 83, -48, 62, -66, 55, 61, -69, -95, 27, 63, 13, 47, 30, -70, -3, 68, -14, -24, 28,
+		-84, -86, 91, -87, 33, 44, 83, 18, -16, 92, -93, -49, -29, 5, 2, 88, -2, 72, -20, -28, -52, -4, 82, -36, -17, 62, 12, 45, 96, 43, 26, 85,
+		-56, 17, -93, 26, 85, -49, -4, -90, 90, 25, -30, -54, -73, 91, -53, 96, 33, -29, 17, -3, 33, -62, 91, 92, -35, -75, -77, 25, -13, -81, 55, 66,
+		4, -37, -22, -1, -95, 29, -55, 53, 4, 91, 50, -18, -54, 22, 59, 86, 89, -2, 58, -87, 4, 81, -1, -92, -91, -68, 99, 62, -66, 96, 38, 39,
+		11, 62, 65, 56, -31, 27, -63, -81, -67, 51, -58, -57, -59, 12, 2, 81, -68, -55, 84, -3, 43, 72, 82, 77, -18, -29, -16, -78, -17, 30, 87, -10,
+		-91, -60, 4, 11, -25, 58, 29, -34, -67, 52, -11, 84, -28, -23, -28, 43, 3, -99, -59, -71, 32, 43, 35, 76, 95, 54, -11, 17, -58, 7, 35, 6,
+		-7, -68, -22, -4, 38, -54, -7, -57, 49, -24, 41, -16, 53, 54, 2, 86, -47, 66, 31, -44, -27, -24, 48, -5, 17, 75, 72, -32, 69, -53, -60, -18,
+		-51, 41, -27, -78, -31, -75, 12, -39, -93, -55, 17, -41, 18, 5, -78, 16, -12, 11, -48, -43, 10, 23, 83, 45, 18, 32, -75, 96, 33, 89, -82, -74,
+		59, -15, 30, -77, -41, -64, 14, 91, -86, 13, 77, 5, 29, -66, 73, -69, -98, -4, -38, 67, -55, 76, -93, -87, 33, 20, 26, -1, 21, 60, -72, 75,
+		-4, -68, 9, 4, -51, 65, -96, -99, -19, -59, -8, -39, 58, -83, -77, -19, 51, 20, -85, -40, -63, -13, 77, 3, -92, 6, -86, 38, -38, 49, -13, 78,
+		96, -32, 62, -56, -37, 83, 21, -52, -85, 92, -41, 39, 33, -90, -7, -39, 35, 51, -53, -74, 98, -24, -20, -28, 95, -55, -80, 54, -56, -43, 79, 96,
+		-22, -21, -30, -15, -64, -30, 75, -73, -44, 56, 89, -77, 96, -18, 74, 85, 44, 74, 31, -42, -75, -15, 21, -44, -69, -59, 16, 6, -5, 60, 70, -94,
+		0, 91, -61, -61, 92, -73, 97, -59, 74, -39, -94, 34, 73, 27, -1, -70, 90, -48, -87, 58, 26, -64, -35, 29, 36, -100, -23, -86, 34, -75, 84, -67,
+		52, 98, 91, 6, 95, 87, -50, 39, 66, -92, -18, -86, 28, -65, -86, -14, -86, 61, -12, -1, 98, 86, 42, -11, 5, -75, 72, 53, 75, 76, 91, 99,
+		-50, -77, 31, -69, 4, -85, -36, 31, -99, -55, -52, 15, -67, -27, -13, 21, -87, -68, -47, 42, -81, 64, -21, 82, -4, -99, -40, 23, -85, -33, 50, -68,
+		-64, -37, -79, 34, -49, 53, 63, -97, -66, 14, -38, 50, 94, -5, 72, -28, -72, -8, -62, 82, -23, -27, 53, -84, 35, -74, 24, -34, -20, 19, -62, -82,
+		-84, 29, -68, -99, -71, 21, -21, -27, 36, 71, -19, 79, 81, 76, -21, -13, -26, -57, 94, 67, -89, -12, -50, 39, -66, 60, 88, 88, 88, 81, 91, -92,
+		65, 49, -62, -90, -28, -72, 60, -62, -22, -17, 66, 42, 88, -90, 78, -5, -15, 63, 90, 62, -26, 38, -47, 36, 48, 16, -44, -80, 91, 25, 31, -82,
+		-85, -85, 53, 62, -5, -12, -64, 1, 47, 93, -31, 99, -68, 88, 97, -94, 89, -89, -57, 72, 43, -88, -55, -74, 71, 4, -91, -30, -14, -27, 81, -9,
+		80, 49, -31, -8, 79, 68, -31, 17, 86, 21, 95, 88, 82, -63, -44, -91, -87, 15, -17, 41, 60, -81, -82, -51, 52, -12, 10, 24, 13, -15, -20, -8,
+		-40, -78, -88, -58, -24, -7, 92, 73, 39, -43, -91, -18, -92, -96, 31, -84, -58, -77, -47, 34, 29, 3, 51, 4, -65, -43, -21, -23, -82, -96, 88, -16,
+		18, -15, 70, 26, 22, -13, 66, -59, -10, -72, -88, -37, -80, -58, 97, 68, 31, 55, -50, 93, 70, -6, -49, -63, -20, 73, 46, 73, -53, 37, -18, 25,
+		10, -85, -38, 99, -37, 43, 0, -90, -79, 81, 9, -42, -78, 4, 21, 19, -94, 14, -5, 70, 85, -29, 10, -47, 23, -68, -100, -90, -61, -76, 92, 35,
+		-48, 85, -75, -68, -52, -65, -89, -81, -34, 75, -50, -32, -97, -44, 48, -68, -51, 22, -1, -4, -33, -32, -42, 17, 32, -3, -99, 41, 91, 89, 24, -7,
+		46, -100, 45, 27, -71, 99, 3, 12, -91, 53, -60, -55, 6, -36, -20, -78, -30, -56, -36, 4, 91, -64, 26, 26, -68, 1, -8, -96, 42, -74, -86, 53,
+		-96, -77, 66, 11, 75, -33, 49, 22, -77, -27, -43, 36, 35, 95, -91, 88, -33, -5, -9, 28, 20, 51, -14, -37, 99, -8, -13, 82, 42, 77, -56, 53,
+		-53, 8, 98, -51, -72, 98, -6, -1, 5, 7, 81, -99, -61, -3, 75, -19, 76, -82, 28, 1, 29, 53, -16, -38, -7, -19, 53, -82, 82, -65, -67, 77,
+		12, -1, 59, -97, -73, -21, 64, 92, -28, -82, 53, -97, 22, -76, -34, -40, -59, -7, -25, -69, -39, -50, 12, -1, 51, 88, 10, 66, 9, -36, 98, 28,
+		-4, 49, -37, -88, -27, -58, 31, -63, 17, 77, -33, 68, -12, 57, -54, -6, 87, 46, 22, 37, -59, -24, 96, -17, 89, -99, 27, 58, 6, 38, 54, -39,
+		-97, 92, 61, 48, 29, -10, -63, 76, -48, -56, 67, -28, -74, 45, -89, 42, -58, -79, -84, 95, 30, 34, -53, 83, 57, -64, 92, 97, -10, -22, 75, 77,
+		39, -70, -33, -62, -7, 40, 13, -16, 4, -2, -8, 89, 16, -36, 75, -26, -98, -83, -18, -28, 61, -17, -13, 93, 75, 42, -54, 35, 48, -54, 20, 62,
+		51, 73, -99, 3, -5, -69, 87, 41, -19, 16, 91, -35, 58, 43, -51, -80, -18, 72, 88, -16, -73, 64, -30, -38, 25, -3, 32, -39, -38, -67, -89, 45,
+		-41, 87, 54, 43, -89, 2, 4, 34, 60, -39, 97, 73, 58, 32, -34, -55, 52, -13, 13, 5, -16, -9, 55, 57, 39, -20, 9, 16, 75, -47, 80, 32,
+		-64, 67, 67, -52, 31, -15, -43, -17, -80, -97, 9, 0, -27, -31, -4, -72, -4, -57, -1, 12, 59, -28, -22, 93, 32, 86, 34, 46, -88, 25, 77, -79,
+		-48, 46, -8, 65, 12, 7, -65, -73, -30, -44, -5, -19, -26, 3, 79, -69, 61, 49, 54, -91, 77, -40, -14, 17, 24, -45, 97, 79, 50, -14, 0, 73,
+		90, 33, -29, -20, 60, 7, 91, 42, 21, -90, -35, -71, 12, 94, 7, -2, 44, 21, -85, -17, 41, -14, 36, 67, 77, 21, -34, 15, 22, 58, -99, 54,
+		93, 82, 30, -86, 69, 5, 23, 7, 20, 4, 90, 80, 78, -51, -88, -7, 67, 77, 26, -68, -93, -64, 98, -26, -66, 69, -92, -32, 91, 74, 51, -35,
+		-98, 48, -61, -44, 31, -62, 34, 58, 38, 87, -95, -39, -94, -37, -47, 89, 58, -44, 62, 76, -43, -40, -78, 69, -86, 45, 72, -45, 96, 37, -25, 31,
+		58, -57, 89, 95, 22, -67, -77, -12, 8, -31, 32, 79, 56, 24, -61, 70, 7, 14, -80, -55, -87, 73, -29, 27, 27, 39, -7, -6, 22, -70, 59, 26,
+		62, 15, 95, 60, -58, -65, 49, 55, -61, 26, 18, -23, 55, 53, -63, 79, -5, -82, 49, 97, -87, 63, 61, 75, -72, 99, -67, 88, -83, -67, 30, 39,
+		11, 45, -79, -60, -5, -67, -1, -39, -69, -56, 60, -24, 53, -7, 46, -14, 4, 78, 25, 88, 79, 13, 59, -36, -58, 75, 8, -92, 83, -39, 46, -30,
+		61, 87, 85, -41, -39, 64, -15, -98, 33, -40, -53, 84, -43, 18, -77, 43, -69, 58, -14, -98, 16, -48, 41, -93, 8, -86, 88, -2, -45, -36, 52, 69,
+		-11, 18, 7, -66, 50, -42, 6, 85, 43, 25, -16, 11, -52, -82, 19, -52, 75, -54, -5, 83, -28, -19, 15, -100, 64, 81, 96, 49, 96, -25, -79, 75,
+		-70, -93, 88, -2, 37, -19, -48, 79, 63, 83, 59, 35, -23, 88, -28, -84, 32, -64, 78, -73, -9, 29, 25, 88, 61, 20, 93, -64, -93, -22, -31, -3,
+		-28, 22, 60, -61, -56, -4, -17, 91, -63, -47, -75, 75, 30, -6, -67, -93, 43, -46, 86, -25, 99, -61, 72, -33, 93, 69, -98, 16, 11, -7, 16, 24,
+		90, 74, 52, -15, -85, -66, 84, -76, 83, 84, 22, 42, 88, 50, -61, 27, -52, -40, -29, 75, 10, -63, -64, 86, 40, -94, -14, 93, 22, -21, 57, -100,
+		2, -45, -14, 88, -10, 99, -94, -61, 60, 69, 85, 15, 7, -74, 40, -43, 86, -78, -79, -60, 27, 18, 46, -96, -34, 93, -62, -39, -42, -16, -69, -21,
+		79, -19, 3, -40, -46, 75, -1, -28, 83, 16, -51, -69, 57, 21, 19, 66, -49, -61, -88, -44, 24, 36, 82, -50, -71, 41, 50, -18, 64, 52, -89, 23,
+		-8, -2, 29, 95, -46, 38, 74, -54, -25, 80, -55, 42, 22, 40, 98, -3, -62, 0, 38, 38, 4, 66, 62, 65, -48, -47, 6, 63, 37, -12, 98, -16,
+		75, 70, -93, -6, 90, -21, -34, -97, 31, -1, -13, -24, 92, -91, 80, 46, -26, -70, -81, 24, 8, 68, -87, 13, 16, 18, -65, -35, -22, 4, 17, -67,
+		41, -48, -59, 38, 23, 15, 29, -51, -27, 47, -34, 21, -9, -65, -19, 82, 52, 44, 2, -46, -64, -58, -39, 63, 55, 59, -35, -57, 74, -8, -90, -12,
+		75, 67, -86, 68, -31, 13, 60, 27, 94, 73, -60, 42, 89, 11, 62, -75, -57, 97, 1, -18, -94, -77, 53, -50, 14, 83, 47, 98, 12, -35, -46, -32,
+		60, 31, 30, 96, 80, 84, -86, 1, -62, 15, 62, -1, -39, -61, -32, -65, -74, 25, 41, -7, -30, -73, 25, -96, -15, -2, -65, -82, -22, -1, 64, 65,
+		-97, -73, 66, 34, -66, 4, -7, 96, -79, 40, -18, 84, 70, 28, -8, -23, -37, 27, 50, 33, -32, -60, 64, -5, -20, -20, 28, 11, -30, -10, 54, 39,
+		64, 61, -44, 65, -14, -3, 28, -93, 92, 82, 7, 59, 87, 6, 48, 25, 40, 25, -62, -99, 27, 87, 54, -56, -28, 5, -67, 57, -20, -46, 83, -67,
+		11, 79, 89, -80, 50, -84, -48, -79, -96, 70, -76, 36, -2, 67, -95, -87, 33, -29, -57, -10, 52, -35, 64, -67, 69, -33, 69, 31, 47, -74, -65, -52,
+		49, -11, -45, 96, -89, 88, 2, -44, -77, -75, 17, 70, 24, 32, -4, -1, -12, 69, -95, -66, 26, -40, -24, -23, -63, 47, 16, -99, 53, 47, 29, -23,
+		-90, -9, 79, 52, -15, -39, 81, -71, 87, 43, 32, 25, -52, -33, -79, -61, -50, -44, -75, 92, 27, 8, 63, -47, -12, -68, 21, -89, 50, -78, -40, 52,
+		82, 48, 36, 18, 29, 86, -41, 37, -37, 59, -93, -26, -62, 19, 15, 0, -83, -70, 36, -52, -66, 68, -84, -15, -67, 64, -58, 49, -31, 81, -10, 56,
+		63, 54, 49, 10, -17, 18, -88, 28, 64, -86, -52, -14, -33, -1, -96, -61, 79, 53, -62, -11, -3, -70, 99, 68, -25, -94, 76, -55, -64, -50, -77, -68,
+		-51, -73, -14, 35, 1, -16, 25, 44, 74, -12, -34, 86, -56, 36, 37, -77, 40, 79, -4, 77, 81, 18, 40, -91, -60, -78, 51, 55, 64, 76, 4, 18,
+		-60, 60, 0, 8, 86, -48, -50, -28, -11, -96, 22, 21, 94, 36, -81, -21, 93, -1, -84, -19, 4, -76, -62, -28, -32, -67, -81, 43, -56, -53, -71, 49,
+		80, -7, 33, 52, -28, -42, 96, -31, -18, 42, -63, -86, -5, -14, -66, 55, -34, -50, 95, 32, 97, 80, 0, -3, 83, -26, 67, 47, -88, 46, -25, -32,
+		41, 44, 97, -1, -69, 65, -14, 45, -23, -63, -54, 20, -36, 39, -46, -70, 77, -44, 24, 75, 66, -18, 75, -94, -1, 38, 13, 58, 22, -67, -5, 41,
+		7, -13, 52, -9, 86, -44, -18, -59, 66, -47, 56, -28, -47, 63, 11, 65, 5, -72, 25, -14, 48, -52, 20, 60, -93, -96, 48, -55, 53, -94, -23, -27,
+		21, -30, 25, -39, 63, 50, 40, 13, 67, 53, -47, -16, 20, 97, 76, 98, 82, 25, -47, 18, 8, -27, -79, -9, 94, -88, 41, -17, -95, -25, -90, 79,
+		25, 79, 61, 76, 42, -21, 35, -34, 58, 10, -40, 49, -23, 39, -45, 10, 57, -92, 80, 36, 38, 55, -27, 66, -44, 24, 24, 3, -95, -39, -19, -39,
+		90, 77, 97, 57, -32, -17, -64, -99, 91, -72, 93, -17, 89, 5, -19, -57, -25, -20, 32, 98, 91, 7, -58, -51, 19, 6, -11, -80, 60, 76, 37, 80,
+		47, 10, -15, -14, -36, -92, -83, 6, 66, 55, -53, -55, 84, -33, -77, -35, -62, -1, 70, 35, 2, 94, 79, -56, -53, 4, -81, 0, 26, 53, -48, -91,
+		28, -63, 39, -8, 40, -68, 98, 85, -70, -42, -23, 84, -36, 90, -75, 90, -54, 24, 40, -14, -28, 42, -48, -51, -54, 18, -61, 56, 81, -41, 78, 75,
+		41, 68, 76, 11, -16, -40, 43, -1, -95, -81, 12, -90, 49, 46, 50, 36, -59, -44, 70, -4, -22, -59, -66, -27, -65, 48, -88, -66, -33, 10, 79, -69,
+		-53, -51, -70, 44, -91, -60, -81, 13, 27, -14, -38, 82, 85, -78, 30, -29, 46, -39, 12, -86, -57, -66, -74, -18, -22, -24, -73, 83, -38, 78, -96, -52,
+		-71, 20, 48, 66, 76, 14, 10, -71, -69, -93, -35, -26, -64, 4, 66, -13, 62, -51, -72, 80, 53, -23, -82, 84, -88, -44, 43, -100, -1, -6, 32, 34,
+		14, -16, -23, -15, -50, 30, -68, -80, -48, -80, -50, 92, -2, -48, 56, -18, -73, -93, 47, 16, -79, -72, 14, 37, 24, -29, 90, 50, 90, -1, 0, 83,
+		24, 92, 18, -16, 62, -61, 13, 52, 68, -75, 51, -73, 39, 98, 98, 13, 11, -98, 64, -49, 80, 13, -79, -5, 43, -65, -71, -9, 76, 29, -88, 56,
+		16, 3, 34, -38, 62, -83, 5, -26, 46, -92, 7, 80, -94, 88, -45, -72, -53, 78, 97, -33, -31, -2, -13, 86, 74, 34, 89, 87, -59, -62, -8, -63,
+		87, 24, -73, -79, -80, 68, 43, -55, -93, -48, -58, -84, -95, 88, -10, 69, -93, -67, 46, -59, -92, -83, 23, 92, -26, 10, -67, 71, 52, 78, 70, 27,
+		-99, 12, -35, -79, -88, 80, -56, -54, -5, -83, 51, 88, 30, -82, 2, 32, 66, 33, -77, -57, 53, -81, 94, -47, 36, -82, -81, -25, -44, -39, -53, 62,
+		-94, 78, 34, -76, 97, -99, 32, -97, -53, -30, 86, 26, -74, -76, -42, 18, 20, 96, -92, 40, 94, 83, 84, 49, -99, -15, 92, -39, -71, 59, -39, -49,
+		-85, 18, 37, 30, -85, 64, -100, -35, -83, -77, 43, 27, -59, -70, 78, -19, -70, -50, -4, -33, -1, 36, -38, -78, 58, -4, 16, -54, -45, -63, -88, 38,
+		29, -10, 83, -51, 66, -25, -3, 69, 3, 58, 43, -86, -84, 87, -100, -15, -83, 65, 81, -19, -22, -36, -35, 4, 89, 77, 89, 19, 42, 14, -50, 13,
+		97, 26, -49, -19, 83, 12, -84, 14, -17, -88, 73, -18, 55, -22, -30, 12, 29, 54, 80, 20, 2, 28, 37, 75, -85, -51, 95, 56, -21, 74, -79, 88,
+		-95, -90, 93, 1, 93, 58, 52, 3, 97, -31, 40, -89, -37, -28, 6, -28, 41, -81, 10, 23, 9, -9, 68, -48, -5, -21, 35, 35, 13, 65, -91, -9,
+		-29, 52, 83, -71, 72, -98, 12, -53, -51, -67, -92, -4, -81, -64, 33, -19, -22, 96, -72, -55, -50, 5, 97, 11, 86, 70, 7, 83, -26, -32, -95, 21,
+		-1, -8, -45, 86, -23, -1, -65, 31, 15, 81, -31, 49, -66, 41, 64, -50, -96, -77, -58, -1, 63, 97, 40, -57, -8, -60, -34, -24, -4, -37, 12, -66,
+		-21, -79, 28, -43, -5, 49, -30, 54, -40, -12, 74, -92, 54, 98, 57, -78, -84, -17, -32, 82, 95, 12, -41, -37, -99, -36, -10, -83, 63, 66, 20, -34,
+		-95, -79, -61, 92, -32, -37, 4, 63, -89, 22, -99, -26, -87, -98, -56, -65, -97, 74, 69, -17, -43, -73, 76, -40, -22, 55, 52, 11, -58, -56, -90, -100,
+		95, -47, -4, -20, 92, 54, -48, 12, -92, 96, -84, 98, -58, -82, -13, -15, -32, 83, 92, -16, 9, -8, -4, -87, -85, -14, -65, 33, 58, 65, -100, -58,
+		-48, 61, 60, 61, -66, -8, 25, 9, -29, 89, 93, 17, 63, 48, 67, 27, 29, 73, 40, 54, -43, -32, -28, -61, 87, 44, 80, 13, -33, 94, -2, -10,
+		40, -79, 40, -55, -96, 96, 52, 83, 74, -9, 90, -72, -21, 29, -62, 76, 55, -14, 95, 58, 60, 6, 61, 19, -63, 78, -23, 32, 16, -56, -50, -34,
+		18, -12, -73, -9, -41, 97, -52, 35, -32, 28, 9, -62, -54, 40, 87, 6, 13, -91, 87, 3, 43, -30, 42, 84, -23, 15, -24, -26, -47, 68, -80, -38,
+		32, 42, -47, -74, -1, -76, -20, 39, -74, -1, 13, 13, 42, 17, -1, 78, -59, -57, 94, 8, -31, 39, -10, 41, 17, -94, -32, 8, 72, 48, 57, 90,
+		-82, 91, -59, -28, -30, 4, -31, -71, 3, 20, 23, 31, -65, -15, -98, -82, -20, 19, -86, -36, -44, 63, 31, -53, -38, -2, -44, -45, -59, 17, 64, 38,
+		10, 78, -72, 88, 28, -22, -99, -65, 65, 88, 66, -79, -5, 87, -65, 45, 99, 85, 93, -36, 39, -55, 54, -27, -84, 96, 2, 89, 99, -78, -10, -37,
+		-27, -39, -89, -67, 21, -77, -75, 8, -76, 9, 3, -74, -46, -95, 83, -98, -42, 45, 71, 58, -65, 84, -38, -70, -17, -33, 42, -49, 67, -9, 13, -41,
+		85, 47, 27, -30, -84, -13, 7, 80, -96, 93, -10, -23, 52, -81, -53, 43, -32, -45, 16, 53, 70, 72, -42, -4, 87, -19, 73, -23, -37, -48, -58, -46,
+		-46, -63, -7, 48, 75, -79, -26, 90, -4, 39, 21, -76, -1, 70, 30, 95, 40, -57, -72, 13, -25, -65, 74, 2, 99, 32, -88, -45, -51, -75, 35, 84,
+		97, 29, -41, -24, -64, 19, 16, 1, -46, 99, 54, 21, 28, 71, -95, 42, 97, -46, -54, 7, 53, 59, -84, 98, 75, 51, -71, -91, -15, 5, 86, 91,
+		-49, 63, 17, -56, -76, 70, 15, 64, 84, 43, 54, -65, -67, 6, 94, 26, 71, -65, -100, 11, 60, -81, -12, -45, 33, -66, 86, -16, -20, -46, 93, 6,
+		-91, -19, -35, -34, 96, -65, -39, 78, -44, 72, -94, 78, -12, -62, 87, -49, 28, 43, 24, -89, 35, -8, 22, 43, 60, 98, 16, 31, 72, 97, -84, -29,
+		3, -55, -65, 85, -97, 92, 25, -12, -22, -17, -52, -96, -88, 3, 48, 22, -73, 65, 17, 16, -16, 35, 96, 8, -57, -96, -15, 53, -81, 78, 14, 57,
+		33, 13, 11, 78, 49, 71, 90, 9, -47, -67, 96, 39, 59, 59, -48, 31, 98, -48, 64, -44, 32, -91, 36, -28, 0, 88, 25, -12, 33, -26, 57, -66,
+		-22, -96, 32, -10, -62, 12, -39, 64, -36, 23, -89, 33, 0, 40, -70, -82, 66, 53, -90, -83, -53, 64, -35, 11, -86, 64, -74, -70, 80, -44, -53, 80,
+		-71, 99, -95, -10, -70, 76, -37, 31, 66, 18, 39, 72, -86, 0, 43, -57, -16, 96, 46, 92, 52, -32, -7, 34, -100, -92, -2, -4, -5, 29, 86, -78,
+		-23, -31, 38, 31, 8, 39, -72, -77, 74, -69, 66, -5, -3, -18, 80, -38, -78, -3, 71, -79, -85, -9, -67, -20, 66, -18, -18, -14, -90, -89, -8, -14,
+		-50, 32, -75, -75, 55, 57, 42, 24, -98, 38, 20, 91, 88, 49, -85, 74, 97, -52, -36, 81, -84, 54, 8, -25, -44, 5, 99, -31, -77, -46, -49, -67,
+		-8, 13, -29, -90, 99, 91, -57, 28, -91, 85, 23, -47, 90, 70, 35, -19, -49, -86, -29, 75, 32, -47, -59, -98, 75, -34, 19, 55, 16, 72, 67, -39,
+		87, -23, -48, 29, -43, -78, 45, -10, 55, 8, 89, -77, 53, 2, 81, -7, -22, -66, -46, -94, -43, 56, -54, -68, 13, 90, 82, 62, 8, 70, 48, 37,
+		2, 58, -55, 47, -3, -61, 4, -90, -34, -8, 16, 15, -54, 83, 90, -22, 9, 95, 53, 42, -73, -14, 56, 0, 77, -32, 73, 30, -48, 73, -67, 26,
+		-94, 42, 59, -29, -59, 50, -22, -62, -36, -95, -13, 41, 57, 18, 41, -22, 72, -25, 26, -33, 46, 22, -66, 91, 45, 65, 28, -2, -49, 94, 28, 1,
+		60, 88, -89, 79, -41, 64, 8, -67, -86, 92, -86, -19, -60, 97, 71, 53, 49, -83, -48, -68, -65, -2, 33, 24, -37, 46, -94, 44, -41, 92, -27, -40,
+		-51, -69, -17, -7, 39, 78, 32, 99, -52, -73, -70, -60, 63, -78, 56, 3, -71, 24, -27, 17, -17, 39, 3, 86, -71, 39, 94, -11, -72, 1, -67, 33,
+		-11, 1, 52, 37, 58, -90, 64, -30, -57, -27, 28, -24, 2, 90, -88, 20, -97, 36, -66, 67, -55, -87, 98, 17, -89, -86, 82, -64, 0, -71, -61, 59,
+		6, 44, -83, -44, 63, -50, 90, -53, -39, -83, 68, 68, -46, -47, 39, -14, -84, -99, 43, 46, 98, 10, 51, 34, 1, -11, -41, 98, -71, 21, -65, -77,
+		2, 52, -92, 33, 41, -62, 56, -34, 2, 9, 60, 37, -45, -90, 81, 51, -36, -50, -59, -84, -97, -22, 33, 54, -65, 42, 45, -1, -67, -96, -50, 70,
+		25, 43, 3, -58, -51, 53, 63, -1, -51, 92, -86, 9, 85, -79, -21, 25, -92, -45, 67, 97, -66, 10, -48, 45, 73, 56, 11, -87, 22, -22, -42, 61,
+		59, 15, 93, 23, 20, -76, 7, -67, 97, 65, -99, 11, 71, -19, 8, -67, 75, 92, -4, -88, 12, -45, -17, 38, -54, 72, 64, 5, -5, -42, 0, 73,
+		46, 51, -70, 60, 46, 39, 17, -100, -2, -64, 46, -24, -76, 36, -38, -95, 2, 35, -47, 13, 7, -88, 70, 62, -18, -14, 77, -82, 7, 5, 46, 38,
+		-61, -61, -61, -16, -12, 96, -52, 30, 34, 67, -39, -65, -68, -32, 63, -54, 94, 96, -13, -79, -81, -38, -63, -73, -40, 19, 56, 79, 25, 40, -11, -59,
+		-48, 96, 88, 46, 45, -47, -79, 2, -34, 52, 16, -15, -4, -92, 21, -51, 40, 60, -90, 86, 26, 28, 56, -37, -5, -49, -46, -52, 29, -56, -73, -93,
+		67, -30, -68, -9, 19, -79, 21, -55, 79, -48, -36, 84, 0, 20, 51, -38, -88, 87, -7, -5, 91, -84, -81, -65, -82, 70, -72, 77, 75, -35, -98, 41,
+		-92, -60, 50, -47, -59, 88, 11, -45, -59, -98, 43, 93, 99, -39, -24, 75, -51, 84, 63, -93, -72, -1, 21, -4, -50, -61, -88, 61, -23, 99, -90, 72,
+		46, -95, -91, -46, 0, 54, -100, -55, -99, 62, 7, 98, -55, -16, 45, 44, -75, 84, -83, 42, -62, -94, 59, -30, 90, 37, 79, 99, -35, 50, -13, -47,
+		87, 44, -12, 43, 15, -92, -21, 56, -80, -56, -52, -86, 80, -8, -13, -12, 66, -28, 71, 98, 94, 40, -58, -83, -37, -41, 80, -30, 86, 45, 39, 77,
+		-64, -16, -33, 75, 91, -62, 64, 11, -80, 13, -99, 66, 10, 48, -42, -71, 14, 18, 47, 16, -37, -76, -15, -13, -11, 98, -80, 5, 13, -64, 20, -98,
+		45, -89, -33, -5, -69, -13, 53, 97, -35, -77, 54, -23, 92, -17, 81, 22, -15, -65, -26, -64, 30, 33, -49, -47, -41, 81, 41, 13, 26, 16, 58, 56,
+		-13, 64, -47, -99, 70, 15, -74, 44, 37, 29, 70, 18, 98, 21, -52, -96, -99, -11, 48, 75, 83, 33, 26, 70, -91, 95, 70, 35, 64, -50, -78, -70,
+		-95, -1, 77, -22, 96, -52, -46, 17, 39, -92, -99, 48, 72, -8, 62, -49, -98, -50, 13, 64, -48, -99, 78, 5, 96, -90, -2, -83, 53, -60, 82, -99,
+		-65, -34, -28, 8, 22, -90, 82, 97, 59, -46, 6, -95, 75, -94, -85, 96, -4, -91, 8, -24, 61, 7, -44, -2, 75, 91, 79, -92, -32, -52, -1, -67,
+		-14, -74, -24, 64, 41, 7, 32, 46, 78, 50, -86, 85, 76, -26, -46, -65, 62, -65, 63, -30, -67, 13, 78, 73, 71, 26, -73, 5, 75, -41, 29, 62,
+		-61, 92, -100, -33, 30, -16, -92, -98, 36, 77, -86, -88, -100, -15, 79, 12, -7, -88, -89, 46, 42, -78, -13, -67, 94, -40, -35, 16, -39, 54, 82, -54,
+		-94, 47, -79, 53, 53, -13, -98, -47, 42, -38, 18, 99, 55, 86, -33, 63, -31, -88, -27, 16, -26, 14, 3, -85, 95, -45, -7, -52, 25, 67, -20, -47,
+		13, -2, 56, 60, 70, 28, 57, -23, -8, -23, -38, -39, -60, -30, 20, -77, -98, -35, -31, 65, -34, 30, -34, -58, -99, 24, 39, -33, 55, 41, 57, 35,
+		-17, 0, 48, -63, -22, 43, -95, 67, 81, 59, 18, 29, 81, 31, 48, -1, -77, 13, 76, 62, -46, -5, 18, -82, 51, 21, 75, 78, 54, -56, -16, -27,
+		-55, -65, -47, 32, 63, -78, 47, 42, -62, -25, 30, 20, -54, -4, -23, 2, 6, -30, 48, -91, -99, 77, -42, -13, 67, 85, -94, 59, -5, 38, 66, 27,
+		94, -28, -3, 22, -57, 93, -42, -96, 48, 96, -16, 5, 18, 31, 8, 68, 11, 74, -52, -97, -27, 94, -2, -78, 59, -9, -30, -54, 28, 36, 71, -81,
+		-47, 52, 3, 96, 46, 73, -15, 88, 58, 24, 8, 2, -1, -6, 79, -76, -89, -81, 61, 56, 87, 38, 2, -2, -68, 1, -23, -15, -50, -26, 41, 60,
+		16, 12, 54, -23, -26, -5, -13, -30, 41, -74, -29, 82, 96, 99, 37, -25, -37, 45, 78, 59, -62, -61, -19, 28, -34, 67, 94, 6, -17, 70, 2, 94,
+		69, -51, 52, 42, -80, 62, 98, -50, -92, -11, -16, 83, -76, 7, -41, -85, 4, -81, -57, -55, -88, 90, 9, -76, 48, 74, 54, -84, -47, 99, -72, -50,
+		-85, 44, 67, -59, -98, -90, 45, 65, 97, 42, 17, 24, -46, -8, 34, 13, -48, -48, 9, 62, -91, 53, -56, -50, -88, 26, 99, 61, 30, -94, 42, -22,
+		-38, 49, -69, -46, -17, 53, -87, 48, -67, -83, 6, -30, 61, -25, -7, -81, -23, -22, 99, 10, -42, -13, -71, -13, 84, -67, -22, 51, -69, 50, 29, 47,
+		8, 74, -48, 20, 52, 81, 29, 11, -98, -93, 77, 93, -98, -100, 52, -15, -1, -86, -79, 15, 30, 8, 54, -64, -84, 33, 79, 22, 99, 83, 8, 15,
+		82, 82, 78, -23, -17, 58, 31, -63, -66, -25, -19, -17, 7, 8, 2, 84, -61, 18, -82, -29, -52, 95, -85, -73, -7, 57, 4, -1, -45, -12, -96, -19,
+		38, 82, -22, 19, -37, 14, -16, -78, 82, -29, -19, 79, 31, -54, -84, -48, -22, -69, -2, -90, 87, 36, 42, 3, -72, 44, 34, -12, -19, -51, -36, -46,
+		70, -89, -22, 37, -93, -17, -83, 50, 99, -81, 85, 23, 2, -30, 66, 72, -46, -97, -36, -85, 22, 32, -57, -54, 7, 87, 28, 89, -48, 25, 83, 26,
+		-64, -76, -6, 51, -13, 24, 78, -15, 13, 77, -19, 81, -97, 39, -51, -8, 35, -71, 45, 68, -77, 44, -31, -37, -46, -39, -2, -84, 69, -94, -46, 5,
+		72, -18, -35, -31, -27, -73, 18, -41, -30, -9, -1, 70, -63, -66, -4, -60, 35, 56, 46, 68, 12, -45, -41, -83, 18, -91, -76, 97, -4, 51, 29, 90,
+		44, -78, -61, 91, 44, -54, -81, 33, -91, -90, -29, -62, -19, 98, 68, 99, -12, -57, -8, 81, -50, -91, -48, -67, 3, 86, 11, -10, 4, -84, 73, -44,
+		-60, -49, -74, -1, 39, 55, 8, -81, 71, 35, 72, -16, -49, -16, -1, -50, -12, -60, 71, 39, -21, 90, 92, 49, 57, 41, -1, -42, -74, -72, -44, 36,
+		-54, 59, 24, 13, 76, 2, 61, 52, -52, -69, 77, 21, 55, -51, -90, -68, 91, 28, 62, 49, -6, -47, 25, -36, 5, 47, -71, 49, 61, -60, -78, -19,
+		61, 25, -67, -87, -91, -62, -64, -30, 57, -91, 76, 57, 9, -57, 29, 34, -41, -97, -6, 84, 56, 90, 41, 78, -27, 9, -78, -51, -25, -70, 21, -95,
+		41, -37, -71, -62, 79, 28, -40, -6, 98, 62, -17, 32, -46, -26, 84, 35, -24, -21, 72, -15, -41, -46, -35, 80, -100, -34, 29, -30, 36, -32, -60, 77,
+		-14, 91, 7, 91, -7, 6, 6, 77, 38, -35, 94, -4, -43, 58, 7, -92, -63, -81, 80, 2, -45, 86, -76, 7, -2, -79, 65, -75, -75, 49, 67, -78,
+		76, 75, -7, -50, 90, -91, -74, -61, -84, -6, -76, 16, -57, -91, -64, -80, 82, -91, 10, -81, -98, 40, -96, 46, 41, 67, -86, 41, -89, 9, 6, 58,
+		40, -12, 2, 78, 0, 37, 17, 95, -19, -82, 89, 69, 86, -84, -69, 74, 99, -83, -16, -71, 88, -50, -86, -4, 12, 86, -28, -45, -99, 36, 15, -29,
+		38, -30, -43, -8, 66, 25, -45, 43, -42, 74, -78, -82, 22, -29, -44, 83, -63, 49, -92, -2, 69, -12, 99, -28, -41, -53, -89, -9, 95, 16, -67, -67,
+		61, 93, 92, 10, 90, 68, 85, 74, 87, 24, 26, -93, -24, 34, 53, -85, 87, 74, 25, 52, -75, 96, -43, -32, -96, -53, -95, -52, 17, -21, 84, 54,
+		93, -67, 59, -37, 16, -6, -100, -73, 85, 34, -43, 7, -95, -30, 83, 60, 56, -23, 68, 52, 57, -18, -43, -22, -95, 1, 37, -11, 12, 34, 15, 80,
+		-13, -58, -12, 54, -66, 39, 35, 67, -97, -17, 28, 38, -48, -67, -64, 89, -24, -8, 11, -45, -85, 81, 77, 95, 55, -73, 56, -40, -12, -45, 30, -74,
+		12, -73, 46, 28, 40, -68, 42, 13, -34, 40, -61, 28, 57, -15, 80, 28, 18, 44, 29, 4, 44, -88, -44, 45, 67, 71, 78, 13, 74, -33, 76, -81,
+		11, 4, -50, -1, 12, -73, -39, 94, 88, -14, -82, 56, 10, -77, 55, 99, -91, -14, 59, 17, 99, 94, 35, -92, -15, 52, -99, -21, 81, 87, -63, 63,
+		-1, 79, -90, -96, -2, -13, -100, -8, 55, -57, 41, -2, -66, 84, 19, -10, 21, -25, 23, -24, 96, -76, 33, 23, 7, 94, -55, -25, 55, -85, -53, -9,
+		-65, -69, 5, 81, 82, 52, -29, -98, -37, 17, -26, -44, -71, -13, 99, -43, -3, 64, 94, 29, 16, 35, 62, -69, -2, 13, -73, 50, -79, 94, -3, -25,
+		-44, 88, 28, 37, 15, 52, 74, 3, -16, -30, -11, 11, 91, 59, 23, 88, -94, -78, 55, 33, -77, 75, -93, 58, 88, -84, -21, -56, -53, 76, 39, 51,
+		-66, -87, 97, -97, 7, 69, 38, -71, -82, 25, -8, -96, 95, 69, -64, -60, -48, 50, -11, -13, 30, 13, -98, -5, 41, -60, -44, 59, 31, -59, 27, -71,
+		-24, 82, 7, -21, 31, 12, -12, 7, 91, -5, 77, -59, 63, 95, 42, -45, 34, 61, 74, -21, 97, 63, -72, -98, 32, 19, -64, -41, -25, 37, -77, -70,
+		51, 73, -26, -42, 52, -73, 31, 70, -96, 80, 23, 35, -77, -83, 35, -35, -26, 29, -100, 96, 6, -47, -18, 6, 89, -80, -94, 70, 85, 5, -78, -77,
+		-1, 26, 79, -22, -88, -52, -79, -67, 59, -33, 26, -92, -81, 95, 43, -46, -14, 56, -64, 29, 66, -97, -79, -30, -70, 68, 4, -63, -94, -4, -33, -78,
+		-95, 95, -92, -9, 30, 96, -17, 63, -52, -21, -94, 6, -34, -9, -48, -47, 52, -2, -86, 75, 35, -47, 37, 88, -65, 23, -85, -39, 94, 83, -6, 73,
+		-55, -45, -53, 59, 50, -23, 1, -52, -77, 19, -31, 52, 12, -55, 9, 2, 15, 74, -15, -26, 42, 56, -17, -65, 20, 78, 58, 0, 91, 43, -31, -91,
+		78, 61, -20, 55, -77, 94, 13, 73, 93, 63, -2, 15, 21, 26, -67, -18, 0, -9, 5, 56, -51, 96, 56, 8, 16, 54, 91, 40, 13, -64, 81, -87,
+		31, 76, 74, -64, -85, -17, 59, -92, 57, -45, 84, 68, 19, -21, -35, 8, 27, 71, 54, 81, 67, 76, -64, 43, -100, -6, 70, 74, -50, -96, 18, 95,
+		-9, 22, -19, -56, 43, -15, 16, 48, 33, -17, -53, 90, 13, 60, 32, -37, 33, 31, 8, -21, -78, -20, -8, -42, 32, 87, 0, -22, -80, -6, 12, 8,
+		27, 60, 27, 64, -88, -54, -100, 99, 75, 49, -32, 35, 24, 91, -89, -41, 30, -70, 63, -71, 64, 55, 64, 36, 19, -95, 54, -31, -87, -10, 5, -45,
+		68, -40, 37, 78, -24, 44, 30, -90, -28, -22, -50, 62, 81, 92, -35, 16, -95, -41, -90, 73, -2, -34, 70, -58, -35, 7, -21, -54, 5, -14, 20, 78,
+		99, -30, -24, -49, 9, 90, 72, -62, 98, 55, 48, 56, -38, 51, -13, 42, -63, -61, -83, 61, -7, 94, -16, -82, 40, -81, 31, -55, -41, -53, 36, -50,
+		-12, 95, -4, -68, -4, 26, 61, -7, 15, 69, 68, -82, 43, -13, -93, -60, -25, 76, -62, -12, -95, 34, -36, 24, 55, -15, -91, -24, -40, -34, 29, -28,
+		-32, -61, -19, -4, 64, -63, -46, -92, 30, 37, -93, 47, -16, 92, 13, -48, 51, -33, -56, -87, -86, -21, -59, 70, 72, -28, 3, 44, -17, 93, -24, 9,
+		28, 96, -11, -21, 22, -26, 90, 56, 12, -70, -22, -83, 68, 98, 49, 59, -4, 76, 34, -28, 70, -68, 40, 61, 32, 19, 73, 55, 62, 43, -5, -87,
+		87, -93, -59, 87, -86, 52, 66, -81, -57, -24, -72, -23, 35, 75, 22, -37, -50, -89, 16, -61, 73, 82, -34, 80, 3, 39, 41, -83, 43, 91, 59, 89,
+		-68, -21, 30, 28, -32, 61, 61, 64, 5, -24, 54, -17, 25, -98, 67, 72, -21, -3, 27, 89, 90, -66, -100, 36, 83, -76, 13, 78, -50, -59, -68, -63,
+		50, -71, -12, 9, -56, 23, -47, 11, 17, -78, -80, 54, -73, -41, 19, 8, 84, -17, -46, 28, -82, -23, -13, -98, 67, -38, -66, -20, 48, -14, -28, 38,
+		-59, 8, -3, -7, 92, 7, 79, 55, -80, -65, 99, 31, -5, 43, -3, -28, 28, 55, -61, -31, -82, -22, -78, 52, 67, -69, 10, -85, -64, -9, -5, 75,
+		-7, 77, -90, -67, 0, -89, 30, -26, -38, 56, -14, 35, -97, -15, 53, -90, 86, 38, 32, 55, 53, -67, -80, 50, -73, 29, -11, 82, -35, -15, -1, 87,
+		-26, -41, -28, 39, -57, 12, 51, -38, 25, 65, 89, 81, -73, -10, 61, -72, 13, -76, -92, -4, -73, -65, -72, -44, -47, 73, -54, 89, 54, -82, -4, -31,
+		26, 92, -19, -47, 35, 31, 42, 99, 63, 80, 46, -85, -43, -36, -73, 47, 62, -20, -10, 70, -36, 13, -31, -33, 36, 87, 39, 72, -76, 79, -11, 50,
+		89, -99, 77, 59, -47, 3, -87, 55, 92, -44, 42, 63, -96, -90, 57, 32, 70, -88, 19, 62, -43, 71, -27, -38, -73, 39, 26, -52, 3, -17, 38, -5,
+		-95, 34, -68, 46, -95, -62, -70, 21, 56, 23, 16, 36, -78, 95, 59, -87, -1, 2, -27, 26, 67, 2, -73, 94, 93, 42, 62, -61, -6, 8, 7, -82,
+		-30, 6, 61, -12, -10, 3, -57, -47, 3, 22, -13, 14, 27, 32, -53, -12, 67, 1, 20, 50, -98, 19, -62, -36, 66, -57, 59, 91, 37, 23, -84, -93,
+		85, 95, -5, -94, 87, -68, -62, 15, 91, -4, -40, 27, 46, -18, 41, -22, -51, -44, 19, 74, 53, 85, -22, 82, -56, -94, 15, -75, -22, -65, -97, -57,
+		-55, 64, 49, -82, -37, 37, -52, 91, 10, -96, -96, -67, 4, -7, 80, -44, -44, 54, 94, 0, -31, -82, 56, 14, 81, -55, -64, -97, 9, -85, 28, -52,
+		17, -93, 91, 51, 47, -2, 8, 0, -84, -82, 59, 12, -100, 76, -90, 23, 89, -30, -7, -90, -88, -33, 33, 99, 95, 83, -23, 14, 59, 58, 54, 53,
+		71, -74, -8, -83, 12, -62, -20, -52, -91, -23, 60, 16, -23, -53, -85, -73, 14, -53, 12, 19, 49, -94, -44, -62, -17, 18, 72, -41, -43, -61, 68, 10,
+		32, -87, 87, -40, -48, 33, -85, -14, -35, -89, 2, 59, -84, -58, -69, -61, -86, 99, 75, 50, 18, 67, 14, -61, 51, 33, -78, -94, 99, -56, 55, -27,
+		-37, 96, -37, 47, 77, -11, 13, -64, -100, -16, -93, -40, 46, 21, -10, 54, 76, -31, 54, -85, -92, -91, 66, 27, 57, -30, -4, 59, -45, -92, 89, 64,
+		72, -83, -93, 45, -68, 75, 75, -98, 65, -47, -86, -96, -53, 63, -14, 54, -67, 28, 54, -76, 92, -43, 55, -23, -39, 15, -40, -89, 76, 52, -54, 83,
+		76, -73, 60, 93, -94, 49, 2, -11, 9, -13, 31, 80, -87, -88, -34, -73, 97, -52, -84, -99, -31, -92, 9, -32, -46, 28, 80, 12, -29, 44, -28, 60,
+		74, -98, 21, -92, 8, -67, 17, 6, 11, -48, 54, -33, -36, 66, 3, -74, 4, 79, 27, -86, -49, -63, 40, -95, -49, -47, 98, -35, -5, 89, -43, -16,
+		1, 76, -58, -90, 7, 18, -34, -31, 8, 73, -86, -69, -14, -32, -99, 65, -59, -62, 10, 63, 95, 51, -78, -82, 53, -26, -90, 92, -51, -73, 27, -62,
+		-74, -39, -47, -17, 20, 57, -37, 61, 76, -25, 92, 23, -24, 56, 70, -59, -28, 62, 4, -48, 97, 2, -18, -38, 16, -48, 82, -21, 76, -36, 8, -97,
+		34, 3, -41, -78, -11, -55, 4, 54, 5, -31, -75, -40, 25, -17, 28, 24, -6, -31, -94, -64, -96, 70, 48, -55, 7, 48, 22, -34, 61, -13, 65, 17,
+		-34, -78, -31, 51, -6, -66, -4, -56, -80, -94, 6, 13, -4, 99, 65, -87, -21, 6, 33, 9, -93, -21, -67, -52, 6, 41, 95, -61, 91, 88, 51, 16,
+		29, 37, 99, -92, -33, 6, -13, -40, -71, 36, -33, -86, 78, -18, -70, -57, -23, -33, 90, -20, -80, -16, 49, 62, 69, -62, -4, -40, 86, -80, 39, -17,
+		55, -53, -92, -12, -63, -57, -19, -11, 61, 61, 51, 65, -23, 71, -20, 87, -99, 92, 78, 96, -51, 34, -33, -77, 81, -43, 34, 69, 99, -72, -61, -43,
+		-96, -69, 68, -66, -54, -87, 38, 30, -55, 93, -8, 46, -40, -99, 14, -46, 13, 7, 26, 98, -32, 57, 54, 49, 16, -37, 32, -30, -26, -63, -11, 25,
+		-70, 48, -46, 16, -76, -21, 29, 34, -16, 97, -19, -71, -40, -71, -30, 40, 61, -41, -17, -57, -47, 75, 86, -49, -47, -19, -98, 42, 48, -25, -86, -6,
+		83, 52, -55, -12, 92, -9, 55, -92, -74, 85, -25, 41, -64, -20, 27, -88, -27, -88, -38, -16, 62, 9, 96, -99, 21, -28, -80, 73, -16, 86, -15, -85,
+		-100, 24, 73, 16, 41, 74, -5, 59, -73, -25, 81, 2, 10, -12, -87, -46, -58, 75, 77, -91, 26, -21, 39, -49, 36, -69, 87, 12, -23, -37, -92, -58,
+		62, 31, -43, -61, 49, 53, -4, 73, 55, -96, 2, -71, 97, -1, -96, -74, -19, 10, -33, 12, -82, -88, -71, -36, -98, -31, -57, 46, 37, 51, 86, 38,
+		-7, -45, 62, 59, 78, -15, 71, -68, -27, 93, -59, -76, 64, -79, 38, 58, 26, -93, 91, 34, 46, 69, -85, 28, -75, -53, 12, -51, -74, -89, -50, -66,
+		-42, 72, -95, 33, -87, -22, -56, 1, -93, -21, 43, -76, 85, 16, -17, 70, 2, 17, 52, -69, 54, -29, 40, -40, -79, -50, 35, 30, 53, 19, 76, 26,
+		-56, 51, -30, -60, 17, 58, 24, 11, -13, -98, 93, 20, 12, -16, -46, 77, -47, 67, 0, -65, 30, 64, -100, 15, -92, 21, 89, 74, 70, 97, 87, 6,
+		-67, 15, -5, 45, -75, -55, 5, 96, 85, 38, 61, 84, -21, 86, -96, -13, 87, -84, 38, -41, -8, -79, -75, -60, -36, 41, 19, -49, -91, -6, -98, -85,
+		60, 10, 95, 56, 90, 63, 33, 30, -91, 71, 1, 2, -49, -37, -42, -36, 70, 18, 32, -21, -97, -92, 88, -9, -94, 7, 20, 53, 88, -70, -77, -82,
+		80, -10, -41, 28, -63, -73, 33, 19, -1, -71, 81, 63, -45, 50, -24, 51, -71, -83, 3, -39, -6, 51, -98, 43, -62, 83, -99, -66, -23, 31, -9, 19,
+		99, 80, 50, 72, -7, -22, -54, 48, 9, 93, -28, -11, -40, -70, 8, -90, -13, 78, -92, 19, 17, -9, -85, -26, -42, -89, -9, 91, 87, -81, -19, -4,
+		-97, 37, -84, -80, 19, 93, -63, -69, -82, 9, 21, 0, -22, 21, 72, -42, -71, -84, -56, 63, -93, 96, -70, 87, 81, -95, -85, -82, 5, 52, -3, 42,
+		-13, -8, -65, -3, 49, 56, 66, -86, 69, -25, 52, -43, 7, -5, -16, -41, 37, 46, 24, -59, 15, 21, -3, -27, 80, -52, 80, 73, 35, 51, -10, 16,
+		-13, 50, -98, 62, 84, 72, -40, 58, 66, -48, 64, -48, -76, 36, 61, 52, 95, 16, -19, -62, -5, -21, -27, -65, -98, -29, -84, -13, -3, -80, -82, -68,
+		16, 19, 77, 14, 3, -4, -64, 67, -27, -54, -21, 56, -42, 4, 78, 99, -9, -47, -1, 76, -19, -73, -55, 72, 76, 62, 91, 99, -27, 5, -60, 75,
+		63, 87, -51, 74, -64, 71, -15, 28, 5, -10, 89, 33, 97, 0, -86, -17, -40, -81, 82, 19, -85, -13, -77, -51, -42, -64, -63, -53, -78, -25, 17, -88,
+		-26, -66, 9, 14, -20, -6, -97, 4, 78, -29, -13, 69, 40, 43, -96, -60, -52, 99, 36, 36, -41, -64, -97, -51, -69, -93, 12, -22, 62, 22, -82, 95,
+		87, -2, 56, 85, -79, 19, -55, -23, 90, 60, 72, 62, -66, -33, -49, 36, 24, 50, -63, 22, 99, -9, -53, -15, 3, 80, -15, 26, 63, 20, 58, -38,
+		36, -9, -15, -3, 91, -29, -63, -7, -19, 10, 7, 38, -94, -73, -58, 76, 77, 51, 92, -59, 56, -6, -93, 16, 46, -83, -10, -43, -90, -61, 91, -72,
+		-98, -54, -41, -78, -75, 10, -52, 19, -33, 33, -61, -1, 92, -79, 99, -88, -44, 85, -12, -89, 74, -34, -67, -46, -83, 68, -54, 10, 32, 51, -8, -22,
+		-77, 11, 88, 88, 55, 13, 92, 86, -6, -17, -1, 82, -5, -54, 7, -93, 14, 0, -89, -8, 48, 72, -4, -26, -31, -33, -88, -46, -15, 76, -9, -47,
+		1, 73, 36, -35, 41, -22, -7, 88, -96, -89, -85, 40, 93, 37, -4, -94, 62, -31, 39, -1, -2, -21, 71, 97, -83, -77, -97, -19, 47, 27, 39, 83,
+		-71, 88, -50, 31, -12, 22, 55, -84, 26, -32, -85, 69, 67, 28, 87, 12, -18, -99, 78, -23, -42, 3, 16, -81, 99, -79, -98, -64, -74, 59, 43, 79,
+		-12, 2, -93, 12, -92, -88, -5, -29, -56, 10, -5, -99, -30, -100, -2, 82, -1, 87, -44, -55, -52, 96, -26, -7, 26, -50, -60, -80, -78, -15, 49, -81,
+		15, 39, -22, -67, 53, 77, 34, -94, -24, 76, 8, -55, -92, 1, -69, 33, -59, -55, -100, -17, -29, -54, -33, -73, -78, -18, -35, 5, 79, 59, 26, 31,
+		-20, -71, -76, 65, -99, 85, 22, 81, 45, 34, -53, 2, 11, 56, -94, 21, 96, -86, -68, 17, -12, -69, 26, -85, -92, 51, 25, 59, 37, -14, -87, 14,
+		72, -52, 41, -59, 77, 94, -52, 65, 72, 1, 93, -50, 91, 25, 11, 74, -71, 16, 81, -96, -40, -2, 41, -84, 60, 76, 33, -37, 42, 7, 55, -55,
+		-20, 61, -43, 70, -79, 48, 89, 97, -50, -33, -54, 38, 91, -19, 14, -3, -36, -1, -7, 44, 65, 25, 26, -81, -96, 25, 11, 19, 1, 54, 41, 62,
+		-78, -94, -78, -79, 60, 13, 60, 11, 49, -64, 64, -83, 36, 77, 26, -51, -43, -94, -32, -35, -67, -75, -58, 16, -81, 69, -18, -84, -23, -60, -97, -50,
+		-65, 90, 86, -8, -18, 16, -39, 45, -20, 33, -58, 27, 38, 77, -97, -17, -22, -82, -85, -88, 27, 18, 94, 89, 20, -93, -41, -54, -66, 60, -50, 66,
+		-97, 94, 95, 42, 26, -87, 65, -2, -91, 90, -99, -81, 2, -8, 71, 42, 23, 21, -33, 3, -2, 33, -79, 73, 90, -3, -45, 66, -27, 60, 40, -17,
+		-97, 84, -84, 34, 98, 22, -75, 67, 64, 59, 59, -69, 90, -73, 40, 64, -50, 69, 64, 58, 29, -53, -3, -16, 91, 62, 80, -82, -14, 12, -96, 35,
+		-55, -96, 26, 21, -97, -88, 88, -48, 34, 99, -83, 81, -61, -57, -49, 22, 47, -74, -36, 97, -6, 36, -79, -79, -44, -96, 56, -66, 64, 0, -10, -3,
+		-26, -77, 48, 71, 90, -20, -49, 78, -86, -87, 52, -29, -87, -90, -18, 36, -91, 74, 50, 5, -35, -15, 16, 50, -20, 39, -83, -67, -8, -64, -41, 82,
+		55, -40, 16, 17, -54, -30, -85, -71, 21, -99, 26, 73, -91, 79, -82, -52, -42, 93, -39, -40, 36, -20, -32, 0, -9, 45, -74, -42, 41, -44, -100, 49,
+		66, 26, 80, -51, 11, -82, -51, 67, 32, -45, -62, -51, -7, 86, -62, -63, 8, 68, 57, -40, 7, 1, -90, 64, -43, -40, 34, -34, 95, -92, -84, -71,
+		91, -78, 15, 27, 20, 61, -55, -44, -66, 27, 43, -50, -64, -28, 96, 16, -80, -62, 41, 60, -78, 35, 24, 22, -79, 27, -3, -20, -58, -50, 9, 85,
+		-9, -43, 72, -2, 3, -57, -88, 13, -44, 9, 52, -11, -47, 90, -57, -98, -96, 92, 87, -29, -46, -42, 69, 12, 67, -38, -66, 12, 72, -3, -71, 33,
+		28, 20, 42, -25, 5, 62, 44, 65, 19, -67, -4, -9, 40, 97, -55, 47, 6, 91, -92, 44, -31, 94, 3, -27, 5, -35, 1, 72, -27, 59, 50, -96,
+		-73, 3, 34, -2, -27, -18, -69, 35, 94, 93, -76, 59, -3, -62, 16, -6, -31, -34, 1, -90, -42, 66, -28, -30, -41, 6, -22, 13, -6, 56, 50, -22,
+		13, 5, -35, 9, -10, -85, -42, 80, 62, 13, -96, -72, 51, -99, 39, 54, -100, 12, -47, 33, -51, 89, 41, -31, 35, -12, 16, -91, -13, -37, 81, 27,
+		10, -52, 14, 22, 82, 35, -5, 47, -34, -67, 17, 59, 84, -70, 11, -70, -54, -15, -71, -77, -45, -98, -56, 93, -54, 29, -65, 54, 85, 81, 20, -50,
+		64, -15, -19, -11, -7, 82, 32, 10, 85, -72, -35, -18, -95, 73, 71, -18, -48, -64, 67, -75, -69, 23, 92, -30, -36, 45, -93, -33, 32, 97, 52, -57,
+		-46, 32, 8, 92, 11, -86, -70, -67, -69, -85, 62, 92, -65, -7, -52, 11, 33, 90, 94, 3, 71, -63, -36, 42, 45, -26, 73, -63, -71, 61, 72, 12,
+		49, 6, -41, -64, -69, -82, 21, 16, -33, -7, 22, 15, 46, 99, -24, -64, 21, -53, 47, -41, 45, 74, 10, 45, 60, -23, 52, 37, -97, 71, -97, -79,
+		-73, -33, -32, 59, -23, -99, 38, 15, 44, -69, -20, 13, 1, -55, -79, 75, -77, -50, -27, 18, -10, 76, 24, -21, 55, -60, -90, -90, -35, -96, -27, -70,
+		-1, -79, -50, 21, -70, -35, 52, -49, -81, 65, -18, -90, -53, -62, 90, -52, -53, -11, -97, -33, 47, -57, 3, 4, 4, -68, 87, -38, 17, 91, 32, -52,
+		-50, 63, 3, 50, -71, 90, -90, -69, 63, -23, -30, 5, -95, 47, -37, -34, 57, -25, 83, -79, -100, 95, -79, 42, -42, -26, 89, -98, 67, 67, 69, 7,
+		61, -68, -13, 59, 77, 81, -81, 1, 63, 70, -38, -1, -51, 65, -7, 94, -72, -86, -33, -22, -87, 91, -84, 1, -72, 52, -56, -52, 29, 98, 68, 12,
+		82, 48, 63, 76, -68, -15, -10, 33, -56, -98, 66, -82, -11, -91, -95, -69, -57, 61, 15, 0, -97, 54, -66, 9, 12, 14, -64, -84, -17, 83, 44, -58,
+		-36, -70, 60, -52, 62, -92, -6, -38, -75, 99, -36, -80, 33, -69, 83, 49, 49, 49, -24, -100, -95, 79, -2, -83, 0, 27, 5, -9, 64, 69, -44, 34,
+		-73, 6, -51, -84, 65, 31, -71, 10, -70, -27, -85, 8, -14, -21, -65, 33, -45, 17, -39, -55, -88, -58, 91, 40, -91, -91, -98, -32, -53, 81, 65, 1,
+		-35, -33, -56, -69, -82, -10, -14, -49, 97, -13, -7, 33, -14, -13, -93, -78, -76, 60, 27, 67, -35, -64, 14, 50, -37, -40, 97, -17, 64, -76, 91, -2,
+		-82, 33, 87, 19, 89, 3, 87, 34, 40, 0, 67, 67, -9, 71, 27, -71, 45, 28, -40, 6, 96, -75, -46, 48, -39, 87, -86, 80, 33, -86, 90, -76,
+		36, 49, 97, -75, -6, 54, 99, 38, -28, -98, 86, -21, 15, -41, -46, 61, -10, -20, -43, 23, 92, 19, 62, -21, -97, -61, -88, 65, -23, -57, 76, 33,
+		85, -26, -58, -37, 73, -84, 51, 25, 34, -42, -55, -45, 83, -46, 43, 87, -74, 26, 86, -46, 36, 99, 41, 10, -60, 11, -78, -20, -5, -51, -54, 95,
+		-71, -99, 6, 3, 45, 38, -43, 57, 70, 14, -81, 7, 51, 98, -27, 77, 85, -81, -75, 85, -19, 7, 80, -18, -27, -27, -59, 49, -22, 5, 48, 53,
+		-95, 27, -9, 42, 36, 98, -52, -89, -54, -56, 92, -99, 8, -22, 41, -92, 72, 15, 0, -74, -36, -35, 76, -60, 9, -26, 93, 0, 6, -64, -41, -62,
+		-91, -29, 20, 28, 86, 98, 69, -74, 84, 65, -77, -73, -13, -57, -9, 85, -92, 83, -72, 52, -14, -42, -81, -35, 26, 39, -34, -24, -53, -50, 16, 11,
+		-64, -3, -19, 21, 80, -36, 86, -65, 95, 23, -90, -35, -99, -9, -95, 12, -79, -74, 44, 5, 77, 18, 73, 52, -9, 44, -84, -90, -92, -22, 80, 16,
+		-63, 69, -42, 47, -78, -98, -27, -44, -92, 13, 95, 96, -98, -98, -48, -46, -29, 63, -60, 7, 46, -14, 66, -58, -27, 68, -86, -51, 9, 22, 13, -87,
+		-16, 65, -86, -74, 86, -5, -4, -87, -10, -48, -90, -83, 14, -29, -95, -91, 49, -62, 14, 40, -65, 47, -39, 18, -28, 53, -82, 85, 82, 80, 56, 26,
+		-85, -51, -91, 43, 66, 99, -21, -95, -45, 26, 58, 63, 9, 38, -91, -88, 75, 12, 0, 28, 76, 88, 66, 10, -18, -72, 91, 68, -10, 62, -95, -35,
+		-25, -92, -34, -97, -95, -5, -12, 10, -3, 6, -99, 26, 45, -11, -81, -30, -9, -10, -41, 6, -13, 74, -70, -84, -44, -38, 47, -89, 16, -8, -17, 2,
+		-31, -1, -53, -66, -81, 30, -89, -73, 39, 92, -16, -58, -82, -32, 47, 62, -76, -36, -24, -60, 78, 8, -90, -11, 18, 89, -74, -69, -28, 84, -6, 4,
+		-45, 50, 35, -77, 67, -30, 75, -95, 1, -70, -29, -57, -55, -40, 16, 97, 62, 57, -62, -50, 95, -87, 40, 41, 11, -100, -59, 57, 4, -65, -43, 64,
+		-26, 86, 8, 74, -94, -29, 5, -1, -33, -3, 75, -36, 79, -86, -21, 82, 24, -88, -70, -63, 7, 74, 71, -19, 74, 97, -10, -3, -73, -69, 2, 38,
+		-69, -16, -60, 61, 18, 36, 9, 33, -63, -66, 95, -83, 84, 52, 41, 57, 54, -32, 58, -46, -64, -38, 71, 32, 5, 93, 25, 31, -10, -78, 93, -78,
+		90, 54, -60, 8, -84, 62, 94, 4, 10, 72, 89, -58, 77, 86, -13, 9, -71, 52, -71, 87, 46, -3, 40, 25, -24, 6, 42, 23, -60, -42, -65, 89,
+		77, -59, 58, -27, -96, -15, 26, -5, 27, 81, 25, -83, -67, -48, -71, -87, -91, -16, -84, -7, 36, -41, 42, 39, -39, 95, -68, 25, 99, 72, -80, 56,
+		83, -72, -74, -22, -24, 62, 90, 26, 25, 98, 66, -51, 18, -77, -41, -32, -7, 20, -89, 46, 20, -89, -71, -65, -70, 21, 13, 32, 83, -79, -20, -70,
+		29, 70, -34, 35, 50, 48, 33, -17, 14, -81, 38, 26, 10, 18, -77, 2, 81, -15, 22, -47, 14, -64, 3, 27, 89, -5, -3, 83, -14, -50, 0, -10,
+		-68, -9, -30, 6, -18, 9, -34, -85, 97, -59, -77, 68, -78, 97, 43, 99, 32, 50, 67, 88, -98, -69, 98, -20, -47, -79, 52, -76, -21, -93, -60, 47,
+		13, -56, 2, -72, 15, -32, -18, -41, 97, -93, -70, 50, 9, 41, -62, -82, 38, -25, -87, 94, -41, 65, -79, 17, 64, 99, -20, -55, 99, 24, -7, 23,
+		-95, 73, 14, 77, -60, -81, 10, 7, 87, -94, 76, 90, 33, 70, 10, 55, 76, 64, -7, -78, -29, -83, 10, -6, 37, -6, 77, 8, 67, 49, -57, -23,
+		18, -87, 53, 65, -55, 83, -43, -2, -67, -34, 22, -85, -2, -30, 94, 44, -99, 17, -96, 56, 94, 29, 72, 89, -23, -57, 54, 24, -71, -86, 30, -66,
+		27, -44, -99, -79, 0, 21, -98, -69, -28, 77, -77, -47, -6, 12, -95, 70, -7, 84, -71, 52, -93, 37, 11, 59, 41, 22, -35, 74, 56, -76, -40, -76,
+		-45, 80, -79, -50, -20, -42, 1, -51, -15, 84, -80, -86, -82, 16, 59, -68, 30, -87, -2, 13, -65, -66, 67, 51, -9, 63, -62, 95, 37, 38, -18, 34,
+		-60, -45, -72, -94, -24, 42, -1, -33, 61, 57, -48, -67, -27, -38, -20, 87, 41, -13, 13, 93, 16, -70, 49, -66, -86, -86, -17, -25, 15, 71, -8, -55,
+		47, 49, 35, 88, 8, 74, 76, -22, 87, -23, 86, 47, 87, -60, 36, -38, 48, -93, 91, -78, -81, -50, -24, -83, 33, -75, 44, 19, -60, -26, -3, -50,
+		74, 13, -3, 78, 91, 62, 10, 29, 8, -22, -72, -1, 96, 9, 77, -11, -29, -17, 16, -86, -14, 81, 8, -11, 34, -19, 41, -56, -19, -54, -53, 42,
+		-34, 76, -51, -79, -39, 23, -85, -89, 14, 92, -73, -55, -5, -79, -12, 40, 78, 37, 63, 66, 71, -32, -41, -42, 31, -56, -79, -81, 54, -19, -53, -65,
+		99, 45, -58, 89, -11, -69, -16, 61, -19, -51, -62, 87, -76, 93, 13, -30, -87, -33, -58, -47, -64, -77, -18, -65, 84, 6, 13, 65, -16, -78, -35, -65,
+		-31, 37, -73, 36, 79, -59, -92, -25, -24, 48, 21, 68, 14, -24, -48, 41, 48, 25, 20, 12, -38, -100, -62, 81, -15, -93, 25, 22, 30, -46, -92, 7,
+		-68, -89, -53, -86, 7, 57, -58, 62, -36, -21, -89, -92, -26, -82, 8, 48, 10, -18, 72, 57, 64, -56, -18, 33, 60, 39, 37, -42, 71, -20, -16, 22,
+		-68, 85, 55, -28, -16, 68, 24, 90, 36, -13, -58, -91, -28, -53, 17, -39, -12, 68, 21, 68, -49, -66, -19, -3, -87, -41, 40, -35, -73, -9, -36, -15,
+		-52, -86, -42, 6, -84, -35, -8, 23, 15, -32, -5, 97, -43, 74, -4, 32, 50, 29, 10, -66, 92, 93, -70, 94, -37, 47, 9, 0, -3, -19, -80, 27,
+		-71, 4, 51, 62, -4, -43, -81, -45, -17, -4, 79, 64, 23, -44, -58, 78, 12, -33, -13, 80, 17, 2, 50, -66, -22, -86, -20, -22, -15, 8, 62, 33,
+		-90, 22, -81, -79, -49, 52, -37, 50, -83, 72, 98, -4, -96, -16, -62, 24, -73, -9, 21, 68, -90, -47, -58, 3, 21, 53, 84, -44, -79, -64, -40, 57,
+		55, 64, -63, -39, -95, 1, 19, -41, 25, 85, -78, -59, -13, 6, 31, -24, -82, -56, -15, 99, -29, 96, -1, -87, 79, 56, 75, 33, 70, 33, -8, -99,
+		49, 59, 27, 7, -69, 48, -56, -7, -72, 13, 1, 30, 32, -92, 39, -75, 53, 47, 60, 44, 86, 72, 83, -3, 41, -55, -3, -17, 62, -13, -12, -100,
+		-59, 28, 55, -80, -92, 70, -79, 29, -76, 33, -19, 25, 56, -14, 2, 59, -23, 75, -2, -72, -10, 98, -38, 48, 60, 31, 55, -55, -70, 47, 83, -33,
+		-77, 28, 97, 60, -44, 81, -82, 65, -65, 51, -99, 94, -30, 68, -48, -85, -14, -63, -100, 89, -64, -81, 11, 40, 41, 41, 77, 60, -59, 90, 11, -61,
+		0, -69, 12, -47, 10, 32, -62, 48, -35, 56, -48, -17, 74, 18, 88, 52, -96, 40, -65, -7, 21, 57, -82, -68, -82, -27, -57, 62, -54, 54, -53, 55,
+		86, 67, -93, 8, 75, 63, -60, 92, -99, -59, 5, 4, -34, 21, -68, -41, 79, 57, -41, -54, -37, -73, 18, 68, 79, 15, 59, 86, 45, 93, -29, 41,
+		71, 29, 55, -77, -28, -12, -100, 62, -55, -66, 56, 96, -87, -9, 15, 44, -100, 31, -97, -97, -94, -25, -66, 74, 15, 10, 14, -81, -82, -21, -9, 78,
+		-74, 62, 62, 86, -60, 4, -33, -90, 37, -1, -5, 64, -87, 71, -26, -70, -18, 11, -41, -46, 91, -68, -78, 14, 96, 4, 12, 46, -10, 68, -16, -41,
+		-68, -67, -45, -5, 41, 4, -98, 76, -93, 56, 42, -51, 64, 43, -89, -33, 0, 93, -9, -66, -27, 26, -74, -21, -12, -27, 26, 3, 54, 49, -63, -98,
+		83, -61, -59, -75, 40, -46, -62, 88, 37, -10, 8, -47, -67, -45, 16, 80, 65, 18, -44, -85, -75, 12, 30, 5, 52, -68, -68, 3, 8, -85, 46, -94,
+		27, -27, 36, -29, -16, 34, -27, 42, 45, -53, 10, -26, 37, -3, 86, -50, 27, -77, -33, -90, 27, -55, -1, 76, 98, -13, -32, -83, 12, 80, 7, 72,
+		14, 86, 96, 60, -7, 43, -34, 26, 56, -66, -96, 79, -75, -12, -3, 16, -19, 79, 50, 22, 11, 94, 99, 37, -92, 52, -98, 87, -60, -53, -31, 61,
+		74, 38, 22, -84, -54, 28, 20, 14, 85, 18, 87, 44, -38, 73, 91, -87, 70, -66, 64, -43, 42, 91, 44, -17, 16, 34, 48, -36, -24, 46, 68, 89,
+		-50, -27, -26, -2, 9, 68, -70, -98, 28, 34, -23, 8, -5, 27, -53, -34, -91, 92, -4, 98, -58, 32, 30, -68, -1, 35, 14, -58, -52, -32, -27, 16,
+		-100, -10, 83, -46, -63, 70, 2, 3, -17, -1, 16, 48, -60, 53, -1, -92, 50, -36, -45, 26, 96, 94, -33, -99, -62, -99, 56, -95, 18, -76, -15, 3,
+		-99, 65, -8, -40, -78, 51, -94, -27, 69, -92, 7, -73, -34, 21, -88, 96, -75, -82, -8, 67, 0, 69, 17, 2, 84, -95, 8, -65, -47, 43, -14, 50,
+		-62, 2, 91, 20, -88, -97, 49, 20, -84, -30, 22, -7, 27, -75, -44, -34, 74, -72, -6, 81, -23, -50, 36, -98, 0, -58, -33, -5, 5, -77, 46, 46,
+		-40, 7, -67, 92, 94, 55, -89, -87, -90, 45, -89, 36, 97, 3, -96, 5, -100, -48, -25, -11, 89, 16, -82, 72, -73, -19, 70, -73, -2, 19, 11, 7,
+		33, 28, -50, 71, 32, 58, -27, -46, -94, 2, -72, -70, -66, 67, -81, 50, -81, 67, 0, 30, 27, 15, -73, -23, -7, 19, -65, 82, 20, 14, 54, -47,
+		67, 23, -46, -97, -38, -23, -40, -73, -41, -37, -46, -37, -80, -81, -38, -49, -47, 75, -49, 36, -47, 55, -4, 13, -66, 29, 94, -83, 26, 37, -29, -82,
+		82, 88, 13, 66, -13, -60, 11, 44, 47, -81, -98, -58, -86, -58, 48, -83, -5, 97, -37, -96, 80, -74, -53, 21, -98, 23, 7, 53, 77, -25, 26, 96,
+		28, -82, -43, 58, -47, 8, -51, 50, -85, -91, -27, 33, 19, 88, -59, 91, 56, 29, -44, 5, -32, -2, 70, 77, -50, -99, 78, 48, -3, -13, 49, -11,
+		67, 53, 59, 2, -9, 61, -71, 69, -72, 69, -48, -94, 45, 6, -16, -22, 30, 20, 52, -63, -62, -99, 65, -44, 54, 82, -22, 14, 79, 74, 79, -5,
+		97, 43, 38, -5, 68, 43, -57, 65, 9, 21, 74, -87, -40, -86, 91, -57, -66, -52, 73, -49, 31, -96, -82, -21, -77, 98, 81, -82, 85, 40, -74, -52,
+		-37, -63, -40, 49, -6, 26, 36, 77, 95, 84, 10, 94, 24, -1, 68, 53, 14, 1, -81, -40, -72, -51, -96, -76, -74, -60, 90, 46, 19, -25, 95, 19,
+		-67, 31, -23, 43, -51, 47, -78, 15, -13, 88, 80, -72, -6, 82, -89, 88, -41, 12, 50, 1, -6, -14, -70, 92, 35, -48, 50, -39, -50, -6, 31, 15,
+		57, 55, 3, -87, -39, 93, -83, 79, -18, 98, -27, -60, -41, -90, 36, -24, -13, -21, 15, 68, 2, -92, -51, -2, 44, 75, -19, 95, 52, 8, -56, 27,
+		79, -26, -98, 1, 73, -80, -69, 65, -71, 26, -95, -61, -27, 18, 70, 19, -10, 20, -33, -4, 25, -37, -73, 13, 81, -55, -78, -41, 96, 57, -56, -48,
+		-52, -28, 97, -88, -48, -14, -8, -21, -82, -55, -35, -21, 62, -100, -69, 33, -84, 2, -12, 67, 99, -15, -67, 20, -51, 30, 37, -34, -32, 58, -60, -95,
+		-6, -27, 78, -92, 28, -6, 92, 64, -92, 19, 35, -70, -94, 62, 51, -53, 45, 0, 56, 78, 60, -93, 73, -58, 81, -78, 20, -73, 66, 62, 22, -47,
+		-78, 89, 51, -56, 87, 61, -98, 65, 34, -31, 63, -64, 9, -20, -36, -97, -58, -86, -66, 55, 50, -54, -90, 2, 81, -34, 8, -86, -5, -43, 51, 12,
+		61, 48, -81, -31, 30, 32, 56, -42, -4, 49, 99, -30, -62, 66, 51, 34, 8, -2, 82, -88, -79, 5, -38, 71, -43, -48, 9, 14, -73, 49, -23, 27,
+		-73, 0, 60, -46, 0, 42, -82, 43, 29, 81, -92, -17, -78, -35, 72, 89, -62, -54, -93, 20, -6, -8, -74, 59, 97, -17, -54, -95, 29, 23, 22, 69,
+		96, -45, 99, 96, 85, 86, 89, 6, 46, -25, -32, -62, 85, -21, -49, -76, 80, 37, -89, 13, -80, 34, -39, -20, -98, 30, 81, 42, -13, -98, -91, 66,
+		-54, 96, 18, 0, -12, 64, -9, -47, -60, -60, 84, 6, -55, -8, -42, 36, 30, -13, -67, 14, -68, -72, -14, -55, -86, -7, 68, -74, 89, -2, 90, 69,
+		76, 9, -96, 55, 23, -70, 49, -92, -100, 12, -88, 89, -22, 20, -13, 46, -12, 45, -69, 11, 17, 83, 48, -51, 54, -78, -32, 72, 26, -19, 33, 79,
+		-34, -86, 50, 83, -42, -5, -48, 12, 6, 11, -4, -86, -41, 3, 29, -64, -62, 97, -22, 65, 76, -3, 5, 47, -2, -97, 0, 4, 54, 18, 60, -89,
+		86, -71, 84, -34, -94, -66, 93, -40, 1, -39, -97, -13, -52, 10, 66, 68, 0, -10, 69, 79, -5, -49, -95, -31, 93, 93, -70, -6, 71, -26, 6, 58,
+		1, -20, 7, -21, 22, 69, 73, 91, 14, -83, 35, 67, 28, -73, -91, 70, -21, -86, -29, 45, -60, 44, 92, 44, -5, 90, -33, 89, -21, 90, 58, 10,
+		3, 18, -21, 6, 32, 36, -15, 44, 13, -90, -22, 2, -75, -72, -12, 54, -39, -66, 80, -92, -30, 84, -83, -70, 41, 88, 70, -35, -66, -44, -3, 31,
+		-43, 19, 10, -28, 14, -69, -75, -2, 93, -69, 9, 15, 14, 29, 15, -2, -88, -34, 58, -59, -28, -79, 37, -97, 41, 26, -11, -80, -62, 69, -12, 75,
+		-86, -40, -95, -44, -81, 5, 80, -58, -55, -68, -57, 79, 3, 83, -42, -18, 83, -57, 17, -100, -91, -7, 94, -81, 64, 84, 99, -16, -45, 50, -74, 7,
+		-21, -20, -70, -10, -66, 81, -28, 73, 87, 56, 9, 81, 79, 11, -75, 96, -4, -99, -63, -5, -36, -63, -62, -73, 33, -76, 17, 70, 69, -32, 75, -87,
+		-86, -58, 89, 40, 6, -54, -71, 22, -53, -21, -11, -47, 82, -29, 51, -41, 43, -96, -93, 48, 41, -85, -80, -42, 17, 53, -6, -42, -36, 99, -80, 54,
+		44, -80, 88, 19, -29, 48, 2, -84, -75, -66, -70, -4, 82, 53, 73, 86, 37, -60, 23, 57, 9, -98, 39, 95, 5, -76, -43, 59, 60, 19, 17, 80,
+		62, -56, -80, 77, 50, -8, -100, 42, 97, -1, -30, -2, -31, -82, 60, -91, 77, -79, 34, -90, 0, -89, 2, -100, -46, 16, -82, 48, -21, -17, -87, -77,
+		92, -66, -74, -62, -22, -59, -1, -17, 23, -29, 3, 58, 93, -16, 64, -99, -30, 87, -98, 98, 35, 43, 11, 11, -71, -79, -51, 20, -1, 49, 50, 63,
+		52, -47, -54, -86, 95, -37, -18, 52, -55, 4, -3, -72, -80, 4, 12, 34, -18, 71, -95, -90, 30, -79, -26, -19, -97, -82, -34, -43, -43, 89, 82, 73,
+		-29, 18, -73, -27, 97, 84, 88, 29, -84, 82, 59, -11, -75, 51, -1, 94, 57, 60, 0, -28, 36, -64, 40, -2, -22, -59, -16, -24, -24, -64, -42, 24,
+		87, 49, -99, 54, -52, 41, 98, 91, 50, 54, 75, -22, -7, 4, 40, 39, -52, 94, 43, -76, -96, 35, -82, 40, -78, -33, 38, -54, 22, 32, -32, -58,
+		-19, -53, -17, -15, -12, 87, 24, 58, -66, 63, 79, -42, 0, -85, -88, 83, 3, -25, -70, 81, 0, -10, 28, 30, 19, 27, 86, -32, 65, -93, -85, -68,
+		-16, 18, -15, -2, -33, 55, 55, -56, -63, -74, -29, 36, -12, 98, 81, 94, -12, 19, 88, 12, 24, 20, -85, 30, 98, 38, -89, -3, 72, -72, -95, 46,
+		55, 60, -89, 14, -7, 12, 90, 13, -76, 19, -88, -100, -90, 61, -91, -58, 83, 44, -28, 11, -89, -47, -44, 52, -10, 54, 39, 95, -34, 11, -54, -48,
+		89, -56, -89, 95, -86, 76, -62, 5, -18, 42, -22, -34, 4, -5, -51, 97, 71, -58, 37, -19, 95, 70, -43, 65, -44, 12, -38, 86, -54, 16, 65, 16,
+		-43, -47, -84, -19, -21, -68, -13, 2, -25, 47, 4, 93, -87, 37, -79, -45, 86, 41, -39, 61, 50, 28, -2, -10, -35, 5, 61, 56, -85, -64, 41, 98,
+		-72, -37, 44, -93, 13, -98, 50, -37, 23, -6, -36, -95, 2, 83, 66, -25, -90, 34, 79, 65, -2, -20, 48, -98, 13, 65, -29, 5, -84, 60, -50, -85,
+		-98, 91, 81, 93, 74, 25, 50, -37, 36, -45, -83, -16, 56, 85, -87, 4, 1, 67, 31, 82, -92, -79, 69, -93, -40, 94, -41, -44, 38, -36, 9, -90,
+		-14, 77, -29, -80, 91, -28, 23, -98, -36, -42, -94, -65, 86, 69, -59, -94, -16, 15, -85, -87, -62, 98, -23, -18, -51, 90, -29, 65, 27, -17, 6, -97,
+		-28, 88, 88, 25, -27, -36, 89, 10, -4, -47, -35, 30, -86, 1, 77, 78, 44, -90, -20, 81, -56, 75, 53, 14, -58, 4, 89, -82, -35, 42, -92, 19,
+		79, 63, 26, -52, 87, -56, 5, 30, -8, 21, 94, -5, -5, -39, -7, -17, 14, -36, 88, 39, 57, -88, 26, -37, 42, -87, 62, -44, -64, -63, -80, -94,
+		-70, -13, 78, 73, -34, 46, 6, 19, 33, 51, -63, -60, 11, 46, -87, 52, -9, 34, -97, -22, -1, -83, 40, 78, 22, -44, 75, 57, -44, -30, 62, 40,
+		-53, -26, 68, 35, -28, -6, 75, 84, 53, -67, -53, -19, -5, -62, 10, -19, 96, 12, -93, 6, 35, 32, -92, -27, -10, 76, 64, -68, -17, 57, -47, 73,
+		93, 12, 39, 38, -90, 81, -80, -81, -47, -49, 59, 66, 74, -22, 33, 1, 42, -87, 68, -19, -97, -27, 18, -89, -85, 91, 93, 96, -44, -36, -62, 81,
+		1, -87, 17, -8, 39, -27, 44, -31, 36, -54, 46, -38, -89, 64, 20, -82, -19, 61, -39, 58, -7, -98, 24, 26, -66, 96, -75, 28, -2, 69, 58, 88,
+		49, 33, 30, -70, 51, 52, -45, -91, 86, 97, -75, -35, 45, 15, 58, 67, 58, 87, -99, 15, 23, -42, -4, -81, -76, -32, 78, 3, -6, -59, -7, 32,
+		-95, 28, 37, -63, -91, 85, 27, 57, -13, 48, 10, -80, -22, 65, -53, 95, -11, 58, 49, -5, -69, -34, 6, -98, 74, 31, -53, 5, -15, -22, -8, -90,
+		-93, 34, -24, -36, 16, -58, -38, 91, -82, 23, 75, -32, 25, -42, -14, 79, 70, 96, -68, 49, 82, 9, -65, 12, -51, 28, 32, 2, -46, 40, 10, 24,
+		-92, 55, 60, 77, 19, 10, -60, -38, 64, 23, -85, 40, 73, -83, 21, 0, 39, -46, 50, 59, 54, 94, 88, 37, 30, -55, 15, -8, 90, 79, 66, -38,
+		20, -66, -4, 95, -89, 55, -43, -21, 94, -48, 63, -41, 55, 95, -10, 5, 31, 49, 52, 91, -58, 82, 17, 98, -69, 59, -20, -85, -5, -97, 53, 77,
+		-9, -22, -1, 85, -82, -40, -51, -64, -14, -95, -98, 80, -58, 47, 57, 65, 44, -87, -48, 10, 8, -73, 57, -87, 34, 89, -9, 88, -42, 31, 82, -34,
+		86, 81, -55, -65, -29, -49, -97, 64, -4, 23, 34, -78, -81, 57, 80, 78, 10, 84, -16, 74, 37, -88, 16, 48, 23, -61, 90, 36, -9, -6, -33, -23,
+		-80, 51, -18, 97, 23, -59, -85, -10, 96, -65, 67, -77, -41, 24, -79, -3, -10, -51, 26, -56, -98, -12, -34, -49, -21, 98, -22, 66, -31, 96, 14, 92,
+		21, 3, -83, -96, 95, 6, 64, -47, 20, -40, -99, -53, -57, -44, -36, -47, 1, 8, -17, 94, -31, -99, 47, -30, -87, 78, -81, -63, 43, 98, 62, 86,
+		-60, 71, 53, -44, -43, 73, 6, 36, -67, 29, -72, 65, 83, -93, -60, 37, 54, -76, 91, -44, 42, 18, -45, -100, -87, -80, -100, 0, 73, 32, -16, -65,
+		27, -39, 34, -75, -48, 46, -58, 18, -12, -80, -98, 89, 0, -48, -10, 42, -44, 39, -7, 43, -94, 58, 75, -67, 42, 27, 97, -65, 53, -48, 88, 12,
+		-67, -44, -76, -92, 59, 29, -74, 74, -65, 20, 52, -4, 65, -60, -75, -30, -20, -35, 42, 2, 95, -76, -92, -76, 86, -88, 23, -13, 53, 15, -38, 48,
+		90, -65, -11, -17, 18, -71, 83, 74, 63, -32, 56, 99, -4, -70, 13, 8, -14, 17, 24, 87, 10, -90, 94, 19, 56, -37, 80, 89, 55, -58, 51, -26,
+		-1, -65, -57, -1, -45, -31, 22, 60, 79, 31, -58, -10, -99, 12, 48, -47, 54, 76, 89, 41, 17, -33, -21, -99, 43, 22, 9, -92, -9, -62, 49, 47,
+		90, 4, -83, -24, 17, 2, 75, -86, 78, -12, 20, -53, 25, -29, -74, -94, 68, 66, 9, -30, -88, -24, 4, -93, 53, 19, -53, -24, -14, -65, -92, 48,
+		63, 0, -60, -30, -93, -89, 53, -45, -78, -22, 68, -56, 65, 72, -28, -71, 61, 52, 81, 8, 99, -42, 77, 23, -52, -36, -98, -18, 35, 11, -26, -68,
+		-72, 20, -60, 91, -94, -18, 22, -87, -77, 8, -75, 87, 91, -26, -82, 58, 56, -10, 42, 85, -5, -64, -96, 45, 79, 47, -1, 6, 64, -85, 26, -94,
+		74, 10, -88, 51, 68, -83, 38, 10, -14, -80, -39, -48, 67, -56, 24, -13, 42, -14, 31, -54, 17, 8, 92, -44, -42, -41, 40, -46, 91, 57, -38, -14,
+		-2, 95, 57, -2, -40, 29, 70, -22, 82, 42, 24, 62, -57, 8, -69, 15, -43, -19, 71, -53, -100, -89, 20, -3, 69, 59, 10, -93, -15, 26, 41, 52,
+		-54, 98, 92, 92, 17, 17, -55, -18, -93, 81, 71, -29, 37, -36, 20, -42, 61, 85, -88, -23, 54, -19, 68, 71, 54, -67, -57, 59, 89, 18, -76, -63,
+		-25, 99, 18, -25, -70, 29, -91, 37, -67, 50, -9, -26, 25, -13, 33, -30, -1, 72, 58, -60, -89, 68, 71, 95, 99, -48, -63, -85, 43, 10, -77, -8,
+		52, -89, -16, -63, 97, -28, -20, -94, 48, 69, 38, -20, -39, 9, 12, 92, 44, 42, -37, -87, -33, -55, 87, 0, -27, -22, 33, -94, 55, -83, 76, 22,
+		-15, 64, -15, -51, 54, -51, -10, -56, -60, 92, -48, -37, -24, -71, -12, -48, -34, 71, 74, -83, -88, -81, -69, -18, -14, 35, 18, 20, -37, 68, 88, -49,
+		-1, 43, -98, -11, 99, -92, 75, -39, -38, -55, -64, -13, 71, 96, 96, 39, 94, 44, 69, 75, 2, -50, 37, 75, -44, -43, 30, 1, -99, -10, -71, -72,
+		75, -66, -47, 59, -12, -43, 73, 11, -88, 6, 50, -67, -41, 21, 7, 38, -53, -27, -75, -50, -71, -88, 46, 3, 67, -27, -66, 99, -54, 2, -51, 23,
+		3, 89, -64, -87, 81, -53, 60, -6, -36, -1, 29, -22, -87, 85, 74, -40, 92, 99, -63, -47, -30, 99, 5, 54, -11, -22, 39, 15, -51, 57, 25, -78,
+		84, -52, -18, -7, -62, 6, -40, -88, 20, -31, 58, 61, -21, -68, 50, -57, 79, 70, -59, 39, 35, -51, -38, 96, -88, 60, 89, -5, -24, 81, 6, 31,
+		33, 77, 76, 28, -90, -70, 35, -62, 72, 43, 58, 82, -98, 4, 45, 54, -14, 49, 25, -72, -80, 15, 22, -12, 77, 94, 56, 93, 62, -77, -3, -43,
+		-33, 48, 34, -22, -7, 28, -27, 11, -65, -99, -3, 69, 91, -61, -53, 60, 65, -82, -93, 40, 3, -92, -98, 78, 34, 57, 36, -60, 89, -46, 5, -82,
+		36, 13, -4, 69, -45, -22, -27, -98, -22, 51, 41, 22, 91, -97, -96, -64, 16, -90, 14, 57, 89, 95, 47, -73, 9, -95, 63, -79, 85, 0, 79, 99,
+		20, 66, 98, -58, -64, -77, -16, 48, -46, 4, -90, 82, 77, -94, -44, -64, -25, -18, 44, -94, 68, 35, -7, -26, -50, 40, -51, 70, -84, -97, -47, -60,
+		-76, -73, -2, 38, 12, 51, -76, -54, -75, 37, -94, -6, 79, -34, -42, 74, 64, -70, -48, -4, -98, 69, 89, -86, 39, 26, -5, -45, 22, 51, -36, 6,
+		49, -93, 67, 43, -28, -86, -37, -4, 21, -53, 95, 64, -95, 39, -57, -44, -36, -12, 48, -46, 33, -84, 27, 75, 14, 79, -14, 80, 85, -90, -69, 16,
+		-18, 13, -50, -57, 48, -68, -38, -14, -47, -31, 33, -89, -20, -22, -69, 29, 73, -18, 25, 80, -46, -47, 36, 16, 12, -67, -90, 90, 46, -69, 18, -68,
+		57, -56, -74, 44, -88, -36, 2, -5, 45, 45, 25, 94, -55, -68, -79, 34, -96, -3, 10, -66, 13, -24, -43, -48, -67, -70, -19, -64, -82, -63, 51, -50,
+		-83, 29, 94, -58, -24, 22, -42, -66, 57, -20, -10, 41, -30, 74, -61, 6, -98, 24, 13, -89, 95, 62, 66, -80, 50, -46, 19, -63, -42, -33, 69, 68,
+		-67, -51, -78, -58, -62, 90, -80, 75, -77, -66, 77, 85, 56, 39, -3, 36, 43, 29, -60, -18, 72, 65, -72, 4, -31, -82, 73, -55, 5, -76, 35, -28,
+		30, -50, 18, -55, 9, -45, -18, -99, 83, -44, -89, 28, -91, -1, -69, 18, 87, 6, 5, -26, 78, -57, -5, 93, 98, -29, 8, 46, -84, -54, 78, -71,
+		-28, -33, 22, 85, -44, 95, -36, 44, -84, -14, -61, 85, -89, -57, -2, -87, 2, 93, -15, -45, -50, 9, 84, -91, 53, 59, -4, 8, -76, -21, 25, -52,
+		72, 47, 97, 59, -50, -90, -51, -65, -12, 20, -72, -27, -59, 5, 87, 33, 48, 99, -59, -78, 90, -12, 57, 38, 5, -3, 48, 30, 7, -3, 25, 68,
+		-81, 15, 13, 35, -20, 15, 25, 40, 31, -15, -6, 20, -13, -8, 87, 80, 64, 20, 91, -88, -21, 6, -41, 17, 53, 54, 33, -94, 82, -72, 32, 80,
+		73, 15, 58, 4, 51, 37, 27, -18, -40, -18, 48, -12, 55, -31, -16, 73, -23, -44, -47, 90, 20, -66, 71, 34, 90, 16, 63, 74, -4, -50, -37, 48,
+		64, -79, 25, 99, 46, 28, -86, -69, -32, -44, -85, -37, 8, 13, -76, -17, -77, 69, -73, -39, 5, -3, 7, -12, 22, 34, -93, 59, -57, -64, -51, -45,
+		19, 14, 74, -15, -13, 86, -62, 49, -27, -80, -93, 66, 54, -69, 87, -41, -7, -50, 1, 53, 70, -8, 63, 72, 9, 11, -17, -19, -55, 15, 21, -95,
+		-18, -57, 2, 80, 18, 36, -71, -75, -79, 63, -96, 98, 4, -47, -20, -17, 96, -59, 36, -89, -41, -82, -40, 97, 88, 89, 38, 19, -76, 52, -15, -85,
+		56, 35, 1, 96, 46, -70, -31, 25, -1, 3, -1, -58, -38, -38, 67, -27, 10, -69, -95, -92, 39, -39, -73, 66, 73, 40, -21, 21, 84, 13, 7, -21,
+		7, 51, -97, 6, 65, -14, -61, -61, -67, 28, 64, -54, 74, -89, -53, 88, -3, 13, -79, -27, 50, -29, 65, 89, -73, 20, -17, -97, -67, 32, 69, 80,
+		-19, 95, 53, -78, 1, -5, 83, 69, 6, 61, 3, 73, 67, -22, -77, -33, 58, 23, 49, -3, -8, 7, -56, 42, -25, 64, 82, 41, 70, 22, 21, 50,
+		62, 62, -69, 46, -96, -27, 84, -35, -91, 62, 54, 34, 74, 97, -77, 27, 44, -33, -25, -71, -37, 79, -23, -55, -59, 51, 64, -49, 96, 10, -38, 32,
+		-93, 38, 69, -82, -94, -74, 86, 60, 58, 14, 47, -7, -68, -47, -45, -31, -34, -35, 2, 64, -42, -47, -38, 62, -31, -43, -91, -93, -71, -15, -68, -57,
+		49, 43, 18, -91, 64, -97, -100, -17, 0, 29, 78, 55, 57, 43, 98, 78, -32, -53, 67, -3, -14, -42, -63, -47, 13, 74, 3, -49, -83, -23, 63, -8,
+		-96, -100, -9, 71, -27, -18, -45, 12, 6, 8, 9, 35, -98, -12, 62, 40, -41, 47, 24, -14, 25, -100, 98, 94, -6, 86, -39, -76, 52, -24, -10, -68,
+		-100, 43, 39, 96, 13, -23, 20, 49, -51, 17, -33, -19, 63, -55, 86, 85, -47, -57, -78, 27, 98, -69, -53, -39, 99, 70, 15, 8, -64, 14, -51, 36,
+		55, -32, -68, 95, 89, -97, -17, 40, 32, 3, -85, 48, -47, 1, 74, 41, -23, -26, -4, 1, 4, -52, -61, -18, -35, 99, 16, -83, 90, -29, -73, -3,
+		76, 50, -9, -85, 57, 91, 20, 8, -85, 38, -12, -62, 32, -56, 71, 66, -55, -53, 37, 48, -12, -50, 13, 84, -89, 64, 5, 61, -4, -90, 83, -32,
+		92, 88, -30, -75, -58, -27, 98, 73, 0, -20, -82, 47, 44, -16, 54, -39, -9, -81, 45, -60, -35, 20, -15, -78, -86, -46, 41, 16, 18, -65, 6, 61,
+		42, 90, 25, 50, -57, 43, -97, -29, 24, 42, 75, -41, -17, 35, 39, 38, 93, -46, -93, 7, 17, -68, -84, 34, -49, 16, 17, 48, 7, -25, -14, 24,
+		31, -54, 48, -38, 49, 14, 85, -24, -72, -83, -79, -86, 81, -88, 30, 65, -87, -51, -68, 61, -26, -52, 42, -51, 75, 78, -18, 27, 85, 26, 13, 45,
+		-68, -47, 0, -54, 8, 8, -13, -87, 69, 68, 41, 17, -98, -98, -9, 99, 76, 52, -47, -14, 59, 68, -40, 91, -33, -10, -27, 37, -16, 58, 37, 99,
+		-55, -27, -18, -80, -96, 80, -89, -14, 85, 37, -11, -35, 46, -93, 69, 21, -73, -30, 69, -67, -14, 54, 61, -8, 74, -71, -65, 98, -5, 79, 51, -65,
+		88, 91, 12, -60, 67, -7, 11, -54, -94, 61, -66, -95, 74, 14, -88, -5, 35, -4, 87, -25, 95, 68, 18, -5, 2, -89, 42, -84, -20, -89, -18, 91,
+		-71, 97, 83, -36, -10, -59, 77, 93, -14, -35, 47, -24, 98, -100, 47, -93, -46, 46, 77, 16, 4, -71, 93, 20, -2, 98, 94, -7, 62, -96, -85, -3,
+		76, -30, -28, -34, -94, 42, 10, -48, -91, 63, 94, 43, -80, 43, -52, 49, 76, 14, 87, 59, 20, -7, 77, -38, -72, 54, 44, -29, -34, 96, -56, 69,
+		7, 98, -45, 14, 78, 62, 40, 87, 51, -47, -51, -1, -69, 2, 95, -40, 73, -9, -69, -1, -3, 18, -92, -2, -15, -29, 63, -61, 42, -57, -58, 38,
+		80, -8, 27, -26, -87, 68, 6, 67, 79, 76, 8, 24, -80, 50, 94, -96, 77, 54, 22, -53, 75, -66, -40, -26, 15, 17, 76, -36, 81, -94, -37, 66,
+		-18, 70, -85, 56, 60, -21, 86, 26, -22, -15, -6, -31, 65, -3, -50, 25, -60, 85, 62, 41, 86, 6, 77, 48, -83, -29, 83, -100, 17, 8, -28, -66,
+		-77, 89, -55, 2, 65, -76, 36, -6, -90, -1, 55, 72, 55, 18, 84, 48, -53, 17, 77, 66, -43, 67, 21, -23, -68, -31, 8, -57, -83, -97, -38, 19,
+		-9, -99, -78, -66, 30, 99, -28, -34, 59, 0, 87, 23, 6, 32, -98, -11, -31, 80, 93, 96, 14, -51, -16, -16, 8, 12, 31, 74, 54, 90, 27, -49,
+		49, 84, 49, -85, -20, -36, -78, 80, 79, 67, -35, 75, -21, -36, -9, 10, 92, 72, -87, -69, -15, -70, -23, -10, -18, 44, -10, 34, 58, 56, -59, 54,
+		54, 87, 70, 62, -3, -27, 6, -39, -13, 56, 11, 2, -80, 19, 46, 40, 16, -88, 84, -48, -35, -61, 12, -20, 20, -72, 28, -99, 42, -23, 27, 80,
+		-38, -56, -25, 81, -43, -42, 3, -17, 82, 4, 4, -90, 98, -51, -4, 14, 34, 60, -45, -79, -3, 44, 6, -33, -100, -40, 4, -18, 48, -45, 28, -37,
+		9, -68, 40, -92, -64, -67, -29, 85, 73, 81, 40, -64, 64, 91, -48, -2, 6, 35, -41, -63, 11, 49, 47, -51, -40, 79, 18, 61, 51, -9, -48, -59,
+		77, -78, 83, -98, -63, -30, 74, -47, -53, 0, 63, 74, 20, 33, -26, 95, 7, 84, -93, 69, -92, -69, 88, -91, 57, 92, -39, 83, 37, -4, 68, -36,
+		-99, 31, 86, 57, -4, -100, -10, -73, -80, 25, 10, 5, -32, 61, 42, -99, -96, -69, 2, -57, -21, -63, 15, 40, -78, -39, 52, 1, 98, -31, 91, -17,
+		24, 59, -90, 9, -7, 95, -75, 16, 41, 3, -93, 76, 31, 98, 83, -21, 85, 89, -47, 84, 15, -74, 3, 87, 92, -84, -91, -100, -85, 65, 92, -8,
+		43, -61, 73, -47, 0, 32, -71, -57, 77, 14, -49, -86, -98, -27, 27, 91, -15, 18, -17, 0, -74, 57, -56, 99, -97, -14, -36, -32, 21, 36, -83, -69,
+		-13, 14, -50, -53, 47, 9, -81, 75, 83, 6, -100, 84, -93, -30, 73, -12, -9, 79, -87, -5, 70, -96, 14, -15, -3, 81, 30, 85, 0, -64, 56, -7,
+		22, 96, 54, -95, -46, -20, -52, 16, 26, -20, -85, 90, 30, -11, -24, 7, 82, 14, -29, -93, 20, -21, -86, 85, -65, 37, 87, -91, -26, -81, -97, -21,
+		-69, -86, -5, -1, 32, 58, 60, 98, 76, -41, -35, 15, -48, 20, 23, -18, -99, -23, 72, 93, 27, -17, -13, 94, -20, -27, -87, 88, 41, 70, -35, -34,
+		-92, 10, -46, 90, 62, 61, 68, 84, -59, 45, -68, -6, -66, -35, 34, -1, 58, 39, 29, 35, 63, -25, -79, -18, 76, 55, 33, -79, 40, -53, -47, -3,
+		0, 43, 81, 67, 34, 83, -89, 66, 48, 9, 92, 14, 60, 33, 83, 58, 97, 28, 27, -16, -54, 69, 36, -81, 72, -60, 37, -45, 69, -33, -30, -86,
+		-76, -12, 60, -88, 75, -74, 14, -29, -88, -79, 46, 5, -54, 77, 18, 38, 94, -28, -16, 29, 34, -53, -28, -29, -82, -70, 46, 87, 65, 10, -60, 95,
+		3, 0, 8, 4, 34, 0, 76, 44, -45, 49, 17, -41, 2, 73, -42, 77, 56, 38, -82, -6, 63, -5, -64, 72, -38, 72, 10, -88, 29, -78, 91, -21,
+		-81, -74, 56, 98, -17, 27, -86, -67, 23, 99, 57, 1, -7, -14, -75, 40, 21, 81, -58, 38, 41, -2, -80, 21, 85, 49, -11, -72, 76, 45, -62, -2,
+		-45, -60, 73, 86, 97, 89, 94, 92, 47, 14, 3, 37, 89, -67, 45, -54, 76, 74, -92, -34, -46, -47, -87, 32, -61, 41, -74, 47, -29, 98, -12, -27,
+		81, 70, -52, -97, 11, -21, 23, 59, -98, -31, 45, 56, -53, -23, -73, -88, 3, -48, -67, 49, 91, -25, -24, 35, 29, -87, -37, 9, 65, 42, -82, -58,
+		-100, 73, -68, -55, 24, -29, -28, 76, -9, -6, 39, 75, 10, -73, 74, -62, 55, -30, 81, 31, -50, 22, -16, 47, 48, -69, -24, 12, 27, 9, -7, -2,
+		-94, 24, 69, -40, 49, -46, 39, -74, -24, 47, 16, 1, -43, 23, -32, 52, 37, -68, -2, -6, 13, -28, -27, 61, 64, 55, -58, 69, -43, -9, 2, 20,
+		15, 50, -33, 60, -16, -85, -46, 54, -11, -87, -32, 93, 73, -36, -75, -66, -67, -85, 32, 2, -65, 38, -76, 6, -86, -24, 95, -34, -62, -30, -81, -66,
+		-57, 88, 40, -14, -95, -100, -78, 80, -98, -72, 16, -74, 79, 49, 2, 41, -90, -88, 21, 62, 70, 41, -87, 13, -100, 14, -88, 7, 69, 75, 16, 78,
+		23, -33, -63, 66, -56, 66, -89, -18, 43, 91, -78, -39, 8, 4, -18, 41, -29, -51, -93, -92, -63, -32, 63, -73, -24, 60, 85, 20, -22, 70, -7, 96,
+		-77, -92, -96, 40, 67, -78, -32, 3, -46, 56, 57, -92, -47, -12, 32, -11, -5, -66, -36, 60, -58, -92, -89, 23, -28, 92, -57, 23, 20, 8, -60, 89,
+		-42, 98, -28, -89, 5, 0, -77, -68, 19, -92, -38, -23, 51, -89, 72, 48, 31, 4, 69, 57, -9, -69, -20, 41, -45, -61, -40, -44, -83, -23, -78, 84,
+		27, 80, 74, -8, -8, 81, -34, 7, 96, -38, -50, 25, 38, -52, -49, -54, -46, -52, 45, 95, 20, 30, -19, -97, -73, -34, 51, -63, -97, -43, 6, 56,
+		-47, 36, 39, -72, -73, -8, 33, 52, 2, 71, -93, 60, 95, -38, 60, -76, 38, -28, 69, 47, 16, -67, -53, -9, 49, -40, 75, 36, 46, -72, 35, 98,
+		60, -61, 19, 1, 15, -100, -52, -77, -29, 21, 56, -7, 9, 28, -90, 64, 61, -100, -59, 13, 30, 43, 35, 3, -56, -75, -2, 42, -73, 78, -50, 35,
+		-16, 93, -99, 42, -16, 47, 18, 63, 68, 80, 12, -29, -73, -42, 69, -52, 11, -61, 16, 46, -45, -9, -69, 83, 11, 91, 81, -5, 64, -4, -60, -97,
+		-67, -91, -51, -50, -46, -42, -58, 11, 93, -48, -70, 27, 34, 94, -25, -87, -34, 7, 52, 90, 15, -42, 46, 90, -22, -9, -79, 26, -59, 56, 1, -52,
+		-17, 34, -38, 75, 8, 62, 23, -92, 56, -93, -10, 67, -85, 74, 57, -31, 4, -77, 39, -6, -91, 27, 64, -64, 76, 45, -73, -63, -56, 32, 56, -94,
+		-20, -30, 79, 21, 54, 32, 38, 34, -53, 99, -46, -36, 84, 53, -65, 1, 60, 99, 70, 97, -45, 56, -61, 17, -57, -73, 33, -7, -35, -98, -42, 31,
+		26, 86, 6, -24, 8, 74, -78, 70, -3, 78, 56, 64, 97, 93, -58, -38, 84, -17, -97, 2, -54, -18, -9, 15, 76, 38, 73, -19, 5, 22, -12, 78,
+		-44, -31, 12, 30, -34, -11, 72, 55, -88, -79, 14, -1, -40, 70, 92, 0, 28, 41, 36, -77, -62, -27, -61, 91, 47, -71, 68, -15, 11, 85, -76, -23,
+		-21, -39, 74, 38, 25, -86, -85, -51, 80, 68, 39, 51, -40, -78, 93, 43, -29, 63, 59, -93, -89, 60, -66, -51, -86, 95, 76, -72, 45, -92, -58, 87,
+		-64, 36, -66, 78, 35, 61, 34, 66, 73, 29, 99, 82, 63, -47, -60, 80, 54, 3, -33, 9, 54, 77, 73, -78, -21, -37, -59, 58, -34, 84, 26, 48,
+		-68, 48, -42, -74, -94, 5, 86, 86, 69, -73, -50, -32, 65, 67, 28, -54, 98, 65, -20, 0, 79, -20, -96, -68, -94, -76, 12, -70, 68, 64, 21, 13,
+		-21, 32, -55, 69, 92, 24, 23, 4, -49, 55, -8, 50, 47, -84, 13, -99, -62, -92, 77, 62, 37, -65, -99, 87, -23, 58, 44, -61, -20, -94, -24, -84,
+		-65, 61, 84, -35, -95, -9, -13, -74, -47, -49, -14, -54, -66, 58, 90, -100, 63, -16, -26, 44, 54, -55, 67, -99, 95, -38, 91, 95, -59, -52, 99, -79,
+		1, -1, 33, -8, -81, -91, 64, -31, 95, 78, -94, 75, 53, 73, -13, -28, -77, -52, -32, -68, -29, 71, 83, 66, -26, 8, -66, 79, 80, 38, -75, -32,
+		98, 78, -65, 11, -15, 84, -33, 74, -52, 75, 65, 35, -60, -98, 98, 82, 44, -42, -16, 76, 58, 97, -97, -28, -56, 64, 77, 54, 46, 81, 47, 84,
+		-63, 52, -42, 21, 48, -46, 70, -41, 53, -78, -87, 13, -94, 37, -50, -7, -94, -23, -32, 7, -74, 34, 10, -22, -46, -38, -98, -40, -28, 5, 98, 74,
+		-23, -84, 98, -77, -54, -55, 19, 95, 61, 54, -97, -45, 90, -70, -43, 99, 49, -91, -62, 5, 39, -75, -45, 25, -4, -36, 21, 24, -69, 33, -82, 33,
+		66, -7, -44, -40, 88, 74, 8, -82, -43, 11, 58, -84, -81, 47, -39, -3, 32, 66, -1, 45, -75, 8, 18, 88, 42, 51, 22, 16, 63, 16, -74, 16,
+		-35, 42, 5, -67, -92, 58, -78, 76, -19, -34, -79, 44, 95, -70, -57, -27, -6, 35, -31, 16, -15, -79, 11, 97, 4, 82, 29, 9, 91, -27, -82, -52,
+		-1, 6, 1, -13, 34, 16, -21, 8, 38, -18, 4, 28, 7, -100, 14, 69, -46, -49, -63, -79, 34, -5, 0, -51, -29, -73, -68, -65, -3, 76, 76, -47,
+		-60, -57, -22, -27, 50, -73, 71, -61, -39, -7, -87, 84, 16, 33, 41, -77, 93, 32, -50, -56, -5, -31, 61, 14, 16, -8, 55, -96, 66, 72, -86, -63,
+		54, -59, 60, 39, 5, -83, 54, -60, -65, 69, 2, 94, -60, 72, -48, 20, -92, 3, 97, -100, 41, 87, -36, 6, -3, 74, 77, -50, -26, 10, -92, -17,
+		-51, -74, 48, -96, -19, -87, 72, 49, 26, 36, 20, -68, 26, 45, 30, 96, -27, 86, 90, -41, 78, -59, 46, -36, 33, -4, -18, 47, -11, 64, -64, -77,
+		-61, -56, -33, -70, 70, -55, 44, -92, 80, -36, -80, 71, -77, 81, -25, -99, -80, -75, -81, 19, -61, 76, -60, -94, 1, 17, -56, -40, -13, -53, 91, -58,
+		-83, -56, -9, -86, -16, -76, 3, 7, -83, -94, -94, -29, 47, -83, -15, -45, 40, 78, 45, 58, -60, -19, 77, -70, 73, 10, -56, 44, -7, 87, -45, -77,
+		-31, 4, 22, -13, -39, 10, -31, 89, 57, -53, 67, 48, -11, 69, 61, -59, -31, -99, 90, -31, -76, -34, 80, 63, -27, -44, -93, -97, -77, 10, 35, -28,
+		-67, 1, -5, 45, 43, 82, 78, -94, -33, 63, -98, -27, -91, 78, 94, -41, -24, -30, -37, -75, -60, 28, -44, -29, 96, -24, -41, 37, 10, -17, 84, -71,
+		59, -94, 24, 68, -10, -98, 32, -37, 52, -14, -6, 87, -67, -55, 2, -91, -81, 75, 27, 96, -30, 92, 38, 14, 38, 61, 14, -9, 65, -70, -55, -98,
+		-26, 9, -34, -20, -61, 4, -40, 33, -28, -28, -68, 65, -79, 78, 98, -69, 88, -11, -61, -4, 55, -4, 23, 66, 67, -56, 39, -20, 58, 47, -20, -84,
+		-65, -4, 64, 6, 71, 67, -35, -78, -89, 10, -70, -13, 8, -55, 69, -38, -69, 8, -60, 10, -28, -21, 38, -91, 66, -88, 48, 54, -14, 27, 29, -80,
+		-17, -90, 99, 60, -99, 62, 97, -92, -63, -52, 97, -48, -68, 87, -67, 88, 68, 32, 17, 51, 75, 59, 58, -95, -23, 83, 73, -10, 35, -6, -34, 90,
+		-2, -46, -53, 67, 4, 18, 19, 37, -33, -11, -84, -11, -36, 85, 60, 22, 67, 73, -98, -43, -25, 22, 11, -50, 62, -60, -73, 38, 61, 87, 26, 1,
+		-76, -99, 36, 78, -37, 76, -71, 38, 8, 22, 17, -21, 64, -66, -14, -95, 92, 49, 58, 61, -81, -63, 82, -87, -54, 58, -100, -96, 70, -90, -64, 45,
+		-28, -36, -84, 98, 61, -1, 58, -50, 37, 43, -17, 28, 6, -37, -8, -39, 39, 3, 84, -97, -66, -85, -26, -40, -64, -7, -98, 43, -33, 29, -12, -66,
+		93, 80, -55, -57, -96, -40, 27, 68, -28, 74, 19, -2, -78, 11, 87, -18, -10, 87, -45, -36, -95, -39, 84, 59, 87, 33, -2, -38, 67, -39, -50, -78,
+		76, 75, -68, -56, 59, -77, -90, -1, 64, -42, -78, -22, 21, 15, 35, -38, 70, 50, 67, 35, -37, 84, 84, -34, -25, 1, -70, -84, -33, 77, -28, -98,
+		-18, 66, -34, -33, 85, 81, 57, 6, -39, 95, 17, 62, -16, -8, 82, -31, 16, 65, 39, -85, -10, -76, 91, 74, 98, -77, -23, -3, -1, 78, -37, -91,
+		-68, -25, -12, -41, -60, -9, 80, 51, -95, -46, 75, -63, -33, -64, 59, 15, -15, 23, -93, -87, -32, -13, 53, 12, -67, 84, 75, -88, -41, -47, -58, -9,
+		-6, 48, 22, -49, -12, -32, 99, -91, -23, 37, 6, 70, -37, -48, 15, 14, 26, -49, 4, 42, -7, -32, 57, -6, -20, 21, -64, -44, -15, -84, -74, -53,
+		-6, -29, 36, -35, 61, 30, -68, -62, -3, -19, -7, 79, -12, -24, 71, -93, -21, -37, 65, -98, -37, 42, -96, -45, 42, 47, -38, 27, -68, 5, 60, -5,
+		-84, 17, 60, 8, -90, 3, -85, 57, -15, 46, -37, 48, -22, 31, 60, -5, -34, -98, 67, 71, 82, -70, -92, 74, 42, -57, 41, 3, 40, 16, 73, -50,
+		18, -51, 85, 70, 66, 17, -15, 23, 63, -22, -83, 36, -4, -72, 99, -74, 94, -2, -2, -51, -75, 40, -1, -20, 89, 85, 42, -3, -82, -48, 10, -23,
+		40, 7, -1, 92, 63, 23, -49, -81, -6, 38, -56, -52, 83, -51, 78, 25, -43, 52, 69, -17, -65, -9, 95, -4, -53, 70, 30, -1, 39, 59, 13, -86,
+		0, -19, -46, -23, -78, -39, -3, -64, 2, -46, -76, -58, 8, -81, -43, -25, 3, 98, -60, 16, 27, -73, -75, 23, 42, -39, 48, -42, 49, 28, 31, 54,
+		-8, 38, -32, -92, 16, -35, -85, 57, -27, -83, -24, 74, 94, -61, 8, -35, -2, -63, -61, 87, 84, -1, -72, -64, 14, 24, -71, 95, 79, -74, 77, 49,
+		-39, 63, -10, -43, -37, -85, 37, -72, 27, -41, -84, -45, -63, 37, 47, 32, 23, 47, 54, 63, -28, 56, -61, -85, -76, 20, 99, 65, -71, -14, 7, 79,
+		12, 42, 26, -100, -66, 0, 91, -81, -93, 37, -46, -10, -75, 79, -78, -76, 8, -47, 61, 49, 30, 87, -4, -97, 70, -60, -45, 70, 75, 95, 55, -98,
+		-78, -38, -82, 56, 67, 72, -78, -24, -7, -22, 0, 33, -64, -96, -100, 47, -82, 12, -11, 54, -83, 42, 28, 30, 74, 97, -17, -4, -71, 73, 63, -16,
+		-8, -36, 33, -53, -21, -47, 38, 8, -95, -74, 23, -30, 58, -42, -16, 54, -97, -87, 84, -7, 90, -21, 98, -28, 23, 29, -19, -87, -26, 76, 41, -8,
+		-37, 7, -54, 12, -99, 23, -37, 76, 10, 49, -45, 68, 32, 86, -89, 31, -17, -72, -11, 5, 88, -50, 48, -81, 90, 33, -20, -41, 23, 35, 2, 47,
+		-15, -91, 29, -60, 79, 52, 31, -46, -33, -43, 63, 35, 51, -24, -95, 21, -84, -3, -1, 2, -77, 47, 35, 74, -21, -91, -19, 53, -95, 23, -98, 63,
+		-31, -1, 54, -78, -73, 0, -49, 42, -79, 5, 21, -95, -4, 3, -71, -64, -100, 19, 9, 73, 95, 72, 16, -15, 62, -52, 92, -52, -89, 69, -35, -49,
+		-35, 75, -74, 53, -27, 73, -67, -22, 61, -53, 48, -11, 59, -100, -39, -25, -61, 8, 89, 73, -80, -45, -41, -45, 73, -73, -3, -63, -44, -58, -71, 90,
+		-95, 33, -50, 70, 68, -19, -76, -47, -11, 68, 4, -29, 80, 85, 84, -48, -34, -93, -100, 12, 59, 10, -40, 59, 19, -17, 56, 32, 95, 94, -56, 65,
+		-90, -2, -49, -95, -97, -100, 0, -97, -61, -22, 95, 18, 56, -84, -36, -25, -17, 20, -76, 86, -83, 81, -90, 2, -54, 41, -3, -35, -92, 32, -12, -10,
+		-66, -36, -44, 65, -62, -2, 4, 26, 55, -96, 26, 14, 77, 7, 41, -48, -25, -81, 68, 53, 10, -69, -95, 90, 55, 90, -22, -71, -51, 1, 13, 39,
+		-53, -18, 23, 42, 55, -47, 73, -26, -11, -88, -3, 45, -92, -24, -42, 50, 63, -91, 64, -43, 38, 74, 73, -94, 84, 5, -46, -1, -99, -43, 31, -45,
+		93, 84, 56, 43, -17, 35, -26, -10, 48, 9, -73, -75, 19, -49, -98, -59, -96, -68, 0, 38, -29, -72, 19, -20, -2, -62, 55, 26, -79, 32, 54, -70,
+		-87, 90, -8, 54, 94, -27, 76, -68, 60, 1, -6, -39, 35, -86, 31, 91, 89, -33, -25, -23, 85, -100, -29, 77, -62, 65, -37, -36, -52, 72, -32, 31,
+		1, -75, -100, -39, -90, 46, 13, -84, -46, 76, -44, -84, 16, 51, -79, -10, -26, 14, -21, 4, -46, -93, -92, 32, 9, 80, 51, -51, -60, 29, -16, 24,
+		0, 51, -92, 33, 2, 91, 41, -17, 1, 20, 21, -91, -9, 40, -50, -85, 73, 53, 24, 34, 51, 55, -32, -18, 25, 71, 38, 31, -20, 66, -5, 10,
+		70, 79, -88, -49, -14, -80, -83, -55, 8, 47, 49, -88, 49, 67, 18, -85, -97, -85, 55, 23, -21, 68, 13, -66, 49, 59, -76, -79, -28, 61, 15, -69,
+		27, -88, -89, 13, -26, -22, 4, 88, 48, 40, -33, 22, -8, 14, -94, 74, 31, 9, 10, 37, -55, -4, -90, 2, -54, 52, 17, 67, -78, 35, -76, -58,
+		47, -71, -42, -55, -37, 72, -85, -82, -98, 93, -54, 58, 65, -85, -11, 80, 59, -76, -47, -18, 18, 29, 18, 19, 24, 92, -24, 36, -68, -24, 56, -69,
+		99, -72, -35, -11, -68, 62, 21, -12, -66, 60, -47, -18, 52, -86, 40, -13, -46, -48, 84, 2, -27, 96, -15, 42, 54, -9, -39, 45, 13, 58, 28, -27,
+		66, 25, -45, 10, -86, -26, 61, 9, -54, -81, 69, -50, -44, -73, 2, 10, -87, -49, 35, 20, 82, -47, 18, 75, -29, -79, 53, 96, -27, -50, 40, -65,
+		46, 93, -31, -49, -90, 2, -7, -2, 89, 35, 62, -72, 94, 70, 69, 66, 48, -55, 89, 41, -17, 14, -95, -77, -91, -10, 13, 73, -74, 2, -29, 45,
+		-16, -84, 9, -94, 25, -52, -46, -48, -89, -90, 99, -15, -1, -17, 62, 5, -62, 30, 98, -58, -1, -32, -17, 58, 20, 35, -85, 17, 85, -97, 40, -27,
+		39, 88, 39, 68, 81, 72, 35, -71, -50, -3, 72, 26, 42, 90, 53, 85, -52, 49, 83, -31, -97, 86, -65, 47, 53, 20, 88, -69, 70, -21, -32, 52,
+		15, -64, -64, -49, -44, -74, -30, -2, -16, 72, 12, 94, 71, 28, -91, -31, 26, 29, 1, 4, 8, 91, 8, 90, -7, 46, -75, -62, -19, 25, 28, 16,
+		47, 52, 70, -85, -78, -61, -33, -40, 7, -96, 86, -66, -94, 93, -6, 92, 98, 69, 21, 79, -20, -57, 0, -76, -19, 38, -71, 9, -26, 97, -23, -20,
+		-52, -84, 53, 70, -50, 16, 75, -58, -3, 12, -65, -29, 33, 13, -31, -57, 98, -43, 3, -34, 96, -47, -5, -49, 13, -84, -77, -61, -11, -48, 65, -95,
+		-63, -55, -43, 87, -100, 33, 34, 45, -11, -75, -5, 44, -41, 47, 66, -34, 17, 62, 65, -6, -14, -36, 50, -91, 15, -47, -18, -12, -47, 71, 37, 40,
+		78, 65, 39, 81, -50, 30, 35, -34, 54, -50, -37, -3, -51, -100, -80, -44, -33, -43, -84, -57, -51, 15, -23, 85, 49, -72, -40, -22, 51, -49, 85, 32,
+		-32, -30, -48, 37, -98, 74, -50, 18, 86, 20, 13, 31, -26, -56, 25, 46, -31, -84, 56, -27, -42, 73, -67, -84, 99, 49, 63, 39, 64, 30, 3, 29,
+		-72, 93, -96, -7, 90, 21, -80, 86, -4, -34, -21, 63, -39, 24, -80, 47, 36, 19, -4, 51, -43, 11, -13, 34, -20, 14, -85, 27, 91, 70, 61, 60,
+		-44, 75, 17, -86, -30, -61, -33, -88, -76, -57, -22, 61, 17, 77, -57, -18, -60, 91, -70, -75, 38, -56, -51, -39, 94, -56, -87, -76, 70, 83, -53, 73,
+		-30, -49, -42, -38, -53, 80, 39, -73, -24, -54, -13, -15, -21, -60, -74, -78, -27, -72, -37, 69, 64, -60, 69, -62, 62, 96, 62, -83, 33, -48, -51, 79,
+		0, -8, -84, -17, 35, -51, -55, -32, -7, 12, -19, 59, -62, 9, -82, 73, -2, -96, -12, -46, 42, -68, 9, 67, 11, 35, -88, -98, -12, 77, -58, -3,
+		-12, -67, -83, -55, -88, -56, 39, 73, 0, -71, 9, -2, 14, -45, 61, -51, -93, 17, 94, 90, -48, 65, -30, -33, -37, 16, -78, 80, 84, -33, -54, 37,
+		-20, 87, -57, 66, -60, -56, -71, 32, -34, 47, -23, 9, -25, -96, 81, 57, 59, -83, 17, -16, -97, 73, -9, -86, 90, -54, -91, 57, -35, 38, -87, -72,
+		-45, 10, -19, -17, 70, 96, -32, 30, -60, 49, 26, 74, -75, 98, -61, 21, -20, -69, 95, -68, -6, -78, -48, 58, -55, 8, -92, 49, -93, 47, -62, 56,
+		-71, 80, -13, 63, 99, -27, -53, 70, 27, -60, -99, -32, -4, 48, -71, 90, -4, -49, 65, 51, 48, -11, -86, -62, 74, 58, 43, -25, 23, 69, -49, 74,
+		77, 69, 96, -91, -12, -1, 9, -55, 98, -76, 17, 78, -36, -93, -82, -60, 40, 94, 32, 16, 27, 94, -52, -28, -94, -12, -56, 17, -59, 30, -15, -69,
+		-44, 63, -8, 81, -20, 59, -92, 67, 43, 20, 18, 49, 18, -94, 58, 92, 0, 80, -1, 31, -10, 33, 73, 19, 58, -67, 5, 23, 87, 44, 2, 64,
+		-89, -79, -23, -42, -99, 82, 98, 76, 71, 52, 89, -27, -85, -21, -37, -20, -53, 29, 6, 50, -58, -6, -87, -41, 42, 97, 95, -18, -43, -77, -18, -21,
+		-98, 74, -23, 17, 40, -26, -96, -47, 55, 91, -80, 62, -42, 67, 88, 28, 6, -82, -91, 87, -1, 43, 56, -73, -96, 55, 88, 8, -99, 64, -69, 48,
+		-87, -94, 92, -64, 49, -15, -5, 10, 12, 21, 46, -73, -27, -6, -71, 7, 67, -42, 92, 43, -67, -42, 57, -34, -23, -65, -22, -21, 46, 17, -63, 18,
+		-38, 0, 3, -63, -25, -96, 44, 51, 67, -13, -29, -87, 5, -33, 67, -10, -51, -16, -83, 24, 82, 0, -86, -44, -94, 74, -28, -63, 24, 54, 79, 0,
+		17, -75, -72, 33, -27, -66, -9, -96, 88, 28, -4, 43, -27, 52, 84, -14, 43, -30, 28, -25, -66, -68, -87, 20, -32, -62, -48, 37, 44, 28, 68, -44,
+		-76, -69, -38, -12, 1, 62, -60, 8, -78, 71, 48, 97, -94, -7, 78, -97, -34, -41, 81, 18, 93, 21, -19, -88, 42, 3, 46, -80, -59, 43, -69, -22,
+		73, 65, 44, 29, 40, -62, -74, 89, 93, 38, -43, -10, -37, -88, -47, 12, -66, 92, -6, -61, -5, 96, -47, 58, 87, -95, -24, -13, 36, 44, -43, 95,
+		-25, 68, 20, -55, -95, 35, -57, -72, -74, 4, -67, 54, 69, 54, -71, 18, 20, 91, -50, -53, 29, -85, 54, -24, -88, 51, 28, -40, 88, 9, -13, -11,
+		3, -80, -80, -23, -11, -11, -11, 63, -54, -25, -82, 10, -55, 41, 42, 21, 9, 97, -74, -8, -53, 60, -98, 42, -7, 16, 17, -41, 31, 40, 76, -11,
+		31, 57, 83, -6, -61, -67, 2, 2, 22, 54, 48, -91, -42, -75, 82, 81, 53, -92, -63, -69, -18, -67, -93, -86, -29, 89, 73, 85, -71, -66, 97, 84,
+		88, 86, -82, -69, -39, -63, 21, -58, -77, -16, 3, 32, 98, 62, 76, -49, 84, 50, 31, -11, -25, 52, -100, 22, -9, -27, -55, -5, -12, -39, 93, -25,
+		69, 54, 77, -15, 26, -5, 28, -65, -100, -43, -54, -51, -14, 94, 97, -21, 1, -89, 24, 48, 32, -9, 85, -50, 84, -66, -65, -30, -7, -72, 67, 65,
+		-55, 21, 13, 42, -82, -27, 50, 66, -98, 47, 62, 63, -1, -63, -65, 27, 91, -32, -47, -60, -54, 85, 76, 77, -55, 76, -64, 60, 5, 67, 72, -89,
+		22, 44, 24, -1, -10, 89, -39, -49, -35, -45, -11, 50, 80, 95, 80, -32, -76, 84, 83, 26, 49, 94, -19, -3, 59, 94, -51, -45, 36, -49, 27, 2,
+		-96, 26, 50, -22, -43, 37, -49, 70, -69, -58, -15, -10, -11, 82, 61, -28, 27, -11, -20, -84, -60, -44, 4, -6, 69, -6, -28, -80, -31, 54, -37, 53,
+		41, 51, 23, 65, 0, -20, 55, 16, -63, 34, 43, -11, -2, -34, 50, -99, 2, -28, 19, -70, 54, -3, -88, 18, -10, -95, 16, -47, -4, 19, 89, -83,
+		-1, -69, -36, -38, -16, -71, -6, 53, -100, -34, 93, 96, 10, 74, -11, -65, -23, 10, -10, -47, -36, -65, -53, -4, 39, 55, -72, 96, -13, -82, 87, 84,
+		-31, 68, -29, -39, 22, -73, -64, -30, 23, 67, -75, -43, 4, -17, 18, -60, 2, -62, 81, -52, -68, 63, -69, 97, -26, -77, -81, -71, -7, -51, -78, 77,
+		-37, 2, 32, -56, -24, -92, 26, -52, 24, -70, -41, -97, -70, -75, 89, 53, 11, -47, -45, -37, -64, -52, 27, 9, 99, 19, -35, -58, 94, -83, -82, -2,
+		-1, -13, 75, -36, 74, -35, -38, 9, -25, 36, 48, -91, -67, 77, 73, 63, -13, 65, 38, 44, 26, -89, -18, 91, -29, 0, -78, 31, 1, -59, -53, 26,
+		-56, -24, 74, 80, -66, 88, 27, -19, -6, 90, -7, -67, -6, 98, -55, -18, 57, -94, -42, -94, 84, 96, -55, -21, 86, -74, 99, 74, -75, 5, -45, -81,
+		-64, -41, -23, -21, 2, 19, -88, -46, 48, -63, 71, -45, -13, -65, 6, 22, 2, 90, 32, -49, -32, 89, 92, -62, -9, 48, 70, 69, -33, 21, -31, -35,
+		2, 6, 56, 6, -4, 19, 63, 74, -17, 72, 5, -57, -77, 37, -86, -44, 82, -34, 93, -71, 75, 98, 11, 17, 78, 24, 38, 41, 22, 29, -49, 65,
+		-100, -71, -10, 66, -85, -93, -68, 8, 6, -57, -56, 43, 26, 52, -7, 76, 62, 23, -90, -17, 53, 10, -77, -31, -25, 21, -57, 29, -51, -41, 64, -25,
+		41, 81, -39, -52, 90, 80, -42, -59, -40, 54, -16, -83, -39, -12, 50, 49, 94, -39, 80, -94, 40, 36, -90, -25, -89, -14, 76, -38, 25, 12, 29, -79,
+		-60, -12, -99, 79, -70, 20, 29, 64, -11, 65, -70, 58, -23, -95, 37, 54, -30, 43, 23, -56, -2, 7, 62, 54, 18, -70, 95, -5, -13, 78, 98, 54,
+		35, 74, -59, -8, 99, -87, -94, -28, 48, 66, -83, 65, 2, -1, 17, 71, 82, -89, 35, -31, -39, -72, 72, -6, 48, -59, 86, 54, 1, 5, -58, -61,
+		56, -59, 40, -3, -17, 66, -20, 96, 65, -52, 88, 73, -68, 47, -38, 75, 73, -56, 22, -83, 0, -79, 82, -11, 88, 64, 18, -20, 24, 5, 48, 91,
+		50, -48, -93, 83, -13, 92, -98, -63, 79, 40, -37, -1, 57, -1, 3, -76, -67, -44, 24, 82, -6, -32, -1, -78, 74, 75, 86, -20, 49, -94, -64, 11,
+		-17, 31, 70, -71, -69, 69, 31, 57, 55, 83, 84, 28, 11, 1, -56, 96, 38, -100, -77, -73, 92, 52, 12, -42, 54, -27, -95, -41, 47, 75, 73, 11,
+		21, 76, -100, -31, 5, -19, -25, 59, -86, 56, 98, -93, 5, -51, -82, -7, -7, -67, -65, -15, 26, 45, 91, 78, -62, -86, 31, -74, -52, -37, -29, 92,
+		-30, 5, -37, -80, -83, 1, 71, 78, -94, 99, 24, 90, 72, -80, 99, -24, 81, 71, 41, -7, 5, 34, -49, -32, -24, 38, 45, -100, 81, -91, -11, -44,
+		80, 68, -87, 13, 39, -56, -55, 50, -1, -21, -10, -15, -25, 69, 90, -76, 21, -93, 47, -30, -26, 37, -64, -45, -64, -61, -45, -46, -42, -56, 86, 47,
+		-35, -23, 58, 6, 65, -62, -43, -27, -29, 22, 74, -33, -73, -77, -70, -19, 8, -96, -60, 62, 15, -70, 71, -98, 5, 42, 46, 86, -33, 25, 50, 56,
+		-37, 65, -38, -13, 56, -29, -2, -67, 99, 38, -6, 35, 51, -59, 68, 48, -14, -60, 14, -87, 73, 93, 68, 16, -12, -37, 83, -13, 22, 16, 12, 5,
+		-95, -79, -1, -53, -39, 1, -89, 27, -36, 48, -10, -87, -1, -45, 90, -38, 19, 94, -9, 90, 76, -16, 63, 28, -53, -30, -22, -17, -7, 6, 27, 15,
+		29, 36, -93, 58, -61, 54, -94, 38, 69, 35, -42, -72, 91, 72, 40, -41, -98, -88, -17, -98, -89, -93, -21, 71, 15, 51, 12, -49, -30, -42, 46, -57,
+		-39, -96, 18, -64, -95, 95, -51, 13, 28, -23, 71, -53, 51, -23, 99, 62, 32, -13, 4, -70, 48, -93, -38, 10, 31, 93, 34, 30, 15, 53, -70, 77,
+		-35, -75, -10, -80, -93, 47, 87, 57, 82, 85, -1, -94, 51, -75, 88, 37, 29, -76, -64, 55, 5, -44, -31, -32, 33, 60, -73, -4, 69, 76, -62, -1,
+		35, 7, -77, 66, -49, 64, 85, 79, 1, -56, 15, 85, -52, 43, 27, -86, 22, -76, -82, -70, -65, -62, -87, 21, 50, -51, -71, -57, 26, -90, 38, -23,
+		-42, -35, -6, -40, 39, -65, -12, 58, -25, -99, 93, 89, -43, -17, -7, 73, 92, 36, -39, 53, -35, -24, -82, -4, 73, -57, 90, 96, -82, -12, 79, -55,
+		89, -28, -3, -57, 81, -68, -82, -34, -43, 95, 86, 33, 71, -18, 24, 91, 30, -67, -7, 42, -35, -85, 13, 17, -83, 25, -69, -85, 61, 17, -91, 64,
+		-59, 67, -80, -33, 6, 86, -72, -92, -83, 82, 27, -53, -32, -85, 85, 98, 32, 59, -50, -76, -83, -43, -36, -15, -30, 95, -48, 38, 98, 39, 81, -32,
+		-14, -17, -91, -80, -7, -46, 39, -82, 5, -27, 40, -80, -77, 9, 57, -57, 4, -73, 22, -31, -20, 14, 62, 0, -51, 34, 86, 13, -21, -9, 75, 88,
+		47, -91, -46, -29, -80, -56, 89, -19, 2, 76, 47, -2, -31, 83, 74, 94, 53, 17, 11, -42, 55, 53, -58, 69, 82, 18, -25, -1, 50, -52, -27, 85,
+		58, -33, 22, 58, 54, -61, -81, -45, 96, -31, 28, -54, -47, -74, -45, -35, -13, 57, -82, 94, 63, 75, -78, 36, 0, 3, 56, -79, 83, -60, 51, 57,
+		-3, 39, 89, -22, 38, -56, -8, 25, 38, -54, 91, -44, -45, -3, -68, -65, -69, -99, 81, 46, 46, -60, 59, 16, 58, 78, -25, -13, -57, 96, -46, 20,
+		-15, -25, -38, -88, 98, -10, 74, -22, 17, -60, 68, -45, 16, -69, -98, -9, -38, 92, 1, -79, 99, -65, 46, 84, 84, 16, 79, -43, 56, -6, -18, -35,
+		-51, 27, 31, 36, 7, -8, 40, 79, -82, -80, 85, -66, -60, -10, -69, 40, -46, 46, -96, 85, -24, 80, 55, 61, 1, 45, -23, -65, 91, 43, -61, 83,
+		-69, 6, 69, 1, -68, 18, 14, -37, 83, -43, 79, 90, -46, -94, -8, 72, 68, -52, -90, 11, 37, 4, -39, 72, -20, 90, -85, -20, 56, 51, -65, 49,
+		-30, -98, -86, -89, -42, -50, 65, -33, -74, -76, -10, -73, -67, -88, 61, 36, -69, -10, -15, -70, 79, -69, -63, 29, 29, -67, -32, -46, -73, -67, -16, 79,
+		52, 11, -20, -39, 78, -2, -22, -24, -90, 73, -31, -100, 72, 68, 5, 46, 11, 95, -97, 92, 55, 93, 72, 84, -81, -84, -52, -21, -85, 32, -70, -75,
+		-100, 25, -77, 83, 39, 15, 33, -94, -85, -13, -44, 23, 56, 5, -50, -47, 50, 73, 67, 66, 63, 0, 7, -42, -55, 57, 10, -90, 58, 51, 87, -40,
+		1, 24, 5, 93, 81, -21, -26, 70, -36, 30, 92, -4, -18, 50, -46, 53, -88, -54, -37, -48, 53, 99, -64, -85, 98, -75, 99, -4, 95, 20, -74, -54,
+		-29, 90, 9, 8, -8, -43, -46, 39, -66, -41, 1, 12, -55, 95, 86, 88, -65, 95, -60, -72, -43, -34, -63, -30, -28, 90, 18, 0, -3, -68, 53, -36,
+		21, -43, -80, -76, 96, -74, 59, 96, 24, -41, 36, -20, -73, 15, 59, -91, -49, -70, -57, 32, 43, 49, 6, -39, -42, 66, 13, 65, 30, 41, 59, 0,
+		-27, 44, -72, 14, -2, 45, 36, 7, 86, 39, -90, -99, -96, 43, 54, -100, -96, -98, -93, -13, 45, 97, 75, 80, 45, -27, -10, -64, -43, -69, -59, 18,
+		51, -62, -62, 81, 11, -99, 10, 60, 14, 91, 36, 46, -90, 9, 54, 2, 84, -64, -55, 39, 63, 73, 70, -96, -34, 52, 9, -22, 96, 20, -35, -87,
+		70, -91, -38, 80, 66, 66, 89, -71, -96, 85, -87, -21, -30, 11, 68, 19, 53, -86, -84, -30, 95, 85, 5, 9, -61, 80, -81, 93, 37, -53, 3, -81,
+		-37, 10, 96, 61, -49, 88, -33, 11, 43, -37, 4, 35, 79, 50, -98, -66, 20, -69, -100, -90, -65, 25, 8, 30, -47, -89, 89, -33, 18, -61, -8, 13,
+		-36, -85, 84, 88, -30, 75, 38, -78, -25, -79, 22, 57, 48, 13, 71, -82, 27, -83, -73, -75, -73, 82, -99, 58, -32, 34, -92, 4, -47, 69, 97, 78,
+		-74, 35, -12, 97, -68, -74, 4, 33, -26, 5, 14, -54, -46, -4, 7, 73, 21, 49, -34, -30, -85, -69, 64, 24, 62, 92, -84, -92, -27, -94, 11, 51,
+		30, -74, 15, 19, -47, -28, 28, -6, -9, -79, 82, 62, 74, 64, 53, -3, -5, -70, -53, 1, 58, 30, 88, -47, -94, -49, -32, -5, 26, -92, 56, 82,
+		-51, -67, -63, 55, 32, -100, -72, -80, 65, 49, 29, -19, -79, 96, 2, 77, -94, -56, -79, -22, -38, -4, 99, -63, -46, -49, 73, -92, -78, 19, 49, 45,
+		20, -20, -67, -99, -17, -40, -90, 81, -20, -51, 59, -12, -68, -43, -78, -55, 9, 59, -52, 85, 89, 17, -50, 69, -15, -71, 80, -95, -16, -54, -8, 58,
+		-24, 78, 38, 92, 92, 3, 73, -92, -36, 89, -40, -93, -4, 36, -36, -12, -97, -24, 16, -14, -99, 85, 86, -56, -26, 17, -29, 39, 17, -43, 95, -17,
+		-82, -46, -24, 38, 57, 15, 31, -32, -59, -88, 57, -93, -62, 55, -83, 52, 22, 3, 89, -77, -24, 1, -43, 92, -80, 1, -90, 21, -82, 48, -7, 55,
+		-35, -92, 44, 13, 13, 31, -13, 23, -88, -42, 89, 36, 9, 22, -5, -8, -28, -92, 49, -23, -64, 9, -60, -97, 28, -12, -82, -72, 4, -69, 43, 0,
+		34, 72, -37, -61, 43, -62, 57, -55, -59, -70, 73, -23, 55, 67, -83, 32, 23, 67, -30, -2, -64, 77, 94, 48, 74, -44, 27, 81, -11, 59, 56, 90,
+		76, 45, 89, -87, -61, 25, 69, 70, 21, -60, -1, -80, 42, -52, -59, -99, 18, -45, -62, 68, 68, -90, -13, -84, 14, -16, 71, -93, 38, -1, 18, -58,
+		-100, -98, 22, 10, 87, -84, 10, -12, -74, 33, 85, -10, -88, -98, 52, 42, -83, 85, -85, -29, -54, -92, -68, 53, -25, -4, 53, -85, 69, -12, 10, 32,
+		43, 79, 43, -30, 31, -62, 71, 12, 98, 61, 51, -87, 30, 77, -26, 63, 97, 65, 19, 72, -100, 7, 3, 83, 59, 92, 56, -90, 49, -83, 28, -80,
+		-62, -88, -24, -27, 73, 53, 78, -68, -30, -87, -43, 70, 28, -57, 79, 49, -79, 83, -52, 89, 23, 91, -27, -66, -4, 91, -59, 50, -23, 34, -97, -5,
+		-22, 87, -76, 84, 78, 83, 64, -62, -53, 22, -71, -93, -16, 50, -35, -73, -66, -62, 5, -75, -89, 93, 49, -57, 56, 46, 77, 96, 74, -41, 43, 14,
+		-95, 25, -75, -38, 41, 51, 23, 44, 54, -16, -72, -28, 74, -50, 20, 20, 51, -39, 93, -57, 64, 25, -99, -24, 69, -23, 48, 82, -77, -12, -21, 35,
+		37, 38, -91, 74, 4, -20, -28, -86, -12, 81, -22, -12, -52, -91, 15, -32, -100, -50, 72, 53, 12, 38, 6, 77, -42, 3, -27, -74, 12, -7, -68, -82,
+		-27, -84, 42, -45, -37, -16, 32, -63, -37, 86, -22, -41, 81, -36, -7, 80, -82, -36, 82, -80, -8, -48, 77, -63, 83, 13, 36, 10, -5, 98, 37, 91,
+		54, -46, 57, -29, 28, 74, -42, -96, -11, -8, -2, -48, 49, 58, -78, 2, -20, -35, 56, -22, 95, -14, -47, 10, -88, -3, 24, -70, -8, 59, -36, 95,
+		65, -36, 27, 82, 75, -44, 55, 73, -59, 86, 47, -59, 29, 22, 34, -87, -91, -87, -46, 34, -6, -94, -69, 87, 12, -52, 12, -10, -56, 23, 75, -11,
+		15, -33, -9, 93, -71, 53, 14, -77, 22, -14, 29, -44, 77, 44, 32, 38, -17, 75, 89, -99, 73, 63, 47, 72, 71, -87, 38, -67, -88, 6, 55, 50,
+		-56, -40, -35, -58, 92, 37, -91, -13, 57, 75, -14, -33, -11, 95, 25, 61, 96, -67, -94, 47, 84, -52, 91, 21, -82, 93, -36, 19, 92, -11, 10, 2,
+		0, 93, -80, 18, -21, -76, -88, 67, 74, -61, 34, -22, -56, 37, -35, -94, 9, 63, -93, 50, -21, 54, -16, 21, 38, -6, -3, -13, 15, 96, -75, 15,
+		-39, 60, -62, -95, -61, 20, 73, -76, 46, 36, 2, -39, 87, -76, 43, 59, 44, -16, -50, -89, -96, 95, 63, 46, -32, -84, 39, 85, -84, 89, 65, -37,
+		-49, 72, -47, 23, 3, -55, -66, 64, -92, 47, -67, -16, 18, -88, -34, 2, -58, -71, -79, -18, 22, -26, -6, -24, -19, 79, -99, -21, -18, -80, 30, 19,
+		-53, 62, -16, 34, -63, -22, -58, -66, -77, 75, 67, 89, -27, 46, -100, -68, -78, -79, 40, 13, 78, 51, -81, 48, 82, 17, 16, 78, -19, 34, 15, -16,
+		33, -88, 18, 58, 88, 3, 97, 54, 16, 26, -73, 33, -42, 70, 94, 32, 39, -62, 46, -97, -8, 13, -20, 48, -48, 78, -84, 56, -99, -72, 98, 49,
+		-10, 21, 1, -12, -29, -62, -73, -70, 8, 86, -93, 99, 16, 44, 77, 82, 90, 17, -17, 83, -80, -43, 57, -42, 56, 10, 35, -83, 96, 35, 98, -22,
+		28, -50, 57, 59, -29, -46, 40, 51, -97, -58, -62, -56, -13, 38, 64, -93, -85, 95, -62, -86, -63, 48, 28, 3, 69, -37, -17, 73, -13, -59, 92, -51,
+		-41, 65, -72, -52, 36, -6, -3, 88, -1, -74, -27, -46, 83, -82, -42, 52, 78, -96, -54, -34, -75, 12, -82, 40, 8, -6, -35, -24, 45, -70, 21, -92,
+		68, -77, -26, 85, 71, -76, -51, 52, -43, 32, 38, 73, -76, 86, 43, 13, 2, -99, 76, -43, -62, 24, -32, -11, -34, 44, 83, -13, 34, -4, 81, 39,
+		-23, -40, -14, 35, -5, 98, -57, 90, -31, 94, -53, -78, 72, -29, -32, -92, 57, 99, 48, -3, 58, -82, -72, -15, 33, -36, 76, -28, -97, -83, -35, -99,
+		-19, 41, 63, -87, -35, 59, -37, 11, 12, -50, -61, -58, 6, 18, 63, -68, -82, 29, -66, 10, -57, -20, -48, -7, 11, -73, -7, -9, 68, -53, 2, 41,
+		23, 89, 80, -97, 90, 17, -86, -78, -82, -85, -84, 20, 16, 90, 99, 36, 35, 88, -57, 33, 82, 36, -91, 27, -100, 29, -88, 2, -92, 90, 27, 6,
+		96, -50, -48, 25, 33, 16, -58, -57, 7, 22, -30, 49, 49, 50, 22, -46, 85, 12, 55, 34, -30, -4, 9, 48, 56, -67, 23, -30, -32, 16, -40, -43,
+		32, 70, 41, -82, -56, 25, -26, -54, -26, 18, -50, 81, 89, 3, 73, 30, 90, -48, 28, 19, -68, -48, 21, 55, 53, 99, -33, -8, 19, 59, 41, -5,
+		26, 30, -14, 5, 3, -31, -33, 50, -20, 31, 67, -29, 54, -10, 22, 54, -34, 14, -87, -97, 69, -95, -97, 80, 48, 73, 34, 85, 40, 67, 3, 23,
+		33, -60, -51, -55, -83, -39, -11, 40, -41, 36, -82, -88, 76, -16, 55, -47, 78, 63, 51, 83, -46, -38, 54, -73, 41, -64, -36, 50, -84, 49, 28, -99,
+		80, -55, -72, -24, 17, -60, -22, -91, -74, 41, 59, 63, -96, 45, -93, -51, 64, -14, -21, -70, -44, -95, 48, 6, -40, -71, 62, -54, 72, 83, -47, -98,
+		42, -48, -10, 73, 38, -67, -73, 25, -46, -68, -3, -13, 12, -9, -32, 47, -84, -27, -77, 62, -17, 20, -27, 23, 93, -46, -40, -73, -23, 55, -84, 94,
+		98, -56, -27, 68, -76, -37, 13, 51, -17, 21, -15, 85, -42, 21, 99, -68, -73, -54, -95, 95, -100, 44, 42, 67, 97, -10, 95, -72, -24, 27, 74, -18,
+		-34, 30, -8, -57, -81, 16, 67, -91, -61, 88, -36, 11, -55, -66, -32, 39, 18, 8, -61, 10, 9, 4, 71, -34, -87, -9, 45, 60, -71, 8, -75, 28,
+		-3, 27, 96, -68, -18, 67, 45, 69, -64, 21, -71, 46, -86, 54, -44, 47, 97, 60, -34, 53, -47, 10, -6, -15, -27, -29, -99, 60, 97, -31, -97, -14,
+		-67, -32, 10, 26, 68, -48, 8, -96, -6, 38, 88, -68, 80, -11, -75, -63, -16, 90, 21, 56, 32, -78, -27, -84, -55, 1, -46, 95, -70, 69, -75, -24,
+		80, -89, -20, -1, -40, 56, -44, 13, 89, -47, -3, -55, 68, 6, -32, 10, 15, 1, 63, 53, -97, 36, 40, 39, -44, -66, -90, 37, -90, -96, -11, -11,
+		-15, -42, 13, -16, -2, -21, 61, -2, 29, 67, -10, -35, -56, 76, -88, -77, -8, -39, -81, -53, 15, -28, -84, 48, 70, -74, 44, 74, -51, -70, -37, -37,
+		74, 62, -53, -63, 77, 30, -55, 79, 77, 63, 88, 52, -54, -51, 96, 34, -2, 72, -35, -64, 19, -96, 75, -8, -87, 23, 2, -83, -21, -43, -100, -10,
+		-56, 61, -84, 93, 3, 0, 21, -28, 18, -49, 84, 89, 84, -91, 84, 57, 33, 15, 30, -48, 50, 21, 11, -92, -67, 86, -45, 47, 8, -33, -73, -55,
+		62, 88, 83, 68, 51, -43, 43, 15, -59, 75, 72, -86, 38, -84, 9, 66, 53, 61, -65, 89, 94, 67, -11, -28, 33, 65, -26, -62, -47, -48, -100, -29,
+		82, -88, -56, -72, -50, 67, 90, -28, 35, -51, -21, 39, -49, 9, 57, 54, 33, 85, 86, 99, 14, 3, 67, -57, 67, -84, 2, 73, 40, -28, -12, -57,
+		-73, 31, 74, 47, 29, -68, -100, -24, -43, 97, 44, -64, -31, -86, 56, -9, -85, 48, 96, 75, 4, 0, 19, 76, -63, -10, -28, -96, 74, 49, 55, -100,
+		89, -92, -46, 98, -46, 32, -62, -84, -7, 69, 4, 94, 94, -63, 62, -16, -65, 11, -68, 39, 21, 54, -42, -3, 10, 99, -87, -80, -39, -1, 5, -88,
+		-62, 54, -64, 55, 15, -8, -33, -1, 10, -75, -74, 93, 31, 87, -87, 78, 9, 62, 3, 5, 83, -20, 79, -40, 23, 73, -35, 16, 62, 59, 10, 91,
+		-53, 62, -17, 39, 69, 91, 61, -81, 60, -57, 94, -79, -87, 24, -67, -32, 46, -5, -9, -61, 44, -30, -26, 30, -92, -52, 67, 33, 0, 56, 68, 84,
+		-58, 30, 13, -69, 28, 4, -7, 59, -95, 64, -46, 87, 38, 11, -50, 35, -30, -46, 77, -59, 83, 42, -66, -82, 19, -22, 2, -79, 14, -94, -44, 7,
+		76, 29, 12, 62, 23, 10, 84, -66, -25, -91, -32, -31, -81, -96, 96, -9, -31, -86, -47, 92, 34, -76, -79, 88, -35, -47, -30, 44, 83, -47, -79, -64,
+		-99, 28, 30, -28, -83, 51, 3, -71, -28, 87, 99, 31, 77, -20, -27, 3, -24, 27, 34, -34, 99, -9, -8, -92, 81, -16, -66, -97, 77, -64, 29, -54,
+		-22, -44, 85, -74, -98, -18, 24, 24, 2, 44, 96, -49, 36, -56, -34, -8, -40, 80, 48, -51, 84, 68, 11, 85, -58, -6, 61, 68, 82, 39, 4, -80,
+		40, 37, 99, 1, 67, 50, 6, 32, 93, -78, -28, -20, 90, -4, -26, 55, 21, -68, -90, 63, -93, 12, -40, -27, -64, -67, 78, -20, -75, 5, -67, -29,
+		45, -74, 66, 35, 44, 50, 41, -47, 94, -50, 48, 70, 39, -70, -66, -23, 27, 75, -57, 38, 81, 57, 87, 94, 63, 30, 44, -74, -51, -82, -84, -85,
+		-78, 29, 80, -9, 39, 26, -5, 59, -75, -13, 76, -59, -64, 55, 23, 49, 39, 92, -92, -67, 72, 58, 31, 1, -66, 54, 85, 34, -37, -55, 68, -47,
+		35, 37, 28, -36, 84, 71, -3, 49, -76, -2, 34, 50, -21, -89, -31, -14, -87, -84, -92, -72, 96, -1, -74, 25, -32, 24, 46, -20, 87, -49, 47, 3,
+		-40, -85, -20, -38, -59, -78, 92, -25, 77, 65, -57, -46, 4, 24, 46, 52, -43, 10, 94, 0, 49, 27, -55, 83, -41, 2, -28, -26, -29, 83, -65, 96,
+		-87, 22, -67, 90, -78, -26, -5, -67, 86, -91, -50, 56, -68, 39, -55, 41, 82, -57, 89, -78, 26, 12, -91, 38, 31, -53, 48, -72, -42, -33, 13, -15,
+		7, -79, -41, -56, 69, 26, -13, 93, -9, -13, 8, -53, -63, 60, -86, 18, -87, 15, -69, 46, -3, 10, -56, 28, -82, -100, -69, 27, -29, 73, -57, 56,
+		-97, -72, 11, -89, 2, -47, 82, 26, 73, -50, 16, 66, -5, -20, -57, -35, -53, 5, 39, 88, -18, 39, 14, 14, -61, -99, 15, 79, -69, 23, -43, -63,
+		-66, 47, 7, -67, -4, -24, 46, -31, -12, 89, 35, -12, -78, -89, 76, -41, 63, 9, 33, -73, -11, -81, 0, -22, -24, -65, -79, -43, -47, -41, -38, 16,
+		-27, -14, -9, 39, 37, 72, 25, -37, -68, 92, -63, 97, 78, 95, 2, -7, -77, -41, -24, -83, 19, -14, 88, -48, -84, -84, -70, 99, 46, -79, -81, 72,
+		43, 55, 90, -69, -77, -10, 16, 41, -13, 7, 13, 66, -58, -52, -17, -5, 87, 93, 22, -71, 21, 57, -66, -11, 84, -7, 38, 75, -59, -13, -11, -53,
+		22, 42, -74, 10, 67, 53, 25, -25, 4, 26, -57, 70, -17, -89, -39, -95, 11, -46, -98, -81, -59, -16, -42, 72, 34, 61, -13, -93, -88, 10, -92, 8,
+		58, 47, 94, 43, -14, 46, -83, 91, 76, 25, -10, 43, -95, -28, -77, -87, -13, -20, 91, -30, -85, 13, 62, 81, -79, 15, 89, -22, 49, -71, -32, -15,
+		37, 60, -43, -76, -46, 90, -54, 40, -99, 54, -36, -37, -49, -84, 93, -34, -18, 54, 69, 25, 63, 48, 35, -96, -47, 55, -75, 16, -22, 11, -9, 29,
+		27, 94, 86, -45, 77, 66, -8, -20, -13, 76, 12, 4, -81, 77, 54, 16, -60, 29, -99, 97, -10, 75, -10, -72, -39, 12, 68, 51, 97, 39, 16, 6,
+		45, -24, -44, 99, 55, -42, 47, -12, -86, 65, -14, -3, 81, 45, 59, 4, -69, 6, -48, -27, -46, -57, 52, 67, -33, 34, 8, 63, 62, 83, 69, 39,
+		50, 88, -20, -71, -45, 68, -57, 28, -46, 55, -30, -85, 64, -45, 7, -13, 98, 0, -41, 24, -41, 62, 88, 36, 64, -75, -51, -59, -37, 52, 21, -36,
+		-81, -40, 8, -28, 88, 13, -58, 38, 32, -62, -7, -42, 68, 17, 5, 44, -88, 49, -91, -13, -53, -60, -4, 62, -59, -99, 17, -13, 26, 51, 16, 84,
+		81, -7, -65, 11, 68, -92, 22, 45, -53, 7, 18, 99, 44, 8, -100, -80, -27, -85, 87, -3, 45, 23, 72, -91, 85, 13, -23, 29, 41, 5, 85, -73,
+		-70, 75, -70, 78, -15, 83, 22, 75, -52, -63, -53, -51, -82, 7, 39, 39, -96, -90, -95, 82, -73, 11, 9, 19, -2, -30, 13, -49, -55, 19, 10, -97,
+		-66, -80, -24, -38, 42, 37, -77, 7, 6, 64, -16, -53, -44, -85, 45, 72, 64, -85, -20, 62, -100, 92, 53, -27, -73, 92, 1, -56, 74, 11, -11, -22,
+		5, 55, -84, 18, 69, 70, 56, -60, -29, -64, -59, 4, 94, -45, 70, -46, 12, 71, 43, 78, 52, -77, -44, 83, 72, 38, -20, 89, -85, 0, -83, 13,
+		-22, -23, -41, 46, -88, -99, -60, -93, 50, -24, 30, -62, 55, -55, 98, 83, 93, -40, 64, -43, 19, 25, 37, -6, 57, 20, 12, -13, 14, -13, 72, 12,
+		8, 2, 64, 54, 0, -32, 7, -15, 7, 73, -9, -92, -78, -4, -43, 65, -40, -66, 15, -25, -5, 66, -93, 90, 19, -34, 27, 90, -68, 16, -77, 29,
+		-48, 62, -30, -64, -69, 75, 32, 10, -7, 54, -49, 14, -86, 12, 93, 70, 62, -76, -49, -90, -53, -76, 17, -7, 37, 56, -83, 67, 26, -65, 45, -87,
+		-73, -19, -14, 82, 11, 62, -29, -95, 99, -17, -75, 33, 5, -25, -100, 56, 20, 77, -16, -60, -12, 25, 96, 88, 23, 2, 81, -52, -32, -45, 87, -9,
+		97, -20, -30, -69, 57, 64, 32, 27, -92, 13, -22, 58, 26, 1, -85, -33, -38, -21, 85, -36, 24, -96, 33, -30, 17, 95, 72, 37, -31, 33, 73, -98,
+		95, -42, 70, 17, 43, 17, -72, -51, -33, -79, -70, -41, 29, -53, -54, 86, 14, -10, -67, -70, 46, -73, -4, -23, 15, -36, -44, -48, 49, -12, 74, 90,
+		-23, -56, -15, -27, 90, -61, -84, 46, -85, 72, -22, 37, -73, -41, 82, -6, -77, 13, -60, -70, 98, 43, -50, 99, -81, -51, -99, 6, -11, 78, 79, -32,
+		-74, 11, 65, 65, 58, 10, 44, -85, -24, -71, -60, 41, 67, -38, 86, 37, 30, 2, -16, 42, 20, -34, -91, 21, -9, -51, -65, -40, 63, 31, 30, -42,
+		25, 63, -16, 92, 78, -74, 65, -12, -94, -92, -10, -13, 64, 6, 46, -71, 69, 8, 3, 22, -57, -48, 47, -74, 30, -25, 91, 71, -51, 51, -12, -38,
+		9, 0, 85, 50, 44, -35, -78, 80, -73, -54, 75, -56, -9, 93, 39, 23, -39, -29, 89, 29, 36, -89, 24, -48, 48, -71, 8, 93, -64, -20, -93, -5,
+		-48, -71, -50, 55, -73, 91, -60, -10, 93, 63, -90, -15, 48, 56, -33, 94, -70, 51, 33, -55, 96, 65, 54, -14, -15, -10, -53, 36, 32, -16, 79, -87,
+		-39, -88, -100, 78, 25, -94, -12, 62, 87, 2, -86, 12, -64, -52, -93, 26, -92, 72, -73, 60, -21, -55, 33, 59, 15, -73, -22, 92, 58, -93, 54, 29,
+		-44, -35, 16, -28, 78, -44, -69, 52, -13, -66, -21, -19, -63, 28, -68, 32, -49, -66, 37, 21, 1, 75, 75, 10, 57, 5, -5, -87, -97, -47, -87, -29,
+		-88, 75, 78, 85, -59, 0, -74, 44, -52, 45, -40, -19, 50, 73, 47, -13, 69, 15, -45, 61, -46, 51, 0, 11, 43, 47, 96, -20, -56, 86, 65, -68,
+		-74, 20, 45, 56, -38, -2, 5, 2, 32, -23, -64, -91, -40, 21, 74, -80, -58, -79, -43, 86, -25, -43, -1, -62, -27, 2, 61, -11, -76, -96, 7, 79,
+		-76, 98, 65, 48, 39, -59, 96, 89, -13, 92, 51, 82, -25, -41, 92, 79, -23, -37, 68, -6, -15, 78, -80, 22, 98, -80, 68, 6, 13, 74, 60, -65,
+		63, 67, 27, 69, -90, 80, 78, 79, -10, 81, -17, 93, -27, -66, 51, 93, -39, -18, -68, 81, -95, -43, 52, 19, -99, 25, -87, -33, 99, 50, -68, -28,
+		25, 35, -19, 4, -7, 79, -5, 15, 54, 11, 44, 51, 62, -39, -92, -73, -51, -62, 52, 71, 29, 79, 73, -13, 63, 32, 91, 82, 86, -32, 97, -95,
+		88, 83, -41, 58, 13, -95, -13, -19, -95, 59, -84, 3, 16, -64, -10, -92, 8, -58, 12, 70, -85, 56, 62, 55, -51, -6, 80, 95, 38, 66, -30, 16,
+		53, 93, 20, 69, 45, -27, 83, -53, 26, -28, 45, 52, 78, 31, 8, 90, -78, -12, 13, -95, 48, -58, 76, -25, 14, -12, -76, 97, -61, 46, -61, -60,
+		40, -67, -47, -70, -71, 36, -12, -57, 43, -28, -68, 41, 81, 39, 25, -20, -19, 4, 24, 33, 2, 22, 68, -83, 75, 44, -35, 57, -50, 67, 54, -26,
+		18, -2, -70, 59, 50, -54, 12, -66, 62, -75, 56, -30, -91, -70, -93, -36, 31, 27, 8, -50, 34, -63, 76, -67, 27, -5, -49, -55, -58, 24, -61, 17,
+		88, -17, -44, -82, 2, 85, -74, -16, 29, -69, 9, -52, -31, -27, 20, -72, -56, -17, 90, 0, -44, -2, -33, -59, -6, -10, 53, 4, -34, 82, -21, 68,
+		57, 20, -17, -86, -77, -71, 32, -57, 36, 79, 10, -86, 61, -16, 60, 67, 7, -64, 20, 96, -26, 4, 23, 3, -74, -69, -48, -100, 20, -92, -96, 73,
+		31, -45, -51, -81, -38, -93, 47, 8, -61, 94, 73, -55, 96, -84, -14, -13, -86, 53, -60, -61, -15, 20, -83, -21, -24, -28, -33, -25, 14, -100, 10, 56,
+		94, -37, -90, -24, -83, -81, 56, 89, -74, 27, 76, 91, 27, 4, -72, -76, 66, -20, -87, 17, 91, 97, -47, 33, 1, -15, -81, -93, -8, -70, -65, -12,
+		-11, 72, -86, -59, 8, -7, 8, 68, -7, -87, -59, 75, -25, 81, -16, -43, -74, -25, -91, 80, 69, -69, -35, -79, 92, 22, -45, -54, -57, -63, -86, -98,
+		59, 16, -31, 49, -48, -82, -32, 42, 36, -53, -86, -80, -48, -87, 61, 7, -89, -67, -5, -18, 69, -77, -71, -11, 15, 39, 5, 66, 15, 73, 48, -41,
+		47, 57, -95, -82, -70, -32, 52, -26, -66, 62, -56, -36, 82, 37, -77, 6, 96, 2, 97, -17, 38, -54, 95, 83, -90, 83, -78, 20, 27, 84, -66, -27,
+		-83, 60, 45, 4, -92, 24, -36, -72, -53, 23, 50, 28, -22, 28, -6, 52, 96, 51, 19, -15, -80, 30, 46, -44, 95, -26, 21, -90, -64, -98, -1, 45,
+		-11, 37, -51, -4, -39, 70, -60, -36, -10, 32, 43, 19, 35, -14, -60, -51, 81, -94, -53, 26, 62, -98, 67, -46, -35, -60, -61, -46, -45, 38, -33, -35,
+		-68, 84, -90, 98, -13, 34, -88, -3, -73, -13, 91, -37, -70, 14, -44, -49, 18, 53, 42, 9, 19, -89, -4, 13, 60, 85, 72, -13, 89, 22, 71, -14,
+		3, -57, -63, 14, -98, 61, -26, -1, -89, -64, -35, 70, 78, -98, 59, 67, -81, -51, 87, -11, 96, -54, -75, 22, 59, -1, -43, 46, 99, 14, 55, -44,
+		-8, 93, 27, 97, -64, -64, 63, 71, -35, -18, 8, -90, 13, 39, 72, -71, 47, -81, 68, 38, -46, 41, -66, 85, 22, -9, 27, 48, -66, 58, -76, -20,
+		92, -57, 7, -87, 41, -5, -63, -85, -9, -54, -14, 84, -94, -80, 60, 89, -60, -46, -28, 43, 46, -38, 32, 77, -31, 97, -19, -41, 52, 53, 6, 23,
+		-42, 59, 68, 4, 28, -32, -91, 47, 20, -75, 81, -78, 87, -99, -42, -14, -86, 51, -45, 30, 42, 92, 95, -20, -60, -43, -72, -91, -37, -83, 62, -36,
+		50, 34, -18, -88, -51, 32, -16, 91, -60, 19, 12, 39, -44, -87, -70, -47, 54, -12, -58, -23, 95, 50, 29, -70, 93, 65, 56, 9, -76, -70, 91, 88,
+		7, 33, -31, 50, -75, -8, -39, -36, 2, -26, -79, -57, -77, -33, -97, -8, 43, 18, 94, 27, 11, 34, 63, -69, -12, -13, -17, -87, -93, 56, -29, -18,
+		-43, 96, -88, 18, 64, -91, -3, -7, 90, -6, 21, -98, 86, 51, -37, -52, -67, 35, -11, 29, -44, -48, 50, 60, -27, 21, -53, -82, -68, -15, -47, 53,
+		93, 73, -11, -97, -88, -95, -58, -75, 66, -10, -25, 22, -4, -45, -62, -13, -63, 48, 55, 91, -69, -48, -31, -97, -80, 7, 31, -28, 79, -84, 12, 68,
+		-61, 86, -60, 86, 13, -6, 82, 17, 60, 43, -54, 2, 80, 61, 25, -90, 80, 88, -11, -61, 85, 63, 55, 31, -48, 86, 18, 71, -65, 16, -91, -47,
+		-70, -84, 58, -60, 39, 33, 76, 15, -84, 15, 95, -74, -12, 12, -68, 28, 97, 91, 53, -74, -17, -1, -65, -78, -15, -76, 60, -41, 47, -24, 68, 52,
+		58, 12, -66, 55, -31, 65, 8, 25, -83, -31, -1, 15, 26, 61, 66, 94, 88, -57, 81, -43, 26, 51, 81, 39, 68, 15, -12, -50, -38, 72, -21, -6,
+		49, -99, -10, -90, -2, 26, -61, 1, -8, 69, -88, 91, -15, -51, -57, -57, 25, -16, -72, 24, -6, 43, -85, 66, -79, -34, -41, 50, -7, -25, 60, 71,
+		-93, 95, 71, 40, 84, 35, -8, 78, -82, -47, -4, -30, 53, -61, -73, -31, 12, -94, -32, 30, -34, -47, 45, 0, 46, 37, 96, 82, 82, 24, -31, 56,
+		45, 73, -23, -7, -65, 23, -93, -42, 79, -41, 66, -92, -98, 56, -66, 92, 83, -58, -11, -40, -86, -83, 92, 41, -95, 15, -15, -67, -53, 35, -3, 43,
+		-18, 12, 41, -25, 8, 88, 61, 64, 63, 60, 39, -72, -52, -8, -18, 51, 36, 17, -68, 76, 55, -10, 43, -65, -17, 83, -76, -24, -48, -31, 22, -18,
+		-36, -88, 73, 17, 82, -91, -76, -45, -75, 48, 83, 82, -20, -44, -81, -17, 67, 60, 31, -84, 18, 16, 45, 9, 23, 53, 63, 68, -5, 92, -30, 37,
+		21, -4, 51, 33, 69, 91, -40, -54, 99, -76, -25, 54, -45, -58, -51, -63, -14, -50, 86, 92, -96, 60, 55, 22, 23, 30, 96, 49, -13, 32, 20, 84,
+		39, 61, 68, -6, -26, 45, 85, 6, -39, 32, 96, 67, 52, 5, -46, -35, 74, -58, 24, 4, -4, 65, -39, -98, 72, -84, -24, 59, -92, -33, -75, 2,
+		-11, 64, 19, 49, 21, -76, -3, 15, -65, 71, 15, 61, 59, 20, 30, 22, 74, 51, 35, -70, -54, 11, 71, -45, 58, -95, -10, 72, 13, -31, -33, 74,
+		52, 25, 24, 71, 34, 1, -39, -7, 79, 76, 39, -44, -95, -78, 13, -61, 24, -84, 7, 80, 16, -35, 87, 88, 10, -3, 60, -8, -57, 0, 22, -33,
+		-98, 71, -92, -45, -24, -63, 64, 61, -62, 74, -43, -47, 61, -27, -12, -76, 98, -16, -36, -78, 4, 46, 48, -8, -95, 12, -80, 97, 49, -13, 2, 76,
+		-66, 14, -90, -43, -16, 39, -13, 98, -24, -4, 47, 11, -4, -62, -11, -23, -66, -93, 1, 95, 38, 66, -90, -41, 87, 67, -11, 49, -65, -64, -92, -99,
+		-38, -11, 54, 40, 22, -39, 58, 47, -61, 43, -77, -43, -68, 10, -82, 0, -98, -47, -50, 98, 93, -9, 49, -48, 91, 22, 16, -82, -85, -4, -8, 14,
+		94, 94, 60, -71, -64, -16, 98, 17, 70, -55, -33, 88, -9, -55, -28, -17, -53, 21, 2, -53, -20, 99, -72, 86, -57, -94, 36, 30, 17, -28, -3, 78,
+		-91, -6, -2, -89, 11, 16, 37, -35, 65, 81, 84, 94, -68, 37, 33, -89, -49, -75, 52, -50, 25, 74, 98, 50, 45, -8, 58, -17, -26, 87, -22, -41,
+		81, 20, -43, 33, -64, -64, -80, 37, 24, -23, 54, 80, 77, 55, -100, -68, 8, 37, -31, 25, -3, -49, -63, 42, -41, -90, 2, 84, -96, 46, 24, -35,
+		-77, -18, -69, 20, -98, -57, 46, -68, -96, 86, -65, 86, 3, -95, -79, 6, 87, 58, 14, 15, 27, -14, 64, -3, 27, 81, 50, 22, 58, 13, 57, 44,
+		-67, -82, -38, 71, 58, -19, 24, -7, -82, 99, 13, -72, -30, -32, -98, 19, 20, 15, -87, -20, -79, -59, -1, -1, 70, 8, -56, -91, 7, 87, -55, -95,
+		-1, 22, 67, -82, -37, -16, -22, -37, 88, 4, 87, 39, -68, 70, 82, 21, -94, 25, 12, 69, 93, -17, -21, -82, 32, -39, 49, -33, 27, -82, 10, 18,
+		67, -61, -43, -65, 71, -83, -52, -92, -1, -100, -52, 23, -89, 82, -73, -26, -77, -81, -35, 78, 24, -3, -85, 83, 12, -5, -94, -91, 7, -75, 58, 70,
+		70, -64, -49, 35, -83, -56, 81, -82, 10, 68, -24, 51, 21, 67, 65, -68, 86, 96, -98, -62, 8, -28, 84, 28, 19, -43, -14, 39, 11, -62, -58, -56,
+		-25, 92, 46, -2, 40, -87, 33, -80, -27, -28, 71, 89, 31, -42, 1, 91, 92, -69, 39, -22, 27, -47, 87, -20, -10, 67, 91, 55, 97, 37, 75, 42,
+		-9, -70, 32, -19, -4, -39, 32, 31, 99, -76, 74, 79, -85, -68, -84, -62, 26, 54, 19, -20, -98, 15, -11, -22, 83, -58, 84, 69, 39, -32, 53, 85,
+		-96, 1, 53, 51, 72, 65, 39, 43, -28, -79, 1, 91, 10, -28, 91, 30, -4, -14, -62, 71, 7, 4, -63, 28, -90, -27, -55, -91, 47, -34, -86, -83,
+		-39, 49, 96, -55, 84, 93, -30, -22, -30, 5, -34, 9, 62, -30, -56, 60, 36, 6, 17, -42, -11, -54, 37, 91, -41, 60, 3, 74, 10, 70, 3, 0,
+		84, -88, -91, -39, 51, -57, -56, -89, -69, -34, -81, 38, 7, -39, 89, 44, -96, -50, 38, -42, 81, 37, -81, -73, 13, -78, -32, 90, 16, -92, -72, -35,
+		79, 76, -9, -51, -56, -72, -71, 60, -59, 34, 10, 26, 80, 56, -7, -47, 17, 53, -71, 34, -77, -9, 95, -25, -20, -22, 58, 41, 1, -64, -6, -57,
+		45, 61, 91, -89, -66, 16, 64, -85, 71, -48, 46, 72, 70, -10, -42, 85, 15, 15, 82, 39, -69, 4, -32, -88, -2, -75, 1, -12, 10, 55, -6, -51,
+		93, 41, 51, -9, -21, -13, 47, -62, -31, -81, 84, -5, 25, -10, 38, -75, 34, 97, -23, -42, -95, -85, -31, -21, 18, 99, -96, 70, 80, 68, 99, 29,
+		93, -25, -93, -95, 36, -60, -46, -20, 27, 81, 18, -12, 1, -99, 60, -26, -74, 91, -22, 42, 57, 40, 71, 25, -76, 23, 32, 73, -80, 27, -95, -98,
+		-20, 0, -81, 76, 71, -98, 6, -92, 52, 4, -54, 56, 98, 37, 20, 46, -96, 76, -6, 67, -33, -5, 30, 12, -65, 71, -64, 16, 51, -73, 23, 40,
+		93, -9, -91, 0, 28, -80, -51, -95, 88, -27, -69, -63, -63, 97, 43, -40, 5, 54, -62, 34, 11, 32, -74, -4, 26, -22, -37, -99, -35, -3, -81, 77,
+		-51, 12, -44, -99, -97, 31, -97, -16, 50, -99, -41, 50, 94, -68, -14, 11, -51, -65, 9, -39, -10, 94, -91, 62, -29, -21, -80, -24, -19, -23, 19, 80,
+		-86, 66, -31, -96, 82, -94, 27, -61, -78, -25, -13, -37, -28, -26, 11, 36, 96, 85, -19, -67, -77, -49, 49, -5, -17, 30, 7, 22, -39, 21, -26, 36,
+		20, 39, 88, 3, 40, -78, 79, -90, -86, 46, -50, -54, 22, -22, 49, -75, 16, -34, -45, -18, -74, 48, 87, -51, -42, 99, 15, 64, -24, 72, 23, -46,
+		-6, -44, -9, -65, -85, -58, -32, -23, 89, 34, -91, 37, 56, -45, 8, 50, -38, -71, 8, -20, 82, 36, 43, -32, 21, -15, -52, -32, 81, -64, -48, -62,
+		67, -29, 53, -18, -49, -97, 53, -65, 29, -77, 97, 31, -59, 64, 34, 36, 26, 32, 69, 47, -29, -23, 73, 28, -73, 0, -34, -13, -57, 56, 21, 47,
+		69, -67, 78, -12, 62, -74, 14, -6, -23, -21, 38, -52, 30, 65, -55, -4, 90, 52, 30, -42, 3, 85, 68, -2, 2, -92, -32, 0, 6, -88, -9, -98,
+		-4, 51, -91, 89, 80, 21, 94, -59, -80, 27, -44, -46, 22, 93, -20, 76, 76, -47, 68, -66, 24, -27, -54, 23, 27, 32, -1, 17, 44, 83, -46, 62,
+		7, -63, -3, -70, 91, -97, 65, 95, 16, -30, 54, 20, -42, -53, -3, 19, -21, -41, -5, -52, -81, -63, -87, -8, -7, -2, -95, 45, -14, -11, -16, 73,
+		53, 13, 21, 54, 60, 84, -76, 82, -87, 84, 29, 32, -30, -21, -86, 69, 78, 2, 54, -90, -25, 27, -24, -75, -92, -79, -100, 96, 34, 38, -35, -13,
+		-60, 64, 33, -70, -75, -9, -41, -44, 99, 99, 57, -8, -82, -87, 67, 5, 9, 46, 49, 65, 72, -78, 49, 24, -87, 54, -92, 53, 50, -6, 31, -31,
+		-4, 15, -53, -59, 29, -29, 63, 78, 6, 77, -90, 47, -13, 20, 86, 22, 62, 91, -51, -71, -27, 91, 67, -82, 78, 12, -86, -36, -12, 97, 61, -16,
+		-93, -40, -79, -32, -28, 93, 22, -53, 54, -32, 1, -33, 57, 53, 41, 46, -27, 59, -16, -20, 45, -34, 33, 61, -53, -73, -37, 49, -57, 9, -4, 98,
+		-32, -89, -11, -47, -68, 99, -82, 91, 36, -68, 3, 6, 80, 72, -41, -84, -79, -68, 71, 0, 45, 13, -3, -30, 9, -65, 33, 22, 31, -100, -83, -75,
+		92, 77, 39, 18, -86, 0, -83, 39, -29, 81, 49, -71, 3, 8, 13, -55, 67, -85, -28, -91, 55, 36, 89, 2, 63, -61, 46, 68, -92, -54, 30, -56,
+		-79, 65, -48, -46, -97, -49, -46, 16, -77, 65, -65, -43, -42, 1, 1, -38, -61, -23, -55, 49, 84, 19, 58, -5, 35, -85, 34, -39, 33, -62, -14, 3,
+		-81, -65, -63, -29, -52, 60, -65, 39, 41, -47, -50, 62, 1, -28, -38, 97, 85, -72, 41, -27, 2, -95, -21, 27, -84, -6, -100, 96, -91, -43, 1, 82,
+		-58, 74, -82, -76, -73, -25, -68, -47, -17, -63, 89, -99, -34, -30, -47, -60, -99, 31, -63, -22, -84, 33, -97, -47, 38, 10, -93, 71, 8, 69, -95, -52,
+		2, 6, 61, 27, -90, 19, -89, 3, 19, 66, 84, 83, -34, 36, 32, 21, -62, -81, 33, -61, 81, 27, 9, 88, 9, -85, -39, -34, -91, -91, 64, -41,
+		-1, 67, -33, -37, 38, 5, 85, -49, 78, 51, -88, 48, 69, -30, 50, 24, -92, 8, -34, -30, 45, 13, -97, 94, 58, -58, -58, -61, 58, -75, 0, 1,
+		-31, -43, -48, 42, -8, 93, -79, -43, 67, -22, 14, 93, 69, -39, 14, -47, 51, 1, -18, 63, 76, 80, -71, -36, -1, 45, -59, 64, 82, 76, -62, -35,
+		-29, 68, 21, 24, 34, -26, -70, 68, -21, 58, 94, -32, -42, 59, 71, -27, -83, 52, -97, 15, -74, 32, 92, -6, -20, -23, 83, -49, -7, 23, 93, -97,
+		58, 24, 92, -27, 79, 10, 99, 94, 45, -57, 13, 90, 54, -83, 87, 25, -45, -24, 27, 28, -40, -78, 28, -38, -22, -9, 85, 10, 7, 17, -25, 4,
+		94, -39, -46, 68, -4, -26, 68, -72, -9, 34, -73, 53, 85, -61, 20, -61, -6, -46, 56, 87, 16, 2, -42, 60, -67, 71, 86, 4, 65, -35, -4, -92,
+		91, -46, -63, -95, -11, -58, -18, -9, 28, 81, -83, -31, 9, -53, 16, 23, 81, -37, -6, -86, -96, -48, -75, -42, 42, 57, 31, -42, 1, 0, 25, 90,
+		43, 8, 50, 56, 46, 70, -20, -16, 38, 39, 63, -17, -48, -51, 69, -16, -17, -90, 37, -33, 55, 21, -83, 80, -13, 14, 34, -32, 34, 74, 56, 0,
+		-97, -66, 42, -44, 74, 11, 15, -97, -46, 62, -6, 52, 65, -25, -46, 37, 50, -92, -11, -84, 12, -59, 11, 37, -82, -13, 56, 78, -66, 70, 63, -41,
+		-82, -18, -96, -83, 34, -82, -96, 56, 16, 59, 14, 62, -51, -91, 13, -77, -2, -25, 50, 29, -2, -78, -12, -8, 47, -16, 36, 16, 6, 34, 49, -63,
+		-43, 44, -53, -55, -61, 97, -75, 24, -46, -55, 98, -66, -65, -77, -14, -29, -87, -36, 1, -92, 29, 80, 28, -30, -35, -9, -1, -52, -77, 73, -81, 80,
+		-78, 1, 26, 37, -16, 54, 44, -70, -60, -40, -12, 11, -4, 25, 1, -60, -72, 81, -44, 17, -67, -92, 47, 38, -98, 69, -19, -78, 88, 99, -61, -56,
+		-74, 38, -16, 82, -32, 73, 8, 35, 55, -11, -63, -70, 23, 14, -100, 46, -21, -33, 28, 74, 27, -85, -79, 7, -28, 37, 70, -71, -35, -75, 93, -28,
+		-43, -69, -96, 50, -37, -93, 70, -52, -21, -66, 75, 6, 91, 19, -75, -95, 51, -93, -72, 3, -39, -42, -82, -95, -98, -14, -85, 19, -6, -83, -91, -51,
+		-99, -33, 49, 46, -8, -60, 86, -23, 61, 55, 36, -66, 6, -53, -84, -89, 51, -81, -56, -85, -61, -85, -27, -62, 43, -35, 67, 64, -57, 91, 4, -54,
+		-96, -62, -69, -13, -83, -18, -51, -22, 46, -12, 26, 70, 45, 95, 88, -15, -56, 57, -86, 11, -12, 36, -61, -77, -76, 97, 35, 22, 86, -65, -99, -100,
+		48, 98, 26, 50, 24, -76, -20, -89, 72, 68, 64, 77, -88, -22, -58, -8, -89, -35, 1, 12, -32, -35, 50, -37, -10, -48, -69, 99, -77, -75, -40, -14,
+		-62, -30, -29, -94, -78, 56, -83, 38, 38, 97, -23, -58, -23, 15, -48, -25, -73, 22, 24, -22, -35, 87, 27, -23, -91, -11, 57, 7, 44, 7, 43, 84,
+		61, -61, -54, 71, 98, -95, 65, -35, -60, -30, -94, 54, -59, -88, -27, -99, -56, -79, 77, 97, -75, -58, 14, 1, 40, -24, 52, -13, 3, 24, -8, -99,
+		-91, 89, -68, -79, 67, -72, -14, -65, -76, 53, -80, -61, 46, 29, 11, 69, 25, -43, -3, -19, 87, 21, -83, -2, 43, 14, 2, -79, 72, -70, 79, 9,
+		80, 79, -92, -90, 95, -26, 64, 5, 62, 37, 48, 10, 26, -43, -88, 0, 61, 36, -32, -71, 95, -53, -45, 3, -51, -64, -67, -26, -31, -58, 26, 38,
+		-18, 80, -71, 96, -1, -12, 47, -83, 15, -37, -35, 41, -71, 93, 42, -94, -2, -11, -47, -19, -100, 50, -76, 91, -17, 45, -75, 87, -53, 96, 52, 78,
+		-82, -15, 86, -6, 48, -98, 65, -75, 19, -37, -28, -41, 65, 46, -1, -70, -7, -25, 69, -21, 47, 38, 21, -100, 69, -37, 15, 15, -53, 59, -38, 63,
+		-18, 59, -56, 75, -23, -77, -40, 32, -47, 56, -7, -86, 17, 95, -10, 5, 62, -91, -36, -66, 18, -4, 79, 36, 67, -69, 73, 83, -49, 6, -4, -10,
+		-80, -18, -69, -52, -6, -57, -67, -12, -32, -40, 89, 64, -10, -62, 21, -95, 2, -76, 99, 71, 33, 78, 95, -59, -52, -36, 56, -48, -5, -35, 53, 74,
+		-52, -97, -48, -95, 8, 14, 73, -80, -55, -57, 72, -48, 75, 88, 79, 78, 94, -10, 27, 78, 79, -9, 9, -58, 52, -80, -89, 9, 71, -35, 91, 66,
+		-11, 26, 80, -71, 80, -36, 55, -41, 39, -99, 21, 1, 48, -4, -75, -87, -90, -99, 24, 58, 72, -33, 23, 47, -31, 72, 14, 18, 75, 65, -36, 12,
+		36, 8, -58, -99, -34, 71, -20, -92, 31, -78, -71, 56, 95, -72, -71, -31, 75, -40, 38, 69, 90, -82, 41, 6, 78, 38, -31, 10, -46, 11, -75, -75,
+		47, 94, 22, -95, 95, -96, -20, -77, -9, 49, 79, 8, 43, 91, 70, -78, -15, -24, 56, 41, -34, 57, 62, 40, -57, 53, -46, 92, 64, 93, -28, -76,
+		-12, 3, -14, -23, -45, 26, 59, 81, -100, 47, -12, 29, -10, -4, 26, 60, 30, -55, -25, -55, -73, -37, 28, -67, 84, 70, -93, 20, 94, -49, 49, -30,
+		-23, -99, 54, -64, -21, -7, 67, 92, -45, -100, 62, -6, 84, -2, -95, -37, -97, -6, -6, 52, -9, 45, 73, 40, 3, -97, -29, 14, 43, 80, 38, -100,
+		2, 85, -19, 54, -29, -64, 33, 97, 53, 77, -37, -33, 62, -91, -10, 91, 6, 50, -82, -19, -38, -39, -60, -62, 70, 3, 4, -47, 70, -18, 37, 16,
+		20, -88, -67, 68, -38, 4, 80, -74, -88, -30, -75, -64, -98, 30, -18, 33, -93, 83, -8, -29, -82, 82, -13, 64, 51, -95, 93, -8, 10, -100, 5, -9,
+		-89, 48, -85, -65, -65, 25, -88, 92, -33, 55, -96, 83, -95, 78, 84, 32, 45, -54, -74, -67, -77, 71, -80, 21, 63, -30, 41, -1, 48, -5, -57, -66,
+		-28, -64, 73, 75, 58, -75, 78, 99, -67, -61, -11, 74, 64, 73, 23, -99, 21, -4, 56, 26, -7, 9, 32, 62, 60, -21, -28, 91, 92, 83, -82, -53,
+		92, 47, -87, 80, 13, -18, 83, -77, -99, -77, 40, 96, 46, 15, -93, 14, 86, 77, -5, -17, -98, 93, -69, 12, -51, 89, 23, -84, -35, -82, -35, -56,
+		-75, -33, -29, 27, 49, -85, 33, -73, -90, -77, -38, 15, 59, -98, -22, -98, 42, 99, -57, 45, 24, -83, -97, -51, -51, -71, 89, -73, -50, 38, 89, 82,
+		-49, 41, -51, -95, -72, 6, 3, -80, 26, -74, -19, -22, 59, 76, -62, 19, 72, 44, 83, -30, 7, 26, 91, 99, 65, -20, 57, 68, 60, 81, -52, -83,
+		-12, -26, 56, -65, 44, -19, 5, -76, 0, -54, 70, -15, -72, -23, -18, 82, 17, -85, -20, -10, -1, 65, -73, -83, 33, 84, -10, 51, -78, 50, -91, 45,
+		49, -61, -20, 70, 12, -70, -76, -38, -74, -12, -37, 7, 32, -28, -55, -75, 52, 86, 39, -64, 62, -35, 96, -16, 38, 15, 52, 41, 90, 9, 47, 4,
+		36, -11, 36, 86, 96, 50, 13, 99, -84, -1, -41, 32, 37, 4, -59, 62, 57, 87, -86, 90, 34, 98, -92, -50, -59, -79, -91, 79, 36, 49, 11, -83,
+		-42, 64, -63, 14, 9, 66, -99, -82, -12, -57, 77, -20, 20, 88, 4, 86, 84, -1, -62, 4, 61, -71, 13, 29, 15, -47, -57, 23, 50, -70, -80, 72,
+		-81, -89, -88, -15, -8, -84, 97, -26, 52, -49, 2, -71, 55, 51, 21, -23, 7, 57, -98, -19, -4, 22, 99, -45, 17, 96, -71, -67, -10, -32, -22, -38,
+		-62, 68, -40, 74, 78, 86, 56, -20, 47, -21, -76, 43, 65, 80, 95, -72, -20, -47, -52, -65, -28, 60, 83, -55, 2, 94, -10, -94, -96, -5, 87, 24,
+		34, 51, -47, 41, -51, -60, -77, -34, -83, 9, -32, 99, -46, -30, -37, 0, -25, 42, -95, 41, 0, 7, -19, 77, -31, -91, 99, 0, -9, -96, -80, -43,
+		54, -45, 18, -31, 18, 58, 71, 65, -52, -41, 94, 71, 74, 45, 73, 42, -60, -96, -21, 18, -100, 37, 81, -27, 91, 68, -7, -100, -53, -52, 89, 85,
+		50, 49, 51, -80, -41, -2, -79, -78, 7, 97, 10, 92, -81, 7, 15, 61, -73, -48, 27, -71, -54, -15, 11, 81, 19, 65, -90, -57, 60, 14, -95, 62,
+		-88, 9, -38, 27, 95, -12, 93, 65, -91, -6, -60, -97, 15, -59, 65, 89, -15, 1, -23, -63, -15, 73, 66, -76, 54, 53, 7, -27, -70, -80, 68, 36,
+		-75, -87, -26, -93, 97, -37, -96, 50, -72, 8, 49, 2, 96, -10, 50, 89, -53, 51, -45, 70, 58, -9, 45, -38, 32, -28, 9, -54, -65, -30, -60, -29,
+		86, 63, -44, -15, -51, 25, -46, 30, 90, 81, -100, -13, -77, -20, 34, 94, 95, 94, 45, -44, 65, 32, -16, -23, -17, -79, -35, 98, 98, -5, -93, -31,
+		66, 79, -42, 75, 1, -6, -25, 76, 94, -30, -62, 82, 2, 69, -95, 60, 78, -78, -35, -51, -7, -92, -92, 34, -75, -58, -94, 55, -56, 33, -88, 32,
+		-71, 38, 19, 95, -11, 20, 37, 31, -24, 99, -60, 80, 96, 34, 70, 86, 7, 22, -9, -1, -39, 83, -26, 4, 36, 92, -32, -50, -82, 33, 40, 57,
+		-24, -71, -14, -22, -76, -13, 44, -69, 40, -90, 75, -2, 48, 19, 78, -17, -46, 28, 56, -100, 99, 75, 43, -82, -43, 89, -49, -21, 99, 5, 37, 22,
+		-70, -30, 97, -97, 25, -40, 77, 13, -25, -25, -1, 74, 84, -15, -56, 49, -97, -22, 16, -28, -63, -58, -78, 91, 13, -37, 30, 30, 19, 65, -29, 49,
+		-15, -89, 66, 81, 28, 20, 98, -62, -93, -16, 37, 85, 7, 88, -67, -56, 47, -16, 12, 4, -50, 97, 86, 72, 96, -18, 54, 93, 57, -93, -79, -51,
+		28, 41, 50, -23, -75, -83, 97, -43, 70, -42, -93, 38, -87, 14, -72, 31, -9, -8, 70, -37, -25, -35, -20, 84, -7, 58, -46, -98, -32, -16, -42, -75,
+		-83, 13, -30, 11, -82, 4, -44, 8, 24, -44, -7, -42, 15, -79, 3, -8, -14, -92, 29, 56, -62, -51, -87, 60, -94, 57, 76, 12, -73, -39, -59, 48,
+		61, 67, 53, -87, -12, -99, 26, 12, 72, 93, -11, 39, 95, -16, -91, 45, 46, 16, -12, -55, -8, -23, 75, 25, 50, -23, 25, -53, 66, -51, -83, 1,
+		-75, 79, 35, -55, -74, 8, -82, 40, 88, -90, -4, -7, -37, -10, 28, -60, 56, -64, -41, 35, 74, 85, -37, 43, -53, -85, -45, -26, 44, 95, -6, -23,
+		84, -86, -94, -49, 82, -81, -52, 53, 61, -97, 72, -4, 11, -50, -61, 58, -49, -86, -84, 33, -7, -22, 1, 70, 79, 15, 12, 74, 31, -35, -5, -90,
+		-89, 34, 87, 87, -78, -99, -51, -86, -63, 4, -78, -72, 46, -60, -99, -5, -49, -37, -6, -6, -13, 89, 14, -74, 7, -17, 86, -72, -32, 81, 55, 55,
+		-20, 47, 96, -79, 4, 49, 69, -31, -1, 9, 15, 36, -41, 85, -93, 81, 29, 93, 20, 69, 18, -6, 44, -13, 81, -20, -46, 52, -6, 99, 8, -15,
+		-87, -4, -88, 28, 86, -33, -19, -47, -58, -73, 33, 90, -30, -29, 31, -20, 38, -56, 38, 70, 92, -24, -83, -4, -18, -35, -47, -36, 94, 45, -52, 24,
+		-29, 97, -36, -24, 26, -63, -37, 82, -6, -12, -90, -83, -3, 74, 15, 82, 88, -31, -32, -1, 1, -39, -21, -15, 88, 84, 13, 18, -51, 77, 25, -22,
+		-87, -45, -68, 32, -89, 69, 75, 14, -2, -33, -94, -31, 56, -22, -49, -73, -91, -49, -69, -28, 13, -38, 20, 45, 97, 71, 7, 5, -22, -62, -79, 19,
+		-9, -68, 0, 28, -45, 51, 52, 27, 30, -25, 19, -24, 4, 15, -76, 93, 15, 69, -19, -99, -67, -48, -88, -72, 52, -10, -42, -46, 81, 81, -60, -25,
+		-96, -73, 99, 84, -57, 56, -14, -52, -57, -82, 18, -40, -55, -20, -97, -60, 29, 80, -59, -78, 26, 97, -98, 74, 92, 99, -88, 55, -68, -54, -55, -31,
+		-55, 16, -90, -83, -84, -49, 32, -42, -9, -10, -38, 13, 47, 71, -88, 44, 60, -30, 51, -60, -55, -11, 21, 99, -74, 8, 37, 58, -32, 4, 27, 20,
+		0, 56, -20, -70, 66, 17, 0, -68, -10, 36, 0, 40, 82, 1, 31, -74, 51, 17, -32, -96, -71, 32, 69, 87, -85, 14, -10, -35, 72, 83, 96, 16,
+		5, 46, -20, 7, 22, 55, 31, -66, -51, -64, 41, 80, -66, 71, 36, -29, -11, -41, 78, 22, -46, -25, 25, -10, 69, 84, 45, 36, 59, -11, -21, 83,
+		-52, 57, 63, 87, 11, -54, -96, -6, 26, 50, -59, -9, 4, -67, 4, -43, 76, -13, -2, -66, 33, -22, -89, -73, 86, 32, -44, 90, 83, -5, 26, 88,
+		-64, 91, -51, -57, -89, 10, 67, -97, -76, -82, -77, 12, -29, 72, -8, -54, -56, 97, -46, -100, -100, -51, 20, 80, -38, 17, -85, -60, 38, -3, -57, -15,
+		-19, 29, 34, -21, -71, 55, 1, -97, 2, 18, -11, 86, -93, 33, -68, -83, 22, -19, -38, 60, -57, -31, -11, 3, -18, 50, 20, -20, -12, -72, 43, 79,
+		-59, 60, -73, 12, -79, -67, 95, 67, 69, -39, 1, -29, -72, 64, -4, -10, 20, 29, -70, 89, 38, -18, -76, 33, -82, -84, 77, 31, -34, -8, 1, 3,
+		11, -11, -75, 38, 22, -35, 55, 10, -77, 76, -7, -9, -16, 60, -7, -29, 93, -6, 1, 43, -30, -92, 14, -22, -63, 47, -11, -34, 59, 87, 68, -13,
+		-37, 29, 24, -44, -93, -16, 70, 11, 37, 85, 89, -84, -69, 87, 75, -30, 18, 28, 21, 41, -30, -94, 80, -76, 22, -96, -63, 43, -84, -69, -20, 36,
+		83, 87, 3, -26, -31, 82, -83, -6, 28, 32, 76, 96, 8, -61, 15, 83, 41, 17, 28, -34, -91, 4, 1, 28, 30, 71, -41, 39, 28, -61, 82, 78,
+		-62, -58, 31, 40, 9, -72, -42, -11, -87, -75, 38, -91, 11, 67, 42, -25, 80, 76, -24, 84, -5, 93, 21, -87, 68, -35, 91, 69, 43, -91, -73, -70,
+		-50, 37, 42, -17, 17, -100, 88, -76, -98, -6, -25, -4, -58, -63, -52, 68, 8, 25, -36, -81, -50, 41, 69, -8, -51, 61, 51, -35, 62, 73, -80, 63,
+		-77, 42, 53, 6, 31, -43, -56, 68, 94, -76, -3, -28, -82, -18, -93, 87, 0, 51, 75, -55, 30, -25, 95, -70, -76, 33, 87, 88, -34, 61, 64, 64,
+		-42, -48, 94, 80, -19, 0, 97, 60, -59, -89, -81, -93, -78, -3, 46, -41, 43, 23, 76, -89, -65, 15, 76, 60, -100, -83, -78, 59, 25, 24, -20, -17,
+		32, -59, 11, 88, -16, 66, -47, -48, -92, 74, 83, -100, 50, -18, -74, -32, -93, -94, -17, 33, 41, -88, -79, 2, -35, -41, -72, -80, -73, -63, 88, -44,
+		-44, 14, -5, -5, 58, 20, 27, 0, 9, 48, -80, 82, 26, -90, -99, 83, -33, -81, 90, -82, 69, 51, 25, -22, 54, -51, -69, -23, -11, 38, 61, -82,
+		29, 15, -78, -42, 29, -63, -75, 28, 42, 40, 44, -30, -53, -26, -95, -79, 62, 49, -83, 40, -29, -37, 76, -7, -63, -29, -52, -51, -48, -30, 12, -76,
+		-62, -72, -4, 97, 80, -83, -97, 2, 98, 83, -3, -60, 40, -70, -35, -83, 39, -34, 56, -23, -43, 27, -39, 32, -50, -7, 68, 36, -81, -70, 8, 21,
+		84, 68, -17, 2, 55, -48, -64, 10, 36, -36, 33, -32, -11, 92, 72, 77, -40, -18, -81, 68, 72, -1, -70, -18, -58, -84, -88, 14, -56, -9, -82, 61,
+		-66, 34, 74, -47, -83, 32, -76, 51, -39, -24, -47, 53, 89, -73, 37, -67, -96, 97, 16, 98, -70, -1, 55, -76, 69, -12, 19, -81, 80, 94, -6, 47,
+		-95, -93, -23, 64, -87, -8, 34, 46, -80, 74, -31, -73, 5, -75, 4, -7, -91, -26, 30, -35, 75, 4, 66, 74, 46, -42, 17, -91, 51, -35, -40, 24,
+		15, 44, -26, -3, -13, -13, 7, -12, 57, -85, -12, 71, -83, -5, -19, -85, 23, 93, 85, 63, -85, 91, 84, 33, -8, -13, 3, -11, -33, 36, 31, -55,
+		47, -65, -83, -100, -68, 53, -94, -90, -53, -56, -65, -69, 44, 96, -92, 45, 86, 64, 29, -18, -88, 91, 62, 69, -92, 18, 93, 70, -28, 41, -89, -16,
+		29, -66, 43, -14, 20, 73, -61, 17, 79, -72, 14, -33, 14, 54, -81, 96, -36, -96, -86, -45, 53, -23, -49, -91, 11, 29, -7, -20, 66, -74, -26, -88,
+		69, -35, -76, -64, 38, -47, -73, 54, 95, -4, -44, 92, -25, 6, 62, -77, -31, 77, 32, -34, 68, 37, 44, -64, 93, 13, -48, -8, -42, -15, 80, 54,
+		85, 0, -79, 4, -34, 77, 39, -36, 49, 62, 32, -14, 47, 94, -7, -87, -19, -68, -1, -55, -26, 19, -49, 58, -82, -8, -87, -77, -97, 33, -56, 45,
+		-74, 31, 58, 62, -70, -53, -7, 83, -7, 25, -49, 78, 1, 65, 22, 78, -76, 35, 64, -27, -77, 20, 10, 97, 27, -54, -40, -5, 86, 61, -74, -57,
+		-36, -29, 42, 99, -49, -29, -24, -16, 24, -64, -31, -58, -66, 72, -43, -63, -48, 25, -17, -40, -10, -41, 15, 66, 30, -45, 25, 10, -67, 4, 25, -9,
+		66, 86, 52, -72, -89, 25, 74, 10, -89, 28, -43, 2, -25, -57, -1, 23, -51, 28, -86, 41, 83, 57, -25, -7, 38, 51, -14, 24, -86, -84, -98, -10,
+		52, 58, 55, -46, -75, 7, 22, -6, 11, 68, -93, 76, -4, 35, -76, -19, 87, -89, -28, 4, -71, -20, 21, 55, 90, 24, -62, 2, 14, -54, 64, 8,
+		85, -17, 79, 87, -16, -18, -96, 30, 0, -21, 41, 84, -77, -99, -78, 0, -99, 94, 26, -79, 12, -43, 19, -67, 13, -16, 55, -99, 87, -21, 67, 71,
+		42, -97, -68, 87, 80, -88, 82, 86, 92, 39, 7, 87, -16, -85, 46, 76, 47, -17, -31, 5, 79, 79, -56, -43, -47, 0, -21, -47, -67, -28, 73, 80,
+		98, 45, -75, -93, -35, -62, 2, -99, 66, 68, -14, -54, -35, 40, 70, -6, -43, -64, -69, -12, -31, 21, -88, -52, 57, 56, 38, -95, -66, -26, -11, 7,
+		-59, 30, 70, 23, 56, 97, -67, -27, -97, 77, 31, 83, 37, 50, -99, -69, -18, 77, -99, 13, 13, -37, 84, 34, 31, -52, 33, -42, 81, 0, 33, 39,
+		7, -83, 2, 78, -70, 18, -15, -19, 55, -9, 55, -50, 16, 56, 28, 45, 84, 79, -19, 33, 29, 87, -33, -36, 98, 40, 36, -69, -49, -88, -69, -49,
+		3, -20, -38, -87, 23, 27, -26, 81, 78, -34, -77, 61, -50, -28, 16, -14, -65, -5, -46, 85, 70, 46, -71, -71, 16, -27, 70, 24, 41, 19, -70, -70,
+		-57, 82, 1, -28, 68, -97, -81, 3, 58, -32, -24, 57, 64, 73, -46, -20, -89, 47, 73, -37, -68, 33, 86, 65, -28, 78, -38, 8, 43, 10, -23, -77,
+		5, -12, -96, -4, 11, -4, -20, 40, 10, 59, 50, 52, 34, 43, 54, 56, -98, 82, -87, 80, 61, 89, -28, -81, 0, -79, 37, -94, 57, -66, -39, -84,
+		50, -83, -92, 11, 63, -20, 45, -37, 91, -58, -24, -54, 12, 28, -5, -72, -81, 94, 77, -96, -61, -55, 35, 76, -12, -73, -9, 79, -2, -34, 21, 22,
+		19, 13, 47, -39, 49, 20, 85, -51, -42, -83, 54, 1, 85, 12, 56, 16, 66, -36, 38, 84, -33, -49, -78, -97, 37, 42, -11, 39, -44, 21, -24, -34,
+		28, 94, 82, -51, -83, -64, -71, 71, 38, 63, -59, -58, 77, -94, -9, 64, 13, -3, -16, -89, -96, -16, -100, -61, 61, 44, 93, 71, 97, 52, -96, 61,
+		-97, -22, -92, 17, 44, -89, -77, -34, -51, 71, 12, 43, -27, -46, 96, 2, -89, 38, -40, -41, -81, -9, -36, -58, -65, -62, -63, 78, 10, -31, 28, 98,
+		40, -1, -4, 37, 20, -49, -64, 35, 26, 54, 7, 47, -92, -72, 80, 41, 80, -10, 78, 48, 38, 17, -11, -97, -49, 6, 14, -53, 9, 95, -12, -81,
+		-44, -57, 26, 29, -94, -9, 66, -51, -52, -31, -41, 43, -71, 62, 52, 63, 95, -36, -20, -67, 58, -47, -17, 96, -86, -55, 99, 82, 60, 53, -31, -83,
+		-35, -25, 0, -83, -93, 73, -48, -84, -84, -60, -20, 2, -57, -17, 44, -31, -82, -20, 17, -49, -52, -41, 53, 70, 41, 71, -34, 99, 83, 7, -99, -46,
+		-68, 34, 94, 93, -67, -35, -41, 20, -2, -88, 53, -56, 86, -92, -90, 28, 87, -7, 37, -27, -45, -23, 29, -32, -6, -98, -50, -10, 40, 68, 84, -6,
+		69, 12, -98, -82, 67, 10, -16, -5, 42, -44, 97, 80, 82, 62, 45, -63, 82, 5, 74, 57, -53, 94, -51, 39, 89, 65, 5, 71, 0, 39, -46, -20,
+		-25, -85, -71, 97, 55, -71, 87, -13, 61, 51, 33, 31, 56, 63, -90, 60, 11, -86, 4, -46, 45, -41, 62, -72, 90, -39, -11, -27, 72, 50, -18, -23,
+		-58, 63, -9, -12, 32, 76, 71, 90, -46, 93, -8, 61, 33, 7, -4, -33, 3, -93, -88, -37, -72, 23, 49, 34, 77, -92, -13, 84, -43, -45, 88, -29,
+		-29, -58, -76, 85, 31, 64, -8, -75, 9, -23, -65, 57, 22, -60, 98, -48, 65, 30, 98, -62, -97, 19, -63, -67, 55, -56, 38, -33, -13, 74, 87, -5,
+		15, -99, 2, -75, 39, 72, 31, 83, 95, -39, 8, -81, -36, -97, 46, 98, 31, -86, -35, 34, -48, -49, -92, 12, 71, -36, 80, -50, 33, -21, 52, 57,
+		-33, -94, 10, -6, -9, -97, 76, -90, -71, -41, -87, -14, 29, 25, -81, 12, -53, 84, 6, -87, 3, -12, -8, -44, 3, 15, -79, -9, 31, 50, 41, 43,
+		-85, -60, 82, -14, -15, -28, 28, 74, -36, -28, -46, 35, -40, 80, 8, 46, 83, -85, -17, -31, -6, -99, -22, 6, 24, 27, -47, 49, 23, 74, 45, -71,
+		25, 54, 0, 57, 49, 0, -17, 3, 38, -71, 80, -27, -2, -60, -41, 35, -99, 41, 73, 17, -3, -26, -53, -79, -88, 21, -90, 69, 53, -75, -49, 0,
+		-48, 88, -99, 14, -75, 77, -55, 47, 1, 59, 31, -55, 97, 41, 71, -13, -55, 57, -61, 12, 0, -48, 93, 83, -56, 54, -90, -49, -57, -64, 37, -99,
+		37, -90, -10, 61, -6, 93, 6, -20, 9, -92, -96, 23, -79, 59, 85, -43, 22, -18, -97, 78, 89, -73, 49, 93, -64, -57, 6, -3, -31, 78, -8, -88,
+		96, -72, 39, 67, -92, 29, 97, -43, 6, -8, 11, 18, 96, 32, -99, -70, 20, -90, 41, 31, 97, 74, 96, 54, 17, -66, 80, 14, -1, 87, -46, 95,
+		94, 22, 97, -29, 65, -11, -40, 62, -14, 7, -9, 0, 97, -33, 30, -12, -93, 40, -79, -68, -63, -69, -95, 26, 99, -86, 90, -21, 7, 64, -42, 26,
+		9, 97, 81, -32, 7, -50, -33, 98, 29, 93, 37, 8, -74, -3, 82, -41, -13, 6, -72, 78, 26, -33, 63, -9, 45, 73, -30, 30, 33, -93, -48, -75,
+		62, -25, 70, -2, -78, 13, -89, -74, -59, -21, 30, -10, -15, -28, 59, -92, 9, 27, -80, -69, 85, 14, 98, 32, -14, -83, -77, -27, 57, -64, 76, 64,
+		22, -91, 84, -30, 19, 32, 4, -14, -6, -31, 39, -70, 19, 32, 5, -23, -1, 61, 17, 21, 61, -35, 60, -48, -9, -90, -24, 24, -29, -53, 90, -72,
+		-62, 45, -74, -63, 95, -38, -53, 53, 4, 41, -52, 64, 41, -77, 4, -51, 59, 71, -45, -53, 4, 78, -81, -57, 13, -96, -52, -81, -17, 5, -19, -77,
+		60, -5, -54, -75, -49, -22, 99, -63, -12, -25, -71, -36, -49, -6, -50, 16, 94, -49, -76, -4, -47, 69, -56, 0, 56, -79, -74, 97, 7, 69, 37, 49,
+		70, -70, 83, -69, -35, -36, -9, -80, 21, 98, -81, -100, -53, -62, 80, -36, -54, 52, -54, -11, 30, 58, -7, 60, 75, -67, 24, -43, 96, -76, 27, -17,
+		-77, 5, -8, -16, 19, -21, -84, -95, 98, 77, -3, 59, 66, -89, -53, -10, 84, -32, 79, -94, 80, 53, -28, -19, 73, -31, -56, 85, 54, -46, 45, 52,
+		-46, -38, 40, 81, 41, 79, -14, -50, -67, 56, 92, 4, -97, -62, 30, 82, -7, -84, -96, -95, -8, -88, -90, 78, 44, -4, -30, 1, 91, 56, -48, 13,
+		-97, -91, -56, -66, -68, 54, 55, -25, 18, -81, 92, -69, 11, 86, 29, -75, 74, -52, 79, -25, 54, 44, -19, 33, 53, -73, 84, 42, -41, 62, 12, -82,
+		7, -34, -88, -50, 50, 81, 69, 47, 24, 4, -42, 88, 56, 94, -96, 79, 85, -73, -48, 67, -81, -25, 21, -24, 53, 13, -66, -48, 10, 86, -5, -95,
+		-17, -58, -50, 17, -69, 47, 9, 76, 99, -88, 54, -94, -54, 33, -97, 84, 10, 58, 29, 48, 27, 22, -32, 28, 28, 64, 79, -64, 62, 68, 15, -20,
+		82, 16, 8, -20, 58, 10, -7, 72, -14, 63, -32, 81, 7, -91, 32, -91, 21, -84, -37, 28, 64, 85, -67, -9, 80, -52, -99, -71, -82, -69, -26, -87,
+		21, -4, -42, -12, 46, -12, 1, 43, -37, 73, 40, -19, -19, -76, 9, 81, -39, 66, 91, -10, -37, 62, 32, 58, 51, 72, 27, -65, -29, 52, 39, 97,
+		-86, 67, 59, -29, 43, -82, 29, 26, -37, 51, -20, -46, -64, -15, 61, 65, -71, -51, -53, -47, -39, 25, -26, -70, 78, -29, 77, 17, 9, 45, -25, -84,
+		67, 28, -75, -32, -17, -73, 10, -33, 56, 89, 9, -73, 16, 75, 72, -16, -53, 67, 47, 46, -96, 52, -28, 51, -87, 13, 35, -39, 78, -29, 39, 86,
+		94, 33, 9, 14, 21, 5, -83, 75, -13, -53, -37, 17, 65, -10, 35, 83, 3, 42, -18, -63, -44, 16, 81, 98, -63, -76, -83, 99, 62, 5, -97, -54,
+		-12, -72, 69, -68, 95, -91, -7, 66, -92, -8, -8, 98, -95, 4, -39, -62, -6, -88, 12, -63, -83, 60, -55, 19, -66, -11, -7, 17, -66, -71, 84, -67,
+		-40, -25, 32, -75, 96, 30, 37, 30, 89, 40, -73, 19, -93, 94, 43, -64, 50, 30, 5, 70, -37, 38, -62, 85, -52, 35, 57, -28, -71, 59, 4, 54,
+		-61, 26, 52, 25, 80, -97, -6, 67, -25, -28, -97, -72, -70, 18, 60, -77, 59, -58, 67, -61, 7, -53, -14, -81, 7, 58, 87, -83, 87, 91, 49, 24,
+		70, -96, -14, -78, 37, -70, -10, 2, 42, 27, -62, -84, 38, -43, -74, 7, -49, 85, 57, -96, -80, -34, -1, 46, -67, 64, -77, 26, -56, -32, -63, -24,
+		-28, -14, -84, -8, 3, -87, 30, -81, 24, 34, -98, -94, -92, -34, 25, -72, -21, -80, 55, 49, -50, 15, -15, 33, 76, 69, -93, -86, -9, 63, 28, -94,
+		-80, -55, -43, -60, 66, -67, 37, -80, 28, -68, -18, 59, -74, -33, 96, -89, -83, 42, 82, 61, -22, 16, -21, 49, -75, -20, 48, 60, 99, 89, -6, -93,
+		84, 16, 76, 7, 53, 40, 82, 32, 44, -98, -31, 31, -25, 15, -65, 48, 96, -95, -51, 8, 49, -73, 2, -48, 56, -99, 67, 22, -7, -54, 92, -59,
+		-82, -51, 89, -65, -45, 12, 13, 27, 71, -6, 93, -46, -39, -71, -68, -51, -18, -3, 57, -20, -64, 97, -58, 81, 74, 98, 98, 30, -62, 12, 54, 22,
+		-55, -88, -78, 53, 5, 54, -99, 6, -62, 41, 32, 57, -97, -20, 19, 63, -76, -39, 65, 73, -71, 30, 12, 62, -5, -2, -79, -63, 90, 54, -58, 71,
+		-19, 9, -17, 98, 79, 41, -44, 47, -62, 76, 65, 91, 28, -49, -90, -58, -97, 92, -47, -22, -7, -66, 70, 31, 84, 31, 39, -48, 28, 47, 10, -83,
+		-1, -85, 36, 43, 0, 75, 30, -5, -68, -75, 93, 99, -81, -11, -7, 16, 1, 23, 58, 52, -76, 6, 65, -2, 68, -84, 55, 22, -96, -75, 67, 57,
+		44, 98, -64, -54, 53, -97, -2, 27, -13, -83, -32, -49, -34, -17, 97, -99, -50, -5, -71, -99, -39, -34, 91, 69, -6, 46, -33, 13, 49, 66, 44, -29,
+		-74, 58, 39, -31, -8, 79, -52, 9, 31, 17, 85, -91, 63, 4, -62, -83, -33, -80, 36, -100, -70, 23, 11, -37, -14, -44, 96, -35, -17, -67, 15, 96,
+		79, 85, 74, -79, 44, -47, 80, -17, 62, 68, -74, -37, -73, 75, -25, -7, 70, 97, -16, 58, 29, 59, 89, -80, 42, -32, 29, -79, -62, 28, 68, -5,
+		18, -84, 69, 35, -67, -90, -16, -65, 84, 28, -87, 17, 16, 86, -55, -1, 71, -87, 41, 50, 84, -68, 76, -5, 38, 37, 62, 4, -100, 44, -77, 3,
+		-99, 46, -58, 56, 36, -30, -85, -20, -12, -91, -95, 71, 30, -97, -77, -50, 70, 25, -67, -38, 74, -74, -90, 34, -88, 53, -20, -96, -84, 13, -88, 12,
+		-63, 1, -74, -28, 81, -3, -44, -20, -30, -67, -13, 9, 9, -49, 56, 71, -74, -17, 94, 89, -10, 47, 49, -20, 69, -31, -47, 72, -62, 68, -20, -70,
+		-91, -34, -92, -71, -26, -46, 90, 56, -23, 8, -66, -77, -44, 98, 35, 19, 43, -41, 98, -90, -16, 51, -39, 31, -1, 43, 75, 84, -39, 16, 69, -1,
+		2, 12, -36, -45, -36, -96, -84, -77, -70, 93, 44, 96, -88, 89, -28, 11, -83, -37, 27, -69, -76, 57, -50, 49, -52, 6, 43, -22, -4, 71, 13, -88,
+		46, -80, 25, -49, 4, -5, 26, -53, 42, 92, -61, -69, 47, -83, 63, 27, 90, -37, -19, 26, -5, -92, 98, 59, -41, -42, -70, -26, -38, 56, 54, 60,
+		-1, 8, 60, -100, 55, 66, 96, -83, 59, -89, -64, -59, -6, -69, -99, -45, 17, -18, -70, -24, 5, 46, 24, -85, -39, -95, 28, -29, 64, -51, -46, 59,
+		34, -23, -86, -82, -96, -83, -59, -22, -48, -4, 53, -92, -65, -77, 77, 61, 53, -63, 96, 16, -92, 75, 8, -67, 19, -83, 60, 14, -1, 75, -15, -80,
+		22, 55, -54, -63, 2, 51, 61, 68, 46, 55, -37, -61, -63, -97, 60, -24, 37, 27, 34, -97, -50, -47, 32, 49, -31, 47, 31, 33, -33, 10, -52, 65,
+		-90, -23, -23, 15, 49, 83, 58, -63, -81, 64, 31, 24, 66, -55, 69, 57, -72, -92, -53, 16, 57, 36, 36, 62, 88, -58, 60, -65, -17, 1, -9, 36,
+		47, 30, 92, 4, -46, -6, -60, 97, -56, 40, 86, 47, 50, -82, -27, 85, 91, -40, -31, -34, 3, -71, -37, 3, -22, -28, 92, 7, 47, 96, 45, 11,
+		26, 38, -22, -79, 71, 29, -20, -85, 31, -25, 91, 75, 5, -24, -44, 77, -40, -68, -99, -46, 84, -7, -93, 1, -76, -53, -28, 40, -51, 0, 5, 5,
+		-37, 50, 2, 62, -65, 10, 97, -89, 87, -83, 51, -92, 33, -64, -70, -48, -3, -92, -46, 90, 39, -29, -35, 33, 12, -37, 15, -23, -27, 40, 12, 13,
+		58, 51, 81, -5, -63, -2, -29, -16, 62, -40, -74, 59, -37, 80, -53, 49, 15, 44, -62, 83, 40, 39, 37, -39, -45, -26, -57, 51, 54, 69, 30, -73,
+		-89, 87, 65, 7, 62, -42, 19, 75, -72, -13, -15, -48, 96, 0, -16, -72, 10, 25, 53, -31, -85, -35, 50, -52, 38, -23, 89, 72, 34, -88, 29, -54,
+		-97, 62, 27, 13, -28, 86, 90, 95, 2, -6, -87, -43, -32, -74, -50, -66, -10, -33, 78, -46, -98, -53, 47, 16, -12, -48, -65, -55, 2, 49, 7, 53,
+		-1, -81, 5, 68, 1, -8, -18, 2, -83, -35, -6, -80, -71, -75, -46, -39, -8, 72, -95, 23, -59, -10, 78, -48, 73, 62, -79, 5, -34, -55, 40, -69,
+		-8, -74, -19, -80, 94, -72, -9, 20, 98, -27, 84, -31, -52, -31, 72, 92, 22, 47, 37, -71, 65, -14, 25, 64, 44, 16, 86, 92, 87, 47, 71, 67,
+		62, 54, 50, -57, -1, -21, 0, -15, 77, 7, 66, 42, -12, 3, 80, 92, -75, -15, 91, 97, 19, -77, -89, -35, 24, 45, -97, -66, -31, 81, 77, -6,
+		-82, 64, 39, 56, -62, 18, -29, 8, 35, 89, -58, -51, -60, 97, 73, 64, 13, 65, -8, 62, 34, -92, -61, 0, 56, 58, -85, -22, -21, -15, -79, 24,
+		-66, -66, 35, 32, -11, -1, 34, 51, -25, -23, -20, -9, -73, 49, -50, -69, 48, -7, 69, -8, -10, 98, -7, -84, 5, 50, 58, 47, 53, -23, -59, -53,
+		-84, 14, 68, 32, 42, -100, -50, -19, -80, -19, -80, 70, -3, 35, 6, 52, -91, -91, -37, -51, -53, 43, 37, 62, -59, -29, 90, 96, -19, 21, -47, -29,
+		-34, -2, 85, 19, 49, -74, -58, -60, 8, -35, 71, 53, -99, -28, -65, -49, 16, 0, -81, -52, 92, -81, -60, 14, 96, -35, 91, -88, -98, -3, 78, 10,
+		-78, 74, 38, -69, -21, -12, 25, -67, -49, -29, -90, 89, -27, 50, -64, 35, 25, 75, -64, -48, 16, -19, 39, 92, -68, 68, -25, -63, 62, -13, -58, -73,
+		-58, 92, -73, -64, 30, -54, 41, -20, 26, 47, -52, 15, 32, -14, -4, -72, 91, -8, -67, -10, -29, 90, 18, -39, -93, 88, -54, -14, 62, -65, -10, -30,
+		-84, -95, 63, 64, -7, -40, 96, 1, 20, 56, -87, 51, 27, 10, -13, 74, -64, -50, 84, -90, -76, 88, 86, -89, 58, 19, 50, 41, -28, 65, 68, -61,
+		89, -27, 35, 31, 22, -28, -16, -38, -14, -23, -74, 27, -46, 74, 52, -33, 54, 10, 39, 53, -52, -25, 36, 62, 21, -38, 7, 2, -11, 14, 89, 45,
+		45, -80, 23, 75, -14, -7, 7, -10, -53, -77, 78, 5, -96, 4, 20, 52, 58, 71, 69, -74, -77, -42, 27, -64, -57, 85, 79, -67, -68, -10, 20, -53,
+		27, -58, -68, -82, -55, 49, 78, -36, 77, -93, -71, 26, 24, -50, -36, -64, -30, 47, 40, 66, 94, -83, 16, 30, -69, -67, 22, 61, -51, -4, 93, -47,
+		30, 0, 32, 32, -65, 87, 18, -38, -87, 17, -29, 32, -78, 14, 27, 6, -73, -32, 70, 84, 48, -67, -65, 0, -18, -90, 16, 71, 39, -32, 22, -91,
+		76, 59, 73, 66, 91, -22, 15, -70, 51, -83, 64, 27, -79, 50, -37, -22, -31, 77, 38, 71, -90, -9, -54, 15, -51, 62, 25, 85, 72, -77, 27, -50,
+		34, 74, -70, 46, 69, -12, -95, 10, 51, -33, -95, -82, 28, 21, 27, -62, 21, 61, -71, -60, -12, 81, -74, 79, 75, 15, -99, 34, -80, -88, -49, -75,
+		-76, -55, -42, 92, 55, -31, 87, 67, 39, 60, 94, 49, 42, -62, -24, 44, 33, 3, 32, -43, -25, 79, -71, 59, -60, -77, 15, 2, 41, -7, -96, -47,
+		-11, -95, 43, -4, 58, -59, -92, 43, -52, -62, -17, -76, 42, -100, -65, 37, -83, 87, 45, -74, 28, -20, -9, 97, 14, 4, 89, -94, 9, 39, -89, 7,
+		-10, 76, -36, -74, -6, -88, -6, 42, 58, -94, 90, 97, 4, -99, 38, 12, -82, 95, 31, 22, -26, -49, 72, -32, -64, -19, -20, -12, -31, 15, -100, 64,
+		-64, 56, 43, 60, -27, -93, -69, 57, 85, 19, -42, -65, -19, -7, 84, -29, 79, 75, -92, -62, -26, 93, 68, -96, 59, 52, -30, -42, -25, -9, 60, -70,
+		71, 21, 94, 29, 84, -9, -34, -90, 42, 42, 85, 37, 39, 15, 63, -29, 37, -25, 62, -41, -100, -21, -28, -44, -24, 38, -58, 12, 81, 44, 16, 29,
+		52, 47, 0, -37, 77, -52, 88, -37, 25, 53, -14, -40, -7, -12, 3, -50, -22, -58, -26, 7, 41, -56, 87, 77, 3, -98, 1, 88, 64, -98, 79, 1,
+		77, 41, -22, 15, 12, -43, 66, -80, 28, 3, 68, 46, -19, 4, 39, 18, -34, 87, 44, 54, -75, 45, -44, 53, -19, -64, 96, -89, 72, 4, 15, 96,
+		35, -13, -50, -37, -81, 83, 29, -65, -21, -14, 58, -67, 51, -89, -43, -61, -70, -64, 85, -81, -99, 46, -46, -26, 74, 31, 75, 18, -46, -74, 38, 19,
+		-38, 30, -86, 73, -31, 44, 31, -28, -78, 54, 53, -65, -76, 57, -4, 54, -21, 66, -32, -1, 83, -4, -73, 64, -36, -45, -23, -46, 9, 94, 72, -20,
+		12, -13, -71, -52, 33, -92, -44, 10, -40, 51, 19, -83, -14, -50, -36, -38, 18, 42, 27, 22, 75, -80, 33, -64, -12, 91, -22, -93, -69, -70, -6, -88,
+		7, 53, -64, -96, 2, -5, 86, -4, 74, -24, -1, 39, -10, -73, -99, 43, 70, -32, 28, 88, 2, 87, -26, 46, -37, 80, -78, 59, 22, 75, 6, -6,
+		13, -23, -31, 63, 45, 15, -7, 34, 13, 95, -7, 50, -61, 13, -20, 56, -49, -99, 87, -81, 76, 59, 60, -16, -61, -19, 97, 35, -100, 47, 73, 91,
+		-83, 88, 21, 67, 89, -26, -27, -81, 65, 11, -90, -63, 18, -21, 40, 70, 42, 86, -95, -64, -73, 48, 31, 54, -42, 31, 89, -48, 16, 43, -43, 96,
+		0, 35, 64, -85, -80, -41, -8, 39, 37, -73, 32, -43, -33, -67, 66, 19, 53, -29, 2, 10, 37, 97, -15, 38, 49, -96, 39, 84, -41, 19, 93, -77,
+		-5, -70, 56, -55, -1, -11, -48, -57, -92, -86, 85, 38, 42, 91, -26, -21, 48, 65, 5, 15, 20, -40, -62, 64, 22, -13, -27, -89, 81, -46, -59, -73,
+		-70, 89, 58, -8, 55, 67, -88, -90, -57, -4, 68, -14, -41, 7, 4, -43, -46, -43, 26, 15, 10, -18, 12, -14, 49, 63, 19, 86, -23, -94, -3, 39,
+		49, 55, -8, 96, 57, -88, -46, -66, 2, -44, -81, -32, 32, -54, 55, -11, 99, -44, -73, -63, -37, 95, 96, 47, 16, 21, 22, -21, 91, -18, 96, -92,
+		-35, 29, 13, 73, 63, 39, -6, -33, 38, -92, -26, 84, 14, 89, 59, -54, 62, -12, -92, -61, -6, 51, -82, -14, -10, -95, -67, -18, -99, 26, -96, -61,
+		91, 53, 83, 56, 60, 17, 30, 52, -30, 26, -24, -91, -62, 96, -65, -7, 0, -99, -72, 47, -63, 73, -93, -83, 9, 96, -47, 3, -53, 46, 35, 2,
+		-19, 45, -48, -62, 6, 95, -87, 98, 47, -94, -91, -16, 61, -100, -42, -71, -31, 85, -25, 96, -95, 73, -72, -51, 97, -57, 43, 41, 50, 94, -43, 75,
+		-63, -34, 33, 53, -18, 59, 96, 17, -63, -23, -29, 80, 31, 95, -29, -59, 14, 19, 27, 17, -28, -94, -95, -1, 89, -38, 12, -25, 96, 23, -73, -69,
+		0, -11, -79, 80, -99, -42, -34, 56, 19, -96, 80, -70, 54, 81, 18, 77, 47, 73, 53, -97, -95, 89, 20, 66, -32, -39, -61, 50, 11, 3, 36, -11,
+		19, 68, -36, 86, -2, -3, -13, -44, -58, -65, -16, 41, 12, -52, -70, -1, -100, -40, -10, 99, 40, -14, 15, 65, 96, 93, -1, 53, -54, -42, -69, -53,
+		-11, 16, -18, -62, -53, 76, 16, -45, -66, -65, -52, 48, 81, 37, 98, 41, 60, -33, -56, 75, -55, 29, -18, -99, -44, -18, 85, 95, -89, -5, -42, -71,
+		-55, 17, -3, -17, -52, -62, 74, -46, 88, 57, 79, -77, 30, 14, -24, -92, 33, 13, -99, 67, -88, -29, 21, -43, 3, -40, -74, -55, 55, 18, 56, -29,
+		32, 23, -7, 32, 33, -1, -25, -7, 38, -60, -57, 96, -71, -23, 98, -84, 82, 74, -54, -89, 34, -18, 93, 82, 43, 69, -90, -93, 22, -44, 55, -77,
+		-71, 36, -66, -76, -41, -50, -30, 97, -5, -45, -19, 21, -52, 57, -100, 37, -45, 96, 26, -45, 26, 50, -47, -45, 4, -50, -72, -16, 55, 23, 90, 28,
+		-48, 99, -48, 21, -40, -39, -64, -52, -99, -5, 14, -51, 89, 20, 29, 10, -14, 63, -83, -13, 37, 94, -91, 76, 67, -95, 83, -89, -97, -34, 88, 69,
+		61, -82, -93, 91, 55, 49, -78, -24, -84, 19, -57, -94, 5, 6, 75, 63, 24, -4, 89, 89, -43, 59, -53, 20, 8, 0, -39, -39, -21, 82, -83, -23,
+		-68, -22, -89, -84, 95, 47, -99, -39, -53, -85, 25, 90, 6, -35, -90, 82, 21, 55, -58, 77, 3, -70, 94, -72, -92, -7, 90, -88, -39, 33, -98, -15,
+		25, 42, -52, -80, 69, -76, -16, -3, 69, 69, 98, 33, 13, 35, -82, 10, -84, -33, -51, 9, 97, 83, 87, 66, -76, 11, -42, 24, 9, 11, -40, -68,
+		22, 76, 39, -96, -20, -52, 60, 72, -3, -3, -23, -75, -19, -12, -48, 10, 20, -57, 24, 34, 10, -23, -36, -98, 72, 43, -34, -15, 9, -91, -77, -92,
+		-84, 35, -96, 78, -18, 54, -98, -28, -97, -24, 9, 10, -26, -28, 74, 20, -80, -41, -68, -27, -85, 9, -63, -31, -57, 53, 19, -51, 37, 33, -8, 71,
+		40, -33, -10, -24, 0, 49, -39, 33, -54, 70, -96, -20, -20, 95, -83, 58, 30, -14, -4, -12, -60, -11, -12, 16, 31, 55, 99, 55, 64, 36, -78, 70,
+		-73, 47, -17, -15, -40, -13, -50, -28, 38, -60, -44, -27, 86, -62, 23, -90, 8, -96, 99, 22, -78, 84, -96, 50, 35, 55, 54, 42, 8, 66, 90, 57,
+		5, 69, -34, -81, -35, -80, -73, -51, -93, 19, 76, 66, -50, -53, 46, -93, 46, -87, 54, 79, -29, 6, -8, -18, -6, -91, 28, -61, 19, 86, -40, -68,
+		10, -6, -60, -9, 13, 5, 32, -72, 74, 98, 93, 35, -8, -9, 79, 61, -18, 61, -59, -47, -78, 49, 98, -11, 40, -14, -79, -83, 14, -15, -17, -23,
+		45, 86, 77, -98, -24, -19, -78, 50, 27, 27, 12, 18, 74, 70, -24, 71, -98, 41, 69, -90, -79, 26, -5, -99, 91, 10, 90, 45, -53, 10, -20, 96,
+		-3, -93, 78, 72, -84, 0, 57, 38, 52, -71, 27, 65, -8, -92, 79, -4, -88, 53, -11, -90, -24, 93, -93, 62, -43, 38, 24, 17, -100, 47, 20, 5,
+		64, -64, -8, -96, 9, 75, -14, -61, 32, 38, -77, 24, -60, -57, -88, -30, -98, -93, -57, -21, -6, 52, -49, 3, -84, 65, 7, 26, 54, 6, 52, 48,
+		75, 0, -84, 95, -92, 62, 59, 15, 91, -13, 45, 45, -20, 35, 35, -89, 45, -53, -15, 72, 87, -40, -27, -91, 97, 70, -38, 62, -37, -46, 35, -95,
+		53, 13, 3, 71, -91, -87, -26, 37, 56, -79, 79, 49, 62, 51, -76, 22, -42, 25, 97, -20, -5, 78, -55, 33, -10, -81, -21, -80, -43, -63, -30, 20,
+		36, -36, -64, 17, 22, -73, -7, 38, 20, -91, -48, 36, 78, -59, 7, 72, 57, -13, 50, -41, -66, -13, -5, -38, 99, -53, 5, 58, -87, 17, -65, 24,
+		43, -51, 34, -16, -57, 88, -71, 81, 11, -45, -58, -37, 60, 57, 25, -55, -18, 76, -45, 66, -11, 72, -81, 25, 9, 73, 18, 73, -12, 96, 1, -71,
+		54, -7, -37, -46, -27, -68, 23, -76, 84, -48, 49, 53, 17, -19, -1, 39, 15, 54, 69, -83, -68, -82, -63, 69, -91, 58, 68, 73, -25, -25, -77, -69,
+		-92, 52, -53, -11, -28, -71, -3, -85, -92, 35, 86, -86, 79, -3, -5, 54, -34, -1, 2, 33, -53, -48, 80, 86, -84, 12, -47, 4, 83, 93, 72, -93,
+		69, -61, 27, -87, -29, 55, 39, 31, -66, 99, -37, 35, 43, 75, -55, 57, -6, 91, -12, 39, -19, -41, -10, 79, -22, 9, 38, -34, -62, 14, 16, 86,
+		82, -48, 13, 56, -52, -46, 21, -16, -61, 51, 22, -51, 21, 18, -44, -34, -75, 27, 96, 14, 13, -80, 84, -55, -92, -4, -77, 19, -33, -30, -11, -6,
+		3, -80, 6, 14, 60, 36, -44, 32, 10, 31, -40, -12, 85, -58, -56, 55, -77, -97, -55, 6, 22, 1, 19, 99, -80, 95, -84, -5, -55, 78, 18, 23,
+		58, -36, 45, 63, -10, -81, 0, -52, 23, -42, 57, 0, 12, -21, -68, -39, 48, -17, -93, 12, -65, 77, -48, 13, -62, -7, 76, 21, -22, -8, 57, 52,
+		89, 14, -17, 38, 2, -85, -53, 75, 11, -93, 12, 27, 82, -12, -40, -98, -46, -54, -46, 94, -12, -46, -76, -85, 2, 3, -9, 4, 6, -12, -63, 20,
+		-85, -70, 3, -21, -9, -56, -48, 26, -36, 55, 76, -62, 70, -99, -11, 1, -61, -96, 21, -62, 13, 36, -92, -87, -87, 22, 26, 28, -39, 15, 73, 98,
+		-58, 6, 78, -94, 25, -7, -75, -44, -36, -51, -4, 27, 36, 65, 97, 81, 75, 22, -84, -70, 97, -44, 89, -49, -17, -41, 8, -7, -73, -15, 58, 10,
+		50, 60, 12, 66, 57, 78, 64, 24, 72, -34, 24, 55, 75, -76, -27, 34, -8, -41, -47, 82, -27, -54, -51, -22, 64, 34, -76, -38, -13, 24, 21, -21,
+		-77, 17, -79, 58, 60, 33, 51, -71, 1, -79, -53, 50, 27, -52, 79, -70, -30, 40, 64, -54, 39, -36, -34, 44, -64, 46, -89, -68, 5, 22, -32, 58,
+		85, -72, -57, 28, 4, -18, 75, -81, -47, -23, 4, -52, 91, 62, -19, 24, 89, 45, -77, 59, -5, 17, 10, 88, -79, 88, -31, 15, -56, -61, 55, 3,
+		64, 8, -59, -76, 85, 71, -13, 61, 79, -71, 50, 14, 54, -29, -72, -84, 73, -99, -19, 28, 88, 14, 39, 30, 0, -73, 69, -81, -38, -21, -75, 2,
+		-33, -9, -25, 49, 65, -45, -3, 2, 87, -83, -30, 38, 8, 90, 33, -6, -89, -97, 23, -28, -81, -31, 14, -69, 34, 51, 25, -95, -62, 52, 57, -4,
+		65, 1, 81, 34, -10, 60, -64, 88, 36, -2, 23, -49, 20, -39, 84, -83, 24, -22, 28, -18, -3, -27, -75, -6, -58, 82, 35, 18, -34, -61, 19, 73,
+		86, 0, -5, 66, 98, -16, 87, 50, 9, -42, -35, -41, 42, -48, 42, -91, 40, 9, 24, 75, -19, 81, 70, 61, -61, -16, -18, 16, -31, -51, -12, 9,
+		63, -79, 11, -32, -93, 26, -15, 47, 45, 70, 21, 52, 83, -68, 95, 53, -45, -33, -41, 44, 94, 55, -11, -6, 64, -59, -17, 2, -63, -62, 46, -18,
+		-5, -96, 56, -26, -74, -19, -5, 66, 25, 55, -14, -33, -97, -61, -21, 11, 81, 17, -94, -4, -21, 49, -1, 9, -52, -11, -51, -27, 37, -51, -23, 80,
+		-35, 29, -48, -74, -80, -67, -16, 17, 74, -86, 9, -89, 97, 25, 22, -33, -15, -15, -5, 26, 59, 70, -74, -98, 27, 6, 67, 68, 49, 39, -16, -91,
+		-92, -43, -83, 93, 20, -74, -94, -39, -15, -14, -87, 76, 47, 12, 82, -45, 55, 39, 75, 61, -99, 17, -59, -58, 75, -2, 92, -72, -93, 34, 25, 83,
+		-5, -3, 42, 22, 83, 33, -41, -57, 12, 68, 18, 98, -18, -11, -33, 40, -97, -60, -37, -17, -62, 90, 58, 18, -7, -90, -74, -82, -2, -59, -90, -51,
+		94, 5, -78, 27, -6, -89, -31, -35, 41, 89, 5, -11, 73, 43, 32, 83, -47, 69, -95, 4, 23, 99, -54, 1, 73, 47, 28, 31, -87, 8, 56, -60,
+		-32, -54, -8, 77, -77, 48, -93, 5, -42, 69, -46, 51, -70, 5, -35, -23, -25, -41, -6, -4, -93, 50, -17, -16, -99, 24, -39, -7, -55, -99, -4, 55,
+		-48, -90, -32, -52, -83, -7, -4, -5, 54, 7, -3, -62, 73, -50, 89, -38, -99, -4, 83, -97, -12, -37, 23, 45, -68, 94, -1, -55, -96, -9, -53, 20,
+		12, 66, -82, -61, -70, -82, -64, -66, -4, 9, -52, 63, -2, -64, 18, -14, -5, 16, -84, -41, 67, 82, -22, 17, -51, -57, -100, -26, 25, -58, -74, 3,
+		-53, 94, 4, -96, -36, -33, -72, 2, -41, 9, -56, -60, -24, 82, 74, -99, 39, 35, 0, 6, 14, 39, 43, 29, 18, 36, 49, -27, 71, -93, -3, -22,
+		-55, -54, -78, 69, -11, 86, 48, -35, -84, -34, 30, 49, 87, -20, 51, 35, -100, -1, 65, 11, 48, -23, 99, -81, -33, 95, -61, -100, -21, -57, 40, -37,
+		6, -90, 93, -21, 74, 90, 85, -14, 15, -38, 54, 42, -3, 78, -24, 94, 96, -61, -38, 44, 5, 54, 35, 13, 38, -51, -5, -47, -65, -88, -21, -32,
+		83, 41, -36, 31, -48, 82, 20, -16, -30, -6, -53, 65, 46, 8, 38, 6, -52, 21, 45, -46, -22, 28, -97, -35, 48, 31, -40, -31, -58, -70, -53, 74,
+		-27, -19, 30, -53, -65, -70, 77, 78, 70, -90, -22, 80, -62, -29, 17, 31, -56, -97, 77, -73, -1, 3, 47, 45, 5, 79, -67, -66, 57, -78, 1, 49,
+		-11, 45, -93, -27, 31, -65, -61, -65, 87, -55, -87, 25, 47, 28, 22, -70, 47, 7, -59, -42, -11, -40, 90, 75, 40, 80, 57, -89, -24, 64, 59, -19,
+		-5, 56, -20, 95, 23, -30, -84, 50, 39, -56, 66, -36, -47, -55, -3, 77, -87, 37, -100, -59, 53, -71, -42, 47, -19, 35, 24, 83, -4, 19, -79, -67,
+		53, 21, 56, 72, 62, -92, 85, 37, 45, -10, -94, 81, -91, 24, -1, 18, 28, 43, -92, -23, -37, -36, 1, -42, 51, 88, -56, 49, -75, -31, 52, 41,
+		32, 63, 89, 48, -47, 85, 51, -7, 96, 86, 18, -84, -34, -79, -76, -41, -15, -35, -54, -41, -36, -87, -63, 54, -61, -15, 98, 9, -77, -44, -10, -92,
+		-20, -82, -15, -87, -79, 27, 39, 74, -90, 57, 52, -2, 47, -56, 1, 6, 49, 3, 12, -89, 11, -80, 2, 2, -93, -70, -80, -84, 97, 85, 91, -51,
+		74, -60, 87, 21, -33, -30, -82, -6, -99, 82, -88, -7, 58, 85, -95, 11, -38, -67, -53, 71, 92, -32, 92, -71, -23, 64, -36, -82, -10, -94, 73, -7,
+		17, -89, -28, 69, 21, -8, 49, 71, 98, -3, 43, 50, -2, -36, -95, -61, 53, 24, -61, 88, -64, -57, 59, -32, -67, 15, -3, -74, -19, -87, -100, 49,
+		6, 52, 64, 98, -92, 65, -84, 91, -96, 59, -65, -89, 70, 12, 80, -46, 66, -14, -57, 4, -37, 30, 95, 89, -83, -15, -28, 38, 34, 12, 31, 1,
+		91, -49, -8, -44, -6, -47, -48, 68, 78, -24, 1, 49, -26, 8, -39, 45, 22, 95, 6, 12, -20, 1, 17, -47, -72, -36, 62, 38, 81, 49, -61, 75,
+		-8, -12, -47, 66, 59, -28, -97, 76, -68, 41, 90, 41, -44, -52, -74, -85, -31, -29, -87, -35, -34, 62, -96, 15, -86, 61, 58, 5, -86, 8, 71, -40,
+		90, -97, -92, -24, -73, -34, -57, 14, -48, -67, 7, 83, -61, 60, -43, -92, 32, 7, -12, 46, 80, -11, 92, -17, 88, 51, -29, -68, -21, 73, 16, 42,
+		-14, 49, -96, -30, 64, -22, 57, 65, -1, 8, -99, -11, -45, -54, -7, -15, 4, -20, 63, -92, 31, 83, -25, -32, 50, 47, 99, -26, 23, -81, 95, -52,
+		21, -41, -18, 15, 55, -28, -95, -93, 80, 34, 64, -68, 62, -91, -29, 40, 48, 86, -50, -34, 41, -14, 84, 99, 22, 25, -54, 45, 49, 93, 8, 58,
+		-8, 28, 51, -69, -38, 41, -91, -49, 75, -21, 96, -41, -83, 43, 50, 63, 83, 56, 48, -79, 38, 22, 45, 66, 80, 12, 10, -26, -61, 21, 28, -58,
+		7, -36, 63, 49, 70, -86, 79, -96, -1, -25, 5, -81, -70, -74, 12, -34, -95, -16, -80, 66, 66, 49, 24, -14, 6, 48, 94, 76, -58, -82, -29, 96,
+		58, -42, -17, -26, 98, -14, 75, -20, 67, -98, 88, -4, 43, -22, 8, -80, 5, 73, 62, 52, -44, -76, -68, 32, 6, -59, 38, 34, -22, -45, 23, -31,
+		20, 4, -4, 49, 10, 16, 18, -23, 31, -74, 50, -77, -79, 58, 50, -56, -98, 17, -24, -84, -31, -38, -85, -5, -28, -74, 1, -88, 27, 75, 56, 55,
+		-8, -12, -18, 95, -99, -42, 51, -15, 2, -68, 36, 61, -81, -2, 70, -41, -62, -99, -20, -38, 84, -56, -48, -64, 51, -70, 1, 43, -74, -14, -52, -46,
+		80, 19, -81, 10, 13, -65, 99, 75, -46, -45, 7, 6, -5, -25, -92, 28, 41, -58, 17, -6, -1, 73, -97, -6, 52, 26, -56, 97, 48, 72, 67, 33,
+		-54, -31, -18, -54, -84, -98, -51, -22, 64, -65, -30, -87, 68, 26, 59, 85, 84, -80, 0, -42, -12, -10, 3, -73, -97, 18, -54, -38, 32, -27, -65, 69,
+		61, 33, -82, -81, -39, -63, 3, -32, -16, -44, -37, -79, 43, -96, -66, 75, -66, 15, 8, -29, -10, 95, -9, -36, -96, -29, -41, 38, 22, -21, 8, -87,
+		17, 84, -19, -42, -88, 83, -95, 58, 36, 28, -47, -93, 69, 77, -48, -4, 75, 71, -76, 16, 4, -17, -66, 61, 14, 59, -29, -74, 90, -13, 16, 7,
+		34, -40, -62, -22, 75, 26, -64, -2, 37, -68, -66, -8, 81, 76, -46, 23, 35, -50, 35, -66, 23, 50, -28, -52, 59, 4, 19, 32, -87, 55, -74, 91,
+		-87, -45, 48, -1, -66, -74, -18, -96, 88, 90, 34, -11, -21, 5, -50, 83, -57, -20, 63, 71, -75, -15, -26, -88, -3, 77, 23, -14, -66, 52, -60, 48,
+		98, -11, 31, 0, 64, -83, 17, -88, -41, 33, 58, 44, -73, -8, -71, 67, 21, 29, 94, 79, 51, 80, 58, 9, 86, 73, -70, 43, -27, 90, -88, -92,
+		-53, 28, -97, 55, -98, 9, 25, 32, -28, -14, 26, -34, 90, -75, -58, 82, 79, 78, 18, -73, -94, -77, -68, 72, -19, -99, -71, 76, -1, -62, -98, 86,
+		13, 25, 77, -90, -69, -83, -99, -45, -60, -8, -57, 52, -53, -86, -50, 13, -25, -23, -29, 81, 43, 71, -32, -25, -29, 53, -14, -12, -38, 53, -21, -14,
+		-42, 78, -65, 6, 62, 14, 12, -59, -31, -77, 88, 64, -58, -3, 61, -35, 11, -97, 2, -24, 1, -54, 1, 16, -50, 0, -75, -66, -52, 31, -42, -43,
+		1, 42, 77, -50, 12, -40, -24, -69, 83, -34, 70, -90, 17, -13, 24, -15, 80, -93, 95, -9, -98, -87, -41, 96, -5, -61, -71, -44, 26, -19, 30, -54,
+		-43, -75, 6, -47, -80, 95, 69, -22, 2, -61, -18, -78, -41, -51, 31, -84, -45, 26, -75, 22, -8, 91, -23, -5, 20, 19, -99, 45, -4, -63, -35, -26,
+		-99, 13, -32, 29, -60, 95, -75, 70, -27, 38, -3, -94, -85, 17, -82, -20, 67, -63, 57, -69, -82, 94, 14, -10, 4, 99, -88, 23, 94, -67, 29, 49,
+		-79, -17, -61, 11, 35, 80, -96, 65, 28, 88, 24, -4, -96, -62, -16, -93, 75, -62, 69, -41, -56, -68, -52, 10, 38, -22, -66, -77, 58, 90, -74, 80,
+		-90, -80, 50, 75, -44, -92, -93, 76, -48, -35, -81, 11, -23, -28, 11, -15, 60, -31, 74, 36, 40, 43, 79, -26, 7, 27, 3, 97, 95, 61, 67, -7,
+		-72, -42, 57, 15, -45, 84, -98, -55, 70, 90, 78, -67, -18, 28, -26, -71, -52, 86, 87, -91, -99, -45, 13, 88, -35, 86, -10, -88, -33, 44, 21, 32,
+		-8, 33, -38, 51, -78, -74, 23, -64, 50, 69, -69, -59, -84, 16, -100, 84, 62, -28, -82, 80, -73, 50, -45, -89, 57, -7, -62, -63, 36, 89, 65, 12,
+		-17, -9, 41, 33, 49, -78, -15, 53, 17, -15, 76, -45, 6, 0, 23, -35, -72, 95, 27, -65, 37, -67, -51, -49, 92, 66, -18, -46, -95, 60, -11, 26,
+		88, 10, 95, 49, 95, -53, 97, 17, 30, -14, -73, 81, 62, -45, -85, 24, -10, 1, 1, -35, 99, 64, -36, -58, -54, -10, 66, 23, 96, -53, -100, -24,
+		72, -37, -53, 29, 91, 57, 86, -88, -58, -2, 80, 58, -98, -47, -73, 12, 88, 33, -71, 35, -56, 80, 58, 89, -92, -19, -8, -77, -24, 89, 23, 66,
+		-15, -88, 13, 96, 35, 88, 64, 81, 28, -22, -88, -44, 33, -95, 34, -97, -43, 25, 99, 23, -34, -59, 86, -42, 63, -55, 84, -100, 59, 18, 99, 63,
+		70, -38, 39, 43, -99, -83, -68, -17, -1, -94, -83, -5, 80, 91, 73, -55, 1, -81, 85, 55, -36, 23, -83, 90, 50, 89, -65, 97, 78, -43, 69, 45,
+		-62, 7, 62, 68, 4, 92, 90, -38, 38, 72, 23, -50, -43, -39, -31, -65, -98, -96, 14, -97, 13, -3, 66, 85, 40, 0, 70, -49, 63, 78, -10, -33,
+		-8, 16, -93, -49, 27, -36, -98, 36, 36, -100, -39, 2, -7, 61, -93, 28, -53, 50, -48, -53, 95, 14, 46, 66, 96, 83, -16, -48, -38, -21, 97, 69,
+		49, -3, -46, -89, 81, -22, -89, 52, -4, 80, -44, 65, -45, -81, -19, 70, -100, -78, -95, 80, -21, 52, 6, -40, 62, -70, -6, 6, 21, -9, -65, -62,
+		7, 54, 98, 63, -17, 29, 38, -43, -18, 69, 68, -98, 97, 87, -12, 91, -58, 53, -3, 22, -9, 61, 36, -74, -63, 25, -62, -37, 42, -3, 25, 24,
+		-10, -57, -61, 73, -100, 75, 94, -99, 86, 58, 55, -28, -83, 13, 95, 17, -36, 97, 34, 80, 38, -41, -29, -30, -25, 50, 40, 59, -6, 56, -1, 60,
+		79, -63, -65, -5, 10, -89, 5, -32, -23, 7, -68, 63, -7, 62, 57, 39, 78, -63, 28, 80, 81, -50, 15, -61, 92, 54, 82, -23, 27, -20, 68, -44,
+		79, -45, -58, -45, 24, 67, -44, 88, 91, 70, 81, 18, 93, -47, -40, -94, -57, -52, 84, 73, -55, -29, 66, 49, 42, 40, 50, -22, -4, -72, 19, 12,
+		35, 12, -26, -100, -92, 10, 1, 40, 13, -84, -100, -2, 61, -58, 24, -44, -36, -54, -13, 34, -33, 9, -31, -2, 20, 12, 76, -64, -61, 15, -70, 83,
+		70, -72, 6, 73, 46, 13, 96, 87, 34, -52, -51, -68, 63, 46, -87, -16, -31, -69, -96, 23, 14, 91, -63, -10, 52, -50, -43, -59, -59, -99, 17, -74,
+		8, 94, 82, -61, 50, 4, -29, 56, 94, 94, 15, 58, -40, 32, -9, 86, 96, 4, 41, 86, 82, -94, -97, -32, 87, 40, -51, 40, -76, 55, 93, 5,
+		81, -14, 47, 51, 6, -88, -9, 15, -34, 25, -13, 34, -57, -45, 53, 52, -71, 71, 35, -56, -78, 15, -69, -27, -41, -96, 29, 94, 46, 50, -78, -40,
+		-94, -51, 14, 54, -37, -85, -4, -100, -64, 28, 89, 51, -83, 10, -29, -25, -96, 50, -29, 43, 32, -29, 30, 67, -37, 13, 44, -25, -67, 67, 97, -13,
+		-97, 12, 49, 33, 46, -56, -42, 88, 18, -20, -72, 23, 15, 70, 17, 34, 21, -72, 46, -32, 65, -38, -42, 72, -17, 91, 42, 33, 46, -59, 29, 47,
+		-82, -16, -60, -84, 81, 68, -40, -96, 28, 8, 15, 43, 55, 50, -3, -13, -72, 21, 87, 11, -12, -12, -57, -22, -13, 8, -18, -47, 64, 10, -84, 12,
+		-9, -24, -40, 54, 64, -93, -45, 50, -72, 89, 52, -7, -61, -29, -40, -67, 35, -72, 54, 47, 38, -44, 71, -78, -64, -64, 77, -82, -42, 42, 46, -66,
+		92, 7, -91, -5, -16, 28, 65, 35, -74, 58, -48, 44, -9, -30, -25, 83, 16, -55, 90, -13, 16, 20, -36, 68, 70, 76, 37, -92, -85, 13, -9, 50,
+		-57, 48, 61, 96, 27, 57, 18, 80, -6, -89, -13, -38, 51, -40, 84, -59, -55, -80, 17, -81, 47, -13, -70, 18, -29, 24, -86, -30, 36, 70, 82, 38,
+		-7, -69, 98, -63, 57, -59, 24, 56, -6, -11, 93, -25, -71, 94, 0, -64, -100, -19, -63, 66, -53, 72, -62, -22, -71, -12, -62, -23, -29, -53, 37, 12,
+		-75, -61, -88, 55, -55, 9, -44, -52, 74, -53, -45, 63, 36, 51, -83, -92, -9, -40, 36, -65, -44, 84, 97, -96, -14, 48, -21, 43, 6, -79, -58, 88,
+		13, 89, -94, -34, -66, -38, -98, 59, -59, 85, -64, 97, -18, 74, 32, -85, 71, -79, -85, 42, 77, -31, 16, -89, 41, 74, 80, -20, 82, -95, -77, -17,
+		-92, -9, -16, -71, 22, 50, -1, -50, 21, -17, 40, 66, 59, -94, 78, -75, 65, -88, 19, 15, -65, -28, 27, 96, 35, 28, 91, -29, 43, -17, 13, -4,
+		-88, 45, 89, -3, -46, -60, 1, -100, 40, 19, -29, -62, -71, 61, -77, 2, -32, 82, 65, -72, -93, -42, -24, 7, -44, -5, 61, -57, 87, 17, 21, -83,
+		-46, -54, -77, 24, -42, 95, -4, 86, -60, -73, 99, 58, 64, 20, 1, -100, 29, -72, -58, 84, 3, 76, 69, 1, -28, 3, -89, -37, 3, 80, -7, 6,
+		-92, -62, -3, 26, -86, 26, -49, -26, 15, 46, -79, -13, 35, -32, -25, 17, 80, -100, 58, -67, -33, 37, 8, -71, 55, 7, 64, -77, -39, 8, 21, -70,
+		-100, -46, -47, 62, 83, 91, 96, 8, -100, -53, 75, 19, 38, 19, 64, -81, -6, -19, -45, 20, -84, 53, 37, -64, -6, 38, -68, -22, 83, 29, -21, 66,
+		91, 3, -60, -91, -92, -77, 93, -61, -29, -92, -87, -75, -58, -70, -62, 75, -62, -98, -13, 38, -10, 31, -54, 33, -20, -42, 45, 20, -26, -39, 69, -18,
+		35, -71, 35, -14, 4, -80, 84, 64, 68, 29, -57, 86, 95, -68, -2, 28, 8, 1, -64, -53, 8, -2, -34, -17, -37, 50, 99, -73, 65, -31, -52, 43,
+		58, 87, -87, -14, -54, 82, 48, -11, -65, 78, 10, 9, -50, 37, 51, -85, -43, -93, -99, 96, -43, -84, 85, 39, 95, -89, 84, -13, -66, -37, -70, 69,
+		-22, 68, 74, -71, -32, 39, -8, -66, 17, -19, -1, -30, 73, -57, 59, 93, -2, 4, -72, -13, -4, 90, -73, 47, -61, -12, -14, 67, 44, 43, 19, -42,
+		-82, 92, 5, -91, -73, 24, 10, 47, -63, 89, -35, -1, 26, 7, -12, 12, -67, -85, -11, -11, 18, 8, 61, 57, 71, 94, -20, -46, 32, 23, 65, 74,
+		48, 76, 33, 68, -40, -19, 36, -77, 82, -98, -16, 58, 9, 41, -33, -66, -24, -43, -11, -70, 93, -59, -80, 13, 41, -81, -45, -80, -93, -62, -17, -13,
+		72, -62, -23, -84, -32, 65, -34, -5, 50, 8, -34, 80, 98, -68, 58, -41, -50, 11, -20, -16, -25, 67, -47, -28, 31, 21, -31, 31, -33, -46, 67, -2,
+		75, -64, 35, 45, 65, -25, 22, 38, 42, -43, -79, -45, 41, -86, -100, -9, -71, 28, 28, 81, -29, -81, 53, -66, -67, 73, -96, -13, 49, -19, -77, 57,
+		-7, 97, -78, -66, -20, -30, -100, -6, 62, 70, 27, 85, 31, -98, -68, -6, -98, -64, -40, 44, -35, 61, -67, -80, -74, -62, 30, -59, -68, -26, 72, 85,
+		69, -50, -74, 36, -45, -92, 83, 43, 77, -33, -33, -2, 23, 91, 22, 57, 99, 57, 85, 42, -43, 66, 41, -37, 4, -50, 15, -7, -6, 72, -31, -61,
+		58, -59, 52, 31, 76, -99, -70, -27, -10, 51, -66, -93, 46, -45, -1, 99, -8, -48, -22, 52, -11, 95, -9, -36, 63, 95, 82, 61, -19, 26, -32, 84,
+		-37, 26, 58, 39, 58, -68, 52, 20, 5, 74, -30, -68, -75, 75, 62, -24, -80, -24, 84, 5, 11, -100, 83, 49, -51, -77, -29, -62, 53, 8, 69, 43,
+		-33, 41, -39, 43, 70, 91, -98, -83, 39, -18, -12, -55, -77, -54, 63, 25, 40, 26, 6, 48, 34, -92, -33, -73, -65, 45, -94, 16, 15, -60, -86, -18,
+		32, -38, -31, -84, -24, -36, 27, 78, -93, 70, -11, 34, 95, 54, 19, -70, 66, -53, -41, 59, -24, 64, -9, -39, -60, 89, -45, 36, 62, -20, 54, -93,
+		59, -40, 83, -44, -44, 46, -70, 71, -14, -12, -63, 85, 21, 27, 57, 17, -15, 88, -29, 20, -12, 14, 20, 48, 96, 99, -38, 89, 28, -3, -56, 3,
+		22, 87, 50, -60, 57, -36, 88, 13, -46, 53, 37, -71, -13, 58, 90, -14, 34, 83, 63, -28, 3, -26, -27, 60, -84, -9, -17, 5, 53, 6, -43, 62,
+		91, -38, 4, 1, -37, -31, -37, 13, -80, 44, 51, 83, 96, -37, 54, 76, 62, -17, -27, 81, 44, 61, -27, -55, 7, 94, -25, -92, 69, 27, -76, -70,
+		-94, -74, -76, -15, -89, -83, -18, 61, -74, -83, -3, -17, -92, -98, 67, -60, -62, -25, 32, -42, -11, 99, 50, -5, 88, -78, -91, -46, 97, 66, -30, 16,
+		31, -34, 5, 43, -23, -52, -36, 80, 53, -28, -74, -1, 1, 37, -59, 74, 15, -65, 79, -15, 38, 33, -90, 53, 85, -25, 21, -62, -77, -25, -45, 34,
+		-14, -2, 97, 76, -25, -99, 62, 15, 69, 57, 59, -35, -83, -96, -77, -3, 27, -26, 38, 64, -38, 50, 58, 25, -33, 36, -18, 95, 92, 78, -95, 57,
+		31, 43, -3, 19, -34, -59, -13, -37, -58, -56, -70, -36, 86, -85, 89, -52, 67, 14, 21, 84, 37, 91, -17, 11, -38, 85, 77, 48, -95, -18, -73, -8,
+		-47, -64, 43, 25, -14, 57, 70, 62, -35, -6, 40, 46, -59, 20, 35, -69, -60, -97, 64, 72, -56, 53, 5, -91, -79, -18, -89, -35, 11, 74, -52, 7,
+		-64, -29, 12, -67, 90, -17, 57, 58, 41, -50, -61, 93, -13, 38, -49, -62, -25, -59, -90, 27, 21, 3, -61, -46, 76, -67, 58, 46, -61, 95, 22, 66,
+		-26, 51, -50, 42, -91, 96, -74, -66, -49, 1, -68, 18, 43, 3, 13, 34, 67, 58, 74, -19, 43, -37, 80, -83, 22, -19, -5, 84, 84, -99, -15, 30,
+		-33, -35, -14, -35, -81, 51, 67, 22, -8, -65, 59, 81, 18, -71, 74, 82, -5, -11, 28, -16, -19, 39, 76, 45, 7, -58, -3, 5, -92, -23, -53, -25,
+		-49, -71, 45, -13, -97, -22, 84, -64, -72, 22, 2, -6, 14, 46, -63, 65, 90, 65, -12, -97, -14, -29, 38, 9, -34, -90, -86, -17, -59, 57, -63, 15,
+		70, -23, -73, -73, 91, -28, 31, -91, -90, -31, -62, 73, 32, 76, -57, -97, 76, 43, 37, -91, -84, 11, -60, 36, 39, 14, -45, -9, 27, -35, 2, -39,
+		90, -39, 42, -64, 7, 0, 78, -62, -52, -40, -62, -71, 56, 49, 72, -61, 76, -39, -22, 49, 19, 52, 38, 66, 12, -76, -60, -9, 43, -77, -1, -10,
+		-38, 70, -31, 44, -77, -97, -66, 95, 69, 49, -42, 34, -52, 4, 59, 10, 50, -46, -6, 49, 83, -22, 39, -87, 65, -70, -84, -82, -92, -56, -44, -2,
+		-49, -15, -66, -18, -73, -87, 52, -79, 83, 79, 44, -71, -14, -55, 43, 80, -59, -35, 75, 94, -35, -48, -35, 40, 19, 3, -86, -89, -22, -98, -37, 58,
+		-46, 72, 47, -11, -65, -69, 91, -54, -14, 56, 15, 46, -67, 8, 19, 10, -96, -59, 49, -77, -3, -65, -17, 73, -12, 98, -17, -11, 69, 37, -36, -13,
+		-60, 18, -34, 9, 42, 60, -47, 53, -44, 24, -74, 70, -89, 41, -49, -13, -61, 62, 2, -13, 36, 80, 68, -16, 56, 25, 30, 73, 22, 20, 44, 59,
+		56, -75, -91, 99, 19, -24, 96, -66, -2, 17, 67, 94, 16, 90, -60, -97, 11, -68, 48, -86, -60, -68, 68, -12, 80, 40, 47, 59, 95, 7, -23, 17,
+		1, -31, -53, 19, 21, 89, -36, 85, 0, -84, -69, 73, 25, 73, -95, 50, 39, -56, -70, 74, 91, -39, -71, 16, 65, -88, 0, 59, -17, -58, -35, -95,
+		-69, -24, 49, -75, -64, 67, 8, 79, 12, -5, -63, -10, -23, 28, -96, 31, 26, 4, -44, -59, 81, 18, 52, 42, 20, -86, -58, 76, -7, -42, 55, 35,
+		-94, 72, 93, -85, -76, 72, 3, -76, -96, -21, -93, 95, -85, 13, -47, -26, -100, -4, 6, 93, 60, 76, -95, 63, 59, 52, 29, -72, -17, -70, -96, -90,
+		4, -73, 49, 90, 92, 22, 80, -31, -23, -47, -46, -65, 38, -81, -99, -76, 59, -87, 18, 58, -73, -5, 0, -40, -62, -100, -87, 53, 46, 76, -5, -29,
+		73, -22, -51, 14, 44, -5, 87, 95, -5, 44, 98, 95, 83, 77, 67, -76, -54, 43, 52, 8, 89, 21, -97, 25, -94, -62, -94, 46, -80, -51, 32, -14,
+		-17, -83, 74, 9, 11, -97, -37, -34, 66, -22, -86, 91, -20, 61, -2, -88, 54, -30, 39, -23, 27, -36, 86, -22, 75, -29, -88, -32, 35, 21, 88, -86,
+		-76, 87, -16, -5, -32, 86, 70, 5, -91, 31, 46, -73, 4, 22, 97, 64, 1, -94, -54, 88, -21, 85, -39, -36, 93, -35, 28, 58, 24, -60, 43, 72,
+		-32, 84, 69, 63, -6, -26, 35, 24, 33, -53, 8, 94, 98, 76, 0, 94, 84, -4, 79, 37, 31, 33, -77, 87, 92, -28, -76, -77, 70, -54, -60, 74,
+		-21, -36, 27, 98, -60, -17, 15, 9, 25, -88, 27, -55, -61, 48, -78, -42, -54, -49, 32, 72, 68, -89, 5, 75, -47, -99, 77, 81, 3, -23, -97, 84,
+		20, -6, 60, -43, -89, 13, 30, 27, -82, 53, 31, -54, -83, -24, 89, -69, 18, -61, 25, 25, 10, 68, 75, 97, 58, 18, 16, 41, 30, -63, -35, 45,
+		-82, -88, 94, 8, -96, -81, 62, 2, 75, -79, -71, -5, -43, 97, -64, 37, -47, -42, 0, 12, 83, -93, 11, 66, -35, 66, -94, -94, 45, 40, 41, 86,
+		-19, 26, -73, 8, -84, -4, -55, -3, 12, -47, 78, 71, 14, 61, 12, 8, 46, 41, 34, 30, 95, 34, 85, -4, 39, 64, -41, 3, -21, -13, 41, -75,
+		-9, 29, -90, -67, 29, 87, 72, 10, -26, -46, 80, -5, 92, 7, -80, -22, 39, 18, -69, -83, -18, 79, 53, 58, -82, 66, -24, -21, 81, -11, -70, 40,
+		-41, -42, -24, -18, 72, 56, 19, -73, -52, 26, 15, 48, -32, 55, -74, 92, -88, -94, 31, -24, 26, 76, -61, 34, 74, -53, 31, -82, -30, -55, 38, -92,
+		83, 57, 83, -55, 54, 25, 81, 1, -70, 56, -15, -81, 16, -29, -65, -20, -31, -17, -22, 43, 5, 74, 65, 3, 1, 68, -15, 19, 82, -75, -1, 95,
+		-78, 79, -60, 7, -61, -97, -68, -91, 29, -60, 34, 62, -96, -74, -68, 68, -58, -7, 37, -84, -82, -14, 0, 26, -55, 85, -12, 80, -28, -32, -54, 39,
+		73, -3, -2, -70, 61, -96, 42, 63, 61, -78, 42, -1, -57, -54, 84, -89, -74, -27, -25, -80, 41, -21, -96, 84, -48, -28, -34, -63, -84, -100, -33, 55,
+		91, 37, 24, -56, 88, -13, 3, -59, 29, 98, -58, 29, 93, 43, -83, -59, -41, 12, -31, 83, -64, 42, -32, -76, 0, 46, -80, -50, -100, -83, 3, 47,
+		4, 85, 85, -10, -19, 88, -69, -10, 70, -75, 5, 90, 53, 88, 10, -81, 58, 85, 49, -42, 29, 99, 36, -59, -9, -41, -59, 20, 22, 97, 35, 58,
+		-22, 87, -99, -24, -17, 78, 76, -53, 20, 28, -52, -73, -41, 26, -35, 11, -89, -18, -19, -35, -21, -95, -21, 90, 11, -98, -10, -82, 39, -4, 59, 76,
+		-75, -57, 23, -71, 25, 90, -72, -52, -66, -75, 2, -67, 28, 83, -26, -31, 43, 52, 1, 38, 12, 67, -99, 2, 68, -82, 72, 92, -67, -11, 30, 21,
+		3, -13, 63, -55, 18, -46, -34, 7, -68, 30, -95, -46, -59, 76, 11, -71, -47, 34, 0, -20, -40, -57, -87, -77, -32, 8, 64, -29, -69, 15, 69, 1,
+		12, -44, -85, 93, 99, -75, 1, 25, -8, -73, 11, -70, 10, 8, -7, -46, -15, 39, 1, -76, 61, 8, 3, -79, -57, 60, 35, -42, -60, 75, -82, -60,
+		96, 56, -31, -19, -59, -13, 78, -35, 71, -53, 96, -5, 23, -74, -40, -74, -96, -44, -59, -5, 28, 72, -21, -7, -9, 74, -73, -85, -52, -87, -27, 30,
+		-69, -23, 98, 78, -54, -21, 27, -84, 41, -36, 43, 18, 11, 44, 98, -93, 22, 88, 18, -5, 79, 58, 86, -88, 7, 64, 41, -63, -85, 78, 94, -20,
+		-38, -5, 63, 21, 13, -10, -45, -89, -81, 58, -96, -59, 42, -84, -16, 11, 91, -90, -74, -35, -19, -100, 38, 5, -75, -87, 19, -11, 2, 56, 48, 6,
+		-39, 8, -56, 94, -25, -70, -66, 5, -18, -84, 24, -74, -19, 0, 96, -58, -21, 40, 1, -3, 37, 81, 60, 67, -95, 83, -63, -41, -28, 93, -22, -88,
+		-60, -84, -67, -66, 12, -31, 76, 86, 96, 37, 13, -47, 3, -64, 70, 20, 68, -77, 25, 93, -79, -79, -81, 86, -97, 93, 15, 33, 47, -23, -5, 21,
+		-75, 90, -61, 63, 0, -93, -7, -73, -97, 89, 51, 25, -62, 19, -53, 90, -86, -65, -30, 82, 11, 84, -41, 53, -43, -52, -39, 34, -40, -75, 41, -3,
+		-87, 33, -1, -24, -12, -77, 25, 26, 90, -31, 79, -61, 55, 25, -27, 85, -7, -55, -60, -63, -79, -57, 63, -52, -84, -60, 47, -92, 10, 19, 60, 21,
+		70, -69, 4, -75, -21, 17, 62, 87, -88, -76, -46, 88, -59, 3, 52, 89, -82, -88, -6, -34, 33, 67, -17, -36, -59, 70, 51, 24, -85, 59, -85, 83,
+		-96, 26, 58, 5, -30, -83, -46, -5, 52, -88, -16, -26, 11, 21, -32, -76, -67, 28, 96, 80, 30, -18, -40, 54, 93, 3, 99, -51, -7, -16, -77, 71,
+		82, 24, -78, 38, 4, -24, 15, -73, 74, -96, 96, -9, 27, -28, -31, 67, -60, 94, -58, -99, -75, 88, 28, -71, 12, 62, 15, 52, 71, -61, -30, 68,
+		-11, 32, 95, -97, 39, -61, 75, 58, -77, -7, -78, 71, -66, 44, -32, -54, -60, -36, -13, 67, 63, -50, 53, -77, 59, -85, 63, 87, -28, 13, -33, 92,
+		0, 69, -81, 92, 41, -45, -86, 88, 26, -36, 64, -35, -10, -5, -86, 12, -46, -48, -82, 13, -25, -97, 36, -72, 29, 78, 12, -85, -26, 61, -10, 47,
+		41, 73, -51, 49, 53, 88, 28, 61, 1, 93, 32, 18, -6, 9, 25, -15, -6, 74, 79, -99, -22, 20, -30, 27, -46, -59, -6, -37, -72, -72, -40, -24,
+		-97, -30, 1, -40, 26, 68, 42, 67, 17, -67, -73, -64, -65, -27, 79, 95, -21, 59, -7, -23, 42, -25, 97, -45, -46, -29, -79, -44, 57, 72, 54, -43,
+		-72, 60, 57, -83, 57, -100, -38, -91, -83, -46, -33, 27, -28, 44, 91, 50, 2, -73, 27, 18, 14, 0, -47, -29, -9, -41, 9, 69, -62, 37, -47, -77,
+		17, 12, 32, 1, -86, -42, 93, -67, -47, 47, 28, -90, 98, 33, -79, -88, 36, 71, -47, -62, 16, 79, 21, -81, 91, -48, -16, -73, 41, -31, 2, 49,
+		39, 51, 92, 88, -66, -2, -2, -97, -65, -33, 40, -94, 42, 69, -42, 96, 46, -36, 26, -80, -79, -98, 91, 51, 96, -90, 74, -4, -23, -73, -76, 98,
+		37, -85, -33, 89, -40, 10, -12, 48, -58, 94, -58, 15, 0, 28, 71, 18, -10, -60, 72, 1, 36, 86, -84, 68, -76, 66, -76, -18, -79, 44, 52, 46,
+		-49, 50, 97, -15, -33, 65, -19, -29, -19, -65, 32, 16, 84, -94, -7, -88, 58, -86, 83, -35, 83, -38, -39, -62, -22, 96, -29, 28, -77, 28, -27, 49,
+		90, 43, 73, -55, 17, 45, 37, 70, 77, 83, -1, -68, 29, -8, 93, 47, -50, -35, -4, 86, -19, -81, 98, -49, 34, -27, -40, 91, 85, -78, 54, -59,
+		-57, 9, -2, 23, -37, -40, -18, -47, -25, -69, -89, 90, 31, -57, 17, -72, -94, -87, -42, 93, -86, -90, 20, 50, 70, -79, -57, -68, -96, -68, -32, 79,
+		-45, -82, 49, 31, 12, 54, 39, 43, 40, 54, -33, -32, 60, -24, 16, 24, -46, 78, -53, -24, 82, -48, 83, 57, 23, -64, -74, -99, 11, -7, -30, 93,
+		-28, 46, -98, -11, 5, 68, -88, -37, -61, -18, -63, -81, -66, -70, 43, -97, 4, -29, 49, -77, -98, 31, 54, 8, 81, -56, -82, 0, 65, 75, 16, 79,
+		98, 75, 51, -15, 38, 54, 25, 68, -68, -45, -29, -46, 94, -76, -27, 36, -12, -79, 13, -55, 98, -56, -97, 33, -47, -40, 37, 82, -22, -36, 89, 95,
+		18, 46, 60, 36, -7, -9, 14, -2, -33, -73, -96, -35, 74, 40, -42, -29, -92, 52, 26, -70, 7, -27, -76, 93, 55, -98, -69, 80, 98, 35, 3, 50,
+		93, -64, -66, -98, 59, -21, 76, 46, -98, 73, -30, 64, -46, -21, -15, -86, 11, -30, -78, 3, 74, -59, 57, 86, -84, -81, -49, -66, 12, 77, 33, 28,
+		-31, -42, -35, 34, 83, -15, 91, -95, -75, -82, -19, 80, -71, 76, -6, -60, -85, 52, 3, -4, -86, 63, 98, -60, 13, 29, -7, 95, -64, -32, 81, -19,
+		4, -70, -81, 73, 23, 94, -6, 26, -20, 41, 53, -99, -21, 37, 77, 96, -24, -15, -9, -76, 71, -49, 76, 38, -17, 11, -69, -26, -24, 78, 53, -86,
+		-25, -3, -94, -16, 30, -99, -39, -98, -100, 45, 84, -89, -32, -21, 95, -72, 95, -54, 24, 33, 11, -79, -35, 51, 73, -38, 60, 66, -47, 79, -29, 38,
+		-81, 49, -78, -44, 79, -64, -72, 6, 73, -43, -79, -58, -81, 51, -77, -59, -75, -43, 46, -22, 7, -2, 36, -22, -14, 3, -31, -94, -48, -32, -95, 17,
+		-31, 38, 71, -48, -95, 31, 72, 70, 94, 28, 84, 38, -5, 43, -74, -2, 74, 17, -11, -80, 73, 63, 9, -99, -10, -92, 35, 68, 82, 45, -69, -75,
+		-42, -13, -18, 87, 85, -22, 79, -47, -13, -57, -23, 72, 31, -67, -83, -39, 54, -9, 16, -40, 5, 84, -28, 17, 82, -50, -41, -35, 36, -81, 17, -42,
+		98, 25, 67, 1, -77, -65, 82, 49, 12, 54, -90, -75, -86, 99, 98, -5, -85, 19, 23, 56, 22, -80, 57, -11, -48, 80, 6, 47, -66, -50, 64, 71,
+		-93, 44, -54, -40, -94, -28, -86, 2, 23, -67, -52, 21, 18, -11, -70, 82, -67, 72, 36, -37, 97, -99, 60, -64, 0, 35, 30, 82, 27, 61, 88, -79,
+		-62, 70, 97, -99, 43, 0, 37, 98, -4, -91, 34, 80, -20, -35, -5, -2, 0, 91, 3, 53, 41, 48, -2, 14, 45, 14, -29, 46, 12, -98, 98, 12,
+		-30, 41, 2, 20, 96, -16, 30, 44, 20, 28, 45, 5, 1, -27, 2, 53, -10, 2, 81, 41, 55, -99, -45, -100, 51, 57, -80, 2, -33, 69, 95, 46,
+		63, 15, 28, 47, 49, 47, 41, -74, -74, 13, -99, -47, -32, 5, -100, 32, 13, 0, -83, 47, 99, 53, -92, -71, -58, -26, -5, 15, -3, -17, -65, -87,
+		-35, 84, -2, 13, -47, -66, 20, -56, -77, -57, 95, -45, -87, 91, 26, -87, -87, -12, 58, -60, -71, 77, -39, -99, 22, 20, -29, -91, -55, 59, -66, 5,
+		-89, -50, -43, -68, 14, -29, 49, 60, 74, -11, -77, -49, -93, 49, 66, 21, -87, 25, 68, 12, 89, 50, -4, -64, -23, 3, -51, -49, 49, -14, 0, -59,
+		-89, 58, -54, -37, 29, -88, -43, 20, -28, 81, 59, 74, 61, 80, -44, -41, 17, -55, -51, -71, -38, 39, -69, 16, -96, 12, -10, -10, 27, -44, -65, -7,
+		-39, -7, -99, 14, 48, -87, -49, 72, 8, 68, -79, -100, 39, 22, -77, 16, -30, 34, -47, 51, 14, -85, 12, 34, -83, 69, -62, 96, -2, 35, 53, 42,
+		-34, 31, 28, -74, 14, 34, -54, 63, 4, 17, -64, 42, -51, -3, -70, -39, 87, -61, -10, 4, 35, -49, -92, -32, 58, -34, -85, -63, 32, 27, -69, -28,
+		-40, 76, 11, 60, -80, 11, -82, 96, -16, 24, 64, -24, -49, -11, 53, 93, -74, 55, 11, -53, 66, -92, 23, 80, 55, 27, -55, 42, -41, 37, -54, 38,
+		37, 41, 84, 12, -52, 41, 96, 19, 92, -49, -51, -62, -51, 1, 73, 34, 38, 12, -40, 70, 55, -74, -89, -83, -6, 96, 59, -79, 59, -51, -35, -40,
+		51, 46, -13, -94, -55, -93, 95, -9, 58, 66, 38, 2, 36, -51, -62, -57, 50, -93, 76, -66, 1, -68, 63, -54, 66, -75, 92, 94, 48, 58, 64, -27,
+		-53, 43, -38, 97, -43, -51, -28, 93, -28, 15, 46, -32, -18, -24, -59, -34, -27, 87, 77, 3, -51, -39, 39, 45, -37, -27, 85, -71, -66, 60, -60, 45,
+		26, 98, 17, 43, 15, -57, -84, 93, 36, -98, 68, -17, -47, 35, 56, -53, 43, -60, 90, 3, 98, 79, -38, 59, -70, -81, 69, 73, -63, 55, 49, -5,
+		51, 38, 79, 93, -11, -89, -25, -22, 92, -60, -44, 36, -14, 62, 62, 74, -86, 95, -5, -83, 73, -46, 66, 91, 12, 73, 42, -4, 14, 11, -41, 97,
+		-67, -80, 60, 39, -69, 48, -36, 20, -96, -30, -82, -21, -19, 23, 82, -81, 64, 19, -91, -24, 41, -17, -100, 49, -81, 40, -61, -15, -72, -71, -31, 59,
+		-61, -16, -67, 51, 65, 82, 82, 42, -26, 65, 61, -32, -5, -39, 16, 81, 40, -34, -71, 93, 51, -54, 42, 9, 65, 31, -81, -2, 96, 62, 3, -12,
+		-39, -48, 55, 96, 16, 75, 22, 70, -64, -91, -86, -84, 96, -15, -3, 86, 67, -3, -5, -47, 9, -100, -81, 43, -77, -62, -37, 64, 8, 1, -33, 81,
+		-78, 94, 82, -83, 4, -28, 22, 27, -56, 36, 62, 63, -89, -37, 15, -80, -14, 43, -99, -96, -77, 73, -4, 1, 37, 49, 60, 37, -26, 6, 74, -97,
+		79, -10, 64, 14, -90, -11, 8, 96, 31, -94, 58, -45, -7, 86, -1, 26, -73, -54, 13, 38, -15, 0, -19, -15, -68, 28, 53, 61, 59, 64, 54, 83,
+		-6, 30, 83, -18, -91, -9, 35, 77, 15, -37, -33, -17, -97, 5, 11, -12, 20, -54, -80, 37, 53, 9, -58, 62, 47, 71, 77, 72, -31, 1, 68, 98,
+		-82, 24, 55, -40, -99, -87, 93, 20, -17, -99, -61, -79, 31, -99, -16, -100, 51, 53, -56, -85, -61, 11, -15, 85, -78, 72, -91, 50, 85, -90, 41, -34,
+		-85, -41, 39, -4, 54, 12, 62, -94, -68, 58, 84, -95, -39, -80, 78, -89, 96, -53, 2, 68, 5, 83, 85, -23, 76, -72, -98, 30, -61, 5, -45, -2,
+		20, -17, 26, -18, 65, -93, -28, -75, 35, -81, -80, -76, -31, 5, 98, -49, -66, -76, -74, -30, 33, 91, -68, -33, 32, 75, -16, 44, 96, 15, 12, 94,
+		68, 14, 63, 47, 14, 44, 8, 79, 25, 67, 32, -91, 38, 7, -2, -92, 59, -23, -12, 32, -74, 83, 11, 4, -82, -88, 66, 97, 6, -53, 56, 93,
+		-28, 85, 0, -48, 49, 21, 76, 68, 30, 56, -55, -1, 35, -92, 16, -27, 65, -54, 50, -75, 23, -27, 14, -5, 91, -89, 25, 80, -80, 41, 59, -66,
+		-48, 3, 78, -28, 92, -83, 73, -20, -53, 53, -31, -95, 51, -5, -45, 43, -41, 42, -100, -76, 16, -52, -24, -59, -96, 98, -44, 35, 3, -68, 56, -34,
+		-13, -23, 19, -83, -84, -91, 75, 40, 66, 88, 50, 99, -4, -78, -65, 57, 7, 5, 68, -39, 54, -13, -58, 1, 41, -82, -14, 93, -41, -11, -56, 27,
+		53, 49, 42, -95, 74, 63, 46, 82, -30, 14, -55, -31, -3, -40, 23, 92, -11, 83, 89, -40, -66, -33, 60, -100, 44, 68, 94, 76, -3, -26, -68, 21,
+		-69, -75, 93, 81, -48, 80, -2, 0, -90, 71, -47, 73, 75, -69, 65, -49, 5, 52, 4, 89, 17, -54, 28, -14, 67, -44, -56, 47, -29, 29, 80, -7,
+		9, -71, 49, 73, -94, 12, 16, 92, -22, 86, 74, 6, -48, 41, -55, -67, 52, -80, 67, -62, -34, -39, 53, -27, -9, 44, 17, 12, 53, -67, -98, -58,
+		-2, -37, -3, -67, 5, 36, -2, -85, -7, -80, -11, -37, -2, 95, -28, 48, 85, -30, -24, -31, -99, 34, -98, 29, -33, -72, -41, 81, 79, 34, 4, 20,
+		-56, -88, -5, -80, 58, 71, -85, 71, 8, 41, 4, -24, 91, 47, 35, -89, 44, 98, -63, -86, 69, -9, 19, -87, 16, 99, 15, -49, 84, 16, -7, 95,
+		-78, 99, -20, 25, 56, 39, -79, -50, -42, -9, -7, -31, 25, -91, 28, -76, -48, 72, 14, -72, 51, -30, 90, -36, 72, -25, -97, 49, 44, -15, 19, 71,
+		8, 38, 71, -14, -83, 88, 27, 40, 28, 33, 68, 56, 30, 70, -4, 64, -50, -85, -65, -92, -75, -77, -87, 45, 6, -9, 78, -46, -7, -40, 25, -4,
+		36, -79, -87, 95, -61, 79, -83, -48, 9, -21, 58, -85, 33, -12, 59, 23, 89, -13, 70, -54, -60, -92, 88, -6, 58, 51, 3, -21, 49, 91, -40, -17,
+		97, -75, -30, 36, -68, -61, 28, -45, -91, 87, 69, 6, 86, -47, 66, -96, -3, 45, -59, -82, 88, -69, 40, -92, 62, 35, 1, 62, -20, 96, -36, -30,
+		-34, 0, -16, 82, 60, -35, -16, 64, -52, -6, -2, -7, -66, -83, -85, -65, -46, -33, -49, 90, 29, 8, -40, -50, -64, 14, -65, -98, 64, 41, 77, -75,
+		16, 92, -58, -33, -93, 26, -36, 22, 94, 92, -90, 72, -82, -30, -39, 54, -83, 23, 38, -60, -64, 20, 70, -80, -15, -64, 61, 26, -91, -33, -67, 47,
+		14, -88, 22, -33, -51, -83, -17, -32, 34, -42, -18, -82, -6, -43, 8, 85, 58, -30, 4, 81, 58, 40, -46, 30, 29, -91, 66, -4, 73, 10, -2, 60,
+		-16, -18, -91, 75, 24, -96, 45, 87, -79, 21, -31, -98, 19, -95, 88, 45, -14, 85, -13, 84, -14, 15, 68, 52, -88, 43, 52, -100, -83, -45, -41, 55,
+		-75, -63, -53, -23, -67, 91, 84, 44, 60, 66, 6, 28, 44, -38, 28, 49, 1, 88, 85, 86, -1, -14, -52, -18, 60, -35, -11, -70, 26, 99, 4, 81,
+		-23, 42, -76, -48, -21, 55, -77, 52, 93, -60, -7, 2, 48, 7, -39, 44, -79, -56, -53, 79, -68, 94, -69, -48, 82, 87, 24, 6, -65, -93, -63, -97,
+		-72, 50, -100, -45, 12, 23, -58, 59, -10, 7, 92, -63, 4, 90, -93, -88, -53, 10, 37, 18, -67, 22, 68, -96, -55, 54, -76, -99, 95, 89, -30, 67,
+		84, -75, 85, -55, -83, -37, 1, -15, -30, -53, -62, -47, 65, 15, -39, 8, 0, -55, 98, -86, 61, -67, 9, -64, 15, 3, -48, 80, -12, -94, -24, 48,
+		-70, 72, 54, 47, 14, 69, -43, -89, -61, -72, 50, -5, -77, -28, -50, -24, -58, 22, -11, 56, -55, 8, 41, -72, 18, 3, -99, -53, 41, -56, 21, -61,
+		87, -70, 49, 0, -28, -22, 64, -9, 38, -53, 27, -1, -100, 81, 84, -21, 31, 64, -76, -55, -15, -8, 14, -57, -56, -7, 43, -96, -42, 16, -68, -91,
+		9, -84, -55, 83, 23, 36, 84, -98, 5, 32, 49, -61, -78, -63, -20, -77, -30, 78, -99, 9, -7, 33, 6, 19, 4, 99, 50, -47, -11, -62, -53, -28,
+		-49, 22, 63, -36, 24, 22, 79, -19, -84, -70, 5, 46, 86, -71, 25, -94, -48, -39, 81, -35, 89, -84, -87, 13, -28, -73, 82, -84, -18, 0, -48, -95,
+		-34, 15, 12, 10, 73, -40, -71, 63, -74, -35, -83, 45, -23, 4, 80, -40, 91, 8, -86, 28, -24, -40, 50, -70, -80, 52, 1, -28, 65, -78, -5, 18,
+		84, 13, -16, 78, 74, 90, 35, -32, -7, 82, 72, 72, -78, 83, 50, -74, 76, 95, -46, 46, 83, -25, -90, -58, -92, -41, -53, -30, 39, -87, 6, 86,
+		23, 16, -97, 12, 14, 43, -14, 75, 94, 96, 87, -65, -100, -59, -31, -32, -56, 6, 59, 98, 79, -53, 98, -68, 54, -97, -44, -92, -29, 60, 61, 48,
+		11, -65, 29, 55, 81, 97, 3, -24, 77, -59, -50, 29, -45, -70, -49, 45, 84, 16, 90, 82, -14, 52, 80, 70, 9, 59, 79, 94, 64, 59, 56, -4,
+		-26, -14, 19, 35, -38, -71, 24, 31, 48, 36, 96, 18, -57, 98, 53, 86, -78, -18, -47, 91, -26, -76, -97, 24, -20, -84, -75, -80, -78, 10, -38, -8,
+		-57, 17, 47, -15, 63, 3, 33, 4, 91, 71, 34, 12, -39, -57, -28, -22, -70, 74, -11, -3, -69, -20, 80, 56, 28, 8, -99, 91, -7, -12, -73, 44,
+		61, -45, 36, -31, 66, -42, 18, -12, -17, 59, -7, 18, -64, 21, -92, -88, 13, 13, 42, 53, -30, -25, -79, 7, -7, -85, 24, -96, 90, -83, -10, 3,
+		24, 41, -35, -66, -52, 57, 28, -16, -22, 18, 27, -5, -69, 35, 22, 77, 97, 45, 48, 7, 86, -7, 80, -67, 22, -69, -22, 71, -37, -22, -87, 86,
+		1, 74, -54, -5, -51, 22, 90, -22, -69, 36, -88, 57, 43, -62, -92, -51, -68, 38, 26, 66, -50, 12, -74, -37, -19, -32, -26, 59, -69, 72, -32, 97,
+		-55, -21, 38, 72, 16, -47, -9, 96, 50, 17, 58, -87, 44, 11, -46, 29, -61, 77, 69, 21, 16, -79, 42, 83, 11, -22, -16, -93, -38, 94, 75, 72,
+		-72, 46, -39, -25, 9, 90, -84, -10, 15, 50, 77, -99, 15, 12, -99, -97, -21, -25, -100, -31, 33, 14, -64, 62, -19, -6, -68, 72, -92, -30, 30, -73,
+		-13, 9, -50, 97, 33, -12, -39, 59, -5, -51, -5, 6, -56, 85, -61, 63, -62, 16, 25, -29, 37, -95, -3, -30, -1, -51, -27, -12, -27, -4, -53, -73,
+		-8, 13, -24, -92, -7, -86, 44, -86, -54, 72, -78, -41, 65, -3, 83, 61, 47, -92, -10, -34, -37, 6, -87, -32, -59, 80, 93, 14, 33, -25, -33, -44,
+		-94, 80, -66, -22, -40, -76, -89, -7, 61, -80, -49, -19, 32, 96, -83, 12, 55, -26, -24, 41, -60, -6, 37, -9, 69, 25, 83, -48, -7, 13, 58, 0,
+		16, -72, 91, -22, -79, 92, -89, 62, 47, -90, 21, 14, -36, -66, -1, 83, -36, -52, -28, -4, -42, -73, 29, -37, 81, 3, 79, 66, 17, -19, 21, 75,
+		53, 98, 89, 82, 56, 87, -75, -53, -34, 77, 84, -84, -26, -45, -35, -57, 96, 32, 86, 23, 87, 83, -37, 46, 99, 81, -76, 23, 40, 47, -18, 87,
+		62, -31, 95, 8, 21, 72, 36, 77, -63, 77, -27, -12, -25, -22, -38, -89, 69, 74, -62, -25, 79, -34, 32, 75, 83, 4, 14, 78, -18, 20, 86, -9,
+		99, 26, 83, 76, -40, -40, -71, -20, 62, -54, 19, -54, 20, -89, 84, -15, -89, -73, -14, 2, 46, 16, 96, 85, 46, -60, 53, -50, 45, -72, 82, -30,
+		-72, -82, 18, -58, 64, -65, -24, 63, 69, 64, 38, -37, -99, 39, 4, 13, 79, 13, -85, -93, -74, -85, 78, -52, -83, -61, -93, -52, -93, 93, 60, 23,
+		-81, -8, -83, 46, 22, -78, 60, -64, -11, 26, -6, -57, 62, -41, 47, -86, -21, 31, -90, -73, 87, -24, 25, 92, 3, -69, -55, 91, 20, 34, 55, -54,
+		-29, -89, 30, -66, -46, 27, -37, -97, -32, -66, -65, -92, 98, 49, -16, 37, 59, 43, -66, -16, -25, -12, -58, 74, -46, 42, 48, -76, -50, 94, 45, -91,
+		51, -75, 3, -23, -31, -99, 61, -74, -20, 78, 52, -67, 22, -61, 38, -9, 51, -6, 84, -58, -66, 73, 39, 18, 73, 9, -42, -93, -94, 99, -36, -50,
+		-27, -54, 63, 14, -15, 69, 83, 94, -74, 2, 21, -15, -77, -35, -90, -62, 88, 23, 20, 14, 75, 39, 31, 96, -70, -89, 21, 84, -15, -87, -1, -71,
+		-68, -9, 36, 4, -48, -45, -40, -79, -13, 40, -95, 90, 78, 90, 56, 86, -87, 2, 51, -64, 5, -78, -52, 68, -76, -76, 84, -7, 58, -10, 98, -78,
+		-68, -52, -57, 11, -32, -100, 43, -59, -98, 25, 85, 27, 11, 58, 74, -13, 26, -17, 30, -42, -16, -56, -82, -18, 90, -15, 57, -77, 95, 37, 98, 68,
+		-35, 42, -41, 36, -41, -56, 77, -36, -23, 73, 90, -51, -75, -3, 99, 49, 27, 4, 95, 99, -25, -88, 86, 10, 25, 79, 43, 34, -55, -39, 72, 11,
+		-73, -55, -15, 32, -13, 41, 19, 90, -60, 38, 88, -98, -30, -67, -76, -11, -18, 55, 50, -81, -55, -87, -57, 84, -9, -23, 14, 60, 81, 79, -15, -11,
+		13, 47, 50, -79, -9, -76, -24, -43, -28, 62, -69, -30, -29, 7, 33, -61, -63, -24, 82, -28, -41, -57, 65, -29, -51, -61, -42, 72, 29, -15, -90, -11,
+		5, -51, -12, -30, -89, 67, 28, 93, -18, 0, 58, -93, 51, -12, 18, -66, 16, 68, -70, -74, 82, -72, -15, -79, 30, -99, -66, -16, -96, -16, 31, -79,
+		-56, 58, 25, -67, -50, -52, -46, -80, 70, 70, 86, -64, 54, 64, 0, 48, -31, 42, 0, 21, 50, 41, -55, 26, -83, -16, -27, -56, -58, 47, -77, 83,
+		-8, 79, 32, -44, 63, -99, -10, -82, 33, -61, 39, 58, 46, 0, -54, 61, -69, 33, -32, 39, -32, 23, 18, -21, 25, -3, 24, -35, 82, 58, 30, -75,
+		-31, -60, 68, 33, -34, 89, -87, -97, 71, 67, 4, -19, 0, 69, -23, 53, -73, 50, -6, 45, -100, 75, -36, -50, 4, -77, 49, -47, -85, -44, -76, 57,
+		-25, -83, 91, -50, -93, -7, -40, -74, -55, -3, 96, 42, 15, 14, -27, -97, -27, -60, -87, -49, -88, -77, -37, -33, 6, 38, 88, -19, -65, 87, -43, 77,
+		-8, -46, 19, -65, -11, 36, 81, -36, 50, -91, 48, -16, 0, 87, -20, 46, -23, 10, 15, 10, -98, 94, -30, 98, -44, -13, 22, -77, -96, -57, -26, 22,
+		-17, -66, -96, 21, 21, -94, -10, -45, -25, -10, -85, -47, -59, 26, -7, -71, 81, 77, 30, -83, 97, 24, 72, 8, 72, 62, -84, -29, 67, -99, -55, -31,
+		91, 16, 89, -23, 45, 48, 15, -81, -20, -67, 4, -83, -54, -60, -49, 65, -44, 80, 25, 10, -30, -90, -85, 52, 55, -82, -55, 87, 39, 0, 70, 61,
+		-53, 4, 35, -89, -95, -61, 39, 18, 72, -26, 43, -8, -95, 76, 37, 93, -47, -20, -83, 62, -9, 36, -53, -52, -18, -52, 87, 61, -49, -58, 66, 35,
+		84, -71, 48, 91, -14, -95, -69, 25, -77, 20, 6, 34, 38, 22, 26, 79, 83, 28, 91, -77, -19, -64, 60, -100, 83, 76, -66, -91, 7, -58, -86, 81,
+		26, 43, -65, 46, -54, 30, 12, -74, -29, 74, -64, 64, 62, -37, 36, 32, 96, -10, 33, 39, 49, 20, 5, 35, 95, -49, 0, 47, -38, 57, 94, 60,
+		-5, -69, -19, -37, 30, 9, -89, 32, -16, 85, -42, -28, 17, -91, 38, -13, -34, 17, -59, 65, -60, 31, 28, 42, -2, 72, -80, -30, -61, 37, 60, -99,
+		-27, -90, -64, -31, 85, 23, -71, -37, 45, -85, 78, -24, 34, -77, -89, 31, -19, -58, 78, 7, -98, 61, 75, -2, 83, 49, -7, -70, -12, 88, -70, 34,
+		99, -18, -78, 79, 84, 87, -27, 97, -92, -96, 73, 21, 83, 73, -86, -47, -76, -24, -15, -69, -100, 10, 96, -24, -88, 37, -91, 73, 84, -76, -81, 19,
+		-20, -10, -1, 24, -64, -89, 79, -21, -88, -100, 48, 1, -16, 51, 35, 37, -71, 14, -97, -37, -88, -95, 54, -81, 21, 88, 46, -69, 91, -85, 34, 26,
+		25, -49, 55, -69, -68, -100, 26, 36, 78, 91, -5, 2, 81, 16, -80, 85, 76, -30, -95, 19, -47, 23, 4, 68, -7, -11, -69, -24, -14, -89, -47, -72,
+		-75, -86, 11, 53, 45, 70, 21, 2, 32, 96, -80, 31, 36, 0, 9, -36, 86, 29, 61, -11, 37, 75, -13, 29, 21, -56, -99, 50, 59, 1, 68, 36,
+		-10, -12, -27, -34, -63, 31, 46, 56, -22, -58, -40, 5, 17, 35, -89, -34, 78, -99, 26, -97, 34, -48, -56, 25, 43, -85, -6, 43, 1, -68, 55, 50,
+		-90, 22, -12, -85, 41, -3, 68, 71, -52, 34, 2, 3, -38, 72, 80, -48, 28, 11, 77, 35, 93, -75, 11, 87, 93, -16, -4, 4, -73, -79, -61, -17,
+		-83, -67, -56, 11, 51, 24, -91, 79, -92, -41, -71, -41, 16, 36, 94, -90, -68, 21, -3, -8, 29, -62, 80, -45, 82, 50, 16, -3, -64, 51, -39, 79,
+		11, -89, 6, -2, -64, -49, 43, 21, 91, 63, 90, -34, -50, 13, -98, -65, -33, 32, -29, 42, 87, -9, -72, 27, 5, 11, 38, -30, 83, -21, -18, -94,
+		-9, -74, -41, 46, -93, -12, -100, 64, 27, -18, -48, 10, -89, -68, -12, -34, -45, -12, -19, 22, 90, -26, 20, 55, -76, 86, 90, 55, -9, -1, 65, 50
+	},
+	.weight_M_2_T = {
+		86, -55, 55, -49, 43, -58, 84, -5, -6, -93, -21, 46, 96, -44, 52, -97, 53, -49, -43, 57, -93, -48, 85, 78, 78, 48, -67, 0, -67, -78, 85, -50,
+		-99, -58, -59, -20, 76, -39, 18, -20, -100, 53, -61, 80, 59, -14, 99, -21, -21, -52, -12, 83, -15, 2, -99, 58, 55, 48, 97, -91, 99, -53, 3, -72,
+		-52, 89, -19, 56, 80, -98, 20, -17, -16, 66, 83, -22, 30, 62, -92, 59, -88, -28, 22, 2, -4, 44, -32, -12, -91, -4, -55, 86, 54, -86, 48, -62,
+		24, 81, -52, 75, 21, -30, 78, -46, 28, 4, -62, 60, -1, -17, 10, -38, -76, 59, 13, -6, 57, -19, 59, 97, 49, 82, 5, 41, -25, 76, 96, -53,
+		-16, -70, -25, 41, 21, 99, 14, 54, -1, -37, 48, -48, -54, -6, -53, 46, -38, -76, 95, 33, 30, 19, -49, 63, 17, 85, -21, 71, 81, 38, -91, 72,
+		-4, -6, 77, 6, -22, -87, 51, -30, 0, -12, 16, 50, -61, 60, -1, 45, -49, -27, -75, -18, 26, -78, 22, 18, -37, 8, -74, -91, 47, -58, 10, -60,
+		39, 14, 36, -1, 10, 39, 94, 19, -62, -81, 25, 13, 39, 96, -79, -80, 80, -11, 7, 28, 98, 3, -94, 36, -93, -12, -87, -72, 1, 31, -5, 44,
+		-76, 89, 89, 22, -92, -26, -13, 87, 90, 24, 38, -37, -15, -24, -19, -66, 36, -76, 88, 74, -12, -25, 91, -29, 22, 44, -11, 64, -19, -16, -61, 41,
+		78, -95, 18, -92, 11, -75, 16, 62, -53, -35, -50, 39, 24, -85, 76, -98, 36, 92, -44, 0, -64, -19, 81, 76, -12, 34, -64, 73, 6, 1, 75, 50,
+		58, -3, -56, 80, 47, -95, -76, -35, 12, -8, -7, 59, -31, 65, -20, -9, -92, 11, 77, -12, 4, 7, -89, -90, -99, -96, 27, -69, -58, -87, -80, -61,
+		45, 1, 26, -81, -92, 92, -94, -80, -68, -35, -41, 67, 92, -44, 96, -11, 13, -80, 25, 61, -12, -97, 4, 19, 45, 45, 71, 27, 78, -82, -80, -90,
+		24, 62, -14, 43, -29, -36, 92, -81, -39, -72, 56, -34, -90, -80, -67, -64, -1, -20, 18, -85, -33, -43, 32, -5, -77, 0, 51, 26, 6, 4, -18, 10,
+		-49, 48, -35, 90, -47, -66, 51, 97, -35, 72, 55, -89, 82, -54, 13, 26, 39, 71, -23, -15, -75, 47, 43, 8, -29, 68, 65, -65, 66, 47, -32, -40,
+		-77, -54, 79, 43, -83, -100, -67, -73, 60, 94, -27, -73, -19, 3, -14, 84, -56, -17, -32, 75, 6, -55, -17, 81, 45, 98, 20, -34, -58, 58, 16, -34,
+		23, 27, -2, -62, -71, 62, -95, -11, -8, 52, 32, -67, 22, -27, -99, -85, 20, 19, -62, -2, -13, -41, 25, -64, 40, 69, 83, 45, 62, -44, -49, 55,
+		-64, -5, -64, 12, 86, 9, 11, 56, 5, -77, -56, -91, 92, -75, 7, -76, -94, -29, -58, 77, 46, 32, -34, 26, 14, -49, -31, 78, -53, 22, 47, 26,
+		-96, 6, -24, 94, 68, 33, -33, 62, -67, 30, 51, 85, 64, 92, -34, 57, -63, -29, 90, 64, -100, 69, -2, -97, -31, 38, 87, -44, -1, 61, -1, -28,
+		16, 8, 23, -85, 8, 46, 0, 37, -34, 59, -11, 95, 0, 69, 73, -21, -49, 88, -89, 63, -96, 72, -60, 0, -81, -80, -5, -68, 63, 34, 13, -84,
+		-23, 70, -58, 59, -88, -7, -68, -73, -27, 90, 23, -53, -23, 5, -48, 4, -43, 22, 86, 18, 26, 67, -33, -88, -66, 37, 28, 1, -89, -14, 54, -90,
+		-71, 28, -41, 69, -92, 24, -20, -52, 35, 30, -62, -63, 1, 24, 81, 57, -67, -60, -29, -40, 28, 23, 38, 45, 63, -54, -9, -31, -25, 78, 23, 97,
+		36, -81, -100, -85, 42, -44, 74, -77, -91, -12, -68, 86, -4, -24, -91, 24, 0, 81, -26, 80, 83, 25, -38, -35, -85, -66, -61, -12, 92, 31, 58, 2,
+		-73, -68, -13, -34, 32, 81, -97, -20, 93, 25, -2, -35, 96, -88, 40, -24, 0, -60, -25, 46, 90, 31, 45, 96, 65, -81, 42, -61, -9, 25, 28, -47,
+		86, -42, -9, 97, -95, 69, -10, 53, 15, -67, 93, -36, -54, 73, -89, 93, 72, -80, 99, 8, -53, 30, 25, -36, -73, 96, 42, 24, 74, 83, -56, -69,
+		-14, 34, -30, -8, -68, 80, -88, -63, 6, -53, -41, -92, -50, -21, 87, -39, -3, 35, -60, 96, -83, 47, -12, 25, -45, -5, 15, 84, 50, -32, -62, 77,
+		52, 4, -45, -68, -13, -19, -51, -44, -3, 78, -100, -87, 20, 95, 88, -53, 75, 7, 29, -27, -87, 34, -57, -95, -92, 69, 11, 51, 15, -53, 61, 68,
+		44, -9, 21, 58, 81, 43, -73, -2, 76, 85, -76, 28, -87, 81, 6, -18, 19, 16, -27, -6, -85, 21, 55, -22, 82, -28, -45, -6, 96, -51, -68, -10,
+		-70, -28, 19, -55, 20, -65, 50, -15, 99, -59, -91, -85, -74, 93, 34, 78, -2, 58, 31, 31, 74, -23, -72, 75, 56, -90, 73, 36, 47, -65, -79, -28,
+		14, 97, -59, 96, 77, -25, -81, 34, -71, 39, -54, -6, 24, -81, 76, 55, -92, 38, 58, 3, -15, 31, -24, -27, 11, 86, -79, 68, -36, 54, -52, -25,
+		-3, -35, -63, -80, 76, -28, -66, 46, -20, 88, -36, 64, 96, -41, 82, -9, -14, 82, 53, -30, -76, -53, -9, 60, 41, -23, -20, -93, -88, 84, 33, -10,
+		-33, 43, 85, 71, 73, 27, 29, 57, -32, -41, 84, 7, -28, -98, 16, -67, 95, 25, 66, 18, -82, 66, 47, -14, 97, 90, 80, -16, 64, 25, -36, 35,
+		-79, 63, 22, 64, 68, 54, -63, -34, 24, -21, 34, 63, 64, -29, -19, -21, -17, 73, 86, 54, 96, -49, -2, 4, 68, 5, 72, -3, 26, 52, -14, -93,
+		83, 4, -44, 66, 22, 85, 18, 30, -9, -24, 1, -54, 20, -91, -19, 14, 21, 36, -15, 6, -15, 70, 64, 86, 75, -14, 45, 4, 98, 11, -90, 32,
+		-34, -78, -39, 16, -55, -10, -69, -88, 51, -54, 11, 96, -19, -62, -100, 33, 23, -96, 45, 14, 42, 33, 21, -15, 90, 29, 63, 2, -72, -9, -86, -38,
+		3, -50, -29, -43, 12, 7, -18, 52, 44, -11, 87, -6, -7, 76, -49, -62, 72, -49, -91, 5, -62, 7, -69, -8, -88, -11, -3, 77, -63, -16, 88, -96,
+		82, 27, 21, 22, -7, -30, 88, 26, -60, 63, -40, 82, -62, -30, -57, -10, 13, 47, 40, 51, -60, -67, 79, 65, -64, 35, 72, -9, 57, 94, -75, 26,
+		89, -91, 21, -31, 36, -27, 92, -65, -42, 87, -18, -6, 54, -64, -49, 66, -22, -53, 94, 19, -100, -90, 14, -36, 74, -72, 21, -96, 39, 43, -51, -64,
+		57, -8, 9, 8, 17, -56, 62, 99, -31, 35, 42, 96, 28, -54, -45, 1, 30, -36, 16, -16, -1, -6, 87, -11, 89, 67, 83, 33, -74, 37, -59, -96,
+		-42, -60, 96, -86, 55, 98, -90, 85, 7, 82, 14, 89, -7, -19, -67, 87, 82, 99, 90, -1, -50, -52, 94, 35, 4, -11, -16, 57, 79, -69, 15, -7,
+		-78, 18, -4, -42, -61, -80, 21, -11, 91, -5, 58, 96, -6, -10, -81, 4, -33, 37, 68, -49, 98, -26, 41, -29, 4, 10, -74, -39, 88, -88, -73, -31,
+		77, 47, -8, -7, 92, 70, 11, -49, 21, -36, 59, -37, 7, -33, 69, -76, -66, -94, 15, -55, 38, -49, -56, -21, 99, -46, -71, 96, -14, 99, -54, 86,
+		-94, -5, 95, 44, 87, -1, -78, -78, 39, 9, 25, -70, 98, 26, -74, 84, -62, -16, -3, 3, 4, 78, -2, -4, -97, -60, -55, -27, 92, -89, -30, 21,
+		-90, -31, 40, -97, -28, -46, 96, -78, 45, 93, 98, 54, -30, 57, -36, -8, 65, 47, 2, -70, -62, 48, 20, 82, -9, 61, 8, -14, 67, 67, 77, 92,
+		68, -11, 98, 75, 59, -32, 75, 3, 40, -76, -26, 20, 79, 26, 96, 62, -90, -45, 53, -29, -29, 72, 76, -100, 84, -77, -28, 81, 22, 6, 14, 32,
+		53, -90, 6, -30, 42, -88, 85, 38, -73, -42, -9, -12, 23, -48, -38, 81, -1, 26, -41, 38, 53, 68, 38, 91, 95, 94, -25, 88, 16, -6, -51, 49,
+		-95, 62, 44, 94, 99, -4, -35, -33, -14, -97, -61, -60, -91, 68, -22, 4, -75, 63, -30, -24, 88, -36, 13, 38, -43, 69, -14, -40, 34, 31, 38, 45,
+		-71, -89, 26, -97, 53, 65, -6, -51, -87, -55, 98, -75, -82, -52, 47, 96, -56, 34, -15, -26, 7, -9, 58, -15, 55, 95, -23, 49, -35, 7, -96, -90,
+		51, 29, -61, 71, -55, 81, 63, -24, 63, -56, -73, -93, -21, -45, -37, -55, 67, 79, 15, 90, -53, 63, 70, 76, -77, 79, -90, 92, -10, -62, -15, -13,
+		-21, 92, 9, -30, 40, 42, -21, 15, -44, -31, 75, 39, 31, -62, 77, -65, -26, 76, 30, 4, -62, 6, -7, 2, 53, 31, -82, -34, -54, -11, 10, -59,
+		23, 2, 39, -31, 23, 47, 5, 89, -22, 33, 95, -2, -14, 21, 32, 69, 88, -65, 53, -17, -84, 18, -94, 58, -17, -87, 37, 11, -80, -22, 56, 61,
+		-69, 42, 67, -59, -43, -100, -63, -90, 71, -90, 14, -86, 95, -46, 72, -8, -11, -22, -83, 54, 50, -92, 28, -30, -18, 1, -83, -36, 28, -25, 78, -90,
+		-63, 45, 0, -25, -49, -52, -81, 15, 50, -76, 97, 41, 52, 79, 81, 47, 4, -36, 70, 41, -77, -23, -59, 16, 0, 33, -63, 29, -32, -37, -70, -86,
+		16, -52, 52, 37, 62, -38, -70, -73, -77, 45, 35, -61, 24, -70, 60, -100, -75, 39, 93, 51, 43, 62, -12, -88, 54, 91, 25, -36, 29, 5, -67, 32,
+		43, 60, 6, -66, 63, 31, -24, -37, -2, 57, -9, -61, 58, -44, 70, -99, 60, -68, 25, -49, -30, -7, -84, -42, -72, -77, -29, -52, -4, -19, 69, -93,
+		-13, -95, -9, -55, 90, -76, -46, 71, -23, 95, -47, 46, 67, 51, -100, -52, -73, -32, 42, 57, -14, -51, 55, 3, 0, 72, -12, -52, -79, -80, -98, -12,
+		18, 31, -95, -60, 8, -1, 13, -77, 99, -21, 82, -32, 6, -11, -61, -7, -36, 18, -99, 65, 86, 13, -46, 91, -84, -57, 81, -26, -64, 15, 40, 29,
+		13, -88, -2, 63, 97, -52, -76, -89, -95, -15, 38, -63, 73, 77, 26, -63, 90, -49, 60, 45, -100, 53, 47, -50, -39, 7, 16, 45, 79, -30, 1, -9,
+		71, -87, -7, 39, 70, 85, 7, 49, -46, -86, 58, -24, 39, -56, -41, -50, 67, 72, 79, -46, 74, -18, 51, 99, 21, -78, -12, 60, 79, 8, -19, 0,
+		-50, -87, 87, 92, -65, 93, 81, 20, -6, 38, -14, 50, -2, 96, 7, -67, 76, -34, -13, -43, 87, 10, 96, -4, 18, 12, 42, 10, 5, 79, -57, -11,
+		-17, 15, 58, 42, 42, 1, -58, 79, -20, -91, -12, -62, 56, -5, -6, -88, -65, 16, 27, 48, 16, 54, 70, 14, -14, -74, 74, 26, -91, -25, -54, -81,
+		93, 72, -25, -86, 19, -59, 22, -4, -68, 4, 58, 93, -25, -40, -39, -82, 44, -59, 71, 76, -70, -34, 4, -82, -37, -2, 13, -18, 60, 45, -27, 58,
+		-78, 75, -94, -16, -9, 43, 77, -28, 71, 2, 26, 74, 72, -29, -69, -15, -87, -13, 7, 27, -86, 26, -98, 80, -79, -36, -26, 20, 21, 68, -50, 86,
+		36, -52, 50, -85, -45, 83, -53, -3, 9, -51, 72, 26, -79, 58, -75, 2, 92, -76, -93, -97, -70, 22, -100, 52, -40, -18, -97, -79, -69, -50, -50, -60,
+		-29, 51, 71, 33, 37, 27, -7, 96, 72, 32, 13, -32, -89, 43, 53, 3, 43, -95, -70, -14, -3, -59, -94, 52, -86, -45, -92, -87, 70, -93, 55, -40,
+		97, 12, -92, 96, 52, -47, 71, -89, 55, -35, 91, -3, -29, 97, 23, -88, -51, 63, -59, 54, -2, -65, -15, 83, 1, -58, -11, 68, -85, 64, -66, 97,
+		-6, 79, -5, 40, -70, -72, 51, -15, 75, -13, 91, -29, -17, 25, 30, 41, 78, 93, -85, -55, -40, 89, 74, 61, 50, -19, -96, -8, -76, -17, 64, 42,
+		49, -2, -38, -95, 8, -4, -17, 40, 82, -96, -83, -98, -44, 91, 61, -73, -16, -69, -94, -18, -72, 67, -85, 27, -65, -55, 20, 12, 56, -23, 79, 96,
+		-99, -83, 65, -92, 46, 14, 2, 99, 66, 48, -44, 28, 38, 62, 17, -55, 98, 96, 2, 3, -24, 9, 24, 90, 29, -88, 55, 63, 72, -67, 0, -2,
+		-96, -70, 8, -83, -64, 31, 2, 17, -52, 75, -72, -8, -51, 51, 74, 25, 40, -8, 83, -1, -70, 56, 3, 39, -16, -72, -80, -78, 41, 13, 66, -36,
+		-84, 56, -68, 52, 90, -5, 56, -30, 43, 54, -85, -32, -23, -50, -24, 39, 38, -5, -54, -54, 40, -61, 6, 27, -3, 79, 79, 5, 7, -74, 28, 52,
+		16, 19, 2, -49, -17, -73, -40, 60, 67, 52, 18, 8, 13, -45, -63, 49, -40, -66, -73, 86, -84, -16, -97, 15, -69, 99, -96, -96, -39, 63, 0, 20,
+		-6, 11, 88, 98, -20, 86, -76, -24, 45, -54, 64, 91, 47, -76, 86, 21, -15, -22, -68, -37, -39, 45, 74, 66, 97, -77, 94, 46, -18, -22, -26, 39,
+		62, 81, 87, -8, 25, 70, 81, 30, 69, -47, 83, 57, 2, 4, 3, -30, 45, -8, -65, 36, 54, -93, 81, 59, 57, -91, -87, -95, 0, -30, 60, 30,
+		12, -78, 96, -48, -28, 25, -95, -53, -63, -48, 58, 3, 87, -45, -43, 50, 32, -17, 30, 66, -18, -19, -52, -48, -64, -84, -3, 13, 33, -40, -37, -43,
+		-96, -4, -75, -13, -91, 58, 75, 57, -98, -21, 18, -10, 11, 47, 48, -16, 71, -63, 51, 43, -45, 89, 38, -18, 53, 36, -26, 48, -78, 83, -35, -22,
+		27, 59, -67, 79, 56, -76, -18, 65, 8, -67, -68, 90, 85, -86, -3, -21, -10, -40, -28, 93, -52, -83, -66, 85, -94, -33, -21, -85, -52, 65, -46, -29,
+		-9, 98, -47, 19, 21, 15, -28, 48, 50, -90, 29, -48, 96, 47, 55, -90, -68, -15, 64, -75, 16, 65, -18, 7, -2, 63, 31, -42, 13, 66, 43, 84,
+		65, 51, -13, 73, -32, -10, 91, 94, 80, 23, -59, -41, -75, 73, 15, 18, -93, 78, -83, 16, -7, -37, 90, 71, 73, -24, 73, -24, 49, -85, 71, -89,
+		-19, 43, -11, -14, -52, -100, -56, -35, 64, -51, 12, -73, 38, -93, -14, 89, 85, 52, 33, -51, 46, -12, 9, -66, 98, 64, 66, -76, -1, 91, -61, -92,
+		-5, 73, -66, 69, -47, 29, -76, -78, -73, -90, -95, -73, 8, 86, -50, 21, -9, 17, 55, -95, 2, 84, 10, -82, 16, -24, -50, 32, 21, 64, -15, -28,
+		-3, -6, 42, -84, 63, -25, 77, -29, 90, 64, -18, 17, -7, 81, 79, -44, -52, -12, 2, 85, -46, 59, 94, 4, -15, 91, -94, -60, -52, 24, -44, -30,
+		-81, 0, 92, -64, -86, 62, 54, -88, 31, -26, -25, -1, -57, -3, 55, -73, 27, -49, -38, -84, 94, -78, -48, -25, -88, 85, 72, 32, -74, -61, -72, 76,
+		55, 92, -19, 73, 48, -55, -5, -97, 50, 12, -39, 58, 29, -43, 4, 13, 5, -66, 71, 83, 20, 84, 47, 75, -94, -36, 85, -63, 31, 55, -29, -64,
+		28, 49, 71, 76, -17, -96, 82, 58, -56, 98, -100, 53, 54, -15, -89, -90, 82, -26, -16, 45, -95, 63, 60, -50, -20, -21, 37, -91, 40, -42, 64, -88,
+		95, -20, -48, -72, -3, 44, 15, -10, 98, -46, 67, -27, -62, 26, 68, 26, 92, 24, -18, -76, -6, -30, 83, 17, 91, -67, -100, -47, -30, 12, -21, 5,
+		-50, -90, 70, -11, -8, 1, 57, -21, 56, -35, -80, 98, 54, -78, -69, -36, -48, -53, 20, -98, -93, -14, 87, -34, -16, -73, -100, 22, -67, -96, -65, -66,
+		-52, 97, 86, -3, -93, -79, -59, -12, -80, 49, 76, -68, 46, 81, -55, -8, -100, 94, 85, 91, 10, 20, -88, 98, 24, -16, 44, -75, 36, 59, -19, -86,
+		-33, -55, -46, 24, 3, -100, 2, -99, -82, -41, 72, 73, 74, -45, 84, -9, 52, -13, 73, 20, 98, 12, 82, -9, -46, -10, 68, -71, -60, -4, -6, 65,
+		7, 35, -40, 85, 80, -9, -66, 15, -35, -75, -96, 18, -8, 98, 24, -20, -82, -35, 67, -73, 6, 82, -37, 29, -99, 47, -78, -70, 39, 72, -52, 66,
+		-52, 98, -50, -63, 96, -94, 8, 89, 17, -58, 68, 46, 20, 82, 37, 96, 24, 16, 9, 74, -18, -27, 82, -41, -66, -76, -27, -12, -80, -71, -10, 39,
+		-9, 96, -51, 72, -8, 1, 4, -91, 50, -26, -60, -69, -37, -83, -99, 72, -82, -31, 20, -24, -21, -10, -28, 20, 25, 16, 22, -33, -48, -69, -5, -91,
+		56, 15, 11, -62, 49, -67, 8, 43, 65, 54, 16, 70, 84, -57, -97, 76, -93, -17, 78, 63, 47, -94, 61, 33, -66, 34, 59, 57, 79, -58, -82, -56,
+		70, 62, 54, 70, 69, -33, 37, -13, -67, 20, -93, -2, 9, 38, 99, 10, -80, -100, -11, -1, 63, -82, -28, -26, 53, -89, -17, 60, 37, 47, 59, -18,
+		-35, -85, 79, 28, 93, 85, -38, 6, 19, -47, 72, 43, 33, -14, -92, 89, 88, -92, 37, 50, -5, 11, -14, -25, -87, -17, -54, -30, 23, -4, 13, -82,
+		5, 86, 97, -14, -83, 78, 98, 74, -65, -71, 61, 69, 28, 25, 8, -10, -27, 99, -52, -70, -19, -5, -35, 44, -86, -67, 24, 7, 42, -68, 10, 44,
+		31, 92, 56, -48, 78, 26, 43, 99, -15, -97, -70, -18, -20, 26, 72, -57, 30, -87, -14, -41, 91, -99, -32, -14, 97, -61, 41, -51, 98, 32, 27, 44,
+		40, -39, 11, 40, 81, 85, 60, 68, -11, 64, 5, 47, 10, 74, -2, -82, 31, 81, 67, -30, -86, 8, -38, 89, 56, -86, -17, 56, -68, 65, 82, 13,
+		-9, 51, 83, -100, -15, 68, 85, 42, 99, -73, 92, 48, -22, -88, 38, 40, 83, 96, 64, -23, -39, 6, -32, -42, 92, -68, -34, 74, 42, 31, 8, 14,
+		-33, 3, -30, -12, -56, 81, -35, 5, 97, -41, 79, 64, 51, 51, -32, -96, 13, 76, -31, 44, -74, 73, -52, 37, 55, -11, 69, 27, 15, -4, 47, 84,
+		-9, -77, 53, -50, 69, 97, -77, -35, 62, 40, -87, -12, -88, 28, 55, -61, 63, 0, -43, -88, -72, -72, -87, -60, -89, 79, -13, 61, 95, -63, -4, 70,
+		4, 44, 9, -61, -44, -73, -28, -42, -9, -19, 44, -2, -64, 95, -46, 34, 7, 45, 72, -43, 85, -3, -90, -26, -5, 52, 37, -48, 34, -95, 93, 68,
+		-5, -27, 58, -37, 30, -66, 57, -42, 61, 28, 83, 55, -86, 98, 12, -52, -83, -53, 53, -62, -22, 6, 16, 12, -74, 0, -84, 74, -78, 58, -60, 40,
+		-76, -26, -14, 10, 20, 61, -77, 38, 14, 84, 68, -20, 24, -71, -83, -54, 37, 68, 77, -27, 98, -45, -75, -84, 71, -46, -6, 54, 17, 26, 96, 49,
+		-51, -10, 60, 28, 99, 87, 21, 85, -67, 48, 9, 7, -43, -6, 16, 42, -42, 36, -91, -58, 35, 47, -64, 64, -79, -80, 43, 74, 24, 53, -79, -14,
+		4, -68, 85, -55, -68, 55, 88, -41, 3, 0, 12, 65, -7, -10, -44, 91, -86, -44, -65, -79, -32, 78, 60, -100, 70, 24, 5, 15, -19, -31, -18, 54,
+		23, -84, 37, -39, 94, -43, 59, 38, 61, -24, -23, 85, 14, 74, -9, 96, -36, -98, 40, -84, -14, 63, -7, -91, 63, 47, -1, 42, -87, 17, -100, 56,
+		11, -65, 35, 84, 24, 49, 16, -14, 71, 47, 77, 41, 55, 38, 56, 45, -92, -9, -65, -47, -38, -75, 74, 24, 16, -42, -41, -36, -27, -59, 16, -54,
+		38, 77, 32, -14, -11, 52, -70, -53, -32, 89, 30, 25, 78, 21, -76, 50, 23, 73, 32, 28, -85, 61, 25, -29, 53, -69, -64, -47, -97, -50, -69, -63,
+		77, -59, 38, 57, -63, 2, 5, -100, 81, 8, 77, 59, -33, 41, 10, 77, -50, -24, -50, -24, -17, 66, 23, 60, -88, 74, 91, -71, -82, -64, 34, 86,
+		-91, 55, -98, 78, -23, 28, -89, -71, -26, -78, 8, 97, 21, -91, 33, 43, 70, 16, 43, 97, 81, 28, -7, 76, 78, -94, 70, -64, -52, 20, 22, 52,
+		-17, 95, 99, 2, -88, 17, 68, 25, -4, -89, 84, -3, 67, -60, 3, -93, 46, 75, -44, -95, -78, 26, 60, -97, 37, -70, 23, -4, -34, -2, 3, 28,
+		-96, -56, 28, 85, -98, -17, -45, 85, -24, -80, 88, 14, 37, -32, -69, -63, -97, -33, 93, 3, -65, -14, 89, 92, 44, 1, -47, 37, 50, 68, -88, 2,
+		89, 91, 64, 62, -80, 73, 48, -59, -35, -90, -48, 25, 9, -35, -66, 20, -98, 19, -84, -20, 69, 26, 2, -65, 57, -80, -46, -42, 64, 88, -32, 76,
+		-83, -4, 79, 33, -65, 13, -97, 4, -29, -39, 98, 64, -89, -54, -89, -92, -17, -99, 55, 35, 14, 84, 99, -97, 68, -69, 86, 69, 32, 90, 27, 29,
+		16, 69, -35, -83, 43, -33, 13, -98, -38, -79, -26, 61, -89, 22, 81, -99, -67, -53, 56, 9, -27, 88, -20, 99, -54, 2, 97, -7, 38, -99, 3, 37,
+		92, -14, -30, 36, -62, -97, 5, -56, -20, 88, 26, -66, 46, 21, 33, -56, 97, 70, -18, -16, 83, 21, 32, -58, -44, 70, -57, -22, 90, 97, -62, 8,
+		-12, -42, -33, -78, -53, -82, -62, 46, -2, -100, -10, -62, -48, 65, -76, 8, -74, 20, 76, -58, -22, -40, -52, 63, -56, -91, 5, 34, -31, 12, 60, -35,
+		29, 92, 79, -4, -98, -27, 21, -84, -17, -50, -31, 75, 86, 85, 82, -14, -56, -94, 3, 85, 0, 26, -82, -70, -45, 94, -53, -89, 89, -26, -85, -64,
+		-82, 46, 81, 92, 85, -81, -3, 91, -2, 44, 94, -73, 15, -99, -11, -3, -49, -33, 20, 34, -33, 31, 17, 33, -91, -27, -19, 37, 49, 41, 23, 21,
+		67, -20, 35, -89, -3, 82, 47, 84, 21, 12, 75, -2, -76, -3, -87, 93, 36, 34, -36, -46, 82, -68, 14, 11, -10, 39, -21, -32, -82, -2, -25, -6,
+		5, 8, -87, -80, 14, -72, 61, -74, 76, 31, -70, 65, -71, -30, -79, 78, -73, -7, 75, 72, 12, -37, 40, 71, 76, 81, 88, 26, 21, 6, -64, 84,
+		-73, -41, -31, 68, -23, -62, 42, -95, -8, -64, 36, -41, 33, 84, -14, -27, -92, -94, 71, 9, -2, 22, -37, -67, -93, 78, -50, 19, 25, 65, 25, -50,
+		-95, 97, 42, 52, 32, 58, 76, 44, -11, 86, 72, -98, -35, -5, -72, 73, 86, 78, -69, 53, 82, 60, -56, -99, -84, 96, 20, 81, -24, 82, -16, 39,
+		-90, 26, 86, 15, 14, -78, 38, 62, 56, 19, -16, 35, 44, 17, 35, -94, 51, 34, -50, -92, -100, -54, 53, 50, 7, -64, 29, 13, -6, 15, -100, -95,
+		-85, 27, 76, 36, 36, -86, 58, -95, -46, 40, 75, -16, 51, 17, 11, -67, -54, 39, 93, -56, -30, 5, 85, 63, 92, 30, 32, -67, -29, -75, 73, -3,
+		-96, -60, -18, -64, 32, -18, 39, 45, -18, -88, 51, -72, -91, -91, -60, -75, -36, 11, -78, -22, 8, -67, 51, 11, 91, -16, -100, -91, -18, 83, -2, -75,
+		-56, 78, 89, 43, -13, 15, -9, -52, 93, 90, 42, -65, 25, 3, -26, 6, 64, -33, -82, 62, -41, 37, -40, 22, 60, 29, -4, 37, 91, 9, -91, -50,
+		4, -58, 9, -13, -23, -31, -64, 46, -78, -56, 25, 16, -50, -78, 63, 19, -95, -98, -39, -62, -28, 25, -88, 51, 77, 15, 94, 89, -60, 42, 15, -51,
+		-65, 49, 25, -67, 53, 69, 98, -59, 49, 0, -91, -60, -70, -61, 98, -65, 74, -43, 98, -61, -18, 56, -24, -1, -2, 45, -55, 75, 19, -30, 44, 24,
+		-90, 50, 55, 13, -70, 50, 83, 39, 96, 16, 71, -59, -1, -62, -15, 29, 59, 36, -15, 95, -70, 20, -53, -5, -86, -5, 19, -68, 51, -79, -48, 43,
+		-29, -54, 84, 13, 27, 6, -48, -77, 30, 43, -25, -2, -73, -80, 36, -53, 17, -76, 37, -95, -50, -86, -58, 25, 31, -37, 69, 29, 82, 5, -28, 74,
+		-77, 73, -14, 75, -74, 52, 60, 57, -10, 69, 7, 59, 38, 32, 52, -11, -12, 68, 51, -11, -49, -7, -83, -98, -85, 92, -48, -81, -33, 32, -33, -79,
+		40, -83, 77, -100, 82, -3, -6, 4, 77, -74, 86, 14, 73, 5, 6, 76, -51, 22, 52, -10, 26, -27, 96, 14, 35, -3, -67, 1, -95, 12, 17, -50,
+		33, 70, -90, -60, 38, -98, -34, -58, -18, -50, -91, -26, 90, -68, 27, 57, 1, 19, -64, -67, 56, 63, -82, 18, 34, 55, 99, 70, 80, -44, 90, -7,
+		86, 88, -43, 97, -68, -65, 48, -25, 41, -99, -75, -5, -86, 66, 58, 57, -96, -22, -90, 71, 58, 47, 77, -12, 12, -58, -98, 75, 85, -35, -62, 78,
+		99, -100, -66, -12, -80, 22, -8, 89, 79, 21, -57, 67, -78, -75, 90, 13, -9, -32, 77, 25, -43, -24, -18, 87, 99, 73, 36, 37, 64, -84, 15, 5,
+		68, 19, 40, -52, 78, -56, -12, -42, 45, 2, 40, -8, 80, 11, 79, -68, -91, 81, -9, 43, 62, -18, -85, 90, -67, -40, 42, 63, 51, -69, 83, 31,
+		36, -24, -16, 60, 38, 78, 85, 0, -28, -66, 74, 98, 90, -50, -34, -91, 47, 64, -12, 28, -9, 82, 34, -61, -5, -17, 92, -60, -80, -86, 69, -42,
+		-54, -99, -27, -3, 15, 62, 39, 66, 84, 55, 85, 43, 2, -6, -4, -1, -80, 97, -98, 6, -49, 95, 84, 17, 78, 99, -43, -94, 23, -32, 66, -70,
+		-78, 54, 43, 77, -66, -63, 10, -74, -50, -70, -17, 35, -12, 20, -8, 78, -25, -99, -12, -58, -46, 63, 63, 48, 1, 16, -2, 46, 20, -65, -81, 71,
+		-4, -96, 13, 41, 13, -11, -94, -86, 29, 28, 39, -85, 25, 21, -56, -43, 35, 22, 54, 41, -10, -59, -12, -23, -72, -35, 72, -76, 95, -13, -92, -56,
+		72, -74, 79, 58, 38, 54, 87, -17, -30, -9, 8, 54, -100, 10, -67, -53, 1, 22, 5, 91, -64, -32, -14, 43, 37, 10, 93, 93, 9, 98, 36, 58,
+		-9, 4, 59, 68, -35, 39, 35, -60, -44, -35, -14, 15, 60, 36, 63, 32, -9, -2, -26, 94, -88, -66, 21, 76, -64, 31, -10, 99, -56, -50, -20, -17,
+		84, 83, -55, 40, 38, -91, 78, 57, 16, -5, -93, -90, 89, 63, -15, -78, -44, -28, -86, -43, -59, -12, 56, -97, -60, -77, -58, 17, -73, 30, -58, -81,
+		-58, 94, -80, -16, -92, -5, 47, -95, -15, -31, -35, -83, -5, -11, -37, 24, -91, -55, -66, 4, 77, 75, -45, -38, 61, 66, -37, 16, 96, 12, 77, 50,
+		-19, 66, 56, 14, -89, -42, 44, -18, 64, -43, -27, -55, -40, 58, -83, -38, 41, -67, 68, 66, 78, 85, 40, -82, -61, 92, -55, 69, 83, 70, -93, -7,
+		-18, -45, -92, -97, -91, 64, 93, 18, -10, 95, 4, 52, 27, -10, -16, 98, -9, 24, 1, 75, 53, -89, 83, -29, 87, -21, -41, -41, -97, 64, -68, -86,
+		57, -7, 85, -27, -73, -81, 20, -21, 98, -75, -10, 73, 68, 22, 87, 89, 13, 16, 50, 73, -30, -73, 49, -73, 4, 2, 23, -32, 89, 21, 23, -33,
+		95, 71, -60, 49, 76, 3, -53, 79, 79, -47, 99, 92, 83, -13, -19, -98, 55, -29, -60, 31, 13, -73, 65, -70, 4, 81, -100, 24, 16, -98, -10, -51,
+		9, -43, -18, 33, -51, -81, 15, 28, -38, -80, -64, 8, 77, 54, 83, -34, 94, 38, -91, 65, -73, -50, 44, 7, 15, -7, -60, 75, -11, 63, -80, -35,
+		60, 67, -27, -30, -28, -58, -76, 43, -15, -63, -14, -8, -5, -80, 82, -83, -94, 70, -24, 30, -33, -73, 69, 27, -19, 32, 51, 95, -46, 18, 62, -86,
+		-81, -63, -90, 92, -2, -28, -55, 2, 44, -17, 97, -47, -13, 55, 9, 87, 84, 60, 30, -68, -39, 9, -77, -64, -47, -38, -69, -70, 12, 48, 42, 22,
+		63, 74, -34, -66, 10, 30, -59, -56, 99, -7, 11, -61, -69, -4, -90, 19, 29, -49, 64, -62, 34, 8, 26, -96, -30, 56, 57, -72, -9, -26, -41, -89,
+		-31, -72, -92, -49, -94, -68, -99, 6, 31, 28, 70, 34, -34, 20, 29, 19, 70, 89, -91, 98, 5, -36, -32, -29, -37, -57, -65, -22, -6, -60, 28, 58,
+		-53, -25, -90, -42, 49, 30, -38, 47, -9, -67, 74, 91, 13, 89, -72, 97, -92, 91, -58, 94, -27, -67, -100, 35, 63, 63, -17, 93, 17, 1, 57, -79,
+		33, 59, -69, 35, 96, -44, -55, 67, 58, -35, -23, 40, 66, 29, 69, -86, 63, -65, -97, -22, 8, 63, 61, 6, 75, -40, 75, 84, 46, -49, 78, -40,
+		89, 94, -35, -78, -90, -2, -4, 55, 80, 90, 74, -50, 95, 17, 22, -98, -51, 87, 94, 38, 67, -93, 28, 25, -91, 28, 46, 5, 10, -77, -83, -44,
+		19, 64, -27, -39, 58, 2, -58, -4, 11, 30, -69, 17, 85, -63, -86, 80, -83, 71, -96, -28, -72, 82, 83, -13, -64, -37, -56, -71, -48, -100, -80, 84,
+		35, 85, -64, 6, -45, 1, 39, -67, 78, 73, 64, 76, -80, -84, -12, 84, 30, -36, -47, 5, 80, 6, -67, 95, -64, 55, 60, -48, -63, -57, -20, -45,
+		-77, -60, -90, 55, 92, 5, 23, -75, -11, -12, 63, -47, -62, 26, -26, 57, 48, -7, 19, 92, -39, 95, 65, 8, 99, 49, 87, -44, 40, 25, 3, -74,
+		19, -56, 66, 22, -87, 16, -56, 2, 0, 44, 89, 52, -96, 70, 16, -36, -45, 36, -27, 44, 22, -25, 65, 3, -77, -40, 71, 26, -62, 96, -68, -91,
+		-76, -24, 80, 66, -51, -51, 83, -88, -40, -87, -98, 53, -88, -83, -65, 19, 1, -61, 31, -43, 13, -30, -98, 7, -96, -20, 95, 60, -60, -88, -78, 20,
+		-89, 21, 25, -40, -82, 80, -97, 70, -44, 15, -48, 6, -10, -92, 42, 98, 20, 85, -34, -67, 69, -40, 57, 51, 43, 79, 65, 45, 91, -3, -16, 32,
+		91, -33, 98, -36, -3, 1, 39, -94, -9, -95, 46, -45, -73, 0, 61, 34, -84, -97, 30, 85, -20, -77, 27, 70, -24, 6, 58, -3, -85, -79, 73, -93,
+		-97, 48, -44, -90, -29, 21, 47, 98, -77, -82, -79, 86, 70, -87, 33, 68, -85, -7, 93, -79, 66, -78, 94, 88, 95, -6, -2, -74, -89, -73, 74, 6,
+		-56, -30, 27, 77, 10, -31, -100, 69, -55, -81, -13, 76, -100, 18, 86, 7, -12, -21, 92, -65, 29, -55, -53, -93, 26, 51, -29, 81, 17, 17, 27, 34,
+		-100, 19, -2, -56, -75, -46, -33, 40, 26, -27, 24, -89, -31, -13, -86, 51, 21, -68, 41, 29, 29, 66, 50, 88, -69, -100, 41, -13, 23, 11, 29, -85,
+		-97, -63, -12, -40, -96, -83, -11, 45, 86, -67, 73, -22, -19, -78, 44, -27, -89, 11, 51, -78, 75, 73, 36, 56, -24, 86, 6, -10, -54, -53, 23, -48,
+		-26, 23, -23, 46, 97, -24, 94, 26, 14, 33, 52, 90, 31, 1, -74, 85, -37, 58, 6, -95, -58, -56, 51, 23, -46, 41, 8, -9, -51, 78, -67, 98,
+		-14, -47, -74, 43, -18, -93, 66, -94, -93, -93, -21, 89, -19, 49, 11, 70, -73, -2, -45, -14, 31, 11, 87, -38, -72, 12, -84, -84, -70, 93, 28, 31,
+		30, 73, 90, -22, -23, 14, -39, 10, 29, -40, 58, 29, -13, 58, -69, -74, -47, 5, -98, -22, 81, -75, -41, -27, -14, 16, 98, 43, 26, -47, 14, 29,
+		7, -38, 83, -82, -65, -25, -70, 5, -94, -68, -54, -26, 11, -93, -1, 28, -98, -93, 48, 42, -52, 1, 63, -17, -67, -31, 73, 97, 34, -91, 70, 98,
+		38, -46, -67, 12, -44, -15, -9, -48, 66, -79, 64, -6, -79, -29, 50, -30, 67, 65, -64, 39, 14, -98, 65, 70, 27, -17, 9, 71, 5, -77, 69, 38,
+		-82, -38, -84, -90, 29, 86, 98, -54, -55, 50, 56, 90, 44, -30, 24, 76, -66, -1, 84, 56, 51, 12, 58, 20, -13, 38, -55, 28, 87, -52, -23, 58,
+		-70, 77, -3, 8, 45, 65, -22, 53, -29, 51, 91, -14, 17, -50, 84, 85, -85, 34, 61, 26, 23, -1, 1, 31, -35, -51, -12, 27, 23, -3, -63, -42,
+		76, 66, -10, 47, 53, -51, -66, 35, 45, -48, 94, 7, -39, -2, 62, -15, -89, -77, 26, -73, -19, -90, 80, 98, -57, 22, -2, -99, 95, -30, -98, 17,
+		-21, 17, -100, 87, 75, 8, 47, -84, -89, -2, 89, 65, -100, 46, 44, 66, 17, 54, 81, 24, 16, 79, 67, -93, 52, -18, 4, 14, 5, 54, -25, -89,
+		46, 26, 93, 56, 80, 33, 11, 97, -16, -85, 21, 16, -90, -28, -17, 99, -28, 44, -75, -41, -60, 47, 83, 14, 91, 26, 58, -31, -79, -39, 19, -6,
+		-85, 33, 68, -26, 43, -96, -45, 6, 95, -58, -80, 60, 1, 96, -40, -13, -55, 53, 5, -39, 82, -26, 45, -40, 4, -93, -9, -77, 18, 17, -52, -66,
+		49, 87, 54, 22, 63, -40, 42, -27, -3, -42, 94, 93, -24, 42, 87, -95, 14, -22, -93, -65, -39, 87, 49, -56, -69, -64, 22, 56, 73, -12, -20, 1,
+		8, 59, -7, 24, -18, 1, 1, 43, -42, 47, -53, 65, 12, 47, -56, -4, -6, -44, 98, 34, 95, 37, -43, -99, 24, 49, -5, -32, -45, -60, 64, -14,
+		-85, 79, 88, -55, -60, -91, 77, -50, 45, -96, -56, -70, 7, -36, -92, 39, 51, -73, 85, -85, -50, 73, -96, 74, 55, 81, -44, -66, 80, -30, 27, -73,
+		-93, -14, 1, 12, 98, -23, 17, -39, -37, -79, 89, 56, -98, 40, 89, -56, -32, -32, 39, 34, -50, -37, -30, -43, 16, -33, 7, 95, -91, -35, -79, 11,
+		37, 9, 92, 39, 94, -57, 74, 2, -9, -6, 91, 88, -56, 67, -74, 38, -60, 33, 94, -66, 97, 69, 56, 91, -23, -62, 27, 93, 25, -6, 8, 14,
+		-52, -46, -82, 83, 10, -35, 9, -28, -79, 83, 16, -30, -61, -37, 75, 28, 53, -46, -75, -72, 48, -14, 91, -62, 36, 33, -64, -74, 52, 85, -27, -100,
+		31, 58, -37, -13, -51, -5, -62, 90, -26, -41, -49, 81, -88, 3, 83, -16, -29, 29, 22, -19, -54, -13, 95, 29, -100, 69, -71, -1, -61, -11, 5, -21,
+		-26, -65, 58, -37, -58, 54, 43, -27, -5, -32, -67, 47, 73, 67, 10, -96, -13, 77, -94, 36, -14, -50, -88, 61, -3, -40, 47, 78, -87, -49, 80, 49,
+		46, -80, -72, -99, 38, 7, -35, 65, 48, -17, 84, 68, -79, 40, 6, -65, -48, -64, 53, -81, -58, 6, -70, 32, -48, 48, 99, 99, -51, 93, 15, -23,
+		11, -70, -7, -94, -87, 87, 76, -6, -39, -63, -7, -97, -39, 83, -49, -44, 28, 88, 76, 11, 79, -89, 27, 53, -34, -51, -35, 63, 44, -41, -49, 85,
+		-1, 34, -21, -36, 91, -14, 80, 55, -12, -12, 72, 76, -82, 8, 79, 29, 89, 47, -58, 71, 47, -93, 28, -1, 98, -18, -94, 21, 16, 53, 13, -98,
+		73, -43, 13, 25, -84, -39, 86, -6, 91, 8, -24, -68, -84, -47, -59, -5, 10, -46, 47, -39, 48, -57, 33, 81, -68, 18, 38, 77, -76, -42, 48, 21,
+		26, -77, -62, 14, -18, 24, -75, -48, -61, 12, -65, 93, 69, 58, 51, -70, -54, 88, 37, -6, -56, 3, 68, 87, 77, 30, -63, -77, -44, 70, 95, 84,
+		94, 1, -90, 48, -97, -21, 7, 45, 47, -30, 60, 19, 86, -65, 92, 29, -94, -21, 22, 92, -23, -10, -52, 52, -68, -31, -7, -85, 94, 79, -37, 20,
+		38, -17, 85, 30, 51, -57, -32, 28, 98, 81, 61, -26, -12, 97, 20, 99, -43, -75, -3, -100, 6, 44, 77, -76, -86, -100, -56, -1, 87, 91, 42, 47,
+		86, 34, -62, -43, 38, 1, -11, 60, -81, -77, 82, 23, 18, 67, -12, 71, -54, -33, -78, 22, -15, -76, 66, -71, -66, 27, -17, 23, 74, -74, -83, -25,
+		70, -59, -4, -42, -32, -50, 4, -43, -22, -4, 26, -10, 62, 48, 90, 51, 51, 68, -76, 59, 33, 43, 66, -19, -47, -57, 24, 65, 57, -61, -5, 99,
+		65, -5, -30, 19, -43, -82, 76, -65, -100, -51, 53, 39, -24, -54, -27, -71, 34, -22, -4, -40, -16, -50, -37, 79, -4, 19, -54, -84, -47, -22, -65, -6,
+		99, 46, 13, 32, -96, -46, -93, 38, -72, 14, -2, -3, 58, 40, 18, 7, -49, 1, 88, -37, 74, -13, 94, -19, 16, -50, -76, 85, 46, 60, -3, 51,
+		45, -59, 40, 70, 74, 73, 63, -36, 95, 31, 66, -60, -22, 14, -81, -15, -77, 96, 6, 35, -12, -32, 19, 32, 64, -36, -92, -94, -71, 75, -15, 89,
+		-3, -9, -63, -82, -77, 27, -88, -11, 32, 0, -62, 31, 67, -30, -8, -62, -25, -84, -75, 19, -42, -44, -70, 66, -100, 88, 38, -85, 79, -70, 31, -93,
+		-31, 35, -31, 14, 56, -90, 7, -19, -58, -78, -54, 41, -60, -81, 28, 47, 25, -63, -63, -77, -16, -68, -40, 10, -79, -16, 22, -3, -36, -39, 8, -75,
+		74, -46, 13, 80, 84, 71, 74, -59, -10, 37, 44, -58, 37, -38, 7, 88, -50, -11, 87, -10, -38, 78, -55, 3, 80, 13, -51, 42, -84, 4, 38, 27,
+		60, -18, -22, -81, 46, 51, 5, 46, 50, -38, 21, 44, 51, -96, -90, -34, -58, 99, 19, 55, 63, -83, 43, -77, -14, -25, -87, -47, 88, -79, -40, -34,
+		38, 11, 95, -21, -20, -86, -96, -97, -49, 71, 55, 43, -2, 78, -50, -32, 38, 43, 71, 0, 32, 82, 33, 65, 5, -92, -82, 57, 43, -86, -72, -84,
+		80, -28, -51, 46, -98, 82, -50, 96, 66, 21, 56, 22, 8, -15, 86, -55, 14, 60, -93, -16, -32, -100, -87, -69, 87, -92, -76, 61, -6, 38, -76, -42,
+		54, 55, 77, -32, 44, 63, 33, 55, 90, -36, 60, -90, 16, -90, 61, 96, 68, 88, -61, 20, -37, -93, 45, -39, -84, 88, -26, 97, -48, 79, 80, 41,
+		-39, -54, -22, 73, 98, 3, 38, -32, -47, 41, 80, -77, 81, 38, 88, 48, 72, -84, -87, -99, 59, -8, -31, -68, 32, -37, -100, -78, -27, -81, 67, -13,
+		66, 30, 67, 89, -37, -9, 62, 75, -34, 18, -4, 51, 44, 39, 96, 24, -86, -15, 32, 19, 8, -62, -59, -68, 53, -27, 71, -11, -96, 41, 63, 4,
+		99, 46, -19, -11, 42, -76, 4, -26, -75, 40, -29, 99, -25, -65, -70, -50, 82, -71, -5, -29, -79, 15, -97, 5, -65, 60, 2, 54, -40, -76, -43, 50,
+		54, 14, -38, 82, -22, 47, -33, -42, 9, -68, 26, 32, 24, -2, 58, 49, 31, -83, 47, -90, -13, -35, -29, -88, 43, -57, -3, -34, -42, -86, 43, 11,
+		15, -14, 69, -13, 27, 14, 59, 6, -48, 92, -2, -38, -30, 79, -48, -22, -45, -65, -6, 11, 28, 14, -11, 65, -72, -44, 45, -77, 8, -19, 75, -96,
+		-25, -71, -96, 32, 23, 4, 71, 6, 36, -58, -37, 39, 46, 7, -15, 86, 34, -29, 25, 69, 68, 90, 56, 77, -68, 43, -95, 64, 25, 38, 69, 12,
+		-14, -40, 64, 99, -94, 80, -3, 50, -6, -57, -49, 61, 69, 58, 31, 10, -92, -92, 36, -58, -78, -37, -33, -52, -43, -84, 64, -76, 65, 38, -57, 87,
+		-59, -68, -88, 20, 30, -4, -18, -43, -17, -41, 59, 51, 78, -96, 51, -52, -41, 4, -74, -23, 95, -6, -56, 6, -57, 57, 47, -83, -68, -21, 93, 7,
+		51, -82, -51, -18, -80, -15, -6, -46, 58, -20, -26, 98, 56, -62, 29, -12, 18, -4, -15, 22, 40, 41, -38, 85, 31, -87, 8, -33, -72, 64, 55, -70,
+		-89, -59, 48, -96, 69, 84, 42, 56, -79, -8, -27, -71, -39, -6, -72, -8, 9, -3, 63, 24, -80, 36, -51, 92, 16, 80, 18, 71, 66, -77, 54, -87,
+		-26, 69, -89, 64, -21, -27, 42, -89, 96, 59, -23, 21, 13, 54, -70, 28, 12, -90, 92, -42, -93, 39, 52, 0, 42, 16, -87, -21, 24, 89, -61, -91,
+		91, 30, 6, -78, -99, 83, 89, 37, -38, 19, -72, 36, 80, 29, -75, 3, 32, 7, 85, 61, -32, -59, -93, 17, -22, 20, -73, 85, 34, 88, 84, -88,
+		81, 8, -42, -65, -70, -100, 6, -2, -12, 11, -46, -10, -97, -60, 38, 18, -62, 81, -36, 55, 20, 31, 61, -25, 90, -81, -92, -89, -2, -41, -38, -60,
+		-82, 3, 51, 54, 14, 23, 33, -79, 92, 35, 74, -95, -19, -62, -47, 50, -22, 90, -80, 84, 3, -49, 50, 61, 79, -84, 55, -9, -38, 21, 70, -79,
+		-100, 61, -17, -98, 63, -13, -93, 62, 99, 88, 31, 49, -35, 49, 47, 1, -16, -9, -86, -15, -85, 64, 1, 36, -6, 11, 71, 34, 77, 76, -4, 14,
+		-37, -30, 8, 20, 19, -37, 7, -16, 2, -58, 18, -55, -10, -50, 70, -75, 84, -71, -44, -87, 19, 38, -48, -21, -7, 11, 55, 67, 43, -99, -22, -85,
+		39, -9, -59, -85, -4, 38, -95, -55, -33, 65, -83, 51, -39, -9, 0, -98, -43, -48, 56, 37, -14, -30, -23, 25, 97, -20, 23, 22, -53, 84, 79, -28,
+		-25, 27, 21, -66, -83, 37, -81, -56, 86, 41, 29, -61, 50, 18, -73, -57, -13, 24, -82, 14, -23, -12, 11, -46, -16, 35, 3, 45, 28, -98, 42, 6,
+		-32, -47, -97, -44, -32, 89, -36, -15, 65, 11, -76, -2, 22, 26, -81, -23, 57, 19, -82, -82, -41, 31, 79, -75, -16, 50, -62, -88, -36, 65, -52, 30,
+		12, 12, 98, 50, 66, -8, 57, 4, -40, -48, 29, -60, -45, 58, 51, 33, -69, 99, -5, -68, 49, 25, -54, 40, -92, -35, 76, -91, 41, -45, 35, -8,
+		97, -21, 31, 74, 30, 27, 46, 95, -77, -93, 81, 65, 53, 87, -76, 78, -50, 47, 84, 41, 41, 98, -30, -65, -75, 69, 22, 5, 35, -40, -53, -68,
+		84, -5, 2, -20, -90, 71, 59, -46, -39, 55, -37, -27, -46, -94, 93, -7, 97, -90, -62, -25, -88, -61, -81, 69, 47, 53, -2, -40, 85, 64, -81, -78,
+		-80, -89, 89, -46, -51, -63, 22, -70, -81, -37, -11, -34, -5, -80, 86, 89, 93, 85, -71, 87, 82, -28, 63, 21, 56, -50, 40, -38, 73, 58, -80, -60,
+		-80, -66, -29, -30, -71, 20, 24, -37, -6, -90, -29, -65, -27, 8, -74, -2, 21, -59, 62, -43, -67, -70, 16, -50, 50, -38, -51, -72, -10, 69, 6, -83,
+		-92, -18, 54, -73, -89, -3, 18, -92, -94, 7, -4, 81, 33, 76, -34, 12, -66, -42, -61, 11, -12, -76, 92, 27, -86, 39, 6, 80, 67, 10, -8, 68,
+		53, -22, 88, 2, -13, 33, -72, 80, -52, 68, 88, 30, 57, -35, 80, -64, 24, 38, -70, -88, -58, 11, -28, 34, 73, -68, 55, 15, -36, 56, -61, 42,
+		-2, 72, 97, 68, 63, 50, 62, -84, 48, -92, 59, 98, 83, 50, 7, -9, 58, 71, 21, 48, 84, -9, 90, -20, -43, 3, -42, -93, 4, 59, -50, 22,
+		51, 50, 28, -98, 75, 57, -43, 19, 64, 64, 23, 36, -35, 7, -7, 4, -25, -96, -41, -10, 22, -18, -63, -65, 65, 82, -20, 92, -28, -52, -2, 24,
+		-81, 35, 14, 76, 21, -75, -36, -57, 11, 56, -100, 62, -14, -40, -83, -47, 21, 99, -48, 79, 13, 8, 44, -84, 81, 81, -64, 22, -53, 22, 63, -69,
+		85, 45, -60, 50, -49, 82, -26, 88, -2, 84, 52, 33, -56, 82, 56, 42, 73, 19, -84, -22, 36, -44, -80, 96, 62, 42, -56, 16, -59, -12, -85, -37,
+		36, 70, 7, 51, 20, -81, -15, -52, -35, -45, -66, -35, -73, -44, 27, -75, 7, 98, -58, -32, 65, 54, -56, -86, -45, 16, 28, -46, 67, -33, 72, -48,
+		-21, -14, 70, -38, 36, -95, 83, -51, -38, -6, 81, 46, -22, -6, 91, -40, 82, 8, -21, 33, 85, -35, -78, -29, -75, 55, 62, -76, -80, -16, -9, 31,
+		43, 58, 78, -2, 83, 17, 27, -91, 38, 9, 46, -82, -46, -39, 57, -98, -41, 6, 27, -16, -63, 88, 5, -18, -52, 10, 71, 7, 7, -61, -34, 23,
+		79, 87, 79, -58, 27, 68, 62, 51, 36, 63, -10, 16, -87, -22, -47, 8, -62, -8, 53, -77, 65, -42, -38, -56, -86, 66, 10, 33, 88, -5, -96, 48,
+		93, 13, 8, 17, 20, -27, 85, -37, -83, 25, 15, 96, 96, 92, -63, 3, -22, -60, 38, -52, -73, 98, 98, 34, -41, 20, 8, -28, 69, -30, -58, 71,
+		37, 47, 69, -40, 41, 6, 85, 88, -3, 9, -21, 50, -7, -12, 82, 6, 90, -38, 30, 44, -39, -19, 68, 96, 61, -53, -60, 39, 34, 75, 84, 35,
+		-18, -67, -23, 6, -87, 71, -92, -49, 45, -83, -83, -53, 90, -12, 37, -55, -79, 76, 99, -100, 69, -53, -29, 21, -7, -67, 10, -23, 2, 7, -91, 83,
+		-91, 12, 83, -65, 42, 1, -60, 25, 21, -97, -20, -33, -2, -15, 74, -8, -20, -51, 54, -51, 23, -38, 51, -29, 75, -99, 26, 27, 75, -54, 99, -50,
+		-15, 33, -91, -10, 92, -14, 9, -35, 81, 21, 24, -49, -13, 27, -100, -36, -2, -50, 12, 40, -67, -13, -29, 43, -21, 72, 46, -61, 32, 75, -74, 10,
+		2, -58, -98, -95, 86, 1, 73, -35, -2, 59, 92, 22, -77, -98, -31, -89, -5, -4, -78, -82, -48, 67, -82, 65, -100, 56, 47, 66, 29, -19, 99, 62,
+		17, -25, 81, 86, 57, -12, -78, 0, -74, 3, -79, 15, -77, -38, -28, -95, 57, 54, -35, -74, -96, -54, 87, -24, 50, -28, 16, 33, 10, -62, -97, -43,
+		73, -54, -93, -61, 63, -65, 20, 3, -64, 29, 24, -70, 16, 97, 1, 95, -18, -52, -98, -27, -87, -4, -65, -97, -24, -89, -23, 70, -22, -34, -74, 96,
+		-69, 75, 86, 9, 82, -75, 13, 27, -67, -18, 48, -41, 28, 26, 18, 57, 18, 8, -20, -72, -6, 62, 88, 43, 18, 24, -14, -43, 33, 84, -16, -11,
+		74, 25, 35, 56, 77, 96, -40, -49, -74, -93, 64, 81, -47, -55, 7, -55, -48, -62, -1, -88, 71, 85, -58, -12, 78, 21, 5, -9, -43, -59, -39, 39,
+		-85, -49, -90, 41, -40, 13, 82, 1, -63, -61, 12, 5, 40, -80, -100, -35, 82, 73, 94, -23, -78, -21, 24, 66, 47, -61, 64, 42, 39, -98, -15, -56,
+		57, -82, -96, 62, 54, 95, -65, 89, -54, 6, -73, -3, 13, -57, 13, 82, -28, 81, -80, 86, -13, -38, -36, 60, 68, -100, 73, -71, -29, 59, -66, -6,
+		37, -88, -10, -77, 25, -53, 99, 27, -65, 66, -81, -38, 14, 1, 84, 69, -37, -58, 25, -55, 20, 43, 31, 48, -39, 74, 31, -18, -87, -87, -37, -91,
+		-54, 26, -91, -27, 64, -50, -71, 41, 93, 20, 74, 5, -70, 99, 87, -77, 34, -60, -47, -15, 87, -35, -34, -9, -48, 11, 42, -74, 20, 30, 41, -2,
+		-13, -40, 75, 94, 5, 20, 89, 42, -68, 9, -66, -15, -24, -75, -31, -54, -3, -92, -84, -94, -70, 94, -48, 45, -100, -93, -52, 5, 98, -40, -87, -84,
+		-71, 79, 56, -87, 3, 54, -33, -45, -9, -56, -43, 14, 10, -11, -68, -85, -29, -84, 81, 79, -37, 90, -7, 14, -17, -13, -71, -22, -45, -80, -52, -73,
+		-26, 67, -83, -88, 75, 87, -86, 71, 1, -47, -81, 5, 1, -21, 47, -32, -25, -44, 68, -19, 19, -50, 65, -73, -23, -18, -15, 5, -80, -52, -51, 61,
+		-9, 48, -46, -13, -4, 23, -91, 2, 43, -7, 19, -23, -5, -95, 22, -23, -16, -25, 69, -48, 1, 60, -96, -77, 79, -86, 60, 69, -8, 31, 78, -8,
+		83, 39, 61, -89, -20, 76, 35, 25, 1, -78, -99, 61, -57, 20, 18, 48, 79, -43, -18, 70, 65, -45, -68, -82, 68, 34, -21, -8, 0, -93, 70, 9,
+		-16, -14, -85, -52, -4, 39, 77, 8, 46, -99, -38, -76, -7, -18, 6, -15, 88, 78, 75, -11, -1, -27, -66, -4, 65, -35, 95, 94, 66, -79, 58, -35,
+		-11, 71, -56, -27, 61, -87, 12, 55, 8, -94, 46, -6, 46, -78, 82, -63, -64, 98, -96, -78, -9, 81, -78, -64, -13, 8, 96, -89, -51, 24, 97, -71,
+		-65, -66, -15, 35, -69, -12, -14, -27, -58, 95, 2, -17, -49, 20, -73, 29, 50, -23, 43, 82, -15, 56, -75, -55, -26, -92, 98, 70, 98, -42, 77, -26,
+		82, 12, 26, 52, 22, 98, -46, 59, -7, -74, 72, -36, -36, 46, 57, -90, 95, 62, -8, -15, 22, 78, 37, 38, 3, 16, -45, 87, 24, -12, 69, 71,
+		90, 40, 20, 60, -35, -84, 76, -41, -94, 58, 68, 50, 1, 62, 68, -22, -83, 28, 68, -24, 94, 51, 86, -56, 37, 74, 42, 86, 5, 24, -55, 6,
+		-72, -46, -22, -44, -36, -97, -91, 7, -2, 31, 25, 35, 8, 43, 59, 75, -45, 4, 73, -9, -4, 67, 19, -7, 99, -75, 12, 96, 98, -49, 72, 64,
+		83, -64, 65, 11, -13, 47, 68, -60, -75, 4, 19, 99, -19, 2, -18, -93, 17, 68, 45, 72, -8, -20, -26, -33, -52, 99, 81, -52, 32, 92, -20, -81,
+		-64, -43, -18, -78, 88, 28, 71, 16, -28, 43, -88, 98, -80, -6, 60, -43, 22, 38, 80, -16, 46, -7, 76, -77, 96, 37, 17, 4, -51, -95, 1, 68,
+		69, -27, 23, -57, 59, 52, 4, 34, -93, -53, -94, 1, 51, -72, -45, -66, -54, 36, -74, 99, 70, -18, 3, -33, 50, -57, -98, 74, 36, 57, -52, 82,
+		52, 65, -100, -21, 61, -69, -37, -60, 58, -42, 90, 56, 67, 84, -99, 83, -29, -69, -18, -66, 75, -30, 11, 64, 51, 99, 91, 52, 44, 40, -45, 85,
+		31, 78, 18, 81, -42, -58, 30, 90, 59, -77, 54, -17, 74, 99, -87, 35, 81, 4, 18, -25, 13, 75, 43, 90, -75, 84, 14, 11, 43, 72, 75, -100,
+		-35, -18, 14, 80, -53, 51, -96, 36, 39, -26, -87, 27, -59, -24, 48, -100, -80, -77, 17, -54, 52, -76, -69, 63, 28, -46, 69, 15, -38, 77, 89, 57,
+		73, -2, 96, -64, -32, 13, -13, 74, 89, -24, -90, -6, -84, 22, -55, 62, 60, -21, 28, 9, -69, -1, -82, -66, 26, 51, 95, 72, -77, 1, -1, 61,
+		56, 64, 80, 99, -5, -12, -60, -77, 8, 72, -92, 64, -5, 87, 93, 34, 68, 42, 45, 2, 17, -27, 95, 79, -50, 39, 61, -23, -19, -41, 50, 37,
+		-75, 62, -34, -90, -18, -84, 63, 71, -52, -52, 90, 92, 85, -25, -8, -52, -100, 21, -70, -64, -33, 33, 41, -34, -33, 57, 93, -86, 20, 29, 17, 36,
+		71, -14, 45, -4, -68, 13, 47, 37, 98, -16, -10, 54, 7, 4, -84, 56, 86, 29, 55, 54, 98, -21, 20, -75, 36, 63, 55, 2, 33, 3, 34, 20,
+		19, -72, 26, 20, -75, 54, 8, 61, -29, -39, -10, -15, -30, 22, -6, -38, -50, 63, 81, 78, 48, 94, 12, 84, 71, -61, -23, -1, 88, 52, -49, -33,
+		51, 70, 38, -19, -87, 14, 5, -5, 21, 81, -35, -100, 76, 47, -60, -48, -52, 28, 60, -91, -37, 24, -25, -44, -85, -25, -90, 49, 90, -97, -84, -60,
+		13, -2, -65, -45, 28, -17, -5, -37, 81, -33, 70, -85, 71, -54, -22, -88, 92, 8, 34, 19, -9, -13, -70, -39, -88, 38, 46, 58, -4, -14, 60, -32,
+		-93, 48, -49, 26, -82, -26, -88, -65, 82, 8, -69, -79, 4, 62, 43, 84, -24, 65, -35, -70, 94, -33, 61, 61, 44, -17, -94, 83, 30, -21, 26, 13,
+		1, -99, 15, 18, -33, 33, -50, 4, 63, -33, 94, -21, -42, -54, -76, -41, 29, -87, 77, -32, 2, -73, -53, -37, 92, 61, 33, -55, -99, 18, 63, -10,
+		-81, 30, -14, -13, -74, 61, 1, 64, -37, -12, -62, -52, -21, -99, -65, -20, -35, -82, -97, 25, -24, -88, 74, 93, -29, -90, 22, 19, 63, -2, 89, -17,
+		-35, -91, -97, -82, 27, 56, -99, -61, -99, -36, -61, 96, -4, 54, 73, 16, 89, -6, 83, -56, 27, 11, -73, 12, 70, 2, 71, 91, -6, 82, -50, -36,
+		-74, -38, 67, -15, -76, 21, -53, 18, -39, 36, 40, 8, -45, -5, 97, 41, -7, -34, -81, 15, 22, -38, 80, -11, 73, 25, 9, -10, 38, 17, -82, -4,
+		-61, -8, 36, 17, 45, -12, -25, 43, -55, -47, 23, -77, -77, -74, 14, 80, 16, 65, 85, -41, -89, 68, 31, 63, -40, -43, 60, -73, -26, -25, 73, 91,
+		8, -95, 68, 13, 62, 10, 75, -16, 47, 59, -73, 84, 28, -19, -8, 8, -29, 98, 27, -68, -55, 58, -99, -31, -37, -6, 52, 15, 34, 89, 77, -31,
+		74, -1, -22, 73, -17, 57, -97, -64, -9, 79, 44, -97, 24, -66, -57, 64, 88, -34, 66, -70, -47, -25, -17, 54, 15, -27, -77, 17, 52, -83, -32, -11,
+		-100, -95, 56, -64, 88, 21, 56, 13, -38, -52, -17, -46, 0, 30, 72, -54, -57, -27, -53, 44, 99, 46, 3, 98, -49, -73, 14, 76, 57, -83, -37, 61,
+		-21, 45, -65, -32, -95, -56, -90, -95, -88, 88, 21, -16, -11, -54, -36, -96, -54, 10, -64, -47, -91, -82, -100, -72, 15, -24, 83, -53, -88, 58, -88, 35,
+		-95, -81, 61, 21, 73, 3, 31, -82, 94, 13, -14, -59, 38, 68, -15, 49, 90, -34, 48, -39, 48, -72, 44, 74, -96, -70, -19, 69, -13, 81, -18, -42,
+		-77, 98, -93, 11, 20, 7, -21, -5, -49, 3, 62, 10, 91, -61, 75, 28, 28, 15, 89, 62, -9, -53, 90, -52, 40, 68, -71, -73, -63, 62, 30, 5,
+		-44, 11, 9, 58, -37, -9, 58, 95, 1, -37, -86, -43, 21, 54, 40, 73, 1, -60, -16, -65, 71, 19, 75, 8, -94, -40, -26, 77, -90, -15, 29, -15,
+		-2, 26, -19, 5, -68, -18, -41, -54, -55, 81, -15, 99, 44, -19, 81, -62, -63, 84, 91, -12, 72, -67, -1, 58, 48, -7, -5, -73, 94, 76, 37, 64,
+		62, 6, 70, -57, -27, 25, 75, -99, -98, 50, 24, -88, -24, -98, -21, -18, -78, 43, 39, -17, -16, -53, -92, -61, 69, 28, 36, 67, -99, 92, 30, -8,
+		59, 96, 17, -85, -75, 93, 67, 91, -90, -50, 96, 79, -44, 9, 33, 22, 17, 5, -26, -83, 89, 33, -14, -56, -5, -54, 46, 58, 13, 27, 83, -47,
+		51, 31, -12, 42, -34, 19, -58, 18, 29, 36, -13, -79, -98, -72, 11, 44, 13, 2, -55, 95, -13, 73, -74, -54, -56, -86, -91, -15, 80, -80, -4, -44,
+		75, -26, -11, 67, 58, -65, -69, 51, -74, 25, -51, 58, -75, 91, -14, -72, -11, -85, 59, -11, 18, -7, -79, -23, -95, 32, -90, -69, -96, 38, -66, 35,
+		85, 0, 9, -64, 14, -56, 44, -35, 99, 14, -46, -58, 81, -56, -49, -96, 30, -87, -30, -80, -65, 78, -99, -57, 48, 12, -93, 76, 18, 82, -85, -86,
+		-20, 0, 25, -30, -23, 17, 9, 0, 76, 21, 51, 35, 45, 36, -82, -8, 11, 68, -67, -94, -31, 99, 99, -59, 0, 21, -63, 67, 47, 3, -72, -59,
+		-41, -88, -81, 2, 23, -94, 62, -54, -13, -65, -31, -70, 79, 89, -25, -42, 23, 74, -4, -94, 27, -10, 32, 23, 73, -21, 89, -5, -21, 72, 87, 13,
+		31, -45, -61, 77, 16, 92, 1, 1, -91, -91, -89, -80, 31, 5, -70, 62, -84, -83, 31, -1, -63, 44, -55, 60, -83, -11, -67, -32, 95, -78, 51, -47,
+		56, 89, 95, 87, -86, 31, -99, -50, 80, 26, -58, -100, -47, -20, 95, 52, 52, -37, -36, 81, 0, -90, 47, -68, -32, 98, -21, 30, 53, -5, 19, 66,
+		-92, 78, 73, -67, 21, -56, -35, -24, -83, 13, 46, -23, -36, -98, -32, 68, -28, -93, -53, 20, -14, -50, -81, 40, 49, -37, -44, -14, 89, 23, 87, 71,
+		21, 70, 60, -78, 88, -32, 33, -80, -97, -69, -17, -40, -91, -32, 64, -2, 5, 83, -26, -16, -61, -13, 74, 68, 42, -26, -61, -17, 80, -65, -32, 85,
+		76, -16, 83, 85, -92, 98, -10, 94, 82, -100, -7, -1, 3, -45, 84, -55, -8, 57, 81, -48, 24, 25, 62, 6, -28, -30, -22, 8, -90, -45, 3, -94,
+		-33, -7, -53, 73, -58, -47, -92, 88, -57, -66, -41, -4, 86, 35, -46, 14, -31, 32, 59, -71, -100, -67, -53, 93, 31, -28, 53, -16, 0, -45, 69, 88,
+		65, 92, 2, -2, 89, -25, -83, -22, -40, 96, -11, 84, 48, -29, 47, 14, -26, -83, -91, -62, 64, -53, 64, -91, 26, -82, -72, 14, 15, -10, -45, -7,
+		59, 74, 82, -37, -14, 90, -86, -85, 77, -3, 46, -32, -72, -98, 45, 18, -86, 86, 72, 95, -52, 49, -50, 56, -59, 47, 79, -79, -33, -82, 80, -5,
+		-1, 61, -2, -41, 63, -55, 65, -94, 16, -44, 92, 85, 52, 11, 79, -52, -52, -33, 49, 27, 19, -9, 8, -12, -9, -20, 84, -12, -22, 24, -15, -78,
+		8, 46, -24, 7, 1, -87, 43, 26, 57, 82, 70, -9, -96, -75, 91, 59, 37, 13, -5, -39, -83, 11, 48, -74, 60, 50, 32, -6, -68, 16, 13, -66,
+		-39, 11, 54, -12, -55, -51, -62, -91, -67, 74, 93, -94, -98, -12, 96, 46, -44, -16, -32, 1, -13, -21, 9, 44, 27, -47, 38, -54, -97, 92, 18, -23,
+		79, 31, 15, -6, -65, 26, 32, 67, 32, 60, 17, -84, 97, -38, 66, -69, 94, -39, -75, 75, 24, -22, 38, -26, 92, -16, -38, 93, 35, -36, -9, -22,
+		-37, 23, 47, 91, -56, -40, -11, 80, -74, -53, -47, -40, -61, 23, 81, 48, -7, -12, -45, -59, -5, 0, 33, 77, -98, -49, 51, -29, 72, -95, -5, -6,
+		-81, 40, 51, -8, 69, -75, 20, 28, -89, -88, 84, -62, -32, 18, -14, -26, -33, 18, 37, -91, 90, 99, -78, 42, 27, -18, 43, 60, -88, 49, 91, -91,
+		-81, -62, 46, -60, 92, -37, -28, 1, 50, -88, 38, -56, -66, -95, 90, 27, 89, -50, 38, 5, 25, 67, 92, 35, 45, 5, -10, 7, 66, 72, -24, 11,
+		-21, -58, 36, -15, 36, -81, 18, 14, 65, 48, 57, 49, -68, 90, 85, -19, -47, -16, -39, 73, -100, -89, 27, -25, 29, 53, -82, -58, -56, -76, 86, -93,
+		-37, -26, -90, 77, -35, -86, -53, -85, 36, -29, 80, -60, -97, 11, -13, -77, 88, -28, 98, -73, 66, 63, -89, -69, -66, -29, 70, 97, 26, -40, 78, 1,
+		30, -46, -42, 27, -15, -69, -62, 20, -66, -45, -95, 0, -40, -24, 4, 0, 88, 58, -6, 99, 43, -69, -51, 57, -16, 32, 31, 9, -79, -61, 3, 94,
+		85, -48, -4, 22, -78, -36, -60, -80, -39, -46, 33, 38, 54, 49, -52, -86, -42, -39, 62, 71, 34, 57, -38, -63, 99, -24, -31, -74, 50, 42, -21, 30,
+		-62, 52, -89, -37, -13, 5, 15, 26, -27, 90, -95, 52, 88, -83, 16, -43, 17, 85, -56, -37, -30, 25, -100, -72, -12, -54, 20, 84, 18, -57, 56, 55,
+		77, 78, 90, 33, -59, 40, -48, 46, -32, -95, 54, 30, -74, 93, 34, -45, 61, 97, 96, 57, 22, -65, -82, -47, 12, 50, -55, 33, -26, -9, -40, -41,
+		-4, -63, 52, 67, 36, -70, 49, 63, 75, 16, 86, -48, 7, 82, -20, 49, -83, -10, 1, -90, 90, 32, -71, -69, -58, -46, 59, -100, 2, -19, -62, 0,
+		-13, -89, 71, 70, -95, 45, 60, 25, -88, -3, -3, 60, 19, 90, 19, -74, 39, -99, 76, -54, 48, 99, -44, 52, -71, 88, 66, -22, -82, -55, 55, -70,
+		-86, 14, -3, 14, 9, -18, 6, -91, -91, -12, 84, -47, 67, 26, 27, -57, 94, 96, 85, -76, 68, 31, -1, 35, 88, -85, -69, 76, 58, 96, 32, 97,
+		-6, 26, 10, 53, -80, 18, -70, -29, 7, 78, 97, 76, 94, -12, -16, -45, 47, 75, -25, -31, 79, 69, -4, -31, 87, 15, -39, -1, 38, 60, 48, 94,
+		85, 7, 26, 94, -55, -7, 9, 44, 19, 41, -92, 33, -84, 39, -11, 83, -28, 21, 14, 10, 64, -88, 36, -39, 60, -38, 98, -56, 41, 94, -43, -18,
+		82, -44, 78, 39, -76, -56, 24, -92, -91, 26, -62, 39, -58, -37, 58, 48, -35, -45, 24, 14, 99, -74, 89, 1, 73, -40, -89, 15, -68, -63, 15, -78,
+		41, 11, 40, -41, -89, 99, -84, -68, -16, -50, 38, 65, -88, 30, -47, 99, 21, -81, 16, -54, -31, -47, 79, -16, 5, 31, -33, -28, 14, -70, 89, -2,
+		41, -59, 44, 50, 97, 68, -87, 70, 70, 84, 96, -66, 20, 44, -59, -88, 13, 33, -93, 62, -100, 49, -26, -86, 99, 18, -46, 65, -16, 2, 32, -65,
+		-81, 37, 1, -3, -17, -37, -44, 8, 20, -49, -75, 23, -24, -59, 19, 9, 44, 45, 7, -16, -26, -36, 7, -99, -5, -21, -79, -100, -63, -98, 37, -24,
+		59, 51, 68, 68, 54, 7, 68, -43, -76, 81, 90, -70, -84, -84, 55, 33, 96, -55, 35, -21, 83, 8, -97, 72, 79, -28, -38, -72, 45, -77, -50, -52,
+		-36, -68, -64, -51, -84, -66, -68, -100, 48, -32, 40, -5, -80, 31, 85, 15, 87, 78, 29, -45, -93, -68, 94, 37, -48, 3, 78, -21, 96, -2, -66, 86,
+		47, -44, -69, -44, -18, 40, 73, -19, 17, -95, 99, 11, 96, 78, -99, 50, -62, -83, -39, -71, 84, 4, 69, 14, -42, -46, -23, -59, -17, -66, -80, 66,
+		-100, -89, -30, 91, -9, -76, -53, -40, 6, -96, -24, -30, 89, 38, -4, 86, -94, 36, 45, 79, 91, 39, -36, -52, -41, 85, -23, -45, 86, -52, 37, -89,
+		3, 32, 88, 86, 65, -44, 10, 68, -64, 20, -13, -10, 81, -51, 78, 46, -100, -34, 45, 59, 13, 75, -87, -14, -81, 51, 34, -1, 7, -42, 56, 39,
+		80, -53, 17, -38, -43, -50, 6, -91, 92, -28, -21, -64, 28, 52, -46, 53, -4, 94, -27, 13, -40, 74, 38, -13, 99, 9, -63, 20, 24, -25, 16, -43,
+		-63, -22, 5, 31, 59, -23, 64, 29, -24, -9, 64, -52, -79, -75, 28, -69, 14, -15, -94, -46, 12, 61, 73, 16, 64, 74, -35, 61, -16, -28, 69, 81,
+		-31, -68, -39, 92, 1, 56, 28, -25, -61, -73, 49, 93, 92, 28, 64, 84, -3, -61, -23, 82, 87, 64, 75, -51, 2, -15, -62, 59, 27, -81, -70, -49,
+		-11, 75, 57, -100, 38, 25, -50, -96, -29, 93, -36, 11, 63, -29, 3, 67, 13, -49, 60, 80, 8, -87, -37, -72, -4, 54, -14, 68, -90, 35, -4, -37,
+		-82, -16, -29, 30, 35, 61, 55, 59, -86, -81, -85, 60, 46, -93, -49, 4, -76, 0, -59, -87, -58, 4, 87, 0, -11, -67, 89, 46, -18, -90, 1, 24,
+		44, 79, -26, 54, 43, 47, 29, 59, -6, 89, -32, -68, -63, -92, -74, -82, 86, -74, -21, 11, -94, -16, 38, 69, 10, -91, 48, 85, 11, -68, 60, -53,
+		-34, 33, 22, 10, -47, 31, 70, 65, 90, -66, 34, 90, 65, -63, 72, -80, -98, 94, -28, 76, 39, 83, 82, -16, -52, 61, 22, 12, 54, 60, 67, 12,
+		-89, 71, 96, -84, 97, -40, -34, -16, -47, -38, 16, -8, 9, -73, 6, 10, 83, 10, -49, 85, 44, -23, -15, 35, -28, 37, -47, 87, 48, 20, 91, -34,
+		24, 13, 51, 51, 69, 42, 80, 64, -12, 67, 65, -46, -75, 84, 74, -81, -87, 97, 38, 72, 17, -88, 55, 87, -37, -18, 80, 7, -92, -38, -94, -89,
+		-89, -70, 91, -22, -49, -2, 16, -4, 35, 63, 7, 76, -62, 24, -50, -87, -97, 15, -95, 54, 21, 7, -51, -15, -55, -43, -95, -39, 94, 17, 82, 77,
+		-12, -5, 66, -49, 74, -34, 36, 12, -73, -43, 22, -58, 23, -56, 6, -65, -6, 5, -40, -72, -9, 39, -90, -99, -95, 38, 18, 33, -89, -37, 2, -75,
+		80, -51, 75, 72, -51, 27, 24, 18, 38, -3, -16, -65, -27, -1, 55, -81, -92, -24, 92, -54, 95, -57, -37, 78, -83, 5, 62, 8, -80, -7, -11, -93,
+		-48, 92, -25, -39, -55, 18, 29, 88, -49, -6, -64, -9, -51, -32, -84, -6, 14, -73, -89, 16, 95, -27, 16, 73, -16, -28, 7, -97, -90, 48, 83, 46,
+		-30, 98, -11, -12, -44, -64, -76, 73, -66, 4, 15, -17, 20, 53, -83, -30, 49, -87, 57, -65, -69, 10, -49, 21, -57, -30, -36, 15, 83, 47, -29, -39,
+		-75, 74, -49, -55, -75, -62, -86, 79, -12, -3, 63, 94, -56, 71, 75, -69, -99, -92, 35, 68, 57, -10, -38, 26, 92, -6, -32, 21, -30, -63, -27, 49,
+		-96, -28, 16, 43, 82, -51, 12, -37, 61, 91, -47, 53, 33, 14, -63, 76, -96, -82, 6, 62, 56, -95, -69, -45, 34, 68, -56, -46, 68, -56, -63, 82,
+		-73, -92, -94, -69, -96, 70, 54, -96, -17, 5, 26, 56, -44, 70, 94, -40, 6, 86, 48, 11, 78, 13, -12, 24, -10, 6, -98, -36, 48, 9, -60, 85,
+		-69, 82, 63, 93, 47, 38, -28, -82, -69, -27, 6, 42, -47, -98, -15, 35, 97, 77, -28, 32, 94, -38, 72, -75, 31, 3, 24, 6, -47, 64, 50, -4,
+		-56, 9, 17, 2, -84, 88, -24, -12, -69, 51, -61, 32, 11, -31, 85, 94, 15, 36, 28, -39, -5, -96, 83, 73, -37, 50, -53, -96, 71, -41, -50, -60,
+		86, 67, 95, -72, 84, 58, -51, -57, -54, 96, -84, -48, 88, -7, -24, -12, -10, 57, -75, -80, 36, 36, 59, 44, 79, -72, 87, -65, -78, 67, 32, 66,
+		19, -100, -20, 81, 51, 50, 2, 40, 48, 93, 86, -22, 2, -48, -74, -96, -86, -20, 18, 45, -41, -33, -28, -38, 91, 95, 95, -5, -56, -100, 6, 92,
+		36, 29, 48, -70, 94, -68, 85, -18, 39, -62, -58, 90, -79, -53, 7, 71, 33, 4, -52, -80, -78, 56, -68, -25, 94, 74, -42, -92, 28, -28, -45, -78,
+		67, -15, 99, -61, -48, -45, -14, -1, -1, -99, -73, 44, -1, -28, 92, -68, -86, -10, 90, 19, 14, -56, -89, 93, 42, -42, 55, -86, 6, 98, 84, -16,
+		-59, 1, -77, -56, -34, 40, 98, -31, -43, 30, 30, 50, -37, 15, -60, 80, 90, -46, 17, 9, -64, 86, 16, -8, 89, 52, -7, -94, -46, 33, 38, -43,
+		49, 14, 23, 28, 26, -26, -16, 29, -29, 37, -91, 37, 97, -41, 1, 2, 96, -17, -90, 3, -44, -25, 75, -12, -83, -58, -11, 56, 91, -36, -33, 58,
+		-74, 32, -49, 57, 64, 39, 38, -89, 57, 75, -77, -50, 94, -65, -88, 21, 87, -90, -42, -53, -74, -99, 8, 8, -34, -96, 86, -42, 51, -72, 57, 46,
+		77, 51, 18, 52, -43, 37, -22, 4, 32, 32, -43, -74, 90, 53, 25, -48, 94, 72, 53, 76, 73, 14, 74, 52, 43, 39, -46, 25, 99, 65, -78, -70,
+		-26, 76, 79, 17, 46, -14, -36, 20, 48, -83, -12, 48, 45, 11, -93, -76, 26, 87, -43, 2, 96, 27, -20, 69, -71, -84, -66, -25, 53, 70, 8, -53,
+		-94, -74, -60, -42, -24, 7, -6, -7, 16, -38, -19, -28, -33, -17, -77, -10, 62, -11, -14, 82, 81, 72, 73, 12, 28, -98, -95, 66, 40, -61, 62, 60,
+		-56, 30, 32, -88, 86, -21, 52, 22, -84, -95, -80, -20, -81, 75, 35, -74, -61, 60, -44, 27, -81, 89, 21, 24, 95, -53, 40, 48, 52, -49, 11, -75,
+		8, 41, -45, -26, -89, -26, -59, -17, -5, 78, 17, -13, -47, 66, -26, 76, -58, 32, 56, 0, -18, -94, 84, 90, -35, -59, 35, 20, 85, 28, 78, -96,
+		-93, -87, 34, 22, -100, 75, 49, -73, -80, 55, 69, 94, 25, -14, -52, -100, 93, -45, 67, -71, -32, -71, -63, 97, 57, 90, 17, 76, -19, 48, 40, 27,
+		37, 51, 28, -92, 95, 29, -94, 63, 52, 93, -84, 53, 2, -34, -36, 74, -96, -78, 21, -15, -25, -47, -14, 4, -49, 68, 13, 32, -7, -65, -43, -51,
+		-29, 92, -20, 92, -46, 70, -100, -65, 17, -72, 20, -19, -30, 58, 27, -43, 92, -87, 25, 59, -53, 45, 30, -17, 33, -22, -100, -1, -6, 34, 44, 59,
+		95, 41, -11, -59, -31, 50, -80, 28, -4, -44, 62, -27, -73, -56, 80, 92, 28, -80, -24, -84, 64, -50, 50, 21, 61, -41, -32, 98, 98, 98, -100, 55,
+		-93, -60, -42, 20, -22, -30, 67, 48, -61, 5, 62, -25, -60, -27, -66, -84, 72, 48, -22, 69, 57, -15, 91, 39, 23, 10, -96, -81, -3, -79, -46, -31,
+		92, 55, -81, -2, 22, -10, 66, -35, -76, 39, 63, 22, -25, 22, 40, 15, -55, 54, -97, 50, 10, -29, -43, -52, 91, 35, 28, 71, -23, 22, -5, -100,
+		-46, 66, 98, -79, -3, 74, -53, 32, -8, -65, -5, 38, 25, 25, 72, 76, 1, -98, 94, 62, -59, -100, -55, -23, 34, 40, -36, 11, -65, 86, -36, 93,
+		-41, 98, -69, 70, -79, -61, -61, 59, 21, -28, -18, -8, -64, 18, -81, -63, -48, 89, -30, 16, -74, -87, 13, 32, 80, -46, -78, 62, 0, 44, 18, 98,
+		98, 56, -9, 22, 11, 13, 40, -19, -49, -83, 49, 82, -71, -62, -98, 71, -72, 89, 66, 35, -24, -38, -6, 48, 44, -29, 16, 36, -47, 9, -6, 43,
+		43, 18, 90, -95, 88, 99, -3, 42, -13, -35, -34, -38, -13, 23, 73, 29, 2, -5, 12, -10, -74, 81, -93, 43, 12, 34, 30, 5, 64, -61, 15, -21,
+		-73, 99, 58, -76, -5, -100, -70, 98, -93, 50, 80, 48, 31, 20, 26, -53, -59, 80, 69, -65, -8, 79, 78, 18, 4, -57, 66, -4, -38, 13, 86, -77,
+		-21, 9, -6, 65, 46, 39, -8, 10, -39, -1, 66, 62, -30, -70, 67, 73, -53, 23, 79, -81, -47, 87, -33, 92, -100, -39, -100, -10, -9, 78, 82, -29,
+		-92, 0, 9, 9, 61, 89, 67, 93, 45, -13, 73, -61, -26, 60, 90, 96, 37, -60, -78, -13, -17, 34, -63, -26, 25, -44, -59, -49, -4, -81, -74, 50,
+		90, 59, 81, -81, 37, -13, -51, 69, -42, -52, 97, 38, -34, -98, 37, -62, -18, 6, -47, 86, -16, 82, 94, 61, 59, -90, -85, 70, -8, 73, 50, 60,
+		46, -25, -63, 50, -1, 19, -37, -6, -73, -58, 50, 81, -96, -74, -27, 30, 48, 84, -71, 53, -99, 0, -63, -41, 50, 99, 20, -85, 87, -96, -7, 32,
+		-4, 65, 57, -10, -29, -98, -26, 69, 68, 8, -61, 90, -11, -85, 38, 39, -22, 67, 46, -56, -49, 1, 40, -2, 41, 9, 93, 61, 26, 14, -8, 27,
+		88, 7, 45, 91, -14, 71, 15, 72, -20, -24, 81, -88, -63, -76, -2, -51, 86, 80, 17, -24, 64, -56, 65, 31, 62, -15, 74, 50, -40, -83, 92, -71,
+		70, 16, 29, 5, 88, 39, -19, 74, -95, -60, -57, 96, 4, -50, 92, -77, 42, 37, 62, 51, 95, 80, -22, 33, -99, 45, -80, -92, -83, -18, 55, -18,
+		66, 21, -72, 98, -67, 89, -18, 22, -32, -13, -81, -29, -44, -45, -62, -72, -67, -92, -48, 78, 74, -82, 77, -43, 43, -85, -96, 53, -30, -40, -58, -27,
+		87, -96, 80, 15, 38, 11, -96, -29, -71, 90, -96, 3, 1, -95, 48, -10, 99, -48, 9, -28, -97, 82, 35, -60, -93, -34, -98, 89, 3, 3, -84, -24,
+		-71, 71, -6, -1, -71, 23, -20, -20, -97, 72, -81, -38, 62, 37, 49, -23, 1, 87, 22, -95, 80, -3, 63, 25, 70, 20, -72, -27, -34, -57, -28, -28,
+		55, -47, 75, 19, 82, -77, -66, -10, 68, 16, 68, 4, -54, -58, 62, -57, -74, 78, -86, -85, 73, -97, 5, -76, 96, -55, 28, -48, 91, 65, -91, 92,
+		-21, 53, 7, 38, 9, -42, -85, 48, 20, -84, -70, -82, -12, 2, -13, 72, -71, 0, 19, 67, -49, 0, 49, -26, 51, 60, 29, -64, -42, 6, 15, -36,
+		-13, 58, 8, -93, -28, 16, 31, 32, -10, -32, -90, 61, 22, 43, -20, 34, 77, 27, -8, 19, 93, -67, -24, 35, -49, 57, -69, -87, 49, 29, -48, 9,
+		59, -6, -70, 65, 55, -100, -22, 4, 33, 65, -62, -25, -72, 30, -13, 23, 69, 24, -48, -64, 6, 10, 43, 29, 1, 97, 97, -21, -8, -43, -63, -26,
+		11, -61, 63, -60, 14, -84, 69, 86, 69, 13, -37, 12, 3, 89, -98, -95, -88, -50, -12, 68, 17, 23, -87, -40, -95, 59, -6, -84, -54, -86, 45, -64,
+		-64, 17, 90, 30, -77, -33, -29, 11, 19, 31, 30, 58, 95, -25, -80, -38, 43, 24, -52, 39, -6, 43, 89, 14, -60, -82, 26, -77, 8, 69, 18, 35,
+		96, -91, -55, -96, 89, -76, -11, -70, 33, 58, -96, -88, -46, -38, -36, -47, -86, 70, 37, -31, -57, 10, 83, -74, 66, -90, -88, -49, -48, 55, 55, -36,
+		0, 73, -82, -66, -25, 50, 7, -76, 60, 77, -11, -47, 19, -70, -64, 45, 95, 16, -83, -18, -72, 10, -43, -85, -23, 17, -89, 73, -51, 67, 28, -79,
+		-67, -62, -94, -63, -33, 87, -72, 63, -71, -38, -67, -69, -89, -8, -76, -89, 7, 71, 68, -29, -46, 97, 74, -89, 41, 37, -70, -83, -8, -20, 91, 59,
+		40, 36, 3, -86, 52, -82, 1, -25, 36, -24, 36, -87, -6, -94, -38, 43, 31, -91, -90, -64, -97, 49, -36, -7, 41, -86, 37, -25, 87, -30, -29, -69,
+		-4, 56, 24, 0, 4, -30, 25, -7, -95, -11, -64, -8, 25, -87, 81, 63, -32, 54, -16, 49, 83, -16, 36, -31, -11, -8, -97, -72, -23, 33, 30, -4,
+		50, 46, -65, 93, 59, -83, -5, -51, 27, -58, -44, 50, -99, -89, -80, -46, -47, 16, -2, -97, -54, 87, 31, -7, -89, -94, -76, -40, 77, -70, -10, 30,
+		-56, 31, 55, -2, -60, 52, 64, 44, -54, -72, -92, 20, 18, -96, 29, -18, 39, 54, 12, -85, -100, 80, -94, 79, -66, -15, -96, -63, -23, -52, -69, 94,
+		-25, -96, 44, -68, 45, 13, 84, 17, -69, 67, -78, 55, -79, -19, -15, 30, 36, 32, -29, -53, 29, -32, 90, 16, 15, -82, -86, 49, -69, -97, -21, -31,
+		11, 33, 15, 15, 59, 68, -87, -74, 39, 94, -4, 13, -87, -6, 8, -72, 32, -86, -18, 3, -44, -68, 9, 61, -67, 45, -18, -19, 98, 18, -4, 72,
+		-19, -1, 99, -32, -67, 67, 56, -44, -31, -98, -12, -44, 66, 3, -18, 80, -25, -4, 6, 17, -20, -31, -78, -16, 16, -24, 45, 68, 17, -75, 3, -46,
+		-9, 70, 81, -42, 94, 76, 67, 58, -83, -36, -3, 34, 65, -20, -45, -61, -52, -80, -78, 8, -67, -40, -83, -58, 26, -65, 78, 90, 60, -37, -67, 29,
+		57, 41, 4, -42, -100, -20, 71, 13, 53, -63, 97, -52, -89, 74, 32, -45, 53, -69, 63, -88, -32, 83, 43, 23, 60, -61, -38, 3, -54, 93, -40, -31,
+		31, 96, -87, 0, -72, 1, 32, -19, 1, 80, 69, -57, -80, 69, 22, 74, 96, 76, 71, 65, -84, 36, 55, 74, 9, 1, -25, -73, 35, 41, 38, -20,
+		60, 64, -88, -76, 26, 16, 76, 83, 73, -60, 90, -89, -64, -41, 70, -61, 39, -82, 79, 34, -11, 72, -13, -13, -15, -74, 54, 43, -40, 55, -86, -28,
+		-5, 8, -85, 83, -33, -17, 38, -98, -52, 33, -99, -98, -42, 65, 52, -86, -72, 91, -57, -10, -100, 17, 29, -52, -9, -6, -38, -67, 26, -98, 19, -82,
+		-76, 73, 36, -43, 28, 69, -18, 71, -47, 77, 50, -41, -49, -31, 83, 92, -64, 25, -22, -7, 64, 70, 68, -79, 21, -11, 99, -13, -70, 91, 87, 74,
+		-68, 97, 32, -57, -71, -41, 31, 87, 9, 93, -77, 5, -18, 14, -16, -9, 60, 75, 88, 32, -70, -82, -56, -50, 16, -86, 98, 49, -36, 19, -50, -13,
+		-96, 43, 73, -34, -14, -42, 88, -8, 33, -73, 18, 3, 11, -29, 1, 35, -46, 3, 13, -57, 56, 26, 94, -58, -93, -3, 66, -90, 12, 4, 98, -68,
+		1, -4, 7, 1, 4, 88, -12, -90, 94, -20, 99, -46, -81, -94, -59, -14, -16, 7, -23, -54, 81, 11, 34, 15, 47, -68, -78, 39, 88, -7, 9, 18,
+		99, 45, 10, -22, 33, -70, 74, -54, 96, -46, 34, -37, 82, -94, 28, -67, -45, -55, 32, 13, 69, -61, -96, 20, 72, -17, -53, 74, 37, 28, 70, -47,
+		-56, 99, 12, -80, 19, 83, -8, 69, 25, 27, -36, 39, 0, -87, -14, 59, 18, -40, 15, 7, 45, 21, -15, -67, -83, 4, -46, -15, -50, 25, 14, 45,
+		64, 69, -4, 23, 76, 13, 75, -78, -78, -39, -59, 20, -90, 62, -17, -24, -66, 1, -66, 25, -25, -5, 41, 99, -66, -98, -27, -87, -54, 26, -44, -64,
+		53, 44, -65, -48, -50, -12, 76, 55, 27, -29, -40, 40, 34, -83, 29, 89, 69, -40, 36, 32, -60, 14, 39, 37, 71, -33, 26, -65, 15, -50, 77, -21,
+		-91, -20, 98, -50, 89, 87, -33, 49, 80, 91, -48, -48, 63, 62, -7, 99, -83, 74, -7, -39, -40, -89, 5, 14, -43, 25, 88, 86, 88, -66, -89, -56,
+		64, 45, -82, -79, 9, 15, 80, -68, -62, 45, 63, -77, 10, -46, -4, 62, 72, 67, -59, 96, -26, -21, -78, -20, 18, 53, 25, -3, -64, 12, 86, 65,
+		-18, -32, 44, -14, 21, -45, 45, -31, -83, -48, 27, 6, -17, 23, -28, 37, 40, 68, 94, 16, -47, -83, 59, 58, -76, 31, 5, -5, 84, -67, -3, 59,
+		89, -70, -88, 33, 10, -98, -17, -81, -27, 97, 90, 43, 18, 89, 76, 66, 25, 90, 95, -29, -3, 99, -82, 65, 39, 59, 84, 58, 81, 35, 51, -2,
+		26, -4, -3, 55, -28, -25, -13, 96, 49, 13, -27, 84, 34, -37, 95, 27, -47, -1, 75, 80, -17, 40, 11, 82, 72, 54, -43, -85, -41, -21, -53, -36,
+		-87, 43, -87, -48, 90, 88, 90, 5, 13, -68, -21, -28, 1, -5, 58, 66, -79, 92, 62, 67, 17, -88, -97, -24, 93, 24, 96, 65, -90, -98, 44, -88,
+		2, 97, 15, -4, -27, -77, -4, -25, 80, 50, -2, -83, 46, -95, -34, -43, -17, 72, 42, 61, 88, -4, 87, 39, 32, -70, -77, -9, 86, -24, -33, 86,
+		-82, -92, 62, 32, 91, -6, 57, 12, -8, 93, 83, 67, -75, -49, 89, -87, 98, 98, -29, 53, -4, 39, 6, 98, 60, -53, -96, 76, -58, -61, -83, -35,
+		34, 90, 20, 62, -16, 81, 30, 15, -10, -97, -26, -62, -46, -80, 53, 26, 20, -5, 55, -29, 96, 69, 86, -31, 13, 65, 31, 62, 56, 30, -18, 38,
+		-77, -4, -9, 77, -34, 42, -7, -27, -17, -42, -47, -32, 45, -35, 54, -14, -52, 11, 83, -69, -89, -58, 41, 32, 53, 24, -15, -56, -41, 8, 29, -45,
+		87, -39, -100, -97, 99, -62, 52, 67, 46, 1, 71, -40, -55, -26, 48, 2, 19, -22, -63, 85, 21, 67, -40, 20, 28, -24, -76, -92, 80, -28, 79, -49,
+		66, -48, -27, -69, 69, -93, -33, -18, 3, 78, -48, -7, -95, -95, -45, 45, -20, 70, -4, -6, 4, -56, 65, 47, 38, -96, -88, -22, -48, 15, -86, 46,
+		-5, -82, 96, -58, 77, -31, 84, -42, -34, 83, 12, 77, -72, -80, -51, -92, -78, -41, -65, 18, -80, -44, -12, -72, 97, 39, -100, 3, 95, -55, -51, -14,
+		-30, -28, -36, 99, -73, -20, 10, 66, -35, 36, -53, 45, -72, 1, 68, 72, 80, -100, 76, -82, -57, 80, 44, -15, 76, -89, 24, 78, 0, -67, -94, -31,
+		63, -44, 10, -53, 23, 7, 40, -71, -70, -96, 29, -80, 55, 85, -45, -26, 96, 13, -97, -64, 46, -70, 9, -49, -66, -29, -47, -21, -36, -20, -96, -99,
+		-46, -52, -47, -98, -61, 30, -61, -34, -30, -100, 24, 28, 22, 73, -15, 57, -34, -6, 39, 43, 2, -97, -5, 75, -90, 32, -92, -30, 51, -22, -11, 82,
+		25, 53, 67, 64, 63, -70, 97, 4, 69, 33, 33, 1, 13, -39, 36, -100, -92, -29, 65, 35, -8, 5, -8, 7, 31, -54, 23, -69, -85, 65, -93, -12,
+		2, 99, 72, 65, 1, -92, 62, 25, -51, -18, 74, -85, 8, -89, -69, -97, -96, 35, -20, 41, -79, 24, 35, 71, 32, -60, -24, -35, -6, -30, 44, -50,
+		20, 79, -23, 38, 3, 95, -12, -61, -24, -23, -81, -15, 60, 60, 44, -56, 91, -19, 5, -18, 22, -40, -58, -12, 68, -30, 54, -60, 64, 69, 74, 66,
+		-19, -5, -60, 38, -79, 55, 38, -64, 72, -71, -78, -37, 74, -43, -61, 3, -77, 52, -91, -76, 32, 1, -52, -13, -11, 63, -83, 23, 12, 52, -31, 58,
+		-41, 67, -8, 22, -2, 95, -71, 86, -43, -92, -5, -9, -100, 92, -55, -13, 96, -68, 5, 83, -13, -67, 99, -17, -35, -44, -74, -13, -79, -63, -79, -33,
+		-51, 5, -30, -5, -97, -97, -63, 12, 91, 72, 36, -34, -10, 55, 90, -62, -50, -73, -94, -36, -47, 38, -28, -22, 25, 89, 59, -59, 80, 84, 64, 93,
+		19, 80, 28, 22, -44, 66, 27, 29, 11, 62, 75, -27, 0, 12, 80, -48, -60, 79, 3, 24, 2, 44, -12, -95, 22, 79, -81, -2, -68, 37, 61, -8,
+		2, -90, 75, 47, -88, -54, -68, -97, 41, 96, -65, -18, 46, 43, 54, 59, 17, -65, 33, -14, 35, 81, 99, -93, 69, -16, 48, -21, -2, -84, -19, -34,
+		79, 15, 16, -59, 1, -82, 30, -83, -80, 18, -57, 35, 6, -2, 61, 41, 82, -69, -33, 41, 99, 61, 54, 77, -85, 89, 14, -81, 64, 27, 5, -15,
+		-14, -46, 98, 40, 75, -12, -90, -31, 74, -29, -69, 34, 63, 9, 15, 56, -62, 95, -11, -18, -15, 54, -46, 14, 32, 54, 10, -49, -78, 22, -94, -22,
+		57, -29, 84, -96, -25, 39, -8, -68, -86, -2, 12, 90, 2, -7, -72, 8, -42, 85, 21, -66, -61, 31, -49, -92, -49, -66, 3, -96, 93, -91, 13, 95,
+		-85, -84, -94, 87, 24, 34, -65, -75, -25, -37, -73, -80, -56, 82, -15, -61, 87, -45, -67, 81, -54, 74, 41, 35, -48, 32, -99, -23, 38, -53, 85, 33,
+		96, -21, -80, 66, -11, 44, -51, -33, 35, 45, 9, -69, -4, 6, -29, -9, -19, -80, 51, -90, -86, 87, -15, -9, -12, -45, 94, -95, -99, -82, -73, -100,
+		-72, -9, 52, -17, -49, -100, 79, -63, -76, 51, 33, -8, -25, -14, -74, -88, 59, 23, 69, -39, 90, -16, -71, -85, -59, 71, 10, 88, -59, 90, -15, 5,
+		92, -81, 85, 1, 18, -100, -67, -96, -9, 96, 74, -8, -7, -2, 81, 66, -29, 67, -90, 82, -83, -82, 97, 93, 47, 50, -74, -96, 72, 86, -67, -16,
+		-63, 13, 91, -44, -72, 57, 24, 42, -40, -11, -46, 18, 85, -18, 4, 60, 32, 53, 39, -79, 42, 9, 91, -40, -88, -18, -33, 91, -62, -41, 95, -92,
+		-98, -61, 63, 18, -84, 86, -88, 77, 11, 17, -46, -47, 84, 38, -25, 28, 16, -67, 42, -19, 35, 59, 22, 37, -57, 79, -83, 53, -87, -40, 72, -22,
+		-73, 94, -88, -86, -51, 76, -10, 40, -99, -49, -14, -75, -94, -66, 91, -85, -18, -31, -70, -58, 66, 78, 57, -14, 16, 58, -87, -36, -56, -44, 89, 86,
+		57, -61, 62, -39, 78, -55, 77, 47, 89, -60, 26, 77, -17, -17, 61, -74, -84, 31, 36, -90, 47, 92, 78, 93, -63, 23, 97, 52, -72, -61, 32, -20,
+		-65, -67, -40, 20, 44, 8, 89, 25, -18, 75, 86, -85, -6, 82, -13, 48, 8, 15, -16, 10, -59, 96, 11, 12, 26, 17, 31, -93, -88, 66, 52, 26,
+		-7, 83, 75, 39, 98, -4, 25, -86, -26, 48, 45, 71, -48, -41, -26, -22, 69, 0, -50, 11, -50, -93, -20, 89, 70, -18, -9, 92, 53, -88, -69, -61,
+		21, -27, 85, -100, -57, 40, -62, 21, -61, 83, 90, -31, -93, -66, 8, 30, -67, 43, 4, 24, 76, 40, -67, -54, 71, -16, 69, 80, -50, 68, -45, 65,
+		34, -38, -30, -84, -46, -60, -86, -32, -61, 46, -28, 44, 27, 42, -2, -26, 75, 76, -79, 93, -27, 33, 40, -62, -31, -9, 91, -16, -88, 19, 70, -60,
+		27, -16, 90, 26, -96, -61, 95, 70, 71, 92, 5, -40, 86, 9, 50, -44, -60, -52, 57, 51, -8, -69, -60, 25, 5, 62, -32, 82, -17, -30, -65, 27,
+		91, 8, -61, 49, 29, 84, -7, -33, 93, -23, 79, 48, -4, -33, 42, 39, -3, -2, -24, -38, -76, -36, -3, -15, 88, -10, 11, -92, 60, 24, -16, -34,
+		-48, -96, 69, -33, 99, 20, -46, 76, 25, 93, -31, -27, 9, -2, 56, 37, -56, -14, -84, 47, -95, 45, 71, 54, 4, 65, 99, 67, 81, 22, 97, -88,
+		-69, -50, -3, 10, -59, -18, 97, -62, 82, 50, -1, -33, -46, 36, -51, -42, -83, 2, -20, 95, -26, -34, 56, -38, 94, 84, 1, -11, -78, -21, -29, 52,
+		35, 32, -45, 89, 63, -73, 95, -60, -52, -47, 77, -54, 8, -91, -51, 86, 85, -92, 73, 72, -24, 58, 93, 73, -96, 30, -79, 8, 50, -55, 66, -83,
+		70, 34, 48, 58, -29, -97, 22, -36, -79, 86, 98, -55, -38, 62, -39, -48, 80, -65, 18, -82, -79, -48, -73, -9, 40, 43, -74, 49, 35, 85, -37, 76,
+		69, -19, 72, -59, 20, 20, 46, -65, 87, 15, -76, -78, 78, 29, 90, 55, 46, 63, 15, 78, 63, 6, -85, 8, -43, 51, -12, 67, -46, 41, -63, 76,
+		-93, -81, 21, 95, -58, -32, -70, -73, 90, -29, 35, 67, 34, 33, -39, 1, -21, 99, -92, 74, 83, 96, -41, -40, 70, 70, 34, -64, -9, 1, -53, -24,
+		31, -35, -51, -44, -37, -54, -75, -91, 99, -30, -33, -70, 37, 11, 77, 39, 87, 95, 7, -87, 69, -71, -42, -77, 35, -30, 22, -79, -56, -94, -70, 93,
+		5, 44, 45, 17, 99, 89, -76, 21, 63, -80, -8, -48, -5, 84, -17, 14, 43, -36, -43, -51, 34, -80, 49, 52, 30, 96, 13, 47, -32, 45, -33, 78,
+		48, 96, -86, 61, 20, 45, -3, -2, 69, -60, 49, -6, -25, -27, -59, 89, 99, -56, -18, -34, -73, -36, 3, -73, 81, 46, -86, 58, -100, 35, 44, -96,
+		-42, -44, 4, 57, -66, -58, 50, -63, 16, 47, 64, 36, 65, -56, -16, -55, -6, -9, 28, 2, -92, -54, 13, -70, -62, -11, 80, 68, -36, 76, -88, 25,
+		-45, 49, -54, -67, 40, -94, 8, -8, -58, 10, 96, -80, -17, 37, 89, -18, -40, -48, 58, 50, 43, -88, 77, 8, 9, 44, -72, 1, 55, 46, 73, 65,
+		-99, 80, 35, -10, -55, 15, 0, -5, 7, 87, -86, 34, -5, 66, -13, -59, -65, 19, -23, -23, -34, -25, -45, -50, -57, -30, 71, 26, -45, -40, -95, -68,
+		36, -81, 91, -65, 36, 72, -74, 67, -38, 15, -34, -53, 49, 52, -52, 25, -7, -68, 85, -84, 23, 6, 12, -91, 39, -70, -2, 79, 22, 88, -29, -61,
+		34, -97, 74, -65, -10, -84, 71, 77, 79, -66, 39, -60, -52, 3, -18, -71, 61, 37, 96, -25, -36, -32, 94, -76, -64, -93, 48, 7, -9, -48, -78, -96,
+		55, -79, -7, -14, 73, -43, 93, -87, -78, 89, 41, -95, 52, -100, 18, -36, -12, 2, 39, 49, 87, -54, -78, 59, 78, 46, -67, 0, 98, 35, -97, -23,
+		-64, 40, 75, -75, 80, 89, -27, -23, 91, 90, -58, 55, 80, -86, 6, 40, -28, -29, -47, -75, 55, 64, -95, -97, -75, 44, -47, -78, -24, 23, 30, 61,
+		36, -41, 38, 57, -80, -74, 75, -83, 41, -52, -100, -10, 72, 20, -94, -80, -1, -90, 60, -92, 83, 89, -77, -92, 89, -40, 30, 12, -89, 42, 11, -38,
+		-35, 34, -5, -97, -16, 86, 27, -1, 98, -8, -63, -31, 88, 16, 70, -81, -85, -71, -32, 6, -10, -61, 3, -89, 52, -66, -86, 55, 37, -8, -5, -44,
+		3, -82, 16, -82, 66, 91, 37, 21, -82, -58, 93, 31, -81, -43, 12, -74, 95, -47, -86, -17, -54, 66, -79, 9, 41, 48, 91, 95, 9, 8, 63, -97,
+		64, -18, -40, -3, 19, -76, -73, 65, -67, -36, -100, 28, 46, -67, -50, 18, -44, 6, -27, 17, -61, 54, 35, 89, 17, 43, 18, -39, 95, 18, -30, 44,
+		39, -67, -23, 30, -22, -95, 73, 94, -8, 38, -83, -67, -62, 96, 36, 95, -96, -53, 43, 13, 73, 77, -75, 21, -2, -91, -42, 8, -87, -65, -2, -31,
+		21, -64, -2, 42, 28, 3, -92, 44, -37, 13, 95, -1, 47, 6, 65, 98, -34, -90, 76, 42, -49, -37, 54, -68, 7, -76, -90, -13, 34, 95, -39, -6,
+		25, 55, -22, -66, -55, -1, -58, -100, -95, 14, 22, 33, 82, 18, -71, -86, 43, -66, -49, -72, 30, 73, -44, -80, -87, -93, -85, 16, -36, 65, -10, 85,
+		-28, 99, -99, -62, 86, 56, -84, 31, 8, -4, 79, 45, -64, -57, -16, -11, 75, 66, -76, 37, 30, -37, -71, -79, -25, 56, -64, -19, 17, 51, -47, -90,
+		79, 55, 21, -76, -15, -4, -29, -96, -93, -18, -62, 70, -63, 20, 5, 33, -31, -92, -21, -27, 38, 50, 90, -30, -28, -71, 20, 25, 5, -51, 33, -88,
+		-20, -94, 89, 18, -26, 7, 94, 57, -79, -35, -91, -85, -55, 40, -53, -75, 59, 33, 7, 17, 3, -99, 18, -44, -2, -4, -87, 4, -89, 33, -17, 27,
+		43, 79, -55, 98, -98, -86, -35, -84, -16, 23, 44, 91, 12, -88, 77, -4, -82, -18, 10, -48, -52, 5, 1, 61, -88, -23, -15, 21, 93, -43, 12, -79,
+		-61, 0, 1, -83, 76, -60, -97, -25, -39, -25, -40, 88, 36, 37, -2, 52, -13, 56, 48, 67, -96, -40, 40, 14, -89, 54, 51, -31, -18, 43, -61, 17,
+		35, 40, -7, 72, -27, 86, -37, -50, 75, 18, -29, 55, 82, 19, 31, -61, -14, -39, 26, -78, -22, 29, 63, -84, 33, 51, -43, -51, 86, 17, -35, -60,
+		91, -70, 41, 20, 65, -78, -16, 67, 71, -19, 82, 69, 85, -62, 85, -52, -25, -75, -87, 98, 9, 56, 16, -88, 75, 35, 72, 42, 95, 86, 65, -11,
+		84, 42, 38, -25, 65, -11, -85, 97, -77, 91, 90, 9, -80, -66, -22, 10, -85, 93, 4, -11, -81, -14, -44, -80, 68, 72, -56, -27, -24, -46, 87, -70,
+		77, -77, -21, -52, -84, -15, 58, 3, 99, 2, 54, -43, 30, 36, -97, -9, 23, 1, 84, -14, 60, -50, 74, -45, 2, 36, 29, -5, -3, 65, 53, 78,
+		-84, -91, -45, -90, 28, 28, -65, -2, -14, 91, 53, 71, -100, 27, 81, -41, -70, 90, -25, 19, -65, -2, 21, -65, -19, 6, -14, -96, 66, -98, -10, 56,
+		-16, -32, -86, 89, 41, 86, -77, 52, -75, 7, 47, 19, 15, -6, -92, -36, -44, -75, 78, -57, -39, -30, 95, 18, 43, -27, 62, 52, 71, -51, 17, -99,
+		92, -29, 70, -85, -54, 80, -77, -23, -74, 78, -93, -58, 54, 73, -51, 50, -12, -67, -100, 79, -35, -89, 16, -54, 86, 2, -82, -96, -49, -13, -49, 44,
+		67, -39, -87, -30, -39, 89, -100, -45, -40, -6, -53, -5, 1, 62, 14, -16, -87, 41, -1, -64, -10, 26, 82, 33, 82, 76, 80, -82, -20, 77, -100, 98,
+		78, 11, 79, 95, 12, 14, 59, -59, -9, 54, 75, 60, 92, -45, 17, -6, 73, -80, -7, -2, 74, 3, 90, -76, 15, -42, 80, 89, -51, -53, -40, -95,
+		30, 55, 64, 52, -87, 15, 88, 49, -7, -60, -72, -59, -53, 49, 96, -57, 83, -41, -69, -33, -80, 80, -86, -78, 94, -34, 39, 77, 48, 20, 79, 53,
+		45, -27, 55, -50, 64, -2, -90, 83, 24, -70, 26, 33, -63, 56, 24, 45, 11, -40, -66, 71, 2, -68, -38, -97, -8, -48, -53, -55, -27, -5, -81, -24,
+		79, -58, 98, 62, 67, -19, -100, -59, -50, -95, 0, 70, -81, 79, -88, 40, 86, 90, 96, 13, 90, -47, 27, 42, -27, 82, -45, 5, -92, -91, -10, -71,
+		-86, -98, -69, -56, 79, -35, 91, 21, 46, 90, -78, 58, 51, 86, -89, -52, 42, 4, -98, 91, 41, -63, 42, 17, 80, 42, -29, 16, 51, -68, -77, -41,
+		40, -63, 63, 3, -74, -66, -84, 1, -40, -14, 91, 65, 37, -73, -41, -95, 88, -92, -74, 41, -92, 66, -68, 14, -95, 7, -95, -30, -92, -94, -5, -34,
+		-55, -10, -24, -65, -76, -49, 36, 22, 46, -36, 75, 32, 1, -66, 20, 80, 14, 48, 34, 1, -70, -17, 55, -92, -3, 97, -80, -85, 91, -52, -4, -70,
+		-14, -59, -37, 31, -64, 69, 97, -39, -36, -40, -30, -91, 98, -22, 80, 75, 18, -75, -86, -99, -42, -50, -77, 4, 43, -72, -51, -7, -96, 87, -64, 83,
+		81, 76, 3, 56, 51, -41, -88, 9, -4, -84, -1, -57, -7, 4, 25, 70, 83, -63, -53, 34, -70, 77, -85, 85, 33, 52, -36, 77, 21, -34, 59, 55,
+		-22, 71, -21, -15, 82, -58, 9, 25, 53, 28, 33, 65, 43, 8, -35, -70, -66, -67, 78, -61, 93, 71, -99, -37, 73, -75, -15, 47, 41, -68, 65, 17,
+		61, -76, 44, 19, 56, 63, -30, 18, 63, -56, 66, -44, -63, 97, 56, -17, -65, 21, 28, 74, -3, 71, -16, 66, -96, 41, -51, 90, 51, 60, 21, 32,
+		5, 35, 70, -23, -21, -30, -16, 39, 18, -69, 5, -23, 99, -81, -32, 74, 7, 52, 17, -87, 81, 34, -14, 28, -62, -24, -56, -12, 72, 69, -14, -92,
+		-58, -31, 21, -52, 38, 68, -78, -86, 60, -88, -81, -72, 76, -16, -46, -83, 79, -49, 68, 85, 88, -27, -13, -46, 11, -91, 88, 45, 89, -50, -47, -48,
+		72, -67, -40, 49, 76, -61, 81, -35, 13, 24, -59, -59, -65, -15, 58, 53, 2, -77, -66, -1, 35, 95, -44, 47, -27, 9, 59, -98, -37, 30, 84, 24,
+		-60, -60, 90, 32, -100, 36, -82, -82, -50, 76, -100, 17, -59, -38, 51, -3, 49, 93, 36, -1, -97, 28, 83, 9, -34, -42, -55, -8, 18, 65, -48, -5,
+		-38, 57, 19, -71, -8, 44, -83, -75, -83, 17, -94, 17, -40, 71, -22, -54, -72, -79, 17, 87, 83, 28, -27, 74, -87, -5, -99, -71, 48, 47, 3, -1,
+		-75, -20, -9, -42, 7, 18, -2, -95, -91, 24, 3, -96, -64, 34, 69, -22, -3, 67, -13, -68, -94, 39, -12, 89, 40, 58, 11, 63, 14, 96, 63, 7,
+		12, -55, -89, -76, -74, -84, 17, -70, -39, 89, -78, 52, 71, 55, -80, -83, 4, 38, -43, -62, -54, -84, 78, 72, 7, 9, 7, 39, 51, 47, 41, -91,
+		-13, -51, 89, -40, -72, 98, -89, -24, -63, 24, 22, -99, -83, -93, 79, -35, -79, 86, -45, -61, 19, 69, 59, -31, 73, 11, -83, -5, -17, -99, -16, 31,
+		18, -75, -34, 83, -94, -13, -14, -58, -93, -19, -54, -37, 8, -76, -100, 85, 69, 89, 67, -43, 26, 96, 38, 5, -45, 86, -58, 77, 4, -58, 56, 27,
+		-92, 89, -17, -67, 74, -66, 10, -71, 52, 83, -40, -44, -30, -30, -68, -28, -58, 34, 17, -79, 70, -93, -44, -70, -25, 51, 6, 45, 96, -99, -84, 87,
+		-86, 9, 91, 97, 65, -3, -30, -94, -11, 87, -70, 46, 30, 95, -56, 44, -8, 53, -16, 96, 43, -48, -96, -24, 38, -87, -23, -67, -12, -7, -76, 30,
+		57, -11, 57, -91, 77, -27, 55, -40, -99, 24, 65, 49, 91, 91, 83, 13, -71, -11, -95, 36, 18, -80, 32, 34, 74, 47, -80, 18, -30, -23, 64, -35,
+		62, 31, -6, -6, 35, -98, 25, -27, 35, -14, 20, -78, -88, 63, 81, -49, 29, -71, 55, 51, -20, 79, -67, 18, 63, -38, 36, 9, -36, -34, 64, -10,
+		-54, 59, -76, 19, 76, -34, -17, 64, -58, -76, -48, 57, 48, -58, -89, 61, -71, 55, -10, 82, -75, -29, 24, -9, -99, -5, -99, -30, 67, -98, -53, 79,
+		-38, 51, -11, -71, -9, 81, -37, -14, -74, 38, 32, 59, -43, -79, 97, -99, 50, 8, 19, 80, 48, 18, 13, 71, -69, -88, 38, -31, 71, 31, 72, 76,
+		-45, -50, 52, 80, -55, 66, -66, 18, -42, -45, -57, -45, 34, -60, -84, 99, -76, -53, -21, -84, -89, 78, 3, -89, 50, -99, -3, 36, -38, -3, -73, -80,
+		46, 39, 81, 51, -40, 9, 48, -82, -76, 99, 74, 34, -15, -56, -69, 0, 71, 62, 31, 52, -96, -95, 35, 64, -4, -56, 91, 77, -17, 94, -3, 40,
+		-5, -56, -57, 7, -17, -25, -28, 17, 86, 19, 92, 42, 4, 27, 63, 70, -70, -44, 38, -47, -73, 29, -49, 82, 39, 12, -4, -23, 63, -51, -3, -27,
+		18, 53, 22, -94, 7, 58, 58, -60, -70, 59, 91, -84, 4, -3, 19, -74, -41, 30, 74, 66, -13, -92, 12, 17, -58, 16, 19, -36, -66, -38, -19, 65,
+		-68, 34, -27, 17, 16, 62, -50, -47, 78, -57, 57, -47, 40, 64, 85, 91, -56, -43, -38, 20, -57, 93, -91, -72, -31, -44, -13, -90, -88, 93, 81, 83,
+		27, -54, -22, -76, -63, -30, -30, -51, 51, 38, 10, -46, 43, 36, -96, 42, -94, -15, 66, 41, 81, -43, -18, -34, -62, 44, -80, -56, 35, 26, 92, 86,
+		-32, -71, 7, 8, 51, -34, -87, 73, 56, -79, 53, -52, 1, -76, 36, 27, 4, 39, -58, 52, 58, -95, 57, 68, -40, 69, -57, -30, 65, -7, 80, 16,
+		-48, 92, 88, -39, 13, 88, 85, -62, -72, 8, 4, 15, 31, -15, 94, -49, -6, 89, 65, -72, -98, -81, -60, -69, -66, -61, 83, -22, -77, -25, 23, 59,
+		40, 86, 34, -28, -92, 6, -91, -29, 92, 53, 71, -68, 33, 81, 17, 74, -26, 50, -77, -90, -44, 11, 75, -90, -14, -17, 29, -99, 93, -53, 14, 49,
+		19, 10, -59, -95, 25, -74, 94, 38, 21, 42, -91, -8, -76, 11, 22, 20, -26, 10, -46, -39, 90, 11, -48, -24, -54, 14, 7, -81, 55, -61, 18, -25,
+		30, -6, -56, -24, 18, 21, -42, -14, -10, -2, 70, 58, -38, -32, -66, -17, 59, -48, -43, 76, -26, 0, 47, -66, -77, 55, -54, 49, 87, -60, -4, 8,
+		-38, 1, -48, 76, 56, -96, 33, 69, 6, -95, 77, -35, 54, -59, -98, -91, -28, -54, 34, 99, 38, -46, -78, 74, -89, -70, -94, 68, -4, 94, -56, -28,
+		-91, -85, 78, -81, 90, 99, 28, -89, 40, -79, 4, 61, -25, -88, -24, 16, 58, 30, 55, 16, -8, -9, 4, -91, 73, 30, 35, -52, -35, 31, -95, -95,
+		80, 80, -41, 60, 96, 38, 60, 8, -29, 91, 99, -84, 37, 83, 25, -90, 13, 5, 93, 96, -26, -65, -90, -58, 84, -52, -34, 56, -95, -21, -48, -81,
+		82, 11, 55, 9, -11, 51, 81, -67, -90, 9, -16, 65, 76, 79, 9, -74, -55, -84, -50, 63, 21, 41, -64, -84, 5, 32, -4, 85, -40, -36, -22, -13,
+		85, -66, 55, -25, -92, -65, -7, -37, 18, -7, 88, -30, 98, -35, -3, -59, 53, 27, 83, 2, -73, 61, -31, -90, 36, -96, -80, -65, 56, -81, 39, 2,
+		-23, -71, -43, -47, -4, 19, -34, -85, -9, 7, 77, -18, 83, -52, -76, 89, 73, -54, -85, -22, 97, -1, -64, 95, 99, 85, -90, -62, 44, 0, -2, -81,
+		16, 41, 56, -17, -84, 93, -44, -69, 89, -78, 55, 63, -15, 11, -1, 3, -96, 73, 32, 96, -47, -17, -6, 78, 14, -16, -32, 37, -4, 95, -61, -41,
+		43, -64, 88, -40, 81, 99, 82, -81, 8, -79, 35, 33, 44, 23, 65, 15, 4, 18, -58, 98, 46, -27, -70, -31, -82, -75, -44, 81, -41, -93, -47, 52,
+		-43, 86, 19, -99, 78, 29, 42, -65, -84, -57, 39, 73, 57, -77, 21, -46, -51, -88, 73, -99, -26, 56, -32, -65, -75, 58, -3, 15, 85, 61, 46, -12,
+		-74, 69, 42, -15, -91, 53, 52, 18, -9, -60, -83, 6, -15, -27, 26, -59, -35, -26, 47, -40, -39, -10, 25, 52, -53, -56, 32, 25, -50, -78, -13, -38,
+		-53, 24, 61, 99, 19, -86, -54, -25, 35, 1, 80, 49, -27, -55, -70, -95, -97, -25, -8, -60, 34, 91, 29, -24, 71, -28, 47, 49, 53, -58, -13, -31,
+		25, 24, 9, 86, 62, -56, 66, 62, -73, -94, -30, 89, 15, -29, 9, 4, -88, -1, 38, -12, 9, 16, -71, 52, -68, -86, 90, -23, 79, 92, 95, 83,
+		2, 99, -4, 48, -35, -3, 20, 45, -57, -73, 84, 87, 30, -34, 9, -53, -77, 12, 78, -15, -14, 71, -89, -30, 34, 53, 46, -18, 63, 86, -93, -42,
+		-64, 74, 22, 12, -78, -91, -13, -62, -28, 46, 25, -23, 19, -99, 96, 25, 20, 99, 25, -23, 86, -86, 31, -12, -29, 8, 20, -100, 7, -94, -64, -45,
+		-4, 28, 10, 27, -41, 12, 77, 13, -69, 80, -31, -7, -34, 3, 31, -57, -97, -37, 66, 85, -61, -48, 82, -38, -89, -98, 85, -86, -35, -12, -53, 84,
+		36, 46, 69, -44, 48, 27, 94, -29, 25, 17, 57, -72, -16, 86, -13, 84, 69, -42, 84, 53, 78, -81, -68, 40, -20, 61, 14, -64, -79, -65, -53, 23,
+		81, -47, 77, -93, 30, -61, 52, -34, 75, -52, 8, 9, -12, 1, 79, -54, 50, -66, 24, 39, -14, -87, -47, 31, 70, 76, -22, 97, 65, -9, -31, -20,
+		20, 50, -55, -27, -45, -51, 66, -46, 96, 65, 97, 64, -55, -92, 12, -9, -6, -95, -67, -11, -3, 75, -16, -26, -77, 16, -35, 64, -39, 38, -72, -5,
+		-96, 96, 47, -36, 59, 64, 90, 75, 47, -95, -76, 22, 96, -23, -69, -50, -84, -19, 0, 42, -86, 5, -55, 33, 39, 18, 17, 92, -56, -74, -5, -88,
+		-56, -34, 57, -15, -30, 29, -79, 74, 91, 69, -14, -77, 20, -67, 65, 18, 20, 15, -44, -21, 58, 10, 96, -84, 14, -41, -69, 47, -65, -5, -96, -63,
+		40, 57, 2, 58, 28, 37, 79, -96, 16, 95, 98, -98, -5, -23, -82, 47, 68, -56, -47, -5, 57, 84, 0, 15, -20, 84, 10, -66, 59, 0, 83, -86,
+		29, -47, -38, 17, 66, -59, 94, 46, -69, -86, 52, 77, -14, -80, 98, 38, 9, 53, 71, 76, -81, -14, 79, 43, 90, -54, -52, 3, 72, -78, -99, 80,
+		46, -23, 52, 17, 57, 97, -27, 37, 96, 71, -19, -43, -59, -20, -92, 83, 30, -39, 59, 40, -46, -9, 95, 14, -32, -5, 95, 76, 16, -26, 59, 90,
+		3, 53, -75, -86, 75, -79, -70, 49, 74, -100, 49, 53, 6, 95, -43, 32, -44, -99, 21, 35, -1, -30, -40, 55, 83, 17, 1, -50, 34, 7, 71, -97,
+		2, 82, 62, -35, -13, 80, 43, -92, 29, 62, 49, -76, -19, 61, -76, 50, 81, -15, 13, 87, 86, -3, -73, -59, -44, 46, -62, 7, -93, 54, 94, 17,
+		93, -18, -51, -63, 58, 91, -89, 27, -58, -52, 79, -26, 57, 2, -85, -9, -21, 83, -10, -10, -81, 48, -59, 51, -77, 56, -93, 92, -34, 77, -96, 2,
+		-92, 99, 79, -100, -26, 10, 29, 15, -33, -71, 48, -62, -66, -67, 47, -63, -67, 97, 38, -66, 39, 92, -92, -80, -36, -7, -48, 33, -40, 2, 12, 49,
+		-43, 40, 84, 96, -92, 12, 1, -46, -33, 58, 61, -69, -6, -47, 49, -99, 19, 71, 9, 55, 67, -24, 77, 83, 47, -25, 48, -86, 33, -65, 8, -39,
+		-26, -46, 33, -76, 18, 65, -83, 62, 50, -92, 16, 97, 40, -63, -34, -25, -5, -36, -66, 68, -48, -51, -74, -95, 14, -21, 73, -9, 3, 55, -40, 50,
+		42, 68, -76, -82, 6, 51, -6, 31, -83, 41, -14, -38, -99, 95, 19, 33, -21, 81, 31, -65, 10, 67, -17, 76, -82, 90, -49, -65, 35, 99, -26, -47,
+		41, -18, 68, 52, 97, -48, 17, -99, -6, -22, 57, -3, -64, -10, -66, -43, 79, 51, 77, 25, 35, 84, 30, -38, 79, 26, 28, -61, 49, -18, 90, -100,
+		-64, 41, -100, 81, 7, -65, -91, 20, 85, 60, 37, -15, 18, 36, 47, 7, -41, -41, 58, -93, -56, 56, 11, 24, -28, -89, -34, -46, 97, 59, 66, 74,
+		-75, -95, -60, 81, 50, -54, -30, 16, 17, 10, 52, -58, -38, -31, 47, 95, 17, -23, 11, -73, -75, 31, -55, 92, 18, -46, 9, -20, -66, -93, 49, 10,
+		-72, -57, -64, -73, -72, -22, 24, 30, 35, 66, 16, 84, 34, 97, 60, 59, -4, -99, 48, 9, 16, -34, 8, -51, -81, 32, 52, -97, -1, -40, -60, -17,
+		-58, -93, -89, -62, 83, 79, 52, 98, 41, 60, 44, 78, -83, -44, 98, 38, -23, 16, 56, 21, -55, 18, -100, -51, -14, 36, -16, 3, -100, 88, 60, -9,
+		52, -38, 43, 85, -37, 81, -91, 52, -51, -34, 1, -74, -92, -33, 69, -15, -21, -1, -28, -47, 90, 13, 48, 43, 36, 45, -31, -82, 87, 36, 61, -67,
+		-71, 21, -76, 98, -63, -56, -71, -57, 62, -32, 17, -27, 20, 58, 0, -15, 37, -76, 78, 65, 64, -9, -41, 31, 2, -78, 61, 12, -43, -80, 34, 43,
+		-81, 56, 75, 52, -66, -81, 42, 90, -22, -63, -63, -32, 74, 38, -94, 5, 58, 42, 6, 8, -15, 49, 61, -79, -7, 68, 27, -43, 86, -14, 3, 49,
+		1, 79, -41, -70, -25, 63, 58, -50, -81, 64, -80, -5, -40, -85, -62, 97, -52, -73, -5, 98, 81, 68, 79, 45, 73, -84, 9, 54, 86, -79, 10, 43,
+		-85, 56, -25, -90, -48, 86, -39, 21, 83, 79, 78, -56, -69, -63, 46, 59, -24, 94, -95, -71, 48, -6, 88, 50, -11, 88, -39, -66, -47, -89, -20, 69,
+		26, -5, -80, -29, -7, -64, -26, -15, -90, -56, 71, 8, 10, 33, -20, -85, 40, 92, 11, 29, -16, 56, 77, 97, -13, 87, 43, 10, 82, 80, -62, 31,
+		-2, 98, 5, 85, 42, -70, -43, -99, 79, -12, -93, 44, 23, -97, -32, -79, -7, -100, 72, 8, -56, -49, 21, -50, 16, -81, -49, -81, 88, 60, 16, 9,
+		0, 99, -50, 73, -85, 48, 64, 69, 60, 69, 12, -50, 8, 48, -99, 13, -82, 10, -60, 7, 95, -11, 43, -65, -12, -77, -13, 57, -54, 19, 36, -63,
+		36, 70, 24, 12, -56, -93, 3, 43, 8, -6, 78, 66, 43, -28, -16, -55, -98, -61, -68, 0, -17, 24, -21, -43, 32, 48, 68, 10, 47, -75, 66, -72,
+		19, -97, -99, -74, 20, -78, 49, -14, -4, -40, -24, -94, 29, 80, -30, 78, -31, 13, 28, 41, 25, 19, 44, 33, 28, -34, -15, -35, 34, -76, 71, -97,
+		83, -90, -8, -55, 87, -52, 9, -78, -92, -35, -25, -62, 42, 25, -17, 56, 53, -21, 84, 36, -72, -1, -35, 73, 87, -27, 62, -49, 35, 83, -17, -98,
+		26, -16, -49, 54, -33, -45, 17, 99, 34, 12, 15, 18, -31, 28, -33, 69, 47, 48, 82, -48, 50, -99, -5, -67, -25, 62, -54, 16, 91, 9, -46, -33,
+		99, 74, 95, -8, 4, 65, -20, -82, -98, 5, -11, 22, -12, 34, -92, 37, 76, 56, 33, 66, -29, 1, 84, 67, 9, 94, -46, -22, -60, 39, 60, 76,
+		-56, 30, -21, -89, 5, -3, 56, 56, 13, -100, -37, -46, 76, 84, 98, -40, -58, 69, 7, 61, 79, -73, -78, -26, 61, -81, 68, 72, -28, 65, 57, -72,
+		78, -38, -33, -66, -10, -24, -48, -92, 83, -50, 31, -55, 16, 54, 88, -92, 93, 81, -9, -17, 19, 8, -14, 62, 8, -36, 31, -42, 13, -65, -18, -19,
+		-59, -18, -41, 48, 67, -17, -89, -96, 26, -3, 66, -80, 68, 42, -9, -32, -19, -49, 4, -37, -97, -54, -28, 43, -53, 92, 68, -99, 1, -30, -95, -78,
+		-25, 5, -87, 78, 69, -35, -93, 58, 16, 30, -73, 93, 56, 88, -50, -71, 67, 3, -82, 99, 62, 51, 48, 99, 45, -35, 57, -67, 63, -65, 37, 46,
+		-34, -91, 1, 83, -31, -67, 70, 34, 56, 22, -76, -65, 68, -23, 13, -91, -60, -52, -36, 71, -92, -70, -80, -29, -89, 83, 70, 78, -65, 12, -10, -94,
+		91, 62, -90, -13, -13, 38, 29, -56, 87, 19, 1, -82, -98, 70, 31, 84, 83, -36, -69, -36, -75, 87, 70, 37, -94, 97, -89, 27, -89, -49, 17, -97,
+		-84, -17, -57, -60, -10, -76, -89, -62, -20, 9, -84, 49, 1, 24, -71, -87, -75, -26, 95, 70, 98, 4, 57, 17, -54, 87, 59, -94, 58, -59, 75, 52,
+		-41, 90, 95, -60, -76, -27, 26, -67, -9, 90, -65, -24, 8, 2, -81, 17, -59, 65, 36, -22, 50, -80, -62, -38, -48, 65, 92, -9, -90, -27, -38, 12,
+		-70, 61, 1, 85, 74, 80, 70, 30, -25, -73, 40, 21, -52, 48, 66, 38, 18, -99, 72, -58, 62, -1, -62, -52, -56, -77, -85, 49, -10, 57, -4, -18,
+		-100, 15, 30, -69, -93, -20, -70, -86, 43, 49, 85, 37, 17, 15, 2, -83, 53, 90, 74, 74, -46, -89, -15, -11, -33, -95, 71, -35, -30, -41, 6, 27,
+		57, 53, 13, -52, 11, 53, -74, 79, 74, 28, -88, -53, 99, 44, -7, -98, 37, -62, 70, 83, -95, -66, -50, -25, 63, 14, 85, 75, 11, 92, -100, -93,
+		69, -76, 38, 86, -54, -29, -44, 10, -92, 48, -21, -52, 81, -74, -11, -42, 4, -65, 61, 99, -89, -82, -7, -48, 68, 54, -9, 61, -2, -72, 41, -71,
+		24, -57, -100, 55, 19, 23, 57, -88, -2, 7, 96, 87, -44, 36, -36, -74, -29, 17, -93, 60, -5, 0, 99, -49, -8, 50, 34, -46, -43, -69, -98, -72,
+		29, 59, -78, 0, -65, 45, 73, -54, -13, -19, 63, -4, 64, -21, 56, 58, -79, 85, -99, -4, -53, -40, -82, -77, 25, 83, 65, -74, 16, 2, 29, -86,
+		-9, -34, -6, 94, 97, 67, 68, -96, 27, 58, 1, 21, 54, 1, -70, -29, 81, -62, -9, -28, -27, 25, -86, -78, 1, -80, -59, 97, -85, 74, 65, 24,
+		-1, 60, -56, 35, -89, -35, 69, -31, 67, -91, 16, 76, 27, 69, -63, 83, -16, 94, 58, 28, 89, 73, 85, 73, 55, 6, 93, 77, -46, 13, -89, 4,
+		-66, 42, -80, 94, -40, -97, -45, -31, -62, -78, 87, 90, 80, 62, 86, 65, -46, 7, -93, 57, 85, -100, 46, -40, 83, -26, -63, 82, 78, 16, -90, 42,
+		-92, 47, -21, -45, -72, -19, -51, 50, -66, 36, -8, 67, -58, -33, 68, 69, 31, 27, 60, 78, 14, -43, 26, 85, -2, -86, -65, 20, 30, 89, -100, 33,
+		-62, -42, -100, -28, -15, -39, -29, -24, 63, -96, 89, -48, 39, 34, -91, -44, -74, -36, -65, 12, 30, -43, 92, -91, -99, 28, -36, 11, 51, 3, 53, -62,
+		-88, 16, -36, 83, -94, -3, -8, -1, -79, -5, -7, -64, 80, -54, 14, -89, -96, 66, 53, -79, 74, -17, 70, -36, -80, -25, -39, 49, 13, -55, -95, 55,
+		85, 35, 9, -98, 89, 60, -94, -64, -30, 19, 55, 25, -76, -71, 51, -41, 76, -30, 97, 26, 79, -19, 85, 30, 54, -37, -45, 79, -33, 69, 59, -95,
+		92, -69, -70, 3, -58, 20, -4, 7, -22, -68, -80, -1, 49, 79, -87, 53, 75, 91, 49, -7, -83, -15, 39, -63, 37, 99, 57, 6, -22, 68, -89, 29,
+		-76, -58, -61, -13, -12, -16, 70, -47, -100, 39, 47, -91, 90, -50, -13, -71, 86, -45, -60, 43, -23, -61, -84, 4, -48, 57, -83, -12, 4, -39, -45, -97,
+		10, -97, -59, 25, -81, -79, 32, 95, 48, 84, -42, -48, -82, -41, -20, -40, 79, 23, -31, -23, 56, -79, 6, -70, 73, 38, 75, -53, 56, -71, -59, 37,
+		10, -98, -51, -44, -54, -16, -13, -81, 79, 72, -95, -49, 29, 4, -71, 29, 95, -1, 96, -20, 86, -22, -80, 74, 11, 3, 9, 4, -5, 64, -10, -17,
+		84, 56, -55, 13, 32, -68, -84, 24, -85, 49, -4, 21, -7, 13, 3, 18, 27, -2, -38, -43, 8, 34, -91, -100, 63, 38, -9, -10, -13, -84, 33, -3,
+		-98, -1, 55, 22, -47, -66, -77, 32, -36, 17, 64, 45, 10, 48, -62, -100, -4, -32, 46, -71, 45, -94, 74, -92, 25, -98, -45, -99, -20, -72, 73, -11,
+		-48, -97, 51, 83, -4, 78, -43, -94, -76, -4, -57, 34, -69, -98, 42, -100, -57, 36, 72, -75, -90, -92, 98, 73, 86, 40, 69, -92, 58, -93, -88, -86,
+		-99, 96, 33, 92, 52, 82, -47, -38, 9, -52, 33, -40, 25, 23, -67, 40, 81, -96, -21, 56, -95, -65, -36, -58, -16, -26, 93, -79, -36, -58, 22, -15,
+		72, 97, 16, 23, -23, 53, 22, -5, 75, 50, -79, -53, -17, -86, -4, 0, -26, 74, -55, -15, -61, -61, 86, 89, 64, 5, 38, -4, -67, -35, 28, 65,
+		72, -84, -30, 14, 1, -49, 34, 79, 26, -68, 35, -42, 22, -7, -5, -80, 5, -65, -92, -39, 58, 59, 5, 44, 75, -34, 7, -67, -42, 24, 54, 28,
+		-20, 26, -5, -34, -69, 49, -8, -59, 16, 72, -30, 75, -9, -21, -72, -7, -19, -67, 80, -57, 65, -20, 88, -80, 97, 76, -2, 68, 80, -9, -86, 75,
+		-63, -6, 2, 1, 40, 68, 8, 3, -33, -10, 44, -21, -80, 89, 76, -24, 67, 62, 6, -21, -2, -8, -98, -100, 96, 18, -25, -90, 80, 74, -58, 4,
+		-74, -24, -13, 10, 95, -73, -18, 21, -35, 39, 18, 2, 80, 68, -61, 25, 27, 81, -45, 44, 76, -40, 96, 66, 35, 29, 99, -53, -74, -49, -25, -39,
+		-98, -14, -45, 6, 87, -66, -67, 66, -93, -51, -79, 90, -15, -19, 99, 81, -62, 54, -57, -61, -21, 75, -91, 69, 4, 68, 96, -4, 30, 95, 60, -84,
+		36, -23, -50, 56, 40, 26, -59, 70, -82, -19, 48, 23, -91, 79, -26, -6, 84, -68, -44, -85, 71, -34, 31, -65, -85, 62, 70, -27, 67, 13, -31, 70,
+		35, 77, 37, 22, -54, 55, 7, 12, 73, 17, 94, -34, 11, 85, -40, -50, -17, 51, 93, 46, -71, 90, -11, 54, -84, 96, -39, -82, 81, 0, -65, -40,
+		-82, 56, -46, -70, -40, -18, 42, 33, 33, -62, -24, -84, -97, -33, 48, -48, -94, 58, 63, 48, -33, 17, -16, -95, 96, 58, 58, -5, -84, 24, -25, -100,
+		95, 25, -26, -24, -59, 29, 83, 20, 60, 26, 49, -20, -58, -14, -80, 87, -22, 42, 40, 5, 18, 22, 23, 28, 75, -32, 0, 97, 12, 55, -39, -51,
+		-24, -59, -82, 47, -32, -93, -63, -68, -13, -51, -70, 73, 89, 95, -57, 90, -68, 98, -52, -18, -68, 72, 16, -72, -68, -60, -22, -16, -43, -99, 68, 13,
+		91, 33, 58, -76, -51, -67, -60, 34, 29, 21, 61, 48, -82, 66, 68, -70, -11, -55, 57, -95, 97, 52, -17, 22, -75, 48, 68, -91, -14, 34, -100, 19,
+		40, -82, -21, 92, 3, 90, 8, 63, -64, 14, -45, -78, -60, 72, 52, -17, 77, 79, 53, 73, -10, -6, -30, -35, 4, 97, 46, 33, 76, -99, 59, -57,
+		23, 59, 14, 37, 29, 60, 90, 91, 26, 76, -66, 5, 65, -29, -56, -21, 1, -84, -20, -88, -66, 6, 96, 99, -65, -80, -63, 76, -48, -32, -93, -26,
+		45, 28, -8, 26, -66, 70, 5, -99, -21, 62, -33, 97, -33, 26, -75, 4, 82, -72, -14, -25, 69, -45, 83, -97, 41, 95, -21, 11, 67, 17, 16, 8,
+		18, 38, 24, -41, 54, -65, -20, -4, 28, -52, -10, 28, -86, 57, 88, 12, -7, 38, 85, 12, -71, -70, -41, -72, 1, -1, -64, 57, 2, 96, -36, -12,
+		-70, 12, 48, 12, 85, -76, 86, 3, -16, 45, -3, -43, 41, 24, -56, -46, -33, 68, -29, 90, -86, 16, 60, -69, -12, -63, 95, -77, 47, -5, -2, 83,
+		21, 58, 40, 1, 23, -97, 79, -76, -45, -81, 77, 86, -15, -82, -96, 44, -55, -63, -3, -4, -89, 86, 79, 53, 32, -73, 76, 97, 9, 75, -36, -51,
+		86, -86, 68, 67, -70, -70, 73, 16, -87, 54, -86, -73, 60, 83, -44, -99, 40, -96, 60, -92, 32, 76, 48, 8, 21, 51, 61, 37, 26, 97, -3, 31,
+		87, -35, 93, -39, -43, -20, -63, -95, 25, 98, -95, -94, -49, -100, -5, -64, 11, 53, 34, 74, 53, 18, 26, -19, -40, 76, -51, 26, 89, -61, -7, -96,
+		96, 11, 37, -44, 10, 66, -69, -50, -29, 44, 24, 25, -6, -50, -33, -51, 45, 91, -16, -96, -75, 29, 94, 19, -25, 13, 37, 78, 66, 57, 81, -34,
+		94, -64, 22, 62, 2, -26, -69, -75, -18, -38, 41, -43, 35, 2, -80, -16, -18, 84, 13, 83, 58, 18, 97, 78, 22, 42, 95, -63, -95, -23, 4, -94,
+		28, -30, -78, 33, 83, -33, 12, -51, 12, 95, 11, -28, 30, -49, 83, -95, 7, -21, 37, -23, 30, 77, -33, -65, 67, -36, -69, 88, -11, -3, -58, 71,
+		0, -22, 87, -45, -37, -36, -91, 78, 53, 68, 70, 55, -19, -32, 58, -35, 85, -24, 10, -20, -33, -41, -94, 22, -98, -14, -93, 63, 80, -84, 70, 77,
+		53, -48, 66, 95, 42, -58, 43, 45, 17, 29, 48, -84, -48, -92, -72, 39, -55, 38, -74, -22, 5, 75, -33, 91, -6, -51, 87, -96, 21, -61, -93, 3,
+		-40, -86, 19, -91, -44, 39, -97, -25, -80, 45, 36, -17, -96, 39, 48, -71, -98, 29, 87, -30, -2, 75, -68, 86, -65, -6, 92, 50, -24, 99, 12, 61,
+		-31, -67, 77, -53, -31, 11, 56, -30, -46, -9, -89, 7, 38, 86, -36, -96, 32, -57, 36, -18, -46, 56, -58, -13, 93, -12, -68, 95, 4, 11, -69, -26,
+		65, 74, 31, -19, 66, -38, -86, -21, 26, -27, 41, 90, -31, 75, 79, 36, 63, 9, -3, -54, 12, 76, 45, -26, 43, 28, 87, 19, -86, -18, 57, 60,
+		-91, -98, -63, 94, -89, 61, 31, 66, 29, -82, 0, 1, 0, 37, -6, -61, 74, -91, -61, -80, 1, -56, -34, -41, 26, 32, -97, 59, -100, 75, 78, 21,
+		26, 23, 34, 92, -76, -21, 17, -64, -90, -81, -92, 30, -32, 56, 52, -13, -67, -76, -30, -41, -55, -91, 11, -19, 36, 46, 96, 80, -66, -90, -100, -54,
+		54, -87, -36, -92, -35, 81, -4, 16, -30, -21, 23, -40, 86, -73, 16, 45, -49, -16, -96, 53, 44, -14, -83, 26, 95, -14, -64, -72, 51, 5, 95, 40,
+		-87, -16, -75, -50, 63, 21, 75, -47, 81, 90, -52, 21, -9, -68, 98, -100, -94, -84, -70, -41, 96, 75, -88, -37, -88, -98, -62, 3, -18, -38, -95, 63,
+		24, 44, -38, 86, -44, -69, 34, 93, -4, -66, 90, 48, -51, -51, 63, 44, 15, -82, 7, 76, -32, 75, 35, -88, 14, 58, -3, 97, 69, -32, 84, 47,
+		39, 49, 40, 3, 79, 14, 67, -99, 70, -96, 60, 68, -92, -82, -17, -94, 93, 49, 89, 82, -44, 57, -31, -39, 61, 61, 37, 92, -42, -25, -42, -71,
+		-21, 11, 43, 7, -21, 28, -71, 25, -11, -14, -40, 65, -20, 82, -33, 12, 50, 63, -46, 42, -21, -97, -91, 74, -24, 80, -69, -62, -13, 5, -4, -79,
+		-3, -96, 40, 56, -65, 98, 83, -64, -37, -64, -45, -5, -82, -47, -53, 93, 90, -10, -80, 27, 92, -3, -45, -26, -48, -20, 11, 9, 35, -81, 57, 8,
+		-43, 11, 95, 84, -9, -2, -62, 29, 61, 98, -2, -12, -62, 90, -86, -27, 73, 83, 91, -30, -52, -46, 87, -1, 64, -17, 28, -84, 7, -83, 19, -29,
+		63, -31, -1, -46, -92, 33, -51, -40, -93, 90, 56, 2, 70, -64, 30, -83, -32, -73, 63, -26, 72, 30, 20, 93, 44, 58, -32, -93, -32, -62, 53, -49,
+		96, -69, 66, -52, -32, -9, -83, 93, 42, 8, -51, 31, -100, -35, 29, -30, -32, -11, 36, -16, -52, -58, -15, -4, -11, 61, -87, 66, -44, 33, -30, -83,
+		-17, -47, -65, 29, -7, -34, -11, -79, -82, 71, 24, -1, 46, -75, -40, 67, -98, -47, 21, -68, -82, 86, -64, -69, 36, -60, -43, 72, 71, -99, -81, 17,
+		76, 5, 65, -89, 19, 34, 43, -72, 3, 71, 62, -29, -25, 70, 61, 82, 30, 65, -73, -45, -36, 99, -42, 24, 8, -12, -66, -13, -27, -21, -32, -18,
+		55, 85, 14, -22, 66, -61, 67, -25, -7, 5, -39, -2, 49, -86, -23, 82, -39, 53, 3, -65, -94, -76, 14, -26, -22, -68, 24, -82, -21, -15, -22, -9,
+		-92, 5, -31, 17, 46, 49, 94, 88, -24, 4, 32, -69, -12, -19, 13, 71, 86, -28, -6, 41, 15, 22, -30, 65, -94, 13, 58, 69, -61, -56, -10, -87,
+		2, -93, -57, 51, -98, -72, 52, -53, -20, -94, -50, -38, -97, 17, 76, 44, -42, -84, -79, -34, -94, 58, -99, 19, 25, -91, 18, 9, 49, -69, 71, -93,
+		-56, -78, 22, -85, 22, 83, -93, -23, -65, 54, 40, 38, 73, -76, 97, -100, -72, -15, -62, -9, 18, -60, 11, -78, -12, 51, -15, -77, -62, -43, -25, 70,
+		99, -86, 88, -46, -70, -82, 43, 73, -40, 20, 21, 29, 65, -37, 69, -95, 5, -80, -10, -60, -44, 8, -75, 28, 22, 34, -42, -46, -47, -10, 64, 61,
+		69, 80, -96, 15, 86, -16, 37, 41, 52, -10, 84, 55, 84, 59, 63, -23, 90, 13, -31, 18, 25, 58, -40, 56, 97, 10, -52, -63, -43, 43, 43, 83,
+		-76, 47, -56, -66, 55, 86, 10, -79, -10, 79, 25, -99, -38, 40, 56, 63, 84, -8, -66, 7, -86, 29, 33, -47, 11, 86, 24, -19, -41, 93, 57, -1,
+		-21, -24, 71, 48, 69, 3, -54, -45, 72, -40, 16, -19, -45, -43, -32, 79, -85, -30, 68, -74, -73, 34, 19, -19, -4, 12, 17, -72, 77, -41, 28, 97,
+		-41, -53, -100, 87, -2, 25, -53, 58, 54, 36, -32, -62, 66, 21, -22, -85, -17, 15, -52, 29, 4, 48, 70, -92, -8, 0, 51, 27, -48, 12, 55, 79,
+		-47, -33, 66, 83, 65, 34, -82, -58, -38, -95, -46, -53, 41, 24, 16, -74, -4, -69, -18, 65, 99, -4, 95, 47, 91, 97, -65, 99, 22, 87, 42, 59,
+		4, -2, 33, -98, -8, 2, -27, -99, -79, 75, 93, 22, -10, 0, -70, -79, -46, -22, 24, 1, -68, 74, -100, 69, -84, -51, -6, 63, 51, 67, 80, -58,
+		-1, 73, -84, -11, 47, 93, -91, 42, 68, -34, -22, 13, -47, -98, -100, 62, 40, 3, -10, -13, -7, 20, 98, -49, 39, -74, -54, -81, -34, 33, -45, 24,
+		-94, 2, 34, 67, -71, 65, 48, 3, -16, 31, 56, -77, 40, 37, 95, 93, 28, 69, -79, -91, 87, 65, 65, -75, 12, -84, -39, -37, 19, -71, 87, -35,
+		79, -1, 8, -60, 98, 10, -76, -68, -37, -99, -3, -74, 53, -74, -62, -53, 9, -78, 82, 40, -75, 87, 86, 99, 91, 1, -53, 12, -75, -27, -79, 98,
+		63, -96, 41, -32, -83, 16, 30, 9, -86, -96, -16, -62, -9, -52, 12, 97, 89, -75, 47, 50, 33, 74, 19, 94, 83, 18, -59, -63, -19, -49, 29, 68,
+		52, -39, -93, 28, 72, -64, 60, -13, -56, 73, 67, -12, -26, -54, 83, -38, -25, 30, 92, -52, 3, 84, 89, -25, 79, 59, 25, 27, 46, 26, 59, 1,
+		-39, 84, 49, -42, -7, -37, -95, -24, -75, -51, 35, 34, -4, 6, -87, -17, 22, 88, 72, 72, 76, 73, -14, 57, -79, 86, -35, 78, -87, 58, -49, 47,
+		5, -10, 26, -42, -53, 98, -96, -43, 48, 95, 24, 15, -49, -56, 59, 61, -58, -50, -16, 77, -51, 28, -32, -41, 96, 23, 47, -6, 55, -72, 6, -21,
+		65, -47, -31, -58, -1, 18, 44, -85, -39, -18, -63, -11, 52, 98, -6, -51, -93, -100, -13, -41, 49, 21, 96, -25, 67, -94, -96, 62, 53, -69, -25, -89,
+		14, 93, -50, 71, 13, -24, -67, -49, 75, 34, 28, -89, -16, -17, 14, -65, -89, 93, -62, 77, -27, -60, 58, 16, -36, -12, 12, 97, 61, -47, -89, -85,
+		23, 69, -46, 30, -76, -76, -14, -76, 64, -67, 54, 98, -60, 22, 93, 8, -91, 10, -88, -75, -12, -39, -3, 85, -20, 6, 17, 12, -87, -17, 12, 2,
+		78, 72, 62, 52, -83, 74, -70, -45, -32, -53, 20, 69, 92, -19, 67, -16, 74, 59, 26, -10, 8, -100, -93, -39, 20, 77, -41, 67, 8, 76, -90, 42,
+		-12, 16, 66, 96, 85, -87, 65, 7, -30, 96, -98, -72, 91, -18, -54, -83, -67, -44, -77, 68, -69, -26, -45, 56, -37, 4, -76, -75, -2, -33, -55, -19,
+		30, 78, 17, -68, 94, 12, -75, -19, 24, -21, -45, -50, -49, -18, 14, 47, 60, 33, 53, -74, -94, 67, 51, -49, 9, -51, -21, -56, -35, -61, -1, 96,
+		-78, -51, -50, -97, 96, 87, -59, -59, 85, -40, 54, -73, -93, 78, -42, 18, 34, 73, -20, 25, -22, -45, -19, 1, -47, 14, -17, 67, 34, -9, 10, -48,
+		65, -14, 27, -97, -50, -24, 45, 15, -43, 64, 33, 93, 14, -26, -49, 7, -43, 42, -39, -45, 20, 78, -68, -67, -54, 18, 41, 38, 67, -100, -68, -54,
+		-48, 76, 70, -86, -3, 0, -94, 16, 52, -46, 17, -42, -2, 2, -84, -99, -41, -23, 80, 53, 86, -52, -4, -26, 16, 68, 95, -8, -2, 41, 9, 98,
+		-24, 81, -2, -93, -62, 51, -33, -55, 46, -79, -40, 75, 62, 17, -51, -87, 60, -19, -1, -42, -93, -7, -18, -81, 52, 1, 85, -72, 55, -75, 11, -30,
+		15, -17, 38, -38, -74, 59, 10, 20, -81, -50, 15, 80, 51, 39, -40, 4, -67, 65, 83, 31, 0, -46, 50, 95, -70, 49, 53, 42, -21, 59, -89, -86,
+		86, -35, -68, 39, -57, -64, 45, -22, 51, 32, 43, -71, -3, 72, -9, -94, 7, 42, 92, 31, 41, 94, -3, 40, -26, 42, 32, -73, -38, -85, 92, -63,
+		8, -92, 16, -37, -43, 91, 97, 19, -95, -96, 68, 52, 70, 84, 26, -67, -89, 14, 72, -59, 20, -36, -76, 74, -87, 55, 7, -94, -24, -97, -60, 11,
+		-31, 56, -7, 82, -34, -53, -43, -82, 54, 44, -62, -60, 62, -79, -26, -53, -23, 19, -32, -66, -16, -54, 27, 5, 76, 2, -34, -53, 70, 49, -58, -65,
+		44, 1, 42, -82, 53, -7, -64, -52, 24, -38, -65, 32, -97, 4, 66, 35, -52, -45, -56, -70, -39, -86, -21, 46, -41, 65, -51, 77, -5, 9, 68, 51,
+		63, -26, -51, 46, -68, -64, 89, 58, -57, -75, 29, 13, 57, -24, 35, 3, 35, 17, -20, -100, -17, -17, 65, 98, 45, -48, -15, 83, 10, -39, -94, 17,
+		-79, 79, -12, 45, -49, 75, -20, -73, 52, -27, -59, 97, 18, 74, -46, 19, 49, -90, -89, 57, 85, 49, 76, 30, -78, 34, 3, -8, -65, 23, -51, 1,
+		-55, 1, -55, 43, -3, -10, 53, 30, 61, -92, -21, -45, -66, 90, 76, 17, 49, 46, 60, -22, -39, -97, -77, -29, 75, 52, -37, 74, -34, -67, -88, 2,
+		-25, 18, -46, 27, -59, 31, 38, 65, -64, -8, -89, 69, -53, -71, 51, -86, 33, 4, -25, 50, 41, 17, -18, -65, 77, -40, 82, 59, 23, 50, 62, 40,
+		10, -24, 74, -72, 86, 63, -100, 1, 79, 52, 98, 28, 17, -2, -87, -4, 48, 80, -41, -11, 64, -4, -91, 23, -16, 38, -75, -95, 25, 9, -91, 2,
+		97, 99, -84, -86, 83, -61, 87, -11, -2, -80, 67, -63, 99, -20, 47, 41, -53, -51, -26, 79, -97, 82, -19, -54, -42, -5, 35, 15, 56, -59, -72, 16,
+		29, 51, 78, -44, -67, 89, -14, 85, 38, -81, 43, -28, 25, 52, -14, 86, 78, -94, -63, -87, 95, -38, -72, 99, -77, -12, 42, 10, 3, 44, -82, -62,
+		-62, -97, 39, 36, -61, 41, 39, -3, -17, -80, 48, 63, 15, 94, -4, -84, 90, -77, -92, 41, 98, -11, 22, -6, 13, -99, 96, 95, 53, 97, 56, -100,
+		23, -20, 4, 44, -80, -95, 67, 40, 84, -97, -52, -49, 78, 83, -78, 51, -100, 14, 52, -59, 85, 0, 51, 77, 97, -60, 38, 44, -61, -26, 86, 10,
+		-89, -98, 33, -60, -39, 4, -97, 88, -30, -22, 2, 67, -58, -96, 26, 87, 27, -23, 65, -31, 3, -29, -8, 43, -81, 67, -27, 45, 56, -42, -58, 24,
+		24, 28, 93, -96, 64, 9, 95, 36, 96, 86, 72, -24, -22, 38, 19, -26, -69, 62, 5, 78, -13, -14, -97, -97, 98, -88, -15, 6, 87, 89, 57, 19,
+		-83, -81, -5, -80, -67, 54, -92, 34, 49, -5, 30, -18, 32, 47, 27, 37, 89, -73, -91, -19, 42, -54, 42, 21, -35, 8, 94, -35, 50, -67, -18, 59,
+		-58, 91, 94, -17, 47, -19, -51, 93, 49, 80, 1, 97, -17, -62, -58, -11, -52, -98, -4, 79, -92, -39, -94, 99, -84, -92, 48, 31, -16, 12, 73, 79,
+		-53, -56, -69, 94, -96, -28, -73, 91, -33, 93, -90, 8, -95, 22, -84, 65, -55, 13, 63, 32, -66, 81, 7, 84, 42, -28, 20, -6, -64, -89, -75, 92,
+		54, -85, -9, 82, 38, -34, -39, 22, -50, -51, 86, 27, -81, 32, 60, 31, 16, -57, -27, 28, -35, 58, 12, -29, -54, 98, 44, 90, 41, -7, 86, 61,
+		91, 56, 45, 79, -5, 43, 96, 66, 83, -40, -95, -49, 88, 0, -30, 67, -28, 60, 79, 91, 28, 31, 34, -84, 15, -72, -39, -54, -37, 32, -44, 62,
+		80, -55, -34, -20, -32, 27, -68, 79, -60, 21, 86, -23, 46, -98, 77, 75, -21, -35, 88, 78, -66, 79, 96, -64, 86, -41, -54, 95, 90, -47, 13, 66,
+		54, 71, 19, -88, 61, 60, -41, -62, 60, 57, 83, 30, 11, 40, 45, -95, 75, -24, 32, 87, 72, -88, 18, 19, 56, 65, -22, -75, 28, 11, 92, 92,
+		-52, -49, 12, 48, -2, -13, 35, 68, -14, -4, 75, -42, -77, -24, -56, -1, -2, -14, 26, 61, -22, -72, -5, 45, -24, 7, -62, 29, 87, 43, 91, -55,
+		77, -53, -55, 5, 35, 84, -19, -94, -32, -97, -40, -9, -38, -100, -5, -40, 50, 26, 30, -17, -9, 1, 20, -59, -30, 81, 1, 25, 50, -49, 87, 11,
+		59, -64, 29, 63, -91, 22, -52, 2, -12, -9, 76, 79, -69, 2, 10, -86, -26, -97, -48, -21, -42, -62, -34, -67, 22, -21, -47, -26, -85, -40, -34, 62,
+		-82, -59, 45, -79, -13, 78, 3, -61, -61, 82, -52, 56, -79, 24, 69, 13, 83, -71, -28, -83, -60, -3, 85, -90, 24, -65, -21, -13, -38, 37, 53, -11,
+		39, -15, 52, -26, -34, -67, 34, 83, 2, 70, -6, 82, 94, 87, -33, -12, 93, 50, -61, 34, 59, 86, -61, -9, 52, -16, 70, -5, -89, -97, -36, -35,
+		-9, -61, -15, 49, -37, 3, -46, 80, -47, 67, -18, 30, -75, -80, 50, -96, -56, -5, 38, 23, -71, -27, 44, 94, 96, 71, -31, 35, 5, -54, -26, -99,
+		78, -29, 56, 55, -66, -59, -36, 32, 35, 32, -38, 68, -100, 71, -53, -100, -8, -27, 65, 56, 75, 54, 84, 26, 90, -33, 50, 42, 53, -29, -99, 11,
+		51, -48, 29, -34, 25, 41, 65, -99, 49, 77, 50, 72, 78, 81, -87, -25, -38, 34, -19, -92, 53, -20, 0, 31, 94, 8, 80, -6, 92, 6, -30, 70,
+		-76, 63, 75, -86, 60, -49, 36, -6, 91, 44, 23, 16, 46, 43, 21, 66, -69, -10, -52, -64, 92, 17, -34, -28, -41, -31, -47, -27, 18, 87, 43, -84,
+		82, 79, 78, 94, -50, 11, -51, 1, -58, 79, 49, 55, -5, 99, 42, -60, -5, -45, -71, 29, 73, 63, -76, 0, 32, 84, 49, -96, 41, -36, 16, -54,
+		-54, -53, -13, 71, -56, -25, -11, 71, 57, -10, 15, 27, 84, -17, 39, -43, -57, -48, 0, 20, 43, 94, -96, 22, 36, -79, 51, 28, -6, 16, -25, -50,
+		98, -88, -49, 3, -77, 52, -57, 38, 33, -38, -22, -51, 91, 51, 5, -33, -2, 75, -22, 8, 5, 14, -3, -22, -14, -2, 98, 18, 45, -31, -55, -7,
+		80, -6, -2, 52, -31, -88, 67, 84, -26, 55, 11, -6, -96, -50, -37, -14, -30, -55, -99, 1, 7, -62, -10, -31, 6, -62, -72, 60, 68, 24, 43, 11,
+		94, -34, -73, 43, 67, -68, 48, 50, -53, -79, -70, -53, -7, 11, 31, 39, -59, -21, -41, 49, 36, 46, 75, -12, -45, 69, -51, -66, -3, -35, 89, 7,
+		-2, -13, 63, -80, 92, -100, -57, -91, -91, -39, -6, -94, 18, 64, -2, -83, 40, 3, 58, -38, -94, -25, -4, -48, -30, 86, -21, 60, 74, 68, 25, 75,
+		-52, -99, 1, -35, 55, 36, 43, 57, -48, -19, 44, 81, -30, 3, 57, 23, -89, 71, 64, -19, 29, 4, -9, 76, -70, 18, -22, -91, 52, 33, 5, -39,
+		-1, 48, 99, -81, -58, 19, -36, 80, -16, -84, -100, 53, -52, -38, 93, 62, 30, -94, 52, 37, 26, -71, 55, -58, 94, 37, -87, -59, -83, 62, 83, -22,
+		3, 43, -79, -4, -17, 86, 12, -53, 51, -86, 22, 6, 66, 54, 92, 11, -4, 96, -37, 70, -77, 41, 72, 41, 42, -86, -24, -65, 31, -42, -42, -29,
+		-63, 36, 72, -8, -2, -87, 12, -55, -11, 66, 97, 48, 56, -51, -28, 65, 59, 83, 1, 27, -7, 68, -38, -55, 56, -1, -35, -99, -86, 27, -83, 86,
+		68, -71, -12, 18, -62, 77, 17, -15, -10, -54, -61, 65, -72, 92, 55, -28, 32, 44, -39, -21, -17, -3, 5, 30, 4, -69, -79, 97, 7, 67, -34, 8,
+		-18, 46, -36, 59, 30, 29, -82, 24, 62, -33, 2, 85, -95, -28, -66, -97, -32, 25, -76, -5, 98, 92, -95, 88, 4, -38, -30, -16, -77, 31, -29, -5,
+		42, -73, 27, 82, -10, -96, 4, 33, -63, -21, 46, -79, -68, 16, 67, -17, 39, 25, -84, 15, 70, 86, 89, -94, 69, -71, 67, -31, 38, -62, -1, 1,
+		45, -80, 80, 76, -12, -72, 49, -100, 7, 0, 69, 58, 77, -65, -9, 9, 35, 52, 85, 42, 89, -69, 97, 16, -21, -52, -7, 52, -80, 16, 16, -76,
+		46, -52, 62, 2, 88, -46, 99, 35, -37, -85, 49, 68, -11, 67, 39, -63, -39, 4, 71, 73, 9, -14, 70, 13, -27, -70, 31, -87, 71, 58, -11, 70,
+		21, -1, 27, -13, -6, -40, 2, 34, -6, -24, 88, 30, -7, 34, -8, 66, 61, -76, 56, 6, 43, -85, 55, -14, 74, 10, -25, -54, -24, 39, 6, 75,
+		4, -10, 77, -14, 44, 40, 62, 36, 11, -53, 58, -43, 92, 20, -3, -39, 58, -70, -33, -71, 90, -4, 95, -37, -58, -50, 13, 80, -13, 58, -50, -73,
+		-48, -78, 38, 56, -82, -80, 37, -3, -42, 28, 28, -62, -34, 55, -84, 25, 30, -18, 81, 37, 67, 65, 93, 53, 2, 84, -33, -32, 0, 10, -54, -87,
+		0, -26, -79, 84, 34, -61, 94, -6, -47, 63, 19, -25, 35, 74, -96, 60, 51, -32, -98, 41, -12, -93, 69, 3, -55, 69, 15, -51, 94, 92, 90, 3,
+		70, -18, -93, -4, -61, -21, 22, 32, -6, 5, 17, 85, -23, 78, 3, -11, -26, -61, -28, -7, 96, -94, 25, -81, 82, 77, 75, 46, 44, 79, -39, -83,
+		85, 33, 8, -40, -42, 82, -87, 9, 69, -15, 77, -72, -73, -17, -49, -48, 7, -54, 20, 76, 42, -10, -71, 13, 85, 29, -42, -13, -68, -59, -40, -26,
+		-93, 88, 34, 1, 3, 31, 41, -12, -25, -18, 42, 21, 77, 88, -97, 65, 34, -84, 87, 88, -32, -15, 59, 26, -88, -92, -44, -91, 40, -18, 33, 38,
+		8, 55, 45, 75, -50, -30, -96, 13, -52, 90, -49, -98, -79, -100, 46, 3, 62, 73, -23, -52, -23, 38, 94, -92, 66, 44, 62, -18, 87, 40, -81, 81,
+		82, 28, 14, 11, -43, 76, -78, 58, 84, 94, 75, 4, -25, 19, -43, 89, 61, 48, 51, 15, -42, -81, 41, 67, -59, 33, 64, -97, -58, -95, 61, -76,
+		80, -55, -34, 77, 80, -3, 61, 76, 68, 94, 70, -70, -73, 16, 4, -95, -74, 8, -54, -97, 25, -89, 83, -29, 1, -100, 90, 83, 5, -68, -47, -84,
+		-82, 81, -86, 3, -53, 79, 28, 94, -33, -11, -18, -67, 37, -34, -22, -68, -37, -93, 81, -86, -62, -34, 84, -77, 92, 36, 25, -65, -48, 36, -73, 2,
+		-61, -55, 60, -2, 50, -79, 73, -15, -56, -88, -16, 55, 52, -76, -88, -98, -71, -96, -69, -80, -37, -76, -18, -92, 40, 87, 66, -43, -68, -1, 8, -8,
+		-53, 37, -89, -36, -2, -70, -95, 64, 54, -1, -18, 51, -93, 21, 3, 2, -77, -80, 16, 18, -25, 99, -13, 34, -95, -27, -72, 99, 7, 85, -4, 35,
+		-61, 80, -51, -38, 58, 89, 5, -57, -41, 90, 91, 18, -2, -33, -72, -49, -92, -4, 88, 0, -36, 60, 97, 66, -34, 32, 74, 55, -21, -31, -45, -41,
+		-45, 74, -68, -32, -52, 25, 41, 57, 4, -17, -40, 74, 4, -60, -69, -58, -23, 14, 29, 2, -99, -54, -39, -26, 8, 26, 82, 56, -79, 46, 22, -19,
+		-52, -48, -31, 17, 25, -98, 24, 35, -60, -97, -43, -30, 34, 42, -65, 21, -92, -35, -27, 9, 52, 76, -18, -99, -66, 36, -50, -55, -24, 10, -10, -54,
+		-56, 74, 82, 23, -8, 36, 9, 82, 42, 96, -15, -73, -54, -34, -79, 52, -48, 77, 0, 58, 60, 53, -6, 4, 29, 65, 26, 0, 20, -53, -5, 14,
+		-17, 35, -19, 52, 91, -25, -43, -17, 73, -6, -1, 78, -72, 20, 20, 0, -97, -69, -91, -78, 35, 64, -79, 20, 32, 85, -4, -71, 39, 18, 95, -60,
+		65, -63, 72, -42, -16, -24, 25, 34, 16, -13, 28, -53, 16, -88, 77, -91, -24, 70, 15, -46, 94, 3, -80, -30, 31, 47, -87, -67, 48, 27, 80, -35,
+		-30, 78, -61, 75, 79, -41, -30, -70, 80, 34, 57, 29, -48, 54, 17, 11, -69, -93, 1, 32, 32, 21, 51, 36, 5, -64, -24, -39, 95, -3, -99, 6,
+		-43, 54, 91, 74, -51, -77, 9, 99, -62, -37, 43, -75, -4, 37, -95, 91, 30, -24, 74, -5, 13, 70, 82, -91, 71, 23, 2, -28, 63, 29, 20, 51,
+		-38, 42, -54, -55, 71, -21, -98, 69, -9, -4, 80, -59, -46, -75, -25, -81, -37, -22, -48, 24, -93, 92, -67, -12, -66, 73, 47, -14, 62, -6, 86, -2,
+		45, -93, 73, -47, -3, 93, 60, -38, -53, 18, 0, -29, -84, 11, 42, 14, -50, -40, -99, -42, 92, -7, 12, -98, -27, -38, -24, 28, 11, 96, -73, -21,
+		77, 9, -95, 15, -70, 57, 87, 32, 16, 67, 16, -49, 39, 90, -33, 93, -62, -63, -90, -76, -92, -5, 30, 47, 87, -41, -14, -77, -92, -100, -26, -7,
+		-50, -86, 14, -62, -8, 12, -83, 47, 84, -17, -45, 73, -56, -57, -93, 87, -66, -11, 43, 2, 40, 46, 60, 1, -96, 61, -31, 50, 56, 4, 28, -15,
+		-86, -92, -9, -45, 76, 83, 72, 69, -45, 72, -42, -62, 91, -14, 67, 59, -65, 32, 93, -55, -53, -79, 18, 25, 50, -100, -20, -86, -50, -60, 2, -41,
+		80, 11, 62, -34, -70, 13, -20, -17, -87, 60, 3, 26, 1, 18, -98, 23, 9, 92, 14, -76, -45, 28, 1, 98, 67, 42, 8, -15, -35, -72, -84, 39,
+		41, 46, 82, -24, 63, -70, -87, -51, -91, 60, 15, 59, 16, -48, 20, 4, -1, 16, -13, 17, -6, -6, 42, -37, -36, 44, -50, 12, 5, -78, 78, 2,
+		-55, 63, -62, -81, -14, -6, -39, 47, 40, -51, 33, -9, 34, 41, 83, 44, 32, 26, -75, 25, 68, 12, 79, 91, -52, -70, 50, 71, 39, 3, -80, 90,
+		22, -62, -35, 82, -34, 89, 90, 26, 8, -81, -89, -73, 22, 73, -36, 81, -29, -9, 79, -22, -56, 51, 6, -7, -4, 64, -100, -86, 39, 3, -14, 69,
+		-40, -71, 53, -82, 19, 51, -79, -69, 65, 67, 58, -80, -34, 76, 4, -85, -8, -54, 50, 13, 69, 50, -1, -50, 86, -12, -97, 37, 98, -72, 37, -94,
+		-71, 32, 53, -26, -10, 73, -39, 20, -19, -52, 84, 92, -78, -86, -5, -26, -61, -46, -59, 11, 98, 10, 1, -47, -57, -51, -69, -94, -57, 46, 54, -73,
+		-24, 14, -50, -33, -7, 76, -61, 25, -22, 58, 57, -8, -86, 75, -47, -65, -55, -40, 58, 82, -85, 98, 20, 42, 13, 55, 0, -17, -21, -40, 5, -68,
+		34, 95, -43, 18, -96, -83, -16, -97, -6, 16, -98, 27, 25, -88, -22, -65, -21, -56, 30, -8, 63, -41, 15, -92, -27, -79, 17, -49, -61, 68, -40, -46,
+		24, -75, -23, 40, -41, -97, 76, -9, -39, 33, -87, 5, -37, 72, 48, 55, 72, -90, 62, -2, 3, 27, 14, 77, 75, -33, 7, -16, -47, -17, -26, -78,
+		-47, 71, -19, -1, 73, 62, 20, -99, -78, 12, -84, -77, -8, -19, 93, 22, -84, -51, 15, -46, -26, -22, -71, 24, -64, 14, 62, 71, 17, 3, -99, 45,
+		-57, -21, 66, 48, 46, -33, 44, 11, 6, 11, -58, -14, -42, -62, 16, 27, -14, -28, -87, 24, 65, 6, 65, -22, 40, 37, 56, -92, 20, 59, 50, 94,
+		-36, -92, -96, -37, 14, 36, -6, 16, -89, 82, 76, 32, 6, -56, 13, 23, 65, 30, 14, -40, 59, 15, -90, 11, 13, 70, 62, -94, 48, 72, -11, -77,
+		41, 99, 94, 75, 78, -15, -79, -9, -35, -78, -75, 23, 53, 78, 53, 48, -80, -45, -9, 95, -69, -65, -19, 51, 47, 45, -19, 84, -62, -54, -98, 61,
+		29, -46, -48, 53, 94, 7, -76, 16, -95, -89, 13, 89, -76, -17, 21, -8, 16, -29, -39, -97, -12, -59, 49, -83, 60, -53, -94, -35, -50, 17, 69, -97,
+		-24, -83, 3, 38, 58, -11, 78, -68, 89, -70, -15, 7, -11, 71, 27, 68, -67, -59, -26, -36, -64, 34, 1, -40, -59, -16, -25, 72, -8, 28, -90, -88,
+		-81, 4, 10, -72, 23, -36, -22, -19, 38, -64, -41, -68, 2, -43, 49, 15, 11, 55, -97, -92, 35, 20, -56, -9, 8, -71, 20, 74, -65, -31, 4, 43,
+		81, -87, 20, 43, 49, 7, 7, 3, 62, -41, -97, 98, -99, -80, 26, -75, -28, -29, -8, 24, 20, -98, -98, -60, -92, -27, 38, 88, 91, -11, 45, -40,
+		64, -82, 96, -20, 83, -50, -100, 48, -96, -30, -6, -62, -44, 0, -56, 80, -41, 81, 55, 9, -94, -99, 11, -84, 92, -80, 46, 46, 6, 39, -30, -44,
+		-34, -27, 33, 8, 91, 96, 82, 43, -46, 7, -95, 3, -34, 37, -35, -90, -72, 5, -44, -33, -51, -42, -72, -47, 24, -48, -91, 33, 93, 45, 7, 19,
+		-72, 84, -47, -32, -82, 74, 75, -58, 77, 39, 33, 24, 99, 88, -78, -81, 5, 0, 49, -71, 69, -7, -80, 30, -56, 48, -82, -33, -60, 2, 58, -58,
+		66, -52, -75, 43, -16, 29, -80, -5, -55, 3, -30, -29, -42, 83, 37, -8, 74, 14, 3, 75, 83, 82, 9, -41, -57, -62, 83, 67, 73, -13, 44, 61,
+		-78, -3, 86, 29, -13, -2, -96, 82, -25, 15, -73, 95, -99, 70, -1, 56, -67, 40, 61, -24, 31, 71, -97, -77, 59, -14, 84, 70, 70, -32, 40, 5,
+		-14, 12, 97, 74, 78, -90, -41, 60, 54, 54, -38, 12, 2, 7, -4, -63, 69, 69, 38, 58, -89, -4, -55, -63, -24, -18, -4, -47, -55, 42, -62, 45,
+		8, 33, 9, 18, 31, 80, -37, -46, -69, -49, -21, -51, 85, -58, 63, -9, -88, 99, 61, -18, -99, -86, 33, -9, 0, -54, -68, -90, 92, 18, -81, -14,
+		25, -88, -60, -58, -94, 42, -14, 30, -78, 31, -30, 35, 93, -37, 31, 54, -53, 43, 71, 91, 34, -43, 15, -22, 47, 98, -25, 68, -39, -86, -79, 6,
+		78, 36, -33, 55, -43, 74, 27, 87, 33, -29, -70, -83, 34, -25, -22, -61, -80, 37, 75, 87, 41, -54, 87, -32, 19, -93, -21, 23, 23, -48, 40, -90,
+		-38, 17, 56, -57, 47, -90, -30, 66, -78, 91, 37, 19, -44, -97, 74, -9, 24, 94, 46, 98, 13, 67, 87, -39, 77, 64, -67, 2, 48, 45, 9, 48,
+		61, -55, -90, 68, 83, 87, 1, 11, -34, -2, -27, 32, -10, 14, -41, 24, 34, -31, -20, 11, -89, -83, 55, 90, -29, 68, 10, -69, -10, -41, 32, 4,
+		-54, 12, 64, 97, 9, -22, -48, -30, 88, -39, -8, -80, 20, -15, -97, 67, 75, -48, 34, -62, 74, 59, 41, -53, -44, -24, 15, -40, 15, -92, 39, -37,
+		42, -69, -63, -16, -34, 52, -82, -95, 51, -55, -34, -94, -34, 71, 33, -50, 50, -88, 67, -85, -37, 5, 75, 12, 88, 89, 54, -21, 36, -16, -89, -92,
+		-76, -61, 76, -94, -8, 76, 6, 68, 78, -38, -82, -94, 58, -17, -7, -43, -98, 28, -38, 58, -27, 32, -31, 47, -97, -62, -63, -58, -70, 45, -72, 48,
+		26, -14, -38, 82, -64, -50, -94, 28, 44, -27, 99, 87, -67, 36, -51, 32, 29, -49, -93, -91, -46, -63, 95, 95, -87, -99, -80, 84, 71, -87, -72, -6,
+		86, 21, -45, -68, 79, -61, -81, 0, 4, -54, -42, -7, 57, 57, -29, -51, 32, -71, -56, -20, 52, 21, 31, 54, -55, 47, 33, -63, -6, 58, -31, 87,
+		-6, 96, 87, 73, -11, 56, 38, 61, -81, -44, -80, 80, -1, 68, -31, 59, 18, -55, -34, 4, 1, 99, -58, 6, -70, -25, -3, 95, -93, 44, 97, 49,
+		-67, -27, -93, -23, 37, -7, -24, 52, -6, -55, -39, -89, -48, 41, -69, -63, -82, 53, 48, 71, -24, 95, 37, 25, -1, 20, 33, 31, 11, 70, 69, 98,
+		3, 47, 66, 10, -1, 73, 71, -55, -56, 10, -41, 15, 64, -61, 14, 48, 52, -46, -64, -62, 86, -10, 78, 85, -59, -95, -87, -5, -48, -44, -28, 47,
+		-78, 36, -40, -97, 83, -79, 61, -4, -37, -83, 16, 9, -53, 80, 16, -11, 65, -39, 20, 93, 39, -45, -28, -5, 53, 97, 56, 43, 79, -29, 87, -20,
+		60, -75, -51, 87, -82, -95, 42, 9, -52, -16, -67, 26, 95, 4, 11, -93, 73, -20, -81, -44, 33, 5, 80, 55, 43, -54, -37, 72, -86, -37, -74, -30,
+		24, -92, 17, -25, 43, 81, -50, 25, -15, -72, 45, 20, 19, -31, 52, -54, 58, 88, 31, -62, -50, -41, -14, -16, -19, 18, 17, -3, 89, 56, -75, -86,
+		49, 88, -21, 46, -9, 68, -23, -4, 63, -99, -67, -72, -58, -29, -67, 58, -98, 37, 49, -58, -50, -78, 57, 58, -96, -25, 91, 15, -41, 19, 79, 5,
+		-47, 27, -29, 68, -78, -94, -6, -8, 37, -1, -81, -12, -75, -68, 90, -53, -71, -52, -27, 52, -83, 63, -16, 34, -90, -95, 97, -83, -100, -64, 75, -83,
+		58, -77, -68, 85, -98, -42, 50, 52, -39, -75, 26, 47, 6, -17, 23, -6, 77, 3, 64, -10, 8, -9, -53, -28, -35, -21, -51, 19, 93, -72, -11, 33,
+		-87, -88, 35, 75, 52, -9, -52, -68, 26, -28, -19, 59, -14, -35, -32, -44, -65, -90, 23, 76, 38, 79, -82, 9, -96, 19, -9, 93, -11, -87, 16, -45,
+		-42, 30, -26, 70, 92, 23, -47, -19, -13, 71, 70, -2, 35, -22, -85, 78, 97, -94, 21, 39, 10, 17, 81, -89, -37, 42, -59, -38, 79, 76, 56, 17,
+		-45, -30, -43, 82, 71, -33, 66, 11, -32, 12, 36, -28, 13, -28, -34, -42, 13, 43, 89, 79, 29, -46, -5, 34, 47, 91, -21, -35, 18, 40, -89, -86,
+		83, -79, 43, -98, -76, -7, -46, 18, -67, -40, 66, -37, -29, -97, 57, 71, -29, 62, -11, -55, 14, 39, -31, -100, 51, -78, 98, -72, -85, -86, -11, 57,
+		-92, -74, 30, -75, 26, -67, -69, -31, 98, 93, -86, 43, 30, 86, 62, -29, -49, 97, -95, 25, -27, -87, -13, 8, 10, 49, -69, -48, -2, -42, -42, -98,
+		-68, 3, 91, 1, -41, 34, 84, -37, -40, 8, 62, 48, 59, 36, -8, 74, -15, 0, 99, -77, -91, -76, -67, -91, 25, -28, -53, -56, -19, 71, 15, 81,
+		-32, -29, -57, 18, 8, 27, -82, 63, 29, -8, -36, 94, -27, 22, -71, -28, -39, 73, -54, -30, -83, -45, -27, -56, -63, -58, 85, 93, -98, 44, 54, -42,
+		-56, -67, -71, 54, -100, 50, -69, 43, 38, 32, 78, 33, 59, 81, 98, 64, -61, -10, 49, -66, 62, 24, 96, -56, -40, 83, -90, -18, -44, -12, 32, 63,
+		-91, 61, -72, 49, 4, 30, -5, 63, -50, -3, 95, 24, -72, -99, -89, 34, 67, -81, -14, -7, 72, 86, 35, -68, 9, 42, -31, -58, 99, -100, 37, -17,
+		-12, 7, -53, 65, 49, 15, -15, -99, -52, 53, -2, -83, 0, -16, 50, 92, 41, 10, -81, 99, 11, 79, 80, 26, 57, -66, -67, -89, -13, 69, -5, -57,
+		27, -34, -38, 1, 72, -85, 62, 85, 16, 37, 7, -9, 0, 97, -4, -81, -64, 36, -77, 42, 35, -76, 38, -25, -93, 57, -81, -55, -95, 98, -29, 61,
+		11, 86, -36, 49, -45, -8, 21, -21, -80, -41, 30, 49, 50, -40, 90, 32, 56, -55, 70, -40, 72, 60, 2, 32, -83, -66, 93, -83, -3, 46, 83, -42,
+		16, -99, 86, 15, -24, -48, -51, -14, 87, 19, -12, -88, -42, 95, -94, -38, 16, -21, -39, -77, 90, 39, 99, -25, -58, -61, -7, 2, -39, -93, -95, 42,
+		-3, -77, 82, 40, -59, -90, -7, -78, -76, -94, -71, 27, 62, 11, -84, 15, 10, -85, 19, 15, 52, -17, -48, 97, 97, -87, -87, 49, 22, -4, 72, -84,
+		52, -5, 34, 13, -21, -15, -92, 96, 9, -78, -96, -50, 67, 76, -40, 62, -70, 28, 41, 65, -45, 47, 31, 62, 40, 21, 34, 31, -46, -39, -24, 75,
+		-10, -84, 25, -28, 20, 18, 81, 7, -68, -83, 39, 64, 61, -2, 74, 57, 46, -3, 73, 9, -64, 53, 13, -53, -67, 38, 86, -10, -94, 61, 89, 62,
+		-27, -91, 78, 50, 14, 99, -31, -5, 95, -18, 67, 17, 58, 17, -2, 7, 81, -25, -60, -74, -50, 85, -25, -34, -16, -51, 41, 33, 1, 39, 97, -55,
+		80, 24, 0, -1, 90, 16, 62, -30, 20, 37, 43, -27, 21, -67, 56, -72, -62, -91, 45, 61, 6, -11, -65, 97, -27, -65, 9, 46, -72, -62, 18, 89,
+		-19, -81, 64, -31, 58, -35, 98, -68, 54, 52, -89, -70, 2, 48, -3, 78, -21, 71, -15, -48, -63, -62, -10, 48, 94, -78, 95, 33, -75, -96, 35, -57,
+		-77, -47, -82, 10, -71, -24, 92, 28, 49, 63, 54, -100, -57, 26, 23, -19, 76, -46, 59, -49, 90, 59, 3, -57, -35, 58, -21, 1, -26, 89, -10, 77,
+		74, -43, 75, -62, 68, -87, 30, 74, 78, -98, -30, -49, -62, -51, 91, 74, 11, 36, 58, 84, -71, 9, -21, -19, 94, 20, 23, 56, 6, 11, -4, -15,
+		-39, -63, 80, -1, -51, 56, -82, 15, 20, -54, 51, -91, -20, -72, -17, 34, 15, 6, 95, -76, -4, 70, 74, 78, 84, -30, -16, -37, -51, -17, 58, 62,
+		-39, -47, 26, -43, -3, -55, 61, -44, 1, -20, -60, -40, 55, -96, 14, -58, -95, -79, -54, 70, -76, 22, 58, -19, -71, -13, 19, 35, -70, 70, -48, 81,
+		-72, -79, -26, -61, 35, -35, -19, -30, -68, -41, -53, -83, 39, -96, 4, -53, 86, -1, -18, -38, -31, -31, -32, 59, -100, -83, -36, 67, -75, -39, 16, 62,
+		84, 46, 58, 10, 80, 18, -11, -62, -6, 13, 73, -40, -58, 40, -54, 28, 42, 72, 86, 21, -85, -96, -47, 9, -24, -2, 81, -14, 21, -18, 17, 38,
+		68, -30, -93, 56, -70, -97, 9, 34, -79, -20, -94, -97, 59, -52, -49, -19, 83, -24, -62, 1, 56, 61, -94, 76, 30, 91, -61, 31, 86, -20, -92, 7,
+		11, -19, -57, -97, -69, 90, -25, -43, -4, -22, -90, 31, 44, -13, -100, -70, 79, -68, 91, 83, 44, 97, -43, 99, 87, -87, 11, -96, -75, 4, -28, 98,
+		-46, 56, 99, 14, 69, 5, 80, 73, 72, -5, 20, -27, 80, -3, -52, 94, -22, -35, -33, -14, 24, -20, 46, 15, -52, -46, 40, 59, 33, -44, 75, -21,
+		-69, -93, 7, -18, 12, 20, -95, 85, 27, 4, -49, 65, 70, -98, 24, -29, 86, -10, -15, -29, 82, -3, -78, -45, 88, -56, -3, -83, -66, -84, -63, -95,
+		12, -48, -59, 54, -73, -86, 73, 63, 81, 65, -26, -54, -58, -82, -82, 12, -100, -75, 5, -64, -38, -48, -17, -17, -71, -33, -49, -52, -68, 83, -75, 17,
+		-26, 13, -52, 77, -35, -62, 73, -88, -5, -17, -66, -80, 20, 65, -52, -97, 14, 79, 65, 72, 80, -86, 21, 62, -86, 98, 29, 11, -94, -34, -90, 51,
+		22, 2, 76, 33, 70, 85, -28, -78, -61, 3, 40, -74, 31, 37, 26, -81, 58, 24, -26, -49, 54, 92, -32, -91, -16, -53, -51, -37, -19, -88, 55, 49,
+		66, 20, 95, 72, -16, 80, -6, 54, -51, -82, -66, 35, -47, 72, 77, 36, -68, 41, -29, -31, -85, -9, 31, 97, -97, 60, -61, 38, 16, 57, 38, 37,
+		96, -8, -51, 89, -79, 97, -38, -48, -45, -38, -1, -61, -2, -49, -8, 91, 61, 79, 70, -31, -100, 87, -29, -89, -33, 56, -77, 93, 56, 10, 38, 15,
+		84, -59, 38, 70, -52, 52, 63, 34, -49, 42, -58, -14, 6, -10, 69, -93, -55, 78, -84, -44, 67, 33, -62, -19, 18, 12, 25, -90, 86, -37, -96, 21,
+		63, -52, -81, -93, -37, -89, 93, 20, -25, -70, 45, 96, -81, 84, 91, 28, -78, -1, 91, 51, -33, -71, -21, -83, 43, -91, 94, -60, 72, -26, -3, -65,
+		-55, -27, -64, 28, 59, -81, -51, -4, 96, 47, -3, -5, -79, 48, -39, 65, -1, 84, -95, 20, 57, 74, -17, 64, 24, -26, 95, -68, 68, 52, 17, 59,
+		95, -22, 66, 29, -94, 53, -28, -61, 91, -8, 87, 99, -4, 20, 45, 8, -74, -17, -12, -84, -71, -34, -1, 72, 45, -26, -87, 17, 17, 10, 19, 34,
+		68, -81, -11, 68, -39, 13, 48, 30, 43, 23, 38, -62, -81, 33, 90, -74, -41, 59, -12, -69, 3, 33, 76, 57, -48, -3, -88, -60, -77, 78, 87, 13,
+		24, -19, 19, 42, 6, -32, 36, -76, 89, -31, -62, -17, 34, -50, -62, -82, 9, -62, 61, 3, -76, 3, 92, -28, 65, 14, -6, -85, 68, -86, -72, -13,
+		96, 31, -55, 13, -26, -89, -70, -61, -98, -11, 99, 35, -25, 56, 38, -20, 48, -18, 16, -49, -25, 47, 94, -10, 80, 99, 76, 65, 65, -40, 14, -17,
+		18, -94, 42, 65, 17, 83, -83, -10, 8, -19, -10, 28, 53, 99, 16, -52, 52, 87, 21, 16, -51, 82, -2, -90, -34, -10, -97, 28, -12, 3, -31, -36,
+		-51, 94, -71, -91, -77, -74, -34, -18, -44, 67, -68, 50, -43, -37, -91, -43, -84, -98, -90, 21, 39, 31, 66, -55, 9, 17, -67, 99, 95, 22, -34, -11,
+		-11, 78, 8, 67, 40, -22, 6, 27, -46, 51, 5, -65, -95, 33, -49, 67, 46, -89, 10, 11, 51, 32, 72, -93, -71, -3, 74, 67, -43, -9, 93, -4,
+		96, 27, 10, 78, 6, -86, 19, -65, 55, -88, -34, 75, -47, 48, -60, 87, -57, -32, -47, -52, 12, 85, 8, 28, -33, 71, -5, 70, 69, -36, -57, 63,
+		38, -13, -31, 31, -27, -77, 62, 54, -24, -65, 99, 86, 67, 81, -53, 60, -92, 63, -25, -100, -25, 46, -86, 79, 53, -65, 85, 96, 21, -96, -89, -64,
+		92, 84, -19, 46, 65, 89, -51, -14, -32, 12, 8, -27, 47, 94, -56, 96, 5, -33, 40, 92, 70, -23, -100, 71, 75, -62, 8, 8, -85, 53, 6, 58,
+		-37, -87, 45, 1, -99, 64, 69, 74, 2, -56, 98, 31, -2, 5, 14, -25, -6, -17, -58, 21, 35, 37, 44, -78, -66, -45, 79, -63, -9, 96, -54, -30,
+		4, 10, -90, -98, -68, 60, -87, -63, 3, 35, 81, -62, -47, -8, 31, -96, -98, -79, 34, 58, -43, -33, -77, 29, 26, 74, -81, 16, -46, 75, -36, 21,
+		-89, 44, 76, -10, 70, -38, -93, 57, 28, 64, 48, 83, -52, 42, -93, -1, 38, 54, 14, 74, 18, -40, 52, -1, -96, -92, 63, -6, -25, 50, -30, 95,
+		-4, -72, 67, 90, -81, 14, -1, -96, -52, 69, 93, 43, 45, -3, -9, -61, 94, 81, -83, -53, -17, -77, -1, -73, -13, 39, 61, -2, 15, 60, 13, 61,
+		-41, -69, -99, -14, 2, -7, 58, 32, -11, 51, 85, 96, 52, 33, 4, -78, 43, -25, 86, 29, -84, -6, -70, -36, -69, 50, 65, -9, -44, 90, -53, 52,
+		94, -20, -8, 37, -4, 5, -28, 84, 35, -13, -50, 9, -6, -34, 6, 26, 5, 47, -21, 15, 30, 66, 65, 72, -88, 67, 73, -78, 55, 59, 33, -56,
+		-2, 76, -74, 46, -60, 69, 39, -65, -51, -32, -99, -25, -71, -24, -2, 91, -46, -16, 58, 15, -89, 59, -31, -43, 98, 7, 17, 80, 61, 51, -94, 22,
+		26, -51, -51, 2, 71, -96, -90, -28, 72, 99, -47, -41, -98, 44, 54, -51, -68, -95, 52, -33, 87, -48, 2, -94, 2, 65, 1, 37, 93, -89, -1, -52,
+		77, 99, 45, 65, 23, -69, -30, -83, 38, -97, 82, -91, -15, -88, -66, 88, -63, -56, -84, -23, 94, -84, -77, 77, 17, 72, 85, -24, -84, 91, 40, -36,
+		74, 50, -78, -37, -57, -81, -43, 80, -25, 83, -80, -77, -87, 97, 95, 66, 31, -100, -1, 6, -27, -50, -72, -90, -15, -43, -28, 79, 2, -68, 0, -76,
+		67, 30, 8, -39, 32, -42, 89, 86, -2, -49, -85, -42, 44, 19, -70, -84, 99, -1, 52, -6, 61, 63, 77, -16, 60, -75, 74, -34, 23, -68, -94, -30,
+		-54, -7, -79, 48, 22, -12, -38, -56, 12, -96, -40, -66, 57, -35, -76, 80, -37, 16, -16, 99, -61, -24, -40, 85, -87, -36, 36, 35, -35, -42, 23, -98,
+		49, -38, -11, -65, -20, -93, 9, -57, 44, -95, 60, 53, 55, 61, -6, -11, 20, 90, 31, 40, -48, 28, 15, -29, 51, 98, 99, -91, 56, -19, 74, -89,
+		15, 72, -46, 19, 84, -28, -37, 92, 4, -30, -45, 80, -91, 68, 82, 36, 86, -58, 46, 87, 98, 49, 55, 68, -64, -70, 31, -30, -10, 9, 18, -69,
+		6, -6, -27, -70, -16, -10, 58, 74, -97, -61, -1, -67, 3, 95, 4, -20, 21, 20, 79, 91, 41, 1, 81, -70, 49, 57, -10, -76, 96, 4, 89, -90,
+		-77, 1, -33, -79, -78, -28, 81, -35, 55, -65, 60, -51, -42, -46, 92, -24, -33, -100, -58, 55, -55, 0, 67, -15, 66, -69, -7, 35, -48, 57, 16, -6,
+		39, -95, -3, 64, -8, 13, 71, -31, 16, -87, 51, -94, -66, -6, -88, -78, -12, -78, 54, -54, -1, 38, 64, 40, 39, 63, 96, 32, -49, 77, -6, -15,
+		-37, -34, -49, 80, 27, -31, -4, -71, 85, -23, -83, 10, 69, -45, 57, -73, 69, -75, 24, 94, -59, -5, -4, -34, 51, 91, 12, 98, 7, 48, -88, -9,
+		-39, 74, -80, 84, 62, 81, -37, -97, 72, -53, 14, 19, 15, -72, -90, 99, 64, -68, 93, -4, -9, 91, -16, 28, -76, -66, 46, -15, 42, 66, 31, -14,
+		-14, -61, -31, 60, -75, 21, 8, -32, -37, -20, -48, -83, 99, -52, -57, -28, 55, 48, -39, 3, -94, -55, -64, -1, -52, -95, -6, -22, 79, 91, 29, -43,
+		-36, -67, 64, 79, -77, -98, 63, 63, 11, -99, -31, 99, 75, -59, 21, -64, 56, 73, 51, -45, 68, 20, -15, -28, 33, -94, 77, 13, 46, 48, -78, -71,
+		89, -2, -88, -72, -40, 99, 10, 27, 54, -53, -5, -56, 15, 95, -74, 67, 37, 73, 33, 6, 88, -87, -55, 76, 41, -49, -50, -23, 3, 33, -4, -81,
+		59, -6, 78, -67, -4, 61, -31, 66, -73, -50, 64, -39, 97, -54, 60, 10, 49, -71, 81, -57, -13, -15, -12, -12, -82, 22, 55, 39, -61, -58, -56, -36,
+		-89, -19, 4, 33, 56, -25, -65, 18, -53, -37, -75, 93, 75, 3, 4, -6, -97, 54, 36, -72, -68, -93, 81, 39, -91, -94, -68, 2, 69, 85, 9, -89,
+		25, 3, -59, -63, -74, -35, -95, -55, 57, -60, -30, -99, -46, -61, -83, -57, -10, -70, 62, -94, -9, -71, 6, -25, -5, -67, 85, -21, 10, 5, -96, 80,
+		64, -58, -55, -41, -6, -18, -3, -32, 56, 42, 6, -56, 1, 12, 66, -73, -32, 57, -20, 69, -54, -41, 75, 82, -67, 93, -69, 94, 43, -66, 27, 53,
+		6, -58, -47, -21, 52, 1, -29, 23, 91, 17, -55, 58, 21, -84, -92, 80, -38, 77, -70, 41, -65, -82, 14, -11, -48, 10, 91, 97, -95, 35, -60, -57,
+		0, -38, 3, -82, 68, 21, -19, 22, 31, 96, -37, 84, -37, -81, 77, -16, 40, 11, 4, -6, -30, 12, 3, -82, -32, -86, -54, -93, -7, -40, -72, -12,
+		-40, 84, 10, 21, 20, 76, -81, -48, -83, -15, 24, 79, -13, 83, 45, -96, 92, 89, 86, -37, 40, -46, 84, -7, 90, -57, 9, -25, -13, -71, -91, -7,
+		89, -85, -38, -66, 74, -87, 90, 94, 44, 92, -94, 0, 77, -57, -38, 4, -86, -34, 82, -47, -26, 97, -61, -48, 32, -20, 50, 35, 0, 92, -44, 2,
+		31, 52, 29, 26, -42, 25, 6, 60, 64, 58, 29, -15, 55, -33, -75, 47, 11, -4, 59, -39, 24, 67, -38, 52, -43, -64, -58, 91, -9, -15, -66, -25,
+		-3, 71, -76, 8, 4, -85, -19, -87, -57, 92, -15, 94, -71, 43, -99, -13, 11, -5, 35, 42, 94, -58, -52, 20, 66, -19, -79, -22, -92, -31, 33, -96,
+		30, 66, -43, -49, 43, -7, -88, -48, 5, -18, -51, 99, 75, -96, -84, -73, 61, 97, -40, 79, 58, -72, -3, -80, 30, 33, -26, 33, -46, -76, 78, -47,
+		-59, -15, -51, -35, 93, 48, -15, -2, 81, -64, -12, 49, -16, -65, 72, -94, 7, 88, -37, -8, 6, 57, 97, 88, -13, 55, -27, 14, 56, 44, 61, -26,
+		9, 38, -35, -53, -14, -15, -19, -83, 19, -95, -74, -12, -51, 21, -11, 24, -62, 3, -22, -97, 29, -40, -5, -74, 64, -98, -81, 73, 4, 57, -20, 46,
+		93, 64, 15, 43, 10, 39, 67, -54, 28, -78, 23, -40, 62, 40, -70, 52, 51, 37, -40, 2, -75, 21, -52, 57, 15, -57, 8, -71, 49, 71, -49, -20,
+		71, -93, -13, 5, 34, -92, 64, 81, -83, -40, 79, -3, -73, 36, -63, 92, 78, 73, -77, -42, -25, 26, 91, 58, -15, -21, -80, -99, 17, 81, -88, -57,
+		38, -86, -54, -92, -28, -94, -49, 1, 65, 91, 23, -72, -12, -77, -46, -45, 49, -70, 67, 97, -22, 9, 84, 98, 61, -33, 25, -96, -52, -13, 28, -69,
+		-29, -35, -14, 28, 8, 73, 79, -37, 20, -20, -16, -39, 64, -30, 25, 49, 22, -4, 91, 42, -61, -96, -95, 56, -44, 81, -97, 44, -32, -88, 90, 48,
+		50, 25, -35, -42, -2, 73, -20, 62, 85, 92, -98, -89, 22, 42, -33, -93, 77, -95, -73, -6, -66, -79, 22, 93, -37, -30, 51, -83, 21, -52, 48, 79,
+		47, 68, 0, 72, -87, 0, -94, 46, 57, 92, 55, -52, 81, -21, -25, 39, 32, -50, 48, -37, -70, -62, -62, -4, 49, 45, -1, -13, 18, -33, 30, -1,
+		-99, 38, -17, 67, 77, -94, 79, 23, -100, 65, 15, -33, 50, 6, 26, 88, -9, 90, 61, -49, -85, -32, -97, 9, 83, 8, 72, 30, 93, 89, -4, 1,
+		-4, 75, 50, -84, 97, -8, 65, 63, -23, 6, -68, -4, -51, -34, 6, 76, -85, 83, -81, 53, 24, -74, 82, 94, 14, 24, -86, -86, -58, -10, -57, -3,
+		23, 59, -24, -28, -48, 29, -97, -50, 90, -52, 78, -30, -59, -97, -81, -62, 26, -29, -42, -88, 7, -54, 36, -67, -24, 46, 41, 95, 70, -16, 5, 31,
+		26, -8, 53, -94, -17, 71, -67, 83, -87, 29, 9, -40, 60, 63, -2, -21, 18, -91, -3, 36, -64, 48, -61, 45, 79, 52, -30, 24, 34, -16, -49, -40,
+		-4, -28, 17, -36, 63, -66, -18, 22, 60, 17, 98, -90, -9, 30, 23, 35, 45, 87, -46, -25, -68, 51, 62, 81, 84, 8, -78, 77, 61, 17, 79, -23,
+		6, 82, -86, 44, -15, -85, -3, -95, 93, -97, -62, 92, -78, 4, 50, 99, -78, 61, -44, -8, -84, 56, -35, -68, -23, 24, -47, 14, 50, 77, -100, 43,
+		-51, -48, 22, 98, 51, 85, -40, -38, 48, -37, 46, 50, -59, -98, 60, -81, 2, 43, 58, -42, 18, -4, 80, -17, -7, -12, 77, -48, 3, -26, 62, -46,
+		-89, -88, -36, -66, -55, 10, 77, -5, -42, -33, -82, -69, 9, -79, 60, -96, 88, 21, -69, -33, -92, -29, -44, -43, 51, -97, 97, -38, 53, 42, -29, 73,
+		-93, 92, 80, 11, 15, -66, -97, -52, 31, -54, 46, -67, 72, -5, -73, -34, 92, -33, 64, -46, -27, 7, 25, -21, 87, 72, -71, -90, 31, -6, 91, -77,
+		-83, -77, -68, 14, -6, 20, -62, -69, -15, -84, 76, -31, 69, 35, 2, -1, 87, 34, 90, -16, 94, 88, -100, -51, -4, -78, 31, 60, -54, -51, 94, -10,
+		-16, -76, 19, 67, 27, -31, 42, -48, 90, 84, -72, 55, -51, 92, -54, -2, 36, 80, -15, -34, -14, -57, -17, 53, -8, -5, -19, 76, 73, 84, -54, 95,
+		-50, 58, 92, 68, -75, 66, -58, -18, 54, -83, 69, -45, -17, 89, 25, -14, 34, 40, 37, 57, 56, -4, -49, 75, 30, -97, 61, 42, -73, 60, -43, 68,
+		90, -95, 1, 90, -34, 65, 97, -36, 80, 5, -70, -63, 62, 31, 90, 11, 92, 91, -81, -78, 71, -99, -64, 78, 92, 13, -80, -56, -55, -76, 34, -66,
+		-81, -34, 86, 87, 51, -40, -43, 42, 29, 5, 16, -53, -30, -34, 35, -30, 40, 49, 59, -65, 85, 44, 13, -60, -17, -64, 81, -49, 74, 33, -95, 75,
+		8, -52, -67, 89, -54, 7, -75, 72, -53, 54, 87, -94, -10, 0, -45, 10, 41, 71, 70, 70, -26, -50, 94, 84, -2, -48, -87, 84, -66, -50, 68, 15,
+		-8, -90, -9, -35, -15, 93, 98, -81, -31, -85, 51, -50, -77, -99, -35, -68, -83, 59, 77, 86, 46, -10, -75, -30, 14, 37, -90, 17, -54, -48, -47, 58,
+		88, -88, 44, 78, -80, -32, -5, 55, -25, 36, -27, 41, -85, -21, -36, -56, 12, -41, -57, 6, 49, 17, -49, 40, 53, -84, 85, 14, -27, -67, -25, 84,
+		-37, 95, 23, -3, 41, -72, 37, -6, 5, -71, 74, 91, 88, 88, 67, -82, 84, -41, -56, 51, -52, -100, 34, -70, -83, -56, 89, -31, -76, 90, -51, -95,
+		-24, 10, 67, 16, -13, -67, 27, 55, 32, -9, 17, 95, 50, 4, 81, 94, -80, 54, 84, -83, 31, 84, 43, -89, -86, -11, 69, 10, -54, 81, -90, 30,
+		-44, 76, 86, -63, 91, 83, -54, -48, -99, 5, 84, -57, -3, 14, -10, 3, -9, -98, -68, -11, -39, 56, 87, -4, -39, -47, -2, -27, -58, 16, -6, -38,
+		23, -5, -19, -31, -41, 52, -50, -72, -16, -43, 97, 28, 84, 82, -94, -52, 83, -55, 12, -78, 70, 40, 98, 90, 13, 82, 37, -61, 41, 5, 72, 74,
+		-42, -41, 45, -82, 38, -16, -93, 0, -9, -52, -1, -35, 85, 74, -27, -23, 45, -13, 53, -16, 80, -50, -29, 23, 45, -81, -19, -30, 79, -96, 48, -4,
+		63, -91, 44, 38, -37, 33, 82, -94, 62, -82, 17, 88, 22, -84, -87, -11, 67, 60, -54, -31, -61, 84, 29, 99, 46, 2, 67, 0, -59, -69, -5, 72,
+		23, -64, -29, -58, -64, 48, 59, 42, 54, 50, -42, 49, -88, -91, -43, -1, 55, 51, 62, -55, -72, 65, 87, 83, 92, -58, -97, 72, 19, -27, -39, 2,
+		84, -69, -9, 25, 25, -89, 33, -52, 45, -46, 39, -43, -18, 9, 58, 66, 20, 33, 32, 84, -30, -64, 82, 73, 43, 72, 82, 2, -63, 26, -62, 8,
+		-30, 79, 64, 85, -39, -28, 1, -17, -69, 53, 86, -44, -91, -39, -2, -15, -56, 40, 1, 99, 79, 84, -54, 43, -6, -53, 62, -47, 80, 80, 57, 84,
+		-57, -59, 86, 83, 93, 43, -39, 80, -80, -65, 30, -63, 25, 10, 55, 66, -94, 0, -76, -44, -99, -95, -5, -71, 94, -79, 86, -17, -15, -50, -11, 17,
+		19, 93, -92, 53, -82, -39, 82, 55, 81, -17, 75, -76, -43, 88, 82, -47, -38, -46, -27, -21, 61, 35, -19, -5, -79, -8, 25, 60, 16, 56, -13, 97,
+		-28, -50, -79, -56, -6, 67, -96, 44, -28, -45, 33, -55, -83, -97, 26, -9, -6, 93, -52, -65, -16, 30, 59, 56, -8, 62, 83, -97, -1, -67, 35, -55,
+		-69, -23, 13, -71, -23, 33, 30, 45, -18, 79, -40, 71, -99, -84, -28, 22, 66, -39, -57, -5, -59, -57, -67, -56, 63, -58, 3, -57, -100, 43, -27, -96,
+		74, -13, 76, 38, 70, -35, -16, -61, -75, -24, -35, 25, 37, 65, 97, 7, 96, 62, 42, 65, 63, 44, -54, -73, -21, 59, 46, 0, 76, 61, -47, 30,
+		89, 19, -20, -49, 9, -63, 71, 51, 19, 85, -75, -85, 22, 51, -21, -70, 20, 73, -85, -22, -19, -23, 71, 15, -72, -79, -98, 42, -90, 35, 10, -45,
+		-64, -64, 78, -99, 60, 5, -59, -37, -20, -55, 84, -16, 34, 68, 71, -1, -5, -27, 91, -63, 73, -41, -42, -5, -67, -38, 13, -91, 23, -9, 29, 74,
+		96, 78, -96, 31, -63, 11, -81, 94, -67, -4, -20, 12, 4, -9, 20, -70, -49, 68, 53, 10, -38, 90, -54, -58, -7, 21, 77, -27, -42, -52, 34, -85,
+		-38, 79, -70, 68, -98, 70, -38, 64, 70, 53, 17, -36, -73, 64, -94, 50, -35, 73, -2, 64, 13, 89, 38, 63, -69, -80, 51, -98, 39, 8, 70, 91,
+		82, 28, -57, -19, 93, -77, 86, -52, 23, -20, -1, -55, -87, -27, -83, 29, -78, -19, 87, -96, -14, 62, -90, -49, -58, -64, -100, 36, -33, -72, 83, 36,
+		5, -53, 96, 11, -33, -43, 31, 64, -66, -11, -67, 59, -71, -35, 24, 84, 43, 12, 32, 18, 70, -56, 78, -7, 85, 16, 11, -28, 57, 77, 64, 29,
+		-60, 32, 96, 11, -21, -18, -82, 38, -75, -46, -63, 3, 44, 28, 18, -62, 87, -53, 99, 5, -76, -5, -44, -91, -2, 51, -69, 78, 23, -51, -14, -13,
+		17, -44, 2, 92, 46, -31, -16, -12, 30, -63, -93, -67, 20, 51, 79, -77, 32, -69, -81, 25, 7, -93, -40, 9, 34, -11, 35, 74, -23, -22, -79, -6,
+		5, -99, -73, -32, -16, 58, -96, -30, -99, -21, -14, -46, 83, -11, 70, 72, 57, -12, 64, -91, -21, -92, 76, 22, -43, -11, -90, 5, -73, -63, -56, -69,
+		56, 89, -20, 95, 95, 88, 43, 85, 51, -36, 41, -1, -87, -77, -10, -48, -2, -13, 11, -58, -88, 47, -31, -67, 87, 69, -100, 28, 17, 57, 12, -93,
+		40, 98, -13, -60, 79, 12, 85, -100, -78, -58, -1, -55, 88, -87, 91, -6, 55, -17, 35, -47, 19, 61, -97, -60, -51, -29, 51, 73, -43, -72, 18, 28,
+		1, -85, 94, -18, -31, 86, 66, -46, -30, 3, -79, -30, 58, 57, 81, 39, -87, 25, -61, -2, -60, 59, -68, -64, 91, -62, 37, -28, -35, -8, 16, -33,
+		72, -68, -80, 74, -20, 87, 69, -28, 49, 86, 72, 41, -25, -83, 39, 83, 75, -88, 26, -20, -94, 15, -78, 96, -15, 28, 9, 62, 45, -19, 61, 51,
+		56, 39, 9, -33, 92, -54, -75, 90, -71, -42, 13, -94, -81, 40, -30, -39, 30, 42, -45, -84, -14, 14, 63, 99, 85, -61, 88, 29, -4, 52, 21, 23,
+		34, 2, -42, -51, -21, 16, 45, -88, -10, 12, 6, 48, 66, -59, 78, -62, 83, -40, 28, 45, 31, 20, 13, 31, 14, 3, 50, -43, -80, 97, -91, -22,
+		-29, -79, -14, -98, -17, -79, -71, 6, 36, -22, 69, 44, -29, 8, -31, -31, -9, 98, 83, -27, 39, -29, 28, -39, 63, -30, -34, 4, 49, -23, -86, 77,
+		86, -89, -46, -49, 21, -11, -34, -63, 98, -42, 75, 66, -1, -78, -51, 72, -19, -36, -82, -52, -8, 47, -46, -85, -57, -90, -53, 1, -34, 58, 3, -18,
+		11, -71, 47, -70, -45, 26, -49, -9, 8, -22, -22, 61, -5, 55, 63, -23, 74, -47, -75, 74, -97, 7, -75, -74, -62, -5, -48, -91, -59, 0, 84, 22,
+		78, -57, -21, 65, -33, 39, -85, -12, 10, -96, 92, -34, -13, -70, -75, 61, 26, 20, 24, 55, -97, -43, -55, -80, -69, -48, -56, 76, -87, 40, 0, -53,
+		60, -76, 49, -67, -63, -1, 52, -68, -69, 85, 32, 15, 12, 38, 51, -61, -62, -40, -12, -66, 13, -13, 26, -19, -85, -67, 18, -61, -3, 42, -38, -42,
+		39, -89, -98, -51, -25, -81, -4, 80, -83, -90, 84, -35, -9, -21, 56, -14, -39, -3, -86, -59, -53, 70, -11, -33, -51, -13, 90, 35, 59, -67, -86, -18,
+		-43, 19, -80, 58, -75, -24, -73, -67, 19, -64, 2, 56, 49, -83, -73, 73, 88, -31, 34, 9, -57, 20, -96, 39, -1, 71, -5, 64, -82, -36, -41, -42,
+		49, -71, 31, 67, 83, 67, -26, -1, -7, 4, 93, 84, -90, -83, 12, -85, 61, 62, 89, 20, -81, -70, 64, 64, 37, -52, -16, 61, 69, -6, -20, 17,
+		-92, -17, 43, -43, 34, 34, 63, 48, 99, 77, 55, -1, -20, 11, -94, -25, -49, -82, -96, 93, 69, 65, -14, 93, 96, 3, 28, 35, -92, 73, 7, -4,
+		-97, -81, -47, 78, 99, 19, 32, -70, 10, -12, 4, -73, -35, -55, 56, -69, 32, 37, -98, -99, -54, -78, -54, -77, 51, 33, -61, 84, 95, 21, 9, 81,
+		-41, 4, 81, 85, -29, -99, -23, -2, 90, -22, 50, -13, 36, -51, 27, 79, 29, -45, -20, -9, -81, 14, 11, -18, 67, 94, -64, 74, -100, 61, -52, -97,
+		-61, 23, 26, -11, -65, 38, -48, 72, -64, -60, 38, -2, 7, 16, 73, -36, -91, 96, -98, -99, 89, 15, -97, 40, -60, 21, -9, 77, 68, -66, 0, -60,
+		41, 43, 49, -71, -52, -27, -53, -21, -5, 22, -2, -16, -40, -14, -2, 12, -98, -92, 29, -9, 45, -4, -76, -64, 25, 86, -1, 36, -85, 67, -38, 16,
+		92, -55, -53, 48, -75, -48, -52, -99, 33, 29, -8, -46, 34, -24, -29, 2, -52, 8, -75, 58, -39, 1, -90, 41, -80, -41, -32, -24, 69, -82, -49, 31,
+		50, -35, 87, 87, -95, 69, -44, -5, 44, -74, -27, 19, 45, 0, 2, -70, -30, 27, 0, -28, 22, -64, -46, 60, -81, 15, 18, 41, -99, -91, 57, 44,
+		-72, -75, 29, 7, -94, 65, -90, 65, 23, 43, 32, 81, -16, 15, -99, 68, -93, -16, -17, 6, -58, -45, -100, 71, 63, 72, 20, -58, 30, -64, -16, -79,
+		-26, -31, -27, 97, -92, -85, -19, -35, -24, 42, 66, 27, -73, -24, -83, 81, 37, 7, -76, 14, 63, 58, -100, 17, 12, 5, -41, -36, 56, 42, 69, 94,
+		47, 46, -83, 91, -41, 56, 41, -87, -42, 25, -60, 43, -37, 47, -63, 54, 24, -59, -37, -7, -62, -1, -90, 69, -93, 17, -13, 75, 57, -43, 36, 77,
+		-90, 18, 25, 27, -58, 65, 96, -65, -20, -95, 87, -35, 74, 63, -95, 23, -89, 76, 81, -8, -64, 55, 16, 15, -66, 16, -99, 46, 97, -17, -71, -18,
+		59, -83, -82, -94, 4, -50, 49, 40, -88, 18, -66, 11, 26, -4, -49, 21, 42, -92, -59, 81, -33, 58, 14, 8, 22, -70, -38, -39, -67, -100, -25, -37,
+		57, 84, 41, 74, -38, 61, 90, 94, 84, -49, 15, -85, 5, -72, 8, -46, 8, -2, -74, 65, 41, 63, 5, -92, -71, 6, -73, 4, 2, 24, 31, -88,
+		-24, -58, 52, 45, -42, 93, 17, -18, -48, -63, -6, -16, 55, -21, 40, -65, -22, -88, 2, -98, 78, -37, 88, 2, -71, -8, -95, 94, -94, 69, -94, 1,
+		17, 6, -23, -88, 23, 51, 17, 9, 63, -84, 35, 49, 9, -41, -6, 90, -13, -71, 8, 60, -24, -5, 32, 55, -87, -22, 15, 28, -41, 74, -16, -81,
+		5, 7, -28, 99, 95, -41, -61, 83, 55, -58, -16, 59, -74, 36, -48, 48, 53, 16, -81, 35, 46, -80, 38, -73, 37, 90, 90, 86, -30, 80, 67, -90,
+		53, 87, -66, -6, -21, -26, 66, -41, 32, 91, 56, -92, 59, -18, 5, -93, -75, 4, -28, -27, -27, -64, 63, 55, -17, -100, 75, -3, -6, -3, 91, -1,
+		64, -26, 16, 12, 93, -88, -46, 38, -71, 90, -26, 57, -65, 46, 64, 97, -43, -18, -22, 80, -98, -46, 14, -69, -49, 65, -8, -24, 89, 12, 3, -98,
+		21, 15, 27, -58, -40, -56, -67, 45, 13, 67, -79, 54, 90, 75, 30, 44, -3, -5, -86, -27, 10, -46, -74, 10, 19, -97, 98, -70, -52, -9, -37, -50,
+		2, -35, 76, -65, 84, 22, 60, -90, -44, -94, 74, -78, 67, -59, -29, -47, -34, -23, -14, -68, 15, -60, -12, -58, 64, -7, 83, 71, 41, 26, 40, 17,
+		33, -15, 86, -61, 5, -55, 48, -50, -5, -30, -50, -21, 38, -81, -58, 11, -53, -10, -74, 21, -73, 16, -30, 17, -84, -26, -93, 38, 17, 36, -29, -17,
+		88, -77, -34, 64, 72, 92, -54, 78, 83, 80, -64, -34, -70, -45, -7, -93, -50, 69, 72, -20, -57, 86, 46, 59, 41, 91, 32, -53, -83, -9, 17, -48,
+		54, -78, 3, 22, -93, -92, 85, 66, 86, -36, -54, -74, -70, -51, -94, -4, -80, 5, -35, 66, -69, -67, -38, 38, 93, 38, -82, 95, -80, -22, -38, -86,
+		72, -71, -50, 65, 99, -50, -63, 19, 36, 22, 67, -8, -32, -78, 17, -57, 18, 97, 61, 6, -2, -82, 69, -45, 35, 47, 84, -42, 99, -96, 73, -4,
+		-80, 30, -57, -50, -39, -35, -9, 84, 12, -98, -23, -85, 8, 78, 4, 72, -77, 61, -24, 90, 42, -17, -77, 94, 76, 4, -9, -38, 23, -66, 68, 64,
+		74, -36, 15, -25, -27, -23, 29, 84, -92, 14, 46, -91, -45, 66, -71, -17, -82, -3, -41, 21, -86, 1, -7, -77, 5, 53, -19, 38, -38, -32, 82, 15,
+		0, 88, 58, -93, -20, 25, 52, -55, 70, 32, 61, 36, 68, 74, -55, 36, -70, -22, -80, 61, 70, -69, -92, -31, -30, 83, -10, -27, -5, -67, -44, 9,
+		84, -2, -87, 72, -62, -95, 23, 41, 33, -70, -6, -40, -29, 33, -14, -76, -74, 97, -24, 67, -64, 76, 49, 62, 8, 84, 50, 35, -66, 34, 10, -39,
+		87, -74, 89, -9, -73, 91, -3, -71, 44, 19, 13, 82, 21, 21, -6, 98, -57, -46, -86, -90, 44, 25, -9, -36, 41, 88, -26, 78, -77, 64, 97, -32,
+		-76, 17, 20, -82, -1, 83, -99, 93, -95, -86, -67, -57, 73, 62, -69, 99, 64, -94, 55, -4, -63, 70, 31, 34, 84, 21, -88, 2, -37, 43, 19, -63,
+		96, -46, -62, 56, 36, -10, 34, -65, 29, 72, 41, 38, 30, 47, -26, 35, -32, -31, -90, -67, 94, 18, -16, 37, -53, -59, -90, -62, 24, 75, 32, -37,
+		65, -27, -58, 2, -16, 14, -100, -56, -61, -50, -49, -2, 17, -85, -15, 85, -33, -35, 19, -32, 94, 73, 80, 37, 12, 35, -87, -12, 36, -82, -96, -100,
+		-90, 47, -25, -14, 58, 92, 11, 13, 18, 87, 20, -7, -97, 26, -2, 85, 67, -25, -10, 90, -3, -44, -65, -65, 52, 76, 72, -4, 24, -69, -56, 9,
+		-61, 19, 72, -56, -2, 66, 26, 84, 80, 43, 50, 95, 20, 82, -11, 78, -75, 26, 97, -44, -35, 29, -56, 51, 1, 84, 98, 47, -13, 52, -7, 90,
+		-88, 30, 4, -41, 98, 30, 6, 86, 87, 78, 73, -12, -10, -35, -47, -80, 26, 79, -11, 1, -61, -47, -8, -19, 86, -2, 50, -91, -29, -87, 51, -81,
+		-72, -42, 14, -95, -43, -69, 11, 88, -92, -39, 48, 62, -1, -72, 82, 34, -52, 49, -55, 19, -77, 72, 53, 86, 19, 14, -34, -69, 42, 58, 37, -46,
+		-5, 1, -9, -2, -93, 91, 90, -87, 63, -41, 9, -80, -60, 60, 32, -37, 51, 85, 50, -26, -93, 43, 75, 29, -78, 41, 16, 32, -35, -85, -99, 15,
+		57, -39, -27, 40, -96, -87, -23, 26, -94, 40, -83, 44, -96, 88, -47, -27, 31, -98, -7, -34, 2, 49, -21, 87, -84, -24, 13, -54, 42, -99, -35, -66,
+		-4, 29, 92, 19, 47, -5, 25, 54, -45, 8, -71, -81, 24, -28, 18, 65, 27, 22, 7, -21, 31, -3, 89, -30, -26, -83, 99, -81, 32, -36, 88, 50,
+		57, -68, 60, -5, -70, -78, 81, -30, 8, -42, 76, -79, 40, 73, -82, 39, -24, -72, 97, -70, -56, -10, -94, -17, -77, -4, -39, 97, 87, 34, -99, -28,
+		-88, -92, 57, 73, 27, -67, 51, -13, 44, -50, 3, -62, 46, 31, -92, 6, 51, -38, 60, 78, -1, -31, -5, 39, 77, 38, 3, -25, -39, -45, 7, -56,
+		-6, 18, 37, -10, 36, -36, -97, 77, 89, 67, 35, 16, 68, -3, 51, -81, -96, 48, -65, -62, -21, 71, 56, -6, 50, -11, -32, 36, -36, 40, -62, -69,
+		-89, -20, -85, -61, -1, 37, -80, 99, 61, 23, -11, -18, -49, -79, 57, -78, -60, 82, 65, -87, -94, 36, -8, -62, -61, 24, 22, 25, 65, 67, -86, -59,
+		51, 40, 23, 75, 4, 92, -60, -86, 15, 46, -22, 97, 83, 45, 30, -12, -42, 93, -49, 85, -29, -40, -91, 29, 38, 12, -46, -36, 11, 78, 91, -42,
+		30, -76, 48, 86, 1, -26, -20, -93, 61, 62, -92, -6, 52, -64, -29, 2, -79, -22, -44, 66, 35, 43, 22, -69, 26, 59, 18, 95, -84, -32, 33, 37,
+		-58, 90, -55, -1, 33, 56, 65, 46, -26, 85, 20, -47, 8, -56, 39, -77, 94, 7, 92, -10, -66, 89, 48, 56, -72, -58, 11, 94, -26, -43, -39, 93,
+		0, -21, -24, 86, -59, -9, 4, 78, -73, 96, 6, -22, 73, 16, -84, 62, -59, 20, 3, -84, -37, -12, 35, 79, -98, -49, -93, 39, 8, -100, 16, -19,
+		32, 7, 54, -92, 83, 11, 42, -25, 73, 82, 54, -43, -10, -95, -6, 99, -14, -11, -49, -89, 29, -66, 78, -28, -8, -88, -53, -32, 87, 9, -84, -59,
+		-81, -22, -39, 81, -62, 59, -49, 21, 75, -49, -72, -87, 46, -31, 89, -88, -18, -99, -20, 94, 45, -92, -5, -66, -89, -63, 36, -8, 69, -71, -8, 80,
+		31, -94, -91, -13, 32, -52, -76, 21, -57, -56, -79, -9, -35, 86, 30, 43, -99, -13, 82, -16, -5, -38, 88, -24, -27, 51, -79, 83, 41, 25, -90, -49,
+		56, -24, -43, 96, 68, 41, -67, 82, 60, -25, -50, -2, 65, -95, -93, 63, -41, -14, -19, 14, -67, 81, -45, -73, -25, 4, 53, -33, -49, 63, -25, -38,
+		-37, 57, 64, -2, -37, -73, 55, -72, -37, -22, -27, 70, 0, 49, -49, -78, -44, -28, -58, -37, -47, 19, -3, -54, -12, 61, 39, 34, 77, -97, -96, 47,
+		-78, -66, 18, 50, 9, -62, 97, -89, -31, -62, 71, 69, -76, 85, 31, -26, 66, -24, 61, -83, -79, -56, -12, 88, -21, -93, -19, -42, 8, -51, 99, 44,
+		-83, -48, -92, 59, 86, -21, 41, -78, -39, -11, 28, -69, 85, 36, 47, 47, -41, -52, -64, -20, -22, 27, 15, -76, 68, 50, 39, 87, 24, -53, 92, -100,
+		83, 81, 77, -81, 87, 23, -84, 52, 49, 80, 64, -92, 51, 58, -32, -84, 80, -56, -54, 22, -53, -42, 26, 6, -97, -64, 62, -18, 55, 74, -76, 43,
+		-100, 34, 86, 31, 52, 37, -51, -9, -55, -80, 88, 8, -4, 60, -93, -80, -93, 96, 81, -60, -99, -83, 92, -39, 56, -12, 96, -22, -21, -28, 46, -39,
+		96, 66, 83, -20, -27, 85, -11, -20, 91, 73, -99, -64, -3, 43, -80, 79, 0, -98, -52, -54, 59, -4, 68, 29, 60, 15, -30, 95, 43, 40, 42, -18,
+		-6, -95, -22, 33, -69, -53, 49, 75, 48, 95, -69, 78, -72, 87, -43, -97, 63, 79, 54, -59, -41, 48, -7, -66, 44, 79, -55, -92, -88, -66, -67, 35,
+		-99, 67, 11, -22, -98, 42, -62, -16, 73, -34, 53, 80, -9, -81, 23, -65, -92, 93, -37, 43, -97, -68, 60, 33, 15, 24, 24, 79, 19, -39, -67, -80,
+		-56, -33, 24, 28, -60, -1, -10, 45, -28, 82, -55, -70, 49, -77, 19, -18, -28, -23, 59, -29, -34, 63, -23, 13, 32, 88, 1, 92, 96, 76, -60, -90,
+		-38, 73, -57, 10, 51, 98, 85, 90, -55, 50, 52, 51, 8, -22, 81, -13, -97, 35, 33, 98, -21, 31, -95, -17, -54, 19, 16, -21, 1, 62, 73, -33,
+		-21, 27, 90, 93, -38, 24, 63, -7, 49, 93, -10, 76, 15, 59, 72, -80, -95, 35, 40, -14, 92, -89, -80, -62, -42, 72, 66, 93, 49, -64, -58, 71,
+		-32, -99, 89, 31, 69, -46, 44, 44, -96, 6, -25, 38, -69, -33, 80, 42, 32, -42, 95, -30, 33, 4, -58, -92, -74, -48, -35, 79, -21, 78, 59, -11,
+		14, -57, -43, 5, 85, -84, 66, 56, 48, -39, -7, -56, 7, -9, 80, -2, -64, 38, 58, -69, 21, 97, -5, -49, -2, 85, -85, 78, -73, 2, -15, 2,
+		25, -25, -9, 1, -58, 85, -19, -69, 80, -52, 83, -83, -94, 80, 44, 7, 61, 86, -71, 24, -97, -17, 32, -56, 78, -7, 55, 3, 35, -26, -52, 53,
+		-93, 62, -25, -35, -7, 13, -8, -2, 51, -54, -40, -85, -30, 84, -7, -71, 7, 94, -46, 21, -63, 14, 26, 59, -68, -96, -18, -60, -21, -86, 73, 52,
+		-3, 82, -38, -17, 99, -70, -58, 45, -62, -64, 22, 71, -58, -52, -58, 54, 49, 34, -58, -26, -7, 63, 42, 39, -86, -6, 31, 78, -50, -80, -47, -78,
+		21, -13, -70, -53, -90, -55, -41, -43, -31, 34, 73, 60, 54, -52, -87, -62, 7, 25, -96, 37, -7, 88, 11, 83, 38, -97, 55, -29, 95, 15, 27, 79,
+		86, 67, -25, 83, 5, 91, -2, -21, 25, 12, 43, 54, -54, 76, -60, 95, -25, 64, -88, -93, 49, -98, -43, 66, -59, -11, -71, 50, -46, 76, -40, 17,
+		37, 26, -27, -75, -35, 45, 62, -37, 79, 17, 59, 1, 30, 47, -96, 76, -76, -42, 38, 88, 54, -67, -72, 38, 89, 68, -33, 24, 31, 28, -6, -50,
+		7, -73, -70, 61, 72, -51, -39, 78, 12, 89, -67, -7, 54, -50, 65, 24, -33, -16, 66, -98, -36, 49, -32, -40, -24, -96, 25, -83, -1, -34, 76, -93,
+		-19, 66, -24, -2, -13, 12, -39, -29, 22, -30, -89, 2, 58, 97, -94, -58, 41, 76, -91, -83, -100, -66, 54, -92, -41, -10, -88, -12, -30, 58, 97, 4,
+		-69, 95, -83, 5, -32, -40, 5, -47, 73, -44, -78, 73, -8, 92, -64, 55, -47, 61, -98, 7, 89, -84, -16, 68, 62, 50, -40, 90, 74, -95, -2, -27,
+		-100, -99, -34, -33, 53, 81, -65, -83, 40, -32, 18, 4, -100, -96, 91, 96, -3, 69, -48, -47, -94, -90, 65, -34, 50, 70, 3, 75, -4, 80, 41, -91,
+		-23, 44, 98, -8, -25, 16, 24, -85, -33, -59, 33, -55, -71, 27, -99, -43, 46, 46, -13, -14, 67, -62, -25, -26, -25, -27, 60, 19, 61, 77, -15, -87,
+		-36, 10, 27, -65, -78, 44, -54, -6, 64, -65, 6, 59, 68, 26, 27, 25, 14, -22, 6, 84, -7, 70, -56, -82, -62, -4, -60, 42, 26, -71, 14, -31,
+		58, -65, 48, 65, -97, 43, -20, -8, -54, 11, -64, 15, -54, 33, -19, -2, -58, 38, -69, -55, 53, -75, -46, -67, 88, 68, -37, 52, 55, -17, 87, 20,
+		85, 62, 62, 78, 84, 9, -49, 78, -19, -44, 33, 47, -95, 7, -56, -48, 64, -71, 30, 71, -70, 88, 16, 9, -6, 36, 19, -94, 24, 93, 66, -2,
+		-91, 84, -67, 34, -26, 90, -35, -50, -20, 47, 23, 30, -62, 76, -30, -20, -32, -3, -3, 64, 17, -40, -21, -16, 15, 69, 92, 41, -31, -100, 99, 17,
+		34, -29, 10, 97, 15, -40, 33, 41, -91, 59, -93, 82, -79, -61, 46, 11, 93, 32, -100, -30, -73, 3, 46, -83, -13, -52, -9, 40, 62, -67, -50, 83,
+		24, 50, -95, -30, -3, -57, -92, 72, 57, -32, -3, 53, -47, -44, 91, 2, 22, 0, -20, -8, -42, 50, 49, -13, 20, -84, -43, -38, 53, 23, -79, -59,
+		25, -73, -54, 56, -52, -8, -94, 57, -24, -98, 63, 33, -70, -58, 43, -29, 45, 6, -16, -73, -31, -91, 47, 17, 50, -6, 61, 17, 52, -63, -18, 93,
+		67, -30, 59, -8, -9, -76, 30, 4, 43, 23, -5, 82, 34, -56, 58, -5, 31, -19, 23, 99, -24, -57, -70, 41, -46, -77, -4, 82, -85, 11, -51, 80,
+		9, 22, -47, -16, 13, -58, 49, -88, 27, -75, -81, -83, -59, 77, -58, 44, 57, -19, -14, -33, -98, -1, -2, 34, 18, 67, 52, 46, 77, 40, 76, -33,
+		-41, 71, 48, 74, -81, 99, -98, -47, -23, 30, -33, 35, -81, -77, -62, -50, 29, 36, 18, -53, 16, -49, 50, 67, -11, -32, -97, -40, 27, -95, -37, 58,
+		-64, 99, 65, 83, 12, -65, -18, 78, -54, -72, -21, -26, 71, -26, 30, -91, 18, 83, -24, 79, -47, -86, -49, -3, -38, -32, 36, 28, -2, 21, -91, -85,
+		58, -5, -79, 25, 7, 68, -92, 74, 68, -86, -61, 42, 28, -59, 45, 1, 40, 61, 59, -98, -54, 0, 67, -23, -8, -46, -2, -68, 80, -46, 6, 13,
+		-97, -72, 60, -100, 48, 85, -43, -49, 56, -76, 79, -56, 83, 46, -35, -82, -54, -3, -70, -42, -76, 51, -47, -18, -76, 33, -50, 90, -45, 46, 27, 17,
+		-10, 98, -72, 29, 90, -69, 61, -68, 67, -27, -72, 17, 70, 12, -21, 22, 8, 5, -81, 70, 50, -70, 43, 21, -36, -47, 12, 61, -79, -44, 80, -100,
+		33, -96, -32, 76, -74, 12, -43, -23, 18, -30, 99, 64, 22, -70, -6, 7, 92, -80, -2, 29, -14, -49, 34, -4, -42, -55, 40, 64, 4, 95, 19, -92,
+		33, -30, 88, 20, 72, -46, 44, -89, -28, 2, -59, 43, -38, -14, 93, -26, -35, 54, 80, -43, 97, 1, -63, -73, 34, -72, 23, -9, 73, 67, 86, -6,
+		21, -47, -48, 84, -49, -95, -34, -94, 30, -92, -58, 26, 88, -51, 5, -7, 72, -62, 33, 86, 90, -29, 35, -72, 53, 41, 86, -28, 68, -51, -20, -59,
+		-48, 61, 76, 9, 18, -42, 8, 76, -60, -93, -15, 41, 81, 40, -57, -27, 74, -23, -86, -87, -11, 76, 87, 59, -40, -16, -79, -75, 73, -23, 2, 49,
+		-23, -40, -17, 74, 0, 39, -82, 23, 22, 87, 2, 12, -66, 54, 20, -71, 73, -45, 44, -72, -21, -91, -58, -60, 66, -11, 42, 39, 13, -2, -59, 9,
+		56, 28, -13, -74, 31, 34, -76, 60, 12, 68, -22, 80, -69, -15, 53, -22, -27, 69, 28, 54, 82, 66, -12, 33, -34, -46, 29, -69, 72, -2, -6, 72,
+		-36, 64, -45, -83, -64, -85, 23, -37, -70, 32, -20, -46, 62, 37, 82, -78, -71, 30, -30, -44, -68, -64, -12, 79, 96, -48, -47, 60, 16, -41, -41, -5,
+		60, -4, -61, 32, -51, -12, 83, -23, -7, 22, 43, -29, -84, -1, 91, 92, 35, -57, -45, 24, -98, -96, 37, 83, 80, 93, 55, -45, 28, 86, 47, -98,
+		66, -53, 11, 79, -11, 68, -54, -30, 44, 49, -55, 54, -80, -13, 84, 47, 74, 33, 71, 26, -78, -70, 28, -35, -76, 12, -65, 97, -64, 68, -3, 13,
+		-93, 84, -39, 89, -6, -26, -22, -34, 49, -44, -11, -66, 96, -96, -13, 10, -32, 15, -72, -33, -95, -96, -73, 77, -67, 71, 50, 59, 0, -34, 2, 37,
+		-26, -41, -76, 85, -86, -18, -72, 21, -73, -1, 16, -22, 36, 97, 23, -9, -41, 3, -71, 99, 80, -77, -71, -95, -79, -4, -19, 26, 47, -19, 68, 72,
+		43, -12, -10, 30, 2, -16, 88, -1, 34, 33, -59, 86, -98, 31, -85, 56, -20, 3, -34, -11, -31, -19, -98, 76, 95, -87, -71, -54, -13, 80, 12, -95,
+		48, -29, -32, -69, 80, 83, -96, -35, -30, -69, 74, 84, -22, -17, 21, -52, 52, 25, 12, -28, -56, -54, -36, -65, 8, -88, 96, -29, -90, -84, -2, -11,
+		-25, 37, 75, 72, 81, 71, -47, -85, -54, 50, -21, -90, 7, -31, -45, 4, 34, -3, -41, 7, 52, 25, 78, 23, 14, 89, -82, -25, -54, -50, 15, -88,
+		75, -44, -83, -99, 81, 54, -57, 56, -72, -39, 68, 92, -1, -41, 73, 55, 83, -70, 92, 41, -26, -35, -98, 52, 65, 68, -77, 81, -41, 8, -59, 88,
+		-74, -18, 28, -64, 30, -8, 44, -56, -12, 40, -16, 44, -71, -19, -23, 30, 76, -33, -25, 60, 10, -61, 99, -69, -48, 78, -39, 64, -78, 42, -46, 18,
+		7, -62, -4, 27, 64, -92, 98, -96, 72, 31, -14, 3, -99, -84, 3, -4, 83, -95, -82, -74, -39, 90, -47, 71, -38, -59, -6, 52, -100, -87, -76, -43,
+		-44, 55, 20, -24, 58, 29, 10, -15, 71, -84, -24, 49, 35, 62, 0, 91, 2, -90, 33, 45, -52, -16, -44, -34, -91, 2, -93, -18, 32, -98, -3, 70,
+		89, 91, 6, -28, -40, -74, 64, -30, 44, 84, 45, 87, -100, 85, 20, 6, 39, 6, -55, 83, 39, 74, 31, 63, 15, 60, 4, -3, -71, -72, -23, -28,
+		14, -44, -22, -83, -44, 53, -7, 64, 8, 13, -85, 90, 56, 33, -53, -81, -57, 81, -36, 47, -74, 72, -69, 9, 28, -39, -32, 81, 5, 85, -40, -12,
+		39, 66, -85, 39, -76, 45, -30, 31, 82, 77, -22, -28, -35, 73, -2, -15, -89, 50, -97, -83, 70, -4, 89, 98, -47, 17, -92, 27, 24, 33, -1, -86,
+		87, 95, 99, -20, -93, 45, -15, -17, 25, -80, 81, -13, -26, -15, -77, -5, 12, 50, -91, -89, 16, 93, 54, 64, -19, 50, 59, -24, 12, 54, -47, 83,
+		-23, -64, 19, -94, 34, -72, -81, -16, 37, 38, -30, 48, 11, 34, 41, -24, -80, -35, 27, 77, -60, 15, -52, -73, -89, 6, 12, -52, -2, -77, 39, 87,
+		34, -18, 20, 56, 10, -32, -24, -44, -5, -23, -3, -86, -70, -56, 60, -60, 89, 70, 3, -5, -83, -61, -83, 53, 62, 6, -50, 2, -82, 10, -55, -58,
+		86, 53, -92, 17, -45, -40, 79, 6, -22, -5, 4, 22, 64, -59, -73, -50, 80, -78, -16, -88, -57, 81, -71, -50, 51, 98, 81, 27, 80, 84, 77, -37,
+		75, 11, -65, 47, -83, -33, 52, -23, -83, 68, -24, 16, 28, 40, -96, 69, 63, -19, 17, -48, -2, -49, -89, 95, 22, 42, 16, 95, -92, -50, -7, -15,
+		-90, 31, -36, -49, -33, -41, -62, -17, 87, -97, 45, 6, -13, -32, -11, 71, 74, 21, 88, 9, -34, 69, 72, 36, -72, 93, -71, -5, -25, -72, 32, -40,
+		69, -28, -50, 52, -29, 93, 15, 81, -77, 89, -81, -47, -97, 18, -96, -65, -92, -38, -61, 44, -51, -27, -6, 54, -46, -19, 87, 46, -64, -99, -64, 8,
+		93, -52, 40, 84, -34, -18, 37, -8, -70, -57, -26, -42, -94, 13, 50, -100, -99, -100, 90, 30, -3, 69, -9, -3, 98, -16, -35, 28, 9, -84, -37, -51,
+		62, 28, 61, 86, -33, 46, -62, 78, 68, -99, 12, -17, 57, -48, 66, -65, -14, 67, -30, -21, 76, -1, -80, 64, -84, 90, -25, -4, -78, -10, 52, -47,
+		-3, -99, -53, 35, -85, -63, 4, -8, 9, 56, 24, 47, -15, 16, -3, -34, 82, 72, 16, 9, -21, -80, -45, 36, 29, 74, -94, -15, -77, 43, 58, -30,
+		82, -7, 74, 9, 28, 65, 36, -5, -5, 63, -99, 17, -47, -62, -65, -96, 56, -59, 96, 35, -4, 95, 35, 69, -35, 79, 67, 16, 12, 50, -89, 77,
+		-25, 54, -51, 8, 74, -91, 45, 15, -67, -49, -49, 22, -27, 38, 88, 91, -62, -81, 30, 20, -16, -65, -90, -14, -5, -84, -51, -46, 18, 94, -11, 54,
+		-47, 78, 13, 17, -97, -47, -87, -25, -24, -30, 54, 45, -8, -94, -64, 13, 44, -72, 40, 76, 51, -49, 9, -40, 9, 72, 46, 95, -35, -93, -30, 96,
+		16, 11, 98, -3, 62, 22, -89, 13, 28, -100, -89, 68, -72, 58, -66, 81, -47, -9, -20, -13, -92, -23, -82, 46, -15, 85, -66, -6, -22, -77, 98, 31,
+		80, 22, -23, -75, -81, -24, 77, 62, -100, 11, -5, -52, -66, 43, 64, -12, -4, -5, 31, -29, 63, 4, 75, 86, 3, -96, 61, -69, -63, 11, -53, -95,
+		65, -43, 82, -86, -54, -47, -37, -61, 6, 38, 66, -79, -86, -41, -72, 69, -29, 70, -29, 81, 34, 29, -21, 36, 94, 92, 38, -7, -2, 27, 11, -68,
+		-6, -5, -55, -82, 77, 96, -80, 90, -96, 90, 18, 7, -28, -18, -47, -64, 40, -87, -58, -40, 86, 15, -55, -64, 0, 47, 15, 32, -83, -14, 96, -70,
+		-31, 50, -92, -95, 60, -100, 59, 84, -49, -44, -46, -67, -86, 83, -46, 16, 36, -89, 80, 51, -90, -34, -55, 26, -68, -64, 31, 51, -78, -78, 37, -23,
+		-87, 65, 25, 57, -89, 3, -54, 39, -90, -4, 97, -1, -95, 33, -17, -91, 34, -59, -8, 92, -4, -28, 61, 97, 57, -41, -64, -8, -60, -64, -28, -48,
+		-100, 97, 78, 41, -57, -78, -67, -72, -25, -13, -8, -76, -8, 74, -25, -28, 82, 67, 33, 40, -7, -39, -65, 28, 39, 71, -76, -43, 34, -85, -80, -96,
+		11, -79, -21, -9, -5, -89, -39, -49, 43, -44, 87, 97, -55, 22, 49, -63, 62, -65, -44, -44, -91, 12, 92, -66, -95, -18, -2, 48, -31, -54, 49, -4,
+		62, 15, -38, -56, -71, -59, 8, -18, -75, 70, 18, 17, 9, 82, -95, 41, 94, 60, 62, 92, 78, -58, -22, -70, -89, 42, 24, 62, 66, 16, -58, 64,
+		-41, 26, 78, -50, 5, -66, -1, -3, -64, 67, -98, 54, 44, -44, 49, 94, -80, -33, 26, -31, -38, -24, 95, -85, -70, -71, -71, -30, 27, 24, -17, 22,
+		-88, -60, 51, 95, -88, 76, 86, 54, -43, 27, 20, -94, 34, 87, -60, 41, 95, -50, -49, -69, 34, -11, 9, 42, -88, -46, 38, 7, 75, -77, -60, -29,
+		74, -43, -34, 73, 56, -96, -39, 89, -19, -83, 64, -74, -67, 82, 83, -29, 38, 41, -41, 12, 95, 35, 9, 53, -79, 69, -71, -71, 46, 15, 75, -49,
+		-24, 86, -96, 32, -65, -85, -33, 84, 10, 12, 19, 63, 22, 41, 80, 51, -63, 49, -6, 44, -89, -96, 61, -12, 33, 47, -49, 76, -80, 32, 9, -79,
+		-32, -59, -95, 5, 15, -57, 72, -64, 21, 92, -10, -62, 73, 5, -86, 60, 69, -6, -11, 83, 11, -63, -63, 3, 98, 13, 46, 40, -27, -13, -30, 19,
+		39, -79, -98, -70, 83, 12, 98, 43, 95, -70, 59, 53, -4, -95, 73, -12, -44, -14, -10, -8, 93, -76, -75, 82, -64, -83, -13, 53, 5, -35, -30, 41,
+		-54, -47, -75, -62, -81, -17, 72, 33, -95, 61, -8, 35, 9, 98, -32, 53, 47, 35, -88, -62, -95, 24, 43, -35, 48, -17, 76, 76, 56, 77, -90, 10,
+		10, -35, 61, 4, -63, -51, 94, 20, 54, 94, 98, 61, 84, -75, 86, 68, -40, -67, 73, -41, -33, 84, -22, -30, 16, -91, -57, 86, -45, -9, 63, 78,
+		-33, 90, -23, -38, -35, -21, 97, 86, 35, 5, -56, 64, 4, -99, 58, -3, -11, 25, 34, -98, 36, 77, -41, -24, -66, -68, -75, 93, -12, -74, 73, -13,
+		-99, -12, 19, 12, 84, -78, -23, -38, 99, -90, 17, 19, 99, -20, 53, 15, -33, -26, -93, -62, -4, 55, -17, 73, -8, 29, -70, 35, 30, 18, 65, 48,
+		12, 14, 21, 6, 90, -13, 53, -45, -32, -54, -62, -33, -27, -31, -71, -47, -22, -68, -37, -90, 22, -43, 87, 49, -7, 49, 52, -13, -44, -55, 75, -39,
+		95, -86, 30, -71, 92, -48, 28, 56, 16, 16, -26, -7, 62, -56, 48, 42, 22, -48, -29, 87, -10, 41, -85, 92, 72, -11, 39, 25, 98, 92, 4, 97,
+		42, 23, -59, -7, -95, 30, -39, 57, 32, -59, 60, -92, 56, 20, -43, 39, 73, 75, 41, -77, -2, 47, 84, 62, -1, -4, 73, -88, -12, 19, -82, 81,
+		-13, -50, -76, -94, -80, 3, -31, -5, 66, 64, 70, 21, -95, 12, 77, -12, -2, -8, -97, -29, 74, -99, -58, -10, -26, -31, 15, 77, -89, -1, 81, 29,
+		28, 39, -33, 78, 2, 59, -62, -15, 39, 83, -84, 40, -89, 42, -45, 31, 15, -68, 65, 76, -100, -85, -84, 58, 60, -66, 38, -85, -34, -71, 41, 50,
+		27, -54, 75, 73, 29, 19, -14, 42, 74, -70, 54, 25, 60, -52, 3, 68, -63, -66, 42, 97, 86, -92, -26, -55, 66, 66, 55, 18, -85, 47, 9, -85,
+		-17, 20, -17, 96, -96, -75, 30, -29, 30, 55, -36, -7, 76, 95, 0, 34, -98, 98, -21, 52, 31, -6, -37, 34, -87, -79, -27, 57, -90, 90, -34, -10,
+		-86, 49, -82, 52, -27, -15, -24, 6, 58, -20, 66, -4, 34, -18, 10, -61, -67, 87, 36, 27, -52, -12, -91, 88, -33, 77, 19, -66, -97, -28, 40, 95,
+		-14, 1, 23, -2, 80, 53, -21, 14, 93, -21, -20, 4, 54, 49, -10, -95, -42, 28, -93, 51, -95, -36, -79, -67, -17, 8, 41, -40, 38, -17, -87, -57,
+		-85, -18, -1, -65, 19, 83, -70, -31, 54, 52, -40, -99, 12, -61, 63, 30, -62, -81, 60, -90, 1, 20, 64, 20, 39, -49, 47, 59, 89, 71, -79, 55,
+		-87, -88, -52, 33, 78, -71, 24, 6, 72, -72, -55, -52, -27, 85, -46, 42, 68, -56, -76, 67, -77, -23, 55, 47, 11, 9, -30, 55, 69, 14, -73, 57,
+		57, -18, -67, -53, -79, 46, -47, 49, -75, -62, -71, 94, 74, -68, 79, 89, -65, 33, 39, -49, -74, -15, -57, 0, 16, 33, -74, -29, 63, 78, 3, 31,
+		-33, 59, 65, -55, -53, 51, -61, -25, 19, -75, 63, -56, 87, 45, -15, 41, 51, 14, -38, -52, -6, 12, 87, 54, 57, -11, -18, 81, 72, -14, -88, 68,
+		56, -79, -14, 63, 61, 6, -30, -5, -89, 50, 95, 85, 37, 35, -26, 30, 96, -66, 73, -7, -60, -58, -75, -99, -96, -71, -86, 86, -96, 87, 48, 23,
+		57, -28, 59, -3, -41, 57, -27, 45, 64, -4, 82, -9, -10, -58, 89, 38, 44, -62, 98, -27, -69, 97, 21, 31, 13, 62, 25, 71, -30, 10, 51, 18,
+		-18, 40, 13, 63, 89, -91, -26, -87, -17, 2, 66, 58, 20, 36, 60, 76, 67, 36, -71, 92, -98, -18, -19, -61, 79, -23, -39, 61, -33, 16, 91, -37,
+		-65, 50, -17, 74, -53, 52, 2, 43, -46, -29, 97, 0, -50, -100, -47, -55, 40, 22, 59, -15, -83, 69, 43, 17, -57, -55, -80, -91, 38, 14, -65, -34,
+		57, 23, -75, -54, 26, -17, 38, 62, 77, -75, 34, 75, -8, 83, -74, -95, -41, -12, 69, 91, -51, -91, 87, -33, -7, 9, 78, 73, -13, 45, 26, 20,
+		-10, -58, -74, -79, 99, -91, -32, -19, 29, -58, -48, 76, -86, -86, 78, 9, 30, 98, -94, 44, -42, 51, 93, -85, 76, 91, 60, 62, 85, -88, 50, 20,
+		29, 12, 72, 26, -69, 83, -8, 82, 47, 42, 13, -1, -95, -87, 82, -66, 24, -58, -70, -62, 98, 89, -27, 86, -5, 86, -99, -37, -59, 33, -54, 92,
+		26, -78, 79, -99, -17, -73, 93, -93, 34, 66, -52, 94, 35, -67, -28, -70, 34, 55, -75, 13, 1, 54, -7, -3, -45, 45, 91, -88, -31, -6, 47, 66,
+		57, 56, -12, 30, -2, 46, 35, -94, 35, -29, -1, 10, 88, 19, 37, -21, -13, -95, -80, 83, 72, 95, -17, -50, 9, -11, -15, -61, 6, -76, 30, -30,
+		-37, -57, -10, 79, -37, 97, 11, 20, 39, -40, 80, 58, 96, 33, 40, 65, 13, -15, -100, -98, 81, 98, 16, 39, -9, 56, 23, 94, 62, 5, -77, -79,
+		-52, -60, -63, -14, 17, -99, -67, 35, 95, 20, 83, -11, 50, -55, 54, 94, 60, -51, 83, 83, 19, 5, 70, -57, 67, -51, 41, 74, -23, 41, -32, -77,
+		46, -74, -71, 8, 27, -51, -11, 51, 47, 97, -61, -61, 21, -89, -16, -24, 15, -31, -67, 49, -78, 73, 69, -99, -60, 15, -4, -69, -11, 37, 21, 96,
+		-33, 78, 79, 88, -97, -72, -15, 81, 75, 60, 6, 64, 66, -22, -66, 61, 55, -10, -34, 17, -34, 44, 91, -8, -32, -41, 77, 56, -2, 62, 59, 40,
+		-2, 67, -11, -23, 54, -51, 2, -95, 73, -53, -98, 23, 26, -94, 62, 72, 50, -23, 86, -42, 15, -24, 44, -59, 20, 43, 8, -52, -91, -37, -84, 96,
+		-83, -76, -23, 64, 30, -39, -54, 76, 76, 62, -61, 66, -32, -20, 16, 72, 80, -84, -72, 43, 8, 3, -84, 86, -35, -71, 70, 61, 97, -91, -32, 23,
+		-94, 28, 4, 18, -17, 72, 32, 17, -99, -29, -68, 48, 43, 98, -21, 65, 92, -44, -97, -6, 56, 43, 94, -88, 94, 68, -39, -74, 6, 99, -66, 62,
+		41, -57, -51, 9, 96, 63, -66, -71, -64, 18, 30, -92, 71, -73, -58, -84, 35, 75, 74, -10, 59, -49, 7, 51, 39, 43, 88, 90, 1, -62, -41, 61,
+		-23, -1, -20, -62, -65, 92, -4, 6, 77, -32, -29, -32, 50, -75, 68, -94, 74, -37, 80, -18, -25, -23, -78, -72, 51, 58, 86, 32, -24, 80, -92, 46,
+		-42, -5, 88, -38, -51, -12, 85, 77, -60, 35, 5, -47, -5, 7, -24, 69, -29, -53, -4, 68, -18, 38, -53, -5, 52, 97, -82, 51, -79, 23, -43, 53,
+		-8, -96, -12, -88, 58, -70, -94, 46, -91, 33, -99, -22, -99, -36, -91, -41, -72, -65, -59, 34, 51, -35, 45, 16, -12, 30, 62, 36, 88, -32, -3, -26,
+		-61, -47, -84, -81, -29, 72, -71, -23, 10, -63, -47, -78, 36, -27, -81, 16, -25, -67, -41, -55, 85, 85, -82, 93, -14, 64, 71, -31, -70, -84, -15, -30,
+		-79, -72, -48, 13, 94, 0, -78, -32, -47, 76, 74, -51, 82, 11, 51, 10, -44, -44, -77, 35, 59, 33, -32, 27, -77, 89, 39, 77, -31, 86, 74, -37,
+		91, 74, -27, 36, 15, 67, 59, 96, 89, -84, 66, -44, 19, -79, -4, 52, -87, -73, 1, 78, -29, -61, -10, 85, 55, -82, 10, -5, 20, -83, 74, -18,
+		62, -70, -14, -97, 33, -50, -90, -22, 10, -62, -44, 25, -98, 10, 54, -33, -97, 45, -12, 95, 63, 75, 48, -11, -17, 33, -24, -7, 23, -20, 93, 2,
+		-80, 17, -37, -83, -63, -82, -12, -80, 33, -57, -32, 29, -38, -96, 85, 75, -71, 4, -51, 74, -26, 99, -87, 53, 5, 80, 47, 88, 14, -38, -33, -57,
+		56, -56, -88, -17, -61, 43, -11, 31, -76, 75, 72, 23, 25, -63, -76, -25, -4, 12, -72, 93, -54, -36, 86, -9, 2, 49, 26, -17, 18, 66, 16, -78,
+		-83, -40, 45, -36, -98, -53, -5, 88, -10, 49, 84, -1, 58, 11, 74, -20, -68, -41, -61, 31, 43, 39, 5, -76, -11, 82, -71, 44, -25, -29, 45, -59,
+		1, 20, 3, -16, 30, 9, -4, -31, -7, -77, 74, 47, -81, -51, -93, 52, 1, 92, 89, -100, 70, 18, -43, -86, 60, 21, -18, -91, -81, -90, 78, 90,
+		-98, 24, -7, 97, 54, -33, -38, 89, -75, 56, 55, -27, 31, -14, -65, 61, 54, -50, -70, -6, -2, 52, 68, -18, 98, 11, -56, -3, 61, 41, -48, -20,
+		10, 7, 84, 52, 39, 41, -55, 42, -2, 9, -43, 18, -19, -86, -32, 71, 19, 57, -7, -98, -86, -84, 48, 59, -54, 70, 57, 46, -29, 38, -41, 23,
+		62, 90, 0, -52, -74, -45, 79, -14, 0, 86, -47, 98, 3, -28, -90, 24, 48, -4, 86, -14, -37, -5, 2, 39, 15, 53, 38, 72, 89, -4, -38, 69,
+		-33, -92, 80, -72, -88, -69, -56, 72, 5, 87, 53, -74, 28, -79, -58, 73, -68, -19, 5, -16, -90, 50, -97, -82, -43, -74, -91, 85, -88, -31, -82, -10,
+		-21, 36, -5, 64, -59, 13, 69, -22, 18, -8, -69, 31, -99, 55, 25, 70, 81, 36, -16, -8, -48, -70, -27, -82, 97, -8, -6, -22, -82, 45, 35, -71,
+		-54, -11, -80, 97, 62, 14, 33, 7, -82, 17, 23, 21, -46, 19, -25, 81, -44, -79, -16, -52, 21, -74, -21, -18, 99, 70, -99, 10, 21, 27, -77, -54,
+		-58, 23, 72, 86, 18, 13, -5, -43, -95, -96, -56, -79, 48, -62, -7, 77, -81, -85, 87, -18, 17, -94, 95, -85, 78, 27, 40, 60, 70, 94, -60, 66,
+		-11, 65, -74, 45, 64, 68, -97, -82, 11, -61, -9, 66, -25, 32, 63, 51, 24, -74, 39, 27, 91, 81, -65, -89, 27, -43, -60, 1, 42, -91, -16, -8,
+		36, 14, -57, 61, -99, -10, 70, 91, -17, -86, -93, 9, 61, 41, -87, 59, 63, -44, 37, 20, -24, 34, -80, -50, -81, -35, -68, 47, -12, 69, 65, -16,
+		39, -9, -17, 96, 69, 88, -38, 48, 80, -51, 0, 49, -20, 99, 67, 79, -24, -65, 50, -81, -40, -63, -57, -40, 67, 20, 76, 93, 5, 75, -98, 96,
+		15, -50, 5, 47, -91, -17, 13, 84, 83, 21, 60, -86, -90, 82, 54, 2, -88, 33, -22, -44, 32, -33, -78, -54, -28, 64, -60, -72, 39, 25, -64, 36,
+		-46, 28, 80, 92, 84, -59, -74, 36, -68, 73, -1, -98, 23, 63, 86, 98, 28, 20, -81, -56, -42, -47, -4, -31, -64, 75, 22, 92, 37, 91, 34, -94,
+		-97, 85, -86, 65, 11, -3, -32, -71, 57, -65, -76, 3, -28, -75, -67, 21, -14, -9, -59, 71, -93, 98, 32, 79, -49, 75, 32, -64, -6, -86, -75, -88,
+		67, -59, 62, -46, 45, 1, 82, -3, 32, -60, -30, 0, -91, -65, 81, 51, -63, 93, -13, -25, -81, 43, 58, -17, -68, 50, -56, -50, -13, -74, 39, 82,
+		-16, 65, 1, 77, 88, -78, -94, -62, -50, -25, -18, 92, -43, -5, 63, -99, 69, 14, -100, 87, -46, -25, 73, 94, -30, 29, -82, 62, -39, 41, 51, -62,
+		-4, 12, 24, -63, -49, 10, -70, 36, -24, -100, -12, -71, -26, 79, -22, -28, -48, 43, -81, -46, 37, -2, -90, -39, 76, -91, 3, 93, -69, -6, -88, 13,
+		-80, -28, 39, -41, 36, 32, -25, 97, 93, 93, 17, 85, -72, 3, -94, 97, -35, -36, 7, 5, 34, 28, -51, -33, -17, 84, 29, -43, 21, -11, -29, -86,
+		-20, -69, 6, -63, -28, 82, -99, 3, 66, 90, 89, 60, 18, 26, -10, -45, 86, -58, 24, -19, 54, 38, -47, 67, -37, -52, -74, 30, 14, -47, -1, 13,
+		-74, -91, -81, 80, 10, 52, -81, 75, -70, -53, 79, -37, -97, -47, 13, 9, 79, 44, 94, 42, 18, 87, -58, 84, -89, -53, -33, 1, 14, 22, -78, -39,
+		35, 35, 68, 59, 98, -60, -66, -100, 9, -89, 32, -60, 29, 4, 36, 18, 90, 20, -66, 9, 64, -14, -70, 62, 53, -39, 28, -35, 32, 39, -51, -78,
+		-100, -21, -57, -41, 52, 99, 66, 5, 67, -26, 67, 91, 55, -14, -69, -51, -61, 42, -33, 94, 60, -73, 82, -54, 92, -95, -49, -93, 44, -73, -11, -88,
+		-92, -55, -10, -56, 71, 96, -4, -61, -90, 43, -11, 62, -79, 46, -25, -2, 81, 22, 23, 79, -51, -16, 39, 32, 16, -5, 5, 42, -5, 76, 15, 82,
+		76, -26, 92, -50, -16, 60, -67, -82, 28, 4, 9, 9, -86, 93, -28, 92, 7, 44, -54, -57, -31, -42, 42, 8, -55, -23, -73, -72, 33, 75, 92, 93,
+		-67, -98, 3, 5, 46, 9, -48, -56, -90, 37, -83, -37, 0, 87, 72, -31, -71, 41, -15, -1, -81, -9, 53, 60, -77, -25, 39, 56, 41, 69, -20, -54,
+		-85, 99, -70, -90, 66, 90, 42, -82, -87, -74, -67, 67, 74, -54, 66, -55, -68, 85, -84, -39, 17, 22, 18, 32, -93, -99, 8, -56, 90, 40, -41, 65,
+		-65, -34, 71, -14, 7, -79, 50, 72, 17, 73, 46, -74, 95, -50, 23, -11, 39, -16, 75, 37, 25, -2, 40, -46, -61, -50, -55, 38, 61, -93, 73, 80,
+		72, -2, -97, 61, 67, 4, 42, -56, -9, 33, -21, -39, -71, -86, -2, -85, -23, 30, 52, -30, -30, -23, -96, 72, 25, 41, -95, -99, 93, 26, -47, 49,
+		11, -35, 27, -34, 15, -16, 40, 86, 53, -15, -27, -43, 17, -11, 63, 3, 29, -55, -82, -8, 31, -40, 38, -25, -48, 28, -77, -80, -62, -71, 61, 97,
+		-61, 83, -33, -4, -3, -19, 57, -67, 0, 86, 31, 70, -42, 34, 39, 24, 28, -46, -100, 59, 7, 89, 0, 64, -38, 27, 92, 61, -15, 31, 26, 63,
+		34, -86, 76, 43, -16, 22, 64, 84, 3, 86, -19, 68, -23, -55, 77, -14, 43, -92, 34, 46, -7, 0, 86, -89, 29, -14, 69, 86, -21, 89, 3, 42,
+		44, -75, 11, -17, 21, 80, -72, 93, 6, 34, 61, 53, 22, 59, -70, 88, -20, -98, -95, -68, 56, -86, 44, -91, 42, 91, 11, 10, -99, -66, 17, -79,
+		-74, 11, 28, 34, -59, -4, -83, 49, 43, 27, 80, 5, 91, 8, -23, -88, 86, -16, 32, -78, 58, 47, -38, -53, 4, 90, 1, 54, 11, -40, 79, -75,
+		-20, 55, 8, 3, -88, 65, 49, -38, -75, -83, -62, -17, -60, 76, 78, 67, 1, -42, -68, -36, -100, 51, -18, 84, 48, -95, 53, 65, 69, 24, 93, 7,
+		-21, -17, 28, 33, -26, 47, -22, -34, -67, 85, 8, -75, -44, 99, -79, 34, -2, -69, -36, -73, 99, -72, 69, -89, 20, 0, -99, 90, -64, -8, 52, 98,
+		78, -100, -2, -41, -76, -27, -60, -92, 32, 27, 59, -92, 62, 80, -20, 88, -46, -26, 70, -24, -25, -41, 13, 22, -44, -57, 3, 40, 47, -82, 94, 94,
+		57, -98, 59, -21, -99, -18, -17, 52, 50, 39, 41, -58, 89, -19, -85, -16, -35, -84, 35, 32, 40, 47, 89, 86, 72, 63, 78, 51, -54, -19, 71, -12,
+		-45, -76, -37, 57, 20, -80, 90, -24, 36, 38, -76, 65, 77, 36, -7, -49, 49, -99, -4, -24, -31, -71, 82, 64, 83, -29, 94, 0, 16, -70, 54, 72,
+		72, 11, -54, 67, 12, -20, -26, 48, -56, 53, 92, -44, 50, -73, 62, 67, 49, -70, 96, 73, 41, 71, -57, -89, 76, 42, -50, 95, 15, -7, -93, -58,
+		-18, -98, -79, 34, -73, 10, 78, 76, -64, 91, -20, 53, -20, -86, 92, 32, -21, 92, -35, 52, -36, -28, -47, -33, -4, 15, 48, 66, -3, -93, 11, 41,
+		55, -24, 98, -26, 17, -32, -9, -73, -92, 18, -9, -85, -26, 90, -68, -24, -51, -48, 4, 79, -52, 53, 27, -27, -77, -2, 77, 10, 62, -33, 54, 74,
+		-15, -44, 89, 62, 69, 61, 42, 67, 5, -51, -65, 50, 57, 20, 58, 94, 28, -25, -49, -2, -100, 75, 37, -60, -38, -7, 98, 63, 54, -28, 37, 51,
+		4, 73, 41, 25, 87, 6, -17, -83, 3, -89, -43, 30, -77, -8, -43, 18, 8, 81, 29, -12, -60, 70, 84, 7, 21, 95, 25, 14, 62, -93, 49, -84,
+		55, -25, 4, -74, -49, -92, 61, 36, 83, 82, -55, -41, -1, 46, 34, 14, 66, 96, -39, -46, 76, -78, 51, 64, 68, 75, 97, -16, -45, 29, -66, -31,
+		17, -30, 72, 34, -26, 58, 56, 99, 73, -19, 18, 17, 39, 60, 93, 24, 26, 80, 78, -52, 65, 0, -43, -66, 34, 25, -35, -36, 99, 25, -23, 94,
+		-63, -83, -23, 57, 18, -93, 12, -52, -74, 80, -93, -91, -14, -3, 34, -67, 18, 36, -81, 57, 20, 28, -1, -36, -3, 91, -14, -90, 41, -100, 65, -85,
+		0, -63, 32, -3, -87, 52, 20, 42, 81, -52, 71, -39, 86, -14, 57, 29, 95, 23, 99, 67, 96, 18, 6, 35, 9, 59, -17, -47, 30, 48, 75, 65,
+		45, -76, -2, -81, 18, 53, 35, -21, -20, 33, 82, -69, -66, -73, -74, -35, 95, -66, -69, 7, 88, 71, -6, -20, 96, 3, -70, -77, -62, 90, -8, -48,
+		-24, -57, -4, -32, -27, -70, -63, -77, -17, 97, -53, 4, -68, -76, 76, 70, 17, 75, 48, -23, -57, 28, 60, 26, 20, 27, -47, -34, 47, 97, -42, 23,
+		38, 5, 6, -74, 28, -4, -89, 11, -74, -1, 70, -25, 54, -50, 28, 2, 20, 7, -1, -80, 74, 24, -46, 54, 36, -19, 86, -50, 51, -25, 59, -48,
+		97, -70, 99, -48, -77, -72, -84, -58, 66, -6, -10, -61, 83, -9, -44, -84, 64, -12, 2, -31, -60, -12, -40, -38, 17, -46, 60, -96, 33, 81, 87, 3,
+		33, -48, 68, -3, 87, 42, 34, -63, 5, 47, 85, -87, 60, 66, -62, -80, 16, -90, 47, -58, -93, 79, 39, 71, -59, -5, -45, 57, 60, 85, -87, 41,
+		31, -80, 29, -25, -38, -69, 93, -45, -80, -84, 14, 60, -6, 3, -14, 47, -16, 53, -12, -28, 28, -32, -75, 26, -45, 91, 81, 38, 91, -38, 85, 58,
+		-87, -6, 21, -89, -11, 70, 23, 17, -15, 69, -29, 46, -92, 41, 57, -89, 48, -51, -13, -84, 90, 35, 87, -53, 51, -40, 53, -81, -86, -18, 57, -87,
+		0, 11, -28, -8, -48, -70, -27, -84, 98, 15, -83, 32, 10, 42, 34, -73, -8, 85, 92, -74, -83, 4, -74, -42, -92, -66, 27, 94, -9, -99, 20, -9,
+		91, 65, 39, -37, -32, 51, 88, -29, -52, 95, -79, 95, -52, 77, 40, 34, -60, -45, 82, -74, 90, -63, 11, -8, -57, -60, 47, 63, -27, 3, -88, 57,
+		67, 94, 79, 53, -70, 2, -6, 48, -30, 99, -50, 17, -87, 25, 5, -53, 94, 73, 0, -97, -33, -20, -12, 66, -30, 81, 14, -12, -45, -60, 4, -99,
+		50, 9, -9, -10, -72, -72, 85, 64, 85, -86, -37, -53, -27, 40, -21, -18, -69, -47, 57, 65, 27, -82, -51, 17, 45, -67, 26, 25, -33, 19, 27, -21,
+		17, 12, 63, -73, -29, 45, 33, 44, -6, -80, 31, 29, -59, -85, 17, -92, 81, 74, 53, 15, -39, 36, -28, -51, -79, -92, -58, 95, 40, 99, -20, -78,
+		-78, -55, -84, -59, 45, 19, -74, 22, -24, -90, 47, -12, -42, 18, 61, 84, 28, 82, -69, 10, -50, -28, 25, -81, 92, 95, -87, -86, -25, 10, -30, -24,
+		-35, 49, 10, -91, -39, -4, 6, -48, -62, -66, 34, 69, -90, -15, -63, -22, 83, 26, -49, -94, 44, -8, 19, -31, 20, -25, -26, 86, 26, 99, 51, 56,
+		-61, -28, -15, -4, 39, 94, 1, -2, -22, 58, -37, 23, 90, 39, 46, 44, 9, -73, 8, 91, 4, -43, 95, -39, -21, -15, -22, 39, 60, -51, -32, -47,
+		84, -35, -9, -24, 8, 42, 51, -29, -59, -29, -68, -58, -27, -17, 24, 18, 14, -76, -65, -7, -45, 88, -82, -66, 64, 35, 31, -39, -38, -30, -39, 38,
+		66, 38, 63, 7, 97, -51, 15, -62, -89, 65, -65, -46, -36, -21, 60, -44, 29, 80, -35, 7, -31, -1, -49, -35, -8, -67, -75, 42, 88, -26, 79, 21,
+		-91, -79, 81, 92, -43, -68, 73, 81, -28, 72, 64, -49, -22, 3, -85, -8, 73, 29, 82, -11, 95, 55, -21, 47, -24, -45, -97, -46, 72, 6, 99, -19,
+		-87, 69, 20, -68, 19, 78, -90, -5, 30, 21, -99, -22, 49, 76, -7, -39, 72, 91, 50, -23, -77, 42, -3, 90, -86, 1, -35, 89, 2, -21, -34, -11,
+		-31, -69, 45, 62, 92, 58, 21, 36, 66, -85, 18, 89, -4, -77, -77, 51, 60, 76, 91, 95, -71, 75, -74, 94, -7, 0, 87, 87, 13, 71, 80, -36,
+		18, 32, -4, 80, -74, -87, -3, 75, 63, 28, 45, 28, -87, -89, -11, -70, 0, 30, 34, 49, -41, -88, 79, 14, 73, 49, -40, 88, -16, 76, -2, -46,
+		27, 42, -78, 45, -29, -63, 29, 19, -61, 89, 5, -43, -51, -13, 99, 71, 42, -65, -9, -99, -2, -49, 22, 67, 43, -34, -70, -49, 62, -43, 48, 21,
+		62, -50, -22, -10, -62, -7, -25, 59, -89, 46, -52, 9, -23, 55, -63, -82, 36, 53, 58, -45, -26, -97, 86, 21, -92, 17, -17, 31, 2, -10, -84, -5,
+		-4, 3, 71, 57, 47, -41, -34, -12, 91, -89, -77, -92, 71, 46, 66, -33, 93, -16, 62, -18, 88, 17, 96, -12, -40, 55, -79, -64, -55, -98, -36, -87,
+		32, -43, -38, -37, 86, -23, 47, -76, 8, -75, 60, -73, -94, 25, 83, -73, 14, -31, 59, 42, -1, 68, -53, 20, -9, 83, -51, 2, -66, -30, -54, 65,
+		-84, -39, 20, 42, 96, -27, -100, -47, -80, 54, 67, -59, -6, -33, -37, 65, -19, -10, 1, -34, -85, 52, -38, -44, 65, 57, -35, 49, 95, -62, -94, 80,
+		-5, 97, -20, -55, -36, 69, -96, -17, -92, 40, 90, 12, -38, -62, -7, 61, -78, -53, 46, -14, -58, -55, -83, 85, 10, 77, -34, -98, -34, 62, 78, 44,
+		60, 62, 30, -83, 46, -5, 55, -61, 96, -86, 12, -94, -90, 7, -95, -83, -34, 97, 23, 77, 6, -4, -14, 46, -30, -8, 50, -54, -37, -99, 12, 11,
+		1, -70, -26, 46, -2, 85, 7, -13, -56, -24, -81, 27, 25, 60, 73, -33, -1, 69, 84, 77, 81, 56, -45, -86, 45, 50, 56, 26, -44, 10, -52, 53,
+		-67, 51, 28, -91, -27, 49, 90, 77, -76, 49, 13, -45, 87, 36, 48, 83, 16, -64, -59, 48, -85, 44, 33, -28, 6, -42, -89, 9, -39, 18, 10, 21,
+		-80, -12, 10, 41, -76, 59, 27, -82, 32, -48, 36, -86, 98, -33, -47, 73, -26, -21, -73, -55, 52, 77, 67, 44, -58, -20, -99, -81, 88, 63, -81, 6,
+		56, 42, 41, -22, 45, -87, 47, 23, 8, -81, -30, 74, -93, -66, -35, -15, 60, -47, -92, -36, 76, -22, -71, -29, -38, -38, -91, -80, -10, -58, 76, -6,
+		-27, 57, -53, -84, -26, -7, -49, 10, 25, 91, 40, -79, 44, 20, -67, 75, 80, -13, -48, -38, -34, 84, 92, 91, 91, 23, 38, -33, -23, 46, -71, 61,
+		-64, -6, 13, 58, 89, -9, -69, -24, -39, -42, -26, 91, -19, 47, 82, 25, -75, 62, -35, -16, -27, 80, 92, -97, -79, 66, -1, 52, 22, 92, -83, -4,
+		-8, 90, -4, -30, -63, -60, 75, -94, 98, 90, 72, 73, -93, -100, 1, -67, -30, -45, 86, -97, 54, 5, 79, 73, -27, -13, -53, 66, 91, 13, 37, -37,
+		83, 22, -33, 62, 35, -85, -96, 25, 5, 16, -71, -40, -67, -24, -7, 43, -13, -21, 72, -80, 23, 56, -61, -88, 12, 99, -61, -99, 21, 84, 3, 75,
+		-73, 37, -77, 62, -75, -100, 38, -16, 8, 79, 90, 8, 25, -48, 11, 54, -96, -27, -60, 7, 8, -37, -86, 63, 17, 34, -99, -52, 32, 13, -50, 2,
+		16, 14, -76, -86, -44, -11, -36, 85, -99, 82, 39, -22, 86, 25, -62, -28, 29, 73, -9, 86, 2, -2, 98, 35, 98, -29, -43, 85, -78, -93, 94, -96,
+		-79, -77, -63, 97, -99, -22, -66, 26, -3, -89, 11, -32, 32, -36, 25, 37, -72, 95, -20, -82, -20, -19, 12, -36, -42, -98, 54, -88, -35, 47, 77, -39,
+		83, -27, 31, 51, -15, -60, -75, 47, -59, -74, -17, 12, -82, 85, 82, -41, 50, 20, -42, -50, -55, 71, -49, 27, -16, -3, -87, -35, -73, -50, 18, 13,
+		-68, -85, -93, -82, 67, 47, 71, 75, -78, -56, -17, -32, -99, 90, 82, -85, -55, 34, 72, -94, 35, -14, 68, -78, 92, -5, 98, -5, -59, -53, -85, -31,
+		24, -73, 18, 17, -37, 3, -17, -88, -93, -89, -14, 96, 2, -21, 16, -79, -74, 40, -41, -57, -89, 54, 95, 89, 60, 4, 19, 8, 95, -29, 93, -2,
+		62, 46, -94, -27, 50, 49, -32, 48, -33, 60, -55, -67, 96, -68, -6, -51, -17, -99, 73, 57, -94, -42, 96, -46, 91, 64, 55, -38, 90, -70, -46, 76,
+		74, -36, 58, -56, 88, 22, -86, -69, 56, -87, -90, -11, 74, 5, -26, -54, 18, 29, -10, 78, -85, -71, 71, -24, 43, -36, -67, -59, 63, -83, -59, -80,
+		35, -85, 10, 64, 26, 65, -51, -84, -50, -36, -34, 91, -72, -45, -20, -51, 57, 14, -88, 60, 71, 70, -34, 70, -89, -30, 32, 37, 76, 91, -57, 90,
+		78, 64, 56, 28, 86, 56, -76, -17, -83, -63, 69, -98, 37, 12, 77, -6, -4, 37, 93, 93, -34, -21, -68, -15, -48, 61, 21, 34, 15, -51, 58, 12,
+		-72, -49, -54, -87, -90, -17, 71, 39, -35, 12, -85, 80, -7, -51, -62, -56, -40, 22, 5, -24, -83, -9, 95, 74, -2, -5, 18, 79, 82, 51, 71, -37,
+		-16, -10, 71, 10, 78, 89, 38, -64, 96, -61, -8, 13, 89, 59, 43, 90, 62, -93, 55, 66, 31, 64, 67, -53, -75, 74, 64, 67, 2, 34, 50, -86,
+		-71, 22, -7, -77, -21, 13, -78, 96, 40, 81, 77, 85, -82, -37, 90, 86, -29, -68, 83, -69, 23, -64, -98, -74, 61, -4, -46, 66, -35, 46, -6, -96,
+		99, 47, -31, 45, -66, 91, -45, -30, 23, -45, -6, -42, 99, -50, 71, 37, -28, -12, 54, 17, -35, -66, 54, 55, -96, 29, 86, -59, 87, -98, 7, 88,
+		48, -64, 41, -6, 68, 65, 3, -47, -32, -39, -70, -96, -68, 91, -62, -3, 26, 97, -5, -12, -47, -95, -14, 28, -29, 62, 7, -72, -74, -69, -34, -21,
+		56, 19, -31, -62, -51, -87, 82, -48, -99, 96, -27, -52, 61, -86, -62, -81, 56, -63, 26, 54, -55, -28, -19, 46, 40, -26, -39, -84, 83, 77, 4, 56,
+		-69, 65, 17, -19, -25, 39, 63, 35, -95, 81, 51, -83, 80, -83, -87, 48, -16, 9, 9, -2, -50, 62, 26, 67, -89, -2, -54, 1, 23, -94, -39, 7,
+		-51, 36, -3, -35, 4, -33, 60, 95, 43, -79, -99, -13, 0, -31, 44, -13, 89, -91, 1, 21, -6, -71, -4, 1, 79, 47, -75, -73, -3, 3, -3, -40,
+		31, 13, -37, -8, 72, -43, 24, 73, -100, -77, -5, -87, -73, 25, 57, 77, -39, -14, -11, 37, 49, -97, -16, 71, 40, -59, -63, 39, 23, -2, 31, 98,
+		89, -31, -53, 38, -40, 82, 35, -86, 30, -40, -19, -76, 49, -71, 85, 26, 67, -66, -87, 71, 50, -75, -5, -43, -73, 44, 4, -34, -52, 48, -45, -75,
+		8, 50, 38, -70, -89, 60, 17, 27, -15, 79, -18, -76, 0, 91, 98, -96, -5, -91, 46, 0, -63, 23, 18, 45, 55, -59, -86, 27, 76, -28, 98, -25,
+		-20, 41, 5, -45, -96, -39, -80, 27, -16, -51, 6, -78, -8, 63, -65, 16, -48, -76, 21, 34, -68, -73, -65, -8, -28, -45, 51, -70, 28, -5, -67, -50,
+		-82, 96, 87, 73, 47, -66, -50, 49, -38, 36, -38, 14, 60, -34, -84, -99, 89, -16, 9, -36, 31, -11, -3, -34, -82, -54, 60, 81, 8, -34, 31, -80,
+		-77, -11, -61, 38, -19, -87, 32, 80, -83, 20, -57, 89, 10, -13, 83, 80, 95, 95, 91, -21, 50, 93, -62, -6, 96, -43, -73, 20, 4, 8, 6, -45,
+		78, -26, 52, 95, 27, 6, -76, 80, 79, 51, 40, -99, -81, 34, 77, 34, -81, 95, 74, 28, 14, 17, -41, -49, -18, 28, 90, 3, -33, 71, 88, -2,
+		-4, -76, 6, 78, -66, 4, 96, 30, 27, -77, -26, -23, -80, -26, -75, -36, -37, -81, -8, 30, 91, 89, -11, -22, -46, -94, 35, -85, -89, -85, 17, -28,
+		27, -85, 12, 33, -46, -82, -71, 17, 47, -7, -32, -42, -20, -69, 32, 44, 48, -42, -58, 67, -16, 95, 63, -7, -13, -22, -17, -91, -61, 44, -29, -20,
+		43, 82, -28, -35, -47, 97, 46, -78, -9, -95, -48, 15, -76, -57, -66, -85, -13, -17, 98, 10, 70, 89, 97, -96, -81, 99, 41, -68, -90, -14, -98, 63,
+		-98, 64, 65, -72, 72, 63, -90, 11, -50, 54, -39, -98, -97, -97, -20, -41, -37, 14, -71, 72, 46, 84, 42, -97, 55, -21, 90, 9, -89, -7, 77, -16,
+		62, -96, -27, -1, 17, -88, 11, 31, 78, 74, 24, 6, 90, -34, 41, -91, -10, -90, -59, -83, -86, 96, -58, -59, 96, 95, -60, -100, 66, 53, 97, -92,
+		49, 58, 91, 7, -76, 93, 90, 17, -73, 93, 79, 47, -4, -58, 79, 9, 12, 37, -17, -73, -74, -13, -55, 26, 59, 33, 71, -68, -27, -95, 64, 51,
+		-80, -83, 48, -92, -61, -13, 52, -1, -61, 99, 81, 15, -37, -56, 63, -20, -99, 18, -38, -50, -90, -2, 89, -57, 96, 45, -34, 28, -50, 61, 30, -3,
+		92, -64, 38, 63, -98, 59, 36, -64, -13, -67, -6, -54, -53, -94, -60, -57, -99, -39, 25, -14, 46, 39, 55, 34, -87, 53, 94, -52, -19, 49, -19, 0,
+		58, 95, 85, -72, 2, 17, 5, 88, -68, -52, -58, -90, 34, 51, -63, 92, -94, -51, -5, -48, 21, 77, -21, -29, 78, -87, 63, 26, -37, 91, -77, -91,
+		-47, -81, -77, 30, -53, 7, 43, 14, -57, -16, 11, -82, 40, 64, -70, -26, -93, -27, 44, -49, 92, 58, -61, -16, -52, -97, -7, 8, 65, -15, 81, -94,
+		-19, 93, 80, -92, 23, 69, -81, -17, 98, -90, 99, -23, -11, 66, 22, -77, 79, 0, -46, 54, -19, -8, -1, 32, 21, -84, -13, 84, -25, -71, 51, -18,
+		32, 72, 75, 79, 85, -34, -6, 38, 5, -54, -75, -67, 26, -41, -29, 14, 96, 58, 58, -87, 31, -38, -27, 14, 77, -21, -77, 0, 48, -51, -82, 94,
+		54, -31, -36, -50, 5, -2, 32, -12, -46, 40, 47, -19, -65, -85, 42, 60, 94, -61, 53, -92, -39, 70, 27, -59, 75, -58, 46, 11, 75, -96, 13, 5,
+		30, -67, 3, 61, -14, 29, -48, 64, -70, -60, -39, 79, -91, -55, -12, -17, 23, 85, 55, 67, 2, 79, -23, 40, -25, -11, 86, -11, -5, -17, 28, -83,
+		99, 7, -27, 58, -70, 20, 79, 14, -46, -20, -67, 90, -33, 84, -86, -53, 4, 48, 34, -13, 29, 98, 12, 70, 88, 54, -13, -93, -60, -34, -28, 84,
+		-30, 44, -54, -53, 47, -25, -45, 65, -30, -39, -82, 43, 58, -68, 66, -31, -99, -30, -28, -61, -63, -21, -72, -14, -31, -7, -8, -40, 73, -100, 19, 83,
+		-69, 64, -12, -62, 1, 38, 64, -42, 31, -94, -50, 22, -24, 63, 5, -46, 1, 39, 39, -37, -7, -11, 35, -35, 24, -22, 34, 98, 15, 73, 15, 65,
+		-7, 47, -20, 1, 88, 20, -33, 81, 21, -89, -6, 19, -91, -31, -9, -21, -57, 73, -95, 27, -53, -89, -96, 61, 39, 16, 82, 52, -24, 1, -82, 59,
+		-64, 50, -46, -53, 72, -64, 72, -73, 0, 57, 2, -97, 8, 25, 81, 96, 40, -100, -58, -6, -67, 86, 59, 41, 28, 40, -98, -100, 13, -94, -12, -52,
+		98, 5, -80, -20, 54, -9, 12, -33, 14, 28, 15, 92, -46, 70, 10, 58, -68, 55, -64, 75, 11, -71, 25, -87, 89, 45, -87, -72, -36, -48, 5, 43,
+		17, 28, -35, 71, 4, -76, -35, -42, -7, 9, -81, 83, 32, 68, -39, 42, -99, -93, 84, 56, -31, -64, -88, -98, 81, -84, -50, 85, -47, -24, 95, -69,
+		60, -41, 78, 92, 45, 91, 99, 30, -40, 58, -2, -79, 90, -46, -37, -39, 8, 89, -88, -28, -70, 98, -1, 66, -11, -15, 97, 72, -22, -74, 90, -10,
+		14, 41, 47, 25, -46, 10, 34, -18, 55, 59, 79, 11, -63, 49, -99, 17, -94, 12, 63, -54, -68, -30, 65, -33, -55, -21, 48, 68, 95, 58, -47, -20,
+		74, -56, 84, -94, -3, -93, 86, 32, 77, -9, -77, 76, 43, -36, 32, -20, -3, -53, 15, -93, 90, 91, 17, 26, 74, -92, -29, 35, -7, 59, -43, -22,
+		-75, -18, 80, -33, -72, -87, -17, -63, -27, 14, 21, -40, -68, 42, 89, 91, 16, 50, 42, -47, -74, -49, -84, -81, 39, -48, 63, 23, -8, 95, -94, -80,
+		67, -31, -68, -56, 7, -27, 65, 76, 29, -76, -66, -5, -71, 99, -71, 45, -79, 73, 85, 4, 65, -75, 93, 1, -70, 89, -28, -95, -63, -29, -54, -33,
+		-29, 47, 0, 12, 86, -29, -90, -86, -86, 44, -7, 68, -23, -17, -20, -57, -100, 5, -14, -71, -85, 53, 74, -20, -91, -64, -96, -97, 51, 9, 88, -36,
+		-38, -62, 3, -39, -2, -89, 9, 23, 18, 48, -51, 18, -11, -79, 61, 76, 94, -93, -2, -98, 62, 88, -18, -28, 84, -99, 97, -4, -89, 45, -88, 64,
+		57, 38, -17, 19, -74, 80, -13, 77, 96, 97, -37, -17, 10, 0, 65, -30, -48, 38, -71, -97, 66, -28, 55, -43, 77, -16, 43, 53, 98, -50, -59, 65,
+		-41, -29, 26, -53, 91, -20, 84, -78, 75, -35, 51, -5, -71, 66, -50, 3, -49, 91, 71, -36, -51, 43, -4, -27, 2, -63, 37, 97, 69, -68, 86, 10,
+		-5, -7, 31, -7, 26, -14, -66, -43, 58, -78, -59, -96, 38, -58, -13, 68, -13, -54, 40, -11, 17, -96, 33, -84, -62, 33, 12, -76, -67, 5, 64, -72,
+		-49, -3, 89, 16, 75, 39, 34, 73, -36, 83, 56, -12, -68, 47, 15, 4, 64, -38, 74, 76, -70, -62, 59, -94, -12, 58, 62, 38, -58, -74, -17, -3,
+		66, -2, 41, 71, -67, -5, 36, 21, 61, -79, -44, 96, -87, -59, 65, 22, -84, -17, -38, -50, -11, -6, 7, 24, 46, -35, -80, 38, -17, -81, 53, -21,
+		-75, -60, -39, 74, 83, 91, -51, -84, 61, -22, -4, -9, -61, 82, -90, -35, 99, 71, -37, -37, -61, -57, -42, -55, 93, -75, -87, -27, 23, 57, -78, 5,
+		-64, -20, 42, 98, 51, -22, -49, -50, -26, 74, 65, -98, -84, 26, 47, 46, -74, 67, 35, 32, 35, -27, -25, 19, 9, -67, -44, 62, -8, 86, 15, 32,
+		89, -92, -18, 77, -56, 8, -16, 66, -92, -65, -97, -79, -87, -90, 78, -94, 1, 31, -71, 67, -70, -40, 34, 32, -88, 96, 85, -12, 25, -5, -66, -68,
+		13, -97, -24, 75, -4, 16, 8, -10, 18, -9, 89, 55, -48, -77, 79, -47, 50, 4, 52, -13, -51, 71, 5, 41, 57, 70, -63, 84, 79, -73, 54, -49,
+		-35, 4, 24, 23, 89, 97, -2, -64, -93, -10, -99, 86, -80, -20, 54, -51, 20, -73, 85, 66, -20, -50, 54, 25, -20, -66, -49, -41, -57, 79, 6, 19,
+		-67, -50, -95, 25, -30, -67, -48, -50, -92, 11, -28, 60, -32, -52, -9, 39, -13, -40, -7, -98, 83, 87, 7, -69, 4, -24, -42, 60, 89, 26, -19, 2,
+		40, -94, 72, -81, 36, -43, 10, 93, -100, -69, -32, 26, 71, 14, -27, 54, -99, -59, 53, 56, 39, -7, 35, 51, -1, 73, 95, 5, -45, 50, -84, 10,
+		-11, 50, -97, -94, 75, -64, 99, 44, -80, 14, 36, 63, -14, 59, -67, 15, 53, -23, -48, -72, -100, 15, 27, 48, -70, -34, 18, 93, 54, -23, 92, -9,
+		-86, 90, 3, -88, 27, 42, 70, -90, 38, -89, 11, 82, 47, 8, 39, 51, 72, -26, -93, -54, 4, -5, -59, -49, -65, -26, -16, 79, -8, -14, -89, 22,
+		-98, -43, 86, -38, -12, -92, 85, 7, -32, -58, 86, 74, 95, -85, -37, -62, 10, 56, -9, 47, -19, -80, -16, 57, 64, -18, 92, 75, 22, -100, -71, -64,
+		-79, 67, -42, 77, 16, 24, 30, 6, -5, 25, -12, 31, 74, -33, 96, 56, -77, 51, 35, -98, -75, 36, 16, -66, -73, -1, 68, -31, 12, -43, 80, -95,
+		17, -99, 23, 69, 52, -13, -13, 61, 0, 70, 71, 17, -18, -2, -38, 84, 34, -59, -82, 5, 45, -89, -25, 69, -63, 28, 77, -79, 20, 41, -7, -99,
+		-5, -53, 26, -98, 79, 75, 26, -20, 37, -98, -77, 73, 91, -91, 27, 25, 72, 6, 5, -80, 65, 20, 33, -88, -8, 70, 51, 34, 29, 71, 32, -93,
+		35, -89, 55, 9, -43, -1, -96, -99, -79, -23, -82, 73, 98, 42, -22, -98, -11, -87, 57, 98, 76, 16, 0, -49, 84, 15, -4, -66, 65, 23, -27, 6,
+		-96, 46, -20, -94, -98, -36, 56, 95, -11, -61, 74, -30, -50, 19, -80, 67, -47, 77, -36, -34, -38, 45, 25, -66, -72, -23, 84, -7, -51, -66, -34, 66,
+		-26, -78, -47, 42, -44, -72, -36, -6, -74, -47, -18, 26, 86, -72, 67, 88, -38, 38, 57, -12, -83, 77, -31, 79, 69, 97, -63, 68, 47, 71, -17, -72,
+		38, -75, -23, -45, 98, 17, 66, -11, -21, -45, -8, -2, 52, -49, 28, 70, -49, 7, 58, -13, -93, -7, -79, -26, 12, 40, 35, 70, -62, -89, 63, -95,
+		-5, 52, -46, -31, 33, 82, 96, -66, -71, 23, 56, -4, -84, 92, -16, -72, 8, -75, 74, 23, 99, -13, 88, -100, -11, 58, -38, 33, 48, 50, -12, -72,
+		-50, 38, -62, -76, 42, 89, -33, 56, 10, -67, 23, 24, 53, 48, -98, -39, -84, -79, -28, -99, 41, -37, -9, 54, -8, 91, -2, 0, 15, 39, -86, -37,
+		91, 0, -28, 79, -84, 33, 57, -82, 79, 31, -17, 66, -53, 47, -71, 76, 76, 13, -100, 94, 26, 39, 79, -70, -78, 80, 20, -46, 66, -82, 41, 48,
+		-90, 54, 30, 62, 62, 46, -52, 65, 80, 98, -41, -22, -87, -16, 49, -34, -24, -30, -77, 4, 58, 17, -45, 63, 18, 79, -56, -81, -16, -15, -48, -22,
+		-62, 31, -77, 54, -83, -3, 95, -50, -45, -40, -61, -24, 24, 40, 77, -27, 32, -37, 45, 48, -21, -7, 7, -73, -24, -27, -42, 47, -85, -55, -44, 15,
+		9, -86, 97, 98, 70, 70, -77, -90, -84, -20, 95, 64, 75, 84, -39, -50, -92, -57, 45, -75, 21, -7, -49, -35, 90, -28, -85, 87, 25, 30, 1, -84,
+		32, 91, 36, 19, 0, 54, 31, -79, -33, 22, 69, 4, -48, 98, -76, 7, 53, 95, -49, 32, 77, -57, -32, -54, 78, -91, 71, -20, -66, 93, 7, -11,
+		-44, 33, -15, -48, 17, 34, 79, -90, -3, 14, 24, -79, -23, -63, 21, -45, -6, 33, -39, 13, -29, 81, 69, -35, 7, 63, -65, -82, -73, 30, -5, -86,
+		29, 83, 40, 40, 74, -62, 90, 33, -68, 72, 50, -45, 69, 8, -50, 6, -97, -80, -78, 12, -94, -15, 0, 33, -19, 19, 37, -25, 42, 1, 82, 7,
+		46, 79, 76, -37, 93, -74, -9, -82, 46, 10, -31, 26, -80, 88, 64, -25, -20, -46, 12, 69, 5, 69, 38, 52, 64, -94, -1, 64, 3, -74, 57, 71,
+		55, -19, 71, -85, -87, 40, 79, 63, -34, -70, -56, 22, -33, -73, 39, -70, 20, 43, 73, -36, -62, -27, 80, 21, 47, 24, -71, -90, -84, -77, -52, -71,
+		-64, -56, 36, -83, -79, 87, 88, -53, 9, -11, -18, 67, -16, -78, -93, -33, 15, 93, -58, 65, 97, 63, 43, 18, -14, -78, 70, 33, -69, -24, -27, 22,
+		21, 87, 82, -83, -72, 29, 69, -74, 79, 80, 15, -68, 83, -32, -92, -73, 86, -15, -10, -11, -34, -74, -48, 1, -62, 57, -93, -1, -45, 89, 4, 90,
+		93, -87, -1, -46, 20, 48, -73, 96, -74, -57, -69, 93, -36, 43, 62, 20, -29, 93, -79, -87, -94, -96, -93, -81, -19, -62, -8, 32, 92, 85, -7, 94,
+		27, 69, 52, -97, -61, 36, -97, 11, 50, -69, -22, 91, -80, 39, 49, 48, 10, 71, -27, 38, 11, 84, -84, -66, -19, -33, 23, 37, -66, 24, -24, 25,
+		12, -40, -92, 86, 54, 14, -69, -65, -72, 94, -54, 68, -43, 40, -66, 8, 16, 16, 50, -35, -73, 24, 48, 64, 35, 47, 61, 52, -60, -2, -94, 2,
+		-86, 52, 18, -48, 28, 86, -90, 80, -54, -85, 69, 84, 2, 39, -92, 69, -94, -37, -81, 48, 57, -93, -46, 66, -86, 53, -1, 51, -47, 28, -54, -19,
+		-100, 77, -52, 49, -40, 8, 30, -55, -18, -74, 43, -30, 6, -48, 54, -16, 47, -20, -11, 51, -53, 86, -67, 91, 90, -90, -39, 36, -11, 86, -22, 44,
+		-35, -24, 18, -69, 33, -53, 2, 7, -54, 84, 53, 20, -68, -5, 56, 95, 11, -44, 97, -48, -61, -90, 28, -82, -20, -53, 84, -85, 88, 3, -14, 31,
+		-45, -64, -95, 25, -26, 68, -14, 14, -19, 3, -78, 82, 84, 13, -61, 28, 32, 62, 22, -40, 63, -44, 43, -32, 83, 10, -9, 24, -8, -31, -10, 88,
+		-65, 79, 16, -68, 63, 91, 64, 34, -60, 12, -97, 76, 49, 59, -98, -3, 96, 2, -25, 54, -1, 66, -33, -62, -26, 92, -20, -3, 79, 47, -100, 82,
+		-5, -98, 66, -16, -86, -37, -61, 47, -61, -91, -55, 14, 97, 65, 36, -88, 49, 65, 13, 15, -47, 82, -74, 52, 0, 82, 61, -75, -47, -13, -57, 63,
+		-46, -36, 7, -83, 0, 63, 66, -84, -26, 9, -68, 42, 80, -59, 27, 3, -53, -40, -60, -40, 37, 33, -26, -15, 35, 41, -1, -59, 47, 95, 51, -4,
+		-99, -63, -98, -42, 19, -64, -12, -80, 20, -48, -58, 47, -39, -76, -18, -1, 42, -34, -13, -76, 22, 8, -92, -10, -28, -5, -6, 46, -2, -40, -21, 15,
+		69, 80, 26, -76, -23, 62, -68, -47, 79, 16, 87, -25, -72, -82, -38, -61, 68, 36, 5, 50, 65, -68, 45, -35, 46, -100, 69, -96, -78, 63, 83, -56,
+		52, 56, -73, 28, 36, 49, -18, -25, 61, 13, -79, -15, -44, -89, -69, 82, 67, 12, -56, -81, 57, 37, -91, 67, 67, 65, 28, -29, -54, 80, -81, -65,
+		-66, -35, -63, 64, 79, 71, 68, 64, 29, -68, 58, 44, -67, -17, -61, -3, 2, 80, 49, 63, 29, -31, 67, 19, -21, 51, -69, 7, 79, 89, -65, -31,
+		-9, -76, 50, -55, -52, 19, -10, -13, -43, -43, -68, -13, 70, -12, 51, -57, -62, 64, 37, -84, -44, -67, -22, 93, 44, -30, 2, -9, 25, -93, 97, 48,
+		-47, 92, -62, -95, -2, -47, -85, -79, 20, 84, -49, -1, 8, 26, -14, -29, -66, 50, -77, -8, 20, 10, 49, -84, -47, 49, 34, 55, -93, 82, -4, -75,
+		-85, -49, 21, 89, 29, -100, -22, 66, -86, 22, -7, -97, 27, 69, 92, 35, -11, 76, 68, 19, -58, -24, -71, 20, -19, 35, -91, 92, 42, 48, -53, -48,
+		49, 76, 82, -73, -19, -80, 73, -11, 94, 4, -21, 10, 33, -70, -68, -58, 47, -84, -23, 48, 49, -6, 96, -64, -38, 82, 57, -12, -11, 53, -21, -21,
+		-73, 77, -59, -63, 16, 37, 37, -54, 2, 23, 46, 54, 71, -94, 55, -50, -58, -6, 49, -86, -32, 55, 87, 9, 77, -61, 2, 93, -55, 29, 88, -12,
+		47, 91, 60, -81, -97, -54, 62, 17, -81, -36, -82, -31, -21, 37, 84, 50, -94, -30, -20, 97, -13, -6, -31, -55, -80, 33, -49, -26, -43, 8, 8, -40,
+		96, 18, 53, -58, 62, -57, -98, 84, 83, 12, -60, 41, -59, 0, 9, 67, 76, 92, -87, -74, 67, -88, -30, 44, -71, 88, -95, 92, -34, 27, 4, -9,
+		-39, 61, 14, 7, 13, 39, 77, -72, 7, -58, -29, 52, -92, -1, -21, 64, 63, 99, -19, 50, -21, 69, 93, 33, -84, -41, 1, -81, -68, 25, 0, 21,
+		-69, 94, -41, 46, -93, 64, -43, -84, 41, 94, -79, 45, 85, -67, -5, 30, -90, -15, -76, -10, -21, -64, -70, 51, 27, -95, 42, 68, 11, -31, -6, 41,
+		96, -1, -97, -43, 18, -28, 57, -55, 53, 10, 84, -79, 78, 7, -63, -55, 42, -53, 81, -48, -49, -27, -20, -47, -59, 8, -100, 27, -33, 68, -45, -61,
+		49, -29, -76, 90, -36, -47, 81, -6, -99, -96, -13, -54, -84, -60, -96, 29, 5, 64, 61, 74, 23, -69, 75, 89, 1, 71, 62, -90, -85, -48, -77, -31,
+		48, -67, 22, -78, 25, -86, 9, -5, -50, -41, -61, -17, -77, -70, -13, -61, 44, -24, 56, -12, 4, 73, 16, 20, -30, 50, 75, -46, -98, 10, -15, -37,
+		-100, -44, -83, -1, 15, 54, 55, 63, -50, 27, -94, -78, -29, 26, 1, 12, -52, -19, -66, 15, 34, -76, 85, 8, -76, -98, -43, -25, 10, -69, 15, 43,
+		37, 61, 9, -90, 55, 71, 22, 17, -49, 4, 54, 65, -75, 44, -93, 67, -68, -62, -51, 17, 94, 91, -7, -96, -54, 75, 36, 19, -66, 73, 21, 49,
+		73, -70, -81, -58, 20, 87, -17, 77, 26, 69, -100, 90, 33, -85, -34, -41, 47, 84, 49, -70, 2, -59, -73, 44, -91, -29, -1, 71, 17, -45, -51, -3,
+		70, 28, 68, 50, -76, 38, 9, -90, -44, -34, 25, 38, -4, 13, -39, -88, -63, 84, -85, -60, 6, 63, -64, -81, 73, 22, -98, -77, 29, -25, 98, -21,
+		-34, 96, 55, 56, 70, 67, 37, 72, 25, -18, -81, 96, 4, 88, 45, -66, 5, 56, -79, -66, 6, -50, -7, 86, 40, -62, 7, -19, 3, 19, 21, -96,
+		-34, -14, 20, -70, 73, -47, -70, -15, -24, -33, -85, -73, -91, -65, 1, 93, 48, -54, 38, 3, -67, 56, 28, 66, 67, -76, 15, 45, 28, 77, 35, -64,
+		40, 32, -84, 18, 8, 84, -61, 46, 53, -21, -64, -21, 46, 64, 4, 96, 58, -17, -17, -6, -62, 85, 25, 92, 27, 43, 87, 74, 73, 55, 85, 21,
+		-64, 71, 49, 82, 93, 73, -97, -47, -67, -44, -13, 32, -96, -15, -81, 5, 9, 44, -22, 17, 14, -78, 10, -27, -87, 33, -50, -31, 33, 41, 25, 98,
+		97, -99, -62, 89, -53, 44, 12, 81, -76, 79, -18, 42, 29, -76, -9, 95, 19, 91, 77, -39, 42, 47, -41, 16, -14, -100, -5, 49, 60, 99, 34, 18,
+		15, -12, 54, 58, 84, 26, -96, 74, 40, 40, -54, 56, 38, 16, -84, -100, 45, 40, -5, 34, -43, -46, 76, 2, -35, 47, 13, -5, 37, 68, -85, 81,
+		71, -50, -17, 10, -9, 44, -57, 35, -91, 66, -19, 29, 43, 37, -33, 31, 2, -29, 24, 67, -97, 64, -99, -36, -56, -56, 75, 12, 98, 16, 3, 91,
+		23, 79, 53, 44, 77, 83, -70, 73, 96, 64, -73, 71, -87, -83, -39, -5, 19, -29, 27, -94, -52, 42, -3, 12, 23, 20, -76, -48, 76, 91, -86, -2,
+		-34, -82, 99, 44, 66, -83, 90, 45, -4, -67, 32, 67, -57, 57, -46, 6, 4, 36, -43, 99, -52, -49, -38, 44, 18, -58, 25, 53, 13, 59, -40, -20,
+		-14, -42, 82, -11, 70, -32, -36, -51, -65, -33, 62, 14, 89, 79, 57, 35, -57, 30, 38, -51, 23, 89, -44, 57, -10, 77, 19, -11, -39, 6, -97, -16,
+		-39, 27, -87, -59, 21, 73, 62, -38, 39, 50, 55, 79, -65, -34, -77, -6, -28, -71, 29, 18, 36, 47, 86, -44, 0, 30, -17, 10, 16, -12, 17, -99,
+		63, 22, 38, 15, -13, 55, 31, 78, 33, -10, -80, 28, 12, 48, 2, -89, -92, 98, 53, 16, 84, 28, -89, -64, -26, 83, -31, -29, -9, -33, -4, -29,
+		-57, -86, -50, 94, 41, -8, 20, -26, 69, 37, -21, 66, -100, -41, -48, 66, 92, -87, 21, 60, 73, 40, -87, -37, -29, 8, -14, -100, -71, 9, 27, -56,
+		-68, -99, 18, -41, 47, -86, -81, 11, -66, 64, 84, -74, 44, 29, -70, -8, -86, 16, 97, 68, -52, -62, -19, 6, -91, -25, -35, 49, 95, -47, -91, 56,
+		-9, 73, -23, 78, -97, -55, -61, 33, 68, -11, 40, -57, -67, -96, 9, 42, 55, 3, 70, -23, -11, -89, 67, 94, -93, 52, 46, 28, 49, -75, -96, 87,
+		-71, -49, 5, 19, -15, 57, -60, -3, -91, 53, -10, 48, -54, -51, -37, -50, 44, -76, 85, 13, -93, 96, -53, -40, 33, 56, 86, -56, 96, -62, 63, -66,
+		25, -73, -90, -62, -35, 82, -62, 44, 65, 23, -24, 87, -5, -30, -85, -92, -2, 7, -41, 13, -36, -3, -13, -90, -6, -75, -82, 50, 34, -11, 62, -62,
+		91, 53, 28, 41, 42, 22, 92, 39, -25, 72, -88, -66, 44, -16, 76, -68, 8, -61, -43, -30, 87, 13, -58, -16, 79, -24, -88, -98, -29, -7, -73, 72,
+		88, 76, 22, -53, 39, -40, -89, -79, 39, 99, -11, 35, 96, -25, 58, 0, 65, -10, -34, 57, -82, -99, 34, -100, -22, 61, -69, -47, 61, 64, -10, 2,
+		-59, -31, 84, 3, 27, 67, -32, -69, -99, -58, 73, -71, -88, -28, 35, -20, 67, 92, 83, 64, -95, 83, 85, -93, 51, -97, -94, 42, 29, -39, -67, 80,
+		-31, 86, 94, -88, -67, -60, -42, -28, -86, -67, 89, -60, -68, 51, 71, 87, 79, -16, -48, 53, 65, -71, -5, -42, 89, -96, -11, 8, 79, 76, -11, -45,
+		97, 80, -32, 32, -68, -6, 17, 0, 31, -49, -24, 0, 32, -70, -100, -62, 64, -94, 50, -43, -3, 95, -48, -95, 41, 63, 35, 89, -89, 26, 49, -24,
+		19, 83, -42, -23, -51, -99, 40, -83, -56, -82, 71, 74, -83, -78, -81, -6, -29, 70, 35, -39, -80, -9, -36, -9, 27, 66, -65, 60, 76, -17, 14, -35,
+		-27, 40, -80, 3, -98, -91, 33, -91, 61, -54, 52, -22, -70, -2, 64, -43, -83, -63, -81, 18, -21, -35, 54, 12, 66, -22, 40, -83, 21, 71, 4, -53,
+		82, 98, -40, -36, 21, -86, 25, -48, 91, 81, -87, 90, 3, -7, -49, -30, 3, -1, 36, 85, 71, -30, -91, 85, 90, -10, 3, 66, -70, -28, 18, -27,
+		-1, 2, 18, -57, 56, 56, 44, 9, -64, 17, 25, -3, 0, -10, -56, -95, 5, -14, -37, -84, 27, 77, -2, -41, 38, -82, 31, 56, -83, 10, 0, -55,
+		-71, -53, 88, 0, 68, 22, -33, 70, -70, 95, -77, 14, -2, -86, 90, -43, -32, 54, -31, 36, -13, -17, 36, -18, -60, 94, -3, 26, 99, -59, -76, 87,
+		51, -73, 32, -5, -84, -89, -62, -79, 20, 91, -74, -84, -96, -50, 46, -81, -84, -58, -83, -71, 42, 4, 26, 49, 64, -66, 30, 53, -42, 12, -92, -70,
+		61, -34, -29, 26, 37, 34, -78, 84, 48, -75, 41, -30, -60, -86, -27, 69, -6, 75, -81, -30, 57, -62, -20, -15, -8, 36, -21, 33, 52, -77, 95, -48,
+		62, -33, -33, 76, -28, -18, 9, -33, -85, -36, -96, 42, 13, -88, -81, 90, 74, 67, -29, -43, 58, -8, -56, -26, -64, -17, 32, 22, -23, 30, -91, 86,
+		97, -91, -68, -62, -65, -100, -38, 85, -53, 97, 42, -29, 91, -59, -90, 0, 62, 61, 53, -17, -32, -21, -72, -29, 39, 83, -44, 30, -85, 27, 28, 34,
+		72, 84, 2, 93, -99, 63, -76, -49, -23, -73, -23, 83, -69, 95, 99, 39, -82, 39, 14, 50, 27, -72, 69, 58, 71, 82, -70, 46, -91, 9, -55, -96,
+		35, -65, 65, 88, 54, 42, -88, 39, 77, 12, -62, -2, -79, -98, 26, -56, -65, 59, -22, 94, 93, 57, 34, 2, 57, 93, 48, -35, 60, 60, 60, -39,
+		9, -96, 81, 53, 73, 44, -8, -56, -88, 73, -99, -59, 88, -66, -85, 81, 87, -14, -49, 72, 0, 59, 36, -3, 11, 79, -15, -34, -57, 68, -15, -84,
+		73, -76, 25, -27, 85, -97, 1, -11, 41, 70, -73, 48, 92, -79, -42, 97, -71, -17, 42, 7, 93, 84, -6, 68, 77, -73, -30, -88, 54, -63, 56, 11,
+		91, -75, 54, 75, 97, -77, 99, 39, -93, -70, 54, 61, 56, 65, 23, -2, -79, -76, 85, -12, -71, 33, -18, 62, 95, -99, -48, 65, 89, 22, -19, -68,
+		-79, -67, -99, 35, -94, -49, 0, 66, 16, -8, 61, 14, 51, -96, -62, 20, -53, 0, -15, -5, -59, -58, 10, 60, 54, 56, 72, -51, -85, 43, 95, 17,
+		-16, 39, 62, -20, -61, 97, 78, 44, 99, -77, 38, -97, -5, -50, -28, 56, 59, -10, -56, 57, -57, 23, 41, -54, -27, -30, 40, 25, 27, -90, 75, 35,
+		-12, 31, 68, 70, 78, -69, -48, -22, 52, -21, 9, -100, -73, -6, -94, 10, 37, 51, -8, -2, -76, -52, -44, 26, 73, -60, -27, -13, 20, 88, -25, 29,
+		5, -93, 55, -31, 29, -57, 71, 78, -76, -87, -15, -14, -99, -29, 94, 57, -94, 28, -71, -61, -75, 73, -74, -92, 4, -1, 97, 79, 88, -48, -64, 55,
+		-72, 96, -82, 85, 2, 68, -83, 8, -46, -22, 95, -72, -27, -92, 57, 17, 37, 3, -33, 79, -15, -72, -63, 35, -90, -76, 80, -25, 29, -4, -56, 63,
+		62, -70, -76, -14, 43, 45, -43, 39, -7, -85, -47, -96, 92, 50, -93, -18, -79, 42, 65, 76, 70, 70, -89, -57, 17, 58, -2, 39, -93, 24, -26, -24,
+		95, 74, 62, 5, 76, -22, -48, 41, 22, 91, 25, 77, -90, 29, -98, -20, 16, 6, -85, -50, -79, -62, -12, -30, 49, -39, -92, -56, -76, 28, 2, -83,
+		30, 49, 19, -83, 10, 79, -69, -10, 72, 66, 97, -41, 25, 79, 55, 82, -33, 85, 69, -61, -27, 89, 6, -39, -36, -72, 1, 98, -24, -55, 88, -79,
+		55, -4, -43, 56, 90, 13, -87, -13, 76, 48, -91, -19, 8, -54, -22, 21, 78, -45, -2, -37, 94, 85, -54, -98, -1, -72, 59, -63, -61, 73, -36, 1,
+		-74, -96, -72, 32, 23, -23, -22, 42, 59, -22, 16, 1, 69, 76, 34, 46, 42, 78, 62, -94, 81, -21, -37, -33, 44, 25, 73, 14, -51, 10, -58, -28,
+		34, -38, 42, -64, -8, -82, 34, -52, -50, 5, -84, 21, -32, -57, 38, 50, 49, 36, -92, 2, -71, -22, 93, -79, -90, -92, 18, 76, -73, 43, 21, -31,
+		93, -94, -60, 52, -8, 13, 91, 25, 17, 23, 69, -54, -92, 49, -83, 31, -13, 94, -41, -58, 96, -31, 28, -89, 42, 72, 82, 34, -49, 99, 5, 36,
+		42, -90, -16, -47, 12, 17, -62, -2, -95, 93, 75, -94, 43, 20, -41, 76, 96, -59, -23, 49, 29, -94, -69, -6, -30, -31, 70, -33, -58, 70, -58, -22,
+		27, 76, 61, -41, 13, -14, -3, 48, -56, 30, 65, -77, 99, -13, 74, -69, 4, 4, -68, 10, 94, -10, 18, 36, 1, 78, 1, -66, 13, 95, 92, -97,
+		-25, -73, -73, 43, 74, -47, 28, -45, 89, 81, 19, 19, -33, -82, 99, 90, 65, -68, 23, -22, 66, 28, 62, -15, 12, -88, -68, 29, 62, -59, 88, -5,
+		18, -36, -59, -66, 91, -47, -89, 71, 22, -15, 23, 96, -85, -78, 67, 76, -31, -76, -30, -75, 52, 16, -35, 25, 32, -89, -48, -52, 96, 1, -61, 15,
+		83, -21, -49, -27, 94, 57, 77, -22, -20, -19, 13, -53, 48, 46, -21, 61, -41, -27, 8, -39, 50, 80, 59, -72, 88, 78, 83, -7, 68, -33, 13, -66,
+		-5, 59, -7, -96, -45, -17, 24, -14, -47, -23, 24, -6, 49, -17, -95, -47, -42, -60, 72, -30, -25, 36, 56, -83, 92, -5, -25, -32, -38, -93, 71, 98,
+		-15, 82, -70, 5, 16, -25, 42, 88, -18, -9, -22, 63, -25, -83, -97, -27, 89, 90, 97, -67, 38, -64, 27, 99, 74, -38, -79, 77, 87, -75, -90, 4,
+		27, -31, -5, 31, -94, -78, -7, -39, -73, 49, 26, 45, -44, 1, 29, 56, 8, 31, -94, 5, 2, 64, 24, 15, -92, 49, -66, 78, -17, 44, 0, 86,
+		47, 18, -95, -5, -63, 93, 2, 74, -97, 46, 4, -49, 9, -4, 28, 55, 48, -34, 30, -42, 80, 54, 35, -53, 90, 10, 83, 71, 96, -45, 21, 8,
+		-82, 45, -55, -27, 17, 78, 19, 20, 48, 3, 26, 32, 1, -19, -82, -97, 80, -37, 60, -15, 36, -38, 38, 43, -60, 76, -47, -74, 97, 19, 87, -56,
+		-8, 39, 92, -13, -68, -83, -98, 32, 7, 12, -100, -10, 22, 3, 55, -2, 57, 49, 93, 18, 74, 55, 74, 62, -18, -91, 67, -28, -41, -88, -67, -78,
+		-13, 59, -62, 48, 34, -45, 43, -71, -5, -79, 60, -25, 94, 83, -6, -26, 39, 42, -43, -94, -10, -53, 53, -8, -75, 84, 60, -74, -15, 61, 73, -100,
+		-19, -80, -51, -81, 86, 43, -49, 8, 56, -17, 85, -26, 35, -70, 44, -34, 71, -47, 2, -24, 91, 54, -70, -52, 89, 85, 95, 13, 62, -19, 42, 7,
+		-5, -8, -42, 85, -35, -71, -69, 3, 1, 63, 19, 91, -32, -19, -82, 8, 20, -82, -51, -78, -53, 57, 71, -61, 12, 96, -14, 5, 14, -16, -100, -61,
+		97, -55, 64, -2, -76, -2, -92, -95, 50, -42, 87, 90, 68, -65, -12, 40, 59, -97, -2, 13, -22, 21, 91, -43, -100, 84, -77, -11, 18, 85, -41, 20,
+		59, -37, -70, 32, 68, -64, -49, 18, -24, -23, 95, 40, -75, -39, 59, 26, -54, 1, 21, 12, 33, 45, 4, 61, 79, 85, 97, -22, 12, 46, 41, -11,
+		-3, 95, -83, 16, -31, 50, -47, 86, -5, -37, -34, -6, 61, 91, 92, -92, -22, 99, -29, -92, -64, -26, -7, 34, 46, -32, 96, 11, -37, 59, -29, -48,
+		-34, 48, -28, 99, -44, -64, -74, -47, -41, -82, -18, -18, 50, 53, -22, -73, 78, 47, -78, -30, -95, 97, 72, 25, 56, 24, 94, 29, -100, -87, -44, 73,
+		59, -33, -63, -54, 22, -70, -92, -99, -13, 12, -43, -63, -15, -81, -5, -30, -55, -40, 66, -98, -78, 73, -11, 9, 50, 94, 51, 72, -42, -56, 94, 95,
+		84, 47, -67, -69, 74, 35, -41, -53, -83, 61, -28, 16, -90, 21, 8, 72, -64, 55, 89, -69, 46, 3, -17, 59, 60, 37, 57, 76, 27, 34, -51, -44,
+		-30, -57, -8, 55, 69, -36, -39, -15, -30, -43, -99, -3, 71, -98, -35, 78, 46, -4, 18, -60, 88, 54, -1, 57, -43, -12, -45, -53, -88, -48, -55, -96,
+		-93, -13, 69, -65, 69, 86, 8, 44, 74, -83, 5, -58, -3, -36, 43, 41, 41, 86, -77, -91, 6, -4, 42, -39, -31, 31, -43, -39, 51, 37, 10, -58,
+		18, 5, -94, 9, 41, 29, 3, -12, -22, 57, 52, -54, -32, -88, -97, 10, -44, 91, 59, 40, -91, -6, 75, -38, -86, -20, 47, -72, 2, 14, -49, -99,
+		49, -65, 10, 52, -77, 8, 20, -6, -77, 75, 78, 1, -86, -30, 41, -100, 25, -53, 54, -8, -48, 66, 85, 77, 35, -82, 96, -37, -44, 47, 80, -37,
+		30, 20, -54, -17, -85, -35, 52, -38, -97, 4, -31, -44, 1, -21, -43, -12, -44, -49, -41, -31, -46, -40, 27, -8, 87, -53, -70, 75, -83, 98, 64, -61,
+		78, -66, 22, 11, -14, -86, 84, -13, -66, -70, 67, 56, -84, 87, -75, 26, 81, -50, 81, 93, 85, -78, -85, -60, 36, 47, 80, 67, 50, -56, 98, -27,
+		81, 49, 5, -63, -37, -88, -77, 18, 20, 1, 44, 38, 53, -13, -79, -46, -23, 20, 6, 93, -59, 58, -27, 27, -89, 18, 53, -18, -30, -9, 89, -85,
+		42, 10, 57, 54, -24, 15, -97, 41, 77, -26, 15, -61, 11, 32, 86, -41, -42, 62, 81, 97, -34, -39, 2, -91, -63, 78, 0, -67, 62, 22, -85, 40,
+		12, 50, 52, 47, 39, -76, 78, 23, 32, -2, 80, 15, 14, -72, -97, -65, 60, -62, -32, 79, 42, -73, -57, -10, -4, -87, -88, 69, -32, 62, 95, 66,
+		12, -57, 69, -98, -59, -1, 62, 7, -63, -27, -25, 32, 12, 26, -61, -22, 70, -8, 48, 23, 64, -17, -74, 14, -40, 5, 28, 31, -17, -15, 90, -77,
+		92, 98, 90, -75, 33, -72, 82, -86, -92, 28, 14, -24, 55, -66, 25, -82, 1, -63, -3, -28, 86, 87, 7, -66, -82, -44, -77, 94, -78, -89, 84, 69,
+		75, 93, -10, -4, -4, 18, 11, 85, -68, 48, 19, -44, 79, -86, 66, -38, 86, -29, -63, -94, 95, 19, -58, 10, 2, -16, -40, 4, -99, 88, -76, -9,
+		26, 18, 11, -19, 83, -80, -60, 7, -34, 14, -3, -38, -83, 28, 37, 96, -1, 59, -65, -62, 30, -50, -35, -2, -32, -53, 51, -79, -9, -15, 91, -93,
+		80, 55, 77, -83, 67, -11, -44, 49, -93, 75, -54, 2, 27, 57, -51, -94, 44, -27, -44, -86, 21, -58, 11, 78, 38, 9, 25, 65, 13, 37, 82, -31,
+		28, -61, -94, -96, 17, -82, 91, -81, 0, 16, 66, -48, -18, -52, -55, -18, -2, 57, 94, 19, 96, 45, 83, 41, 91, -74, 21, -6, 51, -100, -79, -96,
+		-100, 62, -2, -30, 97, 73, 40, -56, 62, 14, 90, -87, 61, -27, 48, 89, 81, 73, 94, -50, -72, 12, -76, -44, -38, 20, 59, -53, -91, 13, -81, -77,
+		34, 45, -17, 56, 35, -59, 59, 67, 65, 38, -68, -75, -64, -89, -41, 31, 41, -85, 87, -1, -3, -65, 71, -72, 89, 99, 96, 7, 88, -22, -43, -38,
+		48, -69, 21, 14, 15, -33, 55, 55, -65, -1, -77, -40, 83, -46, 78, -87, 33, 75, -9, -52, -26, -6, 69, 36, 87, 81, -86, 10, -99, 21, 48, 18,
+		91, -43, -76, 63, 57, 56, 71, -59, 33, -24, 93, 42, -12, -54, -3, 37, -44, 59, -59, 78, -9, -7, 99, -16, 42, 96, 34, -16, -28, -24, -76, -40,
+		-67, 46, 59, 11, -29, -79, 73, 73, 33, -1, 57, -25, -3, -97, -38, 36, 46, -56, 50, 75, -78, -35, 79, -63, -80, -5, -77, 26, 10, 76, -82, -87,
+		-57, -17, -34, 56, 77, -8, 67, 61, -16, -90, -97, 65, -11, -82, -79, -83, -83, -36, 5, -59, -7, -63, -32, 30, -54, -46, -88, -74, 20, 12, -59, -28,
+		-4, 89, -13, -91, -92, -41, -96, -29, -32, 73, -62, -1, -37, 77, -35, 3, -52, 9, -99, -6, -18, -44, 26, -35, 70, -34, 26, -77, 7, 22, -27, 58,
+		-84, 24, 8, 90, -22, 66, -56, 49, 95, 65, -57, -54, -48, 91, 94, 59, 16, -33, -76, 22, -27, -63, -65, -82, 35, -5, 42, -93, 13, 61, 2, 73,
+		32, -45, 97, -49, 63, -22, -84, -43, 45, 99, -70, 73, 29, -66, -48, -28, -38, -91, -75, 26, 21, -78, -88, 99, -9, -55, -98, 85, -70, -22, 37, 93,
+		-2, 27, 67, 33, 46, 41, -19, 20, 66, 77, 21, 50, 85, -36, 92, 44, -41, -62, -54, 44, 3, 51, -61, 88, 84, -82, -30, -8, 37, -10, 30, 37,
+		-5, -68, 84, 38, 65, -44, 1, -88, -99, -65, -50, -47, -6, 68, -77, -40, -62, -95, -3, 90, -45, 50, 18, 35, 32, -100, -72, -58, -100, 49, 20, -17,
+		-20, 99, -88, 95, 30, -41, -95, 36, -60, -42, -80, 9, 49, 86, -87, 23, -5, 66, -59, -68, -43, -54, -7, 13, 14, -89, -82, 93, 33, -90, -90, 64,
+		-49, -28, 38, 64, -49, -92, -38, 91, -81, -24, -93, -71, 54, 88, 6, -57, -53, 64, -6, -32, 20, -16, -32, 62, -58, 65, -34, -100, 15, 41, -91, -14,
+		19, -85, 7, -2, 46, -14, -95, 58, -91, 98, 84, -80, 20, 80, 80, -98, 28, -88, -83, -65, -82, 10, 71, -94, 89, 41, -47, -59, -32, 41, -65, 93,
+		3, -10, 86, -16, -68, -64, 8, -16, 22, -41, 8, 19, 45, 14, -89, 61, 21, -79, 64, 64, -36, 86, 44, -74, -87, -76, 45, 6, 60, -83, -40, -20,
+		-55, 50, -23, 57, 11, 55, 82, -79, 62, -84, -18, -69, 16, 4, -27, -58, -84, -58, 8, -13, -66, 8, -45, -81, 5, -65, 95, 46, -63, -10, -33, 35,
+		11, -49, 89, 36, -92, -44, -85, -43, 76, -8, -89, 12, 68, -14, -71, 70, -51, 84, -90, 96, 77, -79, 91, -6, 36, 22, 79, -85, 81, 58, -86, -43,
+		1, 1, 41, 50, -5, 14, -63, -42, -100, -53, -65, 37, -11, 66, 23, -89, 45, -29, 0, 60, -7, -37, 89, 6, -29, -13, 9, -20, -91, -31, 81, -81,
+		-75, -13, -27, 81, -14, 66, -92, -41, -23, -41, -67, -91, -63, 1, 70, -64, -34, -67, 85, 38, -1, 42, 86, 32, 60, -89, 52, 18, -54, 11, 54, -51,
+		-40, 9, 31, -54, 30, 80, 18, 4, 42, 73, -62, 28, -1, 14, 13, 47, 31, 62, -80, 15, -44, 65, 73, 46, 61, 44, 65, 38, 59, -42, 91, -22,
+		-75, 15, -21, 0, 95, 86, -94, -32, -6, 56, 24, -98, 49, -80, -85, 61, 30, 22, 25, -87, 73, -34, -90, -81, -98, -83, -62, 65, 57, -1, 97, 11,
+		73, -8, -13, 96, -87, -30, -91, 43, -58, -8, 55, 96, 79, 23, -42, -16, 43, -23, 36, -85, 2, 26, 75, -40, -71, 98, -40, -100, -47, -89, 80, -16,
+		-23, 16, 15, -27, -19, 29, -55, -41, -94, -96, -2, 88, 58, -41, -35, -38, 76, -41, -70, -94, 92, 18, -1, -14, -71, -94, -56, 76, 88, -50, -20, -85,
+		-22, 19, -60, 26, 80, 89, 7, 75, 90, 40, 18, -8, -27, -58, 74, 29, 12, -81, 99, -45, -63, -73, 53, 23, 88, 87, -58, -80, -74, 13, 68, 11,
+		-22, 82, -45, -95, 73, 59, 70, 44, -66, -91, -63, -95, 55, 59, -95, -68, -33, -43, 53, 81, -55, -90, -26, 70, -40, 47, 67, 99, 82, -57, 52, -62,
+		79, -90, 94, 69, -21, -18, 22, -79, 98, 28, -65, -78, -39, -26, -70, 69, 51, 72, 87, 23, -76, -84, -45, 59, -57, 94, -51, 80, 33, -77, 0, 75,
+		-79, 26, 32, -97, -50, 69, -3, -91, 66, 50, 96, -21, -12, 36, -45, -60, 24, 42, 32, 59, -3, 72, 47, -95, -10, -26, -50, -87, -60, 92, -96, 93,
+		16, -58, 96, -52, 61, 7, -8, 27, 61, 77, -72, 6, 69, 43, 64, 20, -29, -7, 48, -84, 78, 22, 84, 46, -5, -56, 49, -22, 71, -87, 89, 6,
+		1, -44, 6, -19, -44, -31, -90, -34, -22, -9, 14, 52, 61, -34, 41, 73, 38, 33, 58, 30, -15, -76, 44, 57, 11, -47, 46, -19, -49, -28, -74, -11,
+		19, -2, -9, -90, -24, -94, -33, -66, -68, -65, 91, 63, 49, 44, -41, 45, 35, -24, 61, 29, -69, 34, -79, 43, -41, 0, 15, 84, 5, -77, 68, 73,
+		-82, -27, -96, -43, 45, 6, -51, -93, 10, -50, -64, -56, -49, 77, -45, -50, -3, 80, -77, 39, -50, 41, 33, 76, -49, -95, 36, -89, 85, 8, -33, 42,
+		-65, 83, -39, -93, 20, -15, 52, 35, -58, -20, 51, -98, 87, 44, 72, 40, -1, -63, -12, -6, -52, -19, -14, 26, -61, 2, -29, 89, 86, 0, -52, 48,
+		86, 52, 7, 15, 30, -76, -25, -56, 40, -15, 21, -92, 48, 44, 73, -44, -9, 92, 30, -41, -81, -39, 30, 62, 0, -6, 43, 33, 15, 31, 16, 76,
+		44, -63, 47, 48, -96, -51, -57, -8, 64, -35, 44, 49, -42, 71, 55, -48, -61, 10, -56, 55, -27, -77, -1, -47, 75, 77, -52, -70, 70, 19, -5, 12,
+		53, 88, -1, 89, -7, -17, -63, 90, -50, -90, -34, 64, -62, 51, -30, 51, -90, -90, -79, 94, -90, 47, -45, 74, -62, -55, 9, 22, -22, 14, -55, -80,
+		56, -63, -43, -4, 75, 97, 29, 34, 91, -95, -58, -49, -88, 68, 13, 34, -98, -35, 66, -80, 70, -35, 18, 24, -61, -60, -52, 50, -37, 18, 98, 6,
+		90, 70, 44, 48, 47, 11, 62, -26, 78, 14, -16, 18, 50, -5, -36, -74, -66, 50, 48, 21, 76, 96, -20, 64, -21, -11, -11, 83, -94, 25, 12, -58,
+		-95, -53, -7, 95, -29, 97, 82, 39, -27, -90, -72, 82, -57, 1, 14, 45, -23, 84, 8, 15, -65, -58, -55, 36, -74, -8, 18, -95, 0, 72, -43, -85,
+		-39, -23, 13, -16, 67, -55, 92, -96, -38, 63, -61, 83, -29, 2, 20, 27, 72, 6, -78, 79, -38, -82, -92, -14, 48, 36, -9, 57, -83, 51, 47, -17,
+		11, 21, -5, -78, 56, -83, -76, 52, -51, -56, -69, 98, 61, 63, 2, -44, 61, -53, 68, 99, 32, -94, -42, -71, -100, -93, 17, 82, 0, 2, -24, -71,
+		93, 40, 92, 98, 89, -3, -82, -23, 28, 65, 60, -48, -13, -82, -73, -57, 85, -69, -46, -1, -17, -43, -13, 14, -86, -10, 88, 49, 38, -96, 27, 69,
+		83, 89, 51, -55, -97, -7, 20, -70, -91, -85, -84, -22, 28, -82, -60, -9, 26, 82, 16, 19, 28, 28, -52, -13, -3, -53, 16, 91, -28, -77, -16, -64,
+		2, -20, -88, -16, 41, -89, -21, 60, -5, 29, 31, 96, -64, -79, 82, -53, 29, -45, 34, 78, -36, 35, 86, -24, -2, 49, -61, -61, -98, 68, -35, 37,
+		-5, -67, -26, -4, -95, 11, -29, 65, -35, -95, 85, -59, 42, -66, -20, 13, -21, 89, -90, -29, -51, 63, -96, -39, -43, 92, 68, -48, -58, 99, -38, -78,
+		21, 95, -27, -67, -69, 30, 90, 34, 7, 72, -88, 8, -63, 74, 99, 27, -3, -93, -94, -1, 63, -74, 13, -13, 33, -97, -88, 73, 80, -74, -81, -61,
+		89, 23, 91, 57, -42, 65, -98, 13, -51, -59, 54, -68, 16, 83, -34, 29, 82, 16, 71, 41, 99, 1, -84, -86, -17, 44, -43, 77, -11, -52, -95, -90,
+		19, -29, -68, 43, -30, 21, 73, -1, -17, 39, 8, 33, 0, -2, 38, -68, 74, -29, -78, -4, -17, 76, -61, 60, -47, 97, 15, -8, 36, -24, -65, -41,
+		42, -33, 67, -37, -13, -59, 65, -54, 10, 44, 27, -49, 92, -57, -8, 28, -91, -22, -88, -58, -77, -52, -92, 84, 11, 4, 98, -41, -6, 40, 25, -11,
+		1, -77, -57, 10, -71, 59, 2, -68, 20, -14, -28, -66, 12, -77, 67, -55, -13, 25, -35, 97, 58, -2, 70, 46, -43, 10, -52, 55, -12, -42, 18, 39,
+		-41, 75, 36, -62, 95, 63, 4, -17, 42, 45, 23, -88, 10, -9, 22, 11, 63, -62, 82, 17, -66, -99, -80, -19, -94, 42, -67, 39, 52, -3, -3, -42,
+		35, -24, -52, -62, 0, -20, -84, -37, -18, -72, 5, 14, -19, -67, 69, 46, 92, -34, -64, -47, 61, 26, -81, -31, 94, 18, 79, -40, -86, 93, 68, 88,
+		-45, -74, -89, -39, -65, 0, 84, -7, -92, 68, 32, -9, -13, -80, -99, -49, 86, 48, -81, -95, 5, -9, -63, 80, 23, -85, 12, -58, -81, -5, 75, 22,
+		-89, 88, 9, 60, -58, -17, -82, 77, -34, 7, 4, 51, 95, 8, 78, -72, -100, -66, -74, 85, -78, -10, -64, 97, -72, 67, -79, 4, -87, 48, 54, -41,
+		88, -7, -80, 87, -62, 85, -87, 56, 47, -80, -56, 26, -56, 21, 49, -65, -41, -22, -26, 79, -39, -96, 26, 22, 79, 52, -26, 70, 50, -5, 22, 40,
+		-3, 72, 26, -56, -52, 78, -89, 67, 0, 76, -31, 1, -65, 96, 86, -61, 35, 72, -22, -59, -84, -84, 34, 34, -98, -97, 9, -34, 99, -15, -98, -52,
+		-75, 68, 29, 65, -83, 78, 48, -55, 74, 92, 84, 5, -55, -27, -87, -28, 41, 15, -78, -99, -31, -13, -81, 33, 65, 7, -65, -12, -45, -10, 41, -8,
+		14, -45, 94, 0, -7, -59, 78, -100, 25, -39, 70, 54, -24, -74, -25, -68, -34, 83, 96, -44, -8, 82, -4, 58, -75, 58, -49, 42, 33, 69, 93, -65,
+		-69, 99, 20, 30, 78, 50, 90, 93, -89, 52, 72, -96, -90, -40, 84, -40, -48, 80, 63, -31, -64, -21, -2, -86, -59, 17, -76, -29, -29, 41, -96, -87,
+		-51, -12, 52, -22, 44, 29, 90, 35, 96, -43, 68, -93, 37, -67, -29, -45, 25, -39, 37, 36, 7, 19, 53, -42, 46, -52, 74, 20, -47, -43, 32, 85,
+		75, 20, -62, 69, -21, 47, -24, -2, -8, 86, 72, -29, 59, 25, 44, 51, -81, 40, -59, 27, -93, 12, 62, -96, 39, 74, 83, -100, -31, -63, 2, -5,
+		-6, 10, 87, 64, -5, -67, -56, 25, 43, -8, 56, 52, 53, -98, 21, -38, -80, 47, -86, -76, -83, -16, 21, 50, -16, -97, -66, 93, 52, -54, 93, 74,
+		47, 75, 74, 48, 10, 38, -44, -5, 28, 66, 41, -75, -67, -60, -44, 41, 83, 81, -71, 52, 85, -23, -98, 6, -94, 88, 31, -63, -2, 95, -47, 27,
+		-10, -27, -11, 83, -31, -96, -6, -4, -51, -46, 9, -61, 81, 75, -69, 94, 91, 79, 28, 60, 22, 47, -74, 0, -2, 70, 56, 61, -93, 99, -5, -3,
+		-15, 18, 59, 86, -75, 38, -30, 53, -7, -42, 42, 11, -73, 30, -62, 58, 29, -7, 85, 80, -74, 51, 22, -59, -99, -55, -5, -9, 69, -9, 34, -46,
+		6, -86, 25, -10, -70, -7, 50, 93, 8, 14, -39, 99, 49, -91, -17, 56, 69, -11, 59, 42, 71, -22, 36, 93, -2, -1, 37, 2, -65, -16, -78, -62,
+		11, -82, 65, -10, -9, -5, -81, -10, -50, -48, 98, -65, -25, -37, -57, 3, 12, -99, 10, -83, -82, 33, -13, -77, -71, 38, 53, -82, 29, 46, -94, 68,
+		-67, -1, -73, 68, -39, -99, 67, 97, 52, -65, -61, 40, 74, -81, 86, -89, 59, -98, 19, 14, 0, -25, 31, 79, 54, 36, 70, -35, 15, -81, -21, -48,
+		0, -78, -32, 85, 0, -75, -71, 6, -44, 73, -57, 78, -2, -10, -63, 27, -98, -95, -74, 91, -92, -66, 29, 38, -76, -92, 87, -43, 65, -43, -24, 88,
+		-17, -95, 69, -55, -24, -91, 35, -61, -51, 43, 44, 18, 43, 70, -33, 89, -39, -17, 85, -92, 13, 11, -61, 55, 93, 99, 22, 52, 13, -72, 42, 1,
+		-53, 32, 93, -89, -61, -31, 44, -6, 22, 17, 77, 97, -49, 96, 16, 24, 2, 32, 97, -2, 8, -8, 30, 37, 93, -46, 81, 10, 40, 57, 66, -28,
+		58, -46, 30, 82, 36, -86, 36, -3, -47, -9, 85, 31, -18, -40, -13, 97, -52, -16, 47, -89, 10, -74, -5, -45, -31, 47, 68, 45, 96, -90, 4, 64,
+		3, -54, -65, 19, 17, 32, 24, -35, 76, -35, 39, -88, -40, 45, 38, -58, 3, 21, 44, -34, -37, -5, 67, -27, 85, -8, -69, -49, 61, 4, 21, 88,
+		-67, -23, 31, -61, 92, 10, -79, 25, 23, 88, 20, -80, -73, -25, -68, 90, 91, 24, -62, 33, -33, -4, 35, 32, 34, 73, -18, 49, 21, -63, 23, -46,
+		-96, -48, -47, -36, -96, -51, -40, -49, -46, -48, -18, -7, 72, 25, 85, -41, -51, 37, -65, 48, -66, -45, 65, -79, 24, -26, 9, 70, 47, -20, -68, 35,
+		-16, -51, 24, -52, 1, 1, 4, -79, 48, -88, 47, -44, 80, 54, -23, 23, -10, -71, -80, -8, 50, 83, 78, -74, -22, -41, 20, 61, -99, -24, 38, 16,
+		-8, -69, -47, 91, 15, -19, -70, 32, -39, 82, 1, -74, -24, -71, 96, -55, -44, -15, 43, 58, 8, -81, -4, -59, 93, 64, 76, -77, 79, 14, 46, 72,
+		-74, -94, 74, -46, 31, -96, 88, 28, 83, 65, 18, 75, 38, 69, -36, -80, -100, -85, 41, -41, 8, -22, -65, -27, -31, -80, -16, 51, -50, 69, -4, 6,
+		-33, 89, 21, -71, 45, -100, -12, 37, -55, -41, 44, -42, 49, 77, 30, 51, 93, 73, 50, 92, -97, -85, -99, 93, 13, 63, -7, -1, -1, -21, -60, -94,
+		25, 17, 82, -8, -37, -6, 81, 58, -55, -86, 40, 84, -46, 42, -6, -2, -46, 5, 82, 98, 67, -82, 10, 84, 48, -52, -50, 99, -26, 12, -49, 7,
+		-72, 37, -53, -99, 42, 22, 0, 32, 0, 87, 53, 4, 42, -49, 95, 26, -61, -17, -95, 44, 29, 82, -71, 89, 39, -20, -56, 15, 5, 3, -99, -35,
+		62, 14, 69, 15, 43, -46, -23, -3, 15, 69, 77, 83, -40, 27, 71, 14, -19, -8, 43, 38, -45, -100, -27, -16, -81, 36, 69, 63, -18, 96, -5, 38,
+		-47, 85, 32, -67, 79, 0, -59, -59, 7, 2, 11, 38, -77, 77, 89, -35, 15, -72, -83, 35, 4, -52, 64, -10, 71, -56, -78, 87, -46, 83, -63, -77,
+		9, 37, 90, 94, 39, -60, -55, 33, 14, -46, -95, -43, 61, -52, 33, -97, 87, 40, 49, -15, 12, -68, -2, 80, 34, 36, 73, -13, -75, 16, -48, 63,
+		-52, -57, 37, 0, 52, 62, 66, -90, 20, -63, -37, -24, 50, 67, -68, -78, -80, -74, 62, -85, 5, -13, -10, 27, -5, 49, -72, -3, 88, 56, 98, 78,
+		0, -31, -15, 74, 68, 79, 6, 40, 95, -30, 23, 38, 92, -49, 44, -91, -83, -11, -14, 85, -46, 87, -64, 93, 73, -94, 53, 95, -40, 41, -57, -100,
+		-58, -48, -8, -34, 37, -45, -48, -81, 54, 75, -37, 64, -48, 66, 26, -95, -73, 40, 74, 89, 93, -34, 20, -34, -53, 82, -17, -82, -63, 94, -91, -58,
+		-92, 42, -49, 36, -44, 39, 54, -73, 37, -6, 10, -85, -68, -25, -13, 36, -82, 92, -61, -51, 79, 50, -47, 50, -2, -80, 78, 64, 62, -79, -21, 35,
+		-76, 16, 59, 74, -78, -24, 24, 43, -51, 83, -86, 25, 48, 90, 93, 91, -86, 95, 74, 82, 54, -64, 19, -54, -16, -22, -98, 30, 20, -22, -100, 18,
+		-55, -19, -4, -71, -80, 20, -77, -80, -45, 51, -11, 87, -97, 36, 33, 21, -70, -24, -5, -15, 12, -12, 88, -31, 8, -82, 45, -88, -3, 76, -23, -35,
+		-64, -24, 0, -37, -27, -94, 14, 29, -86, 5, 17, 20, 46, 63, 44, -99, 10, 58, 30, 44, 35, 39, 59, -54, 47, 38, 83, -20, 60, 68, -72, 79,
+		-56, 52, -34, 60, 6, -73, 1, -88, -79, -65, 37, -12, -93, -67, -76, -23, -32, -93, 35, 23, -25, 16, 73, -91, 50, -2, -45, -35, 84, -88, 43, -85,
+		44, -96, -46, 80, 24, -22, -73, -43, -85, 90, -31, 93, 24, 92, 9, 61, 23, 78, 41, -32, 27, 64, 0, -54, -9, 32, 45, -23, 21, 93, -29, -65,
+		3, -82, 70, 3, -19, 93, -96, 1, -8, 94, 98, 57, -16, -19, 55, 1, -23, -66, 52, -45, -5, 20, 46, 6, -52, -40, 40, -91, -36, -55, 19, 89,
+		91, -91, 48, -32, 76, -97, -24, -85, 28, -99, 69, -51, 96, -36, 24, 4, 88, 81, 36, -25, 58, 8, -51, -75, -86, -33, -95, -41, 6, -41, 91, 90,
+		-8, 91, 82, 50, 19, -13, 93, -32, -71, -43, 44, -13, -26, 25, 48, 12, 15, 93, -16, -80, -79, 59, -38, 60, 44, -25, -7, -3, -74, -60, 16, -9,
+		-86, -73, 79, 98, -22, 53, -56, 24, 77, 86, -73, -54, 72, -92, -53, 67, 66, -59, 5, 24, -59, 57, 71, 97, 71, 54, 0, 43, -87, 44, 29, -44,
+		-94, -21, 71, -71, 96, -88, -20, -11, -84, 91, -50, -10, 17, 0, -78, 72, -48, -92, -25, 76, 42, 22, -37, -45, -25, -46, 53, 62, -98, -30, 97, 29,
+		-78, 52, -83, -54, 80, -53, -54, 97, -70, -81, 83, 6, -46, 1, -59, 49, 63, -69, -45, -10, 33, -3, 10, 84, 84, 58, -52, 66, 26, -88, 5, -13,
+		-56, 98, 87, 34, 79, 69, 15, 10, -89, -4, -42, 41, -7, -71, 14, -83, 35, -68, -32, 31, 9, 98, 81, -55, 6, 91, 49, -80, 77, -76, -3, -6,
+		-92, 61, -40, -88, -20, 86, -78, -79, 13, 54, 63, 47, -62, 34, 34, 93, 80, 61, -32, -5, -11, 26, 51, -22, -31, -35, -48, -84, 25, -66, -53, -52,
+		-81, 98, -9, 18, 3, 80, 69, 82, 98, 75, -62, 64, -6, 95, -91, -29, -88, 7, 1, 55, -33, -87, -55, 81, -32, -35, -49, -5, 63, -64, -39, 85,
+		89, -77, -5, -20, 14, 21, -8, 40, -10, -60, -95, 93, 32, -43, 33, 84, 34, 24, -49, -78, 98, -86, -60, 50, 45, -37, -17, -30, -1, -55, -58, -67,
+		70, -47, 37, 5, -70, 2, -93, 97, 43, -13, 68, -94, 72, -100, 89, -18, 15, 62, 5, -37, -90, -42, -46, 14, -99, -64, -43, 10, 18, 25, -74, -57,
+		8, 47, 74, 9, 94, -22, -24, 76, 6, -88, -86, -34, 29, -56, -18, 21, -3, -86, -75, -50, -2, -16, 4, -50, -82, -88, -20, -6, 21, 66, 92, 22,
+		-9, 69, -17, 78, -5, -35, -24, 11, -1, 83, 68, 21, 16, 36, -60, -6, 81, -17, 88, 9, -59, -92, -29, 66, 13, -81, 95, -93, 34, -51, -8, -46,
+		75, 33, 30, -68, -44, -63, 90, -43, 6, -26, -60, -66, -23, 58, -73, 93, 82, -65, -45, -59, -79, -62, -57, -60, -74, -74, -66, 90, -83, -78, 23, 96,
+		63, -59, 11, -38, -36, -70, -55, 87, 47, -17, -43, -97, 45, -61, -13, 51, -89, -94, 80, 86, -95, 78, -12, -40, 27, 97, 85, 15, -53, 8, -93, -5,
+		-95, 64, 85, -13, -12, 21, 84, 35, 19, 64, -34, 45, 48, 5, -35, -31, -74, 68, 71, -73, -83, -38, 57, -25, 89, 70, 25, -38, -92, -37, 17, 86,
+		-60, -33, -40, -88, -23, -3, 79, -86, -40, 96, 75, 49, -14, -77, 82, 61, 22, -72, 81, 76, 27, 60, 14, 34, 39, 55, 5, 75, -31, 59, -42, -56,
+		-49, 29, 25, 26, 24, -90, -18, -45, 19, -46, 51, 65, 71, 47, 55, 18, 2, 18, -100, -54, 80, -73, -91, 96, -61, 20, -82, 10, -4, 90, 98, -20,
+		-51, 21, -37, -25, -60, -30, 52, 37, -76, -15, -87, 74, 89, 11, -57, 28, -32, 84, -67, -49, 63, 33, 39, 9, -35, -61, 97, -19, 54, -92, -11, -43,
+		-52, 57, 4, -77, -73, -19, 23, -66, -71, -49, 74, -43, -46, -45, -84, 75, -17, 20, -92, -94, 54, 17, 71, -48, -34, -71, -23, 82, -2, -77, 29, 40,
+		-18, -42, -21, 41, -23, 61, 35, 67, -76, -18, -35, -56, -42, -60, 74, 86, 32, 52, -44, -91, -97, -8, 79, 14, 16, 8, -15, 49, -36, 44, 17, 57,
+		92, -61, 28, -53, -67, -91, -31, -95, 15, -33, -47, 42, 94, -1, -69, 95, 41, 26, -6, 75, 61, -89, 4, -5, -21, -94, 72, 55, 24, -75, 54, 13,
+		-61, -8, 80, 84, 61, 71, 37, 12, -52, -16, -34, -71, 38, 63, -99, -79, -50, -14, -46, -78, 64, 64, 66, -99, -100, 76, 63, -80, -10, 73, -93, 74,
+		53, 26, -25, 91, -21, -49, -90, 69, 33, 4, -85, -8, 7, 99, -89, 78, 31, -26, -14, 34, -55, 54, -18, 62, -8, 21, 64, -71, -2, 47, 59, -73,
+		99, -32, 50, 81, -94, 29, 56, -8, -33, 48, -72, -95, 56, -45, 54, -52, -80, 18, -80, 92, -26, -94, -20, -36, -15, 27, -43, 91, 0, -82, 64, 44,
+		7, 68, 38, 14, -56, 33, 91, -45, -10, 97, 79, 48, -7, 22, 14, -98, 33, 9, -33, -98, 40, -51, 62, -31, -21, -96, 51, -7, -27, -27, -30, -43,
+		98, 56, -72, -54, -87, 15, -67, 67, 62, -20, -3, 93, 76, 44, 46, 26, -39, -7, 18, 39, -76, 41, -9, 0, -33, 93, 43, 63, -53, 87, 23, 30,
+		47, -12, -86, -53, -29, -75, -61, -16, -17, -27, -93, -53, 71, 56, -2, 96, -75, -10, 47, 79, -85, 3, 17, -2, -15, -25, 58, -12, 9, -43, 30, 31,
+		72, -86, 31, 80, 33, 23, -66, 80, 26, -34, -75, -17, -51, 58, -18, -81, -56, -7, -68, -15, -12, -87, 16, -22, -33, -50, -22, -23, -61, -46, -98, -93,
+		-84, -27, 66, -70, -32, 28, 20, 90, -68, -40, 70, -43, -87, -2, 32, 80, -60, 53, 42, -40, 24, 60, -16, -69, 10, 99, 20, -20, 89, -86, 35, 0,
+		-2, -59, 15, -69, -19, -27, -21, -32, 96, 30, -45, -11, 8, -32, 40, -46, 26, 88, 98, -87, -15, -56, -90, -39, -48, 20, -36, 12, -36, -23, -69, 16,
+		12, 14, -60, -91, 20, -57, 46, 76, 61, -74, -43, -8, 62, -49, -10, -91, -39, 98, -75, 90, 53, 92, 98, -56, -3, 72, 26, -59, 0, -55, 81, 14,
+		-85, 25, 89, 3, 18, 83, 11, -79, 54, -13, 81, -26, -16, 97, 1, 98, 25, 19, -81, 12, -24, 17, -77, 18, -66, -36, 63, -7, 36, 63, 77, -48,
+		83, 67, -48, 64, -42, 32, -71, -10, -64, 77, 93, 74, -58, 18, 87, -80, 47, 56, 95, 40, 55, 24, 38, 7, 25, -77, 29, -66, 70, -21, -88, 39,
+		-7, -94, 72, -70, -16, -23, -31, -10, -33, -9, 25, -61, 93, -95, 32, 98, -63, 99, 37, 99, 28, 39, 52, 89, -86, -60, -77, -30, -61, 13, -28, 99,
+		-16, 41, 26, 42, 73, -52, 31, -86, 34, 5, -12, -48, 98, 76, -57, -19, 58, -19, -33, 66, -50, 34, -100, -43, 21, -3, -61, -85, 90, -13, 79, -87,
+		10, -20, 32, -55, -71, 77, 69, 41, -2, 37, -47, -54, -43, 22, 29, -23, 17, -96, 77, 60, -39, -37, 52, -60, 20, -66, 41, -63, 47, 43, -32, -56,
+		-10, -53, 68, 59, 16, -95, -85, 65, 27, -4, -59, 76, 26, -1, -45, -94, 2, 43, -8, 33, 49, -61, -80, -13, 2, 20, 74, 56, -78, -67, 22, 41,
+		85, 61, 72, 34, -18, -87, -4, -68, -95, -76, 66, 73, -29, 27, -70, -58, 14, -70, 65, 76, -95, -68, 61, 53, -29, -28, 28, -86, 69, 47, -98, -22,
+		14, 59, 42, -98, 14, -11, 16, 83, -85, 66, 98, 22, -47, -25, 64, 15, 70, 24, 73, -12, -49, 9, 96, -22, 44, 8, -20, -75, 94, -70, -78, 68,
+		16, -50, -2, -5, 4, 29, 98, 48, -87, 28, 88, 88, -78, 82, -32, -26, 39, -45, 99, 4, 10, 36, -20, -17, 86, 59, 12, -40, 31, -20, 15, -98,
+		46, 56, 80, 6, -39, -37, 28, 4, -43, -13, -31, 76, 85, -11, 35, 36, 69, -24, -93, 28, 67, -11, 38, 8, 54, -89, -74, 36, 81, -64, -63, -69,
+		64, -70, 50, -13, 19, 77, 59, -94, -68, 48, 46, -77, -82, 79, 28, 98, -88, 45, -16, 69, 82, -96, 95, -50, 15, 7, -12, 1, -34, -19, 85, 32,
+		-30, 15, -47, 69, 48, 84, 6, 85, -30, -56, -79, 67, 23, 98, -46, -66, 95, -44, 89, -55, -24, -35, -75, -82, 47, 92, -19, 16, 48, -37, 77, -57,
+		54, 66, -30, 3, 85, 36, -68, 52, 68, 10, 66, 32, 36, -31, 35, 30, -97, -80, -9, 87, -25, -55, -56, -83, -18, -82, -98, 96, 90, 98, -66, 84,
+		-100, -76, -13, -26, 63, 7, -14, -13, 53, 59, -77, 29, 89, 87, -9, -10, -4, -70, -71, 37, -14, -95, 52, 74, 78, 6, -24, 28, -83, 73, 38, -7,
+		50, 60, 93, -62, -42, -73, -41, -73, 20, 45, -27, -66, -92, -77, -40, -32, -65, 29, -8, 53, -29, -78, -96, -19, -48, 90, 67, -84, 83, 56, -59, -45,
+		-75, 10, 66, 57, 78, 0, -64, -21, -2, 33, -48, -59, 36, 58, 44, -18, 22, 97, -95, -31, -66, -11, 43, 22, -65, -22, 57, 38, 81, -58, 15, 96,
+		75, 52, -26, -50, 90, 92, 71, 14, -18, -41, -4, -87, -66, 36, 5, 83, 35, 6, -72, 50, -81, -16, 26, 22, 20, -13, 85, -72, 10, 43, -17, -22,
+		2, -82, 50, -12, -86, 50, -72, -97, -2, -51, -58, -47, 30, 95, -28, 96, 30, 33, -82, -28, 8, -71, 82, -52, -57, 96, 50, -57, 32, 19, -74, 67,
+		80, 36, 85, -97, 38, -24, 81, 30, 70, -77, 99, 81, -48, 30, -14, -39, -87, -75, -89, -57, 44, -82, -78, 70, -86, -76, -88, -19, -77, 56, 38, 70,
+		60, -12, 24, -9, -1, -47, -3, -92, 36, 43, -58, -79, 44, -50, 67, 72, 86, -34, 6, 75, -54, -54, 63, 94, -41, 77, -96, 48, -49, -11, 50, 80,
+		-75, -26, 74, -13, -99, 75, -49, 77, 27, 13, 11, 98, -40, -95, -61, -9, -71, 77, 55, 53, -88, 82, -54, -70, 33, 46, 60, -98, -73, -17, -34, -2,
+		-53, 23, 13, 8, -1, 35, 55, 55, -95, -47, 49, 29, 23, -35, 61, 17, 98, -8, 35, 66, 53, 59, -48, -95, -49, -78, -47, 0, -33, -82, 23, -77,
+		26, -71, 62, -57, 90, 75, -13, 24, -35, 54, -43, -14, -14, 70, -24, -42, -61, 44, 85, -81, -96, 79, -74, 38, -43, 49, 97, 91, -72, -47, 31, 98,
+		26, 72, 68, -14, -42, 64, -72, -6, 9, -27, -29, 14, 19, 79, 0, 92, -21, 90, -4, -3, 72, -32, 14, 80, -46, -75, -77, -60, -87, -85, -15, -99,
+		31, 84, 75, 25, 60, -18, -22, -35, 45, -58, 30, 46, -96, 43, 76, 42, -57, -55, -59, -4, -21, 46, -2, -37, 87, 2, 30, -42, 19, 8, 57, -28,
+		43, -6, 97, 41, 95, -66, -35, -60, 28, -57, 4, -67, 44, -100, -21, 41, 26, -14, 83, -66, 59, -67, 2, -2, -51, 63, -70, -99, -28, 73, -25, 45,
+		24, -31, 85, 10, 91, -65, -2, -33, -12, 96, -30, -28, -60, 56, 69, -6, -35, 81, -36, 95, 14, 17, 50, 77, -46, -34, 0, -33, -83, 15, -77, 7,
+		-100, 42, -19, -50, -22, 24, 82, 12, 84, 12, -91, -33, 60, -94, -16, -95, 53, -13, -93, 81, -72, -12, 91, 46, -77, -43, 11, -8, 9, 60, -81, 97,
+		-5, 38, -5, -13, -79, 66, -98, 61, 40, -67, -30, 89, -35, -38, 6, 82, 15, 22, -52, 24, -38, 89, -71, 51, 63, -13, 92, 62, -35, -40, 32, 56,
+		19, -11, -95, -92, 31, 61, -75, 7, -79, 74, 79, -3, 2, 2, 9, 44, -75, 49, 71, -30, -23, 61, -96, -35, 68, -32, 2, 50, 71, -97, 39, -85,
+		18, -17, 13, 71, -98, 87, -36, -35, 15, 57, 5, -56, 61, -83, 90, 5, -40, 36, 33, -95, -17, -86, -69, -14, -71, -96, 63, -58, -98, -76, 32, -87,
+		-20, -16, 50, 35, -3, 53, 23, -53, -24, 45, -98, -62, 50, 92, 34, -66, -1, 43, -16, 1, -10, 20, 53, -2, -25, 4, 33, -51, -45, 52, -89, 35,
+		82, 44, -99, -92, -58, -6, 71, 58, 33, -16, -81, 56, -17, 55, 97, -20, 85, 7, -48, -69, 75, -21, -60, -61, -46, 36, 40, 38, -52, 73, -58, 92,
+		23, 62, 40, -63, -72, -84, -87, 27, -86, -9, -13, -10, 13, -94, -93, 90, 18, -15, -41, 55, -53, -27, 40, -7, -49, -2, 45, -73, -54, 40, 66, -62,
+		59, -59, -33, 51, 51, -8, -41, -13, 89, -82, 8, 99, 30, 61, 15, 58, 67, 48, -67, -66, 12, -60, -43, 34, 28, -88, -97, -27, -64, -22, -84, -95,
+		-97, -79, -36, -21, -37, -59, 75, 37, 61, -58, 0, -85, -88, -18, -84, -52, -99, 27, -40, -77, 12, 1, 42, -16, -95, 2, 72, -20, -20, -76, -69, 87,
+		-69, -11, 72, 32, -89, -17, -30, 69, -21, -57, -42, 94, 3, 8, 16, -14, 39, -61, -8, -38, -4, 6, 11, 56, 43, 16, -78, -52, 92, 68, -9, 64,
+		33, 72, 17, 62, -72, -50, 35, 87, -67, 60, -85, -33, 28, -42, 99, -86, -8, -22, -61, -23, -32, -30, -76, -79, -86, 28, -54, 50, -26, -41, 53, -49,
+		44, -73, 98, -57, 66, -85, -50, -72, 49, 93, -76, 69, 34, 68, 20, -18, -8, 83, 8, 90, 26, 5, -47, 61, 92, 30, 6, -21, -67, -53, -9, 85,
+		47, -32, -72, 28, 17, -17, 5, -48, -67, 53, -24, 64, -92, 83, -89, -20, 24, -69, 43, -49, 26, -41, -20, 67, 84, 98, -1, -100, 68, 19, -76, -49,
+		-74, 39, -49, -29, 66, 37, -74, -64, 86, -44, -81, 72, 51, -59, -53, -5, 72, 3, -38, 47, -42, 15, 7, -58, 34, -97, -47, -29, 67, -24, -26, 53,
+		-50, 17, -24, -78, -33, -97, 80, -68, 58, -20, 35, 23, 98, -64, -32, -7, -27, 42, -17, -97, 25, 85, -21, -54, -59, -54, 63, -20, -11, 90, -56, 76,
+		-83, -88, 27, -24, -95, 51, -39, 16, 53, 41, 16, -91, -5, -75, 9, -77, 14, 72, 23, 19, 56, -92, -70, -64, 61, -10, 42, -55, 83, -16, 45, -22,
+		-46, 25, -21, -4, 74, -80, -24, 29, 48, -31, 84, -31, -27, 49, -44, 8, 59, 56, 49, -62, 86, -95, 22, 97, -49, -2, 88, -17, -29, -19, -53, -30,
+		48, -83, -27, -24, 97, -23, -8, 73, -40, -78, -33, 88, -41, -83, -42, -94, -3, -31, 81, -10, 42, 74, 91, 18, -73, 7, 42, 22, -62, 73, 69, -6,
+		31, -20, -100, -4, -24, -6, 48, 52, -64, 51, 92, 7, -82, -2, 76, 87, 37, 34, -7, -23, 19, 78, -11, -39, -78, -94, 17, 67, 56, 0, 3, -80,
+		-20, -46, 18, 79, -16, 22, -96, -40, -13, -29, 84, -9, 8, 37, 96, -94, 2, -81, -15, 30, 64, 70, -46, -62, -5, 25, 91, -48, 35, -57, 89, -5,
+		4, -36, 56, -88, 11, 97, 59, -89, 83, -40, -67, 5, -65, -11, 87, 91, -27, -26, 15, 55, -11, 3, -11, 20, 1, 44, -26, -76, 20, -43, 9, 0,
+		-2, 87, 58, -2, -94, 66, -14, -42, -7, -11, -54, 26, 68, -90, 0, 36, -97, 73, -74, -91, 18, 40, 34, -52, 95, 54, -74, -73, 81, 62, 66, -21,
+		90, -57, 83, 90, -49, -40, -54, -59, 63, 14, -90, -19, -81, 50, -98, -37, 38, 96, -54, 90, -32, 97, 90, 7, 52, 26, 55, 6, -98, -26, -97, 52,
+		15, -88, 7, -66, -31, 90, 97, -41, -74, 94, -80, -1, 29, -2, 43, -35, -15, 17, -79, -81, 76, 46, 53, -37, -35, -13, 85, -8, -79, -63, -62, -43,
+		33, 37, -59, 39, 32, -74, 84, 6, 58, -43, -81, 18, -16, 57, -93, 13, -91, -12, 16, 91, 68, -41, -48, 98, -35, 82, 1, -27, -46, 27, 61, -66,
+		-25, -11, 99, 81, 27, 85, -55, 73, -15, -85, 5, -73, -1, 97, -13, 60, -48, 64, -68, 99, -88, -4, 38, -9, 77, -41, 98, 61, -74, -3, -47, -6,
+		2, 85, 7, -60, -42, 46, -5, -41, -11, 15, -47, 60, -38, -34, 52, -32, -49, 48, 64, -5, -88, -13, -42, 78, -30, -36, 27, -22, 25, 69, 89, 69,
+		33, 3, -100, 41, -69, 61, -51, -42, 85, 97, -2, 97, 44, -40, -55, -7, -10, -39, 85, -70, 50, 40, -37, -67, 18, -96, -33, 37, 64, -65, 81, 41,
+		-1, 20, -53, -92, 56, -79, -40, 17, 89, 36, -64, 92, -45, 71, -84, -34, 79, 97, -80, -17, 31, -22, 49, -3, 50, 70, -59, 3, -90, -68, -3, -82,
+		-55, 81, -9, -76, 43, -82, -41, 10, -75, -31, 78, 85, 32, -89, -25, 82, -97, 93, 10, 10, 25, 98, 68, -30, -7, -17, 21, -66, 70, 92, 87, -51,
+		8, 8, 16, -25, 94, 30, -60, 30, 58, -1, -95, -39, -86, -6, 9, -99, 7, -67, 91, -15, 63, 13, 89, -76, 59, -9, -52, 81, 29, -57, 92, -82,
+		-51, 79, -41, -67, 23, 82, -80, 93, 22, 38, -15, 72, -13, -1, 87, -63, -51, 92, 46, -17, -19, 42, 85, 98, 43, 24, 56, -60, 21, 65, -59, 55,
+		36, 71, 47, -99, 43, 8, -56, -15, -70, -27, 61, -20, -39, 36, 43, -42, 73, 87, -20, 31, 99, 38, 77, 8, 70, 32, 12, 90, 6, -43, 35, -59,
+		-2, 5, 51, 42, -11, 55, -66, -82, 81, 42, 40, 89, 66, -29, 29, 29, -52, -27, -97, 5, -54, -76, -71, 6, 30, -18, 53, 65, -78, -73, -60, 60,
+		61, 13, 10, -54, -80, 91, 39, -67, -72, 31, -75, -93, -71, -89, -92, -10, 31, 31, -10, -97, 26, 70, -60, -6, 73, -10, -62, 22, 86, 89, 42, -7,
+		-54, 58, -93, -40, -77, -46, -91, -40, 77, -26, 0, 98, 71, 88, -100, 7, 14, 33, -92, -24, -100, 35, 81, 74, -4, 72, -92, -19, 12, -75, 63, 24,
+		-59, -76, 90, 8, 17, 65, -1, -74, 65, 1, -57, -50, -57, 67, 36, 55, -81, 82, -55, 6, -5, 88, -29, 47, 13, 52, -59, 48, -83, -32, -70, 50,
+		-51, 11, -33, -80, 31, -3, 99, -80, -5, -61, -66, -90, 12, 17, -39, -12, 39, 18, -2, 47, 27, -19, 20, 30, -6, -26, -36, -44, 19, -65, 84, -13,
+		-57, -57, 1, 96, -71, -75, -50, -75, 9, -73, 90, 81, -33, -14, 50, 6, 77, -73, -80, 70, 8, -91, -56, -10, -49, -81, 28, 62, 89, -4, -11, -16,
+		25, 11, 42, 93, 16, 29, -12, -15, -2, -11, 20, -90, -78, 42, -11, -32, -55, -35, -91, -13, 46, -43, -38, -38, 34, 83, -74, 2, 5, -23, 58, 43,
+		61, 83, 61, 47, -31, 66, -7, -56, -40, -63, 60, 53, 9, -2, 52, 32, -32, 16, -61, -27, -53, -71, -99, -3, 57, 24, 15, 23, -87, -78, -64, 18,
+		-82, 56, -18, -13, -75, -35, -34, 16, 33, -78, 19, 10, -58, 93, 62, -23, 40, 50, 3, -82, 31, -5, -26, -57, 13, -82, -90, 19, 91, -42, -54, -81,
+		30, 15, -63, -84, 43, 2, 2, -100, -82, 74, -67, 19, 48, 13, -82, -12, -59, -6, 72, 41, -92, 86, 81, 19, -66, -33, 80, -24, -46, -19, 57, 20,
+		70, -19, 8, -93, -33, 85, 78, -96, -95, -7, -28, 4, -42, -38, -2, 87, 37, 87, -80, -48, 35, -22, -27, 28, 5, 22, 27, -46, 44, 23, 11, -24,
+		-99, -66, -29, -63, 73, -75, 9, -19, -46, 91, 1, -58, -67, 59, 46, -16, -59, 40, 3, 3, 21, 3, 38, -44, -78, 5, 49, 6, 7, 52, 39, 63,
+		11, -64, -99, -12, -73, -58, 52, 4, 86, -31, 81, 9, -45, 9, -86, -38, -23, -78, -33, -86, 38, 68, -38, -14, 15, -71, 85, -89, -91, 6, 28, 52,
+		44, 61, 99, -58, 6, -37, -100, 88, -68, -24, 30, 83, -22, -50, 68, 53, 5, -17, -96, -16, 84, -69, -4, -3, 20, 87, -68, -7, -70, 16, -72, -54,
+		-66, 49, -32, -78, 68, 91, -45, 37, 14, -65, -25, -62, -83, 51, 37, -76, -82, -88, 69, -1, -96, -3, 55, 67, -31, -34, 57, 65, 57, -24, -71, -9,
+		-16, 56, -61, 63, -53, -44, -61, 55, 32, -28, -78, 97, 90, -99, -15, 78, 32, 19, -65, 73, 46, 99, -48, 99, -74, 48, -59, 56, 59, -41, -50, 21,
+		-56, 23, -75, -62, 10, -86, -90, 21, -25, -49, -3, -77, -88, -97, 1, 59, 68, 24, -41, -34, 78, 35, -38, -80, 15, -52, 95, 71, -32, -15, 33, 74,
+		-71, 49, -50, -13, 5, -29, 67, 48, -36, -39, -61, 51, 16, 69, 11, -42, 37, -11, -94, 8, 66, -63, -28, -93, -29, 94, 77, 18, -65, -79, -81, -13,
+		-86, 53, -17, 87, -86, 55, -1, 50, 93, -18, 59, 64, -16, -67, -23, -29, -39, 69, 61, 76, -40, 33, -70, 28, 52, -48, 44, 59, 74, 58, -40, -48,
+		62, 7, -90, -60, -78, 27, 48, 47, 25, 84, -77, -98, -9, -26, -58, 40, 36, -52, 55, 93, -77, -100, -88, -2, -63, -80, -74, 47, -76, 63, -41, -46,
+		58, 88, 83, 35, -5, 99, 11, -58, -57, 2, 97, -30, 97, 75, 90, -62, -37, -60, 51, 60, -33, 22, -51, 26, 10, 44, -50, -4, 60, -54, 18, -52,
+		9, 68, -23, -58, -79, 60, 83, 16, -30, -77, 69, 98, -19, -25, -44, 90, -11, -54, -82, 39, 38, 6, 24, 73, -94, -14, 74, 3, -67, -94, -57, -66,
+		-5, 53, 25, -63, 5, 1, -86, -37, 66, -90, 6, 57, 82, 35, -87, 87, -17, 3, -12, -7, -61, -44, 28, 87, 17, -24, 9, -30, 54, 82, 78, -90,
+		-67, 32, -23, -56, 61, 58, 98, -56, 49, -16, 45, -91, 52, 30, 18, -40, -26, 84, -83, 63, 60, 73, 92, -94, 5, 72, -54, 37, -2, -66, 43, 28,
+		43, -60, 26, -27, -87, 75, 22, -10, 26, 12, 22, -38, 98, -60, -10, -23, -5, 75, 47, 22, -67, 17, -87, -4, -36, 3, 46, 66, 85, -24, -16, -42,
+		-12, 82, 77, -32, -2, 75, -4, 76, 98, 25, 34, -57, 36, -25, -52, -13, 29, -17, 59, 3, -61, 37, 97, -28, -77, 47, -84, -7, 33, 77, 21, 14,
+		-52, -91, 25, -48, 89, 90, -77, -75, 14, -29, -26, 35, -47, -59, 57, -25, 6, -28, -94, -4, 41, -14, 42, -82, 52, 84, 63, 70, 24, -32, -51, 30,
+		53, -60, 41, -21, 77, -67, 55, -2, -59, -99, -99, 95, 1, 35, 3, -28, 70, -17, 75, -28, -88, -32, -20, 64, -71, -96, 95, 56, 4, -66, -27, -85,
+		-46, -41, -95, 68, 4, -61, -85, 86, -45, -40, 78, 74, 5, 59, 70, 84, 3, 44, 2, -61, 69, 90, -12, 55, -31, -64, -60, -86, -79, 91, -24, -30,
+		41, 5, -21, -55, -40, -84, -22, 75, -82, -36, -95, -15, -12, -57, -60, -45, -22, 8, -25, 21, -91, 61, 56, -84, 47, -100, 10, 59, 47, -62, -61, 28,
+		34, -25, -75, -30, 8, 14, 83, -29, 42, -65, 62, -75, -31, -96, 97, -87, -10, 39, 38, 45, 94, -18, 54, 34, -23, -29, -3, -48, -84, 43, 59, 50,
+		-32, -13, 1, 81, 70, 50, 84, -60, -64, -22, 89, 70, 84, -85, -33, 98, -70, -48, 68, -27, -62, 18, -83, -89, 23, -4, 55, 59, 82, -99, 78, 47,
+		39, -31, 86, -63, -5, 31, -86, 49, -30, 80, 68, 0, -81, 1, -10, 53, 28, -18, 57, -86, 46, 74, -57, -9, -23, -26, 91, 69, 2, -58, 39, -20,
+		91, -26, -77, -42, 97, -59, 28, -20, -90, -52, -82, 71, 98, 88, 81, 37, -31, -14, 63, 69, 42, 30, 35, -19, -11, 66, -10, 1, -64, -54, 86, 95,
+		-98, 61, 65, 87, -60, 68, -39, -33, 91, 30, -10, 80, -88, -93, 14, 62, 36, -46, 11, 5, 93, 21, 23, 12, 88, 66, 61, -7, 13, -89, 30, 41,
+		-74, 3, 81, -16, 2, -25, -52, 62, -76, 14, -88, -81, -50, 6, 79, 13, 44, -75, -62, 69, 72, -15, -26, -16, -79, -84, -75, 98, -88, -66, -7, 68,
+		-75, -18, -96, -87, 29, -94, -60, -48, 57, -35, 72, -29, 93, 37, -4, -47, 94, 4, 9, 30, -55, 13, -20, -68, 84, 84, 92, 97, -8, -85, 38, -99,
+		-50, -29, -22, 37, 40, -44, -56, 31, -73, -57, 86, -53, -90, -5, -14, -100, -84, 61, -3, 58, -22, 25, -92, -4, -43, -60, -44, -80, 88, 76, 94, -76,
+		62, -4, -40, -66, 51, -56, -13, -97, -53, -52, 52, 45, 20, -60, 94, 53, 55, -3, 83, 41, -19, -57, 56, 60, 24, -36, 69, -70, -37, -48, 20, 46,
+		-92, -85, -15, 61, 10, -52, 5, 74, -37, -72, 15, 69, 89, 64, 8, -81, 97, -60, -16, -42, -98, 8, -36, 94, 82, -89, -97, 98, -67, 93, 42, 54,
+		-90, -57, 13, 79, -28, 87, 1, -38, -81, 4, 54, -62, -8, 93, 79, 71, -33, -10, 40, -72, 43, 32, -54, -67, 50, 0, -97, 56, 46, 78, -34, 54,
+		84, 81, 48, 35, -6, 57, -39, 69, 65, -23, -17, 75, 31, 56, -27, 33, 68, 17, 78, 50, -52, -62, 53, 46, -18, -33, 93, -98, -84, -61, -58, 3,
+		87, 81, -30, -69, -45, 1, -78, 26, 97, 98, -46, -18, 68, 31, -27, -29, 3, 28, 77, -31, 79, -83, -34, 20, 1, -31, -34, 59, -69, -43, -98, 28,
+		-66, 3, -55, -68, -62, 17, -37, 54, 78, 67, -2, -17, 39, 3, 63, -19, 90, 3, -47, 69, 94, -83, -28, -80, 96, 15, 90, 95, -46, -55, 65, 14,
+		32, 63, -33, -94, 76, -70, 95, -56, 20, 85, 82, -47, 8, -29, -36, -86, 26, -35, -24, -58, -5, 49, -38, 34, 60, 53, 65, 15, -73, 16, 77, 90,
+		50, 11, 41, 34, -65, 84, 66, 87, -4, -21, 63, -52, -7, 63, -15, 47, -39, -77, 10, 42, -21, 74, 41, -32, 53, 84, -32, 23, 90, 56, -41, -7,
+		-77, 6, 46, -18, 23, -18, 22, 79, -33, -4, 81, -11, 63, 24, 46, 58, 82, -90, -72, -81, -12, -73, 87, 29, -43, 42, -95, 23, -57, -61, -44, 29,
+		61, 99, -47, 48, -54, -15, -33, 56, 32, 43, -94, 90, -6, -11, 70, -14, -14, 68, -15, 74, -27, 0, -11, -73, -51, -46, 45, -25, 52, 48, -99, -52,
+		-42, -66, 87, -66, 97, 42, 49, 25, -24, 25, 7, 87, 22, 93, -87, -42, 75, 97, 24, 36, 25, 27, 80, 42, -2, -98, -93, 68, 6, -77, 39, -32,
+		-97, -5, 24, 78, 35, 99, 67, 43, -84, -95, 16, 82, 13, -93, 17, 22, -49, -31, 35, 47, 75, 33, 70, -15, -78, 9, 26, 3, 85, 76, -99, -83,
+		-40, 69, -39, -6, -9, -58, 25, -53, 13, 23, 87, 79, -79, -65, -83, -90, -79, 93, 66, -55, -16, -65, -45, 12, 95, -95, -67, 40, 18, 88, -82, -68,
+		-84, 22, -17, 4, 51, 70, -9, 11, -31, 88, 17, -23, -14, 25, 8, -89, 15, 35, -55, -14, 93, -46, 24, 38, -73, -38, -42, -34, 86, 61, -11, 49,
+		7, -2, -62, -57, -91, -62, -34, -48, -68, -29, -6, -48, 7, -91, 66, 91, 41, 33, -96, 51, 56, 69, -5, 73, -62, -87, 75, 1, 45, -3, -7, -60,
+		26, 92, -17, -66, -75, -38, -31, -71, 28, -41, 28, -89, 35, -95, -58, -56, 73, 37, 56, 22, -24, 31, -43, 50, -91, 47, 76, -44, 13, -90, 19, -29,
+		2, 75, -98, -19, 41, -7, 63, 94, 24, 40, -90, 40, 38, -38, -77, 70, -75, -55, 62, -34, -41, -22, 89, 17, 87, 60, -85, 94, -87, -50, -10, 4,
+		-12, 96, -10, 20, -94, -29, -77, -28, 96, -51, -78, 68, -63, -10, -52, -27, -57, 9, -34, 53, -2, 7, -83, 1, -42, -29, -51, 3, -6, 36, 49, 27,
+		86, -20, -1, 26, -56, -47, -5, -51, -39, -59, 11, 80, -24, -94, 49, -90, -24, -55, -97, -51, 8, 61, 93, 93, -90, -87, 15, -13, 66, -81, 57, -91,
+		62, 33, 95, 96, 78, 53, -22, 55, 45, -30, -68, -50, 16, -99, -64, 29, 92, 14, -97, -93, -11, 71, -20, -5, -48, -80, 59, 14, 24, 63, 60, 86,
+		-52, -91, 51, 3, -66, -65, 86, 60, 73, 38, 67, -68, -16, 76, 97, -73, 60, -89, -42, 35, -17, 1, 70, -3, 38, 65, 68, -28, -56, -13, -70, 78,
+		-34, 95, -84, 65, 38, 91, 26, -4, 33, 54, -36, -8, 54, -90, 14, -83, 45, -12, -18, 79, -83, -5, -28, 81, -5, -97, 48, 98, -16, -5, 70, 86,
+		66, -74, 83, -19, 32, -69, -33, -64, 60, -95, -1, -72, 40, -24, 56, 46, -66, 70, -39, 54, 90, 82, 86, -2, 92, 77, -55, -89, -14, 17, 96, -22,
+		31, 23, 14, -99, 11, -20, -98, -12, 44, -1, 47, -52, 17, 65, 0, -95, 17, 63, 24, 52, -67, -60, -53, -54, 34, 30, -33, 64, -25, -65, -60, 91,
+		7, 96, 2, -26, 40, 54, 70, 8, -26, -44, 52, 46, 54, -38, -85, 77, 76, 89, -16, 98, 84, -100, -90, -66, -86, 4, -46, 31, -57, -98, -72, -25,
+		77, -52, -51, -38, -12, -15, 84, 92, 69, -74, 68, 67, -57, 66, -22, 37, 92, 13, 27, -15, 90, 23, -38, -34, -88, 93, 72, -91, 40, 77, -26, -56,
+		-20, 47, -20, -19, -87, -92, 33, 47, 37, 22, -55, 12, -28, 75, -29, -95, -26, 43, 64, -72, -88, -48, -67, 75, 91, -88, 54, 65, -72, -64, -71, 8,
+		43, -99, 80, -2, 56, -76, -42, -18, -52, -41, -24, -96, -1, 85, -20, -43, 44, 68, 96, 87, -41, -38, -15, -25, -73, 91, -2, -100, -50, 36, 14, -97,
+		98, -83, 48, 58, -31, -38, -32, 65, 27, -7, 28, -64, -66, 36, 82, -13, 93, 51, -19, 97, 21, -22, 26, -38, -93, -66, 52, -50, -13, -13, 99, -38,
+		-25, 89, -65, -99, -70, 82, 59, 36, -39, -54, -10, 93, -31, -3, -90, 31, -78, -32, 61, -22, -45, -50, -11, -84, -47, -96, 50, 25, -12, 59, 57, -3,
+		43, -67, 9, 8, -83, 42, 62, 95, 42, -86, 32, -86, 19, 72, -91, -29, 7, -33, 4, 95, -54, 54, 78, 93, 46, 26, 70, -10, 6, 82, -11, -20,
+		-78, 11, 69, -4, -37, -76, -25, -63, -77, 26, 90, 12, 19, -78, 58, -24, -6, -7, -11, 31, -39, 68, 34, 38, -4, 56, -95, 59, 11, -60, -68, 80,
+		48, -17, -47, 85, 89, 71, 67, -80, 37, -50, 86, -41, -94, 4, -72, -24, -64, -27, 53, -72, -71, -83, 42, -51, -23, 7, 31, 70, 93, 85, 4, 76,
+		-90, 93, 52, 26, -93, 37, 33, 78, 67, -64, -92, 64, 13, 77, -17, 61, 48, 9, 55, 32, -97, -17, 92, -91, 94, 15, -32, -2, -55, -44, 13, -82,
+		-10, -62, -12, -78, -67, 5, -25, -10, -61, -55, -47, -29, 24, 26, -98, 76, -54, -88, -73, -85, -55, -39, -56, 21, 9, 0, 23, 20, -28, -58, -96, 69,
+		39, 23, 94, -34, -80, 0, -13, 69, 57, 61, 71, -38, 90, 88, -100, -67, -89, -43, 4, -9, 8, 14, -24, -27, 60, 80, -68, 27, -78, 70, 98, -65,
+		90, -30, 77, -72, 58, 79, -21, 24, 4, -96, -54, -33, 73, 60, 18, 8, -17, 76, 26, -22, 52, 95, 6, 84, -44, 86, 12, 15, 28, 51, -23, -7,
+		-89, 98, 11, 72, -16, -34, -90, -89, -81, 64, 18, 86, -53, -77, 21, 64, 79, 10, 86, -12, -29, 75, -39, 2, -45, -84, -15, 39, 55, -28, 31, -15,
+		-82, 65, 20, -71, 84, 15, 23, 47, -78, 26, 77, -79, 29, -16, -38, -53, 89, 11, 95, 27, 73, -81, 0, 47, 61, -37, -98, 57, -83, 13, -1, 89,
+		-40, 43, 4, -99, -22, 25, -52, 4, 29, -81, 86, -73, 44, -93, 34, -55, -11, 11, 38, -2, -37, -36, -25, -44, -4, -74, 93, -48, -39, -74, 56, 88,
+		-26, -39, 57, 85, 99, -53, -41, -16, -65, -71, -27, 73, -26, 89, -24, 69, 70, -19, 96, 6, 87, -84, -7, -73, 58, -94, -58, -1, 81, -89, -81, -31,
+		-11, -43, 31, -18, -43, 26, -17, 19, 50, 52, 59, -19, 58, 7, 10, 51, 70, -52, 41, -47, -92, 86, -75, -32, 20, -36, -39, -89, 28, -84, 34, -50,
+		64, -55, 31, -94, -99, -12, 6, -95, 63, 47, -64, -16, 25, -57, 63, 16, 51, 50, 87, 54, -70, -54, -32, 53, -66, 87, 95, 59, -6, 74, -91, 43,
+		1, -24, 39, -78, 57, 79, -61, 82, -14, 94, 85, -15, 53, 23, -34, -29, 6, 60, -29, 21, 78, -55, 76, -12, -77, -93, 63, -94, -57, -9, -26, 3,
+		-86, 52, -73, 25, 9, -10, 47, -70, -64, -12, 2, -98, -74, 15, 51, -38, 96, 31, 18, -1, -84, -35, -70, 42, -61, -76, 35, 57, 69, -53, -6, 91,
+		-27, -67, 46, 39, 43, -81, 95, -7, 39, -66, -84, 53, -65, 76, 29, 16, -5, 38, -36, -95, 33, 33, 50, -57, -1, 26, -45, 73, 91, 91, -67, 48,
+		75, 62, 93, -46, 32, 26, 86, -35, -86, 38, 98, -77, 18, -86, 34, -87, 38, -25, -81, 44, -74, 17, 71, 88, 52, -67, -51, -82, 18, -22, 63, -37,
+		-70, 26, -40, 40, -69, -3, -85, 94, -68, -32, 29, 51, -44, 11, -69, 88, -40, 42, 22, -61, -56, -89, -35, 14, 68, 12, 5, 84, 78, 83, 48, -9,
+		-9, 42, 7, -98, -54, 75, -85, 8, -7, -45, 45, -59, -54, -94, 64, -59, 27, 95, -2, 0, 13, 17, 37, -2, -70, -7, 68, 92, -22, -69, -31, 93,
+		-81, -71, 3, -58, 96, 26, 88, -32, -62, -73, 72, 11, 46, -57, 30, 78, -49, -83, 77, 77, 63, -21, 57, -4, -28, 28, -20, -25, -65, 33, -77, 0,
+		-90, -34, 4, 10, -87, 69, 17, -99, -36, -74, -92, 83, 91, 6, -32, -95, 22, -90, -86, 75, 18, -51, -61, 93, 50, -25, -8, -30, 35, -89, -48, -57,
+		-97, -87, 89, 58, 75, 28, -83, -93, -42, -94, 4, -30, 11, -32, -29, 45, -80, -26, -22, -94, 23, 4, -30, 3, -9, -20, -97, -29, -54, 37, -21, -79,
+		-91, 59, 27, -54, 50, 56, -91, 99, 20, 19, -55, -54, 54, -48, 75, 60, 24, 16, 78, -89, 81, -38, 58, 42, 37, 62, -50, -25, -90, 1, -38, -37,
+		-73, -100, 95, 23, 71, 91, 24, 37, -84, -61, 1, -93, 13, 63, -1, 8, 28, -94, -81, 55, -8, 83, 10, 67, -16, -43, 63, 82, -66, -91, 77, -29,
+		-8, -72, 82, -59, -74, 37, -23, 98, 48, 89, -70, 87, 4, -4, 95, 52, 35, -12, -55, 61, 27, 8, 42, -31, 51, 43, 71, -9, 37, -56, -56, 17,
+		6, -93, -92, 1, -32, 58, 22, -54, -59, 75, 12, -91, 96, -49, -54, -26, -56, -82, 94, 4, 14, -17, 25, 83, -25, -38, -62, -87, -1, 5, 47, 59,
+		41, -89, 80, 44, -76, 93, 10, -65, 61, -95, 88, 41, 41, -38, 90, -39, 37, 42, 48, 32, 34, -90, 79, -6, -43, 81, -9, 37, 62, 22, -39, 49,
+		-13, -15, -50, -39, -55, 85, 94, 6, -35, -71, -45, 78, 82, 20, 71, -7, -96, 7, 29, -40, 20, -27, 34, -16, -87, 44, -58, -99, -37, -9, -98, 95,
+		59, -100, 4, -76, -48, -85, -70, -10, -72, 23, -53, -7, 94, 76, 8, -20, 27, -73, -62, 92, -12, -38, 24, 64, -54, 26, -60, -100, -29, -65, 10, 12,
+		15, 2, 11, -51, 94, -89, 24, 50, -35, 90, 7, -58, -16, 91, -65, -33, -82, 3, -90, 79, -88, 64, -49, -15, -91, -83, -86, -76, -70, -91, -54, 8,
+		40, 57, 30, -88, -28, -5, -29, -2, 42, -67, -54, 34, -98, 36, -37, -100, 67, -79, -53, -39, 8, 1, 84, 97, 59, 27, 35, -79, -31, 41, 48, -31,
+		-91, -46, 52, -6, 86, -10, 76, 97, 9, -55, 15, 85, -50, 94, 21, 46, -48, -88, 43, -41, 51, -73, 83, 79, -62, -62, 27, 63, 39, 80, 88, -26,
+		-49, 74, 60, -31, -60, 99, -39, -50, -1, -78, -51, 25, -88, -85, 41, -87, 10, 62, 9, -93, 80, 0, -13, 8, -6, 36, -91, -8, -90, 67, 3, -7,
+		63, 73, 94, 4, -91, -51, -49, 24, -48, -80, 24, 12, 71, 63, -12, -60, 72, 34, -47, 71, -22, 45, 21, 23, -23, -93, 91, 82, -19, 15, 14, -26,
+		35, 53, -56, -57, -57, 71, -9, -51, 4, 60, -26, -40, -10, -35, 24, 92, 0, 87, 57, -53, -28, -79, 93, 40, -17, 69, 43, -95, 67, -82, 61, 71,
+		61, 7, 67, 73, -97, -39, 19, 21, -63, -86, 20, -14, -21, -9, -84, 14, -56, -37, 78, -20, -52, -31, -86, 45, 43, 43, 58, -44, 83, -55, 7, 53,
+		85, -29, 73, -73, -8, -17, -3, 82, -90, 49, 39, 76, 40, -8, 87, -17, 42, -15, 58, 50, 89, -62, -98, 27, -66, 68, -100, -22, 60, 87, -69, -2,
+		98, 71, -92, 38, -98, -26, 31, -38, 45, -70, 83, 44, 32, 96, -3, 17, 42, 63, 82, 24, 19, -6, -9, 40, -58, 5, -16, -13, 69, -65, 60, 3,
+		28, -47, 43, 17, 41, -76, 41, -42, -25, -36, 90, 51, 10, 59, 83, 84, 21, -73, 1, 81, -26, -92, 2, -99, 11, 1, -56, 6, -33, 92, -46, -78,
+		-95, 31, -100, -82, -7, -46, 15, 45, -52, 88, 85, -54, -82, -70, 5, 3, -53, -85, 40, -17, 14, -4, 53, 37, -37, 12, -80, 87, -82, 14, -21, -32,
+		25, -51, 3, 85, -92, 3, -13, -13, 77, 21, -35, -7, -4, -81, 72, 45, 38, -69, -46, 45, 51, 22, -16, 99, -39, 34, -23, -92, 45, 30, 75, 90,
+		45, -83, 21, 51, -39, 97, 28, -73, -6, 61, -28, 78, -45, 9, 47, 94, 40, -65, -37, 44, -42, -63, -71, -2, 45, 31, 58, -7, -54, -94, 28, 33,
+		-47, 21, -42, 31, -70, -49, 15, -12, -55, 90, 96, 54, -94, 7, -37, -35, 87, -51, 0, -23, 38, -43, 41, -10, 46, 29, 88, -93, -99, -41, -22, 11,
+		-93, -50, -95, -4, -30, 31, -47, 56, -96, 16, 91, -53, -23, 55, -60, -96, -45, 20, -56, -78, 85, 87, 93, 84, 30, -25, 51, -28, -43, -15, -24, 47,
+		-59, 32, -68, -54, 28, 41, 90, 86, 78, -95, 51, -73, 7, 44, 93, 25, 92, 92, -25, -73, 52, -52, 86, -27, 87, 28, 63, 37, 99, -66, 6, -52,
+		45, 97, 92, -63, 45, -74, -75, 45, 15, 74, 24, -71, 75, -46, -22, 90, -58, 23, 55, 16, 72, 3, 47, -4, 56, 76, 3, -5, 76, 92, -84, 31,
+		92, 43, -58, -3, 40, -92, -62, -38, 12, 10, -69, -31, -73, -85, -67, 52, -26, -94, 73, 15, -9, 24, 7, -43, 24, -20, 55, 49, 43, 78, -20, 3,
+		56, -9, -5, -54, 97, -52, -64, 67, -64, 16, 54, -91, 38, -20, 50, 99, -14, 80, -51, -63, 26, 76, 73, -70, -89, 3, 90, 76, -52, -70, 24, 8,
+		-70, -52, -27, -37, 24, -7, -38, 74, 65, 79, 91, 66, -93, -92, -85, -40, -56, -79, -73, 75, 71, -97, -2, -56, 60, 78, -7, 59, 44, 5, 49, 38,
+		37, -100, -45, 94, -76, 36, 88, -90, -80, -10, 29, -85, 2, -3, -11, -86, 39, 24, -93, -83, -79, -52, -57, -63, -74, -12, 96, 35, 8, -7, 69, -32,
+		-51, 90, 18, -34, -92, -26, 4, 89, 3, -36, -17, 34, -99, -32, -85, 74, 80, 73, -71, -42, 10, -50, -48, 52, -5, 85, 47, 79, -88, 69, -23, -89,
+		1, 25, -21, 21, -5, 63, 20, -7, 5, 58, 45, -15, 57, -97, 6, -24, -79, 65, -14, 5, -30, -58, -48, -23, -56, -80, 33, -30, 67, -55, -47, -81,
+		2, -62, 59, 31, -97, -19, 25, -3, -10, -64, 87, -46, -100, 44, -100, 84, -40, -79, -27, -82, -62, -69, 51, -85, -20, 2, 63, 64, -7, -59, -43, -47,
+		-1, -62, -79, -40, 70, -41, -44, -89, -8, -81, 82, 47, -17, 44, -25, -86, -45, -13, 88, 98, -22, -2, -58, -73, 17, -70, -12, -60, 53, 90, 34, -20,
+		23, 91, 0, 88, 33, -31, 65, 63, -88, 23, -35, -74, 50, -19, -22, -88, -16, 69, -53, -23, 78, -51, -10, -17, 42, 41, -55, -54, 58, 35, 80, -4,
+		70, 7, -6, 21, 77, -62, 81, -16, 51, 94, -86, 43, 44, 47, 83, -60, -72, 70, -94, -36, -22, -52, -68, -95, 60, -82, 14, 33, 5, 27, 50, 37,
+		-15, 88, 95, -38, -77, -56, -96, 5, -36, 1, -36, -36, 91, -56, 73, 4, -80, -98, -77, 41, -43, 60, 77, 1, -47, -89, 10, 47, 60, -9, 69, 49,
+		46, 20, 76, -42, -33, 14, -57, -77, -79, -19, -19, -14, -41, -25, -45, -1, -4, -64, -41, -51, 39, 49, 90, 71, -35, 37, -3, -21, -62, 22, 72, -23,
+		52, 47, -37, 2, 63, -3, 0, 78, 99, 67, 92, -16, -8, 13, -72, 69, 53, 96, -41, -82, 80, -45, 3, -14, -30, 62, -35, -48, -61, -84, 43, -58,
+		-54, -16, 38, 89, -47, -27, 8, -48, -8, 60, 68, 64, -19, -35, 38, 22, 46, -45, -7, -52, 69, 97, 98, -79, 33, -17, 36, 54, 0, -79, 84, 72,
+		-84, -70, 99, -46, -58, -78, -80, -93, -23, -46, -94, -99, 85, 63, -53, 35, -89, -67, -55, -82, 92, 14, -41, 7, -43, 28, -47, -67, -33, 4, 73, -28,
+		74, -15, -56, 85, -11, -27, 58, 16, -89, -79, 44, 31, 77, -57, 94, 13, -45, -13, 76, 88, 85, 84, -88, 58, -41, -15, 34, -23, 87, -29, -34, 91,
+		31, 42, 69, 26, -33, -41, -93, 92, -82, 42, -79, -48, 18, 11, -9, -46, 0, -56, 29, 44, -96, 32, 67, 19, 67, -28, 52, -70, -51, 10, -81, 49,
+		-49, -38, -42, 74, 95, -69, -44, 78, 91, -99, 11, -14, -73, 40, 75, 64, 27, -29, 96, -96, 42, -16, -28, 38, 23, 67, -35, -72, 3, -23, 0, 34,
+		82, 22, -100, 60, 84, 17, 70, 42, 3, 17, -83, 12, 61, -28, 30, -55, 84, 45, 86, -91, -79, 18, -33, 22, -63, -31, 36, 92, -33, -4, 30, -3,
+		-36, -64, -100, -14, -98, -80, 31, 73, 2, 38, -5, 42, 84, 79, 43, 58, 34, 30, -100, -18, -26, -61, -60, 30, 11, 1, -64, -64, 72, -94, 55, -8,
+		63, 56, 3, -5, -48, -33, 41, 67, 18, -20, -97, -10, 62, -14, -99, -66, 9, 93, -35, 16, -47, -81, -78, 98, 27, -51, 51, -89, 10, 84, 87, -71,
+		-13, 63, 45, -65, -79, 42, 28, -7, -80, -44, 29, 90, -100, -91, 94, 99, -93, 77, -91, 46, 97, 61, -33, 32, 61, -13, -54, 24, -16, -35, 84, 6,
+		-24, -69, -25, -94, -11, -96, 48, -72, -94, 9, 76, -15, -71, 53, 8, 62, 4, 50, -29, -94, -51, 38, -49, -1, 14, -20, 97, 31, 63, 86, 13, -82,
+		-89, 25, -25, -44, 74, -100, 9, -19, 63, -46, -5, -36, -92, 31, 85, 86, 41, 19, -49, 20, -82, -73, -57, -27, -7, 12, 43, -19, -91, -74, -53, 76,
+		-97, -60, -36, -19, 94, 35, -99, 4, 60, -21, -3, 46, -91, -29, 42, -2, 62, 99, -38, -53, -87, 64, -84, 92, -19, 37, -47, -100, 29, -48, -53, 75,
+		-77, -57, 25, -18, 24, -94, -50, 12, -92, 19, -16, 40, -93, 93, 15, -57, -100, 58, -20, 95, -72, -31, -39, 79, -34, 19, 67, 27, 64, 57, -61, 69,
+		-47, 18, -32, 44, 67, 61, 84, -56, 63, 65, -76, 22, -48, -55, -12, -49, -51, -39, 86, -29, 24, -39, -36, -99, -81, 35, 49, 35, -2, 43, 62, 1,
+		-90, -34, 34, 73, 96, 44, -40, -33, -13, -56, 85, -67, 64, -82, 82, -11, -45, -90, -46, 76, 50, -19, 80, -91, 6, 1, -65, -46, 22, -12, -89, 94,
+		-29, 12, -57, 78, -93, -50, 77, -84, -64, -57, -73, -96, 53, -59, 89, 10, 98, -7, -67, 48, -42, 83, -74, 21, -89, -68, -91, 32, 12, 37, -45, -48,
+		65, 80, 37, -98, -44, -80, -95, 27, -11, -78, 43, 8, 80, -74, -97, -6, -55, -12, 31, 98, -3, 14, 20, -55, -51, 31, -10, -78, 78, -83, -62, -26,
+		-100, 71, -10, -60, 76, -62, -46, -19, 65, -85, 30, -62, -32, 21, 76, -76, 88, 33, 79, 40, 29, -69, 4, 0, 28, -26, 68, -26, -100, -23, -15, 30,
+		-74, -94, 70, -21, -71, 82, 60, 2, 17, -56, -40, -14, -98, -64, 33, -29, 83, -41, -78, -57, 33, 99, -85, 73, -56, -75, -72, -45, -70, 13, -47, 33,
+		4, -22, 8, 80, 15, -69, -37, 78, 69, -8, 34, -28, 21, -94, -64, 30, -38, 99, -65, 61, -100, 90, -41, -4, 47, 32, 50, -54, 29, 39, -13, 86,
+		-69, -67, -56, -91, -29, 64, 16, 63, -5, -60, 45, 68, -4, -13, -21, -24, 31, -74, -35, 82, 42, -74, 3, 77, -75, 43, -3, 16, -10, 67, 44, -53,
+		-86, 96, 82, 82, 52, -10, -18, 15, -42, 27, -3, 25, 98, -62, -51, 9, -15, 87, -63, 78, 60, 8, 38, -21, -63, -72, 57, -51, 4, 11, 59, -33,
+		-87, 25, 27, 78, 74, -31, -31, 84, -95, -48, 33, -52, -45, -100, 86, 96, 81, 14, 58, -47, 33, 28, 9, 13, 88, 97, -72, 51, 34, -82, -54, -85,
+		47, -47, 60, 41, -65, 16, 46, -73, -90, 58, 37, 5, 65, 47, -36, 31, 58, -5, 5, -55, -75, 65, -7, -8, 31, -35, 49, 89, -25, 37, 57, 59,
+		83, -84, -28, -87, -19, 20, 8, -4, -93, -13, 4, 8, 63, 51, -41, 52, 49, 5, 74, 33, -84, 30, -50, 54, -9, -82, -80, -89, -77, 89, -79, 21,
+		-1, -99, -93, -12, 52, -45, 79, -4, 1, 30, -70, 17, -87, 75, -70, -66, 69, -73, -25, 79, -92, -28, -44, -71, -17, -2, -68, 58, 23, 41, 39, -79,
+		86, 18, 25, -77, -35, 32, 82, 75, -77, -46, 53, 30, 37, -97, -15, 12, -98, 58, 48, 77, 45, 80, -87, -8, -26, 68, 96, 7, 77, -45, -14, 63,
+		-13, -100, -78, 37, 25, -6, 75, 15, -94, 47, -1, 69, -56, 98, 17, -75, 59, -89, -57, 33, 61, -65, -85, 62, 99, -6, -46, -89, 67, -55, 7, -79,
+		-59, 87, -43, -67, 49, 88, 76, 33, 23, 46, -67, -21, 39, 6, -50, -21, 18, 17, 13, -26, -14, 43, 3, -39, 19, 16, -6, 78, 41, 48, 72, 96,
+		-82, -52, 11, -73, -30, 82, -38, -65, 62, -95, -34, 7, 4, -65, 66, 43, 20, 83, -82, -73, -74, -74, 73, -64, -25, -19, 23, 12, 0, 69, 24, 4,
+		-76, -89, 32, 85, 76, 26, 93, -82, 73, -25, -41, -74, -74, 75, -26, 12, 17, -82, -57, -11, 38, -38, -100, -73, -78, 39, -3, 14, 2, 77, -71, 4,
+		71, -47, -13, -59, 77, 76, 58, 35, 12, -99, 37, -47, 90, 50, -52, 81, -38, -32, 22, 96, 78, -92, 40, 10, 97, -89, 84, 4, -27, 11, -38, -16,
+		36, 81, -85, -18, -3, 92, 84, -89, -39, 66, 88, 44, 13, -79, 56, 47, 26, -67, 23, -36, -16, 29, -72, 48, -45, 28, -89, 98, 84, -34, -99, 80,
+		23, -60, -100, -11, 27, 11, -69, -81, 8, -15, -94, -63, 39, -75, -50, -6, 34, -48, -65, -28, -73, -20, -99, -48, 66, -29, 31, 5, -43, -10, 48, 93,
+		26, 47, -76, -18, 74, 84, -85, 35, 7, -83, -44, 32, -51, -71, -59, 20, 38, 22, 49, 51, 84, -92, 84, -86, 48, 30, -85, 86, 24, -30, -96, -15,
+		-70, 18, -100, -24, -48, 33, -5, 63, 86, 16, -43, -44, 80, 94, 70, 42, 0, -84, -35, -33, -63, 89, -77, 39, 90, -65, -28, 46, -90, 87, -79, -64,
+		0, -50, -72, -67, -74, 98, -80, -100, -5, -83, 76, -38, 27, 40, 87, 94, -37, -20, -37, -33, -91, -66, -27, -10, 75, 59, 46, 67, -87, -6, 53, 75,
+		-37, 76, -89, -20, -12, -55, -27, -82, -58, -40, 40, 84, 77, -34, 43, 96, 47, 62, 79, 10, 14, -46, 64, 20, -100, -19, -18, 21, 10, 93, 0, -55,
+		30, -58, 23, -97, -25, -14, 62, -57, -78, -84, -89, -67, 90, -88, 18, 49, 45, -18, 40, -13, -100, 8, 4, 93, 17, -33, -38, 8, -18, 0, 24, 25,
+		37, -27, -87, -63, 4, -98, -97, 89, -41, -59, -42, -63, 54, 4, 64, 72, -52, 47, -53, -4, 80, 17, 39, 34, 65, 51, 57, 41, -43, -78, -68, 67,
+		-74, 0, -74, 34, -36, 76, 95, -5, -10, 69, -78, 54, 44, -46, 46, -15, 75, 2, -90, 7, 5, 77, 60, 49, 57, -16, 48, 47, -56, 94, 25, 54,
+		39, -42, -98, 24, 72, -95, 17, -17, -76, 52, 18, 86, 6, -55, 87, 1, 35, 85, 61, 71, -100, 84, 49, -56, -7, -66, 54, -52, 45, -45, 14, 54,
+		-48, 11, 31, -25, 50, -24, 79, -8, -84, 90, -14, 88, 49, -46, 73, 35, 33, 3, -32, -94, -74, -79, -28, -80, 34, -8, -52, 4, -98, 97, -34, 16,
+		-16, -82, -4, -85, -61, -11, 15, -17, 16, -10, -47, 44, 46, 9, -71, 66, 91, -53, 22, 53, -86, -44, -71, 72, 71, -59, -88, -87, 36, -30, -53, 46,
+		47, 10, -45, 54, 74, 97, 94, 87, -72, -98, 78, -2, 91, -65, -82, 62, 75, -35, 48, 2, 43, -46, -98, -95, 90, -25, -51, 74, -64, -12, 30, -56,
+		-81, -40, -19, -73, 17, 60, 88, 12, -69, 15, -91, 3, -91, -14, 50, -58, -32, 45, 87, -88, 12, 46, -3, -26, 98, -24, -59, -39, 23, 35, -16, -77,
+		-17, 75, 21, -36, -24, -52, 77, 35, -47, 56, 11, 45, -37, -67, 15, -93, -1, 76, 17, -50, -60, 50, 81, -1, 83, -17, -42, -29, 81, -83, -39, 51,
+		-97, -99, -87, 82, -25, 25, -25, 60, -13, -27, 60, -2, 74, -100, 4, 68, -24, 56, -37, -86, 48, -31, 65, -98, 7, 64, -40, 50, -18, 38, -43, -42,
+		-9, 24, 64, 53, 30, 16, -64, 90, 64, 1, 32, 39, -79, 95, -84, 47, 80, -13, 67, -8, -69, 76, 83, 30, -92, 49, -40, -9, 76, 60, -5, -82,
+		-23, -69, -56, 87, -40, 27, -76, -55, -56, 70, -57, -14, -23, 36, 33, -77, 18, 22, -77, -41, -44, 2, 93, -14, -19, 88, 32, -45, -75, -84, 42, -79,
+		77, 93, -42, -38, -43, 74, 62, 30, -65, 40, 33, 48, -70, 78, -94, -69, -12, -29, 56, -58, -18, 48, 35, -18, -70, -14, 99, 22, 49, 88, -42, -36,
+		35, -35, -70, 18, -21, -66, 78, -67, 59, 7, 25, -74, -86, -98, 81, -84, 47, 90, -25, -78, -62, -18, 7, 20, -73, -73, 40, 40, 21, 4, 27, 72,
+		-48, 50, 6, 76, 35, 61, 28, -4, 97, -36, 4, 35, 32, 89, -72, -87, -90, 16, 55, 5, 95, -50, -1, -100, -72, 36, -9, -54, -58, -13, 18, 95,
+		18, 9, -34, 30, -82, 9, -8, 63, -53, -53, 34, 92, -1, -19, 94, -4, 46, 74, 39, 0, 24, -49, -88, 10, -63, -49, 9, 20, 74, -67, -29, -7,
+		37, -41, 45, 74, -89, -81, -41, 12, 22, 47, -19, -33, 22, 3, -43, -62, 11, 60, 26, -9, 38, -68, 86, -15, -35, -50, 37, -56, 29, -5, 59, -33,
+		11, -41, -75, 79, -95, 98, 62, 73, 54, 46, 2, -1, 51, 70, 54, 21, 60, 60, 65, -47, -13, -15, 18, -47, 58, 7, 44, 53, -86, 66, 54, -92,
+		-96, -99, 64, -40, 5, -45, -72, -95, -6, 8, 66, 88, -57, -10, 0, 64, 93, -58, -28, 56, -53, -75, -44, -27, -38, 42, -6, 45, -60, -63, 2, 93,
+		29, 3, -90, 11, -48, -56, 66, 73, 93, 10, 67, 66, 11, -84, 51, -94, -86, -61, 82, 0, -54, -71, -53, 89, 15, -87, 26, 14, -50, 33, 68, -73,
+		-57, 53, -64, 11, -12, -39, -7, 69, -36, 18, -21, 22, 66, -6, 50, 66, 29, 19, -21, 89, -10, -74, -88, 18, -65, -64, 29, 95, 56, 34, -38, 28,
+		-97, -57, 84, 45, 21, 35, -10, -77, -13, 56, 54, -5, 26, 76, 23, 81, 61, 68, 65, -19, 29, -53, -36, -29, -75, 70, 80, 60, -100, -99, -46, 46,
+		22, -2, -70, 21, 55, 32, -95, 88, -53, 77, 7, -25, 83, 78, 88, 94, -16, -79, -82, 26, 23, -95, -22, 55, 92, 53, 38, 83, -74, -42, -57, -85,
+		-36, -79, 56, 15, 81, 8, -18, -24, -43, -53, 72, -58, 37, -100, 52, 37, -11, -44, -44, -81, 99, 44, 50, 49, -84, -34, -8, -86, 92, 79, -57, -68,
+		84, -55, -5, -39, 70, 0, 26, 10, 86, -98, 49, -53, 1, -25, 5, 59, 3, -43, -66, 53, 93, -70, -89, -39, 66, -67, 67, 73, -32, 55, 5, -71,
+		-88, 51, -92, -9, -88, -2, 26, 64, 7, 56, 2, -74, -62, 81, 35, 87, 57, 9, -60, 44, 93, 16, -74, 43, 0, -21, 54, -86, 8, -13, 54, -94,
+		0, -39, -79, -26, 90, -81, 84, 8, 57, 52, 35, 87, 70, 55, 16, -64, 83, -84, -20, 83, 59, -51, -94, -8, -7, -17, 8, -38, 96, 59, 50, 0,
+		48, -23, -77, -61, 57, -25, -16, -3, -8, 8, 39, -37, 56, -14, 83, 35, -62, 94, 66, -16, 91, -91, -12, -98, 49, 76, -6, 76, 19, -74, 98, -93,
+		67, -71, 38, -38, -70, 81, -4, 28, 51, 40, 20, -5, -79, -54, 73, 94, 16, 60, 36, 81, -22, 21, 38, 87, 0, -84, -25, 41, 47, -60, -26, 69,
+		41, 0, -49, 6, -61, 9, 6, -64, -31, 71, 73, -7, -58, -92, -72, -43, 33, -55, -93, -24, 54, 15, 7, 27, 64, -81, -4, 73, -26, -38, 26, -55,
+		-39, -46, -75, -4, -67, -1, 10, 49, 86, 90, 26, 13, -31, -3, 64, 60, -35, 26, -27, 85, -16, 0, 45, -42, -42, 13, -30, -72, 63, 56, -64, -16,
+		-30, -8, 76, 89, -18, 32, 78, -23, -77, 85, -29, 82, 24, -61, 27, 0, 1, -75, 17, 42, 38, -36, 81, -63, 78, 73, -75, 27, -94, 13, -72, 74,
+		66, 14, -28, -48, -86, -43, 2, 33, 27, -85, 39, 48, -25, -29, -73, -44, -48, 36, -4, 93, -29, -41, 26, 10, 53, 49, -38, 64, -61, -32, 94, 4,
+		89, 81, 43, 88, -94, 69, 17, -44, 15, -84, -50, -95, -54, -30, 15, 2, -52, -4, 87, 82, -30, -26, 37, -53, -63, 1, -53, -93, 55, 82, -34, -67,
+		-62, -1, -77, -74, -58, 33, 55, 3, -56, 53, 92, 43, 42, -16, -50, -59, 86, 19, 61, 47, 21, -19, 5, 60, -26, -91, -41, -39, -97, -33, 21, 30,
+		-86, -25, 1, -42, 19, -28, 2, -3, -63, 73, 39, 23, 46, -95, -55, -7, 78, 41, -74, -95, 21, 33, -14, 37, -67, -72, 55, -95, -100, 32, 97, 29,
+		72, 25, -52, 59, 9, 19, -41, 19, 1, -31, 86, 97, 38, 4, -55, 47, -36, 71, -40, -31, -20, -6, 96, -54, -30, -21, 54, -76, 50, 85, 25, 91,
+		-9, 59, -30, 99, 29, -16, 35, -67, 12, 48, -72, 87, 89, -62, -19, 93, 21, 60, 2, -29, 53, -75, -49, -90, -97, -71, 94, 5, 76, -45, -70, 8,
+		-13, 56, 34, -89, 20, -74, 44, -89, 6, 70, -99, 5, 23, 55, -25, 58, 68, 52, 68, -100, 8, 50, -12, -60, -95, -84, 24, 78, 69, 39, -37, -30,
+		64, -11, 99, -13, -50, -4, 33, -98, -20, -36, 43, 95, 75, -57, -84, 22, 83, -49, 64, 85, 59, 61, -74, 49, -60, 27, -2, 93, -58, 63, -5, -37,
+		-38, 27, -69, 12, -70, -51, 65, -55, -8, 55, -23, 75, 8, -83, 52, -70, -2, -66, 88, 99, -53, -93, 46, 87, -53, -12, 16, 37, 33, 53, 31, 72,
+		-67, 86, 12, 77, 54, 85, -13, -39, -85, -54, 69, 12, 67, 43, -15, -49, -27, -19, 42, -33, 70, -84, -92, -82, -34, -42, -94, 55, -64, 32, 90, 77,
+		43, -58, 63, -72, 59, 45, 78, 83, -92, 48, 71, 90, -25, 28, -41, -63, 56, -71, 95, 65, 47, -23, 81, 88, -43, -23, 23, -82, 22, -65, -62, 95,
+		-7, -27, 91, 19, 35, 83, 79, -29, -66, 54, 11, -100, 61, -42, -42, 28, 48, -85, 19, -77, 77, 16, -66, -86, 31, -97, 25, -78, 20, -9, -99, 74,
+		-51, -80, -65, 30, -55, 95, 26, -39, 47, -88, -22, 72, 38, 19, -55, -52, 98, -76, 45, -44, 31, -98, -96, 74, -81, -88, 19, 11, 59, -42, 37, 20,
+		79, 35, 13, -51, 61, -99, -89, -27, 50, 2, 90, -85, -81, -91, -10, 70, 35, 16, -44, 95, 72, 2, 81, 60, -51, 53, 12, -32, -93, -29, -52, -25,
+		-82, 51, 49, 73, 72, 24, -30, 36, -22, -67, -69, -65, 21, 57, 43, -58, 35, 37, -25, -32, 62, -80, 44, -34, -30, 41, -75, 66, -13, -97, 13, 47,
+		60, -69, 40, -76, -48, 91, 40, 38, 91, -33, -33, 19, -87, 57, -57, -75, -14, -43, -3, 29, -93, -28, 19, -57, -78, -52, 49, -52, 59, -20, -72, 48,
+		47, -80, 68, 22, -49, -68, 7, 86, -21, -96, 10, 61, -69, 77, 36, -63, -67, 61, 22, -13, -16, -48, 61, -87, 66, 66, 48, 0, 56, 57, 33, -2,
+		-5, -63, 36, 89, -73, 68, 52, 71, -27, 19, 20, 48, 68, -80, -37, 95, 81, 61, -79, 6, -73, -90, 38, 61, 0, 10, 31, -65, 9, 3, -61, 61,
+		37, 85, -54, 39, -64, -29, 17, -94, 45, -36, -93, -20, 64, -8, 57, -79, 57, -3, -17, -36, -6, 44, 46, -73, 64, 59, -39, -53, 10, -84, -18, 19,
+		-70, 66, -65, -3, 38, 7, -57, 87, 95, 42, -96, -27, -66, 21, 56, 37, -91, 99, 28, -32, -96, 85, 46, 79, -74, -26, -89, 62, 31, -57, -75, -51,
+		72, -37, -24, 3, 87, -14, -68, -72, 87, -86, 87, 92, -13, -33, -68, 69, 6, -36, -68, -89, 14, -85, -18, -83, -86, -42, -38, -66, -87, -87, -44, -86,
+		-96, 2, 99, -35, -1, 98, 52, -60, -63, -60, -80, -28, 32, 1, -82, 56, 61, 66, -50, 97, 76, -89, 41, -53, -78, 61, 19, -62, 9, 38, -78, -59,
+		43, 66, 36, 74, -4, -85, -3, -77, -16, 63, 81, -53, -37, -56, 65, -31, -22, 77, 21, 97, -67, -54, 10, -87, -29, 73, 54, -82, 66, 92, -95, -79,
+		3, -77, 9, 80, 98, -59, 28, 53, 85, 78, -1, 4, -33, -31, -45, 27, 37, 76, 52, -86, -87, 14, 13, 15, 52, 77, -32, 48, 99, 67, 12, 47,
+		-15, -76, 4, -30, 70, 18, -100, 82, 61, -11, -48, -40, 4, 40, 22, 90, 30, 1, -93, 89, -58, -51, 90, 40, 59, 30, -32, -4, -2, -9, -47, 45,
+		-48, 96, -90, 82, -18, -66, 61, 98, -90, 67, 77, -23, -12, -84, -57, -76, 22, 65, 80, -11, 55, 63, -36, 44, 24, -83, 90, 12, 3, 59, -18, -39,
+		17, -78, -53, 88, 42, 55, 93, 67, -27, -81, 24, -92, -69, 8, -7, 44, 36, -23, 4, 26, -34, 72, -33, 3, 22, -77, -68, 61, -57, -35, -68, -83,
+		-97, 38, 20, -54, 31, 90, -100, -71, 35, 9, 26, -25, 71, -65, 48, -21, -94, 84, -1, 4, 72, -6, -76, 92, 68, -16, -67, 88, 58, 40, -81, 92,
+		45, 11, 38, 86, 76, 71, 45, 66, 29, 50, -4, 93, 33, -23, -95, -62, 19, 99, 31, -37, -11, 59, -67, 98, 84, 58, -56, -58, -28, -66, -94, -69,
+		-67, -20, 78, -61, -61, -9, 88, -34, 4, -68, 38, 20, 48, 48, 91, -79, 8, -31, -45, 49, -69, 63, -93, 34, 41, 5, 94, -1, 83, 16, 91, 59,
+		16, 68, 38, -28, -76, -73, -8, 43, -52, -55, 19, 80, -5, 39, 89, 36, -100, 87, 61, 31, -48, 82, 97, -33, 52, -30, 77, 9, 53, 9, -9, -5,
+		-65, -24, -94, 35, -14, -14, -38, 27, -54, 7, 8, -88, 31, -54, -25, 71, 61, -95, -97, -38, -32, 96, 60, 8, -44, 87, 41, -26, -56, 63, 67, -50,
+		43, 7, 39, -15, 85, -2, 18, 70, -19, 37, -86, -41, -26, 92, 46, -42, 2, 32, 54, 98, -28, -63, 6, 32, -38, 22, -71, 78, 16, -55, -93, -69,
+		-2, 89, 45, -27, 77, -80, 4, 32, 41, -71, 93, -51, 53, 20, 59, -41, 15, 92, -36, -37, 79, 1, -25, 0, -74, 4, -87, 61, -96, -89, 46, 76,
+		-95, -57, 78, 82, 21, 96, 65, 88, -8, 39, 30, 67, -34, 77, 97, 38, -99, -69, 42, 4, 70, -58, 53, 59, 6, 72, 73, 69, 55, -4, -94, -6,
+		-5, -81, 1, 31, 21, 44, -74, -60, -14, -45, 35, -36, 71, 43, -46, 73, 15, -68, -71, -66, -73, -54, 67, -63, 85, 74, -72, 36, -63, -39, 47, -47,
+		-5, 41, 32, 39, -23, -67, 49, -11, 21, 30, -85, -38, -11, -12, -80, -11, 25, 68, -7, 12, 27, 57, -95, -6, -28, -73, -44, -24, -27, 92, -26, 69,
+		90, 27, -68, -51, 25, 96, -10, -89, -13, -53, -41, 65, 75, 41, 57, 3, -58, 90, 60, 17, -15, 96, 94, -97, -85, -47, -30, -34, 67, 59, -68, -93,
+		-18, -85, 0, -74, -89, -56, 43, 8, 89, 66, -99, -43, 67, 24, -24, 24, -60, 32, -4, -41, 15, -64, -57, 55, -31, 93, -82, -84, -17, -63, -20, -32,
+		-68, 63, -55, -65, -87, 97, -71, 72, -81, -26, 14, 66, 59, 54, 61, 17, -55, -5, 69, -66, -7, -72, -80, -89, -25, 26, 21, -54, -31, 9, -91, 96,
+		81, -52, -53, 81, 48, -73, -2, -26, 34, 39, 90, 21, 8, -95, -27, 24, 59, -29, -20, 4, -86, 2, -26, -55, 11, -93, 59, -50, -3, 76, 12, -76,
+		24, -5, -3, 12, -1, 22, 62, 67, 57, -28, -7, -66, 17, 61, 46, 17, 41, 28, -35, -91, -26, -28, 77, 99, 48, 20, 3, 64, 53, -11, 65, 24,
+		-23, -67, -3, -71, 31, 35, -43, 91, 14, 43, -19, -49, 43, 52, -86, 43, 18, -15, -63, -48, 16, -100, 19, 5, -51, 61, 19, -53, 14, -67, -50, 56,
+		94, 27, 7, 90, -29, -28, -88, 28, -100, 37, 20, 30, 67, 95, -77, 86, 98, 0, 12, 28, -8, -76, 12, 50, -70, -58, 56, 29, -28, 29, 56, 56,
+		2, -59, -23, -78, 15, -43, -16, 28, -54, -1, -5, 57, 37, 93, 54, 63, 97, 52, 63, -28, -81, 73, 70, -95, -86, -4, -4, 43, -96, 28, -10, -5,
+		92, -73, 39, 39, -26, -61, 24, 69, 40, 67, -38, -51, -44, 68, -29, -11, -63, -12, 92, -41, -40, 31, 69, -44, -44, -50, 50, -45, 11, 24, 2, -45,
+		46, -3, 4, 31, -74, 41, -97, -68, 6, 88, 18, 71, -84, 29, -27, -12, -14, 37, 62, 62, 40, 34, 59, 43, -23, 75, -81, 95, -53, 90, 72, -58,
+		22, 86, -68, -9, -18, 27, 46, -51, -79, -13, -26, -13, 46, 66, 62, -55, 42, -45, 62, 78, 27, -85, -28, -73, 52, -59, 50, 31, -11, -22, -3, 53,
+		17, 5, -31, -41, 53, -20, -76, -44, -100, -19, -58, 52, 42, -73, -97, -86, -11, -18, 24, -4, 86, 41, 7, 22, -32, -62, -63, -3, -54, 22, 51, 43,
+		-70, 55, -77, 15, 68, 12, -69, -49, -73, 89, -78, -88, 39, 32, -88, -35, 13, 55, 35, -36, -100, -81, 31, -28, -39, 13, 50, -11, -39, -91, 7, -25,
+		5, 65, -76, -95, 2, -36, -45, 89, 93, -84, -83, 51, -67, 95, -36, 68, -32, 25, -90, 99, 8, -58, -59, 42, 17, 2, 46, -32, -56, 97, 24, -94,
+		60, -7, -91, 92, 93, -16, 76, 97, 48, -22, -93, 53, -29, 95, 43, -60, -22, 35, -27, 56, 41, 71, -74, 3, 4, 43, 52, 94, -37, 44, 71, 82,
+		51, 36, 31, -19, 22, 1, 82, 85, -58, 38, -23, 39, 43, -31, 35, 18, -94, -42, -38, -71, 39, 87, 62, 44, 83, 54, -89, -24, -43, -63, 1, 30,
+		56, -67, 68, -19, 58, -63, -15, 16, -2, 52, -59, -48, -45, 76, -38, -37, 35, -82, -12, 85, -12, -89, 73, 55, -52, 99, -72, -50, -80, -21, -37, -21,
+		-67, -88, -3, -99, 25, -43, -98, 77, 88, -68, 90, 15, -29, 23, 58, -95, 61, -24, 16, -25, -45, -6, -95, -48, -36, 42, 49, 64, 47, 9, 97, 44,
+		81, 68, 57, -100, 91, -19, -20, -99, -83, -98, 23, -95, 24, -40, -77, 83, 1, -54, -85, -88, -77, -37, -70, -74, 31, -33, -29, -37, 14, 80, 41, -83,
+		-6, -24, 98, -73, -91, 32, 64, -7, 14, 55, -74, -81, 97, 79, -72, -95, 3, 71, -66, -39, 71, 13, 30, 61, -73, -43, -92, 13, 98, -40, -41, 75,
+		-62, 13, -62, 75, -27, -8, -96, -47, 61, 90, -4, 81, 17, -82, 72, -12, -64, 42, 27, 35, 36, 50, -65, 91, 24, -75, 95, 18, -39, -81, 53, -48,
+		5, 83, 40, 22, -30, -61, 31, -24, 50, -95, -48, -78, 17, 7, -96, -69, -82, -85, 46, -50, -23, -82, 11, -20, -13, 5, 56, -20, -9, -7, 92, -89,
+		-89, 59, -75, -30, 59, -73, 79, -52, 48, 59, 67, 40, 21, -96, -30, 40, 33, 35, 16, 41, -9, -75, -14, 66, -52, 9, -72, 90, 70, 49, 80, 88,
+		-74, 38, 38, -70, 76, -18, 5, -76, 29, -24, -13, -77, -46, 19, 89, -78, -58, 40, 66, 22, -51, -92, 13, -80, -83, 9, 62, -81, -96, 95, -42, -46,
+		26, 29, 25, -100, 14, 83, -24, -16, 1, 85, 36, 72, 78, -6, 69, 57, -2, 79, -93, -95, 86, -5, -49, 18, 31, -66, 54, -2, 95, -51, -48, 47,
+		-93, -15, 42, -89, 42, 84, 56, 76, -81, 11, 28, -38, -15, -66, -56, -65, -52, 32, -17, 15, 64, 83, -31, 21, 20, -98, 14, -27, -20, 79, 5, -8,
+		46, 52, 49, -11, -66, 72, 68, -26, -84, 11, 10, 30, -60, -45, 60, -93, 67, -56, -70, -23, -52, -69, 46, -34, 24, 61, 3, -29, -92, 59, -80, -79,
+		-71, -3, -54, 50, -64, 80, 92, -27, 52, 3, 95, -53, 51, 54, -37, -6, 97, 19, -10, 11, -10, -34, 12, -8, 99, 58, -18, 83, -5, 4, -95, -86,
+		-31, 38, -83, -65, -32, 33, -62, 96, -69, 34, 63, 48, -10, 59, -1, 82, -20, 88, -32, -77, 86, -95, 69, 82, 51, 47, 78, 53, -28, 54, -39, -81,
+		-58, -79, 16, -3, 38, -16, 68, -15, -89, -25, 7, -4, 19, 33, 97, 37, 34, -43, -56, -39, -5, -69, 9, -29, -1, 2, -92, -98, -52, -17, 92, 22,
+		-84, 53, 2, 87, 40, -98, -76, 87, 87, 27, 89, -51, 72, 75, -87, -83, -95, -47, 71, 91, 74, -11, 87, -32, 72, 15, -25, 19, -46, -24, -69, 89,
+		-56, 36, -47, 9, -96, -40, 45, -40, -72, -3, 91, 41, 19, -87, -42, -53, -16, 86, -32, 35, -95, 33, -46, -98, 82, -7, -78, 61, 17, -7, 72, 43,
+		11, -88, -40, -57, -36, -89, -28, -94, 15, -80, 79, -11, -3, -62, -90, -22, -48, -56, 22, 14, -85, -59, -68, -94, 32, 71, -96, 23, 68, 10, -4, -98,
+		-42, 16, 31, 43, -60, 73, -73, -74, 60, 54, 83, -45, -82, -65, -87, 13, -56, 39, -51, 70, 58, -33, 94, 24, 27, -79, 7, 26, -23, -89, -41, -99,
+		-61, -77, -36, 29, 88, 84, 43, -75, 77, 3, -55, -26, -16, -6, 56, 25, -16, -71, -5, -39, 67, -91, -29, -38, -51, -94, 31, 93, 96, 71, 69, 94,
+		-1, -35, -3, -13, -10, -82, -50, -80, -53, -55, -24, -26, -20, -48, 19, 55, -57, 27, 50, -72, -63, 59, 69, 88, -26, 90, -44, -81, 7, 78, -22, 25,
+		14, 47, 92, 85, -43, 22, -5, 98, 50, 36, 0, -56, -59, 59, -38, -31, -57, -7, 64, 66, 19, -77, -35, -13, 86, 65, 78, 54, -14, 2, 61, 48,
+		-29, -39, 94, -3, -15, -56, -9, 0, 55, -42, -45, 86, -2, -21, 97, 74, 3, -73, 94, -25, 36, -18, 82, -66, -8, -39, -93, 80, -34, -77, -21, -84,
+		80, -69, -39, 63, 6, 99, 9, 95, -37, 2, 96, -72, -12, -51, -17, -1, -59, -92, -76, 85, 66, 38, 9, -65, -100, 24, 88, 14, 12, 56, 90, -2,
+		14, -80, 37, 15, -84, -70, -90, -31, -71, -89, -26, 24, 34, 43, -65, -34, 64, 79, -45, 38, -68, -29, 90, 66, 43, 41, -42, -14, -96, 21, 45, 45,
+		99, 95, -98, 71, -57, 97, 85, -5, -4, -40, -45, 56, -84, 68, -62, -75, -91, -100, -49, 18, 12, -7, -83, -63, 64, 52, -15, 84, -54, -65, -55, -31,
+		-23, 30, -32, -9, 34, 17, -32, -28, -80, -47, -61, -69, -48, -57, -37, 68, 50, -87, -97, -61, -34, 3, -6, -79, -93, -64, -91, -25, 2, -86, 95, -89,
+		34, -76, 36, -81, 39, -92, -74, 37, -67, 13, -3, -50, -1, 81, 42, -85, 42, -60, 92, -57, -80, 29, 16, -61, 54, 28, 91, 98, 78, -40, -10, -55,
+		72, 72, 85, -17, -53, 88, 5, -15, 29, -79, -50, -1, -87, -36, 27, -74, -5, 4, -38, 29, 25, -27, 42, -67, 5, 83, -40, 38, -99, -34, 3, 84,
+		82, -17, 55, 29, 97, 19, -75, -65, 4, -30, -20, 39, -34, -33, -77, 41, -48, -70, -38, 48, -81, -4, -66, 7, 31, -91, -49, 83, 90, 82, 82, -20,
+		71, -12, 19, 67, 88, 90, 62, 35, -75, 81, 67, 71, 87, 85, -16, 95, 84, -89, 38, -3, -23, 14, -86, -42, 52, 3, 6, 23, -95, -95, -95, 3,
+		28, 31, 24, -74, 47, 66, 74, 99, 8, -51, 29, 21, -42, 20, 32, 78, -80, -63, 18, -45, -87, 41, 26, 8, 97, -60, -33, 56, 28, -57, 30, -38,
+		69, -1, -84, 8, -95, 44, 41, 78, 9, -13, -68, 94, 78, 86, 50, -56, 30, -50, 40, -68, 65, 93, -1, 82, -2, -9, -74, -98, -9, -80, -96, 87,
+		19, -48, 61, -45, -18, -78, -73, -73, -62, -68, 19, 6, -11, -9, -98, 9, -73, -37, 96, 16, -90, 56, 4, -70, 30, -39, -11, -80, -5, 69, 21, 49,
+		88, 23, 77, -56, 66, -58, 65, 51, -32, -83, 43, -60, 77, -3, -32, 92, -100, 40, 84, 77, -99, -2, 96, 28, -4, -74, 15, -71, 77, 11, -100, 97,
+		-62, -66, -62, 2, -59, 24, -13, 90, -49, -99, 46, 43, -41, -66, 90, -5, -97, 67, -94, 69, 10, 47, 73, -40, 12, 84, 68, -71, 72, -48, -52, 32,
+		24, 36, 78, -55, -12, -39, 78, -28, 91, -13, -65, -90, -96, 81, -10, -94, 30, -32, -85, 63, -3, 48, 77, -60, 33, -49, -30, 35, 80, -30, -20, -15,
+		-74, 10, 47, 9, 31, -74, 6, 8, 33, 66, 8, -78, -53, -8, -42, 3, 56, -60, 48, -78, -32, 95, -85, -58, 37, 83, -98, 62, -14, 70, -43, -89,
+		49, -27, 53, 20, -85, -73, -61, -23, -100, 72, -95, -49, -42, -95, -42, -18, 17, 41, -10, 28, -72, -47, 99, 53, 95, -20, -46, 77, -62, 84, -68, -11,
+		-23, 88, -62, -85, 91, 80, -45, -3, -1, 35, 35, -47, 12, 64, -5, 32, -82, -97, -50, 18, 44, -62, -47, -42, 16, -88, -7, 58, -1, -21, 11, -75,
+		-31, 80, -74, 73, -93, 22, -29, -69, 78, -56, -62, -56, -59, -39, -47, 71, 87, -48, -5, -6, 34, 37, 96, -22, 80, 30, 18, -44, -39, -15, -94, 39,
+		63, 30, -19, 27, -73, 57, 86, -97, -18, 13, -99, 64, -44, -74, 70, 6, 38, 46, 3, -39, 21, 70, -53, -49, -71, -63, 43, -97, 25, -87, 84, 64,
+		61, -44, 11, 45, 36, 40, -48, -37, -15, 11, 32, 64, 61, -34, 8, 96, -82, -18, -13, 59, 38, 29, 37, -53, 81, 98, 9, 4, -91, 43, 98, -34,
+		32, 83, 17, 31, -90, -64, 73, 16, -8, 4, 55, -35, 61, 94, -41, 31, -43, 15, 22, -59, -57, 15, -40, -90, 37, -36, -66, -41, -10, 60, -12, -56,
+		-70, 54, -89, -45, 87, -31, -78, 92, -25, 1, -63, -27, -44, -50, -65, 23, 86, 46, 3, -76, -43, 60, 31, -100, -34, -78, -72, 80, 65, 67, -73, 19,
+		53, 84, 73, -72, 29, -92, -7, -70, 9, -14, -83, -78, -96, 37, -36, -10, 75, -41, -56, -77, 14, -41, 0, 42, 84, 38, 43, -30, -42, 99, -57, -76,
+		61, -83, 76, -6, -7, 26, -42, -99, 28, 20, 57, -48, 74, -61, -39, -55, -73, -80, 88, 49, 5, -20, -71, 84, -23, -81, -94, 52, 13, -2, 16, 48,
+		-40, 8, 73, -41, -91, 17, -75, -93, -52, 87, -11, -46, 51, 32, -72, -54, -73, 38, 25, 27, 74, -19, -98, -96, 79, -93, -45, 13, -93, 9, 55, 68,
+		-18, -90, 15, -79, 59, 35, 6, 24, -66, -94, -17, 44, -51, 55, 50, 86, 77, -97, 44, -43, -26, 51, 62, -41, 40, 35, -10, 27, -84, -22, 41, 20,
+		-36, -99, -57, 35, 94, 2, 55, -4, -1, 6, -42, -97, 89, -31, -82, -35, 45, 37, 80, -86, 47, 26, -44, 58, 19, -45, 36, -9, -63, -53, 36, 90,
+		49, -100, -98, -72, 57, 86, -71, 87, -17, -12, 74, -11, 58, -45, 77, 70, -90, 95, -85, 66, 36, -64, -86, 29, -47, -38, 60, -6, -7, -21, -92, 26,
+		59, -25, 48, -56, -64, -63, 55, 91, 36, -42, -89, 50, -98, -89, -72, 47, -28, 76, 15, 64, 41, -91, -21, 82, 24, -39, -62, -46, 17, 36, -28, 97,
+		40, -30, -36, 26, -50, 89, 52, -93, 50, 50, -55, 88, -82, 67, -23, 38, -96, -99, -42, 73, 10, 90, 53, -53, 59, 47, -26, 20, -20, 34, 46, -52,
+		-22, 20, -22, 77, 7, 36, 14, -66, 47, -52, -61, -6, -59, -93, 23, -98, 17, 52, 53, -64, -42, 25, -63, 63, 51, 19, -2, 99, 34, 46, -19, -100,
+		64, -87, -1, 68, 10, -97, -67, -38, 94, -15, -70, -6, -33, -9, -18, -35, 95, 22, -14, -25, 78, -16, 0, 55, 75, 8, 7, -85, -97, 8, -68, -61,
+		-90, 86, 1, 42, -87, 14, -23, -20, 39, 57, 50, 88, 88, -82, 72, -48, -14, 81, 66, 76, -78, -89, 73, -85, 63, -86, -86, -44, -7, -7, -26, -69,
+		-66, 93, -80, 45, -95, -25, 78, 29, 69, 20, 17, -69, 38, 42, 39, -87, -23, 74, -43, 94, -13, -32, 7, -82, 60, 38, 5, 14, 81, -1, -40, 20,
+		39, -80, -17, 37, -88, 21, 66, 35, 33, -84, 8, 31, 68, 49, 7, 43, -77, 62, 96, 39, 33, -31, -47, -11, 48, -61, 44, 51, 53, 56, -34, 47,
+		85, 39, 61, 54, 24, -29, 19, -12, 13, 81, -3, 42, 65, 20, 32, 40, 38, -53, 35, 78, -51, 98, 85, -65, 99, -100, -49, 64, -60, 11, -45, -84,
+		7, -6, -80, -59, -50, -44, -68, 28, 26, -39, -13, -34, 77, 50, -42, 44, -44, 21, 89, -63, 68, -19, -37, 82, 35, 45, 35, -67, 52, 38, 31, 38,
+		67, -8, -96, -62, 2, 33, 53, -11, 64, 99, -98, 5, 38, -47, -86, 35, 25, -21, -17, -45, -51, -63, -46, -49, 12, -75, 1, -75, -24, 51, 75, -55,
+		-63, 30, 64, -55, 51, -12, 62, -30, 68, 8, -63, 15, -24, 44, -47, 64, -12, -48, -24, -92, 41, -78, -72, -53, -44, -16, -30, 35, -19, -77, 50, 53,
+		-74, -68, -39, -33, -32, 98, 11, 62, 95, -23, -94, -32, -73, -92, 75, -48, 39, 56, 20, 8, 86, -31, 65, 48, -84, -26, -70, -52, 58, 36, -36, 41,
+		81, -12, 28, 33, 20, 16, -26, -51, 33, -94, -36, -28, 21, 99, -20, 26, -14, -2, -11, -49, -90, -21, 4, -77, 82, -1, -7, 26, 42, 3, -6, -45,
+		-33, 99, 30, 14, 67, -62, -40, 48, -36, 40, -21, -28, -76, 53, 35, -69, -81, -31, -97, -44, 89, -34, -36, 96, -51, -59, 76, 47, -11, 14, 52, -46,
+		38, -16, -1, -8, -27, 34, 52, -88, -97, 70, -71, 89, -57, 6, -49, -80, -97, 75, -75, -77, -24, -36, -84, 97, 92, -35, -79, -52, 30, 46, -69, -38,
+		-28, 4, -96, 23, 31, -6, -26, -92, 49, 55, 8, -26, -80, 88, -93, 57, 65, 9, -99, -88, 18, -87, 35, -65, -5, 8, -43, 80, 36, 65, 55, -88,
+		5, -59, 15, 61, 40, 53, 5, 16, 60, -5, 60, -42, 72, -46, 2, 39, -2, 76, 93, -5, -67, -71, -92, 34, 33, -38, 60, -85, 6, 4, -3, 80,
+		6, 47, -31, -25, 60, -61, -14, -14, -22, 20, 52, 99, 98, 17, -62, -25, -39, 30, 92, -14, -9, -44, -49, -98, 80, -98, 85, 73, -13, -69, 15, 92,
+		25, 3, -65, -21, 89, 27, -33, -36, 23, 98, 14, -28, 63, 66, -100, -59, -32, -67, 70, -89, -75, -72, 50, 71, -21, -42, -1, -86, -8, 45, 20, 86,
+		-81, -95, -100, 70, 5, 83, -40, 86, 15, 64, -20, -75, 61, -25, 60, 55, -37, 47, 67, -29, -58, -2, 59, 52, 12, -8, 33, -54, 3, -22, 73, 29,
+		-20, -28, -47, 66, 31, -37, 5, -58, -30, -42, 14, 47, 15, -75, 68, -59, -4, 53, -5, 12, 52, -81, 51, 48, 97, 4, 58, -52, 21, -89, -27, -66,
+		49, -41, -89, -69, 66, -50, -31, -41, 60, -89, -79, -2, 73, 47, 37, 91, 67, -16, 81, 11, -38, -33, -40, 67, -49, 40, -2, 31, 50, -24, -8, 7,
+		-24, -32, -16, -9, 19, -100, 8, 48, 79, -74, -15, 27, -42, 66, 63, -69, 93, 79, -6, -86, 83, 75, 28, -23, -18, 69, 40, 60, -88, -91, 16, -61,
+		-82, 87, -15, -50, -56, 70, 91, -22, 36, 68, 97, 8, -82, 54, -18, 66, 68, 45, 14, 51, -92, 40, 89, 70, 54, -5, -80, -91, -50, 9, -28, -95,
+		-54, 99, 56, -25, -53, -55, 49, -85, 11, -56, -14, 3, -60, -9, 9, 1, 74, 82, 72, 90, -97, 27, -39, -47, 94, -3, -47, 41, -78, -100, 9, 49,
+		36, -13, 87, 79, -76, 10, 51, -30, 79, -67, 80, -48, -1, -56, 68, -45, 79, 41, -86, -36, 98, 90, -62, 93, -5, -36, 56, 91, -71, 19, 94, 73,
+		99, -45, -31, 51, -6, 52, -36, -30, 91, -68, 95, -23, -41, -78, -92, -40, 12, 31, 38, -85, 25, -90, -95, 71, -94, 48, 58, 47, -6, -83, -57, 49,
+		18, 14, 41, 18, 47, 74, 18, -38, 27, -26, 61, 74, 46, -82, -91, 54, 18, 55, -29, 3, 58, 82, 58, 83, -66, 76, 51, 62, 31, -88, -25, -43,
+		-38, -96, 44, -28, 80, -16, 93, -30, -4, 57, 98, -24, 30, 57, 77, 44, 82, -60, 83, -30, -6, -100, -18, -42, -7, -98, -37, 5, -42, 61, -49, 9,
+		-13, 82, -79, 94, 98, 10, 91, -48, -5, -37, 72, 99, 76, -85, -59, -15, 49, -3, -97, 22, 31, 9, 69, 76, 92, -31, -2, -57, 28, -14, 90, -82,
+		57, 28, 61, -98, 15, 38, -66, 37, 42, 52, 31, -18, -34, -56, 80, -62, 72, -46, -42, 33, -89, -95, -41, -43, 11, 1, -21, -20, 84, -42, 83, -86,
+		-72, -93, -84, -25, 28, 33, 50, 54, -88, 78, 40, -65, -57, -39, 16, -60, 37, -59, -66, -99, 76, 37, 11, 76, 64, -88, -82, -33, -45, -41, 85, -22,
+		92, 56, -73, -11, -74, -97, 43, 90, 7, -48, -5, 13, 6, 9, 94, -62, 16, 37, -79, -3, -37, 57, 83, -32, 54, -50, -44, 28, 64, -51, -53, -20,
+		-94, -36, 17, 41, -61, -25, 96, 25, 93, -84, -37, -100, 11, -24, 86, -13, -13, 68, -10, 28, -82, -37, 38, 12, 0, -73, -75, 80, 8, -41, -36, -7,
+		-97, -48, -1, 64, -91, 84, -63, 45, 73, -89, 80, -1, -1, 24, 23, 13, -1, 40, 41, -39, -6, -34, -68, 32, -52, -31, -60, -87, 47, -12, 68, 76,
+		-39, -83, 53, -61, 3, -59, 93, 36, -46, -90, -97, -63, 58, -80, 63, 78, -61, -94, -31, -98, 22, 45, -38, -33, -42, 52, -8, -3, -86, 95, -6, 56,
+		-29, 29, -85, -18, 34, -28, -5, -36, -6, -41, -25, 10, -72, 90, -23, -12, -33, 11, 97, -30, -91, 17, -42, -40, 14, 1, 58, -3, 97, -22, -30, -87,
+		58, 28, 0, -43, 49, 63, 27, -48, -85, -98, -96, -47, 44, 13, 1, 51, -65, -29, 86, -26, 9, -10, -88, -84, 16, -19, -45, -2, 39, -34, -89, -61,
+		-20, -30, 1, -38, 87, -84, -42, 87, 48, -35, -96, -65, -26, 78, 81, -42, 57, -56, -55, 72, -17, -52, 88, 95, 27, -72, 57, -72, 99, -26, -10, 44,
+		14, -31, -78, 91, 6, -84, 3, -22, 15, 74, 59, 3, 2, 44, -88, 84, -1, -35, 57, 43, -69, 1, -67, 43, 19, 12, -37, -1, 66, -81, -15, 59,
+		32, 41, 34, 18, -3, 37, 75, 98, -35, -6, -87, -100, -65, -100, -11, 39, 49, -94, -7, -94, -35, -78, 43, 95, 84, -12, -18, -76, 46, 76, 86, 79,
+		-18, -75, -96, -58, -18, 53, 6, -48, -52, 12, 34, 34, 3, 91, 44, 10, 82, -59, 29, -30, -83, -16, 53, 93, -77, 67, 59, -75, 3, 70, -67, -41,
+		83, -25, 75, 26, 66, -76, 7, 81, 17, 1, -29, 93, -94, -25, -83, -69, -5, 10, 13, 77, -22, 97, 6, -87, -75, -75, 8, 38, 84, 16, 73, -30,
+		64, -33, 4, 37, -48, -30, 56, 42, 85, 42, -74, 64, -18, 52, 92, -78, 78, 10, -2, -16, 93, -20, -91, -64, 54, -36, -68, 82, -65, -25, -45, -52,
+		13, -32, -56, 26, -77, 79, -32, -94, -23, 6, -13, 53, 16, -88, 51, 45, 33, -29, -51, 8, -20, 88, -84, 26, -27, 62, 22, -7, -76, 3, -43, -96,
+		-93, -64, -75, 56, -48, -65, -84, -91, -66, 71, -63, 26, 87, 10, -34, -90, -65, -56, -63, -46, 60, 76, 60, -85, -59, 42, 21, -77, 98, 66, -39, 62,
+		43, 81, 27, 12, 29, -1, 42, 40, 30, -62, 68, -30, 50, -89, 21, -78, -33, -56, -7, -50, 20, 57, 68, 18, -30, -25, -60, 44, -70, 34, 61, -74,
+		70, 63, -90, 35, 17, 30, 85, -80, 92, -22, 55, 11, -89, -58, 62, 30, -64, -2, -79, 36, -8, 79, -87, 4, -97, -45, 28, 62, -35, -31, 83, -49,
+		85, 15, 72, -16, -69, 43, 82, 38, 2, -5, -84, -9, -67, 61, -64, 46, -9, -28, -23, -33, 28, -31, -49, -90, 41, 75, 26, -63, -48, -70, -36, -27,
+		50, 11, 73, -13, -86, 71, 29, 59, -94, -94, 2, -20, 8, -77, -38, -73, -8, -99, 27, -54, 57, 33, -97, 52, -7, -45, 16, -71, -9, -73, -95, -84,
+		-53, 49, -95, 48, 69, 69, -73, -93, 56, 68, 58, -29, -87, -23, -94, -97, 72, 67, -97, -21, -80, -85, -65, 68, -55, 41, 43, -11, -44, 87, 28, -42,
+		96, -48, -46, -52, -61, -75, 25, 2, -39, 58, 50, -86, -7, 41, -7, 70, -29, 75, 65, -65, -70, 93, 86, 89, -4, 37, 49, 12, -65, 65, 2, 54,
+		-14, -94, -19, 81, 33, -99, 84, -12, 7, 70, -29, 31, -84, 22, 94, 61, -96, 97, -62, 44, -83, 69, -77, 78, -1, 76, 72, 15, -1, 84, -35, -64,
+		62, -44, -87, -58, 83, 30, -48, 70, -74, -39, 51, -61, 43, -85, 88, -16, -36, -67, -61, -78, 95, 87, 53, -23, -85, -86, 81, -36, 83, 96, 26, 29,
+		-93, -33, 19, 7, -16, -26, -25, -5, -43, 40, -69, 93, 63, -89, 91, 35, -40, -7, 1, 71, -80, 66, 38, -42, -50, -16, 74, -87, -99, -71, 87, -52,
+		-42, 67, 22, -7, 9, 67, -78, 73, -49, 27, -91, -45, -18, -16, -40, 44, 74, -1, -45, 88, -47, -41, -33, 45, 92, 48, -65, -7, -98, 45, -98, 73,
+		80, 52, -29, -69, -35, 97, 94, -42, 62, -11, -93, 68, 85, 27, 17, 14, -77, 10, 43, 28, -9, 10, -57, 43, 64, -49, -3, -11, 8, -83, -6, 26,
+		94, -19, -87, -69, 92, -5, 27, -33, -42, -57, 69, 6, 76, 87, -85, 51, 88, -85, 73, -37, -42, -92, -28, -53, -19, 18, 35, 49, 6, 13, 16, 34,
+		-78, -12, -90, 50, -18, -62, 60, 24, 39, 50, 11, 77, -43, 62, 14, 55, 90, -88, 45, 31, 5, 11, -78, 16, 21, -49, 32, 95, 54, -52, -47, 22,
+		-16, 6, 57, 91, -44, -22, -20, 6, 54, -42, -100, 63, 57, 60, -71, -84, 90, 52, 32, -68, 73, 78, 8, 2, -33, 21, -97, 12, 73, -92, 75, 26,
+		-98, -97, -96, 78, -53, 85, 8, -55, -8, -18, 22, 40, -42, -15, 47, 34, -11, 45, -85, 15, 69, -16, -56, 41, -35, 86, -37, -66, 42, -61, -18, -10,
+		40, -37, 90, -69, 86, 12, -82, 92, -58, 99, -32, 74, -5, 20, -71, -46, -58, -38, -89, -71, 94, 66, -40, 98, 41, -56, -27, -33, 72, -53, -86, 13,
+		81, 86, 16, -28, -10, -33, -9, -96, -35, 17, 3, 89, -19, 41, -78, 80, -29, 56, 93, 60, 39, -50, -31, -60, -81, -76, -44, -58, 58, -13, 78, -33,
+		48, 20, -50, 18, -33, 87, -60, -9, -60, 44, -71, 13, 16, 52, 61, -58, -10, -29, -86, 90, -99, -35, -98, 91, 69, 56, -29, 30, -74, 74, -76, 78,
+		-17, 11, -42, -66, 26, 99, 20, -2, 38, -92, 26, 78, 51, 89, -69, 41, -65, -56, -54, 53, -77, -8, -10, -2, 77, 29, 42, 11, -51, -93, 61, -15,
+		40, -10, -41, -16, 83, -49, 50, -40, 81, 92, 10, 48, -52, 27, -9, 13, -83, 84, 81, -45, 75, -61, 79, 41, 48, -3, 16, -92, 30, -7, 23, 1,
+		22, -100, -84, 40, 11, 25, -60, 68, -26, 23, -10, 2, 69, 28, 48, 86, 75, 30, -59, -34, 64, 0, 44, 36, -6, 1, -82, 55, -30, 76, 67, 61,
+		-27, -97, 82, 1, -72, -63, 87, 36, 19, 65, -47, 34, -16, -77, 1, -3, 94, 63, 7, -79, 33, -56, 44, 35, -14, -73, 76, 59, 59, -96, -43, 3,
+		-88, 68, 73, -97, -15, 14, -55, -71, 5, 8, -34, 39, -16, -43, 47, -41, 64, -14, 96, 53, -76, 96, -46, -52, -97, 67, 54, 52, 9, -51, -71, -86,
+		99, 73, 22, 90, -31, -29, -11, -6, -12, 86, -25, 76, 25, 89, 85, -84, -69, -2, 59, -75, -3, 83, 61, -62, 99, 51, 65, 23, 99, 74, 81, -93,
+		-16, -60, 86, 55, 28, -90, -79, 34, -24, 13, 27, 62, 6, 4, -95, -40, -10, -54, 5, 39, 17, 60, 98, 18, -57, -42, 10, -36, -83, 96, 30, -86,
+		36, -49, -63, 9, -90, -89, -74, 21, -24, -16, -21, 0, 58, -38, -89, 40, 61, -6, -79, -22, 30, 88, -88, 30, 46, 57, 17, -4, -95, -37, 62, -53,
+		65, 16, -87, 94, 6, 80, -3, 7, 25, 79, 2, 63, 87, 23, 15, 30, 32, -62, -10, 84, -62, -58, -57, 85, 46, -37, -57, -46, -62, 44, -93, 83,
+		-99, -25, -4, -33, -82, 42, 28, -53, 65, 75, 22, -92, -34, 95, 1, -13, 11, -54, -5, 8, -17, -94, 23, -52, 33, -55, 56, 17, 56, 28, 14, 1,
+		77, -47, 34, -99, 80, -25, 9, -66, 61, -19, -1, -20, -53, 31, -25, 30, -74, 34, 99, -41, 10, -25, 49, -48, -39, -32, 89, 75, -10, 54, 53, 14,
+		46, -79, -2, -46, -18, 37, -45, 83, -56, 77, 11, -38, 2, -94, -40, 86, -80, -83, -23, -78, 34, -39, 45, -88, 20, 66, -29, -44, 0, -66, -40, -72,
+		-32, 16, 28, 14, 72, -95, -9, 64, 67, -75, 46, -33, -8, 84, 52, -48, -1, -33, -7, -18, -85, 52, -17, -69, 79, 58, 80, 8, -76, -36, 53, -37,
+		18, -92, -71, 63, 40, 55, 70, -53, 93, 41, 10, -13, 59, -70, 61, -83, -87, 80, 20, 54, 71, 97, 56, 8, 57, -53, -76, 83, -43, -33, -21, -96,
+		0, 84, 9, -56, -67, 48, 92, 43, -48, 28, -19, -73, -43, 75, -2, -92, 64, 69, 70, 30, -68, 70, -79, 35, 95, 72, 16, -70, 62, 12, 57, -83,
+		60, 56, 13, 83, 20, 84, 99, -49, -33, -40, -10, 21, 81, 99, 45, 14, 98, -3, -75, -24, 38, -81, -49, -40, 74, -38, 68, -97, -85, 97, 20, -92,
+		-56, -10, 75, -75, -8, -24, -48, -80, 78, -74, -29, 97, 31, 84, 34, -99, 21, -45, 4, -74, -3, -85, -30, 39, -17, 73, 13, 54, 57, -39, 61, -38,
+		-43, -47, 15, -7, 57, -87, -92, -98, -23, 30, 18, 65, 51, 56, 26, -64, -53, -99, -53, -46, 86, -28, 93, -90, 46, 35, -33, -87, -54, -52, 52, -39,
+		17, -15, 6, 58, -85, -35, -9, 3, -86, 74, -34, 22, -98, 26, -15, 69, 24, 30, 79, 28, 85, -72, -94, 79, 51, 55, 13, 18, 81, 48, -90, -58,
+		-82, -2, -1, -32, 27, -83, 93, 92, 6, -64, -27, -87, -94, 96, 8, -29, 46, -100, 74, 11, -96, 54, -94, -39, -92, -36, 21, 70, -79, -93, 74, -52,
+		-11, 73, -62, 34, -69, 99, 73, 48, 79, -24, -22, -83, 28, 12, 21, -16, 10, -41, 46, 10, 75, 1, -77, 15, -61, -78, -33, -85, 37, -27, -96, -71,
+		8, -29, 79, -48, 9, -35, 44, -20, -100, 10, -100, -47, -80, -49, 56, -28, 23, 20, 40, 65, -27, 66, 21, 24, 14, 2, 48, -8, -82, 35, 84, 89,
+		60, -70, -2, -39, -54, 14, -21, -39, 62, 72, 0, -13, -5, -78, 70, -46, -83, -70, 1, 57, -41, 65, -96, -58, -77, 8, -94, 85, -59, 49, 86, 96,
+		4, -9, -51, -78, 1, -49, -57, 90, -43, -2, -100, -53, -20, -61, 89, -70, -13, 14, -58, 70, 37, -45, -81, -84, -65, 90, 44, 45, -88, 34, 98, -4,
+		-49, -100, -35, 79, 51, 5, 1, 63, 71, 39, 13, 5, -56, 69, 42, -25, -22, -94, -66, 24, 94, -41, 78, -62, -31, 44, 27, 6, 37, 79, -83, 60,
+		-3, 12, 80, -63, 97, 27, 80, 43, 85, 63, 93, -6, 72, 32, 97, -22, 59, 6, 27, -89, -10, -41, 21, 82, 66, -36, 49, -48, 73, 86, 77, -17,
+		26, 24, 31, 60, 33, 28, -79, 61, -21, 52, -54, -93, -35, 53, 81, 42, -60, -66, 65, 52, 69, 86, 74, 7, 81, 62, 6, -57, -91, 51, -88, -86,
+		90, -43, -38, -68, 71, -97, -62, 37, -81, -47, 2, -59, -77, -74, 74, -53, 13, 62, -56, -3, 1, 38, 11, -57, -50, -5, -7, -62, -63, -60, -48, -98,
+		-11, -61, 82, -30, -90, 63, 85, -31, 4, -99, -7, -25, -15, -24, -86, 7, 3, -72, -5, -11, 42, -38, -75, 38, -17, 33, -41, -46, 77, 66, 84, 17,
+		-99, 6, -75, -70, -96, 50, -7, -48, 73, -47, -29, -31, 4, -90, -32, -96, 77, -27, -39, -11, 18, -31, -21, -56, 86, -25, -87, -61, -71, -5, 80, 90,
+		9, -46, 89, 37, -64, 16, 59, -2, -61, 19, -63, 53, -82, -52, -84, 29, -35, -69, -71, 31, 63, 30, 54, -10, 28, -31, -65, 54, 54, -62, -8, 92,
+		89, 21, -34, -89, 37, -4, -74, -73, -77, 76, 92, -13, 31, 78, -46, 51, 75, 17, -28, -22, -25, -81, -59, 62, -80, 20, -36, 53, 48, -59, 5, -6,
+		-46, 52, 24, -20, 43, 70, 58, -1, 17, 68, -32, -9, 4, -43, -58, -35, -9, 99, 67, -100, -61, -10, 23, -34, -81, 8, 23, 37, 18, -77, 15, -70,
+		43, 37, -51, 58, 61, -50, 95, -40, -98, -64, 2, 41, -14, 81, -84, -25, 3, 62, -14, -98, 6, -82, 22, -32, 84, -98, 85, -62, 53, -25, -92, 88,
+		89, 7, -33, -15, 93, 85, -31, 70, 74, 94, -46, 37, 36, -32, -51, -53, -7, -74, -19, 36, -2, 81, -44, 84, -67, 22, 72, 37, 53, -80, 42, -61,
+		-5, 71, 34, -51, -65, 85, 91, 4, -98, -41, 42, -15, -73, 79, 41, -8, 99, 99, 74, 5, -94, 59, -87, -73, -63, -50, -29, -13, 46, 58, 5, 58,
+		-50, 50, -54, -65, -3, -89, -48, -42, 14, 96, -22, -79, 70, -49, 32, -76, -24, 99, -77, 94, 35, 54, -24, -92, -40, 48, -78, 46, 73, -63, -74, -87,
+		91, -32, -81, 80, 80, 0, 48, -2, 27, -86, -97, -87, -31, 61, -92, 49, 57, -63, -15, -52, -72, -91, -47, -88, 0, 39, 9, -85, 70, -24, 80, 69,
+		-15, 78, -64, -39, -61, 34, 4, -47, 77, -25, 65, -19, -96, 69, 58, -99, -46, 58, -62, 98, -32, 26, -23, -66, 49, -56, 39, 0, 9, 50, -60, -96,
+		29, -16, -50, 21, -20, 61, 37, -47, 3, 13, -74, -5, 11, -69, 79, 44, 1, 63, 69, 22, -74, -26, -6, -26, 64, 70, 80, -88, -7, -42, 28, 97,
+		-30, 62, 65, 35, 73, -27, 10, 27, -12, -61, 40, -55, 76, -42, -80, -33, 52, 32, 42, -30, 68, -62, 60, -59, 95, -69, -73, -15, 29, -43, 11, 92,
+		17, -64, 39, -75, 98, 96, 99, -87, 77, 48, 31, 85, -59, -100, -87, 94, 8, 11, -79, 48, 38, -63, 29, -69, 91, -39, 60, -68, -14, -91, -81, 53,
+		-6, 84, -14, 47, 79, 58, -5, -98, -81, -85, -31, 60, -30, 53, -85, 23, 62, 69, 79, -9, -94, -92, -16, 74, -25, 84, 20, 43, 52, 8, 31, 66,
+		-20, 99, 23, -22, -49, 60, -49, -82, -16, -100, -36, -16, -71, -14, -3, -56, -51, 22, 57, -35, -73, -11, 67, -43, 17, 41, -93, 53, -79, -4, -47, 96,
+		5, 15, -17, 31, -33, 55, -61, 8, 77, 91, 62, -45, -95, -8, -17, -96, -7, -39, 65, 66, 23, 1, -66, -87, 11, -55, -49, -35, -9, -31, 86, -26,
+		40, -64, -44, -81, -41, -31, -2, 56, -36, -68, 4, 57, 98, 10, -56, -2, 31, -22, -1, 18, -45, -82, 4, 93, -91, -34, -39, -35, 1, -21, -1, 29,
+		-68, 73, 61, -99, 56, 27, -26, -55, 40, 82, -51, -29, -9, 9, -24, 5, -85, 34, -5, 55, 78, -58, -84, 30, 96, 77, -42, 5, 26, -30, 94, 45,
+		-90, -58, 58, 15, -29, 13, 17, 11, 93, 76, 71, -46, -72, 85, -52, -94, 57, -31, 79, -51, 20, -2, 57, 93, 5, -38, -9, -46, -20, 89, -8, 7,
+		98, 58, -68, 34, 72, -8, 69, 7, 80, -2, 40, 70, -28, 39, -94, -34, -72, -53, 24, -86, -18, -41, 8, 39, 53, -12, -18, -80, 37, 46, -64, -3,
+		29, -29, 8, 72, 45, 41, -6, 94, -11, 57, -99, 5, 16, -39, -78, 96, 33, 81, 22, -29, 51, 19, 82, 42, -54, 67, 29, 21, -27, -45, -67, 65,
+		52, 30, 15, 1, -27, -52, -90, 24, -50, 2, 72, -3, 25, 95, 81, 26, -79, -29, -92, 69, 40, -52, -10, -45, -46, -2, 68, 16, -85, 47, 68, -74,
+		7, 66, -33, 17, 50, -76, -36, 13, 49, 86, -62, 3, 98, 7, -29, 74, -19, -24, 10, -25, 36, -77, -24, 96, 92, 19, 99, -76, -62, 67, 94, -21,
+		1, 87, -36, -31, -82, -76, -59, 31, -27, 18, -97, -11, -30, -43, 49, -79, 56, -25, 72, -37, -79, 8, 48, -28, 10, -46, -97, 1, -79, 97, 90, 28,
+		-95, -57, -65, 31, -38, -24, 52, -4, 30, 92, 51, 91, -87, 61, -100, -59, 0, 77, 30, 2, -80, -11, 94, 72, -58, -31, -97, 35, 17, -4, -1, -44,
+		-37, -30, 49, 36, -74, 36, 82, -83, -90, 35, 50, -32, -94, -84, -41, 56, 41, 48, -18, 72, -46, 41, -32, -18, -14, 29, -10, 9, 92, 43, 46, -74,
+		93, -99, 89, 1, -70, 48, 58, -81, -93, 17, 39, 62, 90, -41, -92, 87, 30, 19, -83, -66, -84, 63, -82, 27, 93, 31, -30, 79, -98, 13, 64, 94,
+		-23, -98, -40, -71, 42, -31, -91, -25, -6, -10, -84, -9, -41, -50, -57, 74, 97, 21, 40, 88, -78, -94, -19, 39, 62, 84, -52, -7, 7, -85, 95, -94,
+		-90, 30, -57, 29, -49, -43, 41, -54, -17, 49, -60, 66, -82, -38, -7, 18, 52, -29, 49, 62, 6, 11, 80, 26, 35, 73, -50, 26, -45, 74, 78, 17,
+		-32, 56, -18, 71, -34, -40, 94, 41, 44, -66, -19, -55, 10, 55, 6, -26, -5, 14, -93, 19, 66, -25, -17, 67, 50, 22, -48, 75, -48, -67, -71, -64,
+		73, -50, -20, -19, -11, -34, 23, 11, -43, -71, 29, 29, 28, -67, -58, -60, -22, -99, 99, -44, -77, 72, -74, 73, -76, -10, -96, -4, -75, -85, -62, -100,
+		31, -74, -84, -62, -33, 68, -38, -42, -26, -9, 22, -78, -10, -36, 1, -29, 38, 90, 91, 74, 83, -95, 26, 94, 23, 35, -7, -76, 67, 6, 33, 84,
+		7, 14, -88, -22, 12, 0, -75, -9, -38, 29, -3, -90, -34, 79, 47, 69, -31, 42, -59, -78, 52, -1, 8, 42, 52, -14, 49, -59, -26, -63, -23, 35,
+		84, -58, -20, -29, -21, -87, -3, -90, -1, 23, -70, 31, -19, -7, 2, 32, -49, 29, 53, 35, 86, -68, -59, -69, 71, 52, 5, -76, 38, 12, 82, -98,
+		-19, -87, -58, 45, -57, -98, -64, -98, 16, -46, -89, 89, 34, -26, 58, 80, 30, 87, -41, -83, -1, 55, -87, -2, -55, -5, -50, -56, -25, -39, -8, -3,
+		51, 59, -4, 68, -65, -65, 39, -89, 46, -86, -91, 69, -20, -9, -61, 13, 67, 90, -33, 85, -8, -3, -80, -79, 65, -20, 97, -23, 3, -74, 18, -61,
+		-97, -37, -82, 50, -14, 48, 94, -84, 60, 38, 81, -63, -68, -38, -88, -77, 36, -97, -24, 38, 2, -19, 29, -83, -62, -81, 56, 10, -70, -22, -85, 18,
+		-47, -91, -46, -38, 92, 28, 40, -2, 96, -93, -26, 44, -3, -28, 85, 32, 50, 44, 68, 18, -34, -44, -69, -76, 64, 60, 15, -33, -36, 55, 17, -55,
+		-54, -67, 2, 4, -90, 20, -71, 12, -27, 34, -27, -77, -40, 82, -48, 2, 86, 64, 90, 95, 90, -17, 13, 43, -98, 35, 64, 52, 72, -97, -3, 83,
+		-45, 58, 88, -32, 87, 10, -64, -28, -41, -75, 97, 7, 69, -54, 15, -99, -89, 36, 73, -3, 88, -12, -32, -23, -24, 98, -83, -45, -32, -1, -9, -49,
+		10, 76, -22, 26, -76, -100, 27, 63, -67, -46, -39, -91, 1, 4, 11, 3, 68, 91, 24, -1, -4, -70, -97, -86, 0, -3, -17, 38, -80, -51, 51, -95,
+		85, 18, 76, 59, 5, -27, -6, 65, 37, -67, -48, -98, 32, 7, 12, 15, 81, -65, -8, -75, 72, -97, -77, 75, -88, 90, -78, 70, 8, -10, 88, 51,
+		-80, -82, -79, 5, -50, -22, 31, -79, 1, -87, -12, 45, 71, 82, 91, -100, 42, 34, -84, 59, 37, 54, 1, -21, 19, -98, -73, -98, -84, -94, 11, 95,
+		-35, 67, -83, 61, -55, -20, -75, -30, 94, -71, -41, -14, -66, 46, 36, -75, 89, -82, 73, 40, -70, 72, 39, -31, 6, 92, 81, -95, 57, 76, 90, 8,
+		16, 5, -21, 52, -95, -18, 82, 43, -63, 32, 49, -82, 40, -10, -83, -50, -11, 20, 15, -31, 13, 26, 15, 51, -18, -85, 23, -91, -39, -32, 94, 96,
+		-38, 41, -7, -65, 2, -23, 66, -99, 88, 21, 52, 18, -36, 5, -19, -98, 67, -24, -59, 8, -87, -66, -33, 74, 70, -97, -39, 90, -88, 13, 82, 96,
+		-97, -82, -8, -21, 66, 43, 73, 85, -96, 89, 91, 92, -82, 0, -30, -63, -2, -93, -23, 78, 27, -82, -91, 3, -56, 88, -20, -74, 34, -58, -78, 50,
+		43, 70, -23, 22, -57, -16, -33, 17, 26, 73, -79, 49, -14, -82, 99, 32, -90, 22, -7, 25, -71, 36, -97, 16, -89, 39, 42, 55, 27, -74, 61, 96,
+		-22, 80, -17, 62, -47, -99, -38, 48, -16, -13, -100, 96, -94, 12, -60, 40, 69, -33, 10, 69, 84, 73, -50, -4, -74, -49, -60, -50, -44, -1, 89, 46,
+		87, -42, -24, -35, -50, -7, 54, 16, 67, 82, 4, -87, -70, 8, -23, -87, -30, 50, 91, 38, 24, -38, 40, 93, -80, 3, 94, 17, -53, 62, -11, -57,
+		30, 44, 42, 73, 70, 50, 19, -59, 90, 8, 11, 94, 26, 47, 31, 9, -93, -57, 88, 50, -61, -99, 92, 68, 29, 77, -90, 4, 56, 31, -30, -44,
+		-12, 28, 37, 25, 92, -74, 60, 56, 19, -71, -14, 18, 59, 47, -98, 18, 11, 11, -21, -19, 0, 15, 75, 65, -42, -89, 11, 68, 67, 77, 76, -68,
+		12, -76, -68, 56, 71, 75, -72, -9, 13, -72, 59, -27, 44, -26, -47, -2, 70, -12, 50, -85, -84, 55, -82, 29, -82, 18, -79, -57, -34, 25, -16, -46,
+		-48, 52, -40, -69, -82, 85, 78, 29, 25, 6, -38, -15, -45, -75, 72, 48, 47, 85, 6, -4, 22, -74, 80, 73, -56, -18, -54, 87, -68, -81, 58, 12,
+		61, -96, -99, 30, 61, 71, 89, -49, 58, 5, 84, -85, -65, -42, -36, -13, -34, -93, 88, 42, -83, -65, 33, 94, -6, -50, -77, -25, -14, 16, -98, -64,
+		95, -3, -27, 83, 6, 22, -43, 63, -72, -32, 30, -13, -70, 61, 46, -82, -37, 38, 87, -64, -87, 81, 57, 81, -65, 83, -4, -91, -24, -82, -15, -84,
+		58, 54, -74, -56, -26, 72, -6, 66, -12, 89, 71, 71, -56, -32, 5, 92, 35, -29, -35, -5, -29, 51, 27, -92, -97, -24, -37, 52, -55, 23, 22, -57,
+		4, -3, -80, -82, -13, 40, 87, -31, -45, -81, -99, 55, 62, 66, -8, 95, -62, 28, -59, 71, 7, -55, -57, -68, -99, 7, -35, 99, 41, 22, 29, -16,
+		-25, 44, 98, -7, -47, -6, -76, 16, 13, 12, -57, 11, 5, 38, 61, -82, 97, 20, -48, 87, -41, 23, -1, 30, 30, 93, 7, -37, 48, -67, 42, -97,
+		94, -83, 14, 30, -71, 77, 87, 75, 17, -80, 73, -20, -92, -27, -63, 85, 79, 79, 67, 34, -97, -15, 91, -74, -11, 14, 81, 82, -91, 39, 6, 1,
+		-78, -46, 72, -90, -66, -13, -83, -53, -2, 28, -64, -66, 97, 80, 4, 57, 27, 41, 34, -87, -67, 44, -58, 37, -39, -70, -82, -76, -95, -70, 95, 21,
+		-88, 76, -43, 49, 21, 50, -49, -86, 59, 81, -70, -92, -9, -33, 33, -48, -45, -31, -87, -10, 97, 64, -42, 36, -2, 25, -30, -26, -55, 23, -100, 41,
+		87, -68, 25, -46, -1, -2, 82, 94, -23, -18, -68, -61, 53, -38, -7, 79, -81, -73, 57, -13, 2, 77, 17, -44, -61, -26, 55, 47, -92, 15, -17, -96,
+		-14, 50, 71, 79, -62, 13, 89, 80, 47, 3, -44, -83, 16, 9, 87, 61, 12, 64, -19, 98, 31, -11, -27, 98, -8, -94, 96, -95, 92, -2, -75, -15,
+		-47, -76, -60, 85, 96, 72, 78, 67, -88, -10, 36, 23, 19, -37, -57, 11, 43, -73, -39, 46, 22, 6, 24, 46, -53, 31, -22, -74, -19, -47, 2, -56,
+		14, -25, 57, -79, -31, -49, -32, -44, -42, 36, -9, 75, -31, -7, -54, 41, -59, -56, 68, 26, 88, 80, -19, 77, -26, -40, -61, -81, 5, 80, 35, -56,
+		-30, 36, -77, -1, -99, 66, 31, -71, -99, 56, 99, -35, -30, 25, -62, -84, -53, 12, -25, 49, -70, 16, -79, -46, -37, -10, 61, 37, -59, -81, -29, 78,
+		90, 23, 0, 3, -3, -71, 60, 56, -50, -63, 89, -55, -11, 34, 59, -36, 5, 60, -72, -46, 64, -92, -68, -90, 37, -15, 32, -80, -95, 28, -64, -3,
+		-37, 28, -4, 3, 51, 37, -75, -71, -99, -58, -42, 31, 85, 71, 47, -63, 49, 79, -83, -96, -24, 91, -21, -27, -47, -10, 28, 96, 81, -79, 10, -98,
+		-69, -87, -58, -72, 36, 85, 50, -56, -75, -34, 2, 87, 51, -92, -65, -21, -56, 71, -92, -61, 50, 89, -46, 12, -10, -68, 9, -58, -99, -3, 91, -56,
+		-11, 96, -93, -71, -51, -58, 21, 13, -41, -30, 67, -40, 39, -90, -20, -59, 35, -41, -31, 1, 45, -19, 92, -34, -92, -76, -20, -81, -57, 2, 34, -71,
+		-85, 30, -29, 89, -16, -35, 8, -86, -13, -44, 13, -19, 47, 57, -46, 25, -54, 70, 9, 65, 52, -77, 18, 83, -14, 80, -50, -60, 78, 48, -43, -65,
+		15, -9, 94, 83, 17, 72, -90, -94, -52, -29, 67, -13, -54, 75, -90, -15, -22, -36, -59, 4, -25, 61, -21, -72, -56, -24, -42, 51, -30, 37, 35, 24,
+		29, 79, 37, 85, 47, -11, 48, 89, 9, -76, 44, 26, -37, -86, 8, 5, 8, 49, -61, -91, 83, 21, 22, 66, -59, 33, -18, -8, 90, 79, -86, 26
+	},
+	.bias_0 = {
+		6, -6, 1, -2, -5, -16, 17, 4, -23, -12, -14, -10, 14, -6, -4, -3, -10, -1, -3, 14, -1, -6, -13, -4, -6, -2, -9, -3, -1, -7, -1, -3,
+		12, 0, -2, -10, -17, -7, -15, -11, -14, -1, -12, -16, 4, -2, 12, -19, -4, 5, 3, -3, 11, -4, -4, 0, -3, -12, -1, 10, 5, -1, -14, -12,
+		-5, -2, 5, -2, -3, 0, 3, -1, -13, -13, 8, 16, -5, -4, 2, -9, -3, -1, -5, -9, -3, -7, 10, -1, -2, -3, -21, -5, -10, -21, -8, 15,
+		1, 2, -4, -2, -8, -10, -3, -9, -3, -10, 12, -3, -8, -1, 8, -18, -1, -2, -2, -4, -12, -20, -6, 0, -1, -7, -6, -7, -6, -8, -1, -5,
+		-1, -8, 0, 5, 5, -5, 11, -10, -2, -3, -17, -25, -3, -16, -12, -4, -5, -1, -1, -23, -8, -5, 2, -2, -13, 0, -16, -6, -13, -9, 7, 0,
+		4, -1, 11, -10, 10, 10, -7, -9, -4, -10, -1, -9, 8, 3, 63, -2, 0, 0, -3, 1, -5, -2, -10, -1, -4, 11, -1, 0, 2, -1, 1, -8,
+		-12, -6, -7, -23, 2, -18, -10, -9, -11, -1, -1, 4, -5, -7, -4, -18, 18, 14, -4, -15, -1, -9, -3, -5, -1, -10, -2, -1, -1, 9, -10, -6,
+		4, -1, -8, -2, -9, 0, -18, -2, -12, 0, 1, -8, 0, 4, 4, -2, 6, -46, 12, -11, -1, -10, 1, -52, -5, 9, -8, 11, 0, -1, -23, 0
+	},
+	.bias_M_1 = {
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0,
+		1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0
+	},
+	.bias_M_2 = {
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+	},
+	.bias_1 = {
+		{ 668, -402 },
+		{ 2, -1 },
+		{ 0, 0 },
+	},
+	.requant_mul = { 2763320, 49479, 24216 },
+};
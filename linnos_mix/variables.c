@@ -49,6 +49,9 @@ hipFunction_t batch_linnos_mid_layer_1_kernel = 0;
 hipFunction_t batch_linnos_mid_layer_2_kernel = 0;
 hipFunction_t batch_linnos_final_layer_kernel_persistent = 0;
 hipFunction_t batch_linnos_mid_layer_kernel_persistent = 0;
+hipFunction_t batch_linnos_q8_final_layer_kernel = 0;
+hipFunction_t batch_linnos_q8_mid_layer_kernel = 0;
+hipFunction_t batch_linnos_q8_mid_layer_m_kernel = 0;
 hipCtx_t hipctx = 0;
 
 CUdeviceptr d_input_vec_i_cuda;
@@ -61,6 +64,9 @@ CUfunction batch_linnos_final_layer_kernel_cuda = 0;
 CUfunction batch_linnos_mid_layer_kernel_cuda = 0;
 CUfunction batch_linnos_mid_layer_1_kernel_cuda = 0;
 CUfunction batch_linnos_mid_layer_2_kernel_cuda = 0;
+CUfunction batch_linnos_q8_final_layer_kernel_cuda = 0;
+CUfunction batch_linnos_q8_mid_layer_kernel_cuda = 0;
+CUfunction batch_linnos_q8_mid_layer_m_kernel_cuda = 0;
 CUcontext cuctx = 0;
 
 long *inputs_to_gpu = 0;
@@ -69,6 +75,7 @@ long *gpu_outputs = 0;
 //these are host
 long *multi_inputs_to_gpu[NUMBER_DEVICES][MAX_DEV_BATCHES];
 long *multi_gpu_outputs[NUMBER_DEVICES][MAX_DEV_BATCHES];
+struct lake_batch *multi_batches[NUMBER_DEVICES][MAX_DEV_BATCHES];
 
 hipDeviceptr_t multi_d_input_vec_i[NUMBER_DEVICES][MAX_DEV_BATCHES];
 hipDeviceptr_t multi_d_mid_res_i[NUMBER_DEVICES][MAX_DEV_BATCHES];
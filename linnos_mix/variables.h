@@ -51,6 +51,14 @@ struct GPU_weights {
     long *weights[8];
 };
 
+//device copy of a struct linnos_q8 (predictors_q8.h) and its fields
+struct GPU_weights_q8 {
+    void *model;
+    void *weight_0_T, *weight_1_T, *weight_M_T[2];
+    void *bias_0, *bias_M[2], *bias_1[3];
+    int requant_mul[3];
+};
+
 extern hipDeviceptr_t d_input_vec_i;
 extern hipDeviceptr_t d_mid_res_i;
 extern hipDeviceptr_t d_mid_res_1_i;
@@ -63,6 +71,9 @@ extern hipFunction_t batch_linnos_mid_layer_1_kernel;
 extern hipFunction_t batch_linnos_mid_layer_2_kernel;
 extern hipFunction_t batch_linnos_final_layer_kernel_persistent;
 extern hipFunction_t batch_linnos_mid_layer_kernel_persistent;
+extern hipFunction_t batch_linnos_q8_final_layer_kernel;
+extern hipFunction_t batch_linnos_q8_mid_layer_kernel;
+extern hipFunction_t batch_linnos_q8_mid_layer_m_kernel;
 extern hipCtx_t hipctx;
 
 
@@ -76,6 +87,9 @@ extern CUfunction batch_linnos_final_layer_kernel_cuda;
 extern CUfunction batch_linnos_mid_layer_kernel_cuda;
 extern CUfunction batch_linnos_mid_layer_1_kernel_cuda;
 extern CUfunction batch_linnos_mid_layer_2_kernel_cuda;
+extern CUfunction batch_linnos_q8_final_layer_kernel_cuda;
+extern CUfunction batch_linnos_q8_mid_layer_kernel_cuda;
+extern CUfunction batch_linnos_q8_mid_layer_m_kernel_cuda;
 extern CUcontext cuctx;
 extern long *inputs_to_gpu;
 extern long *gpu_outputs;
@@ -96,6 +110,9 @@ extern hipDeviceptr_t multi_d_final_res_i[NUMBER_DEVICES][MAX_DEV_BATCHES];
 
 extern long *first_weight_ptr_to_dev[NUMBER_DEVICES];
 
+struct lake_batch;
+extern struct lake_batch *multi_batches[NUMBER_DEVICES][MAX_DEV_BATCHES];
+
 extern CUstream cu_streams[NUMBER_DEVICES][MAX_DEV_BATCHES];
 
 #endif
\ No newline at end of file
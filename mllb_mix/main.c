@@ -34,6 +34,7 @@
 #include <linux/ktime.h>
 #include <linux/vmalloc.h>
 #include <asm/fpu/api.h>
+#include "lake_pk.h"
 #else
 // if userspace
 #include <stdint.h>
@@ -424,6 +425,9 @@ static int run_apu_zerocopy(int* batch_sizes, int n_batches, int max_batch, int
 
 
 
+// mllb_persistent_infer resets the task flag to 0 once a batch is done
+#define MLLB_PK_DONE 0
+
 static int run_apu_persistent(int* batch_sizes, int n_batches, int max_batch, int RUNS, int* rand_floats_as_int) {
     
     hipCtx_t cuctx;
@@ -443,21 +447,21 @@ static int run_apu_persistent(int* batch_sizes, int n_batches, int max_batch, in
     gpu_get_cufunc(hsaco_path, "_Z21mllb_persistent_inferPfS_S_S_fS_PiS0_S0_", &persistent_kernel);
     void* h_inputs = kava_alloc(NR_FEAT * max_batch * sizeof(float));
     float* h_results = (float*)kava_alloc(max_batch * sizeof(float));
-    int* h_task_flag = (int*)kava_alloc(sizeof(int));
-    int* h_quit_flag = (int*)kava_alloc(sizeof(int));
-    int* h_batch_size = (int*)kava_alloc(sizeof(int));
-    *h_task_flag = 0; *h_quit_flag = 0; *h_batch_size = 0;
+    struct lake_pk *pk = lake_pk_create(MLLB_PK_DONE);
+    if (!pk) {
+        PRINT(V_ERROR, "Failed to create persistent kernel mailbox\n");
+        kava_free(h_inputs); kava_free(h_results);
+        vfree(flag_set_times); vfree(flag_wait_times); vfree(total_run_times);
+        return -1;
+    }
     hipHostRegister(h_inputs, NR_FEAT*max_batch*sizeof(float), hipHostRegisterMapped | hipExtHostRegisterCoarseGrained);
     hipHostRegister(h_results, max_batch*sizeof(float), hipHostRegisterMapped);
-    hipHostRegister(h_task_flag, sizeof(int), hipHostRegisterMapped | hipExtHostRegisterCoarseGrained);
-    hipHostRegister(h_quit_flag, sizeof(int), hipHostRegisterMapped);
-    hipHostRegister(h_batch_size, sizeof(int), hipHostRegisterMapped);
 
     void* d_inputs; hipHostGetDevicePointer(&d_inputs, h_inputs, 0);
     void* d_results; hipHostGetDevicePointer(&d_results, h_results, 0);
-    void* d_task_flag; hipHostGetDevicePointer(&d_task_flag, h_task_flag, 0);
-    void* d_quit_flag; hipHostGetDevicePointer(&d_quit_flag, h_quit_flag, 0);
-    void* d_batch_size; hipHostGetDevicePointer(&d_batch_size, h_batch_size, 0);
+    // the kernel reads the batch size from the mailbox's n
+    void *d_task_flag, *d_quit_flag, *d_batch_size;
+    lake_pk_device_ptrs(pk, &d_task_flag, &d_quit_flag, &d_batch_size);
 
     
 
@@ -466,25 +470,12 @@ static int run_apu_persistent(int* batch_sizes, int n_batches, int max_batch, in
  
         for (int z = 0; z < n_batches&&batch_sizes[z]<=4096; z++)
         {
-        *h_task_flag = 0; *h_quit_flag = 0; *h_batch_size = 0;
          // Launch persistent kernel
-        hipStream_t stream1;
-        #ifdef __KERNEL__
-        check_error(hipStreamCreate(&stream1,0), "hipStreamCreate1", __LINE__);
-        #else
-        check_error(hipStreamCreate(&stream1), "hipStreamCreate1", __LINE__);
-        #endif
         void* args[] = { &d_inputs, &d_w1, &d_b1, &d_w2, &b2, &d_results, &d_task_flag, &d_quit_flag, &d_batch_size };
         int threadsPerBlock = 256, blocks = 1;  
-        check_error(hipModuleLaunchKernel(persistent_kernel, blocks, 1, 1, threadsPerBlock, 1, 1, 0, stream1, args, NULL), "hipModuleLaunchKernel", __LINE__);
+        check_error(lake_pk_launch(pk, persistent_kernel, blocks, 1, 1, threadsPerBlock, 1, 1, 0, args), "lake_pk_launch", __LINE__);
         int rand_counter = 0;
         int batch_size = batch_sizes[z];
-        *h_batch_size = batch_size;
-        #ifdef __KERNEL__
-        mb();
-        #else
-        __sync_synchronize();
-        #endif
             int* linear_inputs = (int*)h_inputs;
             for (int j = 0 ; j < batch_size*NR_FEAT ; j++) {
                 linear_inputs[j] = rand_floats_as_int[rand_counter];
@@ -502,21 +493,19 @@ static int run_apu_persistent(int* batch_sizes, int n_batches, int max_batch, in
 
     // Warmup
     for (int j = 0 ; j < 10000; j++) { 
-        *h_task_flag = 1;
-        while (*h_task_flag == 1) {}
+        lake_pk_submit(pk, batch_size);
+        lake_pk_wait_done(pk, 0);
     }
         for (int j = 0 ; j < RUNS ; j++) { 
         t_start = ktime_get_ns();  
-        *h_task_flag = 1;
-        while (*h_task_flag == 1) {}
+        lake_pk_submit(pk, batch_size);
+        lake_pk_wait_done(pk, 0);
         t_stop = ktime_get_ns();
         total_run_times[j] = t_stop-t_start; // Only calculate wait time
     }
     
  
-    *h_quit_flag = 1;
-    hipStreamSynchronize(stream1);
-    check_error(hipStreamDestroy(stream1), "hipStreamDestroy stream1", __LINE__);
+    lake_pk_stop(pk);
 
 
     for (int j = 0 ; j < RUNS ; j++) {
@@ -529,10 +518,8 @@ static int run_apu_persistent(int* batch_sizes, int n_batches, int max_batch, in
     // Free resources
     hipHostUnregister(h_inputs); 
     hipHostUnregister(h_results);
-    hipHostUnregister(h_task_flag); 
-    hipHostUnregister(h_quit_flag); 
-    hipHostUnregister(h_batch_size);
-    kava_free(h_inputs); kava_free(h_results); kava_free(h_task_flag); kava_free(h_quit_flag); kava_free(h_batch_size);
+    lake_pk_destroy(pk);
+    kava_free(h_inputs); kava_free(h_results);
     vfree(flag_set_times); vfree(flag_wait_times); vfree(total_run_times);
     gpu_clean(NULL, d_w1, d_b1, d_w2, NULL);
     return 0;